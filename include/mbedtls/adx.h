@@ -0,0 +1,101 @@
+/**
+ * \file adx.h
+ *
+ * \brief MULX/ADCX/ADOX Montgomery multiplication for bignum
+ *
+ * \warning These functions are only for internal use by other library
+ *          functions; you must not call them directly.
+ */
+/*
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_ADX_H
+#define MBEDTLS_ADX_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Bits of CPUID.(EAX=07H,ECX=0):EBX */
+#define MBEDTLS_ADX_BMI2       0x00000100u
+#define MBEDTLS_ADX_ADX        0x00080000u
+
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) &&  \
+    ( defined(__amd64__) || defined(__x86_64__) )   &&  \
+    ! defined(MBEDTLS_HAVE_X86_64)
+#define MBEDTLS_HAVE_X86_64
+#endif
+
+#if defined(MBEDTLS_HAVE_X86_64)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          BMI2 / ADX features detection routine
+ *
+ * \param what     The features to detect (MBEDTLS_ADX_BMI2 for MULX,
+ *                 MBEDTLS_ADX_ADX for ADCX and ADOX, or both OR-ed)
+ *
+ * \return         1 if CPU has support for all of them, 0 otherwise
+ */
+int mbedtls_adx_has_support( unsigned int what );
+
+/**
+ * \brief          Montgomery multiplication with MULX, ADCX and ADOX:
+ *                 T[n..2n] = ( a * b + u * N ) / 2^(64 n), with u chosen
+ *                 so that the division is exact. The result is less than
+ *                 2N if a and b are less than N.
+ *
+ * \note           Only call this if mbedtls_adx_has_support() reports both
+ *                 MBEDTLS_ADX_BMI2 and MBEDTLS_ADX_ADX.
+ *
+ * \param n        Number of limbs of a, b and N (at least 1)
+ * \param a        First operand
+ * \param b        Second operand
+ * \param N        Odd modulus
+ * \param mm       -N^-1 mod 2^64
+ * \param T        Scratch space of 2n + 1 limbs, holding the result in
+ *                 its n + 1 upper limbs on return
+ */
+void mbedtls_adx_montmul( size_t n, const uint64_t *a, const uint64_t *b,
+                          const uint64_t *N, uint64_t mm, uint64_t *T );
+
+/**
+ * \brief          Montgomery squaring with MULX, ADCX and ADOX:
+ *                 T[n..2n] = ( a * a + u * N ) / 2^(64 n), computing each
+ *                 cross product of a once
+ *
+ * \note           Same requirements and parameters as mbedtls_adx_montmul().
+ */
+void mbedtls_adx_montsqr( size_t n, const uint64_t *a,
+                          const uint64_t *N, uint64_t mm, uint64_t *T );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_HAVE_X86_64 */
+
+#endif /* MBEDTLS_ADX_H */
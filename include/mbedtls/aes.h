@@ -246,6 +246,47 @@ int mbedtls_aes_crypt_ecb( mbedtls_aes_context *ctx,
                     const unsigned char input[16],
                     unsigned char output[16] );
 
+/**
+ * \brief          This function encrypts consecutive independent blocks,
+ *                 as for several calls to mbedtls_aes_crypt_ecb() with
+ *                 #MBEDTLS_AES_ENCRYPT.
+ *
+ *                 Without hardware acceleration, and if
+ *                 \c MBEDTLS_AES_BITSLICE is enabled, the blocks are
+ *                 processed eight at a time by the constant-time bitsliced
+ *                 implementation.
+ *
+ * \param ctx      The AES context, set up with mbedtls_aes_setkey_enc().
+ * \param nblocks  The number of 16-Byte blocks to encrypt.
+ * \param input    The buffer holding the input data (\p nblocks * 16 Bytes).
+ * \param output   The buffer holding the output data. It may be equal to
+ *                 \p input, but must not otherwise overlap it.
+ *
+ * \return         \c 0 on success.
+ */
+int mbedtls_aes_encrypt_blocks( mbedtls_aes_context *ctx,
+                                size_t nblocks,
+                                const unsigned char *input,
+                                unsigned char *output );
+
+/**
+ * \brief          This function decrypts consecutive independent blocks,
+ *                 as for several calls to mbedtls_aes_crypt_ecb() with
+ *                 #MBEDTLS_AES_DECRYPT.
+ *
+ * \param ctx      The AES context, set up with mbedtls_aes_setkey_dec().
+ * \param nblocks  The number of 16-Byte blocks to decrypt.
+ * \param input    The buffer holding the input data (\p nblocks * 16 Bytes).
+ * \param output   The buffer holding the output data. It may be equal to
+ *                 \p input, but must not otherwise overlap it.
+ *
+ * \return         \c 0 on success.
+ */
+int mbedtls_aes_decrypt_blocks( mbedtls_aes_context *ctx,
+                                size_t nblocks,
+                                const unsigned char *input,
+                                unsigned char *output );
+
 #if defined(MBEDTLS_CIPHER_MODE_CBC)
 /**
  * \brief  This function performs an AES-CBC encryption or decryption operation
@@ -333,6 +374,88 @@ int mbedtls_aes_crypt_xts( mbedtls_aes_xts_context *ctx,
                            const unsigned char data_unit[16],
                            const unsigned char *input,
                            unsigned char *output );
+
+/**
+ * \brief The description of one data unit (for example a disk sector)
+ *        processed by mbedtls_aes_crypt_xts_multi().
+ */
+typedef struct mbedtls_aes_xts_sector
+{
+    uint64_t data_unit;             /*!< The data unit number, such as the
+                                         sector index. It is used as the
+                                         little-endian 16-byte data unit
+                                         address of mbedtls_aes_crypt_xts(). */
+    const unsigned char *input;     /*!< The input data unit. */
+    unsigned char *output;          /*!< The output data unit. It may be
+                                         equal to \c input. */
+} mbedtls_aes_xts_sector;
+
+/**
+ * \brief      This function performs AES-XTS encryption or decryption of
+ *             many data units of the same length.
+ *
+ *             The result for each data unit is the same as that of
+ *             mbedtls_aes_crypt_xts(). The tweaks of consecutive data units
+ *             are computed together, and with AES-NI the blocks of a data
+ *             unit are processed four at a time.
+ *
+ * \param ctx          The AES XTS context to use for AES XTS operations.
+ * \param mode         The AES operation: #MBEDTLS_AES_ENCRYPT or
+ *                     #MBEDTLS_AES_DECRYPT.
+ * \param length       The length of each data unit in bytes, with the same
+ *                     limits as for mbedtls_aes_crypt_xts().
+ * \param sectors      The \p count data units.
+ * \param count        The number of data units.
+ *
+ * \return             \c 0 on success.
+ * \return             #MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH if \p length is
+ *                     out of range.
+ * \return             #MBEDTLS_ERR_AES_BAD_INPUT_DATA if \p sectors is
+ *                     \c NULL.
+ */
+int mbedtls_aes_crypt_xts_multi( mbedtls_aes_xts_context *ctx,
+                                 int mode,
+                                 size_t length,
+                                 const mbedtls_aes_xts_sector *sectors,
+                                 size_t count );
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/**
+ * \brief      This function performs the same operation as
+ *             mbedtls_aes_crypt_xts_multi(), with the data units split
+ *             between several threads.
+ *
+ *             Each data unit has its own tweak, so contiguous runs of
+ *             them are encrypted independently: the calling thread takes
+ *             the first run and one thread is started for each of the
+ *             other \p threads - 1 (at most 15). Starting and joining a
+ *             thread costs about as much as encrypting a few tens of
+ *             kilobytes with AES-NI, so each thread should get at least a
+ *             few hundred kilobytes.
+ *
+ * \note       The tweak and data keys in \p ctx are used by all the
+ *             threads at once, so the context must not be set up again or
+ *             freed until this function returns.
+ *
+ * \param ctx          The AES XTS context to use for AES XTS operations.
+ * \param mode         The AES operation: #MBEDTLS_AES_ENCRYPT or
+ *                     #MBEDTLS_AES_DECRYPT.
+ * \param length       The length of each data unit in bytes.
+ * \param sectors      The \p count data units.
+ * \param count        The number of data units.
+ * \param threads      The number of threads to use, including the calling
+ *                     thread.
+ *
+ * \return             \c 0 on success, or the same errors as
+ *                     mbedtls_aes_crypt_xts_multi().
+ */
+int mbedtls_aes_crypt_xts_multi_threads( mbedtls_aes_xts_context *ctx,
+                                         int mode,
+                                         size_t length,
+                                         const mbedtls_aes_xts_sector *sectors,
+                                         size_t count,
+                                         unsigned int threads );
+#endif /* MBEDTLS_THREADING_PTHREAD */
 #endif /* MBEDTLS_CIPHER_MODE_XTS */
 
 #if defined(MBEDTLS_CIPHER_MODE_CFB)
@@ -563,6 +686,27 @@ int mbedtls_internal_aes_encrypt( mbedtls_aes_context *ctx,
                                   const unsigned char input[16],
                                   unsigned char output[16] );
 
+#if defined(MBEDTLS_AES_BITSLICE)
+/**
+ * \brief           Internal bitsliced AES encryption of several blocks.
+ *                  It runs in constant time and does not use the AES tables.
+ *                  This is exposed for testing and benchmarking; use
+ *                  mbedtls_aes_encrypt_blocks() instead.
+ *
+ * \param ctx       The AES context to use for encryption.
+ * \param nblocks   The number of 16-Byte blocks.
+ * \param input     The plaintext blocks.
+ * \param output    The output (ciphertext) blocks. It may be equal to
+ *                  \p input, but must not otherwise overlap it.
+ *
+ * \return          \c 0 on success.
+ */
+int mbedtls_internal_aes_encrypt_bitsliced( mbedtls_aes_context *ctx,
+                                            size_t nblocks,
+                                            const unsigned char *input,
+                                            unsigned char *output );
+#endif /* MBEDTLS_AES_BITSLICE */
+
 /**
  * \brief           Internal AES block decryption function. This is only
  *                  exposed to allow overriding it using see
@@ -28,6 +28,7 @@
 
 #define MBEDTLS_AESNI_AES      0x02000000u
 #define MBEDTLS_AESNI_CLMUL    0x00000002u
+#define MBEDTLS_AESNI_SSSE3    0x00000200u
 
 #if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) &&  \
     ( defined(__amd64__) || defined(__x86_64__) )   &&  \
@@ -45,7 +46,8 @@ extern "C" {
  * \brief          AES-NI features detection routine
  *
  * \param what     The feature to detect
- *                 (MBEDTLS_AESNI_AES or MBEDTLS_AESNI_CLMUL)
+ *                 (MBEDTLS_AESNI_AES, MBEDTLS_AESNI_CLMUL or
+ *                 MBEDTLS_AESNI_SSSE3)
  *
  * \return         1 if CPU has support for the feature, 0 otherwise
  */
@@ -66,6 +68,76 @@ int mbedtls_aesni_crypt_ecb( mbedtls_aes_context *ctx,
                      const unsigned char input[16],
                      unsigned char output[16] );
 
+/**
+ * \brief          AES-NI AES-ECB encryption of consecutive blocks,
+ *                 interleaved four at a time
+ *
+ * \param ctx      AES context set up for encryption
+ * \param nblocks  Number of 16-byte blocks
+ * \param input    Input blocks
+ * \param output   Output blocks (may be equal to input)
+ *
+ * \return         0 on success (cannot fail)
+ */
+int mbedtls_aesni_encrypt_blocks( mbedtls_aes_context *ctx,
+                                  size_t nblocks,
+                                  const unsigned char *input,
+                                  unsigned char *output );
+
+/**
+ * \brief          AES-NI AES-ECB decryption of consecutive blocks,
+ *                 interleaved four at a time
+ *
+ * \param ctx      AES context set up for decryption
+ * \param nblocks  Number of 16-byte blocks
+ * \param input    Input blocks
+ * \param output   Output blocks (may be equal to input)
+ *
+ * \return         0 on success (cannot fail)
+ */
+int mbedtls_aesni_decrypt_blocks( mbedtls_aes_context *ctx,
+                                  size_t nblocks,
+                                  const unsigned char *input,
+                                  unsigned char *output );
+
+/**
+ * \brief          AES-NI CCM payload processing: CBC-MAC and CTR of whole
+ *                 blocks, with the two AES computations interleaved
+ *
+ * \param ctx      AES context set up for encryption
+ * \param mode     MBEDTLS_AES_ENCRYPT or MBEDTLS_AES_DECRYPT
+ * \param nblocks  Number of 16-byte blocks
+ * \param ctr      CTR counter block, updated to the block after the last
+ *                 one used; the caller guarantees that the big-endian
+ *                 increment does not overflow the CCM counter field
+ * \param y        CBC-MAC state, updated
+ * \param input    Input blocks
+ * \param output   Output blocks (may be equal to input)
+ */
+void mbedtls_aesni_ccm_crypt( mbedtls_aes_context *ctx, int mode,
+                              size_t nblocks,
+                              unsigned char ctr[16], unsigned char y[16],
+                              const unsigned char *input,
+                              unsigned char *output );
+
+/**
+ * \brief          AES-NI XTS en(de)cryption of consecutive whole blocks of
+ *                 one data unit, four at a time
+ *
+ * \param ctx      AES context set up for \p mode
+ * \param mode     MBEDTLS_AES_ENCRYPT or MBEDTLS_AES_DECRYPT
+ * \param nblocks  Number of 16-byte blocks, a multiple of 4 (any remainder
+ *                 is left to the caller)
+ * \param tweak    Tweak of the first block, updated to that of the block
+ *                 after the last one processed
+ * \param input    Input blocks
+ * \param output   Output blocks (may be equal to input)
+ */
+void mbedtls_aesni_xts_crypt( mbedtls_aes_context *ctx, int mode,
+                              size_t nblocks, unsigned char tweak[16],
+                              const unsigned char *input,
+                              unsigned char *output );
+
 /**
  * \brief          GCM multiplication: c = a * b in GF(2^128)
  *
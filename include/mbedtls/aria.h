@@ -151,6 +151,30 @@ int mbedtls_aria_crypt_ecb( mbedtls_aria_context *ctx,
                             const unsigned char input[MBEDTLS_ARIA_BLOCKSIZE],
                             unsigned char output[MBEDTLS_ARIA_BLOCKSIZE] );
 
+/**
+ * \brief          This function performs ARIA encryption or decryption of
+ *                 consecutive independent blocks, as for several calls to
+ *                 mbedtls_aria_crypt_ecb().
+ *
+ *                 The direction is the one the key was set up for. On x86-64
+ *                 processors with AES-NI, the blocks are processed sixteen at
+ *                 a time by a byte-sliced implementation that computes the
+ *                 S-boxes with the AES instructions.
+ *
+ * \param ctx      The ARIA context to use for encryption or decryption.
+ * \param nblocks  The number of 16-Byte blocks.
+ * \param input    The buffer holding the input data
+ *                 (\p nblocks * 16 Bytes).
+ * \param output   The buffer holding the output data. It may be equal to
+ *                 \p input, but must not otherwise overlap it.
+ *
+ * \return         \c 0 on success.
+ */
+int mbedtls_aria_crypt_blocks( mbedtls_aria_context *ctx,
+                               size_t nblocks,
+                               const unsigned char *input,
+                               unsigned char *output );
+
 #if defined(MBEDTLS_CIPHER_MODE_CBC)
 /**
  * \brief  This function performs an ARIA-CBC encryption or decryption operation
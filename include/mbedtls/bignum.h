@@ -58,8 +58,9 @@
  * Maximum window size used for modular exponentiation. Default: 6
  * Minimum value: 1. Maximum value: 6.
  *
- * Result is an array of ( 2 << MBEDTLS_MPI_WINDOW_SIZE ) MPIs used
- * for the sliding window calculation. (So 64 by default)
+ * Result is a table of ( 1 << ( MBEDTLS_MPI_WINDOW_SIZE - 1 ) ) + 1 MPIs
+ * used for the sliding window calculation, taken from an mbedtls_mpi_arena.
+ * (So 33 by default)
  *
  * Reduction in size, reduces speed.
  */
@@ -79,6 +80,28 @@
 
 #define MBEDTLS_MPI_MAX_BITS                              ( 8 * MBEDTLS_MPI_MAX_SIZE )    /**< Maximum number of bits for usable MPIs. */
 
+#if !defined(MBEDTLS_MPI_KARATSUBA_THRESHOLD)
+/*
+ * Number of limbs from which multiplications of operands of the same size
+ * use Karatsuba's method rather than the schoolbook method. Squarings use
+ * it from twice this number of limbs. Must be at least 4.
+ *
+ * The default is tuned for 64-bit limbs on x86-64.
+ */
+#define MBEDTLS_MPI_KARATSUBA_THRESHOLD                   40       /**< Minimum number of limbs for Karatsuba multiplication. */
+#endif /* !MBEDTLS_MPI_KARATSUBA_THRESHOLD */
+
+#if MBEDTLS_MPI_KARATSUBA_THRESHOLD < 4
+#error "MBEDTLS_MPI_KARATSUBA_THRESHOLD must be at least 4"
+#endif
+
+/*
+ * Number of temporaries held by an mbedtls_mpi_arena: the window table of
+ * mbedtls_mpi_exp_mod_arena() plus the other temporaries of the RSA, DHM and
+ * ECP operations that take their temporaries from an arena.
+ */
+#define MBEDTLS_MPI_ARENA_SIZE          ( ( 1 << ( MBEDTLS_MPI_WINDOW_SIZE - 1 ) ) + 24 )
+
 /*
  * When reading from files with mbedtls_mpi_read_file() and writing to files with
  * mbedtls_mpi_write_file() the buffer should have space
@@ -185,6 +208,22 @@ typedef struct mbedtls_mpi
 }
 mbedtls_mpi;
 
+/**
+ * \brief          Scratch arena of MPI temporaries
+ *
+ *                 Temporaries are taken from the arena in stack order and
+ *                 released in bulk. A released temporary keeps its limbs,
+ *                 so that the next user of the same slot only allocates
+ *                 memory if it needs more limbs than any previous user.
+ *                 All limbs are wiped and freed by mbedtls_mpi_arena_free().
+ */
+typedef struct mbedtls_mpi_arena
+{
+    mbedtls_mpi T[MBEDTLS_MPI_ARENA_SIZE];  /*!<  temporaries               */
+    size_t used;                            /*!<  # of temporaries in use   */
+}
+mbedtls_mpi_arena;
+
 /**
  * \brief           Initialize one MPI (make internal references valid)
  *                  This just makes it ready to be set or freed,
@@ -229,6 +268,53 @@ int mbedtls_mpi_grow( mbedtls_mpi *X, size_t nblimbs );
  */
 int mbedtls_mpi_shrink( mbedtls_mpi *X, size_t nblimbs );
 
+/**
+ * \brief          Initialize an MPI arena
+ *
+ * \param arena    Arena to initialize
+ */
+void mbedtls_mpi_arena_init( mbedtls_mpi_arena *arena );
+
+/**
+ * \brief          Wipe and free all temporaries of an MPI arena
+ *
+ * \param arena    Arena to free
+ */
+void mbedtls_mpi_arena_free( mbedtls_mpi_arena *arena );
+
+/**
+ * \brief          Take a temporary from an MPI arena
+ *
+ *                 The temporary is set to 0. It remains valid until the
+ *                 arena is released to a mark taken before this call.
+ *
+ * \param arena    Arena to take the temporary from
+ * \param X        Address of the pointer to the temporary
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if all MBEDTLS_MPI_ARENA_SIZE
+ *                 temporaries are in use
+ */
+int mbedtls_mpi_arena_get( mbedtls_mpi_arena *arena, mbedtls_mpi **X );
+
+/**
+ * \brief          Mark the current position of an MPI arena
+ *
+ * \param arena    Arena to mark
+ *
+ * \return         The mark, to pass to mbedtls_mpi_arena_release()
+ */
+size_t mbedtls_mpi_arena_mark( const mbedtls_mpi_arena *arena );
+
+/**
+ * \brief          Release all temporaries taken from an MPI arena since
+ *                 a mark
+ *
+ * \param arena    Arena to release the temporaries of
+ * \param mark     Value returned by mbedtls_mpi_arena_mark()
+ */
+void mbedtls_mpi_arena_release( mbedtls_mpi_arena *arena, size_t mark );
+
 /**
  * \brief          Copy the contents of Y into X
  *
@@ -646,6 +732,25 @@ int mbedtls_mpi_div_int( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A, m
  */
 int mbedtls_mpi_mod_mpi( mbedtls_mpi *R, const mbedtls_mpi *A, const mbedtls_mpi *B );
 
+/**
+ * \brief          Modulo: R = A mod B, with temporaries from an arena
+ *
+ *                 Same as mbedtls_mpi_mod_mpi(), except that the temporaries
+ *                 are taken from \p arena and released before returning.
+ *
+ * \param R        Destination MPI for the rest value
+ * \param A        Left-hand MPI
+ * \param B        Right-hand MPI
+ * \param arena    Arena to take temporaries from
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed,
+ *                 MBEDTLS_ERR_MPI_DIVISION_BY_ZERO if B == 0,
+ *                 MBEDTLS_ERR_MPI_NEGATIVE_VALUE if B < 0
+ */
+int mbedtls_mpi_mod_mpi_arena( mbedtls_mpi *R, const mbedtls_mpi *A,
+                               const mbedtls_mpi *B, mbedtls_mpi_arena *arena );
+
 /**
  * \brief          Modulo: r = A mod b
  *
@@ -680,6 +785,30 @@ int mbedtls_mpi_mod_int( mbedtls_mpi_uint *r, const mbedtls_mpi *A, mbedtls_mpi_
  */
 int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *E, const mbedtls_mpi *N, mbedtls_mpi *_RR );
 
+/**
+ * \brief          Sliding-window exponentiation: X = A^E mod N, with
+ *                 temporaries from an arena
+ *
+ *                 Same as mbedtls_mpi_exp_mod(), except that the window
+ *                 table and the other temporaries are taken from \p arena
+ *                 and released before returning.
+ *
+ * \param X        Destination MPI
+ * \param A        Left-hand MPI
+ * \param E        Exponent MPI
+ * \param N        Modular MPI
+ * \param _RR      Speed-up MPI used for recalculations
+ * \param arena    Arena to take temporaries from
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed,
+ *                 MBEDTLS_ERR_MPI_BAD_INPUT_DATA if N is negative or even or
+ *                 if E is negative
+ */
+int mbedtls_mpi_exp_mod_arena( mbedtls_mpi *X, const mbedtls_mpi *A,
+                               const mbedtls_mpi *E, const mbedtls_mpi *N,
+                               mbedtls_mpi *_RR, mbedtls_mpi_arena *arena );
+
 /**
  * \brief          Fill an MPI X with size bytes of random
  *
@@ -118,6 +118,28 @@ int mbedtls_camellia_crypt_ecb( mbedtls_camellia_context *ctx,
                     const unsigned char input[16],
                     unsigned char output[16] );
 
+/**
+ * \brief          CAMELLIA-ECB en/decryption of consecutive independent
+ *                 blocks, as for several calls to mbedtls_camellia_crypt_ecb()
+ *
+ *                 The direction is the one the key was set up for. On x86-64
+ *                 processors with AES-NI, the blocks are processed sixteen at
+ *                 a time by a byte-sliced implementation that computes the
+ *                 S-boxes with the AES instructions.
+ *
+ * \param ctx      CAMELLIA context
+ * \param nblocks  number of 16-byte blocks
+ * \param input    buffer holding the input data (\p nblocks * 16 bytes)
+ * \param output   buffer holding the output data. It may be equal to
+ *                 \p input, but must not otherwise overlap it.
+ *
+ * \return         0 if successful
+ */
+int mbedtls_camellia_crypt_blocks( mbedtls_camellia_context *ctx,
+                                   size_t nblocks,
+                                   const unsigned char *input,
+                                   unsigned char *output );
+
 #if defined(MBEDTLS_CIPHER_MODE_CBC)
 /**
  * \brief          CAMELLIA-CBC buffer encryption/decryption
@@ -257,6 +257,75 @@ int mbedtls_ccm_star_auth_decrypt( mbedtls_ccm_context *ctx, size_t length,
                       const unsigned char *input, unsigned char *output,
                       const unsigned char *tag, size_t tag_len );
 
+#if !defined(MBEDTLS_CCM_ALT)
+/**
+ * \brief           This function encrypts a message spread over several
+ *                  buffers, like mbedtls_ccm_encrypt_and_tag().
+ *
+ *                  Blocks are gathered from \p src and scattered to \p dst
+ *                  one at a time, so segments may have any length.
+ *
+ * \param ctx       The CCM context to use for encryption.
+ * \param iv        Initialization vector (nonce).
+ * \param iv_len    The length of the nonce in Bytes: 7, 8, 9, 10, 11, 12,
+ *                  or 13.
+ * \param add       The additional data field.
+ * \param add_len   The length of additional data in Bytes.
+ *                  Must be less than 2^16 - 2^8.
+ * \param src       The plaintext segments. Their total length is the
+ *                  message length.
+ * \param src_count The number of plaintext segments.
+ * \param dst       The ciphertext segments, holding at least as many Bytes
+ *                  as \p src, or NULL to encrypt in place.
+ * \param dst_count The number of ciphertext segments.
+ * \param tag       The buffer holding the authentication field.
+ * \param tag_len   The length of the authentication field to generate in
+ *                  Bytes: 4, 6, 8, 10, 12, 14 or 16.
+ *
+ * \return          \c 0 on success.
+ * \return          A CCM or cipher-specific error code on failure.
+ */
+int mbedtls_ccm_encrypt_and_tag_iov( mbedtls_ccm_context *ctx,
+                         const unsigned char *iv, size_t iv_len,
+                         const unsigned char *add, size_t add_len,
+                         const mbedtls_cipher_iov *src, size_t src_count,
+                         const mbedtls_cipher_iov *dst, size_t dst_count,
+                         unsigned char *tag, size_t tag_len );
+
+/**
+ * \brief           This function decrypts a message spread over several
+ *                  buffers, like mbedtls_ccm_auth_decrypt().
+ *
+ * \param ctx       The CCM context to use for decryption.
+ * \param iv        Initialization vector (nonce).
+ * \param iv_len    The length of the nonce in Bytes: 7, 8, 9, 10, 11, 12,
+ *                  or 13.
+ * \param add       The additional data field.
+ * \param add_len   The length of additional data in Bytes.
+ *                  Must be less than 2^16 - 2^8.
+ * \param src       The ciphertext segments. Their total length is the
+ *                  message length.
+ * \param src_count The number of ciphertext segments.
+ * \param dst       The plaintext segments, holding at least as many Bytes
+ *                  as \p src, or NULL to decrypt in place. They are zeroed
+ *                  out if the tag does not match.
+ * \param dst_count The number of plaintext segments.
+ * \param tag       The buffer holding the authentication field.
+ * \param tag_len   The length of the authentication field in Bytes.
+ *                  4, 6, 8, 10, 12, 14 or 16.
+ *
+ * \return          \c 0 on success. This indicates that the message is authentic.
+ * \return          #MBEDTLS_ERR_CCM_AUTH_FAILED if the tag does not match.
+ * \return          A cipher-specific error code on calculation failure.
+ */
+int mbedtls_ccm_auth_decrypt_iov( mbedtls_ccm_context *ctx,
+                         const unsigned char *iv, size_t iv_len,
+                         const unsigned char *add, size_t add_len,
+                         const mbedtls_cipher_iov *src, size_t src_count,
+                         const mbedtls_cipher_iov *dst, size_t dst_count,
+                         const unsigned char *tag, size_t tag_len );
+#endif /* !MBEDTLS_CCM_ALT */
+
 #if defined(MBEDTLS_SELF_TEST) && defined(MBEDTLS_AES_C)
 /**
  * \brief          The CCM checkup routine.
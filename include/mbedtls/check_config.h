@@ -66,10 +66,25 @@
 #error "MBEDTLS_HAVE_TIME_DATE without MBEDTLS_HAVE_TIME does not make sense"
 #endif
 
+#if defined(MBEDTLS_ADX_C) && !defined(MBEDTLS_HAVE_ASM)
+#error "MBEDTLS_ADX_C defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_AESNI_C) && !defined(MBEDTLS_HAVE_ASM)
 #error "MBEDTLS_AESNI_C defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_AES_BITSLICE) &&                                    \
+    ( !defined(MBEDTLS_AES_C) || defined(MBEDTLS_AES_ALT) ||            \
+      defined(MBEDTLS_AES_SETKEY_ENC_ALT) ||                            \
+      defined(MBEDTLS_AES_ENCRYPT_ALT) )
+#error "MBEDTLS_AES_BITSLICE defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_SHANI_C) && !defined(MBEDTLS_HAVE_ASM)
+#error "MBEDTLS_SHANI_C defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_CTR_DRBG_C) && !defined(MBEDTLS_AES_C)
 #error "MBEDTLS_CTR_DRBG_C defined, but not all prerequisites"
 #endif
@@ -122,6 +137,11 @@
 #error "MBEDTLS_ECDSA_DETERMINISTIC defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL) && ( !defined(MBEDTLS_ECDSA_C) ||  \
+    defined(MBEDTLS_ECDSA_SIGN_ALT) )
+#error "MBEDTLS_ECDSA_NONCE_POOL defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_ECP_C) && ( !defined(MBEDTLS_BIGNUM_C) || (   \
     !defined(MBEDTLS_ECP_DP_SECP192R1_ENABLED) &&                  \
     !defined(MBEDTLS_ECP_DP_SECP224R1_ENABLED) &&                  \
@@ -137,6 +157,23 @@
 #error "MBEDTLS_ECP_C defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_ECP_P256_C) && ( !defined(MBEDTLS_ECP_C) ||    \
+    !defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED) ||                  \
+    defined(MBEDTLS_ECP_ALT) )
+#error "MBEDTLS_ECP_P256_C defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_ECP_X25519_C) && ( !defined(MBEDTLS_ECP_C) ||  \
+    !defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED) ||                 \
+    defined(MBEDTLS_ECP_ALT) )
+#error "MBEDTLS_ECP_X25519_C defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE) && ( !defined(MBEDTLS_ECP_C) ||  \
+    defined(MBEDTLS_ECP_ALT) )
+#error "MBEDTLS_ECP_PRECOMP_CACHE defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_ENTROPY_C) && (!defined(MBEDTLS_SHA512_C) &&      \
                                     !defined(MBEDTLS_SHA256_C))
 #error "MBEDTLS_ENTROPY_C defined, but not all prerequisites"
@@ -155,6 +192,16 @@
 #error "MBEDTLS_ENTROPY_FORCE_SHA256 defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_ENTROPY_SHARDS) && \
+    ( !defined(MBEDTLS_ENTROPY_C) || MBEDTLS_ENTROPY_SHARDS < 1 )
+#error "MBEDTLS_ENTROPY_SHARDS defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_ENTROPY_SHARDS) && defined(MBEDTLS_THREADING_C) && \
+    defined(MBEDTLS_HAVEGE_C)
+#error "MBEDTLS_ENTROPY_SHARDS with MBEDTLS_THREADING_C is incompatible with MBEDTLS_HAVEGE_C"
+#endif
+
 #if defined(MBEDTLS_TEST_NULL_ENTROPY) && \
     ( !defined(MBEDTLS_ENTROPY_C) || !defined(MBEDTLS_NO_DEFAULT_ENTROPY_SOURCES) )
 #error "MBEDTLS_TEST_NULL_ENTROPY defined, but not all prerequisites"
@@ -170,6 +217,11 @@
 #error "MBEDTLS_GCM_C defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_GCM_TABLE_BITS) &&                                  \
+    MBEDTLS_GCM_TABLE_BITS != 4 && MBEDTLS_GCM_TABLE_BITS != 8
+#error "MBEDTLS_GCM_TABLE_BITS must be 4 or 8"
+#endif
+
 #if defined(MBEDTLS_ECP_RANDOMIZE_JAC_ALT) && !defined(MBEDTLS_ECP_INTERNAL_ALT)
 #error "MBEDTLS_ECP_RANDOMIZE_JAC_ALT defined, but not all prerequisites"
 #endif
@@ -538,6 +590,11 @@
 #error "MBEDTLS_RSA_C defined, but none of the PKCS1 versions enabled"
 #endif
 
+#if defined(MBEDTLS_RSA_CRT_POOL) && ( !defined(MBEDTLS_RSA_C) ||       \
+    !defined(MBEDTLS_THREADING_PTHREAD) || defined(MBEDTLS_RSA_NO_CRT) )
+#error "MBEDTLS_RSA_CRT_POOL defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_X509_RSASSA_PSS_SUPPORT) &&                        \
     ( !defined(MBEDTLS_RSA_C) || !defined(MBEDTLS_PKCS1_V21) )
 #error "MBEDTLS_X509_RSASSA_PSS_SUPPORT defined, but not all prerequisites"
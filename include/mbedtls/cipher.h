@@ -277,6 +277,19 @@ typedef struct mbedtls_cipher_info_t
 
 } mbedtls_cipher_info_t;
 
+/**
+ * One segment of a scatter/gather buffer, for the _iov() functions.
+ *
+ * Input segments are only read, unless the same segments are used for
+ * output. Segments may have zero length.
+ */
+typedef struct mbedtls_cipher_iov
+{
+    unsigned char *base;    /*!< Start of the segment. */
+    size_t len;             /*!< Length of the segment, in Bytes. */
+}
+mbedtls_cipher_iov;
+
 /**
  * Generic cipher context.
  */
@@ -441,6 +454,13 @@ int mbedtls_cipher_setup( mbedtls_cipher_context_t *ctx,
  *                      the same tag length.
  *                      For non-AEAD ciphers, the value must be \c 0.
  *
+ * \note                Besides AEAD ciphers, the supported modes are CBC
+ *                      without padding, CTR, CFB and OFB. Contexts in these
+ *                      modes can stream data with mbedtls_cipher_set_iv(),
+ *                      mbedtls_cipher_reset(), mbedtls_cipher_update() and
+ *                      mbedtls_cipher_finish(), which drive a multi-part
+ *                      PSA cipher operation.
+ *
  * \return              \c 0 on success.
  * \return              #MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA on
  *                      parameter-verification failure.
@@ -703,6 +723,49 @@ int mbedtls_cipher_update( mbedtls_cipher_context_t *ctx,
                            size_t ilen, unsigned char *output,
                            size_t *olen );
 
+/**
+ * \brief               Scatter/gather variant of mbedtls_cipher_update().
+ *                      The input is the concatenation of the \p src
+ *                      segments, and the output is written to the \p dst
+ *                      segments as if they were one contiguous buffer.
+ *
+ *                      Data is processed directly in the segments: only
+ *                      cipher blocks that straddle a segment boundary are
+ *                      copied. Supported modes are CBC, CFB, OFB, CTR,
+ *                      stream ciphers, GCM and ChaCha20+Poly1305.
+ *
+ * \note                Pass \p dst = NULL to operate in place, writing the
+ *                      output over the input. Unlike mbedtls_cipher_update(),
+ *                      this is allowed for any length, except that in CBC
+ *                      mode the context must not hold a partial block from
+ *                      a previous call.
+ *
+ * \note                In GCM mode, the total length of all calls except
+ *                      the last one before mbedtls_cipher_finish() must be
+ *                      a multiple of the block size of the cipher.
+ *
+ * \param ctx           The generic cipher context.
+ * \param src           The input segments.
+ * \param src_count     The number of input segments.
+ * \param dst           The output segments, or NULL for in-place operation.
+ * \param dst_count     The number of output segments. Ignored if \p dst is
+ *                      NULL.
+ * \param olen          The length of the output data, to be updated with the
+ *                      actual number of Bytes written.
+ *
+ * \return              \c 0 on success.
+ * \return              #MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA on
+ *                      parameter-verification failure, including output
+ *                      segments too short for the output.
+ * \return              #MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE on an
+ *                      unsupported mode for a cipher.
+ * \return              A cipher-specific error code on failure.
+ */
+int mbedtls_cipher_update_iov( mbedtls_cipher_context_t *ctx,
+                               const mbedtls_cipher_iov *src, size_t src_count,
+                               const mbedtls_cipher_iov *dst, size_t dst_count,
+                               size_t *olen );
+
 /**
  * \brief               The generic cipher finalization function. If data still
  *                      needs to be flushed from an incomplete block, the data
@@ -856,6 +919,76 @@ int mbedtls_cipher_auth_decrypt( mbedtls_cipher_context_t *ctx,
                          const unsigned char *input, size_t ilen,
                          unsigned char *output, size_t *olen,
                          const unsigned char *tag, size_t tag_len );
+
+/**
+ * \brief             Scatter/gather variant of mbedtls_cipher_auth_encrypt(),
+ *                    for GCM, CCM and ChaCha20+Poly1305.
+ *
+ * \param ctx         The generic cipher context.
+ * \param iv          The IV to use.
+ * \param iv_len      The IV length for ciphers with variable-size IV.
+ * \param ad          The additional data to authenticate.
+ * \param ad_len      The length of \p ad.
+ * \param src         The plaintext segments.
+ * \param src_count   The number of plaintext segments.
+ * \param dst         The ciphertext segments, with room for at least as many
+ *                    Bytes as \p src holds, or NULL to encrypt in place.
+ * \param dst_count   The number of ciphertext segments. Ignored if \p dst is
+ *                    NULL.
+ * \param olen        The length of the output data, to be updated with the
+ *                    actual number of Bytes written.
+ * \param tag         The buffer for the authentication tag.
+ * \param tag_len     The desired length of the authentication tag.
+ *
+ * \return            \c 0 on success.
+ * \return            #MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA on
+ *                    parameter-verification failure.
+ * \return            A cipher-specific error code on failure.
+ */
+int mbedtls_cipher_auth_encrypt_iov( mbedtls_cipher_context_t *ctx,
+                         const unsigned char *iv, size_t iv_len,
+                         const unsigned char *ad, size_t ad_len,
+                         const mbedtls_cipher_iov *src, size_t src_count,
+                         const mbedtls_cipher_iov *dst, size_t dst_count,
+                         size_t *olen,
+                         unsigned char *tag, size_t tag_len );
+
+/**
+ * \brief             Scatter/gather variant of mbedtls_cipher_auth_decrypt(),
+ *                    for GCM, CCM and ChaCha20+Poly1305.
+ *
+ * \note              If the data is not authentic, then the output segments
+ *                    are zeroed out.
+ *
+ * \param ctx         The generic cipher context.
+ * \param iv          The IV to use.
+ * \param iv_len      The IV length for ciphers with variable-size IV.
+ * \param ad          The additional data to be authenticated.
+ * \param ad_len      The length of \p ad.
+ * \param src         The ciphertext segments.
+ * \param src_count   The number of ciphertext segments.
+ * \param dst         The plaintext segments, with room for at least as many
+ *                    Bytes as \p src holds, or NULL to decrypt in place.
+ * \param dst_count   The number of plaintext segments. Ignored if \p dst is
+ *                    NULL.
+ * \param olen        The length of the output data, to be updated with the
+ *                    actual number of Bytes written.
+ * \param tag         The buffer holding the authentication tag.
+ * \param tag_len     The length of the authentication tag.
+ *
+ * \return            \c 0 on success.
+ * \return            #MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA on
+ *                    parameter-verification failure.
+ * \return            #MBEDTLS_ERR_CIPHER_AUTH_FAILED if data is not authentic.
+ * \return            A cipher-specific error code on failure.
+ */
+int mbedtls_cipher_auth_decrypt_iov( mbedtls_cipher_context_t *ctx,
+                         const unsigned char *iv, size_t iv_len,
+                         const unsigned char *ad, size_t ad_len,
+                         const mbedtls_cipher_iov *src, size_t src_count,
+                         const mbedtls_cipher_iov *dst, size_t dst_count,
+                         size_t *olen,
+                         const unsigned char *tag, size_t tag_len );
 #endif /* MBEDTLS_CIPHER_MODE_AEAD */
 
 #ifdef __cplusplus
@@ -139,9 +139,49 @@ typedef struct
     psa_algorithm_t alg;
     psa_key_slot_t slot;
     mbedtls_cipher_psa_key_ownership slot_state;
+    psa_cipher_operation_t op;  /* Multi-part operation behind update() */
+    int op_started;             /* op is set up with the key and the IV  */
 } mbedtls_cipher_context_psa;
 #endif /* MBEDTLS_USE_PSA_CRYPTO */
 
+/**
+ * Position in a list of mbedtls_cipher_iov segments
+ */
+typedef struct
+{
+    const mbedtls_cipher_iov *iov;  /*!< current segment                */
+    size_t count;                   /*!< segments left, including it    */
+    size_t off;                     /*!< offset in the current segment  */
+}
+mbedtls_cipher_iov_cursor;
+
+/** Start a cursor at the beginning of \p count segments */
+void mbedtls_cipher_iov_cursor_init( mbedtls_cipher_iov_cursor *cur,
+                                     const mbedtls_cipher_iov *iov,
+                                     size_t count );
+
+/** Total length of \p count segments */
+size_t mbedtls_cipher_iov_len( const mbedtls_cipher_iov *iov, size_t count );
+
+/** Number of contiguous Bytes at the cursor (0 at the end), and where */
+size_t mbedtls_cipher_iov_contig( mbedtls_cipher_iov_cursor *cur,
+                                  unsigned char **p );
+
+/** Move the cursor \p len Bytes forward */
+void mbedtls_cipher_iov_advance( mbedtls_cipher_iov_cursor *cur, size_t len );
+
+/** Copy \p len Bytes at the cursor to \p buf, and move past them */
+void mbedtls_cipher_iov_gather( mbedtls_cipher_iov_cursor *cur,
+                                unsigned char *buf, size_t len );
+
+/** Copy \p len Bytes from \p buf to the cursor, and move past them */
+void mbedtls_cipher_iov_scatter( mbedtls_cipher_iov_cursor *cur,
+                                 const unsigned char *buf, size_t len );
+
+/** Zeroize the first \p len Bytes of \p count segments */
+void mbedtls_cipher_iov_zeroize( const mbedtls_cipher_iov *iov, size_t count,
+                                 size_t len );
+
 extern const mbedtls_cipher_definition_t mbedtls_cipher_definitions[];
 
 extern int mbedtls_cipher_supported[];
@@ -62,6 +62,11 @@ struct mbedtls_cmac_context_t
 
     /** The length of data pending processing. */
     size_t              unprocessed_len;
+
+    /** The K1 and K2 subkeys, derived from the key once by
+     *  mbedtls_cipher_cmac_starts(). */
+    unsigned char       K1[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    unsigned char       K2[MBEDTLS_CIPHER_BLKSIZE_MAX];
 };
 
 #else  /* !MBEDTLS_CMAC_ALT */
@@ -140,6 +145,41 @@ int mbedtls_cipher_cmac_finish( mbedtls_cipher_context_t *ctx,
  */
 int mbedtls_cipher_cmac_reset( mbedtls_cipher_context_t *ctx );
 
+/**
+ * \brief               This function calculates the CMAC of several
+ *                      independent messages with the key of a CMAC
+ *                      operation.
+ *
+ *                      For each \c i, the result is the same as
+ *                      mbedtls_cipher_cmac_reset(), mbedtls_cipher_cmac_update()
+ *                      of \p input[i] and mbedtls_cipher_cmac_finish() into
+ *                      \p output[i] would give. The subkeys are those derived
+ *                      by mbedtls_cipher_cmac_starts(), and the block cipher
+ *                      calls of different messages are batched, so that
+ *                      AES-NI encrypts several blocks at once.
+ *
+ *                      It is called after mbedtls_cipher_cmac_starts(), and
+ *                      does not affect a CMAC operation in progress on
+ *                      \p ctx.
+ *
+ * \param ctx           The cipher context used for the CMAC operation.
+ * \param input         The \p count buffers holding the messages.
+ * \param ilen          The lengths of the buffers in \p input.
+ * \param output        The \p count buffers for the CMAC results, each of
+ *                      the cipher block size.
+ * \param count         The number of messages.
+ *
+ * \return              \c 0 on success.
+ * \return              #MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA
+ *                      if parameter verification fails.
+ * \return              A cipher-specific error code on failure.
+ */
+int mbedtls_cipher_cmac_multi( mbedtls_cipher_context_t *ctx,
+                               const unsigned char * const input[],
+                               const size_t ilen[],
+                               unsigned char * const output[],
+                               size_t count );
+
 /**
  * \brief               This function calculates the full generic CMAC
  *                      on the input buffer with the provided key.
@@ -53,6 +53,7 @@
  *      include/mbedtls/bn_mul.h
  *
  * Required by:
+ *      MBEDTLS_ADX_C
  *      MBEDTLS_AESNI_C
  *      MBEDTLS_PADLOCK_C
  *
@@ -520,6 +521,30 @@
  */
 //#define MBEDTLS_AES_FEWER_TABLES
 
+/**
+ * \def MBEDTLS_AES_BITSLICE
+ *
+ * Use a bitsliced, constant-time AES implementation for bulk encryption
+ * (CTR, GCM and XTS encryption) when no hardware acceleration (AES-NI or
+ * PadLock) is available at runtime.
+ *
+ * The bitsliced code encrypts eight blocks at a time without any
+ * table lookup, so it is not vulnerable to cache-timing attacks. Single
+ * block operations and decryption still use the tables.
+ *
+ * Tradeoff: on 64-bit platforms with fast caches the table-based code is
+ * about twice as fast; the bitsliced code removes the secret-dependent
+ * memory accesses and the need for the AES tables in bulk operations.
+ *
+ * Requires: MBEDTLS_AES_C
+ *
+ * Not compatible with MBEDTLS_AES_ALT, MBEDTLS_AES_SETKEY_ENC_ALT or
+ * MBEDTLS_AES_ENCRYPT_ALT, as it works from the software key schedule.
+ *
+ * Uncomment this macro to use the bitsliced implementation.
+ */
+//#define MBEDTLS_AES_BITSLICE
+
 /**
  * \def MBEDTLS_CAMELLIA_SMALL_MEMORY
  *
@@ -715,6 +740,25 @@
  */
 #define MBEDTLS_ECDSA_DETERMINISTIC
 
+/**
+ * \def MBEDTLS_ECDSA_NONCE_POOL
+ *
+ * Enable pools of precomputed ECDSA nonces.
+ *
+ * With this option, mbedtls_ecdsa_sign_pool() takes the nonce of a
+ * randomized signature, together with its inverse and the resulting r, from
+ * a mbedtls_ecdsa_nonce_pool filled ahead of time, for example by the thread
+ * of mbedtls_ecdsa_nonce_pool_thread_start(), so that signing only costs a
+ * few modular multiplications. mbedtls_psa_ecdsa_set_nonce_pool() makes
+ * randomized PSA signatures use a pool. Deterministic signatures are not
+ * affected.
+ *
+ * Requires: MBEDTLS_ECDSA_C
+ *
+ * Uncomment this macro to enable ECDSA nonce pools.
+ */
+//#define MBEDTLS_ECDSA_NONCE_POOL
+
 /**
  * \def MBEDTLS_KEY_EXCHANGE_PSK_ENABLED
  *
@@ -1075,6 +1119,35 @@
  */
 //#define MBEDTLS_ENTROPY_FORCE_SHA256
 
+/**
+ * \def MBEDTLS_ENTROPY_SHARDS
+ *
+ * Split the entropy accumulator into this many shards, each with its own
+ * lock, so that threads calling mbedtls_entropy_func() concurrently do not
+ * all wait for each other. A thread uses the shard selected by its thread
+ * ID (with MBEDTLS_THREADING_PTHREAD) or otherwise by the address of its
+ * stack. Each call polls the sources into that shard, as often as needed
+ * for it to hold the threshold amount from every source, and then releases
+ * entropy from it.
+ * Data added with mbedtls_entropy_update_manual() goes to every shard.
+ *
+ * With MBEDTLS_THREADING_PTHREAD, mbedtls_entropy_gather_thread_start()
+ * is also available to poll the sources into the shards from a background
+ * thread.
+ *
+ * Requires: MBEDTLS_ENTROPY_C
+ *
+ * \note With MBEDTLS_THREADING_C, the entropy sources are polled
+ *       concurrently, so they must be thread-safe. This excludes
+ *       MBEDTLS_HAVEGE_C. The NV seed (MBEDTLS_ENTROPY_NV_SEED) is
+ *       polled and written under the context lock instead, and only
+ *       the first call to mbedtls_entropy_func() updates it, without
+ *       holding back concurrent callers.
+ *
+ * Uncomment and set to the number of shards to enable sharding.
+ */
+//#define MBEDTLS_ENTROPY_SHARDS 8
+
 /**
  * \def MBEDTLS_ENTROPY_NV_SEED
  *
@@ -1204,6 +1277,25 @@
  */
 //#define MBEDTLS_RSA_NO_CRT
 
+/**
+ * \def MBEDTLS_RSA_CRT_POOL
+ *
+ * Enable worker pools for the CRT exponentiations of RSA private key
+ * operations.
+ *
+ * With this option, mbedtls_rsa_set_crt_pool() attaches a
+ * mbedtls_rsa_crt_pool to an RSA context, and the private key operations of
+ * that context compute their exponentiations modulo P and modulo Q at the
+ * same time, one of them on a worker thread of the pool. This trades a
+ * second core for about half the latency of each operation.
+ *
+ * Requires: MBEDTLS_RSA_C, MBEDTLS_THREADING_PTHREAD
+ *           !MBEDTLS_RSA_NO_CRT
+ *
+ * Uncomment this macro to enable RSA CRT worker pools.
+ */
+//#define MBEDTLS_RSA_CRT_POOL
+
 /**
  * \def MBEDTLS_SELF_TEST
  *
@@ -1739,6 +1831,23 @@
  * \{
  */
 
+/**
+ * \def MBEDTLS_ADX_C
+ *
+ * Enable MULX/ADCX/ADOX support for Montgomery multiplication on x86-64.
+ *
+ * Module:  library/adx.c
+ * Caller:  library/bignum.c
+ *
+ * Requires: MBEDTLS_HAVE_ASM
+ *
+ * This module adds Montgomery multiplication and squaring kernels using
+ * the BMI2 and ADX instructions, selected at runtime, which speed up
+ * mbedtls_mpi_exp_mod() and therefore RSA and DHM. It needs an assembler
+ * that knows these instructions (GNU binutils 2.23 or later).
+ */
+#define MBEDTLS_ADX_C
+
 /**
  * \def MBEDTLS_AESNI_C
  *
@@ -2244,6 +2353,72 @@
  */
 #define MBEDTLS_ECP_C
 
+/**
+ * \def MBEDTLS_ECP_P256_C
+ *
+ * Enable a dedicated implementation of the secp256r1 (NIST P-256) group.
+ *
+ * Module:  library/ecp_p256.c
+ * Caller:  library/ecp.c
+ *
+ * Requires: MBEDTLS_ECP_C, MBEDTLS_ECP_DP_SECP256R1_ENABLED
+ *
+ * This module computes mbedtls_ecp_mul() and mbedtls_ecp_muladd() on
+ * secp256r1 with fixed-size field elements on the stack instead of
+ * mbedtls_mpi, with MULX and ADX on x86-64 processors that have them
+ * (selected at runtime, needs MBEDTLS_HAVE_ASM). Multiplication of the base
+ * point uses a static table of about 88 KB. Multiplications are
+ * constant-time with respect to the scalar. Restartable operations
+ * (MBEDTLS_ECP_RESTARTABLE with mbedtls_ecp_set_max_ops()) and groups
+ * handled by MBEDTLS_ECP_INTERNAL_ALT keep using the generic code.
+ *
+ * Uncomment this macro to enable the P-256 implementation.
+ */
+//#define MBEDTLS_ECP_P256_C
+
+/**
+ * \def MBEDTLS_ECP_X25519_C
+ *
+ * Enable a dedicated implementation of X25519 (Curve25519).
+ *
+ * Module:  library/ecp_x25519.c
+ * Caller:  library/ecp.c
+ *
+ * Requires: MBEDTLS_ECP_C, MBEDTLS_ECP_DP_CURVE25519_ENABLED
+ *
+ * This module computes mbedtls_ecp_mul() on Curve25519, and hence ECDH
+ * with it in mbedtls_ecdh_compute_shared() and psa_key_agreement(), with a
+ * constant-time Montgomery ladder on field elements of five 51-bit limbs on
+ * the stack instead of mbedtls_mpi. Groups handled by
+ * MBEDTLS_ECP_INTERNAL_ALT keep using the generic code.
+ *
+ * Comment this macro to use the generic code for Curve25519.
+ */
+#define MBEDTLS_ECP_X25519_C
+
+/**
+ * \def MBEDTLS_ECP_PRECOMP_CACHE
+ *
+ * Enable tables of precomputed multiples of public keys.
+ *
+ * Module:  library/ecp.c
+ * Caller:  library/ecdsa.c
+ *          library/psa_crypto.c
+ *
+ * Requires: MBEDTLS_ECP_C
+ *
+ * With this option, mbedtls_ecp_keypair_precompute() attaches to a key a
+ * table of multiples of its public point, of at most a given size, and
+ * mbedtls_ecdsa_verify_precomp(), mbedtls_ecdsa_read_signature() and
+ * psa_asymmetric_verify() use that table instead of computing one for each
+ * verification. Each table counts how often it was used. PSA keys get a
+ * table of MBEDTLS_ECP_PRECOMP_PSA_SIZE bytes when they are imported or
+ * generated. This adds a pointer to each mbedtls_ecp_keypair.
+ *
+ * Uncomment this macro to enable the precomputation of public keys.
+ */
+//#define MBEDTLS_ECP_PRECOMP_CACHE
+
 /**
  * \def MBEDTLS_ENTROPY_C
  *
@@ -2778,6 +2953,27 @@
  */
 #define MBEDTLS_SHA512_C
 
+/**
+ * \def MBEDTLS_SHANI_C
+ *
+ * Enable SHA-NI and SIMD support for SHA-1, SHA-256 and SHA-512 on x86-64.
+ *
+ * Module:  library/shani.c
+ * Caller:  library/sha1.c
+ *          library/sha256.c
+ *          library/sha512.c
+ *
+ * Requires: MBEDTLS_HAVE_ASM
+ *
+ * This module adds support for the SHA extensions on x86-64, selected at
+ * runtime, and for hashing several independent messages in parallel with
+ * SSE2 or AVX2 (see mbedtls_sha256_finish_multi() and
+ * mbedtls_sha1_finish_multi()). SHA-384 and SHA-512 use an AVX2 message
+ * schedule on processors that support AVX2 and BMI2. It needs an assembler
+ * that knows the SHA instructions (GNU binutils 2.24 or later).
+ */
+#define MBEDTLS_SHANI_C
+
 /**
  * \def MBEDTLS_SSL_CACHE_C
  *
@@ -3042,6 +3238,7 @@
 /* MPI / BIGNUM options */
 //#define MBEDTLS_MPI_WINDOW_SIZE            6 /**< Maximum windows size used. */
 //#define MBEDTLS_MPI_MAX_SIZE            1024 /**< Maximum number of bytes for usable MPIs. */
+//#define MBEDTLS_MPI_KARATSUBA_THRESHOLD  40 /**< Minimum number of limbs for Karatsuba multiplication. */
 
 /* CTR_DRBG options */
 //#define MBEDTLS_CTR_DRBG_ENTROPY_LEN               48 /**< Amount of entropy used per seed by default (48 with SHA-512, 32 with SHA-256) */
@@ -3051,6 +3248,9 @@
 //#define MBEDTLS_CTR_DRBG_MAX_SEED_INPUT           384 /**< Maximum size of (re)seed buffer */
 //#define MBEDTLS_CTR_DRBG_USE_128_BIT_KEY              /**< Use 128-bit key for CTR_DRBG - may reduce security (see ctr_drbg.h) */
 
+/* GCM options */
+//#define MBEDTLS_GCM_TABLE_BITS              4 /**< GHASH table index width without CLMUL: 4 (256 bytes per context) or 8 (4 KiB per context) */
+
 /* HMAC_DRBG options */
 //#define MBEDTLS_HMAC_DRBG_RESEED_INTERVAL   10000 /**< Interval before reseed is performed by default */
 //#define MBEDTLS_HMAC_DRBG_MAX_INPUT           256 /**< Maximum number of additional input bytes */
@@ -3061,6 +3261,7 @@
 //#define MBEDTLS_ECP_MAX_BITS             521 /**< Maximum bit size of groups */
 //#define MBEDTLS_ECP_WINDOW_SIZE            6 /**< Maximum window size used */
 //#define MBEDTLS_ECP_FIXED_POINT_OPTIM      1 /**< Enable fixed-point speed-up */
+//#define MBEDTLS_ECP_PRECOMP_PSA_SIZE       0 /**< Table size for PSA keys, in bytes */
 
 /* Entropy options */
 //#define MBEDTLS_ENTROPY_MAX_SOURCES                20 /**< Maximum number of sources supported */
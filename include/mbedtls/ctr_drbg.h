@@ -38,6 +38,8 @@
 
 #include "aes.h"
 
+#include "drbg_prefetch.h"
+
 #if defined(MBEDTLS_THREADING_C)
 #include "threading.h"
 #endif
@@ -139,6 +141,11 @@ typedef struct mbedtls_ctr_drbg_context
 
     void *p_entropy;            /*!< The context for the entropy function. */
 
+    /*
+     * Output generated ahead of time (see mbedtls_ctr_drbg_set_prefetch())
+     */
+    mbedtls_drbg_prefetch prefetch; /*!< The prefetch buffer. */
+
 #if defined(MBEDTLS_THREADING_C)
     mbedtls_threading_mutex_t mutex;
 #endif
@@ -222,6 +229,46 @@ void mbedtls_ctr_drbg_set_entropy_len( mbedtls_ctr_drbg_context *ctx,
 void mbedtls_ctr_drbg_set_reseed_interval( mbedtls_ctr_drbg_context *ctx,
                                    int interval );
 
+/**
+ * \brief               This function sets up a buffer of output generated
+ *                      ahead of time, so that small requests to
+ *                      mbedtls_ctr_drbg_random() are served by copying from
+ *                      the buffer instead of running a generate operation
+ *                      each.
+ *
+ *                      The buffer is filled on first use. A request that
+ *                      finds fewer than \p watermark unused bytes, or fewer
+ *                      than it asks for, first tops the buffer up: the unused
+ *                      bytes are kept and the rest of the buffer is refilled
+ *                      with generate operations of at most
+ *                      #MBEDTLS_CTR_DRBG_MAX_REQUEST bytes.
+ *                      Bytes are erased from the buffer as soon as they are
+ *                      handed out.
+ *
+ *                      The buffer is not used for requests larger than the
+ *                      buffer, for mbedtls_ctr_drbg_random_with_add() and
+ *                      mbedtls_ctr_drbg_random_bulk(), or when prediction
+ *                      resistance is enabled. Its unused content is erased
+ *                      whenever the DRBG is reseeded other than during a
+ *                      refill, or updated with mbedtls_ctr_drbg_update().
+ *
+ * \warning             The unused bytes in the buffer are future output of
+ *                      the DRBG: anyone who can read the buffer can predict
+ *                      that output. Only use this for memory that is as well
+ *                      protected as the context itself.
+ *
+ * \param ctx           The CTR_DRBG context.
+ * \param buf           The buffer, which must remain valid until the
+ *                      prefetch is disabled or the context is freed. Pass
+ *                      \c NULL to disable prefetching.
+ * \param len           The size of \p buf in bytes.
+ * \param watermark     The number of unused bytes below which the buffer is
+ *                      topped up. It is capped at \p len.
+ */
+void mbedtls_ctr_drbg_set_prefetch( mbedtls_ctr_drbg_context *ctx,
+                                    unsigned char *buf, size_t len,
+                                    size_t watermark );
+
 /**
  * \brief               This function reseeds the CTR_DRBG context, that is
  *                      extracts data from the entropy source.
@@ -290,6 +337,30 @@ int mbedtls_ctr_drbg_random_with_add( void *p_rng,
 int mbedtls_ctr_drbg_random( void *p_rng,
                      unsigned char *output, size_t output_len );
 
+/**
+ * \brief   This function uses CTR_DRBG to generate random data of any
+ *          length.
+ *
+ *          The request is split into consecutive generate operations of
+ *          at most #MBEDTLS_CTR_DRBG_MAX_REQUEST bytes each, as
+ *          successive calls to mbedtls_ctr_drbg_random() would do, so each
+ *          of them stays within the limits of NIST SP 800-90A. The context
+ *          is locked once for the whole request.
+ *
+ * \note    The function automatically reseeds if the reseed counter is
+ *          exceeded, including between two segments.
+ *
+ * \param p_rng         The CTR_DRBG context. This must be a pointer to a
+ *                      #mbedtls_ctr_drbg_context structure.
+ * \param output        The buffer to fill.
+ * \param output_len    The length of the buffer.
+ *
+ * \return              \c 0 on success.
+ * \return              #MBEDTLS_ERR_CTR_DRBG_ENTROPY_SOURCE_FAILED on failure.
+ */
+int mbedtls_ctr_drbg_random_bulk( void *p_rng,
+                                  unsigned char *output, size_t output_len );
+
 #if defined(MBEDTLS_FS_IO)
 /**
  * \brief               This function writes a seed file.
@@ -0,0 +1,105 @@
+/**
+ * \file drbg_prefetch.h
+ *
+ * \brief Prefetch buffer shared by CTR_DRBG and HMAC_DRBG
+ *
+ * This header supports the prefetch buffers of ctr_drbg.h and hmac_drbg.h,
+ * which include it; applications do not need to include it themselves.
+ */
+/*
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_DRBG_PREFETCH_H
+#define MBEDTLS_DRBG_PREFETCH_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Output of a DRBG generated ahead of time
+ */
+typedef struct mbedtls_drbg_prefetch
+{
+    unsigned char *buf;         /*!< prefetch buffer, or NULL               */
+    size_t len;                 /*!< size of the prefetch buffer            */
+    size_t pos;                 /*!< offset of the first unused byte        */
+    size_t low;                 /*!< refill watermark                       */
+}
+mbedtls_drbg_prefetch;
+
+/**
+ * \brief          Attach a buffer, or detach it if \p buf is NULL or \p len
+ *                 is 0, erasing the unused part of the previous one
+ *
+ * \param pf        Prefetch state, all zero when no buffer was ever set
+ * \param buf       Buffer, or NULL
+ * \param len       Size of \p buf in bytes
+ * \param watermark Refill when fewer unused bytes remain (capped at \p len)
+ */
+void mbedtls_drbg_prefetch_set( mbedtls_drbg_prefetch *pf,
+                                unsigned char *buf, size_t len,
+                                size_t watermark );
+
+/**
+ * \brief          Erase the unused part of the buffer, for instance on
+ *                 reseed. Does nothing while no buffer is attached.
+ *
+ * \param pf       Prefetch state
+ */
+void mbedtls_drbg_prefetch_discard( mbedtls_drbg_prefetch *pf );
+
+/**
+ * \brief          Serve a request from the buffer, topping it up first
+ *                 with calls of at most \p max_request bytes to
+ *                 \p f_generate if fewer than \p len or than the watermark
+ *                 unused bytes remain
+ *
+ *                 The buffer is detached during the refill, so that a
+ *                 reseed triggered by \p f_generate does not discard it.
+ *                 On error, the whole buffer is erased.
+ *
+ * \param pf          Prefetch state, with a buffer of at least \p len bytes
+ * \param f_generate  Generate function of the DRBG, without locking
+ * \param p_generate  Context of \p f_generate
+ * \param max_request Largest request accepted by \p f_generate
+ * \param output      Buffer to fill
+ * \param len         Number of bytes to copy to \p output
+ *
+ * \return         0 if successful, or the error of \p f_generate
+ */
+int mbedtls_drbg_prefetch_random( mbedtls_drbg_prefetch *pf,
+                                  int (*f_generate)( void *, unsigned char *,
+                                                     size_t ),
+                                  void *p_generate, size_t max_request,
+                                  unsigned char *output, size_t len );
+
+/**
+ * \brief          Erase the whole buffer, when the DRBG is freed
+ *
+ * \param pf       Prefetch state
+ */
+void mbedtls_drbg_prefetch_free( mbedtls_drbg_prefetch *pf );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* drbg_prefetch.h */
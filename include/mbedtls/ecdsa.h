@@ -35,6 +35,10 @@
 #include "ecp.h"
 #include "md.h"
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL) && defined(MBEDTLS_THREADING_C)
+#include "threading.h"
+#endif
+
 /**
  * \brief           Maximum ECDSA signature size for a given curve bit size
  *
@@ -119,6 +123,43 @@ typedef void mbedtls_ecdsa_restart_ctx;
 
 #endif /* MBEDTLS_ECP_RESTARTABLE */
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+/**
+ * \brief           Pool of precomputed ECDSA nonces for one curve
+ *
+ *                  Each entry holds the two values of a signature that do
+ *                  not depend on the message or on the key: r = (k G).x
+ *                  mod n and k^-1 mod n, for a random k. Entries are used
+ *                  at most once and erased as they are handed out.
+ *
+ * \see             mbedtls_ecdsa_nonce_pool_setup()
+ */
+typedef struct mbedtls_ecdsa_nonce_pool
+{
+    mbedtls_ecp_group_id grp_id;    /*!< The curve of the nonces.         */
+    mbedtls_mpi *r;                 /*!< r for each entry.                */
+    mbedtls_mpi *k_inv;             /*!< k^-1 mod n for each entry.       */
+    size_t size;                    /*!< The number of entries.           */
+    size_t count;                   /*!< The number of unused entries.    */
+    size_t low;                     /*!< The refill watermark.            */
+    int (*f_rng)(void *, unsigned char *, size_t); /*!< RNG for refills   */
+    void *p_rng;                    /*!< RNG context for refills.         */
+    unsigned long hits;             /*!< Signatures that used an entry.   */
+    unsigned long misses;           /*!< Signatures that found none.      */
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t mutex; /*!< Protects the fields above.      */
+#endif
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    mbedtls_threading_thread_t refill_thread; /*!< background refill thread */
+    pthread_mutex_t refill_mutex;   /*!< protects the two fields below    */
+    pthread_cond_t  refill_cond;    /*!< signalled to wake the thread     */
+    int             refill_running; /*!< background thread is running     */
+    int             refill_wanted;  /*!< the pool went below low          */
+#endif
+}
+mbedtls_ecdsa_nonce_pool;
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
+
 /**
  * \brief           This function computes the ECDSA signature of a
  *                  previously-hashed message.
@@ -184,6 +225,150 @@ int mbedtls_ecdsa_sign_det( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi
                     mbedtls_md_type_t md_alg );
 #endif /* MBEDTLS_ECDSA_DETERMINISTIC */
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+/**
+ * \brief           This function initializes a nonce pool.
+ *
+ * \param pool      The pool to initialize.
+ */
+void mbedtls_ecdsa_nonce_pool_init( mbedtls_ecdsa_nonce_pool *pool );
+
+/**
+ * \brief           This function sets up an empty nonce pool.
+ *
+ *                  The pool is filled by mbedtls_ecdsa_nonce_pool_refill()
+ *                  or by the thread of
+ *                  mbedtls_ecdsa_nonce_pool_thread_start(), typically while
+ *                  the application is idle, and emptied by
+ *                  mbedtls_ecdsa_sign_pool().
+ *
+ * \warning         A nonce must never be used twice. Do not duplicate the
+ *                  memory of a pool that holds entries, for example by
+ *                  forking the process or saving a snapshot of it.
+ *
+ * \param pool      The pool to set up.
+ * \param gid       The curve of the keys that will sign with the pool.
+ * \param size      The number of entries of the pool.
+ * \param low       The number of unused entries below which
+ *                  mbedtls_ecdsa_sign_pool() wakes the refill thread. It is
+ *                  capped at \p size.
+ * \param f_rng     The RNG function used to generate the nonces and to
+ *                  blind the computations. It must be thread-safe if the
+ *                  pool is refilled from another thread.
+ * \param p_rng     The RNG context.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_BAD_INPUT_DATA if \p gid is not a
+ *                  curve that can be used for ECDSA or \p size is 0.
+ * \return          #MBEDTLS_ERR_ECP_ALLOC_FAILED on memory allocation
+ *                  failure.
+ */
+int mbedtls_ecdsa_nonce_pool_setup( mbedtls_ecdsa_nonce_pool *pool,
+                                    mbedtls_ecp_group_id gid,
+                                    size_t size, size_t low,
+                                    int (*f_rng)(void *, unsigned char *, size_t),
+                                    void *p_rng );
+
+/**
+ * \brief           This function fills the unused entries of a nonce pool.
+ *
+ *                  Each entry costs about as much as a signature. Entries
+ *                  are computed without holding the lock of the pool, so
+ *                  signatures can use the pool while it is being refilled.
+ *
+ * \param pool      The pool to refill.
+ *
+ * \return          \c 0 on success.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX, \c MBEDTLS_ERR_MPI_XXX or
+ *                  \c MBEDTLS_ERR_THREADING_XXX error code on failure. The
+ *                  entries added before the failure are kept.
+ */
+int mbedtls_ecdsa_nonce_pool_refill( mbedtls_ecdsa_nonce_pool *pool );
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/**
+ * \brief           This function starts a thread that refills a nonce pool
+ *                  in the background.
+ *
+ *                  The thread fills the pool when it starts, and again
+ *                  whenever mbedtls_ecdsa_sign_pool() leaves fewer than
+ *                  \c low unused entries, as set by
+ *                  mbedtls_ecdsa_nonce_pool_setup(). Failures to compute
+ *                  an entry are not reported: signatures then find the pool
+ *                  empty and compute their nonce themselves.
+ *
+ * \param pool      The pool, which must have been set up.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_THREADING_BAD_INPUT_DATA if the thread is
+ *                  already running or the pool is not set up.
+ * \return          #MBEDTLS_ERR_THREADING_THREAD_ERROR if the thread cannot
+ *                  be created.
+ */
+int mbedtls_ecdsa_nonce_pool_thread_start( mbedtls_ecdsa_nonce_pool *pool );
+
+/**
+ * \brief           This function stops the background refill thread, if
+ *                  running, and waits for it to exit.
+ *
+ *                  This is done automatically by
+ *                  mbedtls_ecdsa_nonce_pool_free().
+ *
+ * \param pool      The pool.
+ */
+void mbedtls_ecdsa_nonce_pool_thread_stop( mbedtls_ecdsa_nonce_pool *pool );
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
+/**
+ * \brief           This function erases the unused entries of a nonce pool
+ *                  and frees it.
+ *
+ * \param pool      The pool to free.
+ */
+void mbedtls_ecdsa_nonce_pool_free( mbedtls_ecdsa_nonce_pool *pool );
+
+/**
+ * \brief           This function computes the ECDSA signature of a
+ *                  previously-hashed message with a nonce taken from a
+ *                  pool.
+ *
+ *                  With an entry of the pool, this only costs a few
+ *                  multiplications modulo the group order. If \p pool is
+ *                  \c NULL, is for another curve or is empty, this
+ *                  function computes the signature as mbedtls_ecdsa_sign()
+ *                  does, with \p f_rng.
+ *
+ * \note            Deterministic signatures (mbedtls_ecdsa_sign_det())
+ *                  derive the nonce from the key and the message, so they
+ *                  cannot use a pool, and they do not consume its entries.
+ *                  Both kinds of signatures can be computed with the same
+ *                  key, and they are verified in the same way.
+ *
+ * \see             mbedtls_ecdsa_sign()
+ *
+ * \param grp       The ECP group.
+ * \param r         The first output integer.
+ * \param s         The second output integer.
+ * \param d         The private signing key.
+ * \param buf       The message hash.
+ * \param blen      The length of \p buf.
+ * \param pool      The nonce pool, or \c NULL.
+ * \param f_rng     The RNG function, used when the pool has no entry.
+ * \param p_rng     The RNG context.
+ *
+ * \return          \c 0 on success.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX, \c MBEDTLS_ERR_MPI_XXX or
+ *                  \c MBEDTLS_ERR_THREADING_XXX error code on failure.
+ */
+int mbedtls_ecdsa_sign_pool( mbedtls_ecp_group *grp,
+                             mbedtls_mpi *r, mbedtls_mpi *s,
+                             const mbedtls_mpi *d,
+                             const unsigned char *buf, size_t blen,
+                             mbedtls_ecdsa_nonce_pool *pool,
+                             int (*f_rng)(void *, unsigned char *, size_t),
+                             void *p_rng );
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
+
 /**
  * \brief           This function verifies the ECDSA signature of a
  *                  previously-hashed message.
@@ -213,6 +398,33 @@ int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
                   const unsigned char *buf, size_t blen,
                   const mbedtls_ecp_point *Q, const mbedtls_mpi *r, const mbedtls_mpi *s);
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+/**
+ * \brief           This function verifies the ECDSA signature of a
+ *                  previously-hashed message with the public key of an
+ *                  ECDSA context, using the multiples of this key
+ *                  precomputed by \c mbedtls_ecp_keypair_precompute() if
+ *                  any.
+ *
+ * \see             mbedtls_ecdsa_verify()
+ *
+ * \param ctx       The ECDSA context holding the public key.
+ * \param buf       The message hash.
+ * \param blen      The length of \p buf.
+ * \param r         The first integer of the signature.
+ * \param s         The second integer of the signature.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_BAD_INPUT_DATA if the signature
+ *                  is invalid.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX or \c MBEDTLS_MPI_XXX
+ *                  error code on failure for any other reason.
+ */
+int mbedtls_ecdsa_verify_precomp( mbedtls_ecdsa_context *ctx,
+                                  const unsigned char *buf, size_t blen,
+                                  const mbedtls_mpi *r, const mbedtls_mpi *s );
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
+
 /**
  * \brief           This function computes the ECDSA signature and writes it
  *                  to a buffer, serialized as defined in <em>RFC-4492:
@@ -181,7 +181,9 @@ typedef struct mbedtls_ecp_group
     int (*t_post)(mbedtls_ecp_point *, void *); /*!< Unused. */
     void *t_data;               /*!< Unused. */
     mbedtls_ecp_point *T;       /*!< Pre-computed points for ecp_mul_comb(). */
-    size_t T_size;              /*!< The number of pre-computed points. */
+    size_t T_size;              /*!< The number of pre-computed points, or 0
+                                     if \p T is the static table of the
+                                     base point, shared by all groups. */
 }
 mbedtls_ecp_group;
 
@@ -279,6 +281,8 @@ typedef void mbedtls_ecp_restart_ctx;
  * by two (if large curves are in use).
  *
  * Reduction in size may reduce speed, but larger curves are impacted first.
+ * This value does not apply to the static base point tables of
+ * MBEDTLS_ECP_FIXED_POINT_OPTIM, which live in read-only memory.
  * Sample performances (in ECDHE handshakes/s, with FIXED_POINT_OPTIM = 1):
  *      w-size:     6       5       4       3       2
  *      521       145     141     135     120      97
@@ -294,23 +298,65 @@ typedef void mbedtls_ecp_restart_ctx;
 /*
  * Trade memory for speed on fixed-point multiplication.
  *
- * This speeds up repeated multiplication of the generator (that is, the
+ * This speeds up multiplication of the generator (that is, the
  * multiplication in ECDSA signatures, and half of the multiplications in
  * ECDSA verification and ECDHE) by a factor roughly 3 to 4.
  *
- * The cost is increasing EC peak memory usage by a factor roughly 2.
+ * The pre-computed points for the generator of each short Weierstrass curve
+ * are precomputed in ecp_curves.c and shared read-only by all
+ * groups, so this costs no heap memory and no computation at run time, but
+ * adds about 2 KB (256-bit curves) to 7 KB (521-bit curves) of read-only
+ * data per enabled curve.
  *
  * Change this value to 0 to reduce peak memory usage.
  */
 #define MBEDTLS_ECP_FIXED_POINT_OPTIM  1   /**< Enable fixed-point speed-up. */
 #endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
 
+#if !defined(MBEDTLS_ECP_PRECOMP_PSA_SIZE)
+/*
+ * With MBEDTLS_ECP_PRECOMP_CACHE, maximum size in bytes of the table of
+ * mbedtls_ecp_keypair_precompute() built for each PSA elliptic curve key
+ * whose policy allows signature verification, when the key is imported.
+ *
+ * The default of 0 disables these tables.
+ */
+#define MBEDTLS_ECP_PRECOMP_PSA_SIZE   0   /**< Table size for PSA keys. */
+#endif /* MBEDTLS_ECP_PRECOMP_PSA_SIZE */
+
 /* \} name SECTION: Module settings */
 
 #else  /* MBEDTLS_ECP_ALT */
 #include "ecp_alt.h"
 #endif /* MBEDTLS_ECP_ALT */
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+/**
+ * \brief           Precomputed multiples of a public key, and statistics
+ *                  about their use.
+ *
+ * \see             mbedtls_ecp_keypair_precompute()
+ *
+ * \note            The statistics are updated without any locking, so they
+ *                  are only exact if the key is not used by several threads
+ *                  at the same time.
+ */
+typedef struct mbedtls_ecp_precomp
+{
+    mbedtls_ecp_group_id grp_id;    /*!< The group of the key.              */
+    unsigned char w;                /*!< The width of the wNAF recoding.    */
+    size_t T_size;                  /*!< The number of points in T.         */
+    mbedtls_ecp_point *T;           /*!< Q, 3Q, 5Q, ... in affine form.     */
+    size_t size;                    /*!< The memory used, in Bytes.         */
+    unsigned long hits;             /*!< Multiplications that used T.       */
+    unsigned long misses;           /*!< Multiplications that could not.    */
+}
+mbedtls_ecp_precomp;
+#else
+/* We want to declare functions that take a table of multiples anyway */
+typedef void mbedtls_ecp_precomp;
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
+
 /**
  * \brief    The ECP key-pair structure.
  *
@@ -324,6 +370,9 @@ typedef struct mbedtls_ecp_keypair
     mbedtls_ecp_group grp;      /*!<  Elliptic curve and base point     */
     mbedtls_mpi d;              /*!<  our secret value                  */
     mbedtls_ecp_point Q;        /*!<  our public value                  */
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+    mbedtls_ecp_precomp *precomp; /*!<  multiples of Q, or NULL         */
+#endif
 }
 mbedtls_ecp_keypair;
 
@@ -835,6 +884,73 @@ int mbedtls_ecp_muladd_restartable(
              const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
              mbedtls_ecp_restart_ctx *rs_ctx );
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+/**
+ * \brief           This function precomputes multiples of the public key
+ *                  of a key pair, to speed up the later calls to
+ *                  \c mbedtls_ecp_muladd_precomp() with this key, such as
+ *                  in ECDSA verification with \c mbedtls_ecdsa_read_signature().
+ *
+ *                  The width of the table is the largest one whose memory
+ *                  use, reported in \c key->precomp->size, fits in
+ *                  \p max_size. A previous table of \p key is freed first.
+ *
+ * \note            The table is a copy of multiples of \c key->Q at the
+ *                  time of the call. If \c key->Q is changed later, the
+ *                  table is not used anymore, until this function is
+ *                  called again.
+ *
+ * \param key       The key pair, with a short Weierstrass group.
+ * \param max_size  The maximum memory to use, in Bytes: a few KB are
+ *                  enough for a speed-up. \c 0 only frees the table.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_BAD_INPUT_DATA if \p max_size is not
+ *                  enough for a useful table.
+ * \return          #MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE if the group of
+ *                  \p key is not a short Weierstrass curve.
+ * \return          #MBEDTLS_ERR_ECP_INVALID_KEY if \c key->Q is not a
+ *                  valid public key.
+ * \return          #MBEDTLS_ERR_ECP_ALLOC_FAILED or
+ *                  #MBEDTLS_ERR_MPI_ALLOC_FAILED on memory-allocation failure.
+ */
+int mbedtls_ecp_keypair_precompute( mbedtls_ecp_keypair *key,
+                                    size_t max_size );
+
+/**
+ * \brief           This function performs multiplication and addition of two
+ *                  points by integers: \p R = \p m * \p P + \p n * \p Q,
+ *                  with the multiples of \p Q in \p precomp if possible.
+ *
+ * \see             \c mbedtls_ecp_muladd()
+ *
+ * \note            The table is used, and \c precomp->hits incremented,
+ *                  if it was computed for \p Q in the group \p grp, unless
+ *                  another implementation of the group is faster. Otherwise
+ *                  this function works as \c mbedtls_ecp_muladd() and
+ *                  increments \c precomp->misses.
+ *
+ * \param grp       The ECP group.
+ * \param R         The destination point.
+ * \param m         The integer by which to multiply \p P.
+ * \param P         The point to multiply by \p m.
+ * \param n         The integer by which to multiply \p Q.
+ * \param Q         The point to be multiplied by \p n.
+ * \param precomp   The table of a key pair with public key \p Q, computed
+ *                  by \c mbedtls_ecp_keypair_precompute(), or NULL.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_ECP_INVALID_KEY if \p m or \p n are not
+ *                  valid private keys, or \p P or \p Q are not valid public
+ *                  keys.
+ * \return          #MBEDTLS_ERR_MPI_ALLOC_FAILED on memory-allocation failure.
+ */
+int mbedtls_ecp_muladd_precomp( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
+             mbedtls_ecp_precomp *precomp );
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
+
 /**
  * \brief           This function checks that a point is a valid public key
  *                  on this curve.
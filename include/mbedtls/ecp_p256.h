@@ -0,0 +1,95 @@
+/**
+ * \file ecp_p256.h
+ *
+ * \brief Fixed-width arithmetic for the NIST P-256 curve
+ *
+ * \warning These functions are only for internal use by other library
+ *          functions; you must not call them directly.
+ */
+/*
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_ECP_P256_H
+#define MBEDTLS_ECP_P256_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include "ecp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Multiplication by an integer: R = m * P,
+ *                 for the group secp256r1 only
+ *
+ * \note           Constant-time with respect to \p m. The caller must have
+ *                 checked that \p m is a valid private key and \p P a valid
+ *                 public key of \p grp, which must have been loaded with
+ *                 mbedtls_ecp_group_load( grp, MBEDTLS_ECP_DP_SECP256R1 ).
+ *
+ * \param grp      The secp256r1 group
+ * \param R        Destination point
+ * \param m        Integer by which to multiply
+ * \param P        Point to multiply
+ * \param f_rng    RNG function for the randomization of the
+ *                 coordinates, or NULL
+ * \param p_rng    RNG parameter
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_ECP_RANDOM_FAILED if the RNG failed to provide
+ *                 a blinding value,
+ *                 or a MBEDTLS_ERR_MPI_XXX error code
+ */
+int mbedtls_ecp_p256_mul( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                          const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                          int (*f_rng)(void *, unsigned char *, size_t),
+                          void *p_rng );
+
+/**
+ * \brief          Multiplication and addition of two points by integers:
+ *                 R = m * P + n * Q, for the group secp256r1 only
+ *
+ * \note           The same requirements as for mbedtls_ecp_p256_mul()
+ *                 apply to \p m, \p P, \p n and \p Q.
+ *
+ * \param grp      The secp256r1 group
+ * \param R        Destination point
+ * \param m        Integer by which to multiply P
+ * \param P        Point to multiply by m
+ * \param n        Integer by which to multiply Q
+ * \param Q        Point to be multiplied by n
+ *
+ * \return         0 if successful,
+ *                 or a MBEDTLS_ERR_MPI_XXX error code
+ */
+int mbedtls_ecp_p256_muladd( const mbedtls_ecp_group *grp,
+                             mbedtls_ecp_point *R,
+                             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                             const mbedtls_mpi *n, const mbedtls_ecp_point *Q );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ecp_p256.h */
@@ -0,0 +1,73 @@
+/**
+ * \file ecp_x25519.h
+ *
+ * \brief Fixed-width arithmetic for Curve25519
+ *
+ * \warning These functions are only for internal use by other library
+ *          functions; you must not call them directly.
+ */
+/*
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_ECP_X25519_H
+#define MBEDTLS_ECP_X25519_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include "ecp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Multiplication by an integer: R = m * P,
+ *                 for the group Curve25519 only (X25519)
+ *
+ * \note           Constant-time with respect to \p m. The caller must have
+ *                 checked that \p m is a valid private key and \p P a valid
+ *                 public key of Curve25519.
+ *
+ * \param R        Destination point (X and Z only, as mbedtls_ecp_mul())
+ * \param m        Integer by which to multiply
+ * \param P        Point to multiply (only X is used)
+ * \param f_rng    RNG function for the randomization of the
+ *                 coordinates, or NULL
+ * \param p_rng    RNG parameter
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_NOT_ACCEPTABLE if the result is the point
+ *                 at infinity (\p P of small order),
+ *                 MBEDTLS_ERR_ECP_RANDOM_FAILED if the RNG failed to provide
+ *                 a blinding value,
+ *                 or a MBEDTLS_ERR_MPI_XXX error code
+ */
+int mbedtls_ecp_x25519_mul( mbedtls_ecp_point *R, const mbedtls_mpi *m,
+                            const mbedtls_ecp_point *P,
+                            int (*f_rng)(void *, unsigned char *, size_t),
+                            void *p_rng );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ecp_x25519.h */
@@ -117,6 +117,31 @@ typedef struct mbedtls_entropy_source_state
 }
 mbedtls_entropy_source_state;
 
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+/**
+ * \brief           Entropy accumulator shard
+ *
+ *                  In sharded mode, each shard accumulates the output of
+ *                  the sources for the threads that use it, under its own
+ *                  lock.
+ */
+typedef struct mbedtls_entropy_shard
+{
+    int accumulator_started;
+#if defined(MBEDTLS_ENTROPY_SHA512_ACCUMULATOR)
+    mbedtls_sha512_context  accumulator;
+#else
+    mbedtls_sha256_context  accumulator;
+#endif
+    size_t          size[MBEDTLS_ENTROPY_MAX_SOURCES]; /**< Amount received from each source since the last release */
+    int             gathered;   /**< Sources polled since the last release */
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t mutex;    /*!< mutex                  */
+#endif
+}
+mbedtls_entropy_shard;
+#endif /* MBEDTLS_ENTROPY_SHARDS */
+
 /**
  * \brief           Entropy context structure
  */
@@ -139,6 +164,16 @@ typedef struct mbedtls_entropy_context
 #if defined(MBEDTLS_ENTROPY_NV_SEED)
     int initial_entropy_run;
 #endif
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+    mbedtls_entropy_shard   shard[MBEDTLS_ENTROPY_SHARDS];
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    mbedtls_threading_thread_t gather_thread; /*!< background gathering thread */
+    pthread_mutex_t gather_mutex;       /*!< protects gather_state        */
+    pthread_cond_t  gather_cond;        /*!< signals gather_state changes */
+    int             gather_state;       /*!< idle, running or stopping    */
+    unsigned int    gather_interval;    /*!< polling interval in ms       */
+#endif
+#endif /* MBEDTLS_ENTROPY_SHARDS */
 }
 mbedtls_entropy_context;
 
@@ -196,6 +231,10 @@ int mbedtls_entropy_gather( mbedtls_entropy_context *ctx );
  * \param output    Buffer to fill
  * \param len       Number of bytes desired, must be at most MBEDTLS_ENTROPY_BLOCK_SIZE
  *
+ * \note            With MBEDTLS_ENTROPY_SHARDS, the sources are polled into
+ *                  the calling thread's shard, and entropy is released from
+ *                  that shard.
+ *
  * \return          0 if successful, or MBEDTLS_ERR_ENTROPY_SOURCE_FAILED
  */
 int mbedtls_entropy_func( void *data, unsigned char *output, size_t len );
@@ -208,11 +247,52 @@ int mbedtls_entropy_func( void *data, unsigned char *output, size_t len );
  * \param data      Data to add
  * \param len       Length of data
  *
+ * \note            With MBEDTLS_ENTROPY_SHARDS, the data is added to every
+ *                  shard.
+ *
  * \return          0 if successful
  */
 int mbedtls_entropy_update_manual( mbedtls_entropy_context *ctx,
                            const unsigned char *data, size_t len );
 
+#if defined(MBEDTLS_ENTROPY_SHARDS) && defined(MBEDTLS_THREADING_PTHREAD)
+/**
+ * \brief           Start a thread that keeps the accumulator shards
+ *                  supplied with entropy in the background
+ *
+ *                  Every \p interval_ms milliseconds, the thread polls the
+ *                  sources into each shard that has not yet received the
+ *                  threshold amount from every source since it last
+ *                  released entropy. mbedtls_entropy_func() then usually
+ *                  polls the sources only once, rather than until the
+ *                  thresholds are reached.
+ *
+ * \note            The sources are polled from the background thread and
+ *                  from the callers of mbedtls_entropy_func() concurrently,
+ *                  so they must be thread-safe.
+ *
+ * \param ctx       Entropy context
+ * \param interval_ms Polling interval in milliseconds
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_THREADING_BAD_INPUT_DATA if the thread is
+ *                  already running, or
+ *                  MBEDTLS_ERR_ENTROPY_SOURCE_FAILED if it cannot be created
+ */
+int mbedtls_entropy_gather_thread_start( mbedtls_entropy_context *ctx,
+                                         unsigned int interval_ms );
+
+/**
+ * \brief           Stop the background gathering thread, if running,
+ *                  and wait for it to exit
+ *
+ *                  This is done automatically by mbedtls_entropy_free().
+ *
+ * \param ctx       Entropy context
+ */
+void mbedtls_entropy_gather_thread_stop( mbedtls_entropy_context *ctx );
+#endif /* MBEDTLS_ENTROPY_SHARDS && MBEDTLS_THREADING_PTHREAD */
+
 #if defined(MBEDTLS_ENTROPY_NV_SEED)
 /**
  * \brief           Trigger an update of the seed file in NV by using the
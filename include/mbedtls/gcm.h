@@ -47,6 +47,35 @@
 
 #define MBEDTLS_ERR_GCM_BAD_INPUT                         -0x0014  /**< Bad input parameters to function. */
 
+/*
+ * GHASH implementations, see mbedtls_gcm_set_ghash_mode()
+ */
+#define MBEDTLS_GCM_GHASH_AUTO      0   /**< CLMUL if available, else MBEDTLS_GCM_TABLE_BITS tables. */
+#define MBEDTLS_GCM_GHASH_TABLE4    1   /**< Shoup's method, 4-bit tables (256 bytes). */
+#define MBEDTLS_GCM_GHASH_TABLE8    2   /**< Shoup's method, 8-bit tables (4 KiB). */
+#define MBEDTLS_GCM_GHASH_CT        3   /**< Constant-time multiplication, no tables. */
+
+/**
+ * \name SECTION: Module settings
+ *
+ * The configuration options you can set for this module are in this section.
+ * Either change them in config.h or define them on the compiler command line.
+ * \{
+ */
+
+#if !defined(MBEDTLS_GCM_TABLE_BITS)
+/*
+ * Index width of the GHASH multiplication tables used when no CLMUL
+ * instruction is available: 4 or 8. Default: 4
+ *
+ * With 8, each GCM context allocates a 4 KiB table on the heap, and
+ * GHASH processes one byte instead of one nibble per table lookup.
+ */
+#define MBEDTLS_GCM_TABLE_BITS          4
+#endif
+
+/* \} name SECTION: Module settings */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -61,6 +90,11 @@ typedef struct mbedtls_gcm_context
     mbedtls_cipher_context_t cipher_ctx;  /*!< The cipher context used. */
     uint64_t HL[16];                      /*!< Precalculated HTable low. */
     uint64_t HH[16];                      /*!< Precalculated HTable high. */
+    uint64_t *HT8;                        /*!< Precalculated 8-bit HTable, high
+                                               and low halves interleaved, or
+                                               NULL. */
+    int ghash_mode;                       /*!< The GHASH implementation:
+                                               MBEDTLS_GCM_GHASH_XXX. */
     uint64_t len;                         /*!< The total length of the encrypted data. */
     uint64_t add_len;                     /*!< The total length of the additional data. */
     unsigned char base_ectr[16];          /*!< The first ECTR for tag. */
@@ -109,6 +143,37 @@ int mbedtls_gcm_setkey( mbedtls_gcm_context *ctx,
                         const unsigned char *key,
                         unsigned int keybits );
 
+/**
+ * \brief           This function selects the GHASH implementation used
+ *                  by a GCM context.
+ *
+ *                  By default (#MBEDTLS_GCM_GHASH_AUTO), the CLMUL
+ *                  instruction is used where available, and otherwise
+ *                  Shoup's method with tables indexed by
+ *                  #MBEDTLS_GCM_TABLE_BITS bits. The other modes force one
+ *                  software implementation regardless of the platform:
+ *                  - #MBEDTLS_GCM_GHASH_TABLE4: 4-bit tables, 256 bytes
+ *                    in the context;
+ *                  - #MBEDTLS_GCM_GHASH_TABLE8: 8-bit tables, 4 KiB
+ *                    allocated on the heap, about twice as fast;
+ *                  - #MBEDTLS_GCM_GHASH_CT: no secret-dependent memory
+ *                    accesses or branches, for deployments where cache
+ *                    timing attacks on H are a concern. It relies on the
+ *                    64-bit integer multiplier running in constant time.
+ *
+ * \note            This function may be called before or after
+ *                  mbedtls_gcm_setkey(), but not during an operation.
+ *
+ * \param ctx       The GCM context.
+ * \param mode      One of the MBEDTLS_GCM_GHASH_XXX values.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_GCM_BAD_INPUT if \p mode is invalid.
+ * \return          #MBEDTLS_ERR_CIPHER_ALLOC_FAILED if the 8-bit table
+ *                  cannot be allocated.
+ */
+int mbedtls_gcm_set_ghash_mode( mbedtls_gcm_context *ctx, int mode );
+
 /**
  * \brief           This function performs GCM encryption or decryption of a buffer.
  *
@@ -26,6 +26,8 @@
 
 #include "md.h"
 
+#include "drbg_prefetch.h"
+
 #if defined(MBEDTLS_THREADING_C)
 #include "threading.h"
 #endif
@@ -92,6 +94,9 @@ typedef struct mbedtls_hmac_drbg_context
     int (*f_entropy)(void *, unsigned char *, size_t); /*!< entropy function */
     void *p_entropy;            /*!< context for the entropy function        */
 
+    /* Output generated ahead of time */
+    mbedtls_drbg_prefetch prefetch; /*!< prefetch buffer                    */
+
 #if defined(MBEDTLS_THREADING_C)
     mbedtls_threading_mutex_t mutex;
 #endif
@@ -188,6 +193,37 @@ void mbedtls_hmac_drbg_set_entropy_len( mbedtls_hmac_drbg_context *ctx,
 void mbedtls_hmac_drbg_set_reseed_interval( mbedtls_hmac_drbg_context *ctx,
                                     int interval );
 
+/**
+ * \brief               Set up a buffer of output generated ahead of time,
+ *                      so that small requests to mbedtls_hmac_drbg_random()
+ *                      are served by copying from it
+ *
+ *                      The buffer is filled on first use. A request that
+ *                      finds fewer than \p watermark unused bytes, or fewer
+ *                      than it asks for, first tops the buffer up, with
+ *                      generate calls of at most
+ *                      MBEDTLS_HMAC_DRBG_MAX_REQUEST bytes. Bytes are erased
+ *                      from the buffer as soon as they are handed out.
+ *
+ *                      The buffer is bypassed by requests larger than it,
+ *                      by mbedtls_hmac_drbg_random_with_add() and when
+ *                      prediction resistance is on. Its unused content is
+ *                      erased when the DRBG is reseeded outside a refill,
+ *                      or updated with mbedtls_hmac_drbg_update().
+ *
+ * \warning             Unused bytes in the buffer are future DRBG output.
+ *                      Protect the buffer like the context itself.
+ *
+ * \param ctx           HMAC_DRBG context
+ * \param buf           Buffer, valid until prefetching is disabled or the
+ *                      context is freed, or NULL to disable prefetching
+ * \param len           Size of the buffer in bytes
+ * \param watermark     Refill watermark in bytes (capped at len)
+ */
+void mbedtls_hmac_drbg_set_prefetch( mbedtls_hmac_drbg_context *ctx,
+                                     unsigned char *buf, size_t len,
+                                     size_t watermark );
+
 /**
  * \brief               HMAC_DRBG update state
  *
@@ -309,6 +309,33 @@ int mbedtls_md_update( mbedtls_md_context_t *ctx, const unsigned char *input, si
  */
 int mbedtls_md_finish( mbedtls_md_context_t *ctx, unsigned char *output );
 
+/**
+ * \brief           This function finishes several digest operations at
+ *                  once. For each \c i, it feeds \p input[i] into \p ctx[i]
+ *                  and writes the result to \p output[i], as
+ *                  mbedtls_md_update() followed by mbedtls_md_finish() would.
+ *
+ *                  For digests that support it (SHA-1, SHA-224 and SHA-256),
+ *                  the messages are hashed in parallel SIMD lanes where the
+ *                  platform allows. Otherwise they are hashed in turn.
+ *
+ * \param ctx       The \p count generic message-digest contexts. They must
+ *                  all be set up for the same algorithm and started.
+ * \param input     The \p count buffers holding the remaining data.
+ * \param ilen      The lengths of the buffers in \p input.
+ * \param output    The \p count buffers for the checksum results.
+ * \param count     The number of contexts.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_MD_BAD_INPUT_DATA on parameter-verification
+ *                  failure.
+ */
+int mbedtls_md_finish_multi( mbedtls_md_context_t * const ctx[],
+                             const unsigned char * const input[],
+                             const size_t ilen[],
+                             unsigned char * const output[],
+                             size_t count );
+
 /**
  * \brief          This function calculates the message-digest of a buffer,
  *                 with respect to a configurable message-digest algorithm
@@ -330,6 +357,31 @@ int mbedtls_md_finish( mbedtls_md_context_t *ctx, unsigned char *output );
 int mbedtls_md( const mbedtls_md_info_t *md_info, const unsigned char *input, size_t ilen,
         unsigned char *output );
 
+/**
+ * \brief          This function calculates the message-digests of several
+ *                 independent buffers in a single call.
+ *
+ *                 The results are calculated as
+ *                 output[i] = message_digest(input[i]), in parallel where
+ *                 possible (see mbedtls_md_finish_multi()).
+ *
+ * \param md_info  The information structure of the message-digest algorithm
+ *                 to use.
+ * \param input    The \p count buffers holding the data.
+ * \param ilen     The lengths of the buffers in \p input.
+ * \param output   The \p count generic message-digest checksum results.
+ * \param count    The number of buffers.
+ *
+ * \return         \c 0 on success.
+ * \return         #MBEDTLS_ERR_MD_BAD_INPUT_DATA on parameter-verification
+ *                 failure.
+ */
+int mbedtls_md_multi( const mbedtls_md_info_t *md_info,
+                      const unsigned char * const input[],
+                      const size_t ilen[],
+                      unsigned char * const output[],
+                      size_t count );
+
 #if defined(MBEDTLS_FS_IO)
 /**
  * \brief          This function calculates the message-digest checksum
@@ -415,6 +467,36 @@ int mbedtls_md_hmac_update( mbedtls_md_context_t *ctx, const unsigned char *inpu
  */
 int mbedtls_md_hmac_finish( mbedtls_md_context_t *ctx, unsigned char *output);
 
+/**
+ * \brief           This function finishes several HMAC operations at once.
+ *                  For each \c i, it feeds \p input[i] into \p ctx[i] and
+ *                  writes the HMAC value to \p output[i], as
+ *                  mbedtls_md_hmac_update() followed by
+ *                  mbedtls_md_hmac_finish() would.
+ *
+ *                  Both the inner and the outer hashes are computed with
+ *                  mbedtls_md_finish_multi(), so that short messages are
+ *                  authenticated in parallel where the digest supports it.
+ *                  The contexts may hold different keys. Afterwards, call
+ *                  mbedtls_md_hmac_reset() on a context to reuse it.
+ *
+ * \param ctx       The \p count message digest contexts containing an
+ *                  embedded HMAC context, all for the same algorithm.
+ * \param input     The \p count buffers holding the remaining data.
+ * \param ilen      The lengths of the buffers in \p input.
+ * \param output    The \p count generic HMAC checksum results.
+ * \param count     The number of contexts.
+ *
+ * \return          \c 0 on success.
+ * \return          #MBEDTLS_ERR_MD_BAD_INPUT_DATA on parameter-verification
+ *                  failure.
+ */
+int mbedtls_md_hmac_finish_multi( mbedtls_md_context_t * const ctx[],
+                                  const unsigned char * const input[],
+                                  const size_t ilen[],
+                                  unsigned char * const output[],
+                                  size_t count );
+
 /**
  * \brief           This function prepares to authenticate a new message with
  *                  the same key as the previous HMAC operation.
@@ -82,6 +82,19 @@ struct mbedtls_md_info_t
 
     /** Internal use only */
     int (*process_func)( void *ctx, const unsigned char *input );
+
+    /** Finish several digest computations at once, or NULL */
+    int (*finish_multi_func)( void * const ctx[],
+                              const unsigned char * const input[],
+                              const size_t ilen[],
+                              unsigned char * const output[],
+                              size_t count );
+
+    /** Generic digest of several buffers at once, or NULL */
+    int (*digest_multi_func)( const unsigned char * const input[],
+                              const size_t ilen[],
+                              unsigned char * const output[],
+                              size_t count );
 };
 
 #if defined(MBEDTLS_MD2_C)
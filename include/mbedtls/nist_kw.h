@@ -161,6 +161,144 @@ int mbedtls_nist_kw_unwrap( mbedtls_nist_kw_context *ctx, mbedtls_nist_kw_mode_t
                             unsigned char *output, size_t* out_len, size_t out_size);
 
 
+/**
+ * \brief           The description of one wrap or unwrap processed by
+ *                  mbedtls_nist_kw_wrap_multi() or
+ *                  mbedtls_nist_kw_unwrap_multi().
+ */
+typedef struct mbedtls_nist_kw_job
+{
+    const unsigned char *input;     /*!< The input data. */
+    size_t in_len;                  /*!< The length of the input data in
+                                         Bytes. */
+    unsigned char *output;          /*!< The buffer for the output data. It
+                                         must not overlap the buffers of the
+                                         other jobs. */
+    size_t out_size;                /*!< The capacity of the output buffer. */
+    size_t out_len;                 /*!< Set to the number of bytes written
+                                         to the output buffer, \c 0 on
+                                         failure. */
+    int ret;                        /*!< Set to the result of the job, as
+                                         returned by mbedtls_nist_kw_wrap()
+                                         or mbedtls_nist_kw_unwrap(). */
+} mbedtls_nist_kw_job;
+
+/**
+ * \brief           This function wraps several independent buffers with the
+ *                  same key.
+ *
+ *                  For each job, the output and result are those of
+ *                  mbedtls_nist_kw_wrap() on the same input. The block
+ *                  cipher calls of up to eight jobs are batched, so that
+ *                  AES-NI encrypts several blocks at once.
+ *
+ * \param ctx       The key wrapping context to use for encryption.
+ * \param mode      The key wrapping mode to use (MBEDTLS_KW_MODE_KW or MBEDTLS_KW_MODE_KWP)
+ * \param jobs      The \p count jobs. The \c out_len and \c ret fields of
+ *                  each job are set.
+ * \param count     The number of jobs.
+ *
+ * \return          \c 0 if every job succeeded.
+ * \return          The error of the first job that failed otherwise.
+ * \return          A cipher-specific error code on failure of the underlying
+ *                  cipher, in which case the jobs after the failing batch
+ *                  are not processed.
+ */
+int mbedtls_nist_kw_wrap_multi( mbedtls_nist_kw_context *ctx,
+                                mbedtls_nist_kw_mode_t mode,
+                                mbedtls_nist_kw_job *jobs, size_t count );
+
+/**
+ * \brief           This function unwraps several independent buffers with
+ *                  the same key.
+ *
+ *                  For each job, the output and result are those of
+ *                  mbedtls_nist_kw_unwrap() on the same input, so a job
+ *                  that fails verification does not affect the others.
+ *                  The block cipher calls of up to eight jobs are batched.
+ *
+ * \param ctx       The key wrapping context to use for decryption.
+ * \param mode      The key wrapping mode to use (MBEDTLS_KW_MODE_KW or MBEDTLS_KW_MODE_KWP)
+ * \param jobs      The \p count jobs. The \c out_len and \c ret fields of
+ *                  each job are set.
+ * \param count     The number of jobs.
+ *
+ * \return          \c 0 if every job succeeded.
+ * \return          The error of the first job that failed otherwise, for
+ *                  example \c MBEDTLS_ERR_CIPHER_AUTH_FAILED.
+ * \return          A cipher-specific error code on failure of the underlying
+ *                  cipher, in which case the jobs after the failing batch
+ *                  are not processed.
+ */
+int mbedtls_nist_kw_unwrap_multi( mbedtls_nist_kw_context *ctx,
+                                  mbedtls_nist_kw_mode_t mode,
+                                  mbedtls_nist_kw_job *jobs, size_t count );
+
+#if defined(MBEDTLS_THREADING_PTHREAD) && !defined(MBEDTLS_NIST_KW_ALT)
+/**
+ * \brief           This function performs the same operation as
+ *                  mbedtls_nist_kw_wrap_multi(), with the jobs split between
+ *                  several threads.
+ *
+ *                  The jobs are cut into \p threads contiguous shares (at
+ *                  most 16). The calling thread wraps the first one, and a
+ *                  thread is started for each of the others and joined
+ *                  before the function returns. Starting a thread takes
+ *                  as long as wrapping tens of short keys, so a share
+ *                  should hold at least a few hundred jobs to gain
+ *                  anything.
+ *
+ * \note            Every share calls mbedtls_nist_kw_wrap_multi() on the
+ *                  same \p ctx, so mbedtls_nist_kw_setkey() and
+ *                  mbedtls_nist_kw_free() must not be called on it until
+ *                  this function returns. A context set up with
+ *                  #MBEDTLS_USE_PSA_CRYPTO keeps a PSA operation that a
+ *                  single thread must drive, so its jobs are all wrapped
+ *                  by the calling thread.
+ *
+ * \param ctx       The key wrapping context to use for encryption.
+ * \param mode      The key wrapping mode to use (MBEDTLS_KW_MODE_KW or MBEDTLS_KW_MODE_KWP)
+ * \param jobs      The \p count jobs.
+ * \param count     The number of jobs.
+ * \param threads   The number of threads to use, including the calling
+ *                  thread.
+ *
+ * \return          The same values as mbedtls_nist_kw_wrap_multi().
+ */
+int mbedtls_nist_kw_wrap_multi_threads( mbedtls_nist_kw_context *ctx,
+                                        mbedtls_nist_kw_mode_t mode,
+                                        mbedtls_nist_kw_job *jobs, size_t count,
+                                        unsigned int threads );
+
+/**
+ * \brief           This function performs the same operation as
+ *                  mbedtls_nist_kw_unwrap_multi(), with the jobs split
+ *                  between several threads.
+ *
+ *                  The shares are formed and run as for
+ *                  mbedtls_nist_kw_wrap_multi_threads(). A job that fails
+ *                  verification only sets its own \c ret field, whichever
+ *                  thread processed it.
+ *
+ * \note            \p ctx is used by all the threads at once, with the same
+ *                  restrictions as for mbedtls_nist_kw_wrap_multi_threads().
+ *
+ * \param ctx       The key wrapping context to use for decryption.
+ * \param mode      The key wrapping mode to use (MBEDTLS_KW_MODE_KW or MBEDTLS_KW_MODE_KWP)
+ * \param jobs      The \p count jobs.
+ * \param count     The number of jobs.
+ * \param threads   The number of threads to use, including the calling
+ *                  thread.
+ *
+ * \return          The same values as mbedtls_nist_kw_unwrap_multi().
+ */
+int mbedtls_nist_kw_unwrap_multi_threads( mbedtls_nist_kw_context *ctx,
+                                          mbedtls_nist_kw_mode_t mode,
+                                          mbedtls_nist_kw_job *jobs,
+                                          size_t count, unsigned int threads );
+#endif /* MBEDTLS_THREADING_PTHREAD && !MBEDTLS_NIST_KW_ALT */
+
+
 #if defined(MBEDTLS_SELF_TEST) && defined(MBEDTLS_AES_C)
 /**
  * \brief          The key wrapping checkup routine.
@@ -81,6 +81,72 @@ int mbedtls_pkcs5_pbkdf2_hmac( mbedtls_md_context_t *ctx, const unsigned char *p
                        unsigned int iteration_count,
                        uint32_t key_length, unsigned char *output );
 
+/**
+ * \brief          Derive part of a PKCS#5 PBKDF2 key using HMAC
+ *
+ *                 The PBKDF2 output is a sequence of independent blocks of
+ *                 the digest size. This function computes the \p key_length
+ *                 bytes that start at block \p first_block, so that a long
+ *                 key can be derived on several threads, each with its own
+ *                 context, and the parts concatenated. Blocks handled by
+ *                 one call are computed in parallel where the digest
+ *                 supports it (see mbedtls_md_finish_multi()).
+ *
+ * \param ctx      Generic HMAC context
+ * \param password Password to use when generating key
+ * \param plen     Length of password
+ * \param salt     Salt to use when generating key
+ * \param slen     Length of salt
+ * \param iteration_count       Iteration count
+ * \param first_block           Index of the first output block, counted
+ *                              from 0 in units of the digest size
+ * \param key_length            Length of generated key part in bytes
+ * \param output   Generated key part. Must be at least as big as key_length
+ *
+ * \returns        0 on success, or a MBEDTLS_ERR_XXX code if verification fails.
+ */
+int mbedtls_pkcs5_pbkdf2_hmac_part( mbedtls_md_context_t *ctx,
+                                    const unsigned char *password,
+                                    size_t plen,
+                                    const unsigned char *salt, size_t slen,
+                                    unsigned int iteration_count,
+                                    uint32_t first_block,
+                                    uint32_t key_length,
+                                    unsigned char *output );
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/**
+ * \brief          Derive a PKCS#5 PBKDF2 key using HMAC, with the output
+ *                 blocks split between several threads
+ *
+ *                 Each thread derives a contiguous range of whole groups
+ *                 of blocks with mbedtls_pkcs5_pbkdf2_hmac_part() and its
+ *                 own HMAC context. This only helps for keys of more than
+ *                 8 digests, as shorter keys are computed in parallel by
+ *                 a single call already.
+ *
+ * \param md_info  Digest to use with HMAC
+ * \param password Password to use when generating key
+ * \param plen     Length of password
+ * \param salt     Salt to use when generating key
+ * \param slen     Length of salt
+ * \param iteration_count       Iteration count
+ * \param key_length            Length of generated key in bytes
+ * \param output   Generated key. Must be at least as big as key_length
+ * \param threads  Number of threads to use, including the calling thread
+ *
+ * \returns        0 on success, or a MBEDTLS_ERR_XXX code if verification fails.
+ */
+int mbedtls_pkcs5_pbkdf2_hmac_threads( const mbedtls_md_info_t *md_info,
+                                       const unsigned char *password,
+                                       size_t plen,
+                                       const unsigned char *salt, size_t slen,
+                                       unsigned int iteration_count,
+                                       uint32_t key_length,
+                                       unsigned char *output,
+                                       unsigned int threads );
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
 /**
  * \brief          Checkup routine
  *
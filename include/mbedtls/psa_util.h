@@ -73,6 +73,15 @@ static inline psa_key_type_t mbedtls_psa_translate_cipher_type(
         case MBEDTLS_CIPHER_AES_128_CBC:
         case MBEDTLS_CIPHER_AES_192_CBC:
         case MBEDTLS_CIPHER_AES_256_CBC:
+        case MBEDTLS_CIPHER_AES_128_CTR:
+        case MBEDTLS_CIPHER_AES_192_CTR:
+        case MBEDTLS_CIPHER_AES_256_CTR:
+        case MBEDTLS_CIPHER_AES_128_CFB128:
+        case MBEDTLS_CIPHER_AES_192_CFB128:
+        case MBEDTLS_CIPHER_AES_256_CFB128:
+        case MBEDTLS_CIPHER_AES_128_OFB:
+        case MBEDTLS_CIPHER_AES_192_OFB:
+        case MBEDTLS_CIPHER_AES_256_OFB:
             return( PSA_KEY_TYPE_AES );
 
         /* ARIA not yet supported in PSA. */
@@ -104,7 +113,19 @@ static inline psa_algorithm_t mbedtls_psa_translate_cipher_mode(
         case MBEDTLS_MODE_CBC:
             if( taglen == 0 )
                 return( PSA_ALG_CBC_NO_PADDING );
-            /* Intentional fallthrough for taglen != 0 */
+            return( 0 );
+        case MBEDTLS_MODE_CTR:
+            if( taglen == 0 )
+                return( PSA_ALG_CTR );
+            return( 0 );
+        case MBEDTLS_MODE_CFB:
+            if( taglen == 0 )
+                return( PSA_ALG_CFB );
+            return( 0 );
+        case MBEDTLS_MODE_OFB:
+            if( taglen == 0 )
+                return( PSA_ALG_OFB );
+            return( 0 );
         default:
             return( 0 );
     }
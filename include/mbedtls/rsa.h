@@ -90,6 +90,39 @@ extern "C" {
 // Regular implementation
 //
 
+#if defined(MBEDTLS_RSA_CRT_POOL)
+/* Upper bound on the workers of a mbedtls_rsa_crt_pool */
+#define MBEDTLS_RSA_CRT_POOL_MAX_WORKERS    8
+
+/**
+ * \brief          Pool of worker threads for RSA private key operations
+ *
+ *                 A private key operation on a context attached to a pool
+ *                 with mbedtls_rsa_set_crt_pool() hands its exponentiation
+ *                 modulo Q to a worker and does the one modulo P itself,
+ *                 which nearly halves its latency on an otherwise idle
+ *                 core. A pool can be shared by any number of contexts and
+ *                 threads; when all its workers are busy, the calling
+ *                 thread takes back its exponentiation and does both.
+ *
+ * \see            mbedtls_rsa_crt_pool_start()
+ */
+typedef struct mbedtls_rsa_crt_pool
+{
+    mbedtls_threading_thread_t workers[MBEDTLS_RSA_CRT_POOL_MAX_WORKERS]; /*!< worker threads */
+    unsigned int count;         /*!< The number of started workers.       */
+    int running;                /*!< The workers accept new jobs.         */
+    struct mbedtls_rsa_crt_job *head; /*!< First queued job, in rsa.c.    */
+    struct mbedtls_rsa_crt_job *tail; /*!< Last queued job.               */
+    unsigned long jobs;         /*!< Exponentiations done by a worker.    */
+    unsigned long reclaimed;    /*!< Queued ones done by their caller.    */
+    pthread_mutex_t mutex;      /*!< Protects the fields above.           */
+    pthread_cond_t work_cond;   /*!< Signalled when a job is queued.      */
+    pthread_cond_t done_cond;   /*!< Broadcast when a job is done.        */
+}
+mbedtls_rsa_crt_pool;
+#endif /* MBEDTLS_RSA_CRT_POOL */
+
 /**
  * \brief   The RSA context structure.
  *
@@ -128,6 +161,10 @@ typedef struct mbedtls_rsa_context
                                      as specified in md.h for use in the MGF
                                      mask generating function used in the
                                      EME-OAEP and EMSA-PSS encodings. */
+#if defined(MBEDTLS_RSA_CRT_POOL)
+    mbedtls_rsa_crt_pool *crt_pool; /*!<  The worker pool of private key
+                                          operations, or NULL. */
+#endif
 #if defined(MBEDTLS_THREADING_C)
     mbedtls_threading_mutex_t mutex;    /*!<  Thread-safety mutex. */
 #endif
@@ -398,6 +435,72 @@ int mbedtls_rsa_export_crt( const mbedtls_rsa_context *ctx,
 void mbedtls_rsa_set_padding( mbedtls_rsa_context *ctx, int padding,
                               int hash_id);
 
+#if defined(MBEDTLS_RSA_CRT_POOL) && !defined(MBEDTLS_RSA_ALT)
+/**
+ * \brief          This function initializes a CRT worker pool, with no
+ *                 worker running.
+ *
+ * \param pool     The pool to initialize.
+ */
+void mbedtls_rsa_crt_pool_init( mbedtls_rsa_crt_pool *pool );
+
+/**
+ * \brief          This function starts the worker threads of a pool.
+ *
+ * \note           One worker per context used concurrently is enough:
+ *                 each private key operation hands a single exponentiation
+ *                 to the pool.
+ *
+ * \param pool     The initialized pool, with no worker running.
+ * \param workers  The number of threads to start, from 1 to
+ *                 #MBEDTLS_RSA_CRT_POOL_MAX_WORKERS.
+ *
+ * \return         \c 0 on success, including if only some of the
+ *                 threads could be started.
+ * \return         #MBEDTLS_ERR_THREADING_BAD_INPUT_DATA if \p workers is
+ *                 out of range or workers are already running.
+ * \return         #MBEDTLS_ERR_THREADING_THREAD_ERROR if no thread could be
+ *                 started.
+ */
+int mbedtls_rsa_crt_pool_start( mbedtls_rsa_crt_pool *pool,
+                                unsigned int workers );
+
+/**
+ * \brief          This function stops the worker threads of a pool, once
+ *                 they have finished their current job. Jobs still queued
+ *                 are done by their callers.
+ *
+ * \param pool     The pool to stop. It may be started again afterwards.
+ */
+void mbedtls_rsa_crt_pool_stop( mbedtls_rsa_crt_pool *pool );
+
+/**
+ * \brief          This function stops the workers of a pool and frees it.
+ *
+ * \note           No context may be using the pool any more.
+ *
+ * \param pool     The pool to free.
+ */
+void mbedtls_rsa_crt_pool_free( mbedtls_rsa_crt_pool *pool );
+
+/**
+ * \brief          This function makes the private key operations of a
+ *                 context run their two CRT exponentiations concurrently,
+ *                 one of them on a worker of \p pool. Blinding is
+ *                 applied as without a pool.
+ *
+ * \note           The pool is not owned by the context, and must outlive
+ *                 its use by the context. mbedtls_rsa_copy() copies the
+ *                 pointer.
+ *
+ * \param ctx      The RSA context.
+ * \param pool     The pool to use, or NULL to do both exponentiations in
+ *                 the calling thread.
+ */
+void mbedtls_rsa_set_crt_pool( mbedtls_rsa_context *ctx,
+                               mbedtls_rsa_crt_pool *pool );
+#endif /* MBEDTLS_RSA_CRT_POOL && !MBEDTLS_RSA_ALT */
+
 /**
  * \brief          This function retrieves the length of RSA modulus in Bytes.
  *
@@ -157,6 +157,37 @@ int mbedtls_sha1_update_ret( mbedtls_sha1_context *ctx,
 int mbedtls_sha1_finish_ret( mbedtls_sha1_context *ctx,
                              unsigned char output[20] );
 
+/**
+ * \brief          This function finishes several independent SHA-1
+ *                 operations at once. For each \c i, it feeds \p input[i]
+ *                 into \p ctx[i] and writes the result to \p output[i], as
+ *                 mbedtls_sha1_update_ret() followed by
+ *                 mbedtls_sha1_finish_ret() would.
+ *
+ *                 Where the platform supports it, the messages are hashed
+ *                 in parallel in SIMD lanes, which is much faster than
+ *                 hashing them one by one when they are short.
+ *
+ * \warning        SHA-1 is considered a weak message digest and its use
+ *                 constitutes a security risk. We recommend considering
+ *                 stronger message digests instead.
+ *
+ * \param ctx      The \p count SHA-1 contexts to finish. Each of them must
+ *                 have been started, and may already have been fed some
+ *                 data.
+ * \param input    The \p count buffers holding the remaining data.
+ * \param ilen     The lengths of the buffers in \p input.
+ * \param output   The \p count SHA-1 checksum results.
+ * \param count    The number of contexts.
+ *
+ * \return         \c 0 on success.
+ */
+int mbedtls_sha1_finish_multi( mbedtls_sha1_context * const ctx[],
+                               const unsigned char * const input[],
+                               const size_t ilen[],
+                               unsigned char * const output[],
+                               size_t count );
+
 /**
  * \brief          SHA-1 process data block (internal use only).
  *
@@ -272,6 +303,30 @@ int mbedtls_sha1_ret( const unsigned char *input,
                       size_t ilen,
                       unsigned char output[20] );
 
+/**
+ * \brief          This function calculates the SHA-1 checksums of several
+ *                 independent buffers.
+ *
+ *                 The SHA-1 results are calculated as
+ *                 output[i] = SHA-1(input[i]), using
+ *                 mbedtls_sha1_finish_multi().
+ *
+ * \warning        SHA-1 is considered a weak message digest and its use
+ *                 constitutes a security risk. We recommend considering
+ *                 stronger message digests instead.
+ *
+ * \param input    The \p count buffers holding the input data.
+ * \param ilen     The lengths of the buffers in \p input.
+ * \param output   The \p count SHA-1 checksum results.
+ * \param count    The number of buffers.
+ *
+ * \return         \c 0 on success.
+ */
+int mbedtls_sha1_ret_multi( const unsigned char * const input[],
+                            const size_t ilen[],
+                            unsigned char * const output[],
+                            size_t count );
+
 #if !defined(MBEDTLS_DEPRECATED_REMOVED)
 #if defined(MBEDTLS_DEPRECATED_WARNING)
 #define MBEDTLS_DEPRECATED      __attribute__((deprecated))
@@ -129,6 +129,33 @@ int mbedtls_sha256_update_ret( mbedtls_sha256_context *ctx,
 int mbedtls_sha256_finish_ret( mbedtls_sha256_context *ctx,
                                unsigned char output[32] );
 
+/**
+ * \brief          This function finishes several independent SHA-256
+ *                 operations at once. For each \c i, it feeds \p input[i]
+ *                 into \p ctx[i] and writes the result to \p output[i], as
+ *                 mbedtls_sha256_update_ret() followed by
+ *                 mbedtls_sha256_finish_ret() would.
+ *
+ *                 Where the platform supports it, the messages are hashed
+ *                 in parallel in SIMD lanes, which is much faster than
+ *                 hashing them one by one when they are short.
+ *
+ * \param ctx      The \p count SHA-256 contexts to finish. Each of them
+ *                 must have been started, and may already have been fed
+ *                 some data. Mixing SHA-224 and SHA-256 is allowed.
+ * \param input    The \p count buffers holding the remaining data.
+ * \param ilen     The lengths of the buffers in \p input.
+ * \param output   The \p count SHA-224 or SHA-256 checksum results.
+ * \param count    The number of contexts.
+ *
+ * \return         \c 0 on success.
+ */
+int mbedtls_sha256_finish_multi( mbedtls_sha256_context * const ctx[],
+                                 const unsigned char * const input[],
+                                 const size_t ilen[],
+                                 unsigned char * const output[],
+                                 size_t count );
+
 /**
  * \brief          This function processes a single data block within
  *                 the ongoing SHA-256 computation. This function is for
@@ -225,6 +252,29 @@ int mbedtls_sha256_ret( const unsigned char *input,
                         unsigned char output[32],
                         int is224 );
 
+/**
+ * \brief          This function calculates the SHA-224 or SHA-256
+ *                 checksums of several independent buffers.
+ *
+ *                 The SHA-256 results are calculated as
+ *                 output[i] = SHA-256(input[i]), using
+ *                 mbedtls_sha256_finish_multi().
+ *
+ * \param input    The \p count buffers holding the input data.
+ * \param ilen     The lengths of the buffers in \p input.
+ * \param output   The \p count SHA-224 or SHA-256 checksum results.
+ * \param count    The number of buffers.
+ * \param is224    Determines which function to use:
+ *                 0: Use SHA-256, or 1: Use SHA-224.
+ *
+ * \return         \c 0 on success.
+ */
+int mbedtls_sha256_ret_multi( const unsigned char * const input[],
+                              const size_t ilen[],
+                              unsigned char * const output[],
+                              size_t count,
+                              int is224 );
+
 #if !defined(MBEDTLS_DEPRECATED_REMOVED)
 #if defined(MBEDTLS_DEPRECATED_WARNING)
 #define MBEDTLS_DEPRECATED      __attribute__((deprecated))
@@ -0,0 +1,200 @@
+/**
+ * \file shani.h
+ *
+ * \brief SHA-NI and SIMD acceleration of SHA-1, SHA-256 and SHA-512
+ *        on x86-64 processors
+ */
+/*
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_SHANI_H
+#define MBEDTLS_SHANI_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Bits of CPUID.(EAX=07H,ECX=0):EBX */
+#define MBEDTLS_SHANI_AVX2     0x00000020u
+#define MBEDTLS_SHANI_BMI2     0x00000100u
+#define MBEDTLS_SHANI_SHA      0x20000000u
+
+/** Number of independent messages processed by the multi-buffer kernels */
+#define MBEDTLS_SHANI_LANES    8
+
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) &&  \
+    ( defined(__amd64__) || defined(__x86_64__) )   &&  \
+    ! defined(MBEDTLS_HAVE_X86_64)
+#define MBEDTLS_HAVE_X86_64
+#endif
+
+#if defined(MBEDTLS_HAVE_X86_64)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Layout and kernels of a hash context for
+ *                 mbedtls_shani_finish_lanes()
+ */
+typedef struct
+{
+    size_t state_words;     /*!< 5 for SHA-1, 8 for SHA-256             */
+    size_t total_off;       /*!< offset of uint32_t total[2] in context */
+    size_t state_off;       /*!< offset of the uint32_t state words     */
+    size_t buffer_off;      /*!< offset of the 64-byte block buffer     */
+    size_t min_lanes;       /*!< finish one by one below this many      */
+    int (*process)( void *ctx, const unsigned char data[64] );
+                            /*!< single-block compression function      */
+    void (*process_x8)( uint32_t state[][MBEDTLS_SHANI_LANES],
+                        const unsigned char *data[MBEDTLS_SHANI_LANES] );
+                            /*!< multi-buffer compression function      */
+}
+mbedtls_shani_lanes_info;
+
+/**
+ * \brief          SHA-NI / AVX2 features detection routine
+ *
+ * \param what     The feature to detect (MBEDTLS_SHANI_SHA,
+ *                 MBEDTLS_SHANI_AVX2 or MBEDTLS_SHANI_BMI2)
+ *
+ * \note           MBEDTLS_SHANI_AVX2 is only reported if the operating
+ *                 system also saves the YMM registers on context switch.
+ *
+ * \return         1 if CPU has support for the feature, 0 otherwise
+ */
+int mbedtls_shani_has_support( unsigned int what );
+
+/**
+ * \brief          Tell whether the multi-buffer functions should hash over
+ *                 the SIMD lanes: only if SHA-NI is not available, as it
+ *                 is faster, or if the lanes are forced
+ *
+ * \return         1 to use the lanes, 0 to hash the messages one by one
+ */
+int mbedtls_shani_use_lanes( void );
+
+/**
+ * \brief          Force the multi-buffer functions to use the SIMD lanes
+ *                 even when SHA-NI is available
+ *
+ *                 This is exposed for testing only, so that the lanes are
+ *                 also tested on CPUs with SHA-NI. It is not thread-safe.
+ *
+ * \param force    1 to force the lanes, 0 to restore the default
+ */
+void mbedtls_shani_force_lanes( int force );
+
+/**
+ * \brief          SHA-1 compression of consecutive blocks with SHA-NI
+ *
+ * \param state    SHA-1 chaining state (5 words), updated in place
+ * \param data     \p nblocks consecutive 64-byte blocks
+ * \param nblocks  Number of blocks to process
+ */
+void mbedtls_shani_sha1_process( uint32_t state[5],
+                                 const unsigned char *data,
+                                 size_t nblocks );
+
+/**
+ * \brief          SHA-256 compression of consecutive blocks with SHA-NI
+ *
+ * \param state    SHA-256 chaining state (8 words), updated in place
+ * \param data     \p nblocks consecutive 64-byte blocks
+ * \param nblocks  Number of blocks to process
+ */
+void mbedtls_shani_sha256_process( uint32_t state[8],
+                                   const unsigned char *data,
+                                   size_t nblocks );
+
+/**
+ * \brief          Multi-buffer SHA-1 compression: one 64-byte block for each
+ *                 of MBEDTLS_SHANI_LANES independent states
+ *
+ *                 Uses AVX2 if available, SSE2 otherwise.
+ *
+ * \param state    Chaining states, word-major: state[i][lane] is word i
+ *                 of the state of \p lane
+ * \param data     One 64-byte block per lane (none may be NULL)
+ */
+void mbedtls_shani_sha1_process_x8( uint32_t state[5][MBEDTLS_SHANI_LANES],
+                    const unsigned char *data[MBEDTLS_SHANI_LANES] );
+
+/**
+ * \brief          Multi-buffer SHA-256 compression: one 64-byte block for
+ *                 each of MBEDTLS_SHANI_LANES independent states
+ *
+ *                 Uses AVX2 if available, SSE2 otherwise.
+ *
+ * \param state    Chaining states, word-major: state[i][lane] is word i
+ *                 of the state of \p lane
+ * \param data     One 64-byte block per lane (none may be NULL)
+ */
+void mbedtls_shani_sha256_process_x8( uint32_t state[8][MBEDTLS_SHANI_LANES],
+                    const unsigned char *data[MBEDTLS_SHANI_LANES] );
+
+/**
+ * \brief          Absorb the last input of several contexts of the same
+ *                 hash and pad them, interleaving the messages over the
+ *                 lanes of \p info->process_x8
+ *
+ *                 On success, the state of each context holds the final
+ *                 digest words; the caller serializes them.
+ *
+ * \param info     Layout and kernels of the hash
+ * \param ctx      \p count contexts of the hash, as described by \p info
+ * \param input    Last input of each context
+ * \param ilen     Length of each input
+ * \param count    Number of contexts
+ *
+ * \return         0 on success, or the error of \p info->process
+ */
+int mbedtls_shani_finish_lanes( const mbedtls_shani_lanes_info *info,
+                                void * const ctx[],
+                                const unsigned char * const input[],
+                                const size_t ilen[],
+                                size_t count );
+
+/**
+ * \brief          SHA-512 compression of consecutive blocks, with the message
+ *                 schedule computed four words at a time with AVX2
+ *
+ * \note           Only call this if mbedtls_shani_has_support() reports both
+ *                 MBEDTLS_SHANI_AVX2 and MBEDTLS_SHANI_BMI2.
+ *
+ * \param state    SHA-512 chaining state (8 words), updated in place
+ * \param data     \p nblocks consecutive 128-byte blocks
+ * \param nblocks  Number of blocks to process
+ */
+void mbedtls_shani_sha512_process( uint64_t state[8],
+                                   const unsigned char *data,
+                                   size_t nblocks );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_HAVE_X86_64 */
+
+#endif /* MBEDTLS_SHANI_H */
@@ -42,6 +42,7 @@ extern "C" {
 
 #define MBEDTLS_ERR_THREADING_BAD_INPUT_DATA              -0x001C  /**< Bad input parameters to function. */
 #define MBEDTLS_ERR_THREADING_MUTEX_ERROR                 -0x001E  /**< Locking / unlocking / free failed with error code. */
+#define MBEDTLS_ERR_THREADING_THREAD_ERROR                -0x001F  /**< A thread could not be started. */
 
 #if defined(MBEDTLS_THREADING_PTHREAD)
 #include <pthread.h>
@@ -115,6 +116,83 @@ extern mbedtls_threading_mutex_t mbedtls_threading_gmtime_mutex;
 
 #endif /* MBEDTLS_THREADING_C */
 
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/*
+ * Threads started by the library itself. These are only for internal use
+ * by other library functions; you must not call them directly.
+ */
+
+/** Upper bound on the threads used by mbedtls_threading_split() */
+#define MBEDTLS_THREADING_MAX_SPLIT     16
+
+typedef struct mbedtls_threading_thread_t
+{
+    pthread_t thread;
+    void (*fn)( void * );
+    void *arg;
+} mbedtls_threading_thread_t;
+
+/**
+ * \brief          Start a thread running fn( arg )
+ *
+ * \param thread   Thread handle, which must stay valid until the thread
+ *                 has been joined
+ * \param fn       Function run by the thread
+ * \param arg      Argument of \p fn
+ *
+ * \return         0 if successful, or MBEDTLS_ERR_THREADING_THREAD_ERROR
+ */
+int mbedtls_threading_thread_create( mbedtls_threading_thread_t *thread,
+                                     void (*fn)( void * ), void *arg );
+
+/**
+ * \brief          Wait for a thread started by
+ *                 mbedtls_threading_thread_create() to return
+ *
+ * \param thread   Thread handle
+ */
+void mbedtls_threading_thread_join( mbedtls_threading_thread_t *thread );
+
+/**
+ * \brief          Wait on a condition variable for at most \p ms
+ *                 milliseconds
+ *
+ * \param cond     Condition variable
+ * \param mutex    Mutex locked by the caller, as for pthread_cond_wait()
+ * \param ms       Timeout in milliseconds
+ *
+ * \note           As with pthread_cond_wait(), the call may also return
+ *                 spuriously before the timeout; the caller must check
+ *                 its own condition.
+ *
+ * \return         0 if woken up or timed out, or
+ *                 MBEDTLS_ERR_THREADING_THREAD_ERROR
+ */
+int mbedtls_threading_cond_timedwait( pthread_cond_t *cond,
+                                      pthread_mutex_t *mutex,
+                                      unsigned int ms );
+
+/**
+ * \brief          Process \p count independent items in up to \p threads
+ *                 contiguous shares, running fn( arg, first, n ) once per
+ *                 share and concurrently
+ *
+ *                 The calling thread takes the first share, and any share
+ *                 whose thread cannot be started.
+ *
+ * \param fn       Function processing items first to first + n - 1
+ * \param arg      Argument of \p fn, shared by all threads
+ * \param count    Number of items
+ * \param threads  Number of threads, including the calling one; at most
+ *                 #MBEDTLS_THREADING_MAX_SPLIT are used
+ *
+ * \return         0 if all calls to \p fn succeeded, or the error of the
+ *                 first failing share
+ */
+int mbedtls_threading_split( int (*fn)( void *arg, size_t first, size_t n ),
+                             void *arg, size_t count, unsigned int threads );
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
 #ifdef __cplusplus
 }
 #endif
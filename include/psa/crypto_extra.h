@@ -47,6 +47,36 @@ extern "C" {
  */
 void mbedtls_psa_crypto_free( void );
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+struct mbedtls_ecdsa_nonce_pool;
+
+/**
+ * \brief Use a pool of precomputed nonces for randomized ECDSA signatures
+ *        on a curve.
+ *
+ * psa_asymmetric_sign() with #PSA_ALG_ECDSA and a key on \p curve then
+ * takes its nonces from \p pool, as mbedtls_ecdsa_sign_pool() does, and
+ * computes them itself when the pool is empty. Deterministic ECDSA does
+ * not use the pool.
+ *
+ * This is an Mbed TLS extension.
+ *
+ * \param curve         The curve.
+ * \param[in] pool      A pool set up with mbedtls_ecdsa_nonce_pool_setup()
+ *                      for \p curve. It must remain valid until it is
+ *                      replaced or mbedtls_psa_crypto_free() is called.
+ *                      \c NULL to stop using a pool for \p curve.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ *         \p curve is not a supported curve.
+ * \retval #PSA_ERROR_INVALID_ARGUMENT
+ *         \p pool is for another curve.
+ */
+psa_status_t mbedtls_psa_ecdsa_set_nonce_pool( psa_ecc_curve_t curve,
+                                               struct mbedtls_ecdsa_nonce_pool *pool );
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
+
 
 /**
  * \brief Inject an initial entropy seed for the random generator into
@@ -0,0 +1,235 @@
+/*
+ *  MULX/ADCX/ADOX support functions for Montgomery multiplication
+ *
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+/*
+ * [ADX-WP] Ozturk, Guilford, Gopal, Feghali: "New Instructions Supporting
+ *          Large Integer Arithmetic on Intel Architecture Processors",
+ *          Intel white paper, 2012
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ADX_C)
+
+#if defined(__has_feature)
+#if __has_feature(memory_sanitizer)
+#warning "MBEDTLS_ADX_C is known to cause spurious error reports with some memory sanitizers as they do not understand the assembly code."
+#endif
+#endif
+
+#include "mbedtls/adx.h"
+
+#include <string.h>
+
+#ifndef asm
+#define asm __asm
+#endif
+
+#if defined(MBEDTLS_HAVE_X86_64)
+
+/*
+ * BMI2 / ADX support detection routine
+ */
+int mbedtls_adx_has_support( unsigned int what )
+{
+    static int done = 0;
+    static unsigned int c = 0;
+
+    if( ! done )
+    {
+        unsigned int max_leaf, ebx7;
+
+        asm( "xorl  %%ecx, %%ecx \n\t"
+             "xorl  %%eax, %%eax \n\t"
+             "cpuid              \n\t"
+             : "=a" (max_leaf)
+             :
+             : "ebx", "ecx", "edx" );
+
+        if( max_leaf >= 7 )
+        {
+            asm( "movl  $7, %%eax   \n\t"
+                 "xorl  %%ecx, %%ecx \n\t"
+                 "cpuid             \n\t"
+                 : "=b" (ebx7)
+                 :
+                 : "eax", "ecx", "edx" );
+
+            c = ebx7;
+        }
+
+        done = 1;
+    }
+
+    return( ( c & what ) == what );
+}
+
+/*
+ * d[0..n) += s[0..n) * b, returning the carry limb
+ *
+ * Each limb product is added with two independent carry chains [ADX-WP]:
+ * ADCX adds the limb of d on CF, ADOX adds the high half of the previous
+ * product on OF. Loop control only uses LEA, JRCXZ and JMP, which leave
+ * both flags untouched.
+ */
+static uint64_t adx_mul_add_row( size_t n, const uint64_t *s, uint64_t *d,
+                                 uint64_t b )
+{
+    uint64_t c;
+
+    asm volatile( "xorl   %%r8d, %%r8d           \n\t"
+                  "movq   %[n1], %%rcx           \n\t"
+                  "1:                            \n\t"
+                  "jrcxz  2f                     \n\t"
+                  "mulx   (%%rsi), %%rax, %%r9   \n\t"
+                  "adcx   (%%rdi), %%rax         \n\t"
+                  "adox   %%r8, %%rax            \n\t"
+                  "movq   %%rax, (%%rdi)         \n\t"
+                  "movq   %%r9, %%r8             \n\t"
+                  "leaq   8(%%rsi), %%rsi        \n\t"
+                  "leaq   8(%%rdi), %%rdi        \n\t"
+                  "leaq   -1(%%rcx), %%rcx       \n\t"
+                  "jmp    1b                     \n\t"
+                  "2:                            \n\t"
+                  "movq   %[n4], %%rcx           \n\t"
+                  "3:                            \n\t"
+                  "jrcxz  4f                     \n\t"
+                  "mulx   (%%rsi), %%rax, %%r9   \n\t"
+                  "adcx   (%%rdi), %%rax         \n\t"
+                  "adox   %%r8, %%rax            \n\t"
+                  "movq   %%rax, (%%rdi)         \n\t"
+                  "mulx   8(%%rsi), %%rax, %%r8  \n\t"
+                  "adcx   8(%%rdi), %%rax        \n\t"
+                  "adox   %%r9, %%rax            \n\t"
+                  "movq   %%rax, 8(%%rdi)        \n\t"
+                  "mulx   16(%%rsi), %%rax, %%r9 \n\t"
+                  "adcx   16(%%rdi), %%rax       \n\t"
+                  "adox   %%r8, %%rax            \n\t"
+                  "movq   %%rax, 16(%%rdi)       \n\t"
+                  "mulx   24(%%rsi), %%rax, %%r8 \n\t"
+                  "adcx   24(%%rdi), %%rax       \n\t"
+                  "adox   %%r9, %%rax            \n\t"
+                  "movq   %%rax, 24(%%rdi)       \n\t"
+                  "leaq   32(%%rsi), %%rsi       \n\t"
+                  "leaq   32(%%rdi), %%rdi       \n\t"
+                  "leaq   -1(%%rcx), %%rcx       \n\t"
+                  "jmp    3b                     \n\t"
+                  "4:                            \n\t"
+                  "movl   $0, %%eax              \n\t"
+                  "adcx   %%rax, %%r8            \n\t"
+                  "adox   %%rax, %%r8            \n\t"
+                  "movq   %%r8, %[c]             \n\t"
+                  : [c] "=r" (c), "+S" (s), "+D" (d)
+                  : "d" (b), [n1] "r" (n & 3), [n4] "r" (n >> 2)
+                  : "rax", "rcx", "r8", "r9", "cc", "memory" );
+
+    return( c );
+}
+
+/*
+ * T[n..2n] = ( T[0..2n) + u * N ) / 2^(64 n), with u = -T / N mod 2^(64 n)
+ * computed one limb at a time
+ */
+static void adx_redc( size_t n, const uint64_t *N, uint64_t mm, uint64_t *T )
+{
+    size_t i;
+    uint64_t c, t, carry = 0;
+
+    for( i = 0; i < n; i++ )
+    {
+        c = adx_mul_add_row( n, N, T + i, T[i] * mm );
+
+        t = T[n + i] + carry;
+        carry = ( t < carry );
+        t += c;
+        carry += ( t < c );
+        T[n + i] = t;
+    }
+
+    T[2 * n] = carry;
+}
+
+/*
+ * Montgomery multiplication, separated operand scanning
+ */
+void mbedtls_adx_montmul( size_t n, const uint64_t *a, const uint64_t *b,
+                          const uint64_t *N, uint64_t mm, uint64_t *T )
+{
+    size_t i;
+
+    memset( T, 0, n * sizeof( uint64_t ) );
+
+    for( i = 0; i < n; i++ )
+        T[n + i] = adx_mul_add_row( n, a, T + i, b[i] );
+
+    adx_redc( n, N, mm, T );
+}
+
+/*
+ * Montgomery squaring: the cross products a[i] * a[j], i < j, are
+ * accumulated once, then doubled while the squares a[i]^2 are added
+ */
+void mbedtls_adx_montsqr( size_t n, const uint64_t *a,
+                          const uint64_t *N, uint64_t mm, uint64_t *T )
+{
+    size_t i;
+    const uint64_t *s = a;
+    uint64_t *d = T;
+
+    memset( T, 0, 2 * n * sizeof( uint64_t ) );
+
+    for( i = 0; i + 1 < n; i++ )
+        T[n + i] = adx_mul_add_row( n - i - 1, a + i + 1, T + 2 * i + 1, a[i] );
+
+    /* T = 2 T + sum a[i]^2 2^(128 i): doubling on CF, squares on OF */
+    asm volatile( "xorl   %%eax, %%eax           \n\t"
+                  "movq   %[n], %%rcx            \n\t"
+                  "1:                            \n\t"
+                  "jrcxz  2f                     \n\t"
+                  "movq   (%%rsi), %%rdx         \n\t"
+                  "mulx   %%rdx, %%rax, %%r9     \n\t"
+                  "movq   (%%rdi), %%r8          \n\t"
+                  "adcx   %%r8, %%r8             \n\t"
+                  "adox   %%rax, %%r8            \n\t"
+                  "movq   %%r8, (%%rdi)          \n\t"
+                  "movq   8(%%rdi), %%r8         \n\t"
+                  "adcx   %%r8, %%r8             \n\t"
+                  "adox   %%r9, %%r8             \n\t"
+                  "movq   %%r8, 8(%%rdi)         \n\t"
+                  "leaq   8(%%rsi), %%rsi        \n\t"
+                  "leaq   16(%%rdi), %%rdi       \n\t"
+                  "leaq   -1(%%rcx), %%rcx       \n\t"
+                  "jmp    1b                     \n\t"
+                  "2:                            \n\t"
+                  : "+S" (s), "+D" (d)
+                  : [n] "r" (n)
+                  : "rax", "rcx", "rdx", "r8", "r9", "cc", "memory" );
+
+    adx_redc( n, N, mm, T );
+}
+
+#endif /* MBEDTLS_HAVE_X86_64 */
+
+#endif /* MBEDTLS_ADX_C */
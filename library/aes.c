@@ -44,6 +44,9 @@
 #if defined(MBEDTLS_AESNI_C)
 #include "mbedtls/aesni.h"
 #endif
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include "mbedtls/threading.h"
+#endif
 
 #if defined(MBEDTLS_SELF_TEST)
 #if defined(MBEDTLS_PLATFORM_C)
@@ -973,6 +976,446 @@ void mbedtls_aes_decrypt( mbedtls_aes_context *ctx,
 }
 #endif /* !MBEDTLS_DEPRECATED_REMOVED */
 
+#if defined(MBEDTLS_AES_BITSLICE)
+/*
+ * Bitsliced AES encryption, after the "ct64" construction of BearSSL
+ * [BEARSSL-CT]: eight 64-bit words hold bit i of every byte of four blocks,
+ * so the S-box is evaluated for all 64 bytes at once by a boolean circuit
+ * (Boyar and Peralta, 113 gates) and no memory access depends on secret
+ * data. Two such groups are interleaved, for eight blocks per pass.
+ */
+#define AES_BS_BLOCKS   8
+
+#if defined(_MSC_VER) || defined(__WATCOMC__)
+  #define UL64(x) x##ui64
+#else
+  #define UL64(x) x##ULL
+#endif
+
+static void aes_bs_sbox( uint64_t q[8] )
+{
+    uint64_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint64_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint64_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint64_t y20, y21;
+    uint64_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint64_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint64_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint64_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint64_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint64_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint64_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint64_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint64_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint64_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+    x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+    /* Top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* Non-linear section (inversion in GF(2^8)) */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* Bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+    q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+}
+
+#define AES_BS_SWAPN( cl, ch, s, x, y )                         \
+    do {                                                        \
+        uint64_t a_ = (x), b_ = (y);                            \
+        (x) = ( a_ & (uint64_t) (cl) ) |                        \
+              ( ( b_ & (uint64_t) (cl) ) << (s) );              \
+        (y) = ( ( a_ & (uint64_t) (ch) ) >> (s) ) |             \
+              ( b_ & (uint64_t) (ch) );                         \
+    } while( 0 )
+
+#define AES_BS_SWAP2( x, y ) AES_BS_SWAPN( UL64( 0x5555555555555555 ),   \
+                                           UL64( 0xAAAAAAAAAAAAAAAA ),   \
+                                           1, x, y )
+#define AES_BS_SWAP4( x, y ) AES_BS_SWAPN( UL64( 0x3333333333333333 ),   \
+                                           UL64( 0xCCCCCCCCCCCCCCCC ),   \
+                                           2, x, y )
+#define AES_BS_SWAP8( x, y ) AES_BS_SWAPN( UL64( 0x0F0F0F0F0F0F0F0F ),   \
+                                           UL64( 0xF0F0F0F0F0F0F0F0 ),   \
+                                           4, x, y )
+
+/*
+ * Transpose between byte-sliced and bit-sliced representations
+ * (the transform is its own inverse)
+ */
+static void aes_bs_ortho( uint64_t q[8] )
+{
+    AES_BS_SWAP2( q[0], q[1] );
+    AES_BS_SWAP2( q[2], q[3] );
+    AES_BS_SWAP2( q[4], q[5] );
+    AES_BS_SWAP2( q[6], q[7] );
+
+    AES_BS_SWAP4( q[0], q[2] );
+    AES_BS_SWAP4( q[1], q[3] );
+    AES_BS_SWAP4( q[4], q[6] );
+    AES_BS_SWAP4( q[5], q[7] );
+
+    AES_BS_SWAP8( q[0], q[4] );
+    AES_BS_SWAP8( q[1], q[5] );
+    AES_BS_SWAP8( q[2], q[6] );
+    AES_BS_SWAP8( q[3], q[7] );
+}
+
+/*
+ * Spread the four little-endian words of one block over two 64-bit words,
+ * one byte in every 16 bits
+ */
+static void aes_bs_interleave_in( uint64_t *q0, uint64_t *q1,
+                                  const uint32_t w[4] )
+{
+    uint64_t x0, x1, x2, x3;
+
+    x0 = w[0];
+    x1 = w[1];
+    x2 = w[2];
+    x3 = w[3];
+    x0 |= ( x0 << 16 );
+    x1 |= ( x1 << 16 );
+    x2 |= ( x2 << 16 );
+    x3 |= ( x3 << 16 );
+    x0 &= UL64( 0x0000FFFF0000FFFF );
+    x1 &= UL64( 0x0000FFFF0000FFFF );
+    x2 &= UL64( 0x0000FFFF0000FFFF );
+    x3 &= UL64( 0x0000FFFF0000FFFF );
+    x0 |= ( x0 << 8 );
+    x1 |= ( x1 << 8 );
+    x2 |= ( x2 << 8 );
+    x3 |= ( x3 << 8 );
+    x0 &= UL64( 0x00FF00FF00FF00FF );
+    x1 &= UL64( 0x00FF00FF00FF00FF );
+    x2 &= UL64( 0x00FF00FF00FF00FF );
+    x3 &= UL64( 0x00FF00FF00FF00FF );
+    *q0 = x0 | ( x2 << 8 );
+    *q1 = x1 | ( x3 << 8 );
+}
+
+static void aes_bs_interleave_out( uint32_t w[4], uint64_t q0, uint64_t q1 )
+{
+    uint64_t x0, x1, x2, x3;
+
+    x0 = q0 & UL64( 0x00FF00FF00FF00FF );
+    x1 = q1 & UL64( 0x00FF00FF00FF00FF );
+    x2 = ( q0 >> 8 ) & UL64( 0x00FF00FF00FF00FF );
+    x3 = ( q1 >> 8 ) & UL64( 0x00FF00FF00FF00FF );
+    x0 |= ( x0 >> 8 );
+    x1 |= ( x1 >> 8 );
+    x2 |= ( x2 >> 8 );
+    x3 |= ( x3 >> 8 );
+    x0 &= UL64( 0x0000FFFF0000FFFF );
+    x1 &= UL64( 0x0000FFFF0000FFFF );
+    x2 &= UL64( 0x0000FFFF0000FFFF );
+    x3 &= UL64( 0x0000FFFF0000FFFF );
+    w[0] = (uint32_t) x0 | (uint32_t) ( x0 >> 16 );
+    w[1] = (uint32_t) x1 | (uint32_t) ( x1 >> 16 );
+    w[2] = (uint32_t) x2 | (uint32_t) ( x2 >> 16 );
+    w[3] = (uint32_t) x3 | (uint32_t) ( x3 >> 16 );
+}
+
+/*
+ * Convert the encryption key schedule of ctx into bitsliced round keys:
+ * 8 words per round, each round key replicated over the four blocks
+ */
+static void aes_bs_expand_key( const mbedtls_aes_context *ctx,
+                               uint64_t skey[( 14 + 1 ) * 8] )
+{
+    int r, k;
+    uint64_t q[8];
+    uint32_t rk[4];
+
+    for( r = 0; r <= ctx->nr; r++ )
+    {
+        /* Round keys are native words; the AES-NI key schedule stores raw
+         * bytes instead, which is the same on the little-endian x86 */
+        for( k = 0; k < 4; k++ )
+            rk[k] = ctx->rk[4 * r + k];
+
+        aes_bs_interleave_in( &q[0], &q[4], rk );
+        q[1] = q[0]; q[2] = q[0]; q[3] = q[0];
+        q[5] = q[4]; q[6] = q[4]; q[7] = q[4];
+        aes_bs_ortho( q );
+
+        for( k = 0; k < 8; k++ )
+            skey[8 * r + k] = q[k];
+    }
+
+    mbedtls_platform_zeroize( q, sizeof( q ) );
+    mbedtls_platform_zeroize( rk, sizeof( rk ) );
+}
+
+static void aes_bs_shift_rows( uint64_t q[8] )
+{
+    int i;
+
+    for( i = 0; i < 8; i++ )
+    {
+        uint64_t x = q[i];
+
+        q[i] = ( x & UL64( 0x000000000000FFFF ) )
+             | ( ( x & UL64( 0x00000000FFF00000 ) ) >> 4 )
+             | ( ( x & UL64( 0x00000000000F0000 ) ) << 12 )
+             | ( ( x & UL64( 0x0000FF0000000000 ) ) >> 8 )
+             | ( ( x & UL64( 0x000000FF00000000 ) ) << 8 )
+             | ( ( x & UL64( 0xF000000000000000 ) ) >> 12 )
+             | ( ( x & UL64( 0x0FFF000000000000 ) ) << 4 );
+    }
+}
+
+#define AES_BS_ROTR32( x )  ( ( (x) << 32 ) | ( (x) >> 32 ) )
+
+static void aes_bs_mix_columns( uint64_t q[8] )
+{
+    uint64_t q0, q1, q2, q3, q4, q5, q6, q7;
+    uint64_t r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0]; q1 = q[1]; q2 = q[2]; q3 = q[3];
+    q4 = q[4]; q5 = q[5]; q6 = q[6]; q7 = q[7];
+    r0 = ( q0 >> 16 ) | ( q0 << 48 );
+    r1 = ( q1 >> 16 ) | ( q1 << 48 );
+    r2 = ( q2 >> 16 ) | ( q2 << 48 );
+    r3 = ( q3 >> 16 ) | ( q3 << 48 );
+    r4 = ( q4 >> 16 ) | ( q4 << 48 );
+    r5 = ( q5 >> 16 ) | ( q5 << 48 );
+    r6 = ( q6 >> 16 ) | ( q6 << 48 );
+    r7 = ( q7 >> 16 ) | ( q7 << 48 );
+
+    q[0] = q7 ^ r7 ^ r0 ^ AES_BS_ROTR32( q0 ^ r0 );
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ AES_BS_ROTR32( q1 ^ r1 );
+    q[2] = q1 ^ r1 ^ r2 ^ AES_BS_ROTR32( q2 ^ r2 );
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ AES_BS_ROTR32( q3 ^ r3 );
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ AES_BS_ROTR32( q4 ^ r4 );
+    q[5] = q4 ^ r4 ^ r5 ^ AES_BS_ROTR32( q5 ^ r5 );
+    q[6] = q5 ^ r5 ^ r6 ^ AES_BS_ROTR32( q6 ^ r6 );
+    q[7] = q6 ^ r6 ^ r7 ^ AES_BS_ROTR32( q7 ^ r7 );
+}
+
+static void aes_bs_add_round_key( uint64_t q[8], const uint64_t sk[8] )
+{
+    int i;
+
+    for( i = 0; i < 8; i++ )
+        q[i] ^= sk[i];
+}
+
+/*
+ * Encrypt up to AES_BS_BLOCKS blocks with bitsliced round keys, in groups
+ * of four. Unused block slots are processed as zeros and discarded.
+ */
+static void aes_bs_encrypt( int nr, const uint64_t *skey, size_t nblocks,
+                            const unsigned char *input,
+                            unsigned char *output )
+{
+    int r;
+    size_t i, k, groups = ( nblocks + 3 ) / 4;
+    uint64_t q[2][8];
+    uint32_t w[AES_BS_BLOCKS * 4];
+
+    memset( w, 0, sizeof( w ) );
+    for( i = 0; i < nblocks * 4; i++ )
+        GET_UINT32_LE( w[i], input, 4 * i );
+
+    for( k = 0; k < groups; k++ )
+    {
+        for( i = 0; i < 4; i++ )
+            aes_bs_interleave_in( &q[k][i], &q[k][i + 4], w + 16 * k + 4 * i );
+        aes_bs_ortho( q[k] );
+        aes_bs_add_round_key( q[k], skey );
+    }
+
+    for( r = 1; r < nr; r++ )
+    {
+        for( k = 0; k < groups; k++ )
+        {
+            aes_bs_sbox( q[k] );
+            aes_bs_shift_rows( q[k] );
+            aes_bs_mix_columns( q[k] );
+            aes_bs_add_round_key( q[k], skey + 8 * r );
+        }
+    }
+
+    for( k = 0; k < groups; k++ )
+    {
+        aes_bs_sbox( q[k] );
+        aes_bs_shift_rows( q[k] );
+        aes_bs_add_round_key( q[k], skey + 8 * nr );
+        aes_bs_ortho( q[k] );
+        for( i = 0; i < 4; i++ )
+            aes_bs_interleave_out( w + 16 * k + 4 * i, q[k][i], q[k][i + 4] );
+    }
+
+    for( i = 0; i < nblocks * 4; i++ )
+        PUT_UINT32_LE( w[i], output, 4 * i );
+
+    mbedtls_platform_zeroize( q, sizeof( q ) );
+    mbedtls_platform_zeroize( w, sizeof( w ) );
+}
+
+/*
+ * Use the bitsliced code for bulk encryption only when no hardware
+ * acceleration is available
+ */
+static int aes_bs_active( void )
+{
+#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) )
+        return( 0 );
+#endif
+#if defined(MBEDTLS_PADLOCK_C) && defined(MBEDTLS_HAVE_X86)
+    if( aes_padlock_ace > 0 )
+        return( 0 );
+#endif
+    return( 1 );
+}
+
+int mbedtls_internal_aes_encrypt_bitsliced( mbedtls_aes_context *ctx,
+                                            size_t nblocks,
+                                            const unsigned char *input,
+                                            unsigned char *output )
+{
+    uint64_t skey[( 14 + 1 ) * 8];
+
+    aes_bs_expand_key( ctx, skey );
+
+    while( nblocks > 0 )
+    {
+        size_t n = nblocks < AES_BS_BLOCKS ? nblocks : AES_BS_BLOCKS;
+
+        aes_bs_encrypt( ctx->nr, skey, n, input, output );
+
+        nblocks -= n;
+        input += 16 * n;
+        output += 16 * n;
+    }
+
+    mbedtls_platform_zeroize( skey, sizeof( skey ) );
+
+    return( 0 );
+}
+#endif /* MBEDTLS_AES_BITSLICE */
+
 /*
  * AES-ECB block encryption/decryption
  */
@@ -1127,35 +1570,78 @@ static void mbedtls_gf128mul_x_ble( unsigned char r[16],
 }
 
 /*
- * AES-XTS buffer encryption/decryption
+ * AES-XTS en/decryption of one data unit whose (encrypted) tweak is known.
+ * The length has been checked by the caller. The tweak is overwritten.
  */
-int mbedtls_aes_crypt_xts( mbedtls_aes_xts_context *ctx,
-                           int mode,
-                           size_t length,
-                           const unsigned char data_unit[16],
-                           const unsigned char *input,
-                           unsigned char *output )
+static int aes_xts_crypt_unit( mbedtls_aes_xts_context *ctx,
+                               int mode,
+                               size_t length,
+                               unsigned char tweak[16],
+                               const unsigned char *input,
+                               unsigned char *output )
 {
     int ret;
     size_t blocks = length / 16;
     size_t leftover = length % 16;
-    unsigned char tweak[16];
     unsigned char prev_tweak[16];
     unsigned char tmp[16];
 
-    /* Data units must be at least 16 bytes long. */
-    if( length < 16 )
-        return MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH;
+#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) )
+    {
+        /* When decrypting with ciphertext stealing, the last full block
+         * uses the tweak after the next one: leave it to the loop below. */
+        size_t n = blocks;
 
-    /* NIST SP 800-38E disallows data units larger than 2**20 blocks. */
-    if( length > ( 1 << 20 ) * 16 )
-        return MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH;
+        if( leftover && mode == MBEDTLS_AES_DECRYPT )
+            n--;
+        n &= ~(size_t) 3;
 
-    /* Compute the tweak. */
-    ret = mbedtls_aes_crypt_ecb( &ctx->tweak, MBEDTLS_AES_ENCRYPT,
-                                 data_unit, tweak );
-    if( ret != 0 )
-        return( ret );
+        mbedtls_aesni_xts_crypt( &ctx->crypt, mode, n, tweak, input, output );
+
+        blocks -= n;
+        input += 16 * n;
+        output += 16 * n;
+    }
+#endif
+
+#if defined(MBEDTLS_AES_BITSLICE)
+    if( mode == MBEDTLS_AES_ENCRYPT && blocks > 1 && aes_bs_active() )
+    {
+        uint64_t skey[( 14 + 1 ) * 8];
+        unsigned char tweaks[AES_BS_BLOCKS * 16];
+        unsigned char buf[AES_BS_BLOCKS * 16];
+
+        aes_bs_expand_key( &ctx->crypt, skey );
+
+        while( blocks > 0 )
+        {
+            size_t i, n = blocks < AES_BS_BLOCKS ? blocks : AES_BS_BLOCKS;
+
+            for( i = 0; i < n; i++ )
+            {
+                memcpy( tweaks + 16 * i, tweak, 16 );
+                mbedtls_gf128mul_x_ble( tweak, tweak );
+            }
+
+            for( i = 0; i < 16 * n; i++ )
+                buf[i] = input[i] ^ tweaks[i];
+
+            aes_bs_encrypt( ctx->crypt.nr, skey, n, buf, buf );
+
+            for( i = 0; i < 16 * n; i++ )
+                output[i] = buf[i] ^ tweaks[i];
+
+            blocks -= n;
+            output += 16 * n;
+            input += 16 * n;
+        }
+
+        mbedtls_platform_zeroize( skey, sizeof( skey ) );
+        mbedtls_platform_zeroize( tweaks, sizeof( tweaks ) );
+        mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    }
+#endif /* MBEDTLS_AES_BITSLICE */
 
     while( blocks-- )
     {
@@ -1168,7 +1654,7 @@ int mbedtls_aes_crypt_xts( mbedtls_aes_xts_context *ctx,
              * and this tweak for the lefover bytes. Save the current tweak for
              * the leftovers and then update the current tweak for use on this,
              * the last full block. */
-            memcpy( prev_tweak, tweak, sizeof( tweak ) );
+            memcpy( prev_tweak, tweak, sizeof( prev_tweak ) );
             mbedtls_gf128mul_x_ble( tweak, tweak );
         }
 
@@ -1177,7 +1663,7 @@ int mbedtls_aes_crypt_xts( mbedtls_aes_xts_context *ctx,
 
         ret = mbedtls_aes_crypt_ecb( &ctx->crypt, mode, tmp, tmp );
         if( ret != 0 )
-            return( ret );
+            goto exit;
 
         for( i = 0; i < 16; i++ )
             output[i] = tmp[i] ^ tweak[i];
@@ -1206,8 +1692,8 @@ int mbedtls_aes_crypt_xts( mbedtls_aes_xts_context *ctx,
          * are the same). */
         for( i = 0; i < leftover; i++ )
         {
-            output[i] = prev_output[i];
             tmp[i] = input[i] ^ t[i];
+            output[i] = prev_output[i];
         }
 
         /* Copy ciphertext bytes from the previous block for input in this
@@ -1217,7 +1703,7 @@ int mbedtls_aes_crypt_xts( mbedtls_aes_xts_context *ctx,
 
         ret = mbedtls_aes_crypt_ecb( &ctx->crypt, mode, tmp, tmp );
         if( ret != 0 )
-            return ret;
+            goto exit;
 
         /* Write the result back to the previous block, overriding the previous
          * output we copied. */
@@ -1225,8 +1711,131 @@ int mbedtls_aes_crypt_xts( mbedtls_aes_xts_context *ctx,
             prev_output[i] = tmp[i] ^ t[i];
     }
 
-    return( 0 );
+    ret = 0;
+
+exit:
+    mbedtls_platform_zeroize( prev_tweak, sizeof( prev_tweak ) );
+    mbedtls_platform_zeroize( tmp, sizeof( tmp ) );
+
+    return( ret );
+}
+
+/*
+ * AES-XTS buffer encryption/decryption
+ */
+int mbedtls_aes_crypt_xts( mbedtls_aes_xts_context *ctx,
+                           int mode,
+                           size_t length,
+                           const unsigned char data_unit[16],
+                           const unsigned char *input,
+                           unsigned char *output )
+{
+    int ret;
+    unsigned char tweak[16];
+
+    /* Data units must be at least 16 bytes long. */
+    if( length < 16 )
+        return MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH;
+
+    /* NIST SP 800-38E disallows data units larger than 2**20 blocks. */
+    if( length > ( 1 << 20 ) * 16 )
+        return MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH;
+
+    /* Compute the tweak. */
+    ret = mbedtls_aes_crypt_ecb( &ctx->tweak, MBEDTLS_AES_ENCRYPT,
+                                 data_unit, tweak );
+    if( ret != 0 )
+        return( ret );
+
+    return( aes_xts_crypt_unit( ctx, mode, length, tweak, input, output ) );
+}
+
+/* Number of data unit tweaks encrypted together */
+#define AES_XTS_TWEAK_BATCH     16
+
+/*
+ * AES-XTS encryption/decryption of many data units of the same length
+ */
+int mbedtls_aes_crypt_xts_multi( mbedtls_aes_xts_context *ctx,
+                                 int mode,
+                                 size_t length,
+                                 const mbedtls_aes_xts_sector *sectors,
+                                 size_t count )
+{
+    int ret = 0;
+    size_t i, n;
+    unsigned char tweaks[AES_XTS_TWEAK_BATCH * 16];
+
+    if( length < 16 || length > ( 1 << 20 ) * 16 )
+        return MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH;
+
+    if( count > 0 && sectors == NULL )
+        return( MBEDTLS_ERR_AES_BAD_INPUT_DATA );
+
+    for( ; count > 0; count -= n, sectors += n )
+    {
+        n = count < AES_XTS_TWEAK_BATCH ? count : AES_XTS_TWEAK_BATCH;
+
+        /* The tweaks of the next few data units, in one go */
+        memset( tweaks, 0, 16 * n );
+        for( i = 0; i < n; i++ )
+            PUT_UINT64_LE( sectors[i].data_unit, tweaks, 16 * i );
+
+        ret = mbedtls_aes_encrypt_blocks( &ctx->tweak, n, tweaks, tweaks );
+        if( ret != 0 )
+            goto exit;
+
+        for( i = 0; i < n; i++ )
+        {
+            ret = aes_xts_crypt_unit( ctx, mode, length, tweaks + 16 * i,
+                                      sectors[i].input, sectors[i].output );
+            if( ret != 0 )
+                goto exit;
+        }
+    }
+
+exit:
+    mbedtls_platform_zeroize( tweaks, sizeof( tweaks ) );
+
+    return( ret );
 }
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+typedef struct
+{
+    mbedtls_aes_xts_context *ctx;
+    int mode;
+    size_t length;
+    const mbedtls_aes_xts_sector *sectors;
+} aes_xts_share;
+
+static int aes_xts_share_run( void *arg, size_t first, size_t n )
+{
+    aes_xts_share *share = (aes_xts_share *) arg;
+
+    return( mbedtls_aes_crypt_xts_multi( share->ctx, share->mode,
+                                         share->length,
+                                         share->sectors + first, n ) );
+}
+
+int mbedtls_aes_crypt_xts_multi_threads( mbedtls_aes_xts_context *ctx,
+                                         int mode,
+                                         size_t length,
+                                         const mbedtls_aes_xts_sector *sectors,
+                                         size_t count,
+                                         unsigned int threads )
+{
+    aes_xts_share share;
+
+    share.ctx = ctx;
+    share.mode = mode;
+    share.length = length;
+    share.sectors = sectors;
+
+    return( mbedtls_threading_split( aes_xts_share_run, &share,
+                                     count, threads ) );
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
 #endif /* MBEDTLS_CIPHER_MODE_XTS */
 
 #if defined(MBEDTLS_CIPHER_MODE_CFB)
@@ -1361,6 +1970,46 @@ int mbedtls_aes_crypt_ctr( mbedtls_aes_context *ctx,
     if ( n > 0x0F )
         return( MBEDTLS_ERR_AES_BAD_INPUT_DATA );
 
+#if defined(MBEDTLS_AES_BITSLICE)
+    /* Whole keystream blocks, eight counters at a time */
+    if( n == 0 && length >= 32 && aes_bs_active() )
+    {
+        uint64_t skey[( 14 + 1 ) * 8];
+        unsigned char buf[AES_BS_BLOCKS * 16];
+        size_t j, nb = 0;
+
+        aes_bs_expand_key( ctx, skey );
+
+        while( length >= 16 )
+        {
+            nb = length / 16 < AES_BS_BLOCKS ? length / 16 : AES_BS_BLOCKS;
+
+            for( j = 0; j < nb; j++ )
+            {
+                memcpy( buf + 16 * j, nonce_counter, 16 );
+
+                for( i = 16; i > 0; i-- )
+                    if( ++nonce_counter[i - 1] != 0 )
+                        break;
+            }
+
+            aes_bs_encrypt( ctx->nr, skey, nb, buf, buf );
+
+            for( j = 0; j < 16 * nb; j++ )
+                output[j] = (unsigned char)( input[j] ^ buf[j] );
+
+            length -= 16 * nb;
+            input += 16 * nb;
+            output += 16 * nb;
+        }
+
+        memcpy( stream_block, buf + 16 * ( nb - 1 ), 16 );
+
+        mbedtls_platform_zeroize( skey, sizeof( skey ) );
+        mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    }
+#endif /* MBEDTLS_AES_BITSLICE */
+
     while( length-- )
     {
         if( n == 0 ) {
@@ -1384,6 +2033,67 @@ int mbedtls_aes_crypt_ctr( mbedtls_aes_context *ctx,
 
 #endif /* !MBEDTLS_AES_ALT */
 
+/*
+ * AES-ECB encryption of consecutive independent blocks
+ */
+int mbedtls_aes_encrypt_blocks( mbedtls_aes_context *ctx,
+                                size_t nblocks,
+                                const unsigned char *input,
+                                unsigned char *output )
+{
+    int ret;
+
+#if !defined(MBEDTLS_AES_ALT) && \
+    defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) )
+        return( mbedtls_aesni_encrypt_blocks( ctx, nblocks, input, output ) );
+#endif
+
+#if defined(MBEDTLS_AES_BITSLICE)
+    if( aes_bs_active() )
+        return( mbedtls_internal_aes_encrypt_bitsliced( ctx, nblocks,
+                                                        input, output ) );
+#endif
+
+    while( nblocks-- > 0 )
+    {
+        ret = mbedtls_aes_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT, input, output );
+        if( ret != 0 )
+            return( ret );
+
+        input += 16;
+        output += 16;
+    }
+
+    return( 0 );
+}
+
+int mbedtls_aes_decrypt_blocks( mbedtls_aes_context *ctx,
+                                size_t nblocks,
+                                const unsigned char *input,
+                                unsigned char *output )
+{
+    int ret;
+
+#if !defined(MBEDTLS_AES_ALT) && \
+    defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) )
+        return( mbedtls_aesni_decrypt_blocks( ctx, nblocks, input, output ) );
+#endif
+
+    while( nblocks-- > 0 )
+    {
+        ret = mbedtls_aes_crypt_ecb( ctx, MBEDTLS_AES_DECRYPT, input, output );
+        if( ret != 0 )
+            return( ret );
+
+        input += 16;
+        output += 16;
+    }
+
+    return( 0 );
+}
+
 #if defined(MBEDTLS_SELF_TEST)
 /*
  * AES test vectors from:
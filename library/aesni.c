@@ -39,6 +39,7 @@
 #endif
 
 #include "mbedtls/aesni.h"
+#include "mbedtls/platform_util.h"
 
 #include <string.h>
 
@@ -94,6 +95,10 @@ int mbedtls_aesni_has_support( unsigned int what )
 #define xmm0_xmm4   "0xE0"
 #define xmm1_xmm0   "0xC1"
 #define xmm1_xmm2   "0xD1"
+#define xmm4_xmm0   "0xC4"
+#define xmm4_xmm1   "0xCC"
+#define xmm4_xmm2   "0xD4"
+#define xmm4_xmm3   "0xDC"
 
 /*
  * AES-NI AES-ECB block en(de)cryption
@@ -140,6 +145,303 @@ int mbedtls_aesni_crypt_ecb( mbedtls_aes_context *ctx,
     return( 0 );
 }
 
+/*
+ * AES-NI en/decryption of consecutive blocks, four at a time so that the
+ * AESENC/AESDEC latency of one block is hidden behind the others
+ */
+#define AESNI_CRYPT4( OP, OPLAST )                                          \
+        asm volatile( "movdqu    (%1), %%xmm4    \n\t" /* round key 0 */     \
+             "movdqu      (%2), %%xmm0    \n\t" /* load input */             \
+             "movdqu    16(%2), %%xmm1    \n\t"                              \
+             "movdqu    32(%2), %%xmm2    \n\t"                              \
+             "movdqu    48(%2), %%xmm3    \n\t"                              \
+             "pxor      %%xmm4, %%xmm0  \n\t" /* round 0 */                  \
+             "pxor      %%xmm4, %%xmm1  \n\t"                                \
+             "pxor      %%xmm4, %%xmm2  \n\t"                                \
+             "pxor      %%xmm4, %%xmm3  \n\t"                                \
+             "add       $16, %1         \n\t" /* next round key */           \
+                                                                            \
+             "1:                        \n\t" /* rounds loop */              \
+             "movdqu    (%1), %%xmm4    \n\t" /* load round key */           \
+             OP         xmm4_xmm0      "\n\t" /* do round */                 \
+             OP         xmm4_xmm1      "\n\t"                                \
+             OP         xmm4_xmm2      "\n\t"                                \
+             OP         xmm4_xmm3      "\n\t"                                \
+             "add       $16, %1         \n\t" /* next round key */           \
+             "subl      $1, %0          \n\t" /* loop */                     \
+             "jnz       1b              \n\t"                                \
+             "movdqu    (%1), %%xmm4    \n\t" /* load round key */           \
+             OPLAST     xmm4_xmm0      "\n\t" /* last round */               \
+             OPLAST     xmm4_xmm1      "\n\t"                                \
+             OPLAST     xmm4_xmm2      "\n\t"                                \
+             OPLAST     xmm4_xmm3      "\n\t"                                \
+                                                                            \
+             "movdqu    %%xmm0,   (%3)  \n\t" /* export output */            \
+             "movdqu    %%xmm1, 16(%3)  \n\t"                                \
+             "movdqu    %%xmm2, 32(%3)  \n\t"                                \
+             "movdqu    %%xmm3, 48(%3)  \n\t"                                \
+             : "+r" (rounds), "+r" (rk)                                     \
+             : "r" (input), "r" (output)                                    \
+             : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4" )
+
+int mbedtls_aesni_encrypt_blocks( mbedtls_aes_context *ctx,
+                                  size_t nblocks,
+                                  const unsigned char *input,
+                                  unsigned char *output )
+{
+    for( ; nblocks >= 4; nblocks -= 4, input += 64, output += 64 )
+    {
+        int rounds = ctx->nr - 1;
+        const uint32_t *rk = ctx->rk;
+
+        AESNI_CRYPT4( AESENC, AESENCLAST );
+    }
+
+    for( ; nblocks > 0; nblocks--, input += 16, output += 16 )
+        mbedtls_aesni_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT, input, output );
+
+    return( 0 );
+}
+
+int mbedtls_aesni_decrypt_blocks( mbedtls_aes_context *ctx,
+                                  size_t nblocks,
+                                  const unsigned char *input,
+                                  unsigned char *output )
+{
+    for( ; nblocks >= 4; nblocks -= 4, input += 64, output += 64 )
+    {
+        int rounds = ctx->nr - 1;
+        const uint32_t *rk = ctx->rk;
+
+        AESNI_CRYPT4( AESDEC, AESDECLAST );
+    }
+
+    for( ; nblocks > 0; nblocks--, input += 16, output += 16 )
+        mbedtls_aesni_crypt_ecb( ctx, MBEDTLS_AES_DECRYPT, input, output );
+
+    return( 0 );
+}
+
+/*
+ * Run the CBC-MAC and the CTR keystream of CCM through the rounds side by
+ * side: the lane in xmm0 is the MAC state, the lane in xmm1 the counter.
+ * y[] is the MAC state, c[] the counter block, p[] the block to authenticate
+ * which is xored into the MAC state after (decryption) or before (encryption)
+ * the rounds, and s[] receives the keystream block.
+ */
+#define CCM_ROUNDS2                                                         \
+             "movdqu    (%1), %%xmm4    \n\t" /* round 0 */                 \
+             "pxor      %%xmm4, %%xmm0  \n\t"                               \
+             "pxor      %%xmm4, %%xmm1  \n\t"                               \
+             "add       $16, %1         \n\t"                               \
+             "1:                        \n\t" /* encryption loop */         \
+             "movdqu    (%1), %%xmm4    \n\t"                               \
+             AESENC     xmm4_xmm0      "\n\t"                               \
+             AESENC     xmm4_xmm1      "\n\t"                               \
+             "add       $16, %1         \n\t"                               \
+             "subl      $1, %0          \n\t"                               \
+             "jnz       1b              \n\t"                               \
+             "movdqu    (%1), %%xmm4    \n\t" /* last round */              \
+             AESENCLAST xmm4_xmm0      "\n\t"                               \
+             AESENCLAST xmm4_xmm1      "\n\t"
+
+/*
+ * Increment the big-endian counter in the last bytes of the block.
+ * The caller guarantees that it does not overflow the CCM counter field.
+ */
+static void aesni_ccm_inc( unsigned char ctr[16] )
+{
+    int i;
+
+    for( i = 15; i > 0; i-- )
+        if( ++ctr[i] != 0 )
+            break;
+}
+
+/*
+ * CCM payload processing, CBC-MAC and CTR interleaved
+ */
+void mbedtls_aesni_ccm_crypt( mbedtls_aes_context *ctx, int mode,
+                              size_t nblocks,
+                              unsigned char ctr[16], unsigned char y[16],
+                              const unsigned char *input,
+                              unsigned char *output )
+{
+    unsigned char s[16];
+    size_t i;
+
+    if( nblocks == 0 )
+        return;
+
+    if( mode == MBEDTLS_AES_ENCRYPT )
+    {
+        /* y = E(y ^ P), C = P ^ E(ctr) */
+        for( ; nblocks > 0; nblocks--, input += 16, output += 16 )
+        {
+            int rounds = ctx->nr - 1;
+            const uint32_t *rk = ctx->rk;
+
+            asm volatile( "movdqu    (%2), %%xmm0    \n\t" // MAC state
+                 "movdqu    (%3), %%xmm1    \n\t" // counter
+                 "movdqu    (%4), %%xmm3    \n\t" // plaintext
+                 "pxor      %%xmm3, %%xmm0  \n\t"
+                 CCM_ROUNDS2
+                 "pxor      %%xmm1, %%xmm3  \n\t"
+                 "movdqu    %%xmm0, (%2)    \n\t"
+                 "movdqu    %%xmm3, (%5)    \n\t"
+                 : "+r" (rounds), "+r" (rk)
+                 : "r" (y), "r" (ctr), "r" (input), "r" (output)
+                 : "memory", "cc", "xmm0", "xmm1", "xmm3", "xmm4" );
+
+            aesni_ccm_inc( ctr );
+        }
+
+        return;
+    }
+
+    /*
+     * Decryption needs the keystream before the MAC input is known, so the
+     * MAC lane runs one block behind: each step finishes the MAC of the
+     * previous plaintext block while producing the next keystream block.
+     */
+    mbedtls_aesni_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT, ctr, s );
+    aesni_ccm_inc( ctr );
+    for( i = 0; i < 16; i++ )
+    {
+        output[i] = input[i] ^ s[i];
+        y[i] ^= output[i];
+    }
+
+    for( nblocks--, input += 16, output += 16; nblocks > 0;
+         nblocks--, input += 16, output += 16 )
+    {
+        int rounds = ctx->nr - 1;
+        const uint32_t *rk = ctx->rk;
+
+        asm volatile( "movdqu    (%2), %%xmm0    \n\t" // MAC state
+             "movdqu    (%3), %%xmm1    \n\t" // counter
+             "movdqu    (%4), %%xmm3    \n\t" // ciphertext
+             CCM_ROUNDS2
+             "pxor      %%xmm1, %%xmm3  \n\t" // plaintext
+             "pxor      %%xmm3, %%xmm0  \n\t"
+             "movdqu    %%xmm0, (%2)    \n\t"
+             "movdqu    %%xmm3, (%5)    \n\t"
+             : "+r" (rounds), "+r" (rk)
+             : "r" (y), "r" (ctr), "r" (input), "r" (output)
+             : "memory", "cc", "xmm0", "xmm1", "xmm3", "xmm4" );
+
+        aesni_ccm_inc( ctr );
+    }
+
+    mbedtls_aesni_crypt_ecb( ctx, MBEDTLS_AES_ENCRYPT, y, y );
+    mbedtls_platform_zeroize( s, sizeof( s ) );
+}
+
+#undef CCM_ROUNDS2
+
+/*
+ * XTS tweak doubling: multiply the tweak in register S by x in GF(2^128)
+ * (little-endian convention) and store it in register D.
+ * pshufd moves the top bit of each 64-bit half to where its carry goes,
+ * psrad turns it into a mask, and xmm7 holds the carry values {0x87, 1}.
+ */
+#define XTS_DOUBLE( S, D )                                                  \
+             "pshufd    $0x13, %%" S ", %%xmm10 \n\t"                       \
+             "psrad     $31, %%xmm10    \n\t"                               \
+             "pand      %%xmm7, %%xmm10 \n\t"                               \
+             "movdqa    %%" S ", %%" D "\n\t"                               \
+             "paddq     %%" D ", %%" D "\n\t"                               \
+             "pxor      %%xmm10, %%" D "\n\t"
+
+/*
+ * Four XTS blocks: compute the four tweaks from the one at (%4) and write
+ * back the next one, whiten the input with them, run the rounds with the
+ * given instructions, and whiten the output.
+ */
+#define XTS_CRYPT4( RND, LAST )                                             \
+             "movdqu    (%4), %%xmm5    \n\t" /* tweaks */                  \
+             "movdqu    (%5), %%xmm7    \n\t"                               \
+             XTS_DOUBLE( "xmm5", "xmm6" )                                   \
+             XTS_DOUBLE( "xmm6", "xmm8" )                                   \
+             XTS_DOUBLE( "xmm8", "xmm9" )                                   \
+             "movdqu      (%2), %%xmm0  \n\t" /* load input */              \
+             "movdqu    16(%2), %%xmm1  \n\t"                               \
+             "movdqu    32(%2), %%xmm2  \n\t"                               \
+             "movdqu    48(%2), %%xmm3  \n\t"                               \
+             "pxor      %%xmm5, %%xmm0  \n\t"                               \
+             "pxor      %%xmm6, %%xmm1  \n\t"                               \
+             "pxor      %%xmm8, %%xmm2  \n\t"                               \
+             "pxor      %%xmm9, %%xmm3  \n\t"                               \
+             "movdqu    (%1), %%xmm4    \n\t" /* round 0 */                 \
+             "pxor      %%xmm4, %%xmm0  \n\t"                               \
+             "pxor      %%xmm4, %%xmm1  \n\t"                               \
+             "pxor      %%xmm4, %%xmm2  \n\t"                               \
+             "pxor      %%xmm4, %%xmm3  \n\t"                               \
+             "add       $16, %1         \n\t"                               \
+             "1:                        \n\t" /* round loop */              \
+             "movdqu    (%1), %%xmm4    \n\t"                               \
+             RND        xmm4_xmm0      "\n\t"                               \
+             RND        xmm4_xmm1      "\n\t"                               \
+             RND        xmm4_xmm2      "\n\t"                               \
+             RND        xmm4_xmm3      "\n\t"                               \
+             "add       $16, %1         \n\t"                               \
+             "subl      $1, %0          \n\t"                               \
+             "jnz       1b              \n\t"                               \
+             "movdqu    (%1), %%xmm4    \n\t" /* last round */              \
+             LAST       xmm4_xmm0      "\n\t"                               \
+             LAST       xmm4_xmm1      "\n\t"                               \
+             LAST       xmm4_xmm2      "\n\t"                               \
+             LAST       xmm4_xmm3      "\n\t"                               \
+             "pxor      %%xmm5, %%xmm0  \n\t"                               \
+             "pxor      %%xmm6, %%xmm1  \n\t"                               \
+             "pxor      %%xmm8, %%xmm2  \n\t"                               \
+             "pxor      %%xmm9, %%xmm3  \n\t"                               \
+             "movdqu    %%xmm0,   (%3)  \n\t" /* export output */           \
+             "movdqu    %%xmm1, 16(%3)  \n\t"                               \
+             "movdqu    %%xmm2, 32(%3)  \n\t"                               \
+             "movdqu    %%xmm3, 48(%3)  \n\t"                               \
+             XTS_DOUBLE( "xmm9", "xmm5" )                                   \
+             "movdqu    %%xmm5, (%4)    \n\t"
+
+/*
+ * XTS en(de)cryption of consecutive blocks, four at a time
+ */
+void mbedtls_aesni_xts_crypt( mbedtls_aes_context *ctx, int mode,
+                              size_t nblocks, unsigned char tweak[16],
+                              const unsigned char *input,
+                              unsigned char *output )
+{
+    /* Carry values of the doubling, as 32-bit lanes: 0x87 into the low
+     * half from bit 127, 1 into the high half from bit 63 */
+    static const uint32_t xts_carry[4] = { 0x87, 0, 1, 0 };
+
+    for( ; nblocks >= 4; nblocks -= 4, input += 64, output += 64 )
+    {
+        int rounds = ctx->nr - 1;
+        const uint32_t *rk = ctx->rk;
+
+        if( mode == MBEDTLS_AES_ENCRYPT )
+        {
+            asm volatile( XTS_CRYPT4( AESENC, AESENCLAST )
+                 : "+r" (rounds), "+r" (rk)
+                 : "r" (input), "r" (output), "r" (tweak), "r" (xts_carry)
+                 : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+                   "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "xmm10" );
+        }
+        else
+        {
+            asm volatile( XTS_CRYPT4( AESDEC, AESDECLAST )
+                 : "+r" (rounds), "+r" (rk)
+                 : "r" (input), "r" (output), "r" (tweak), "r" (xts_carry)
+                 : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4",
+                   "xmm5", "xmm6", "xmm7", "xmm8", "xmm9", "xmm10" );
+        }
+    }
+}
+
+#undef XTS_CRYPT4
+#undef XTS_DOUBLE
+
 /*
  * GCM multiplication: c = a times b in GF(2^128)
  * Based on [CLMUL-WP] algorithms 1 (with equation 27) and 5.
@@ -37,6 +37,13 @@
 
 #include <string.h>
 
+#if defined(MBEDTLS_AESNI_C) && !defined(MBEDTLS_ARIA_ALT)
+#include "mbedtls/aesni.h"
+#if defined(MBEDTLS_HAVE_X86_64)
+#define MBEDTLS_ARIA_AESNI
+#endif
+#endif
+
 #if defined(MBEDTLS_SELF_TEST)
 #if defined(MBEDTLS_PLATFORM_C)
 #include "mbedtls/platform.h"
@@ -583,6 +590,216 @@ int mbedtls_aria_crypt_ecb( mbedtls_aria_context *ctx,
     return( 0 );
 }
 
+#if defined(MBEDTLS_ARIA_AESNI)
+/*
+ * Byte-sliced ARIA using the AES S-box [AES-NI].
+ *
+ * Sixteen blocks are transposed so that vector j holds byte j of every
+ * block; the diffusion layer is then sixteen XORs of seven vectors each.
+ * SB1 is the AES S-box and IS1 its inverse, computed by AESENCLAST and
+ * AESDECLAST with an all-zero round key followed by a byte shuffle that
+ * undoes (Inv)ShiftRows. SB2 is SB1 followed by an affine map, and IS2 is
+ * IS1 preceded by the inverse map; each affine map is a pair of lookups on
+ * the low and high nibbles (PSHUFB).
+ */
+typedef unsigned char aria_u8x16 __attribute__((vector_size(16)));
+typedef char aria_i8x16 __attribute__((vector_size(16)));
+typedef long long aria_i64x2 __attribute__((vector_size(16)));
+
+#define ARIA_BS_TARGET __attribute__((target("aes,ssse3")))
+
+/* SB2( x ) = post( SB1( x ) ) */
+static const aria_u8x16 aria_bs_post_sb2[2] =
+{
+    { 0x88, 0x0d, 0x37, 0xb2, 0x00, 0x85, 0xbf, 0x3a,
+      0xa8, 0x2d, 0x17, 0x92, 0x20, 0xa5, 0x9f, 0x1a },
+    { 0x00, 0x3e, 0xd4, 0xea, 0x84, 0xba, 0x50, 0x6e,
+      0xcd, 0xf3, 0x19, 0x27, 0x49, 0x77, 0x9d, 0xa3 }
+};
+
+/* IS2( x ) = IS1( pre( x ) ), pre being the inverse of the map above */
+static const aria_u8x16 aria_bs_pre_is2[2] =
+{
+    { 0x04, 0x45, 0xee, 0xaf, 0x17, 0x56, 0xfd, 0xbc,
+      0x53, 0x12, 0xb9, 0xf8, 0x40, 0x01, 0xaa, 0xeb },
+    { 0x00, 0xb6, 0x08, 0xbe, 0xd6, 0x60, 0xde, 0x68,
+      0x53, 0xe5, 0x5b, 0xed, 0x85, 0x33, 0x8d, 0x3b }
+};
+
+static const aria_u8x16 aria_bs_shift_rows =
+    { 0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11 };
+
+static const aria_u8x16 aria_bs_inv_shift_rows =
+    { 0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3 };
+
+static inline __attribute__((always_inline)) ARIA_BS_TARGET
+aria_u8x16 aria_bs_pshufb( aria_u8x16 t, aria_u8x16 i )
+{
+    return( (aria_u8x16) __builtin_ia32_pshufb128( (aria_i8x16) t,
+                                                   (aria_i8x16) i ) );
+}
+
+static inline __attribute__((always_inline)) ARIA_BS_TARGET
+aria_u8x16 aria_bs_affine( aria_u8x16 x, const aria_u8x16 t[2] )
+{
+    const aria_u8x16 m = (aria_u8x16) { 0 } + 0x0f;
+
+    return( aria_bs_pshufb( t[0], x & m ) ^
+            aria_bs_pshufb( t[1], ( x >> 4 ) & m ) );
+}
+
+static inline __attribute__((always_inline)) ARIA_BS_TARGET
+aria_u8x16 aria_bs_sb1( aria_u8x16 x )
+{
+    const aria_i64x2 zero = { 0, 0 };
+
+    x = (aria_u8x16) __builtin_ia32_aesenclast128( (aria_i64x2) x, zero );
+    return( aria_bs_pshufb( x, aria_bs_inv_shift_rows ) );
+}
+
+static inline __attribute__((always_inline)) ARIA_BS_TARGET
+aria_u8x16 aria_bs_is1( aria_u8x16 x )
+{
+    const aria_i64x2 zero = { 0, 0 };
+
+    x = (aria_u8x16) __builtin_ia32_aesdeclast128( (aria_i64x2) x, zero );
+    return( aria_bs_pshufb( x, aria_bs_shift_rows ) );
+}
+
+/*
+ * 16x16 byte transpose: four rounds of interleaving vector k with vector
+ * k + 8, each of which rotates the (vector, byte) index bits by one.
+ */
+static inline __attribute__((always_inline)) ARIA_BS_TARGET
+void aria_bs_transpose( aria_u8x16 x[16] )
+{
+    aria_u8x16 t[16];
+    int r, k;
+
+    for( r = 0; r < 4; r++ )
+    {
+        for( k = 0; k < 8; k++ )
+        {
+            t[2 * k] = (aria_u8x16) __builtin_ia32_punpcklbw128(
+                    (aria_i8x16) x[k], (aria_i8x16) x[k + 8] );
+            t[2 * k + 1] = (aria_u8x16) __builtin_ia32_punpckhbw128(
+                    (aria_i8x16) x[k], (aria_i8x16) x[k + 8] );
+        }
+        for( k = 0; k < 16; k++ )
+            x[k] = t[k];
+    }
+}
+
+/* x ^= round key, byte j of the key in every lane of vector j */
+static inline __attribute__((always_inline)) ARIA_BS_TARGET
+void aria_bs_add_key( aria_u8x16 x[16], const uint32_t rk[4] )
+{
+    int j;
+
+    for( j = 0; j < 16; j++ )
+        x[j] ^= (aria_u8x16) { 0 } +
+                (unsigned char)( rk[j >> 2] >> ( 8 * ( j & 3 ) ) );
+}
+
+/* SL1 ( sb1, sb2, is1, is2 ) and SL2 ( is1, is2, sb1, sb2 ) */
+static inline __attribute__((always_inline)) ARIA_BS_TARGET
+void aria_bs_sl1( aria_u8x16 x[16] )
+{
+    int j;
+
+    for( j = 0; j < 16; j += 4 )
+    {
+        x[j] = aria_bs_sb1( x[j] );
+        x[j + 1] = aria_bs_affine( aria_bs_sb1( x[j + 1] ), aria_bs_post_sb2 );
+        x[j + 2] = aria_bs_is1( x[j + 2] );
+        x[j + 3] = aria_bs_is1( aria_bs_affine( x[j + 3], aria_bs_pre_is2 ) );
+    }
+}
+
+static inline __attribute__((always_inline)) ARIA_BS_TARGET
+void aria_bs_sl2( aria_u8x16 x[16] )
+{
+    int j;
+
+    for( j = 0; j < 16; j += 4 )
+    {
+        x[j] = aria_bs_is1( x[j] );
+        x[j + 1] = aria_bs_is1( aria_bs_affine( x[j + 1], aria_bs_pre_is2 ) );
+        x[j + 2] = aria_bs_sb1( x[j + 2] );
+        x[j + 3] = aria_bs_affine( aria_bs_sb1( x[j + 3] ), aria_bs_post_sb2 );
+    }
+}
+
+/* The diffusion layer of aria_a(), byte by byte */
+static inline __attribute__((always_inline)) ARIA_BS_TARGET
+void aria_bs_a( aria_u8x16 x[16] )
+{
+    aria_u8x16 y[16];
+    int j;
+
+    y[ 0] = x[ 3] ^ x[ 4] ^ x[ 6] ^ x[ 8] ^ x[ 9] ^ x[13] ^ x[14];
+    y[ 1] = x[ 2] ^ x[ 5] ^ x[ 7] ^ x[ 8] ^ x[ 9] ^ x[12] ^ x[15];
+    y[ 2] = x[ 1] ^ x[ 4] ^ x[ 6] ^ x[10] ^ x[11] ^ x[12] ^ x[15];
+    y[ 3] = x[ 0] ^ x[ 5] ^ x[ 7] ^ x[10] ^ x[11] ^ x[13] ^ x[14];
+    y[ 4] = x[ 0] ^ x[ 2] ^ x[ 5] ^ x[ 8] ^ x[11] ^ x[14] ^ x[15];
+    y[ 5] = x[ 1] ^ x[ 3] ^ x[ 4] ^ x[ 9] ^ x[10] ^ x[14] ^ x[15];
+    y[ 6] = x[ 0] ^ x[ 2] ^ x[ 7] ^ x[ 9] ^ x[10] ^ x[12] ^ x[13];
+    y[ 7] = x[ 1] ^ x[ 3] ^ x[ 6] ^ x[ 8] ^ x[11] ^ x[12] ^ x[13];
+    y[ 8] = x[ 0] ^ x[ 1] ^ x[ 4] ^ x[ 7] ^ x[10] ^ x[13] ^ x[15];
+    y[ 9] = x[ 0] ^ x[ 1] ^ x[ 5] ^ x[ 6] ^ x[11] ^ x[12] ^ x[14];
+    y[10] = x[ 2] ^ x[ 3] ^ x[ 5] ^ x[ 6] ^ x[ 8] ^ x[13] ^ x[15];
+    y[11] = x[ 2] ^ x[ 3] ^ x[ 4] ^ x[ 7] ^ x[ 9] ^ x[12] ^ x[14];
+    y[12] = x[ 1] ^ x[ 2] ^ x[ 6] ^ x[ 7] ^ x[ 9] ^ x[11] ^ x[12];
+    y[13] = x[ 0] ^ x[ 3] ^ x[ 6] ^ x[ 7] ^ x[ 8] ^ x[10] ^ x[13];
+    y[14] = x[ 0] ^ x[ 3] ^ x[ 4] ^ x[ 5] ^ x[ 9] ^ x[11] ^ x[14];
+    y[15] = x[ 1] ^ x[ 2] ^ x[ 4] ^ x[ 5] ^ x[ 8] ^ x[10] ^ x[15];
+
+    for( j = 0; j < 16; j++ )
+        x[j] = y[j];
+}
+
+static ARIA_BS_TARGET
+void aria_bs_crypt16( const mbedtls_aria_context *ctx,
+                      const unsigned char input[256],
+                      unsigned char output[256] )
+{
+    aria_u8x16 X[16];
+    int i;
+
+    memcpy( X, input, sizeof( X ) );
+    aria_bs_transpose( X );
+
+    i = 0;
+    while( 1 )
+    {
+        aria_bs_add_key( X, ctx->rk[i++] );
+        aria_bs_sl1( X );
+        aria_bs_a( X );
+
+        aria_bs_add_key( X, ctx->rk[i++] );
+        aria_bs_sl2( X );
+        if( i >= ctx->nr )
+            break;
+        aria_bs_a( X );
+    }
+
+    aria_bs_add_key( X, ctx->rk[i] );
+
+    aria_bs_transpose( X );
+    memcpy( output, X, sizeof( X ) );
+
+    mbedtls_platform_zeroize( X, sizeof( X ) );
+}
+
+#define ARIA_BS_BLOCKS  16
+
+static int aria_bs_active( void )
+{
+    return( mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) &&
+            mbedtls_aesni_has_support( MBEDTLS_AESNI_SSSE3 ) );
+}
+#endif /* MBEDTLS_ARIA_AESNI */
+
 /* Initialize context */
 void mbedtls_aria_init( mbedtls_aria_context *ctx )
 {
@@ -617,6 +834,36 @@ int mbedtls_aria_crypt_cbc( mbedtls_aria_context *ctx,
 
     if( mode == MBEDTLS_ARIA_DECRYPT )
     {
+#if defined(MBEDTLS_ARIA_AESNI)
+        /* Sixteen blocks at a time, reading them all before writing */
+        if( length >= ARIA_BS_BLOCKS * MBEDTLS_ARIA_BLOCKSIZE &&
+            aria_bs_active() )
+        {
+            unsigned char buf[ARIA_BS_BLOCKS * MBEDTLS_ARIA_BLOCKSIZE];
+
+            while( length >= sizeof( buf ) )
+            {
+                aria_bs_crypt16( ctx, input, buf );
+
+                for( i = 0; i < MBEDTLS_ARIA_BLOCKSIZE; i++ )
+                    buf[i] = (unsigned char)( buf[i] ^ iv[i] );
+                for( i = MBEDTLS_ARIA_BLOCKSIZE; i < (int) sizeof( buf ); i++ )
+                    buf[i] = (unsigned char)( buf[i] ^
+                                              input[i - MBEDTLS_ARIA_BLOCKSIZE] );
+
+                memcpy( iv, input + sizeof( buf ) - MBEDTLS_ARIA_BLOCKSIZE,
+                        MBEDTLS_ARIA_BLOCKSIZE );
+                memcpy( output, buf, sizeof( buf ) );
+
+                input  += sizeof( buf );
+                output += sizeof( buf );
+                length -= sizeof( buf );
+            }
+
+            mbedtls_platform_zeroize( buf, sizeof( buf ) );
+        }
+#endif /* MBEDTLS_ARIA_AESNI */
+
         while( length > 0 )
         {
             memcpy( temp, input, MBEDTLS_ARIA_BLOCKSIZE );
@@ -715,6 +962,43 @@ int mbedtls_aria_crypt_ctr( mbedtls_aria_context *ctx,
     int c, i;
     size_t n = *nc_off;
 
+#if defined(MBEDTLS_ARIA_AESNI)
+    /* Whole keystream blocks, sixteen counters at a time */
+    if( n == 0 && length >= ARIA_BS_BLOCKS * MBEDTLS_ARIA_BLOCKSIZE &&
+        aria_bs_active() )
+    {
+        unsigned char buf[ARIA_BS_BLOCKS * MBEDTLS_ARIA_BLOCKSIZE];
+        size_t j;
+
+        while( length >= sizeof( buf ) )
+        {
+            for( j = 0; j < ARIA_BS_BLOCKS; j++ )
+            {
+                memcpy( buf + MBEDTLS_ARIA_BLOCKSIZE * j, nonce_counter,
+                        MBEDTLS_ARIA_BLOCKSIZE );
+
+                for( i = MBEDTLS_ARIA_BLOCKSIZE; i > 0; i-- )
+                    if( ++nonce_counter[i - 1] != 0 )
+                        break;
+            }
+
+            aria_bs_crypt16( ctx, buf, buf );
+
+            for( j = 0; j < sizeof( buf ); j++ )
+                output[j] = (unsigned char)( input[j] ^ buf[j] );
+
+            length -= sizeof( buf );
+            input  += sizeof( buf );
+            output += sizeof( buf );
+        }
+
+        memcpy( stream_block, buf + sizeof( buf ) - MBEDTLS_ARIA_BLOCKSIZE,
+                MBEDTLS_ARIA_BLOCKSIZE );
+
+        mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    }
+#endif /* MBEDTLS_ARIA_AESNI */
+
     while( length-- )
     {
         if( n == 0 ) {
@@ -738,6 +1022,40 @@ int mbedtls_aria_crypt_ctr( mbedtls_aria_context *ctx,
 #endif /* MBEDTLS_CIPHER_MODE_CTR */
 #endif /* !MBEDTLS_ARIA_ALT */
 
+int mbedtls_aria_crypt_blocks( mbedtls_aria_context *ctx,
+                               size_t nblocks,
+                               const unsigned char *input,
+                               unsigned char *output )
+{
+    int ret;
+
+#if defined(MBEDTLS_ARIA_AESNI)
+    if( nblocks >= ARIA_BS_BLOCKS && aria_bs_active() )
+    {
+        do
+        {
+            aria_bs_crypt16( ctx, input, output );
+            input  += ARIA_BS_BLOCKS * MBEDTLS_ARIA_BLOCKSIZE;
+            output += ARIA_BS_BLOCKS * MBEDTLS_ARIA_BLOCKSIZE;
+            nblocks -= ARIA_BS_BLOCKS;
+        }
+        while( nblocks >= ARIA_BS_BLOCKS );
+    }
+#endif /* MBEDTLS_ARIA_AESNI */
+
+    while( nblocks-- > 0 )
+    {
+        ret = mbedtls_aria_crypt_ecb( ctx, input, output );
+        if( ret != 0 )
+            return( ret );
+
+        input  += MBEDTLS_ARIA_BLOCKSIZE;
+        output += MBEDTLS_ARIA_BLOCKSIZE;
+    }
+
+    return( 0 );
+}
+
 #if defined(MBEDTLS_SELF_TEST)
 
 /*
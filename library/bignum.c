@@ -47,6 +47,10 @@
 #include "mbedtls/bn_mul.h"
 #include "mbedtls/platform_util.h"
 
+#if defined(MBEDTLS_ADX_C)
+#include "mbedtls/adx.h"
+#endif
+
 #include <string.h>
 
 #if defined(MBEDTLS_PLATFORM_C)
@@ -65,6 +69,11 @@
 
 #define MPI_SIZE_T_MAX  ( (size_t) -1 ) /* SIZE_T_MAX is not standard */
 
+#if defined(MBEDTLS_ADX_C) && defined(MBEDTLS_HAVE_X86_64) && \
+    defined(MBEDTLS_HAVE_INT64)
+#define MPI_HAVE_ADX
+#endif
+
 /*
  * Convert between bits/chars and number of limbs
  * Divide first in order to avoid potential overflows
@@ -72,6 +81,11 @@
 #define BITS_TO_LIMBS(i)  ( (i) / biL + ( (i) % biL != 0 ) )
 #define CHARS_TO_LIMBS(i) ( (i) / ciL + ( (i) % ciL != 0 ) )
 
+#if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
+    !defined(inline) && !defined(__cplusplus)
+#define inline __inline
+#endif
+
 /* Implementation that should never be optimized out by the compiler */
 static void mbedtls_mpi_zeroize( mbedtls_mpi_uint *v, size_t n )
 {
@@ -176,6 +190,76 @@ int mbedtls_mpi_shrink( mbedtls_mpi *X, size_t nblimbs )
     return( 0 );
 }
 
+/*
+ * Initialize an MPI arena
+ */
+void mbedtls_mpi_arena_init( mbedtls_mpi_arena *arena )
+{
+    size_t i;
+
+    if( arena == NULL )
+        return;
+
+    for( i = 0; i < MBEDTLS_MPI_ARENA_SIZE; i++ )
+        mbedtls_mpi_init( &arena->T[i] );
+
+    arena->used = 0;
+}
+
+/*
+ * Wipe and free all temporaries of an MPI arena
+ */
+void mbedtls_mpi_arena_free( mbedtls_mpi_arena *arena )
+{
+    size_t i;
+
+    if( arena == NULL )
+        return;
+
+    for( i = 0; i < MBEDTLS_MPI_ARENA_SIZE; i++ )
+        mbedtls_mpi_free( &arena->T[i] );
+
+    arena->used = 0;
+}
+
+/*
+ * Take a temporary from an MPI arena, keeping the limbs of its previous use
+ */
+int mbedtls_mpi_arena_get( mbedtls_mpi_arena *arena, mbedtls_mpi **X )
+{
+    mbedtls_mpi *T;
+
+    if( arena->used == MBEDTLS_MPI_ARENA_SIZE )
+        return( MBEDTLS_ERR_MPI_ALLOC_FAILED );
+
+    T = &arena->T[arena->used++];
+
+    if( T->p != NULL )
+        memset( T->p, 0, T->n * ciL );
+    T->s = 1;
+
+    *X = T;
+
+    return( 0 );
+}
+
+/*
+ * Mark the current position of an MPI arena
+ */
+size_t mbedtls_mpi_arena_mark( const mbedtls_mpi_arena *arena )
+{
+    return( arena->used );
+}
+
+/*
+ * Release the temporaries taken since a mark
+ */
+void mbedtls_mpi_arena_release( mbedtls_mpi_arena *arena, size_t mark )
+{
+    if( mark < arena->used )
+        arena->used = mark;
+}
+
 /*
  * Copy the contents of Y into X
  */
@@ -970,24 +1054,45 @@ static void mpi_sub_hlp( size_t n, mbedtls_mpi_uint *s, mbedtls_mpi_uint *d )
     }
 }
 
+/*
+ * Helper for mbedtls_mpi subtraction in place of the subtrahend:
+ * d = s - d, for s >= d
+ */
+static void mpi_sub_hlp_rev( size_t n, const mbedtls_mpi_uint *s, mbedtls_mpi_uint *d )
+{
+    size_t i;
+    mbedtls_mpi_uint c, z, t;
+
+    for( i = c = 0; i < n; i++, s++, d++ )
+    {
+        t = *s - c;          z = ( *s < c );
+        c = ( t < *d ) + z;  *d = t - *d;
+    }
+}
+
 /*
  * Unsigned subtraction: X = |A| - |B|  (HAC 14.9)
  */
 int mbedtls_mpi_sub_abs( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *B )
 {
-    mbedtls_mpi TB;
     int ret;
     size_t n;
 
     if( mbedtls_mpi_cmp_abs( A, B ) < 0 )
         return( MBEDTLS_ERR_MPI_NEGATIVE_VALUE );
 
-    mbedtls_mpi_init( &TB );
-
     if( X == B )
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TB, B ) );
-        B = &TB;
+        /*
+         * Subtract in place rather than from a copy of B: as |B| <= |A|,
+         * the limbs of B above A->n are zero and there is no final borrow.
+         */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, A->n ) );
+        X->s = 1;
+
+        mpi_sub_hlp_rev( A->n, A->p, X->p );
+
+        return( 0 );
     }
 
     if( X != A )
@@ -1008,8 +1113,6 @@ int mbedtls_mpi_sub_abs( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
 
 cleanup:
 
-    mbedtls_mpi_free( &TB );
-
     return( ret );
 }
 
@@ -1180,19 +1283,310 @@ void mpi_mul_hlp( size_t i, mbedtls_mpi_uint *s, mbedtls_mpi_uint *d, mbedtls_mp
 }
 
 /*
- * Baseline multiplication: X = A * B  (HAC 14.12)
+ * Helper for mbedtls_mpi addition: d += s, propagating the carry beyond
+ * the n limbs of s
+ */
+static void mpi_add_hlp( size_t n, const mbedtls_mpi_uint *s, mbedtls_mpi_uint *d )
+{
+    size_t i;
+    mbedtls_mpi_uint c, t;
+
+    for( i = c = 0; i < n; i++, s++, d++ )
+    {
+        t = *d + c;   c  = ( t < c );
+        *d = t + *s;  c += ( *d < t );
+    }
+
+    while( c != 0 )
+    {
+        *d += c; c = ( *d < c ); d++;
+    }
+}
+
+/*
+ * Helper for mbedtls_mpi squaring: d = s^2, where the 2n limbs of d are
+ * zero on entry. Each cross product s[i] * s[j], i < j, is computed once
+ * and the sum of them doubled before the squares s[i]^2 are added.
+ */
+static void mpi_sqr_hlp( size_t n, mbedtls_mpi_uint *s, mbedtls_mpi_uint *d )
+{
+    size_t i;
+    mbedtls_mpi_uint c, t;
+
+    for( i = 0; i + 1 < n; i++ )
+        mpi_mul_hlp( n - i - 1, s + i + 1, d + 2 * i + 1, s[i] );
+
+    for( i = c = 0; i < 2 * n; i++ )
+    {
+        t = d[i] >> ( biL - 1 );
+        d[i] = ( d[i] << 1 ) | c;
+        c = t;
+    }
+
+#if defined(MBEDTLS_HAVE_UDBL)
+    for( i = c = 0; i < n; i++ )
+    {
+        mbedtls_t_udbl r = (mbedtls_t_udbl) s[i] * s[i] + d[2 * i] + c;
+
+        d[2 * i] = (mbedtls_mpi_uint) r;
+        r = ( r >> biL ) + d[2 * i + 1];
+        d[2 * i + 1] = (mbedtls_mpi_uint) r;
+        c = (mbedtls_mpi_uint) ( r >> biL );
+    }
+#else
+    for( i = 0; i < n; i++ )
+        mpi_mul_hlp( 1, s + i, d + 2 * i, s[i] );
+#endif /* MBEDTLS_HAVE_UDBL */
+}
+
+#if defined(MBEDTLS_HAVE_UDBL)
+/*
+ * Comba multiplication and squaring of n-limb operands: the product is
+ * computed one column at a time in a three-limb accumulator (acc, c2), so
+ * that each limb of d is written once and no carry is propagated through
+ * d. Multiplication is only faster than mpi_mul_hlp() for the field sizes
+ * of the smaller elliptic curves, where it is called with a constant n.
+ * Squaring, which computes each cross product once, is faster up to
+ * MPI_COMBA_SQR_LIMBS limbs.
+ */
+#define MPI_COMBA_SQR_LIMBS     BITS_TO_LIMBS( 1024 )
+
+#define COMBA_MULADD( x, y )                                \
+    do {                                                    \
+        p = (mbedtls_t_udbl) ( x ) * ( y );                 \
+        acc += p; c2 += ( acc < p );                        \
+    } while( 0 )
+
+#define COMBA_STORE( k )                                    \
+    do {                                                    \
+        d[k] = (mbedtls_mpi_uint) acc;                      \
+        acc = ( acc >> biL ) | ( (mbedtls_t_udbl) c2 << biL ); \
+        c2 = 0;                                             \
+    } while( 0 )
+
+static inline void mpi_mul_comba( size_t n, const mbedtls_mpi_uint *a,
+                                  const mbedtls_mpi_uint *b,
+                                  mbedtls_mpi_uint *d )
+{
+    size_t i, k;
+    mbedtls_t_udbl acc = 0, p;
+    mbedtls_mpi_uint c2 = 0;
+
+    for( k = 0; k + 1 < 2 * n; k++ )
+    {
+        for( i = ( k < n ) ? 0 : k - n + 1; i <= k && i < n; i++ )
+            COMBA_MULADD( a[i], b[k - i] );
+
+        COMBA_STORE( k );
+    }
+
+    d[2 * n - 1] = (mbedtls_mpi_uint) acc;
+}
+
+static inline void mpi_sqr_comba( size_t n, const mbedtls_mpi_uint *a,
+                                  mbedtls_mpi_uint *d )
+{
+    size_t i, k;
+    mbedtls_t_udbl acc = 0, p;
+    mbedtls_mpi_uint c2 = 0;
+
+    for( k = 0; k + 1 < 2 * n; k++ )
+    {
+        for( i = ( k < n ) ? 0 : k - n + 1; i < k - i; i++ )
+        {
+            COMBA_MULADD( a[i], a[k - i] );
+            COMBA_MULADD( a[i], a[k - i] );
+        }
+
+        if( ( k & 1 ) == 0 )
+            COMBA_MULADD( a[k / 2], a[k / 2] );
+
+        COMBA_STORE( k );
+    }
+
+    d[2 * n - 1] = (mbedtls_mpi_uint) acc;
+}
+#endif /* MBEDTLS_HAVE_UDBL */
+
+/*
+ * Number of limbs of scratch space needed by mpi_mul_core() and
+ * mpi_sqr_core() for n-limb operands
+ */
+static size_t mpi_mul_scratch( size_t n )
+{
+    size_t s = 0;
+
+    while( n >= MBEDTLS_MPI_KARATSUBA_THRESHOLD )
+    {
+        n = n - n / 2 + 1;
+        s += 4 * n;
+    }
+
+    return( s );
+}
+
+/*
+ * Multiplication of n-limb operands: d = a * b, where d holds 2n limbs.
+ * Karatsuba above MBEDTLS_MPI_KARATSUBA_THRESHOLD limbs, with a = a1 * B^l
+ * + a0 and b = b1 * B^l + b0:
+ *
+ *   a * b = z2 * B^2l + ( m - z2 - z0 ) * B^l + z0
+ *
+ * with z0 = a0 * b0, z2 = a1 * b1 and m = ( a0 + a1 ) * ( b0 + b1 ). The
+ * sums are used rather than the differences of the halves so that the
+ * sequence of operations does not depend on their values.
+ * s is scratch space of mpi_mul_scratch( n ) limbs.
+ */
+static void mpi_mul_core( size_t n, mbedtls_mpi_uint *a, mbedtls_mpi_uint *b,
+                          mbedtls_mpi_uint *d, mbedtls_mpi_uint *s )
+{
+    size_t h, l;
+    mbedtls_mpi_uint *sa, *sb, *m;
+
+    if( n < MBEDTLS_MPI_KARATSUBA_THRESHOLD )
+    {
+#if defined(MBEDTLS_HAVE_UDBL)
+        if( n == BITS_TO_LIMBS( 256 ) )
+        {
+            mpi_mul_comba( BITS_TO_LIMBS( 256 ), a, b, d );
+            return;
+        }
+        if( n == BITS_TO_LIMBS( 384 ) )
+        {
+            mpi_mul_comba( BITS_TO_LIMBS( 384 ), a, b, d );
+            return;
+        }
+#endif /* MBEDTLS_HAVE_UDBL */
+
+        memset( d, 0, 2 * n * ciL );
+
+        for( l = n; l > 0; l-- )
+            mpi_mul_hlp( n, a, d + l - 1, b[l - 1] );
+
+        return;
+    }
+
+    h = n / 2;
+    l = n - h;
+    sa = s;
+    sb = sa + l + 1;
+    m  = sb + l + 1;
+
+    mpi_mul_core( l, a, b, d, s );
+    mpi_mul_core( h, a + l, b + l, d + 2 * l, s );
+
+    memcpy( sa, a, l * ciL ); sa[l] = 0;
+    memcpy( sb, b, l * ciL ); sb[l] = 0;
+    mpi_add_hlp( h, a + l, sa );
+    mpi_add_hlp( h, b + l, sb );
+
+    mpi_mul_core( l + 1, sa, sb, m, m + 2 * ( l + 1 ) );
+
+    mpi_sub_hlp( 2 * l, d, m );
+    mpi_sub_hlp( 2 * h, d + 2 * l, m );
+    mpi_add_hlp( n + 1, m, d + l );
+}
+
+/*
+ * Squaring of an n-limb operand: d = a^2, where d holds 2n limbs.
+ * Same structure as mpi_mul_core(), but as the schoolbook squaring needs
+ * about half as many limb products as the multiplication, Karatsuba only
+ * pays off from twice MBEDTLS_MPI_KARATSUBA_THRESHOLD limbs.
+ */
+static void mpi_sqr_core( size_t n, mbedtls_mpi_uint *a, mbedtls_mpi_uint *d,
+                          mbedtls_mpi_uint *s )
+{
+    size_t h, l;
+    mbedtls_mpi_uint *sa, *m;
+
+    if( n < 2 * MBEDTLS_MPI_KARATSUBA_THRESHOLD )
+    {
+#if defined(MBEDTLS_HAVE_UDBL)
+        if( n <= MPI_COMBA_SQR_LIMBS )
+        {
+            mpi_sqr_comba( n, a, d );
+            return;
+        }
+#endif /* MBEDTLS_HAVE_UDBL */
+
+        memset( d, 0, 2 * n * ciL );
+        mpi_sqr_hlp( n, a, d );
+
+        return;
+    }
+
+    h = n / 2;
+    l = n - h;
+    sa = s;
+    m  = sa + 2 * ( l + 1 );
+
+    mpi_sqr_core( l, a, d, s );
+    mpi_sqr_core( h, a + l, d + 2 * l, s );
+
+    memcpy( sa, a, l * ciL ); sa[l] = 0;
+    mpi_add_hlp( h, a + l, sa );
+
+    mpi_sqr_core( l + 1, sa, m, m + 2 * ( l + 1 ) );
+
+    mpi_sub_hlp( 2 * l, d, m );
+    mpi_sub_hlp( 2 * h, d + 2 * l, m );
+    mpi_add_hlp( n + 1, m, d + l );
+}
+
+/*
+ * Aliased operands of a multiplication of at most this many limbs are copied
+ * to the stack rather than to the heap (this covers the field elements of
+ * all supported elliptic curves)
+ */
+#define MPI_ALIAS_LIMBS     BITS_TO_LIMBS( 1024 )
+
+/*
+ * Copy the n lowest limbs of an operand aliased with the destination, to
+ * buf if they fit and to the heap otherwise. T must be released with
+ * mpi_alias_free().
+ */
+static int mpi_alias_copy( mbedtls_mpi *T, mbedtls_mpi_uint *buf,
+                           const mbedtls_mpi *A, size_t n )
+{
+    if( n > MPI_ALIAS_LIMBS )
+        return( mbedtls_mpi_copy( T, A ) );
+
+    if( n > 0 )
+        memcpy( buf, A->p, n * ciL );
+    T->s = A->s;
+    T->n = n;
+    T->p = buf;
+
+    return( 0 );
+}
+
+static void mpi_alias_free( mbedtls_mpi *T, mbedtls_mpi_uint *buf )
+{
+    if( T->p == buf )
+    {
+        mbedtls_mpi_zeroize( buf, T->n );
+        mbedtls_mpi_init( T );
+    }
+    else
+        mbedtls_mpi_free( T );
+}
+
+/*
+ * Baseline multiplication: X = A * B  (HAC 14.12), with a dedicated
+ * squaring when A and B are the same MPI and Comba or Karatsuba
+ * multiplication when they have the same number of limbs
  */
 int mbedtls_mpi_mul_mpi( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *B )
 {
     int ret;
-    size_t i, j;
+    size_t i, j, k;
+    int sqr = ( A == B );
     mbedtls_mpi TA, TB;
+    mbedtls_mpi_uint ta[MPI_ALIAS_LIMBS], tb[MPI_ALIAS_LIMBS];
+    mbedtls_mpi_uint *S = NULL;
 
     mbedtls_mpi_init( &TA ); mbedtls_mpi_init( &TB );
 
-    if( X == A ) { MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TA, A ) ); A = &TA; }
-    if( X == B ) { MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TB, B ) ); B = &TB; }
-
     for( i = A->n; i > 0; i-- )
         if( A->p[i - 1] != 0 )
             break;
@@ -1201,17 +1595,45 @@ int mbedtls_mpi_mul_mpi( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
         if( B->p[j - 1] != 0 )
             break;
 
+    if( X == A ) { MBEDTLS_MPI_CHK( mpi_alias_copy( &TA, ta, A, i ) ); A = &TA; }
+    if( X == B && !sqr ) { MBEDTLS_MPI_CHK( mpi_alias_copy( &TB, tb, B, j ) ); B = &TB; }
+    if( sqr ) B = A;
+
     MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, i + j ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
 
-    for( ; j > 0; j-- )
-        mpi_mul_hlp( i, A->p, X->p + j - 1, B->p[j - 1] );
+    if( i == j && i > 0 )
+    {
+        k = mpi_mul_scratch( i );
+
+        if( k > 0 && ( S = (mbedtls_mpi_uint *) mbedtls_calloc( k, ciL ) ) == NULL )
+        {
+            ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+            goto cleanup;
+        }
+
+        if( sqr )
+            mpi_sqr_core( i, A->p, X->p, S );
+        else
+            mpi_mul_core( i, A->p, B->p, X->p, S );
+
+        if( k > 0 )
+        {
+            mbedtls_mpi_zeroize( S, k );
+            mbedtls_free( S );
+        }
+    }
+    else
+    {
+        for( ; j > 0; j-- )
+            mpi_mul_hlp( i, A->p, X->p + j - 1, B->p[j - 1] );
+    }
 
     X->s = A->s * B->s;
 
 cleanup:
 
-    mbedtls_mpi_free( &TB ); mbedtls_mpi_free( &TA );
+    mpi_alias_free( &TB, tb ); mpi_alias_free( &TA, ta );
 
     return( ret );
 }
@@ -1331,18 +1753,17 @@ static mbedtls_mpi_uint mbedtls_int_div_int( mbedtls_mpi_uint u1,
 /*
  * Division by mbedtls_mpi: A = Q * B + R  (HAC 14.20)
  */
-int mbedtls_mpi_div_mpi( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A, const mbedtls_mpi *B )
+static int mpi_div_mpi( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A,
+                        const mbedtls_mpi *B, mbedtls_mpi *X, mbedtls_mpi *Y,
+                        mbedtls_mpi *Z, mbedtls_mpi *T1, mbedtls_mpi *T2 )
 {
     int ret;
     size_t i, n, t, k;
-    mbedtls_mpi X, Y, Z, T1, T2;
+    mbedtls_mpi_uint y[2];
 
     if( mbedtls_mpi_cmp_int( B, 0 ) == 0 )
         return( MBEDTLS_ERR_MPI_DIVISION_BY_ZERO );
 
-    mbedtls_mpi_init( &X ); mbedtls_mpi_init( &Y ); mbedtls_mpi_init( &Z );
-    mbedtls_mpi_init( &T1 ); mbedtls_mpi_init( &T2 );
-
     if( mbedtls_mpi_cmp_abs( A, B ) < 0 )
     {
         if( Q != NULL ) MBEDTLS_MPI_CHK( mbedtls_mpi_lset( Q, 0 ) );
@@ -1350,86 +1771,97 @@ int mbedtls_mpi_div_mpi( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A, c
         return( 0 );
     }
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &X, A ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Y, B ) );
-    X.s = Y.s = 1;
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, A ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( Y, B ) );
+    X->s = Y->s = 1;
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &Z, A->n + 2 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &Z,  0 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T1, 2 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T2, 3 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( Z, A->n + 2 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( Z,  0 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( T1, 3 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( T2, 3 ) );
 
-    k = mbedtls_mpi_bitlen( &Y ) % biL;
+    k = mbedtls_mpi_bitlen( Y ) % biL;
     if( k < biL - 1 )
     {
         k = biL - 1 - k;
-        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &X, k ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &Y, k ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( X, k ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( Y, k ) );
     }
     else k = 0;
 
-    n = X.n - 1;
-    t = Y.n - 1;
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &Y, biL * ( n - t ) ) );
+    /*
+     * X and Y may have more limbs than their values need when the caller
+     * reuses temporaries: work with the most significant non-zero limbs.
+     */
+    for( n = X->n - 1; n > 0; n-- )
+        if( X->p[n] != 0 )
+            break;
+
+    for( t = Y->n - 1; t > 0; t-- )
+        if( Y->p[t] != 0 )
+            break;
 
-    while( mbedtls_mpi_cmp_mpi( &X, &Y ) >= 0 )
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( Y, biL * ( n - t ) ) );
+
+    while( mbedtls_mpi_cmp_mpi( X, Y ) >= 0 )
     {
-        Z.p[n - t]++;
-        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &X, &X, &Y ) );
+        Z->p[n - t]++;
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( X, X, Y ) );
     }
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &Y, biL * ( n - t ) ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( Y, biL * ( n - t ) ) );
 
     for( i = n; i > t ; i-- )
     {
-        if( X.p[i] >= Y.p[t] )
-            Z.p[i - t - 1] = ~0;
+        if( X->p[i] >= Y->p[t] )
+            Z->p[i - t - 1] = ~0;
         else
         {
-            Z.p[i - t - 1] = mbedtls_int_div_int( X.p[i], X.p[i - 1],
-                                                            Y.p[t], NULL);
+            Z->p[i - t - 1] = mbedtls_int_div_int( X->p[i], X->p[i - 1],
+                                                            Y->p[t], NULL);
         }
 
-        Z.p[i - t - 1]++;
+        y[0] = ( t < 1 ) ? 0 : Y->p[t - 1];
+        y[1] = Y->p[t];
+
+        Z->p[i - t - 1]++;
         do
         {
-            Z.p[i - t - 1]--;
+            Z->p[i - t - 1]--;
 
-            MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &T1, 0 ) );
-            T1.p[0] = ( t < 1 ) ? 0 : Y.p[t - 1];
-            T1.p[1] = Y.p[t];
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &T1, &T1, Z.p[i - t - 1] ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_lset( T1, 0 ) );
+            mpi_mul_hlp( 2, y, T1->p, Z->p[i - t - 1] );
 
-            MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &T2, 0 ) );
-            T2.p[0] = ( i < 2 ) ? 0 : X.p[i - 2];
-            T2.p[1] = ( i < 1 ) ? 0 : X.p[i - 1];
-            T2.p[2] = X.p[i];
+            MBEDTLS_MPI_CHK( mbedtls_mpi_lset( T2, 0 ) );
+            T2->p[0] = ( i < 2 ) ? 0 : X->p[i - 2];
+            T2->p[1] = ( i < 1 ) ? 0 : X->p[i - 1];
+            T2->p[2] = X->p[i];
         }
-        while( mbedtls_mpi_cmp_mpi( &T1, &T2 ) > 0 );
+        while( mbedtls_mpi_cmp_mpi( T1, T2 ) > 0 );
 
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &T1, &Y, Z.p[i - t - 1] ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &T1,  biL * ( i - t - 1 ) ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &X, &X, &T1 ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( T1, Y, Z->p[i - t - 1] ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( T1,  biL * ( i - t - 1 ) ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( X, X, T1 ) );
 
-        if( mbedtls_mpi_cmp_int( &X, 0 ) < 0 )
+        if( mbedtls_mpi_cmp_int( X, 0 ) < 0 )
         {
-            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &T1, &Y ) );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &T1, biL * ( i - t - 1 ) ) );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &X, &X, &T1 ) );
-            Z.p[i - t - 1]--;
+            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( T1, Y ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( T1, biL * ( i - t - 1 ) ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( X, X, T1 ) );
+            Z->p[i - t - 1]--;
         }
     }
 
     if( Q != NULL )
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( Q, &Z ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( Q, Z ) );
         Q->s = A->s * B->s;
     }
 
     if( R != NULL )
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &X, k ) );
-        X.s = A->s;
-        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( R, &X ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( X, k ) );
+        X->s = A->s;
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( R, X ) );
 
         if( mbedtls_mpi_cmp_int( R, 0 ) == 0 )
             R->s = 1;
@@ -1437,6 +1869,19 @@ int mbedtls_mpi_div_mpi( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A, c
 
 cleanup:
 
+    return( ret );
+}
+
+int mbedtls_mpi_div_mpi( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A, const mbedtls_mpi *B )
+{
+    int ret;
+    mbedtls_mpi X, Y, Z, T1, T2;
+
+    mbedtls_mpi_init( &X ); mbedtls_mpi_init( &Y ); mbedtls_mpi_init( &Z );
+    mbedtls_mpi_init( &T1 ); mbedtls_mpi_init( &T2 );
+
+    ret = mpi_div_mpi( Q, R, A, B, &X, &Y, &Z, &T1, &T2 );
+
     mbedtls_mpi_free( &X ); mbedtls_mpi_free( &Y ); mbedtls_mpi_free( &Z );
     mbedtls_mpi_free( &T1 ); mbedtls_mpi_free( &T2 );
 
@@ -1482,6 +1927,40 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Modulo: R = A mod B, with temporaries from an arena
+ */
+int mbedtls_mpi_mod_mpi_arena( mbedtls_mpi *R, const mbedtls_mpi *A,
+                               const mbedtls_mpi *B, mbedtls_mpi_arena *arena )
+{
+    int ret;
+    size_t mark = mbedtls_mpi_arena_mark( arena );
+    mbedtls_mpi *X, *Y, *Z, *T1, *T2;
+
+    if( mbedtls_mpi_cmp_int( B, 0 ) < 0 )
+        return( MBEDTLS_ERR_MPI_NEGATIVE_VALUE );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( arena, &X ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( arena, &Y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( arena, &Z ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( arena, &T1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( arena, &T2 ) );
+
+    MBEDTLS_MPI_CHK( mpi_div_mpi( NULL, R, A, B, X, Y, Z, T1, T2 ) );
+
+    while( mbedtls_mpi_cmp_int( R, 0 ) < 0 )
+      MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( R, R, B ) );
+
+    while( mbedtls_mpi_cmp_mpi( R, B ) >= 0 )
+      MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( R, R, B ) );
+
+cleanup:
+
+    mbedtls_mpi_arena_release( arena, mark );
+
+    return( ret );
+}
+
 /*
  * Modulo: r = A mod b
  */
@@ -1557,38 +2036,68 @@ static void mpi_montg_init( mbedtls_mpi_uint *mm, const mbedtls_mpi *N )
 }
 
 /*
- * Montgomery multiplication: A = A * B * R^-1 mod N  (HAC 14.36)
+ * Size in limbs of the temporary of mpi_montmul() for an n-limb modulus
+ */
+#define MPI_MONTMUL_LIMBS( n )  ( 2 * ( n ) + 2 + mpi_mul_scratch( n ) )
+
+/*
+ * Montgomery multiplication: A = A * B * R^-1 mod N  (HAC 14.32, 14.36)
+ *
+ * The product A * B is computed first, with mpi_sqr_core() when A and B
+ * are the same MPI, and is then reduced (separated operand scanning), so
+ * that squarings cost about half as many limb products as multiplications.
+ * On x86-64 CPUs with BMI2 and ADX, both steps use the MULX/ADCX/ADOX
+ * kernels of adx.c instead when B has as many limbs as N.
+ * T must have MPI_MONTMUL_LIMBS( N->n ) limbs.
  */
 static int mpi_montmul( mbedtls_mpi *A, const mbedtls_mpi *B, const mbedtls_mpi *N, mbedtls_mpi_uint mm,
                          const mbedtls_mpi *T )
 {
     size_t i, n, m;
-    mbedtls_mpi_uint u0, u1, *d;
+    mbedtls_mpi_uint *d;
 
-    if( T->n < N->n + 1 || T->p == NULL )
+    if( T->n < MPI_MONTMUL_LIMBS( N->n ) || T->p == NULL )
         return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
 
-    memset( T->p, 0, T->n * ciL );
-
     d = T->p;
     n = N->n;
     m = ( B->n < n ) ? B->n : n;
 
-    for( i = 0; i < n; i++ )
+#if defined(MPI_HAVE_ADX)
+    if( m == n &&
+        mbedtls_adx_has_support( MBEDTLS_ADX_BMI2 | MBEDTLS_ADX_ADX ) )
     {
-        /*
-         * T = (T + u0*B + u1*N) / 2^biL
-         */
-        u0 = A->p[i];
-        u1 = ( d[0] + u0 * B->p[0] ) * mm;
+        if( A == B )
+            mbedtls_adx_montsqr( n, A->p, N->p, mm, d );
+        else
+            mbedtls_adx_montmul( n, A->p, B->p, N->p, mm, d );
+    }
+    else
+#endif
+    {
+        if( A == B )
+            mpi_sqr_core( n, A->p, d, d + 2 * n + 2 );
+        else if( m == n )
+            mpi_mul_core( n, A->p, B->p, d, d + 2 * n + 2 );
+        else
+        {
+            memset( d, 0, 2 * n * ciL );
+
+            for( i = 0; i < m; i++ )
+                mpi_mul_hlp( n, A->p, d + i, B->p[i] );
+        }
 
-        mpi_mul_hlp( m, B->p, d, u0 );
-        mpi_mul_hlp( n, N->p, d, u1 );
+        d[2 * n] = d[2 * n + 1] = 0;
 
-        *d++ = u0; d[n + 1] = 0;
+        /*
+         * T = (T + u*N) / 2^(n * biL), with u = -T / N mod 2^(n * biL)
+         * computed one limb at a time
+         */
+        for( i = 0; i < n; i++ )
+            mpi_mul_hlp( n, N->p, d + i, d[i] * mm );
     }
 
-    memcpy( A->p, d, ( n + 1 ) * ciL );
+    memcpy( A->p, d + n, ( n + 1 ) * ciL );
 
     if( mbedtls_mpi_cmp_abs( A, N ) >= 0 )
         mpi_sub_hlp( n, N->p, A->p );
@@ -1617,13 +2126,34 @@ static int mpi_montred( mbedtls_mpi *A, const mbedtls_mpi *N, mbedtls_mpi_uint m
  * Sliding-window exponentiation: X = A^E mod N  (HAC 14.85)
  */
 int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *E, const mbedtls_mpi *N, mbedtls_mpi *_RR )
+{
+    int ret;
+    mbedtls_mpi_arena arena;
+
+    mbedtls_mpi_arena_init( &arena );
+
+    ret = mbedtls_mpi_exp_mod_arena( X, A, E, N, _RR, &arena );
+
+    mbedtls_mpi_arena_free( &arena );
+
+    return( ret );
+}
+
+/*
+ * Sliding-window exponentiation with the window table and the other
+ * temporaries taken from an arena
+ */
+int mbedtls_mpi_exp_mod_arena( mbedtls_mpi *X, const mbedtls_mpi *A,
+                               const mbedtls_mpi *E, const mbedtls_mpi *N,
+                               mbedtls_mpi *_RR, mbedtls_mpi_arena *arena )
 {
     int ret;
     size_t wbits, wsize, one = 1;
     size_t i, j, nblimbs;
     size_t bufsize, nbits;
+    size_t mark = mbedtls_mpi_arena_mark( arena );
     mbedtls_mpi_uint ei, mm, state;
-    mbedtls_mpi RR, T, W[ 2 << MBEDTLS_MPI_WINDOW_SIZE ], Apos;
+    mbedtls_mpi RR, *T, *W[ 1 << MBEDTLS_MPI_WINDOW_SIZE ];
     int neg;
 
     if( mbedtls_mpi_cmp_int( N, 0 ) <= 0 || ( N->p[0] & 1 ) == 0 )
@@ -1636,9 +2166,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
      * Init temps and window size
      */
     mpi_montg_init( &mm, N );
-    mbedtls_mpi_init( &RR ); mbedtls_mpi_init( &T );
-    mbedtls_mpi_init( &Apos );
-    memset( W, 0, sizeof( W ) );
+    mbedtls_mpi_init( &RR );
 
     i = mbedtls_mpi_bitlen( E );
 
@@ -1648,10 +2176,16 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
     if( wsize > MBEDTLS_MPI_WINDOW_SIZE )
         wsize = MBEDTLS_MPI_WINDOW_SIZE;
 
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( arena, &T ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( arena, &W[1] ) );
+    if( wsize > 1 )
+        for( i = one << ( wsize - 1 ); i < ( one << wsize ); i++ )
+            MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( arena, &W[i] ) );
+
     j = N->n + 1;
     MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, j ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[1],  j ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T, j * 2 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( W[1],  j ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( T, MPI_MONTMUL_LIMBS( N->n ) ) );
 
     /*
      * Compensate for negative A (and correct at the end)
@@ -1659,9 +2193,12 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
     neg = ( A->s == -1 );
     if( neg )
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Apos, A ) );
-        Apos.s = 1;
-        A = &Apos;
+        mbedtls_mpi *Apos;
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( arena, &Apos ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( Apos, A ) );
+        Apos->s = 1;
+        A = Apos;
     }
 
     /*
@@ -1671,7 +2208,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
     {
         MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &RR, 1 ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &RR, N->n * 2 * biL ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &RR, &RR, N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &RR, &RR, N, arena ) );
 
         if( _RR != NULL )
             memcpy( _RR, &RR, sizeof( mbedtls_mpi ) );
@@ -1683,17 +2220,17 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
      * W[1] = A * R^2 * R^-1 mod N = A * R mod N
      */
     if( mbedtls_mpi_cmp_mpi( A, N ) >= 0 )
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &W[1], A, N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( W[1], A, N, arena ) );
     else
-        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[1], A ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( W[1], A ) );
 
-    MBEDTLS_MPI_CHK( mpi_montmul( &W[1], &RR, N, mm, &T ) );
+    MBEDTLS_MPI_CHK( mpi_montmul( W[1], &RR, N, mm, T ) );
 
     /*
      * X = R^2 * R^-1 mod N = R mod N
      */
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, &RR ) );
-    MBEDTLS_MPI_CHK( mpi_montred( X, N, mm, &T ) );
+    MBEDTLS_MPI_CHK( mpi_montred( X, N, mm, T ) );
 
     if( wsize > 1 )
     {
@@ -1702,21 +2239,21 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
          */
         j =  one << ( wsize - 1 );
 
-        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[j], N->n + 1 ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[j], &W[1]    ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( W[j], N->n + 1 ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( W[j], W[1]    ) );
 
         for( i = 0; i < wsize - 1; i++ )
-            MBEDTLS_MPI_CHK( mpi_montmul( &W[j], &W[j], N, mm, &T ) );
+            MBEDTLS_MPI_CHK( mpi_montmul( W[j], W[j], N, mm, T ) );
 
         /*
          * W[i] = W[i - 1] * W[1]
          */
         for( i = j + 1; i < ( one << wsize ); i++ )
         {
-            MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[i], N->n + 1 ) );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[i], &W[i - 1] ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_grow( W[i], N->n + 1 ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( W[i], W[i - 1] ) );
 
-            MBEDTLS_MPI_CHK( mpi_montmul( &W[i], &W[1], N, mm, &T ) );
+            MBEDTLS_MPI_CHK( mpi_montmul( W[i], W[1], N, mm, T ) );
         }
     }
 
@@ -1753,7 +2290,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
             /*
              * out of window, square X
              */
-            MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, mm, &T ) );
+            MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, mm, T ) );
             continue;
         }
 
@@ -1771,12 +2308,12 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
              * X = X^wsize R^-1 mod N
              */
             for( i = 0; i < wsize; i++ )
-                MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, mm, &T ) );
+                MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, mm, T ) );
 
             /*
              * X = X * W[wbits] R^-1 mod N
              */
-            MBEDTLS_MPI_CHK( mpi_montmul( X, &W[wbits], N, mm, &T ) );
+            MBEDTLS_MPI_CHK( mpi_montmul( X, W[wbits], N, mm, T ) );
 
             state--;
             nbits = 0;
@@ -1789,18 +2326,18 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
      */
     for( i = 0; i < nbits; i++ )
     {
-        MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, mm, &T ) );
+        MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, mm, T ) );
 
         wbits <<= 1;
 
         if( ( wbits & ( one << wsize ) ) != 0 )
-            MBEDTLS_MPI_CHK( mpi_montmul( X, &W[1], N, mm, &T ) );
+            MBEDTLS_MPI_CHK( mpi_montmul( X, W[1], N, mm, T ) );
     }
 
     /*
      * X = A^E * R * R^-1 mod N = A^E mod N
      */
-    MBEDTLS_MPI_CHK( mpi_montred( X, N, mm, &T ) );
+    MBEDTLS_MPI_CHK( mpi_montred( X, N, mm, T ) );
 
     if( neg && E->n != 0 && ( E->p[0] & 1 ) != 0 )
     {
@@ -1810,10 +2347,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
 
 cleanup:
 
-    for( i = ( one << ( wsize - 1 ) ); i < ( one << wsize ); i++ )
-        mbedtls_mpi_free( &W[i] );
-
-    mbedtls_mpi_free( &W[1] ); mbedtls_mpi_free( &T ); mbedtls_mpi_free( &Apos );
+    mbedtls_mpi_arena_release( arena, mark );
 
     if( _RR == NULL || _RR->p == NULL )
         mbedtls_mpi_free( &RR );
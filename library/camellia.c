@@ -38,6 +38,13 @@
 
 #include <string.h>
 
+#if defined(MBEDTLS_AESNI_C) && !defined(MBEDTLS_CAMELLIA_ALT)
+#include "mbedtls/aesni.h"
+#if defined(MBEDTLS_HAVE_X86_64)
+#define MBEDTLS_CAMELLIA_AESNI
+#endif
+#endif
+
 #if defined(MBEDTLS_SELF_TEST)
 #if defined(MBEDTLS_PLATFORM_C)
 #include "mbedtls/platform.h"
@@ -319,6 +326,253 @@ static void camellia_feistel( const uint32_t x[2], const uint32_t k[2],
     z[1] ^= I0;
 }
 
+#if defined(MBEDTLS_CAMELLIA_AESNI)
+/*
+ * Byte-sliced Camellia using the AES S-box [AES-NI].
+ *
+ * Sixteen blocks are transposed so that vector j holds byte j of every
+ * block, and the cipher then runs on whole vectors exactly as the scalar
+ * code above runs on bytes. s1 is an inversion in GF(2^8) like the AES
+ * S-box, just in another basis, so s1(x) = post( SubBytes( pre( x ) ) ) for
+ * two affine maps pre and post. These are applied as a pair of lookups on
+ * the low and high nibbles (PSHUFB), and SubBytes is AESENCLAST with an
+ * all-zero round key followed by InvShiftRows to undo its byte permutation.
+ * s2, s3 and s4 rotate the output or the input of s1, which is folded into
+ * the tables.
+ */
+typedef unsigned char camellia_u8x16 __attribute__((vector_size(16)));
+typedef char camellia_i8x16 __attribute__((vector_size(16)));
+typedef long long camellia_i64x2 __attribute__((vector_size(16)));
+
+#define CAMELLIA_BS_TARGET __attribute__((target("aes,ssse3")))
+
+static const camellia_u8x16 camellia_bs_pre_s1[2] =
+{
+    { 0x08, 0x09, 0x11, 0x10, 0xb9, 0xb8, 0xa0, 0xa1,
+      0xa3, 0xa2, 0xba, 0xbb, 0x12, 0x13, 0x0b, 0x0a },
+    { 0x00, 0xa7, 0x93, 0x34, 0x61, 0xc6, 0xf2, 0x55,
+      0xd9, 0x7e, 0x4a, 0xed, 0xb8, 0x1f, 0x2b, 0x8c }
+};
+
+static const camellia_u8x16 camellia_bs_pre_s4[2] =
+{
+    { 0x08, 0x11, 0xb9, 0xa0, 0xa3, 0xba, 0x12, 0x0b,
+      0xaf, 0xb6, 0x1e, 0x07, 0x04, 0x1d, 0xb5, 0xac },
+    { 0x00, 0x93, 0x61, 0xf2, 0xd9, 0x4a, 0xb8, 0x2b,
+      0x01, 0x92, 0x60, 0xf3, 0xd8, 0x4b, 0xb9, 0x2a }
+};
+
+static const camellia_u8x16 camellia_bs_post_s1[2] =
+{
+    { 0x11, 0x82, 0x84, 0x17, 0x3e, 0xad, 0xab, 0x38,
+      0x71, 0xe2, 0xe4, 0x77, 0x5e, 0xcd, 0xcb, 0x58 },
+    { 0x00, 0xb8, 0xd9, 0x61, 0xa0, 0x18, 0x79, 0xc1,
+      0xa8, 0x10, 0x71, 0xc9, 0x08, 0xb0, 0xd1, 0x69 }
+};
+
+static const camellia_u8x16 camellia_bs_post_s2[2] =
+{
+    { 0x22, 0x05, 0x09, 0x2e, 0x7c, 0x5b, 0x57, 0x70,
+      0xe2, 0xc5, 0xc9, 0xee, 0xbc, 0x9b, 0x97, 0xb0 },
+    { 0x00, 0x71, 0xb3, 0xc2, 0x41, 0x30, 0xf2, 0x83,
+      0x51, 0x20, 0xe2, 0x93, 0x10, 0x61, 0xa3, 0xd2 }
+};
+
+static const camellia_u8x16 camellia_bs_post_s3[2] =
+{
+    { 0x88, 0x41, 0x42, 0x8b, 0x1f, 0xd6, 0xd5, 0x1c,
+      0xb8, 0x71, 0x72, 0xbb, 0x2f, 0xe6, 0xe5, 0x2c },
+    { 0x00, 0x5c, 0xec, 0xb0, 0x50, 0x0c, 0xbc, 0xe0,
+      0x54, 0x08, 0xb8, 0xe4, 0x04, 0x58, 0xe8, 0xb4 }
+};
+
+static const camellia_u8x16 camellia_bs_inv_shift_rows =
+    { 0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3 };
+
+static inline __attribute__((always_inline)) CAMELLIA_BS_TARGET
+camellia_u8x16 camellia_bs_pshufb( camellia_u8x16 t, camellia_u8x16 i )
+{
+    return( (camellia_u8x16) __builtin_ia32_pshufb128( (camellia_i8x16) t,
+                                                       (camellia_i8x16) i ) );
+}
+
+static inline __attribute__((always_inline)) CAMELLIA_BS_TARGET
+camellia_u8x16 camellia_bs_affine( camellia_u8x16 x,
+                                   const camellia_u8x16 t[2] )
+{
+    const camellia_u8x16 m = (camellia_u8x16) { 0 } + 0x0f;
+
+    return( camellia_bs_pshufb( t[0], x & m ) ^
+            camellia_bs_pshufb( t[1], ( x >> 4 ) & m ) );
+}
+
+static inline __attribute__((always_inline)) CAMELLIA_BS_TARGET
+camellia_u8x16 camellia_bs_sbox( camellia_u8x16 x,
+                                 const camellia_u8x16 pre[2],
+                                 const camellia_u8x16 post[2] )
+{
+    const camellia_i64x2 zero = { 0, 0 };
+
+    x = camellia_bs_affine( x, pre );
+    x = (camellia_u8x16) __builtin_ia32_aesenclast128( (camellia_i64x2) x,
+                                                       zero );
+    x = camellia_bs_pshufb( x, camellia_bs_inv_shift_rows );
+    return( camellia_bs_affine( x, post ) );
+}
+
+/*
+ * 16x16 byte transpose: four rounds of interleaving vector k with vector
+ * k + 8, each of which rotates the (vector, byte) index bits by one.
+ */
+static inline __attribute__((always_inline)) CAMELLIA_BS_TARGET
+void camellia_bs_transpose( camellia_u8x16 x[16] )
+{
+    camellia_u8x16 t[16];
+    int r, k;
+
+    for( r = 0; r < 4; r++ )
+    {
+        for( k = 0; k < 8; k++ )
+        {
+            t[2 * k] = (camellia_u8x16) __builtin_ia32_punpcklbw128(
+                    (camellia_i8x16) x[k], (camellia_i8x16) x[k + 8] );
+            t[2 * k + 1] = (camellia_u8x16) __builtin_ia32_punpckhbw128(
+                    (camellia_i8x16) x[k], (camellia_i8x16) x[k + 8] );
+        }
+        for( k = 0; k < 16; k++ )
+            x[k] = t[k];
+    }
+}
+
+/* Byte j (big endian) of a round key word, in every lane */
+#define CAMELLIA_BS_KEY( k, j ) \
+    ( (camellia_u8x16) { 0 } + (unsigned char)( (k) >> ( 24 - 8 * (j) ) ) )
+
+/* z ^= F( x, k ), on the four vectors of each of x[0], x[1], z[0], z[1] */
+static inline __attribute__((always_inline)) CAMELLIA_BS_TARGET
+void camellia_bs_feistel( const camellia_u8x16 x[8], const uint32_t k[2],
+                          camellia_u8x16 z[8] )
+{
+    camellia_u8x16 I0[4], I1[4], t[4];
+    int j;
+
+    I0[0] = camellia_bs_sbox( x[0] ^ CAMELLIA_BS_KEY( k[0], 0 ),
+                              camellia_bs_pre_s1, camellia_bs_post_s1 );
+    I0[1] = camellia_bs_sbox( x[1] ^ CAMELLIA_BS_KEY( k[0], 1 ),
+                              camellia_bs_pre_s1, camellia_bs_post_s2 );
+    I0[2] = camellia_bs_sbox( x[2] ^ CAMELLIA_BS_KEY( k[0], 2 ),
+                              camellia_bs_pre_s1, camellia_bs_post_s3 );
+    I0[3] = camellia_bs_sbox( x[3] ^ CAMELLIA_BS_KEY( k[0], 3 ),
+                              camellia_bs_pre_s4, camellia_bs_post_s1 );
+    I1[0] = camellia_bs_sbox( x[4] ^ CAMELLIA_BS_KEY( k[1], 0 ),
+                              camellia_bs_pre_s1, camellia_bs_post_s2 );
+    I1[1] = camellia_bs_sbox( x[5] ^ CAMELLIA_BS_KEY( k[1], 1 ),
+                              camellia_bs_pre_s1, camellia_bs_post_s3 );
+    I1[2] = camellia_bs_sbox( x[6] ^ CAMELLIA_BS_KEY( k[1], 2 ),
+                              camellia_bs_pre_s4, camellia_bs_post_s1 );
+    I1[3] = camellia_bs_sbox( x[7] ^ CAMELLIA_BS_KEY( k[1], 3 ),
+                              camellia_bs_pre_s1, camellia_bs_post_s1 );
+
+    /* The word rotations of camellia_feistel() as byte index offsets */
+    for( j = 0; j < 4; j++ ) t[j] = I0[j] ^ I1[( j + 1 ) & 3];
+    for( j = 0; j < 4; j++ ) I1[j] ^= t[( j + 2 ) & 3];
+    for( j = 0; j < 4; j++ ) I0[j] = t[j] ^ I1[( j + 3 ) & 3];
+    for( j = 0; j < 4; j++ ) I1[j] ^= I0[( j + 3 ) & 3];
+
+    for( j = 0; j < 4; j++ )
+    {
+        z[j] ^= I1[j];
+        z[j + 4] ^= I0[j];
+    }
+}
+
+/* XR ^= ( XL & KL ) <<< 1, on the four byte vectors of each word */
+static inline __attribute__((always_inline)) CAMELLIA_BS_TARGET
+void camellia_bs_rotl1_xor( camellia_u8x16 r[4], const camellia_u8x16 l[4],
+                            uint32_t kl )
+{
+    camellia_u8x16 t[4];
+    int j;
+
+    for( j = 0; j < 4; j++ )
+        t[j] = l[j] & CAMELLIA_BS_KEY( kl, j );
+    for( j = 0; j < 4; j++ )
+        r[j] ^= ( t[j] << 1 ) | ( t[( j + 1 ) & 3] >> 7 );
+}
+
+static inline __attribute__((always_inline)) CAMELLIA_BS_TARGET
+void camellia_bs_or_xor( camellia_u8x16 l[4], const camellia_u8x16 r[4],
+                         uint32_t kr )
+{
+    int j;
+
+    for( j = 0; j < 4; j++ )
+        l[j] ^= r[j] | CAMELLIA_BS_KEY( kr, j );
+}
+
+static CAMELLIA_BS_TARGET
+void camellia_bs_crypt16( const mbedtls_camellia_context *ctx,
+                          const unsigned char input[256],
+                          unsigned char output[256] )
+{
+    camellia_u8x16 X[16], Y[16];
+    const uint32_t *RK = ctx->rk;
+    int NR = ctx->nr;
+    int j;
+
+    memcpy( X, input, sizeof( X ) );
+    camellia_bs_transpose( X );
+
+    for( j = 0; j < 16; j++ )
+        X[j] ^= CAMELLIA_BS_KEY( RK[j >> 2], j & 3 );
+    RK += 4;
+
+    while( NR ) {
+        --NR;
+        camellia_bs_feistel( X, RK, X + 8 );
+        RK += 2;
+        camellia_bs_feistel( X + 8, RK, X );
+        RK += 2;
+        camellia_bs_feistel( X, RK, X + 8 );
+        RK += 2;
+        camellia_bs_feistel( X + 8, RK, X );
+        RK += 2;
+        camellia_bs_feistel( X, RK, X + 8 );
+        RK += 2;
+        camellia_bs_feistel( X + 8, RK, X );
+        RK += 2;
+
+        if( NR ) {
+            /* FL( X[0], X[1] ) and FLInv( X[2], X[3] ) */
+            camellia_bs_rotl1_xor( X + 4, X, RK[0] );
+            camellia_bs_or_xor( X, X + 4, RK[1] );
+            camellia_bs_or_xor( X + 8, X + 12, RK[3] );
+            camellia_bs_rotl1_xor( X + 12, X + 8, RK[2] );
+            RK += 4;
+        }
+    }
+
+    for( j = 0; j < 8; j++ )
+    {
+        Y[j] = X[j + 8] ^ CAMELLIA_BS_KEY( RK[j >> 2], j & 3 );
+        Y[j + 8] = X[j] ^ CAMELLIA_BS_KEY( RK[2 + ( j >> 2 )], j & 3 );
+    }
+
+    camellia_bs_transpose( Y );
+    memcpy( output, Y, sizeof( Y ) );
+
+    mbedtls_platform_zeroize( X, sizeof( X ) );
+}
+
+#define CAMELLIA_BS_BLOCKS  16
+
+static int camellia_bs_active( void )
+{
+    return( mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) &&
+            mbedtls_aesni_has_support( MBEDTLS_AESNI_SSSE3 ) );
+}
+#endif /* MBEDTLS_CAMELLIA_AESNI */
+
 void mbedtls_camellia_init( mbedtls_camellia_context *ctx )
 {
     memset( ctx, 0, sizeof( mbedtls_camellia_context ) );
@@ -566,6 +820,33 @@ int mbedtls_camellia_crypt_cbc( mbedtls_camellia_context *ctx,
 
     if( mode == MBEDTLS_CAMELLIA_DECRYPT )
     {
+#if defined(MBEDTLS_CAMELLIA_AESNI)
+        /* Sixteen blocks at a time, reading them all before writing */
+        if( length >= CAMELLIA_BS_BLOCKS * 16 && camellia_bs_active() )
+        {
+            unsigned char buf[CAMELLIA_BS_BLOCKS * 16];
+
+            while( length >= CAMELLIA_BS_BLOCKS * 16 )
+            {
+                camellia_bs_crypt16( ctx, input, buf );
+
+                for( i = 0; i < 16; i++ )
+                    buf[i] = (unsigned char)( buf[i] ^ iv[i] );
+                for( i = 16; i < CAMELLIA_BS_BLOCKS * 16; i++ )
+                    buf[i] = (unsigned char)( buf[i] ^ input[i - 16] );
+
+                memcpy( iv, input + ( CAMELLIA_BS_BLOCKS - 1 ) * 16, 16 );
+                memcpy( output, buf, CAMELLIA_BS_BLOCKS * 16 );
+
+                input  += CAMELLIA_BS_BLOCKS * 16;
+                output += CAMELLIA_BS_BLOCKS * 16;
+                length -= CAMELLIA_BS_BLOCKS * 16;
+            }
+
+            mbedtls_platform_zeroize( buf, sizeof( buf ) );
+        }
+#endif /* MBEDTLS_CAMELLIA_AESNI */
+
         while( length > 0 )
         {
             memcpy( temp, input, 16 );
@@ -664,6 +945,40 @@ int mbedtls_camellia_crypt_ctr( mbedtls_camellia_context *ctx,
     int c, i;
     size_t n = *nc_off;
 
+#if defined(MBEDTLS_CAMELLIA_AESNI)
+    /* Whole keystream blocks, sixteen counters at a time */
+    if( n == 0 && length >= CAMELLIA_BS_BLOCKS * 16 && camellia_bs_active() )
+    {
+        unsigned char buf[CAMELLIA_BS_BLOCKS * 16];
+        size_t j;
+
+        while( length >= CAMELLIA_BS_BLOCKS * 16 )
+        {
+            for( j = 0; j < CAMELLIA_BS_BLOCKS; j++ )
+            {
+                memcpy( buf + 16 * j, nonce_counter, 16 );
+
+                for( i = 16; i > 0; i-- )
+                    if( ++nonce_counter[i - 1] != 0 )
+                        break;
+            }
+
+            camellia_bs_crypt16( ctx, buf, buf );
+
+            for( j = 0; j < CAMELLIA_BS_BLOCKS * 16; j++ )
+                output[j] = (unsigned char)( input[j] ^ buf[j] );
+
+            length -= CAMELLIA_BS_BLOCKS * 16;
+            input  += CAMELLIA_BS_BLOCKS * 16;
+            output += CAMELLIA_BS_BLOCKS * 16;
+        }
+
+        memcpy( stream_block, buf + 16 * ( CAMELLIA_BS_BLOCKS - 1 ), 16 );
+
+        mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    }
+#endif /* MBEDTLS_CAMELLIA_AESNI */
+
     while( length-- )
     {
         if( n == 0 ) {
@@ -687,6 +1002,41 @@ int mbedtls_camellia_crypt_ctr( mbedtls_camellia_context *ctx,
 #endif /* MBEDTLS_CIPHER_MODE_CTR */
 #endif /* !MBEDTLS_CAMELLIA_ALT */
 
+int mbedtls_camellia_crypt_blocks( mbedtls_camellia_context *ctx,
+                                   size_t nblocks,
+                                   const unsigned char *input,
+                                   unsigned char *output )
+{
+    int ret;
+
+#if defined(MBEDTLS_CAMELLIA_AESNI)
+    if( nblocks >= CAMELLIA_BS_BLOCKS && camellia_bs_active() )
+    {
+        do
+        {
+            camellia_bs_crypt16( ctx, input, output );
+            input  += CAMELLIA_BS_BLOCKS * 16;
+            output += CAMELLIA_BS_BLOCKS * 16;
+            nblocks -= CAMELLIA_BS_BLOCKS;
+        }
+        while( nblocks >= CAMELLIA_BS_BLOCKS );
+    }
+#endif /* MBEDTLS_CAMELLIA_AESNI */
+
+    while( nblocks-- > 0 )
+    {
+        ret = mbedtls_camellia_crypt_ecb( ctx, MBEDTLS_CAMELLIA_ENCRYPT,
+                                          input, output );
+        if( ret != 0 )
+            return( ret );
+
+        input  += 16;
+        output += 16;
+    }
+
+    return( 0 );
+}
+
 #if defined(MBEDTLS_SELF_TEST)
 
 /*
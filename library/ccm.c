@@ -37,10 +37,19 @@
 #if defined(MBEDTLS_CCM_C)
 
 #include "mbedtls/ccm.h"
+#include "mbedtls/cipher_internal.h"
 #include "mbedtls/platform_util.h"
 
 #include <string.h>
 
+#if defined(MBEDTLS_AESNI_C) && !defined(MBEDTLS_AES_ALT)
+#include "mbedtls/aes.h"
+#include "mbedtls/aesni.h"
+#if defined(MBEDTLS_HAVE_X86_64)
+#define MBEDTLS_CCM_AESNI
+#endif
+#endif
+
 #if defined(MBEDTLS_SELF_TEST) && defined(MBEDTLS_AES_C)
 #if defined(MBEDTLS_PLATFORM_C)
 #include "mbedtls/platform.h"
@@ -135,7 +144,8 @@ void mbedtls_ccm_free( mbedtls_ccm_context *ctx )
 static int ccm_auth_crypt( mbedtls_ccm_context *ctx, int mode, size_t length,
                            const unsigned char *iv, size_t iv_len,
                            const unsigned char *add, size_t add_len,
-                           const unsigned char *input, unsigned char *output,
+                           const mbedtls_cipher_iov *input, size_t input_count,
+                           const mbedtls_cipher_iov *output, size_t output_count,
                            unsigned char *tag, size_t tag_len )
 {
     int ret;
@@ -145,8 +155,16 @@ static int ccm_auth_crypt( mbedtls_ccm_context *ctx, int mode, size_t length,
     unsigned char b[16];
     unsigned char y[16];
     unsigned char ctr[16];
-    const unsigned char *src;
-    unsigned char *dst;
+    mbedtls_cipher_iov_cursor in, out;
+#if defined(MBEDTLS_CCM_AESNI)
+    mbedtls_aes_context *aes = NULL;
+
+    if( ctx->cipher_ctx.cipher_info->base->cipher == MBEDTLS_CIPHER_ID_AES &&
+        mbedtls_aesni_has_support( MBEDTLS_AESNI_AES ) )
+    {
+        aes = ctx->cipher_ctx.cipher_ctx;
+    }
+#endif
 
     /*
      * Check length requirements: SP800-38C A.1
@@ -165,6 +183,10 @@ static int ccm_auth_crypt( mbedtls_ccm_context *ctx, int mode, size_t length,
     if( add_len > 0xFF00 )
         return( MBEDTLS_ERR_CCM_BAD_INPUT );
 
+    if( mbedtls_cipher_iov_len( input, input_count ) < length ||
+        mbedtls_cipher_iov_len( output, output_count ) < length )
+        return( MBEDTLS_ERR_CCM_BAD_INPUT );
+
     q = 16 - 1 - (unsigned char) iv_len;
 
     /*
@@ -205,16 +227,15 @@ static int ccm_auth_crypt( mbedtls_ccm_context *ctx, int mode, size_t length,
     {
         size_t use_len;
         len_left = add_len;
-        src = add;
 
         memset( b, 0, 16 );
         b[0] = (unsigned char)( ( add_len >> 8 ) & 0xFF );
         b[1] = (unsigned char)( ( add_len      ) & 0xFF );
 
         use_len = len_left < 16 - 2 ? len_left : 16 - 2;
-        memcpy( b + 2, src, use_len );
+        memcpy( b + 2, add, use_len );
         len_left -= use_len;
-        src += use_len;
+        add += use_len;
 
         UPDATE_CBC_MAC;
 
@@ -223,11 +244,11 @@ static int ccm_auth_crypt( mbedtls_ccm_context *ctx, int mode, size_t length,
             use_len = len_left > 16 ? 16 : len_left;
 
             memset( b, 0, 16 );
-            memcpy( b, src, use_len );
+            memcpy( b, add, use_len );
             UPDATE_CBC_MAC;
 
             len_left -= use_len;
-            src += use_len;
+            add += use_len;
         }
     }
 
@@ -251,33 +272,88 @@ static int ccm_auth_crypt( mbedtls_ccm_context *ctx, int mode, size_t length,
      *
      * The only difference between encryption and decryption is
      * the respective order of authentication and {en,de}cryption.
+     *
+     * Each block is processed directly in the input and output segments,
+     * which may be the same ones: the CTR keystream goes to b, and the
+     * plaintext is folded into the CBC-MAC state y as it goes by, which is
+     * the same as padding the last partial block with zeros.
      */
     len_left = length;
-    src = input;
-    dst = output;
+    mbedtls_cipher_iov_cursor_init( &in, input, input_count );
+    mbedtls_cipher_iov_cursor_init( &out, output, output_count );
 
     while( len_left > 0 )
     {
         size_t use_len = len_left > 16 ? 16 : len_left;
+        size_t done, part;
 
-        if( mode == CCM_ENCRYPT )
+#if defined(MBEDTLS_CCM_AESNI)
+        /*
+         * Runs of whole blocks that are contiguous in both the input and the
+         * output go through the AES-NI kernel, which interleaves the CBC-MAC
+         * and the CTR computations instead of doing one after the other.
+         */
+        if( aes != NULL && len_left >= 16 )
         {
-            memset( b, 0, 16 );
-            memcpy( b, src, use_len );
-            UPDATE_CBC_MAC;
+            unsigned char *in_p, *out_p;
+            size_t n = mbedtls_cipher_iov_contig( &in, &in_p );
+            size_t out_n = mbedtls_cipher_iov_contig( &out, &out_p );
+
+            if( out_n < n )
+                n = out_n;
+            if( len_left < n )
+                n = len_left;
+            n &= ~(size_t) 15;
+
+            if( n > 0 )
+            {
+                mbedtls_aesni_ccm_crypt( aes, mode == CCM_ENCRYPT ?
+                                         MBEDTLS_AES_ENCRYPT :
+                                         MBEDTLS_AES_DECRYPT,
+                                         n / 16, ctr, y, in_p, out_p );
+                mbedtls_cipher_iov_advance( &in, n );
+                mbedtls_cipher_iov_advance( &out, n );
+                len_left -= n;
+                continue;
+            }
         }
+#endif /* MBEDTLS_CCM_AESNI */
 
-        CTR_CRYPT( dst, src, use_len );
+        if( ( ret = mbedtls_cipher_update( &ctx->cipher_ctx, ctr, 16,
+                                           b, &olen ) ) != 0 )
+            return( ret );
 
-        if( mode == CCM_DECRYPT )
+        for( done = 0; done < use_len; done += part )
         {
-            memset( b, 0, 16 );
-            memcpy( b, dst, use_len );
-            UPDATE_CBC_MAC;
+            unsigned char *in_p, *out_p, c;
+            size_t out_n, k;
+
+            part = mbedtls_cipher_iov_contig( &in, &in_p );
+            out_n = mbedtls_cipher_iov_contig( &out, &out_p );
+            if( out_n < part )
+                part = out_n;
+            if( use_len - done < part )
+                part = use_len - done;
+
+            for( k = 0; k < part; k++ )
+            {
+                c = in_p[k];
+                if( mode == CCM_ENCRYPT )
+                    y[done + k] ^= c;
+                c ^= b[done + k];
+                if( mode == CCM_DECRYPT )
+                    y[done + k] ^= c;
+                out_p[k] = c;
+            }
+
+            mbedtls_cipher_iov_advance( &in, part );
+            mbedtls_cipher_iov_advance( &out, part );
         }
 
-        dst += use_len;
-        src += use_len;
+        if( ( ret = mbedtls_cipher_update( &ctx->cipher_ctx, y, 16,
+                                           y, &olen ) ) != 0 )
+            return( ret );
+
         len_left -= use_len;
 
         /*
@@ -298,6 +374,44 @@ static int ccm_auth_crypt( mbedtls_ccm_context *ctx, int mode, size_t length,
     CTR_CRYPT( y, y, 16 );
     memcpy( tag, y, tag_len );
 
+    mbedtls_platform_zeroize( b, sizeof( b ) );
+
+    return( 0 );
+}
+
+/*
+ * Authenticated decryption, with the tag check
+ */
+static int ccm_auth_decrypt( mbedtls_ccm_context *ctx, size_t length,
+                      const unsigned char *iv, size_t iv_len,
+                      const unsigned char *add, size_t add_len,
+                      const mbedtls_cipher_iov *input, size_t input_count,
+                      const mbedtls_cipher_iov *output, size_t output_count,
+                      const unsigned char *tag, size_t tag_len )
+{
+    int ret;
+    unsigned char check_tag[16];
+    unsigned char i;
+    int diff;
+
+    if( ( ret = ccm_auth_crypt( ctx, CCM_DECRYPT, length,
+                                iv, iv_len, add, add_len,
+                                input, input_count, output, output_count,
+                                check_tag, tag_len ) ) != 0 )
+    {
+        return( ret );
+    }
+
+    /* Check tag in "constant-time" */
+    for( diff = 0, i = 0; i < tag_len; i++ )
+        diff |= tag[i] ^ check_tag[i];
+
+    if( diff != 0 )
+    {
+        mbedtls_cipher_iov_zeroize( output, output_count, length );
+        return( MBEDTLS_ERR_CCM_AUTH_FAILED );
+    }
+
     return( 0 );
 }
 
@@ -310,8 +424,15 @@ int mbedtls_ccm_star_encrypt_and_tag( mbedtls_ccm_context *ctx, size_t length,
                          const unsigned char *input, unsigned char *output,
                          unsigned char *tag, size_t tag_len )
 {
+    mbedtls_cipher_iov src, dst;
+
+    src.base = (unsigned char *) input;
+    src.len = length;
+    dst.base = output;
+    dst.len = length;
+
     return( ccm_auth_crypt( ctx, CCM_ENCRYPT, length, iv, iv_len,
-                            add, add_len, input, output, tag, tag_len ) );
+                            add, add_len, &src, 1, &dst, 1, tag, tag_len ) );
 }
 
 int mbedtls_ccm_encrypt_and_tag( mbedtls_ccm_context *ctx, size_t length,
@@ -336,29 +457,15 @@ int mbedtls_ccm_star_auth_decrypt( mbedtls_ccm_context *ctx, size_t length,
                       const unsigned char *input, unsigned char *output,
                       const unsigned char *tag, size_t tag_len )
 {
-    int ret;
-    unsigned char check_tag[16];
-    unsigned char i;
-    int diff;
+    mbedtls_cipher_iov src, dst;
 
-    if( ( ret = ccm_auth_crypt( ctx, CCM_DECRYPT, length,
-                                iv, iv_len, add, add_len,
-                                input, output, check_tag, tag_len ) ) != 0 )
-    {
-        return( ret );
-    }
+    src.base = (unsigned char *) input;
+    src.len = length;
+    dst.base = output;
+    dst.len = length;
 
-    /* Check tag in "constant-time" */
-    for( diff = 0, i = 0; i < tag_len; i++ )
-        diff |= tag[i] ^ check_tag[i];
-
-    if( diff != 0 )
-    {
-        mbedtls_platform_zeroize( output, length );
-        return( MBEDTLS_ERR_CCM_AUTH_FAILED );
-    }
-
-    return( 0 );
+    return( ccm_auth_decrypt( ctx, length, iv, iv_len, add, add_len,
+                              &src, 1, &dst, 1, tag, tag_len ) );
 }
 
 int mbedtls_ccm_auth_decrypt( mbedtls_ccm_context *ctx, size_t length,
@@ -373,6 +480,52 @@ int mbedtls_ccm_auth_decrypt( mbedtls_ccm_context *ctx, size_t length,
     return( mbedtls_ccm_star_auth_decrypt( ctx, length, iv, iv_len, add,
                 add_len, input, output, tag, tag_len ) );
 }
+
+/*
+ * Scatter/gather variants
+ */
+int mbedtls_ccm_encrypt_and_tag_iov( mbedtls_ccm_context *ctx,
+                         const unsigned char *iv, size_t iv_len,
+                         const unsigned char *add, size_t add_len,
+                         const mbedtls_cipher_iov *src, size_t src_count,
+                         const mbedtls_cipher_iov *dst, size_t dst_count,
+                         unsigned char *tag, size_t tag_len )
+{
+    if( tag_len == 0 )
+        return( MBEDTLS_ERR_CCM_BAD_INPUT );
+
+    if( dst == NULL )
+    {
+        dst = src;
+        dst_count = src_count;
+    }
+
+    return( ccm_auth_crypt( ctx, CCM_ENCRYPT,
+                            mbedtls_cipher_iov_len( src, src_count ),
+                            iv, iv_len, add, add_len,
+                            src, src_count, dst, dst_count, tag, tag_len ) );
+}
+
+int mbedtls_ccm_auth_decrypt_iov( mbedtls_ccm_context *ctx,
+                         const unsigned char *iv, size_t iv_len,
+                         const unsigned char *add, size_t add_len,
+                         const mbedtls_cipher_iov *src, size_t src_count,
+                         const mbedtls_cipher_iov *dst, size_t dst_count,
+                         const unsigned char *tag, size_t tag_len )
+{
+    if( tag_len == 0 )
+        return( MBEDTLS_ERR_CCM_BAD_INPUT );
+
+    if( dst == NULL )
+    {
+        dst = src;
+        dst_count = src_count;
+    }
+
+    return( ccm_auth_decrypt( ctx, mbedtls_cipher_iov_len( src, src_count ),
+                              iv, iv_len, add, add_len,
+                              src, src_count, dst, dst_count, tag, tag_len ) );
+}
 #endif /* !MBEDTLS_CCM_ALT */
 
 #if defined(MBEDTLS_SELF_TEST) && defined(MBEDTLS_AES_C)
@@ -175,11 +175,12 @@ void mbedtls_cipher_free( mbedtls_cipher_context_t *ctx )
             mbedtls_cipher_context_psa * const cipher_psa =
                 (mbedtls_cipher_context_psa *) ctx->cipher_ctx;
 
+            /* xxx_free() doesn't allow to return failures. */
+            if( cipher_psa->op_started )
+                (void) psa_cipher_abort( &cipher_psa->op );
+
             if( cipher_psa->slot_state == MBEDTLS_CIPHER_PSA_KEY_OWNED )
-            {
-                /* xxx_free() doesn't allow to return failures. */
                 (void) psa_destroy_key( cipher_psa->slot );
-            }
 
             mbedtls_platform_zeroize( cipher_psa, sizeof( *cipher_psa ) );
             mbedtls_free( cipher_psa );
@@ -374,6 +375,66 @@ int mbedtls_cipher_setkey( mbedtls_cipher_context_t *ctx,
     return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
 }
 
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+/*
+ * Stop the multi-part PSA operation of a context, if any
+ */
+static void cipher_psa_stop( mbedtls_cipher_context_psa *cipher_psa )
+{
+    if( cipher_psa->op_started )
+    {
+        (void) psa_cipher_abort( &cipher_psa->op );
+        cipher_psa->op_started = 0;
+    }
+}
+
+/*
+ * Set up the multi-part PSA operation of a context with the key and the IV
+ * last given to mbedtls_cipher_set_iv(), unless that is already done.
+ */
+static int cipher_psa_start( mbedtls_cipher_context_t *ctx )
+{
+    mbedtls_cipher_context_psa * const cipher_psa =
+        (mbedtls_cipher_context_psa *) ctx->cipher_ctx;
+    psa_status_t status;
+
+    if( cipher_psa->op_started )
+        return( 0 );
+
+    if( ctx->operation == MBEDTLS_DECRYPT )
+    {
+        status = psa_cipher_decrypt_setup( &cipher_psa->op,
+                                           cipher_psa->slot,
+                                           cipher_psa->alg );
+    }
+    else if( ctx->operation == MBEDTLS_ENCRYPT )
+    {
+        status = psa_cipher_encrypt_setup( &cipher_psa->op,
+                                           cipher_psa->slot,
+                                           cipher_psa->alg );
+    }
+    else
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+
+    if( status != PSA_SUCCESS )
+        return( MBEDTLS_ERR_CIPHER_HW_ACCEL_FAILED );
+
+    cipher_psa->op_started = 1;
+
+    if( ctx->iv_size != 0 )
+    {
+        status = psa_cipher_set_iv( &cipher_psa->op, ctx->iv, ctx->iv_size );
+        if( status != PSA_SUCCESS )
+        {
+            cipher_psa_stop( cipher_psa );
+            return( MBEDTLS_ERR_CIPHER_HW_ACCEL_FAILED );
+        }
+    }
+
+    return( 0 );
+}
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
 int mbedtls_cipher_set_iv( mbedtls_cipher_context_t *ctx,
                    const unsigned char *iv, size_t iv_len )
 {
@@ -383,16 +444,6 @@ int mbedtls_cipher_set_iv( mbedtls_cipher_context_t *ctx,
     else if( NULL == iv && iv_len != 0  )
         return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
 
-#if defined(MBEDTLS_USE_PSA_CRYPTO)
-    if( ctx->psa_enabled == 1 )
-    {
-        /* While PSA Crypto has an API for multipart
-         * operations, we currently don't make it
-         * accessible through the cipher layer. */
-        return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
-    }
-#endif /* MBEDTLS_USE_PSA_CRYPTO */
-
     if( NULL == iv && iv_len == 0 )
         ctx->iv_size = 0;
 
@@ -411,6 +462,12 @@ int mbedtls_cipher_set_iv( mbedtls_cipher_context_t *ctx,
             return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
     }
 
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    /* The IV is passed to PSA when the next operation starts. */
+    if( ctx->psa_enabled == 1 )
+        cipher_psa_stop( (mbedtls_cipher_context_psa *) ctx->cipher_ctx );
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
 #if defined(MBEDTLS_CHACHA20_C)
     if ( ctx->cipher_info->type == MBEDTLS_CIPHER_CHACHA20 )
     {
@@ -440,9 +497,11 @@ int mbedtls_cipher_reset( mbedtls_cipher_context_t *ctx )
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     if( ctx->psa_enabled == 1 )
     {
-        /* We don't support resetting PSA-based
-         * cipher contexts, yet. */
-        return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+        /* Drop any operation in progress: the next call to
+         * mbedtls_cipher_update() or mbedtls_cipher_finish()
+         * starts a new one. */
+        cipher_psa_stop( (mbedtls_cipher_context_psa *) ctx->cipher_ctx );
+        return( 0 );
     }
 #endif /* MBEDTLS_USE_PSA_CRYPTO */
 
@@ -515,10 +574,27 @@ int mbedtls_cipher_update( mbedtls_cipher_context_t *ctx, const unsigned char *i
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     if( ctx->psa_enabled == 1 )
     {
-        /* While PSA Crypto has an API for multipart
-         * operations, we currently don't make it
-         * accessible through the cipher layer. */
-        return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+        mbedtls_cipher_context_psa * const cipher_psa =
+            (mbedtls_cipher_context_psa *) ctx->cipher_ctx;
+        psa_status_t status;
+
+        *olen = 0;
+
+        if( ( ret = cipher_psa_start( ctx ) ) != 0 )
+            return( ret );
+
+        /* As for the other contexts, the output buffer must have room
+         * for ilen plus one block. An unsuccessful call terminates the
+         * PSA operation. */
+        status = psa_cipher_update( &cipher_psa->op, input, ilen, output,
+                        ilen + mbedtls_cipher_get_block_size( ctx ), olen );
+        if( status != PSA_SUCCESS )
+        {
+            cipher_psa->op_started = 0;
+            return( MBEDTLS_ERR_CIPHER_HW_ACCEL_FAILED );
+        }
+
+        return( 0 );
     }
 #endif /* MBEDTLS_USE_PSA_CRYPTO */
 
@@ -750,6 +826,429 @@ int mbedtls_cipher_update( mbedtls_cipher_context_t *ctx, const unsigned char *i
     return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
 }
 
+/*
+ * Scatter/gather helpers
+ */
+void mbedtls_cipher_iov_cursor_init( mbedtls_cipher_iov_cursor *cur,
+                                     const mbedtls_cipher_iov *iov,
+                                     size_t count )
+{
+    cur->iov = iov;
+    cur->count = count;
+    cur->off = 0;
+}
+
+size_t mbedtls_cipher_iov_len( const mbedtls_cipher_iov *iov, size_t count )
+{
+    size_t len = 0;
+
+    while( count-- > 0 )
+        len += iov++->len;
+
+    return( len );
+}
+
+size_t mbedtls_cipher_iov_contig( mbedtls_cipher_iov_cursor *cur,
+                                  unsigned char **p )
+{
+    while( cur->count > 0 && cur->off == cur->iov->len )
+    {
+        cur->iov++;
+        cur->count--;
+        cur->off = 0;
+    }
+
+    if( cur->count == 0 )
+    {
+        *p = NULL;
+        return( 0 );
+    }
+
+    *p = cur->iov->base + cur->off;
+    return( cur->iov->len - cur->off );
+}
+
+void mbedtls_cipher_iov_advance( mbedtls_cipher_iov_cursor *cur, size_t len )
+{
+    unsigned char *p;
+    size_t n;
+
+    while( len > 0 && ( n = mbedtls_cipher_iov_contig( cur, &p ) ) > 0 )
+    {
+        if( n > len )
+            n = len;
+
+        cur->off += n;
+        len -= n;
+    }
+}
+
+void mbedtls_cipher_iov_gather( mbedtls_cipher_iov_cursor *cur,
+                                unsigned char *buf, size_t len )
+{
+    unsigned char *p;
+    size_t n;
+
+    while( len > 0 && ( n = mbedtls_cipher_iov_contig( cur, &p ) ) > 0 )
+    {
+        if( n > len )
+            n = len;
+
+        memcpy( buf, p, n );
+        cur->off += n;
+        buf += n;
+        len -= n;
+    }
+}
+
+void mbedtls_cipher_iov_scatter( mbedtls_cipher_iov_cursor *cur,
+                                 const unsigned char *buf, size_t len )
+{
+    unsigned char *p;
+    size_t n;
+
+    while( len > 0 && ( n = mbedtls_cipher_iov_contig( cur, &p ) ) > 0 )
+    {
+        if( n > len )
+            n = len;
+
+        memcpy( p, buf, n );
+        cur->off += n;
+        buf += n;
+        len -= n;
+    }
+}
+
+void mbedtls_cipher_iov_zeroize( const mbedtls_cipher_iov *iov, size_t count,
+                                 size_t len )
+{
+    for( ; count > 0 && len > 0; iov++, count-- )
+    {
+        size_t n = iov->len < len ? iov->len : len;
+
+        mbedtls_platform_zeroize( iov->base, n );
+        len -= n;
+    }
+}
+
+/*
+ * Process a contiguous run of data in a mode that accepts any length
+ */
+static int cipher_update_contig( mbedtls_cipher_context_t *ctx, size_t ilen,
+                                 const unsigned char *input,
+                                 unsigned char *output )
+{
+#if defined(MBEDTLS_GCM_C)
+    if( ctx->cipher_info->mode == MBEDTLS_MODE_GCM )
+        return( mbedtls_gcm_update( (mbedtls_gcm_context *) ctx->cipher_ctx,
+                                    ilen, input, output ) );
+#endif
+
+#if defined(MBEDTLS_CHACHAPOLY_C)
+    if( ctx->cipher_info->type == MBEDTLS_CIPHER_CHACHA20_POLY1305 )
+        return( mbedtls_chachapoly_update(
+                    (mbedtls_chachapoly_context *) ctx->cipher_ctx,
+                    ilen, input, output ) );
+#endif
+
+#if defined(MBEDTLS_CIPHER_MODE_CFB)
+    if( ctx->cipher_info->mode == MBEDTLS_MODE_CFB )
+        return( ctx->cipher_info->base->cfb_func( ctx->cipher_ctx,
+                    ctx->operation, ilen, &ctx->unprocessed_len, ctx->iv,
+                    input, output ) );
+#endif
+
+#if defined(MBEDTLS_CIPHER_MODE_OFB)
+    if( ctx->cipher_info->mode == MBEDTLS_MODE_OFB )
+        return( ctx->cipher_info->base->ofb_func( ctx->cipher_ctx,
+                    ilen, &ctx->unprocessed_len, ctx->iv, input, output ) );
+#endif
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+    if( ctx->cipher_info->mode == MBEDTLS_MODE_CTR )
+        return( ctx->cipher_info->base->ctr_func( ctx->cipher_ctx,
+                    ilen, &ctx->unprocessed_len, ctx->iv,
+                    ctx->unprocessed_data, input, output ) );
+#endif
+
+#if defined(MBEDTLS_CIPHER_MODE_STREAM)
+    if( ctx->cipher_info->mode == MBEDTLS_MODE_STREAM )
+        return( ctx->cipher_info->base->stream_func( ctx->cipher_ctx,
+                    ilen, input, output ) );
+#endif
+
+    ((void) ilen);
+    ((void) input);
+    ((void) output);
+    return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+}
+
+/*
+ * Process len Bytes between two cursors in a mode that accepts any length.
+ * GCM wants multiples of 16 Bytes except at the end, so in that mode blocks
+ * that straddle a segment boundary go through a local buffer.
+ */
+static int cipher_update_iov_stream( mbedtls_cipher_context_t *ctx,
+                                     mbedtls_cipher_iov_cursor *in,
+                                     mbedtls_cipher_iov_cursor *out,
+                                     size_t len )
+{
+    int ret = 0;
+    unsigned char *p, *q;
+    size_t n, m;
+    unsigned char tmp[16];
+
+    while( len > 0 )
+    {
+        n = mbedtls_cipher_iov_contig( in, &p );
+        m = mbedtls_cipher_iov_contig( out, &q );
+        if( m < n )
+            n = m;
+        if( len < n )
+            n = len;
+
+#if defined(MBEDTLS_GCM_C)
+        if( ctx->cipher_info->mode == MBEDTLS_MODE_GCM && n < len )
+        {
+            n -= n % 16;
+
+            if( n == 0 )
+            {
+                n = len < 16 ? len : 16;
+
+                mbedtls_cipher_iov_gather( in, tmp, n );
+                if( ( ret = cipher_update_contig( ctx, n, tmp, tmp ) ) != 0 )
+                    goto exit;
+                mbedtls_cipher_iov_scatter( out, tmp, n );
+
+                len -= n;
+                continue;
+            }
+        }
+#endif /* MBEDTLS_GCM_C */
+
+        if( ( ret = cipher_update_contig( ctx, n, p, q ) ) != 0 )
+            goto exit;
+
+        mbedtls_cipher_iov_advance( in, n );
+        mbedtls_cipher_iov_advance( out, n );
+        len -= n;
+    }
+
+exit:
+    mbedtls_platform_zeroize( tmp, sizeof( tmp ) );
+    return( ret );
+}
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+/*
+ * CBC over segments: same caching rules as mbedtls_cipher_update()
+ */
+static int cipher_update_iov_cbc( mbedtls_cipher_context_t *ctx,
+                                  const mbedtls_cipher_iov *src,
+                                  size_t src_count,
+                                  const mbedtls_cipher_iov *dst,
+                                  size_t dst_count,
+                                  int in_place, size_t *olen )
+{
+    int ret = 0;
+    size_t block_size = mbedtls_cipher_get_block_size( ctx );
+    size_t ilen = mbedtls_cipher_iov_len( src, src_count );
+    size_t copy_len = 0, tail_len = 0, full_len;
+    mbedtls_cipher_iov_cursor in, out;
+    unsigned char *p, *q;
+    size_t n, m;
+    unsigned char tmp[MBEDTLS_MAX_BLOCK_LENGTH];
+
+    mbedtls_cipher_iov_cursor_init( &in, src, src_count );
+    mbedtls_cipher_iov_cursor_init( &out, dst, dst_count );
+
+    /*
+     * If there is not enough data for a full block, cache it.
+     */
+    if( ( ctx->operation == MBEDTLS_DECRYPT && NULL != ctx->add_padding &&
+            ilen <= block_size - ctx->unprocessed_len ) ||
+        ( ctx->operation == MBEDTLS_DECRYPT && NULL == ctx->add_padding &&
+            ilen < block_size - ctx->unprocessed_len ) ||
+         ( ctx->operation == MBEDTLS_ENCRYPT &&
+            ilen < block_size - ctx->unprocessed_len ) )
+    {
+        mbedtls_cipher_iov_gather( &in,
+                &( ctx->unprocessed_data[ctx->unprocessed_len] ), ilen );
+
+        ctx->unprocessed_len += ilen;
+        return( 0 );
+    }
+
+    /*
+     * Work out the output length first, so that nothing is written
+     * if the output segments are too short.
+     */
+    if( 0 != ctx->unprocessed_len )
+    {
+        /* The first output block would overwrite unread input */
+        if( in_place )
+            return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+
+        copy_len = block_size - ctx->unprocessed_len;
+        ilen -= copy_len;
+    }
+
+    if( 0 != ilen )
+    {
+        tail_len = ilen % block_size;
+        if( tail_len == 0 &&
+            ctx->operation == MBEDTLS_DECRYPT &&
+            NULL != ctx->add_padding )
+        {
+            tail_len = block_size;
+        }
+    }
+
+    full_len = ilen - tail_len;
+
+    if( mbedtls_cipher_iov_len( dst, dst_count ) <
+        full_len + ( copy_len != 0 ? block_size : 0 ) )
+    {
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+    }
+
+    /*
+     * Process cached data first
+     */
+    if( 0 != copy_len )
+    {
+        mbedtls_cipher_iov_gather( &in,
+                &( ctx->unprocessed_data[ctx->unprocessed_len] ), copy_len );
+
+        if( 0 != ( ret = ctx->cipher_info->base->cbc_func( ctx->cipher_ctx,
+                ctx->operation, block_size, ctx->iv,
+                ctx->unprocessed_data, tmp ) ) )
+        {
+            goto exit;
+        }
+
+        mbedtls_cipher_iov_scatter( &out, tmp, block_size );
+        *olen += block_size;
+        ctx->unprocessed_len = 0;
+    }
+
+    /*
+     * Process full blocks, directly in the segments where possible
+     */
+    while( full_len > 0 )
+    {
+        n = mbedtls_cipher_iov_contig( &in, &p );
+        m = mbedtls_cipher_iov_contig( &out, &q );
+        if( m < n )
+            n = m;
+        if( full_len < n )
+            n = full_len;
+        n -= n % block_size;
+
+        if( n == 0 )
+        {
+            mbedtls_cipher_iov_gather( &in, tmp, block_size );
+            if( 0 != ( ret = ctx->cipher_info->base->cbc_func(
+                    ctx->cipher_ctx, ctx->operation, block_size, ctx->iv,
+                    tmp, tmp ) ) )
+            {
+                goto exit;
+            }
+            mbedtls_cipher_iov_scatter( &out, tmp, block_size );
+            n = block_size;
+        }
+        else
+        {
+            if( 0 != ( ret = ctx->cipher_info->base->cbc_func(
+                    ctx->cipher_ctx, ctx->operation, n, ctx->iv, p, q ) ) )
+            {
+                goto exit;
+            }
+            mbedtls_cipher_iov_advance( &in, n );
+            mbedtls_cipher_iov_advance( &out, n );
+        }
+
+        *olen += n;
+        full_len -= n;
+    }
+
+    /*
+     * Cache final, incomplete block
+     */
+    mbedtls_cipher_iov_gather( &in, ctx->unprocessed_data, tail_len );
+    ctx->unprocessed_len = tail_len;
+
+exit:
+    mbedtls_platform_zeroize( tmp, sizeof( tmp ) );
+    return( ret );
+}
+#endif /* MBEDTLS_CIPHER_MODE_CBC */
+
+int mbedtls_cipher_update_iov( mbedtls_cipher_context_t *ctx,
+                               const mbedtls_cipher_iov *src, size_t src_count,
+                               const mbedtls_cipher_iov *dst, size_t dst_count,
+                               size_t *olen )
+{
+    size_t ilen;
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+    int in_place = 0;
+#endif
+    mbedtls_cipher_iov_cursor in, out;
+
+    if( NULL == ctx || NULL == ctx->cipher_info || NULL == olen ||
+        ( NULL == src && 0 != src_count ) )
+    {
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+    }
+
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    if( ctx->psa_enabled == 1 )
+        return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
+    *olen = 0;
+
+    if( NULL == dst )
+    {
+        dst = src;
+        dst_count = src_count;
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+        in_place = 1;
+#endif
+    }
+
+    switch( ctx->cipher_info->mode )
+    {
+#if defined(MBEDTLS_CIPHER_MODE_CBC)
+        case MBEDTLS_MODE_CBC:
+            return( cipher_update_iov_cbc( ctx, src, src_count,
+                                           dst, dst_count, in_place, olen ) );
+#endif /* MBEDTLS_CIPHER_MODE_CBC */
+
+        case MBEDTLS_MODE_GCM:
+        case MBEDTLS_MODE_CFB:
+        case MBEDTLS_MODE_OFB:
+        case MBEDTLS_MODE_CTR:
+        case MBEDTLS_MODE_STREAM:
+        case MBEDTLS_MODE_CHACHAPOLY:
+            break;
+
+        default:
+            return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+    }
+
+    ilen = mbedtls_cipher_iov_len( src, src_count );
+    if( mbedtls_cipher_iov_len( dst, dst_count ) < ilen )
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+
+    mbedtls_cipher_iov_cursor_init( &in, src, src_count );
+    mbedtls_cipher_iov_cursor_init( &out, dst, dst_count );
+
+    *olen = ilen;
+    return( cipher_update_iov_stream( ctx, &in, &out, ilen ) );
+}
+
 #if defined(MBEDTLS_CIPHER_MODE_WITH_PADDING)
 #if defined(MBEDTLS_CIPHER_PADDING_PKCS7)
 /*
@@ -931,10 +1430,26 @@ int mbedtls_cipher_finish( mbedtls_cipher_context_t *ctx,
 #if defined(MBEDTLS_USE_PSA_CRYPTO)
     if( ctx->psa_enabled == 1 )
     {
-        /* While PSA Crypto has an API for multipart
-         * operations, we currently don't make it
-         * accessible through the cipher layer. */
-        return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+        mbedtls_cipher_context_psa * const cipher_psa =
+            (mbedtls_cipher_context_psa *) ctx->cipher_ctx;
+        psa_status_t status;
+        int ret;
+
+        *olen = 0;
+
+        if( ( ret = cipher_psa_start( ctx ) ) != 0 )
+            return( ret );
+
+        /* psa_cipher_finish() always terminates the operation. */
+        status = psa_cipher_finish( &cipher_psa->op, output,
+                                    mbedtls_cipher_get_block_size( ctx ),
+                                    olen );
+        cipher_psa->op_started = 0;
+
+        if( status != PSA_SUCCESS )
+            return( MBEDTLS_ERR_CIPHER_HW_ACCEL_FAILED );
+
+        return( 0 );
     }
 #endif /* MBEDTLS_USE_PSA_CRYPTO */
 
@@ -1461,6 +1976,246 @@ int mbedtls_cipher_auth_decrypt( mbedtls_cipher_context_t *ctx,
 
     return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
 }
+
+/*
+ * Packet-oriented encryption for AEAD modes, over segments
+ */
+int mbedtls_cipher_auth_encrypt_iov( mbedtls_cipher_context_t *ctx,
+                         const unsigned char *iv, size_t iv_len,
+                         const unsigned char *ad, size_t ad_len,
+                         const mbedtls_cipher_iov *src, size_t src_count,
+                         const mbedtls_cipher_iov *dst, size_t dst_count,
+                         size_t *olen,
+                         unsigned char *tag, size_t tag_len )
+{
+    size_t ilen;
+
+    if( NULL == ctx || NULL == ctx->cipher_info || NULL == olen ||
+        ( NULL == src && 0 != src_count ) )
+    {
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+    }
+
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    if( ctx->psa_enabled == 1 )
+        return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
+    if( NULL == dst )
+    {
+        dst = src;
+        dst_count = src_count;
+    }
+
+    ilen = mbedtls_cipher_iov_len( src, src_count );
+    if( mbedtls_cipher_iov_len( dst, dst_count ) < ilen )
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+
+#if defined(MBEDTLS_GCM_C)
+    if( MBEDTLS_MODE_GCM == ctx->cipher_info->mode )
+    {
+        int ret;
+        mbedtls_cipher_iov_cursor in, out;
+
+        mbedtls_cipher_iov_cursor_init( &in, src, src_count );
+        mbedtls_cipher_iov_cursor_init( &out, dst, dst_count );
+
+        if( ( ret = mbedtls_gcm_starts( ctx->cipher_ctx, MBEDTLS_GCM_ENCRYPT,
+                                        iv, iv_len, ad, ad_len ) ) != 0 ||
+            ( ret = cipher_update_iov_stream( ctx, &in, &out, ilen ) ) != 0 ||
+            ( ret = mbedtls_gcm_finish( ctx->cipher_ctx, tag, tag_len ) ) != 0 )
+        {
+            return( ret );
+        }
+
+        *olen = ilen;
+        return( 0 );
+    }
+#endif /* MBEDTLS_GCM_C */
+#if defined(MBEDTLS_CCM_C) && !defined(MBEDTLS_CCM_ALT)
+    if( MBEDTLS_MODE_CCM == ctx->cipher_info->mode )
+    {
+        *olen = ilen;
+        return( mbedtls_ccm_encrypt_and_tag_iov( ctx->cipher_ctx,
+                                     iv, iv_len, ad, ad_len,
+                                     src, src_count, dst, dst_count,
+                                     tag, tag_len ) );
+    }
+#endif /* MBEDTLS_CCM_C && !MBEDTLS_CCM_ALT */
+#if defined(MBEDTLS_CHACHAPOLY_C)
+    if ( MBEDTLS_CIPHER_CHACHA20_POLY1305 == ctx->cipher_info->type )
+    {
+        int ret;
+        mbedtls_cipher_iov_cursor in, out;
+
+        /* ChachaPoly has fixed length nonce and MAC (tag) */
+        if ( ( iv_len != ctx->cipher_info->iv_size ) ||
+             ( tag_len != 16U ) )
+        {
+            return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+        }
+
+        mbedtls_cipher_iov_cursor_init( &in, src, src_count );
+        mbedtls_cipher_iov_cursor_init( &out, dst, dst_count );
+
+        if( ( ret = mbedtls_chachapoly_starts( ctx->cipher_ctx, iv,
+                                    MBEDTLS_CHACHAPOLY_ENCRYPT ) ) != 0 ||
+            ( ret = mbedtls_chachapoly_update_aad( ctx->cipher_ctx,
+                                                   ad, ad_len ) ) != 0 ||
+            ( ret = cipher_update_iov_stream( ctx, &in, &out, ilen ) ) != 0 ||
+            ( ret = mbedtls_chachapoly_finish( ctx->cipher_ctx, tag ) ) != 0 )
+        {
+            return( ret );
+        }
+
+        *olen = ilen;
+        return( 0 );
+    }
+#endif /* MBEDTLS_CHACHAPOLY_C */
+
+    ((void) iv);
+    ((void) iv_len);
+    ((void) ad);
+    ((void) ad_len);
+    ((void) tag);
+    ((void) tag_len);
+    return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+}
+
+/*
+ * Packet-oriented decryption for AEAD modes, over segments
+ */
+int mbedtls_cipher_auth_decrypt_iov( mbedtls_cipher_context_t *ctx,
+                         const unsigned char *iv, size_t iv_len,
+                         const unsigned char *ad, size_t ad_len,
+                         const mbedtls_cipher_iov *src, size_t src_count,
+                         const mbedtls_cipher_iov *dst, size_t dst_count,
+                         size_t *olen,
+                         const unsigned char *tag, size_t tag_len )
+{
+    size_t ilen;
+
+    if( NULL == ctx || NULL == ctx->cipher_info || NULL == olen ||
+        ( NULL == src && 0 != src_count ) )
+    {
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+    }
+
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    if( ctx->psa_enabled == 1 )
+        return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+#endif /* MBEDTLS_USE_PSA_CRYPTO */
+
+    if( NULL == dst )
+    {
+        dst = src;
+        dst_count = src_count;
+    }
+
+    ilen = mbedtls_cipher_iov_len( src, src_count );
+    if( mbedtls_cipher_iov_len( dst, dst_count ) < ilen )
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+
+#if defined(MBEDTLS_GCM_C)
+    if( MBEDTLS_MODE_GCM == ctx->cipher_info->mode )
+    {
+        int ret;
+        unsigned char check_tag[16];
+        mbedtls_cipher_iov_cursor in, out;
+
+        if( tag_len > sizeof( check_tag ) )
+            return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+
+        mbedtls_cipher_iov_cursor_init( &in, src, src_count );
+        mbedtls_cipher_iov_cursor_init( &out, dst, dst_count );
+
+        if( ( ret = mbedtls_gcm_starts( ctx->cipher_ctx, MBEDTLS_GCM_DECRYPT,
+                                        iv, iv_len, ad, ad_len ) ) != 0 ||
+            ( ret = cipher_update_iov_stream( ctx, &in, &out, ilen ) ) != 0 ||
+            ( ret = mbedtls_gcm_finish( ctx->cipher_ctx,
+                                        check_tag, tag_len ) ) != 0 )
+        {
+            return( ret );
+        }
+
+        *olen = ilen;
+
+        /* Check the tag in "constant-time" */
+        if( mbedtls_constant_time_memcmp( tag, check_tag, tag_len ) != 0 )
+        {
+            mbedtls_cipher_iov_zeroize( dst, dst_count, ilen );
+            return( MBEDTLS_ERR_CIPHER_AUTH_FAILED );
+        }
+
+        return( 0 );
+    }
+#endif /* MBEDTLS_GCM_C */
+#if defined(MBEDTLS_CCM_C) && !defined(MBEDTLS_CCM_ALT)
+    if( MBEDTLS_MODE_CCM == ctx->cipher_info->mode )
+    {
+        int ret;
+
+        *olen = ilen;
+        ret = mbedtls_ccm_auth_decrypt_iov( ctx->cipher_ctx,
+                                iv, iv_len, ad, ad_len,
+                                src, src_count, dst, dst_count,
+                                tag, tag_len );
+
+        if( ret == MBEDTLS_ERR_CCM_AUTH_FAILED )
+            ret = MBEDTLS_ERR_CIPHER_AUTH_FAILED;
+
+        return( ret );
+    }
+#endif /* MBEDTLS_CCM_C && !MBEDTLS_CCM_ALT */
+#if defined(MBEDTLS_CHACHAPOLY_C)
+    if ( MBEDTLS_CIPHER_CHACHA20_POLY1305 == ctx->cipher_info->type )
+    {
+        int ret;
+        unsigned char check_tag[16];
+        mbedtls_cipher_iov_cursor in, out;
+
+        /* ChachaPoly has fixed length nonce and MAC (tag) */
+        if ( ( iv_len != ctx->cipher_info->iv_size ) ||
+             ( tag_len != 16U ) )
+        {
+            return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+        }
+
+        mbedtls_cipher_iov_cursor_init( &in, src, src_count );
+        mbedtls_cipher_iov_cursor_init( &out, dst, dst_count );
+
+        if( ( ret = mbedtls_chachapoly_starts( ctx->cipher_ctx, iv,
+                                    MBEDTLS_CHACHAPOLY_DECRYPT ) ) != 0 ||
+            ( ret = mbedtls_chachapoly_update_aad( ctx->cipher_ctx,
+                                                   ad, ad_len ) ) != 0 ||
+            ( ret = cipher_update_iov_stream( ctx, &in, &out, ilen ) ) != 0 ||
+            ( ret = mbedtls_chachapoly_finish( ctx->cipher_ctx,
+                                               check_tag ) ) != 0 )
+        {
+            return( ret );
+        }
+
+        *olen = ilen;
+
+        /* Check the tag in "constant-time" */
+        if( mbedtls_constant_time_memcmp( tag, check_tag, tag_len ) != 0 )
+        {
+            mbedtls_cipher_iov_zeroize( dst, dst_count, ilen );
+            return( MBEDTLS_ERR_CIPHER_AUTH_FAILED );
+        }
+
+        return( 0 );
+    }
+#endif /* MBEDTLS_CHACHAPOLY_C */
+
+    ((void) iv);
+    ((void) iv_len);
+    ((void) ad);
+    ((void) ad_len);
+    ((void) tag);
+    ((void) tag_len);
+    return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+}
 #endif /* MBEDTLS_CIPHER_MODE_AEAD */
 
 #endif /* MBEDTLS_CIPHER_C */
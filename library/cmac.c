@@ -49,8 +49,13 @@
 #if defined(MBEDTLS_CMAC_C)
 
 #include "mbedtls/cmac.h"
+#include "mbedtls/cipher_internal.h"
 #include "mbedtls/platform_util.h"
 
+#if defined(MBEDTLS_AES_C)
+#include "mbedtls/aes.h"
+#endif
+
 #include <string.h>
 
 
@@ -227,16 +232,23 @@ int mbedtls_cipher_cmac_starts( mbedtls_cipher_context_t *ctx,
     }
 
     /* Allocated and initialise in the cipher context memory for the CMAC
-     * context */
-    cmac_ctx = mbedtls_calloc( 1, sizeof( mbedtls_cmac_context_t ) );
-    if( cmac_ctx == NULL )
-        return( MBEDTLS_ERR_CIPHER_ALLOC_FAILED );
+     * context, unless a previous operation left one */
+    if( ctx->cmac_ctx == NULL )
+    {
+        cmac_ctx = mbedtls_calloc( 1, sizeof( mbedtls_cmac_context_t ) );
+        if( cmac_ctx == NULL )
+            return( MBEDTLS_ERR_CIPHER_ALLOC_FAILED );
 
-    ctx->cmac_ctx = cmac_ctx;
+        ctx->cmac_ctx = cmac_ctx;
+    }
+    else
+        cmac_ctx = ctx->cmac_ctx;
 
-    mbedtls_platform_zeroize( cmac_ctx->state, sizeof( cmac_ctx->state ) );
+    mbedtls_platform_zeroize( cmac_ctx, sizeof( mbedtls_cmac_context_t ) );
 
-    return 0;
+    /* The subkeys only depend on the key: derive them once for all the
+     * messages authenticated until the next call */
+    return( cmac_generate_subkeys( ctx, cmac_ctx->K1, cmac_ctx->K2 ) );
 }
 
 int mbedtls_cipher_cmac_update( mbedtls_cipher_context_t *ctx,
@@ -312,8 +324,6 @@ int mbedtls_cipher_cmac_finish( mbedtls_cipher_context_t *ctx,
 {
     mbedtls_cmac_context_t* cmac_ctx;
     unsigned char *state, *last_block;
-    unsigned char K1[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    unsigned char K2[MBEDTLS_CIPHER_BLKSIZE_MAX];
     unsigned char M_last[MBEDTLS_CIPHER_BLKSIZE_MAX];
     int ret;
     size_t olen, block_size;
@@ -326,22 +336,18 @@ int mbedtls_cipher_cmac_finish( mbedtls_cipher_context_t *ctx,
     block_size = ctx->cipher_info->block_size;
     state = cmac_ctx->state;
 
-    mbedtls_platform_zeroize( K1, sizeof( K1 ) );
-    mbedtls_platform_zeroize( K2, sizeof( K2 ) );
-    cmac_generate_subkeys( ctx, K1, K2 );
-
     last_block = cmac_ctx->unprocessed_block;
 
     /* Calculate last block */
     if( cmac_ctx->unprocessed_len < block_size )
     {
         cmac_pad( M_last, block_size, last_block, cmac_ctx->unprocessed_len );
-        cmac_xor_block( M_last, M_last, K2, block_size );
+        cmac_xor_block( M_last, M_last, cmac_ctx->K2, block_size );
     }
     else
     {
         /* Last block is complete block */
-        cmac_xor_block( M_last, last_block, K1, block_size );
+        cmac_xor_block( M_last, last_block, cmac_ctx->K1, block_size );
     }
 
 
@@ -355,10 +361,8 @@ int mbedtls_cipher_cmac_finish( mbedtls_cipher_context_t *ctx,
     memcpy( output, state, block_size );
 
 exit:
-    /* Wipe the generated keys on the stack, and any other transients to avoid
-     * side channel leakage */
-    mbedtls_platform_zeroize( K1, sizeof( K1 ) );
-    mbedtls_platform_zeroize( K2, sizeof( K2 ) );
+    /* Wipe the transients to avoid side channel leakage */
+    mbedtls_platform_zeroize( M_last, sizeof( M_last ) );
 
     cmac_ctx->unprocessed_len = 0;
     mbedtls_platform_zeroize( cmac_ctx->unprocessed_block,
@@ -387,6 +391,146 @@ int mbedtls_cipher_cmac_reset( mbedtls_cipher_context_t *ctx )
     return( 0 );
 }
 
+/* Number of messages authenticated side by side by mbedtls_cipher_cmac_multi */
+#define CMAC_LANES  8
+
+/*
+ * Encrypt n consecutive blocks in place, several at a time where the
+ * cipher supports it
+ */
+static int cmac_encrypt_blocks( mbedtls_cipher_context_t *ctx,
+                                unsigned char *buf, size_t n )
+{
+    int ret;
+    size_t i, olen, block_size = ctx->cipher_info->block_size;
+
+#if defined(MBEDTLS_AES_C)
+    int use_aes = ( ctx->cipher_info->base->cipher == MBEDTLS_CIPHER_ID_AES );
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    use_aes = use_aes && ctx->psa_enabled == 0;
+#endif
+    if( use_aes )
+        return( mbedtls_aes_encrypt_blocks( ctx->cipher_ctx, n, buf, buf ) );
+#endif /* MBEDTLS_AES_C */
+
+    for( i = 0; i < n; i++, buf += block_size )
+    {
+        if( ( ret = mbedtls_cipher_update( ctx, buf, block_size, buf,
+                                           &olen ) ) != 0 )
+            return( ret );
+    }
+
+    return( 0 );
+}
+
+int mbedtls_cipher_cmac_multi( mbedtls_cipher_context_t *ctx,
+                               const unsigned char * const input[],
+                               const size_t ilen[],
+                               unsigned char * const output[],
+                               size_t count )
+{
+    mbedtls_cmac_context_t *cmac_ctx;
+    unsigned char state[CMAC_LANES][MBEDTLS_CIPHER_BLKSIZE_MAX];
+    unsigned char buf[CMAC_LANES * MBEDTLS_CIPHER_BLKSIZE_MAX];
+    unsigned char M_last[MBEDTLS_CIPHER_BLKSIZE_MAX];
+    size_t nblocks[CMAC_LANES];
+    size_t lanes, lane, n, j, max_blocks, last_len, block_size;
+    const unsigned char *p;
+    int ret = 0;
+
+    if( ctx == NULL || ctx->cipher_info == NULL || ctx->cmac_ctx == NULL ||
+        ( count > 0 && ( input == NULL || ilen == NULL || output == NULL ) ) )
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+
+    cmac_ctx = ctx->cmac_ctx;
+    block_size = ctx->cipher_info->block_size;
+
+    for( ; count > 0; count -= lanes, input += lanes, ilen += lanes,
+                      output += lanes )
+    {
+        lanes = count < CMAC_LANES ? count : CMAC_LANES;
+        max_blocks = 0;
+
+        for( lane = 0; lane < lanes; lane++ )
+        {
+            if( input[lane] == NULL || output[lane] == NULL )
+            {
+                ret = MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA;
+                goto exit;
+            }
+
+            /* An empty message still has one (padded) block */
+            nblocks[lane] = ilen[lane] == 0 ? 1 :
+                            ( ilen[lane] + block_size - 1 ) / block_size;
+            if( nblocks[lane] > max_blocks )
+                max_blocks = nblocks[lane];
+        }
+
+        memset( state, 0, sizeof( state ) );
+
+        /*
+         * Step j chains block j of every message that has one: the inputs
+         * of the block cipher are packed into buf and encrypted together.
+         */
+        for( j = 0; j < max_blocks; j++ )
+        {
+            for( lane = 0, n = 0; lane < lanes; lane++ )
+            {
+                if( j >= nblocks[lane] )
+                    continue;
+
+                p = input[lane] + j * block_size;
+
+                if( j + 1 < nblocks[lane] )
+                {
+                    cmac_xor_block( buf + n * block_size, state[lane], p,
+                                    block_size );
+                }
+                else
+                {
+                    last_len = ilen[lane] - j * block_size;
+                    if( last_len == block_size )
+                    {
+                        cmac_xor_block( M_last, p, cmac_ctx->K1, block_size );
+                    }
+                    else
+                    {
+                        cmac_pad( M_last, block_size, p, last_len );
+                        cmac_xor_block( M_last, M_last, cmac_ctx->K2,
+                                        block_size );
+                    }
+                    cmac_xor_block( buf + n * block_size, state[lane], M_last,
+                                    block_size );
+                }
+
+                n++;
+            }
+
+            if( ( ret = cmac_encrypt_blocks( ctx, buf, n ) ) != 0 )
+                goto exit;
+
+            for( lane = 0, n = 0; lane < lanes; lane++ )
+            {
+                if( j >= nblocks[lane] )
+                    continue;
+
+                memcpy( state[lane], buf + n * block_size, block_size );
+                n++;
+            }
+        }
+
+        for( lane = 0; lane < lanes; lane++ )
+            memcpy( output[lane], state[lane], block_size );
+    }
+
+exit:
+    mbedtls_platform_zeroize( state, sizeof( state ) );
+    mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    mbedtls_platform_zeroize( M_last, sizeof( M_last ) );
+
+    return( ret );
+}
+
 int mbedtls_cipher_cmac( const mbedtls_cipher_info_t *cipher_info,
                          const unsigned char *key, size_t keylen,
                          const unsigned char *input, size_t ilen,
@@ -132,6 +132,7 @@ void mbedtls_ctr_drbg_free( mbedtls_ctr_drbg_context *ctx )
 #if defined(MBEDTLS_THREADING_C)
     mbedtls_mutex_free( &ctx->mutex );
 #endif
+    mbedtls_drbg_prefetch_free( &ctx->prefetch );
     mbedtls_aes_free( &ctx->aes_ctx );
     mbedtls_platform_zeroize( ctx, sizeof( mbedtls_ctr_drbg_context ) );
 }
@@ -151,6 +152,13 @@ void mbedtls_ctr_drbg_set_reseed_interval( mbedtls_ctr_drbg_context *ctx, int in
     ctx->reseed_interval = interval;
 }
 
+void mbedtls_ctr_drbg_set_prefetch( mbedtls_ctr_drbg_context *ctx,
+                                    unsigned char *buf, size_t len,
+                                    size_t watermark )
+{
+    mbedtls_drbg_prefetch_set( &ctx->prefetch, buf, len, watermark );
+}
+
 static int block_cipher_df( unsigned char *output,
                             const unsigned char *data, size_t data_len )
 {
@@ -338,6 +346,9 @@ void mbedtls_ctr_drbg_update( mbedtls_ctr_drbg_context *ctx,
 {
     unsigned char add_input[MBEDTLS_CTR_DRBG_SEEDLEN];
 
+    /* Output buffered before the update must not be handed out after it */
+    mbedtls_drbg_prefetch_discard( &ctx->prefetch );
+
     if( add_len > 0 )
     {
         /* MAX_INPUT would be more logical here, but we have to match
@@ -375,6 +386,9 @@ int mbedtls_ctr_drbg_reseed( mbedtls_ctr_drbg_context *ctx,
 
     memset( seed, 0, MBEDTLS_CTR_DRBG_MAX_SEED_INPUT );
 
+    /* Output buffered before the reseed must not be handed out after it */
+    mbedtls_drbg_prefetch_discard( &ctx->prefetch );
+
     /*
      * Gather entropy_len bytes of entropy to seed state
      */
@@ -476,6 +490,34 @@ int mbedtls_ctr_drbg_random_with_add( void *p_rng,
         }
     }
 
+    /*
+     * Whole blocks: write the counter values straight into the output and
+     * encrypt them there in a single multi-block call
+     */
+    if( output_len >= MBEDTLS_CTR_DRBG_BLOCKSIZE )
+    {
+        size_t j, nblocks = output_len / MBEDTLS_CTR_DRBG_BLOCKSIZE;
+
+        for( j = 0; j < nblocks; j++ )
+        {
+            for( i = MBEDTLS_CTR_DRBG_BLOCKSIZE; i > 0; i-- )
+                if( ++ctx->counter[i - 1] != 0 )
+                    break;
+
+            memcpy( p + j * MBEDTLS_CTR_DRBG_BLOCKSIZE, ctx->counter,
+                    MBEDTLS_CTR_DRBG_BLOCKSIZE );
+        }
+
+        if( ( ret = mbedtls_aes_encrypt_blocks( &ctx->aes_ctx, nblocks,
+                                                p, p ) ) != 0 )
+        {
+            return( ret );
+        }
+
+        p += nblocks * MBEDTLS_CTR_DRBG_BLOCKSIZE;
+        output_len -= nblocks * MBEDTLS_CTR_DRBG_BLOCKSIZE;
+    }
+
     while( output_len > 0 )
     {
         /*
@@ -513,6 +555,13 @@ int mbedtls_ctr_drbg_random_with_add( void *p_rng,
     return( 0 );
 }
 
+static int ctr_drbg_generate( void *p_rng, unsigned char *output,
+                              size_t output_len )
+{
+    return( mbedtls_ctr_drbg_random_with_add( p_rng, output, output_len,
+                                              NULL, 0 ) );
+}
+
 int mbedtls_ctr_drbg_random( void *p_rng, unsigned char *output, size_t output_len )
 {
     int ret;
@@ -523,7 +572,52 @@ int mbedtls_ctr_drbg_random( void *p_rng, unsigned char *output, size_t output_l
         return( ret );
 #endif
 
-    ret = mbedtls_ctr_drbg_random_with_add( ctx, output, output_len, NULL, 0 );
+    if( ctx->prefetch.buf != NULL && output_len <= ctx->prefetch.len &&
+        ctx->prediction_resistance == MBEDTLS_CTR_DRBG_PR_OFF )
+        ret = mbedtls_drbg_prefetch_random( &ctx->prefetch, ctr_drbg_generate,
+                                            ctx, MBEDTLS_CTR_DRBG_MAX_REQUEST,
+                                            output, output_len );
+    else
+        ret = mbedtls_ctr_drbg_random_with_add( ctx, output, output_len,
+                                                NULL, 0 );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+#endif
+
+    return( ret );
+}
+
+/*
+ * Requests of any size, split into generate calls of at most
+ * MBEDTLS_CTR_DRBG_MAX_REQUEST bytes, under a single lock
+ */
+int mbedtls_ctr_drbg_random_bulk( void *p_rng, unsigned char *output,
+                                  size_t output_len )
+{
+    int ret = 0;
+    mbedtls_ctr_drbg_context *ctx = (mbedtls_ctr_drbg_context *) p_rng;
+    size_t use_len;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
+        return( ret );
+#endif
+
+    while( output_len > 0 )
+    {
+        use_len = ( output_len > MBEDTLS_CTR_DRBG_MAX_REQUEST ) ?
+                  MBEDTLS_CTR_DRBG_MAX_REQUEST : output_len;
+
+        ret = mbedtls_ctr_drbg_random_with_add( ctx, output, use_len,
+                                                NULL, 0 );
+        if( ret != 0 )
+            break;
+
+        output += use_len;
+        output_len -= use_len;
+    }
 
 #if defined(MBEDTLS_THREADING_C)
     if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
@@ -312,7 +312,8 @@ cleanup:
  *  Berlin Heidelberg, 1996. p. 104-113.
  */
 static int dhm_update_blinding( mbedtls_dhm_context *ctx,
-                    int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+                    int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                    mbedtls_mpi_arena *arena )
 {
     int ret, count;
 
@@ -336,10 +337,12 @@ static int dhm_update_blinding( mbedtls_dhm_context *ctx,
     if( mbedtls_mpi_cmp_int( &ctx->Vi, 1 ) != 0 )
     {
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->Vi, &ctx->Vi, &ctx->Vi ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->Vi, &ctx->Vi, &ctx->P ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &ctx->Vi, &ctx->Vi, &ctx->P,
+                                                    arena ) );
 
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->Vf, &ctx->Vf, &ctx->Vf ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->Vf, &ctx->Vf, &ctx->P ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &ctx->Vf, &ctx->Vf, &ctx->P,
+                                                    arena ) );
 
         return( 0 );
     }
@@ -364,7 +367,8 @@ static int dhm_update_blinding( mbedtls_dhm_context *ctx,
 
     /* Vf = Vi^-X mod P */
     MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &ctx->Vf, &ctx->Vi, &ctx->P ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->Vf, &ctx->Vf, &ctx->X, &ctx->P, &ctx->RP ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_arena( &ctx->Vf, &ctx->Vf, &ctx->X,
+                                                &ctx->P, &ctx->RP, arena ) );
 
 cleanup:
     return( ret );
@@ -380,6 +384,7 @@ int mbedtls_dhm_calc_secret( mbedtls_dhm_context *ctx,
 {
     int ret;
     mbedtls_mpi GYb;
+    mbedtls_mpi_arena arena;
 
     if( ctx == NULL || output_size < ctx->len )
         return( MBEDTLS_ERR_DHM_BAD_INPUT_DATA );
@@ -388,26 +393,29 @@ int mbedtls_dhm_calc_secret( mbedtls_dhm_context *ctx,
         return( ret );
 
     mbedtls_mpi_init( &GYb );
+    mbedtls_mpi_arena_init( &arena );
 
     /* Blind peer's value */
     if( f_rng != NULL )
     {
-        MBEDTLS_MPI_CHK( dhm_update_blinding( ctx, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( dhm_update_blinding( ctx, f_rng, p_rng, &arena ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &GYb, &ctx->GY, &ctx->Vi ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &GYb, &GYb, &ctx->P ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &GYb, &GYb, &ctx->P,
+                                                    &arena ) );
     }
     else
         MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &GYb, &ctx->GY ) );
 
     /* Do modular exponentiation */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->K, &GYb, &ctx->X,
-                          &ctx->P, &ctx->RP ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_arena( &ctx->K, &GYb, &ctx->X,
+                          &ctx->P, &ctx->RP, &arena ) );
 
     /* Unblind secret value */
     if( f_rng != NULL )
     {
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->K, &ctx->K, &ctx->Vf ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->K, &ctx->K, &ctx->P ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &ctx->K, &ctx->K, &ctx->P,
+                                                    &arena ) );
     }
 
     *olen = mbedtls_mpi_size( &ctx->K );
@@ -416,6 +424,7 @@ int mbedtls_dhm_calc_secret( mbedtls_dhm_context *ctx,
 
 cleanup:
     mbedtls_mpi_free( &GYb );
+    mbedtls_mpi_arena_free( &arena );
 
     if( ret != 0 )
         return( MBEDTLS_ERR_DHM_CALC_SECRET_FAILED + ret );
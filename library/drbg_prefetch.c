@@ -0,0 +1,111 @@
+/*
+ *  Prefetch buffer shared by CTR_DRBG and HMAC_DRBG
+ *
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_CTR_DRBG_C) || defined(MBEDTLS_HMAC_DRBG_C)
+
+#include "mbedtls/drbg_prefetch.h"
+#include "mbedtls/platform_util.h"
+
+#include <string.h>
+
+void mbedtls_drbg_prefetch_discard( mbedtls_drbg_prefetch *pf )
+{
+    if( pf->buf == NULL )
+        return;
+
+    mbedtls_platform_zeroize( pf->buf + pf->pos, pf->len - pf->pos );
+    pf->pos = pf->len;
+}
+
+void mbedtls_drbg_prefetch_set( mbedtls_drbg_prefetch *pf,
+                                unsigned char *buf, size_t len,
+                                size_t watermark )
+{
+    mbedtls_drbg_prefetch_discard( pf );
+
+    if( buf == NULL )
+        len = 0;
+
+    pf->buf = ( len != 0 ) ? buf : NULL;
+    pf->len = len;
+    pf->pos = len;
+    pf->low = ( watermark < len ) ? watermark : len;
+}
+
+int mbedtls_drbg_prefetch_random( mbedtls_drbg_prefetch *pf,
+                                  int (*f_generate)( void *, unsigned char *,
+                                                     size_t ),
+                                  void *p_generate, size_t max_request,
+                                  unsigned char *output, size_t len )
+{
+    int ret = 0;
+    unsigned char *buf = pf->buf;
+    size_t avail = pf->len - pf->pos;
+    size_t fill, use_len;
+
+    if( avail < len || avail < pf->low )
+    {
+        memmove( buf, buf + pf->pos, avail );
+
+        /* Detach the buffer, so that an automatic reseed during the refill
+         * does not discard it */
+        pf->buf = NULL;
+        for( fill = avail; fill < pf->len; fill += use_len )
+        {
+            use_len = pf->len - fill;
+            if( use_len > max_request )
+                use_len = max_request;
+
+            if( ( ret = f_generate( p_generate, buf + fill, use_len ) ) != 0 )
+                break;
+        }
+        pf->buf = buf;
+
+        if( ret != 0 )
+        {
+            mbedtls_platform_zeroize( buf, pf->len );
+            pf->pos = pf->len;
+            return( ret );
+        }
+
+        pf->pos = 0;
+    }
+
+    memcpy( output, buf + pf->pos, len );
+    mbedtls_platform_zeroize( buf + pf->pos, len );
+    pf->pos += len;
+
+    return( 0 );
+}
+
+void mbedtls_drbg_prefetch_free( mbedtls_drbg_prefetch *pf )
+{
+    if( pf->buf != NULL )
+        mbedtls_platform_zeroize( pf->buf, pf->len );
+}
+
+#endif /* MBEDTLS_CTR_DRBG_C || MBEDTLS_HMAC_DRBG_C */
@@ -36,6 +36,10 @@
 #include "mbedtls/ecdsa.h"
 #include "mbedtls/asn1write.h"
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+#include "mbedtls/platform_util.h"
+#endif
+
 #include <string.h>
 
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC)
@@ -460,6 +464,385 @@ int mbedtls_ecdsa_sign_det( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi
 }
 #endif /* MBEDTLS_ECDSA_DETERMINISTIC */
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+static int ecdsa_pool_lock( mbedtls_ecdsa_nonce_pool *pool )
+{
+#if defined(MBEDTLS_THREADING_C)
+    return( mbedtls_mutex_lock( &pool->mutex ) );
+#else
+    (void) pool;
+    return( 0 );
+#endif
+}
+
+static int ecdsa_pool_unlock( mbedtls_ecdsa_nonce_pool *pool )
+{
+#if defined(MBEDTLS_THREADING_C)
+    return( mbedtls_mutex_unlock( &pool->mutex ) );
+#else
+    (void) pool;
+    return( 0 );
+#endif
+}
+
+void mbedtls_ecdsa_nonce_pool_init( mbedtls_ecdsa_nonce_pool *pool )
+{
+    memset( pool, 0, sizeof( mbedtls_ecdsa_nonce_pool ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_init( &pool->mutex );
+#endif
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    pthread_mutex_init( &pool->refill_mutex, NULL );
+    pthread_cond_init( &pool->refill_cond, NULL );
+#endif
+}
+
+int mbedtls_ecdsa_nonce_pool_setup( mbedtls_ecdsa_nonce_pool *pool,
+                                    mbedtls_ecp_group_id gid,
+                                    size_t size, size_t low,
+                                    int (*f_rng)(void *, unsigned char *, size_t),
+                                    void *p_rng )
+{
+    size_t i;
+
+    /* Only curves that can be used for ECDSA have curve info */
+    if( mbedtls_ecp_curve_info_from_grp_id( gid ) == NULL || size == 0 ||
+        pool->size != 0 )
+    {
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+    }
+
+    pool->r = mbedtls_calloc( size, sizeof( mbedtls_mpi ) );
+    pool->k_inv = mbedtls_calloc( size, sizeof( mbedtls_mpi ) );
+    if( pool->r == NULL || pool->k_inv == NULL )
+    {
+        mbedtls_free( pool->r );
+        mbedtls_free( pool->k_inv );
+        pool->r = NULL;
+        pool->k_inv = NULL;
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+    }
+
+    for( i = 0; i < size; i++ )
+    {
+        mbedtls_mpi_init( &pool->r[i] );
+        mbedtls_mpi_init( &pool->k_inv[i] );
+    }
+
+    pool->grp_id = gid;
+    pool->size = size;
+    pool->count = 0;
+    pool->low = ( low < size ) ? low : size;
+    pool->f_rng = f_rng;
+    pool->p_rng = p_rng;
+
+    return( 0 );
+}
+
+/*
+ * Compute the message-independent part of a signature (SEC1 4.1.3 steps
+ * 1-3): r = xR mod n for R = k G, and k^-1 mod n, with the inversion
+ * blinded as in ecdsa_sign_restartable()
+ */
+static int ecdsa_nonce_compute( mbedtls_ecp_group *grp,
+                                mbedtls_mpi *r, mbedtls_mpi *k_inv,
+                                int (*f_rng)(void *, unsigned char *, size_t),
+                                void *p_rng )
+{
+    int ret, key_tries = 0;
+    mbedtls_ecp_point R;
+    mbedtls_mpi k, t;
+
+    mbedtls_ecp_point_init( &R );
+    mbedtls_mpi_init( &k ); mbedtls_mpi_init( &t );
+
+    do
+    {
+        if( key_tries++ > 10 )
+        {
+            ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+            goto cleanup;
+        }
+
+        MBEDTLS_MPI_CHK( mbedtls_ecp_gen_privkey( grp, &k, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_mul( grp, &R, &k, &grp->G,
+                                          f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( r, &R.X, &grp->N ) );
+    }
+    while( mbedtls_mpi_cmp_int( r, 0 ) == 0 );
+
+    /* k^-1 = t / (k t) mod n */
+    MBEDTLS_MPI_CHK( mbedtls_ecp_gen_privkey( grp, &t, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &k, &k, &t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( k_inv, &k, &grp->N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( k_inv, k_inv, &t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( k_inv, k_inv, &grp->N ) );
+
+cleanup:
+    mbedtls_ecp_point_free( &R );
+    mbedtls_mpi_free( &k ); mbedtls_mpi_free( &t );
+
+    return( ret );
+}
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+static int ecdsa_pool_thread_running( mbedtls_ecdsa_nonce_pool *pool )
+{
+    int running;
+
+    pthread_mutex_lock( &pool->refill_mutex );
+    running = pool->refill_running;
+    pthread_mutex_unlock( &pool->refill_mutex );
+
+    return( running );
+}
+#endif
+
+/*
+ * Add entries until the pool is full, or until the background thread is
+ * stopped if called from that thread
+ */
+static int ecdsa_nonce_pool_fill( mbedtls_ecdsa_nonce_pool *pool,
+                                  int from_thread )
+{
+    int ret, full;
+    mbedtls_ecp_group grp;
+    mbedtls_mpi r, k_inv;
+
+    if( pool->size == 0 )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    mbedtls_ecp_group_init( &grp );
+    mbedtls_mpi_init( &r ); mbedtls_mpi_init( &k_inv );
+
+    /* A private copy of the group, so that refills can run concurrently */
+    MBEDTLS_MPI_CHK( mbedtls_ecp_group_load( &grp, pool->grp_id ) );
+
+    MBEDTLS_MPI_CHK( ecdsa_pool_lock( pool ) );
+    full = ( pool->count == pool->size );
+    MBEDTLS_MPI_CHK( ecdsa_pool_unlock( pool ) );
+
+    while( ! full )
+    {
+#if defined(MBEDTLS_THREADING_PTHREAD)
+        if( from_thread && ! ecdsa_pool_thread_running( pool ) )
+            break;
+#else
+        (void) from_thread;
+#endif
+
+        /* Computed without holding the lock, which signatures need */
+        MBEDTLS_MPI_CHK( ecdsa_nonce_compute( &grp, &r, &k_inv,
+                                              pool->f_rng, pool->p_rng ) );
+
+        MBEDTLS_MPI_CHK( ecdsa_pool_lock( pool ) );
+        if( pool->count < pool->size )
+        {
+            mbedtls_mpi_swap( &pool->r[pool->count], &r );
+            mbedtls_mpi_swap( &pool->k_inv[pool->count], &k_inv );
+            pool->count++;
+        }
+        full = ( pool->count == pool->size );
+        MBEDTLS_MPI_CHK( ecdsa_pool_unlock( pool ) );
+    }
+
+cleanup:
+    mbedtls_ecp_group_free( &grp );
+    mbedtls_mpi_free( &r ); mbedtls_mpi_free( &k_inv );
+
+    return( ret );
+}
+
+int mbedtls_ecdsa_nonce_pool_refill( mbedtls_ecdsa_nonce_pool *pool )
+{
+    return( ecdsa_nonce_pool_fill( pool, 0 ) );
+}
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+/*
+ * Background refill: fill the pool, then wait until a signature takes it
+ * below the watermark or the thread is stopped
+ */
+static void ecdsa_nonce_pool_thread( void *data )
+{
+    mbedtls_ecdsa_nonce_pool *pool = (mbedtls_ecdsa_nonce_pool *) data;
+
+    pthread_mutex_lock( &pool->refill_mutex );
+
+    while( pool->refill_running )
+    {
+        pool->refill_wanted = 0;
+        pthread_mutex_unlock( &pool->refill_mutex );
+
+        /* Failures are left for mbedtls_ecdsa_sign_pool() to handle */
+        (void) ecdsa_nonce_pool_fill( pool, 1 );
+
+        pthread_mutex_lock( &pool->refill_mutex );
+        while( pool->refill_running && ! pool->refill_wanted )
+            pthread_cond_wait( &pool->refill_cond, &pool->refill_mutex );
+    }
+
+    pthread_mutex_unlock( &pool->refill_mutex );
+}
+
+int mbedtls_ecdsa_nonce_pool_thread_start( mbedtls_ecdsa_nonce_pool *pool )
+{
+    int ret = 0;
+
+    if( pool->size == 0 )
+        return( MBEDTLS_ERR_THREADING_BAD_INPUT_DATA );
+
+    pthread_mutex_lock( &pool->refill_mutex );
+
+    if( pool->refill_running )
+        ret = MBEDTLS_ERR_THREADING_BAD_INPUT_DATA;
+    else
+    {
+        pool->refill_running = 1;
+        if( ( ret = mbedtls_threading_thread_create( &pool->refill_thread,
+                                        ecdsa_nonce_pool_thread, pool ) ) != 0 )
+            pool->refill_running = 0;
+    }
+
+    pthread_mutex_unlock( &pool->refill_mutex );
+
+    return( ret );
+}
+
+void mbedtls_ecdsa_nonce_pool_thread_stop( mbedtls_ecdsa_nonce_pool *pool )
+{
+    pthread_mutex_lock( &pool->refill_mutex );
+
+    if( ! pool->refill_running )
+    {
+        pthread_mutex_unlock( &pool->refill_mutex );
+        return;
+    }
+
+    pool->refill_running = 0;
+    pthread_cond_signal( &pool->refill_cond );
+    pthread_mutex_unlock( &pool->refill_mutex );
+
+    mbedtls_threading_thread_join( &pool->refill_thread );
+}
+
+static void ecdsa_pool_thread_wake( mbedtls_ecdsa_nonce_pool *pool )
+{
+    pthread_mutex_lock( &pool->refill_mutex );
+    if( pool->refill_running )
+    {
+        pool->refill_wanted = 1;
+        pthread_cond_signal( &pool->refill_cond );
+    }
+    pthread_mutex_unlock( &pool->refill_mutex );
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
+void mbedtls_ecdsa_nonce_pool_free( mbedtls_ecdsa_nonce_pool *pool )
+{
+    size_t i;
+
+    if( pool == NULL )
+        return;
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    mbedtls_ecdsa_nonce_pool_thread_stop( pool );
+    pthread_cond_destroy( &pool->refill_cond );
+    pthread_mutex_destroy( &pool->refill_mutex );
+#endif
+
+    /* mbedtls_mpi_free() erases the unused entries */
+    for( i = 0; i < pool->size; i++ )
+    {
+        mbedtls_mpi_free( &pool->r[i] );
+        mbedtls_mpi_free( &pool->k_inv[i] );
+    }
+    mbedtls_free( pool->r );
+    mbedtls_free( pool->k_inv );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &pool->mutex );
+#endif
+
+    mbedtls_platform_zeroize( pool, sizeof( mbedtls_ecdsa_nonce_pool ) );
+}
+
+/*
+ * Compute ECDSA signature of a hashed message with a precomputed nonce:
+ * s = k^-1 (e + r d) mod n (SEC1 4.1.3 steps 5-6)
+ */
+int mbedtls_ecdsa_sign_pool( mbedtls_ecp_group *grp,
+                             mbedtls_mpi *r, mbedtls_mpi *s,
+                             const mbedtls_mpi *d,
+                             const unsigned char *buf, size_t blen,
+                             mbedtls_ecdsa_nonce_pool *pool,
+                             int (*f_rng)(void *, unsigned char *, size_t),
+                             void *p_rng )
+{
+    int ret, found = 0, wake = 0;
+    mbedtls_mpi e, pr, k_inv;
+
+    if( pool == NULL )
+        return( mbedtls_ecdsa_sign( grp, r, s, d, buf, blen, f_rng, p_rng ) );
+
+    /* Fail cleanly on curves such as Curve25519 that can't be used for ECDSA */
+    if( grp->N.p == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    /* Make sure d is in range 1..n-1 */
+    if( mbedtls_mpi_cmp_int( d, 1 ) < 0 || mbedtls_mpi_cmp_mpi( d, &grp->N ) >= 0 )
+        return( MBEDTLS_ERR_ECP_INVALID_KEY );
+
+    mbedtls_mpi_init( &e ); mbedtls_mpi_init( &pr ); mbedtls_mpi_init( &k_inv );
+
+    /* Take the last entry, leaving an empty slot */
+    MBEDTLS_MPI_CHK( ecdsa_pool_lock( pool ) );
+    if( pool->count > 0 && pool->grp_id == grp->id )
+    {
+        pool->count--;
+        mbedtls_mpi_swap( &pr, &pool->r[pool->count] );
+        mbedtls_mpi_swap( &k_inv, &pool->k_inv[pool->count] );
+        pool->hits++;
+        found = 1;
+    }
+    else
+        pool->misses++;
+    wake = ( pool->count < pool->low );
+    MBEDTLS_MPI_CHK( ecdsa_pool_unlock( pool ) );
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    if( wake )
+        ecdsa_pool_thread_wake( pool );
+#else
+    (void) wake;
+#endif
+
+    if( found )
+    {
+        MBEDTLS_MPI_CHK( derive_mpi( grp, &e, buf, blen ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, &pr, d ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &e, &e, s ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, &e, &k_inv ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( s, s, &grp->N ) );
+    }
+
+    /* Without an entry, or in the unlikely case that s = 0, use a new k */
+    if( ! found || mbedtls_mpi_cmp_int( s, 0 ) == 0 )
+    {
+        ret = mbedtls_ecdsa_sign( grp, r, s, d, buf, blen, f_rng, p_rng );
+        goto cleanup;
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( r, &pr ) );
+
+cleanup:
+    mbedtls_mpi_free( &e ); mbedtls_mpi_free( &pr ); mbedtls_mpi_free( &k_inv );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
+
 #if !defined(MBEDTLS_ECDSA_VERIFY_ALT)
 /*
  * Verify ECDSA signature of hashed message (SEC1 4.1.4)
@@ -468,6 +851,7 @@ int mbedtls_ecdsa_sign_det( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi
 static int ecdsa_verify_restartable( mbedtls_ecp_group *grp,
                                      const unsigned char *buf, size_t blen,
                                      const mbedtls_ecp_point *Q,
+                                     mbedtls_ecp_precomp *precomp,
                                      const mbedtls_mpi *r, const mbedtls_mpi *s,
                                      mbedtls_ecdsa_restart_ctx *rs_ctx )
 {
@@ -536,6 +920,14 @@ muladd:
     /*
      * Step 5: R = u1 G + u2 Q
      */
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+    if( precomp != NULL && rs_ctx == NULL )
+        MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_precomp( grp,
+                         &R, pu1, &grp->G, pu2, Q, precomp ) );
+    else
+#else
+    (void) precomp;
+#endif
     MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_restartable( grp,
                      &R, pu1, &grp->G, pu2, Q, ECDSA_RS_ECP ) );
 
@@ -577,10 +969,27 @@ int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
                   const unsigned char *buf, size_t blen,
                   const mbedtls_ecp_point *Q, const mbedtls_mpi *r, const mbedtls_mpi *s)
 {
-    return( ecdsa_verify_restartable( grp, buf, blen, Q, r, s, NULL ) );
+    return( ecdsa_verify_restartable( grp, buf, blen, Q, NULL, r, s, NULL ) );
 }
 #endif /* !MBEDTLS_ECDSA_VERIFY_ALT */
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+/*
+ * Verify ECDSA signature of hashed message with the key of a context
+ */
+int mbedtls_ecdsa_verify_precomp( mbedtls_ecdsa_context *ctx,
+                                  const unsigned char *buf, size_t blen,
+                                  const mbedtls_mpi *r, const mbedtls_mpi *s )
+{
+#if defined(MBEDTLS_ECDSA_VERIFY_ALT)
+    return( mbedtls_ecdsa_verify( &ctx->grp, buf, blen, &ctx->Q, r, s ) );
+#else
+    return( ecdsa_verify_restartable( &ctx->grp, buf, blen, &ctx->Q,
+                                      ctx->precomp, r, s, NULL ) );
+#endif
+}
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
+
 /*
  * Convert a signature (given by context) to ASN.1
  */
@@ -727,9 +1136,15 @@ int mbedtls_ecdsa_read_signature_restartable( mbedtls_ecdsa_context *ctx,
                                       &ctx->Q, &r, &s ) ) != 0 )
         goto cleanup;
 #else
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
     if( ( ret = ecdsa_verify_restartable( &ctx->grp, hash, hlen,
-                              &ctx->Q, &r, &s, rs_ctx ) ) != 0 )
+                              &ctx->Q, ctx->precomp, &r, &s, rs_ctx ) ) != 0 )
         goto cleanup;
+#else
+    if( ( ret = ecdsa_verify_restartable( &ctx->grp, hash, hlen,
+                              &ctx->Q, NULL, &r, &s, rs_ctx ) ) != 0 )
+        goto cleanup;
+#endif
 #endif /* MBEDTLS_ECDSA_VERIFY_ALT */
 
     /* At this point we know that the buffer starts with a valid signature.
@@ -69,6 +69,14 @@
 
 #include "mbedtls/ecp_internal.h"
 
+#if defined(MBEDTLS_ECP_P256_C)
+#include "mbedtls/ecp_p256.h"
+#endif
+
+#if defined(MBEDTLS_ECP_X25519_C)
+#include "mbedtls/ecp_x25519.h"
+#endif
+
 #if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
     !defined(inline) && !defined(__cplusplus)
 #define inline __inline
@@ -541,6 +549,9 @@ void mbedtls_ecp_keypair_init( mbedtls_ecp_keypair *key )
     mbedtls_ecp_group_init( &key->grp );
     mbedtls_mpi_init( &key->d );
     mbedtls_ecp_point_init( &key->Q );
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+    key->precomp = NULL;
+#endif
 }
 
 /*
@@ -556,6 +567,21 @@ void mbedtls_ecp_point_free( mbedtls_ecp_point *pt )
     mbedtls_mpi_free( &( pt->Z ) );
 }
 
+/*
+ * Tell if the comb table of a group is one of the static tables of
+ * ecp_curves.c, shared by all the groups of that curve: these have
+ * T != NULL and T_size == 0
+ */
+static int ecp_group_is_static_comb_table( const mbedtls_ecp_group *grp )
+{
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+    return( grp->T != NULL && grp->T_size == 0 );
+#else
+    (void) grp;
+    return( 0 );
+#endif
+}
+
 /*
  * Unallocate (the components of) a group
  */
@@ -575,7 +601,7 @@ void mbedtls_ecp_group_free( mbedtls_ecp_group *grp )
         mbedtls_mpi_free( &grp->N );
     }
 
-    if( grp->T != NULL )
+    if( grp->T != NULL && ! ecp_group_is_static_comb_table( grp ) )
     {
         for( i = 0; i < grp->T_size; i++ )
             mbedtls_ecp_point_free( &grp->T[i] );
@@ -585,6 +611,28 @@ void mbedtls_ecp_group_free( mbedtls_ecp_group *grp )
     mbedtls_platform_zeroize( grp, sizeof( mbedtls_ecp_group ) );
 }
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+/*
+ * Unallocate a table of mbedtls_ecp_keypair_precompute()
+ */
+static void ecp_precomp_free( mbedtls_ecp_precomp *precomp )
+{
+    size_t i;
+
+    if( precomp == NULL )
+        return;
+
+    if( precomp->T != NULL )
+    {
+        for( i = 0; i < precomp->T_size; i++ )
+            mbedtls_ecp_point_free( &precomp->T[i] );
+        mbedtls_free( precomp->T );
+    }
+
+    mbedtls_free( precomp );
+}
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
+
 /*
  * Unallocate (the components of) a key pair
  */
@@ -596,6 +644,10 @@ void mbedtls_ecp_keypair_free( mbedtls_ecp_keypair *key )
     mbedtls_ecp_group_free( &key->grp );
     mbedtls_mpi_free( &key->d );
     mbedtls_ecp_point_free( &key->Q );
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+    ecp_precomp_free( key->precomp );
+    key->precomp = NULL;
+#endif
 }
 
 /*
@@ -901,12 +953,13 @@ int mbedtls_ecp_tls_write_group( const mbedtls_ecp_group *grp, size_t *olen,
  *
  * This function is in the critial loop for mbedtls_ecp_mul, so pay attention to perf.
  */
-static int ecp_modp( mbedtls_mpi *N, const mbedtls_ecp_group *grp )
+static int ecp_modp( mbedtls_mpi *N, const mbedtls_ecp_group *grp,
+                     mbedtls_mpi_arena *ar )
 {
     int ret;
 
     if( grp->modp == NULL )
-        return( mbedtls_mpi_mod_mpi( N, N, &grp->P ) );
+        return( mbedtls_mpi_mod_mpi_arena( N, N, &grp->P, ar ) );
 
     /* N->s < 0 is a much faster test, which fails only if N is 0 */
     if( ( N->s < 0 && mbedtls_mpi_cmp_int( N, 0 ) != 0 ) ||
@@ -948,25 +1001,25 @@ cleanup:
 #define INC_MUL_COUNT
 #endif
 
-#define MOD_MUL( N )    do { MBEDTLS_MPI_CHK( ecp_modp( &N, grp ) ); INC_MUL_COUNT } \
-                        while( 0 )
+#define MOD_MUL( N )    do { MBEDTLS_MPI_CHK( ecp_modp( &( N ), grp, ar ) ); \
+                             INC_MUL_COUNT } while( 0 )
 
 /*
  * Reduce a mbedtls_mpi mod p in-place, to use after mbedtls_mpi_sub_mpi
  * N->s < 0 is a very fast test, which fails only if N is 0
  */
-#define MOD_SUB( N )                                \
-    while( N.s < 0 && mbedtls_mpi_cmp_int( &N, 0 ) != 0 )   \
-        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &N, &N, &grp->P ) )
+#define MOD_SUB( N )                                                    \
+    while( ( N ).s < 0 && mbedtls_mpi_cmp_int( &( N ), 0 ) != 0 )       \
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &( N ), &( N ), &grp->P ) )
 
 /*
  * Reduce a mbedtls_mpi mod p in-place, to use after mbedtls_mpi_add_mpi and mbedtls_mpi_mul_int.
  * We known P, N and the result are positive, so sub_abs is correct, and
  * a bit faster.
  */
-#define MOD_ADD( N )                                \
-    while( mbedtls_mpi_cmp_mpi( &N, &grp->P ) >= 0 )        \
-        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_abs( &N, &N, &grp->P ) )
+#define MOD_ADD( N )                                                    \
+    while( mbedtls_mpi_cmp_mpi( &( N ), &grp->P ) >= 0 )                \
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_abs( &( N ), &( N ), &grp->P ) )
 
 #if defined(ECP_SHORTWEIERSTRASS)
 /*
@@ -981,10 +1034,12 @@ cleanup:
  * Normalize jacobian coordinates so that Z == 0 || Z == 1  (GECC 3.2.1)
  * Cost: 1N := 1I + 3M + 1S
  */
-static int ecp_normalize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt )
+static int ecp_normalize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt,
+                              mbedtls_mpi_arena *ar )
 {
     int ret;
-    mbedtls_mpi Zi, ZZi;
+    size_t mark = mbedtls_mpi_arena_mark( ar );
+    mbedtls_mpi *Zi, *ZZi;
 
     if( mbedtls_mpi_cmp_int( &pt->Z, 0 ) == 0 )
         return( 0 );
@@ -994,20 +1049,21 @@ static int ecp_normalize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *p
         return( mbedtls_internal_ecp_normalize_jac( grp, pt ) );
 #endif /* MBEDTLS_ECP_NORMALIZE_JAC_ALT */
 
-    mbedtls_mpi_init( &Zi ); mbedtls_mpi_init( &ZZi );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &Zi ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &ZZi ) );
 
     /*
      * X = X / Z^2  mod p
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &Zi,      &pt->Z,     &grp->P ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ZZi,     &Zi,        &Zi     ) ); MOD_MUL( ZZi );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->X,   &pt->X,     &ZZi    ) ); MOD_MUL( pt->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( Zi,       &pt->Z,     &grp->P ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( ZZi,      Zi,         Zi      ) ); MOD_MUL( *ZZi );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->X,   &pt->X,     ZZi     ) ); MOD_MUL( pt->X );
 
     /*
      * Y = Y / Z^3  mod p
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     &ZZi    ) ); MOD_MUL( pt->Y );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     &Zi     ) ); MOD_MUL( pt->Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     ZZi     ) ); MOD_MUL( pt->Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     Zi      ) ); MOD_MUL( pt->Y );
 
     /*
      * Z = 1
@@ -1016,7 +1072,7 @@ static int ecp_normalize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *p
 
 cleanup:
 
-    mbedtls_mpi_free( &Zi ); mbedtls_mpi_free( &ZZi );
+    mbedtls_mpi_arena_release( ar, mark );
 
     return( ret );
 }
@@ -1033,14 +1089,15 @@ cleanup:
  * Cost: 1N(t) := 1I + (6t - 3)M + 1S
  */
 static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
-                                   mbedtls_ecp_point *T[], size_t T_size )
+                                   mbedtls_ecp_point *T[], size_t T_size,
+                                   mbedtls_mpi_arena *ar )
 {
     int ret;
-    size_t i;
-    mbedtls_mpi *c, u, Zi, ZZi;
+    size_t i, mark = mbedtls_mpi_arena_mark( ar );
+    mbedtls_mpi *c, *u, *Zi, *ZZi;
 
     if( T_size < 2 )
-        return( ecp_normalize_jac( grp, *T ) );
+        return( ecp_normalize_jac( grp, *T, ar ) );
 
 #if defined(MBEDTLS_ECP_NORMALIZE_JAC_MANY_ALT)
     if( mbedtls_internal_ecp_grp_capable( grp ) )
@@ -1053,7 +1110,9 @@ static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
     for( i = 0; i < T_size; i++ )
         mbedtls_mpi_init( &c[i] );
 
-    mbedtls_mpi_init( &u ); mbedtls_mpi_init( &Zi ); mbedtls_mpi_init( &ZZi );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &u ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &Zi ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &ZZi ) );
 
     /*
      * c[i] = Z_0 * ... * Z_i
@@ -1068,7 +1127,7 @@ static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
     /*
      * u = 1 / (Z_0 * ... * Z_n) mod P
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &u, &c[T_size-1], &grp->P ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( u, &c[T_size-1], &grp->P ) );
 
     for( i = T_size - 1; ; i-- )
     {
@@ -1077,21 +1136,21 @@ static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
          * u = 1 / (Z_0 * ... * Z_i) mod P
          */
         if( i == 0 ) {
-            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Zi, &u ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( Zi, u ) );
         }
         else
         {
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &Zi, &u, &c[i-1]  ) ); MOD_MUL( Zi );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &u,  &u, &T[i]->Z ) ); MOD_MUL( u );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( Zi,  u,  &c[i-1]  ) ); MOD_MUL( *Zi );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( u,   u,  &T[i]->Z ) ); MOD_MUL( *u );
         }
 
         /*
          * proceed as in normalize()
          */
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ZZi,     &Zi,      &Zi  ) ); MOD_MUL( ZZi );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->X, &T[i]->X, &ZZi ) ); MOD_MUL( T[i]->X );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->Y, &T[i]->Y, &ZZi ) ); MOD_MUL( T[i]->Y );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->Y, &T[i]->Y, &Zi  ) ); MOD_MUL( T[i]->Y );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( ZZi,      Zi,       Zi   ) ); MOD_MUL( *ZZi );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->X, &T[i]->X, ZZi  ) ); MOD_MUL( T[i]->X );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->Y, &T[i]->Y, ZZi  ) ); MOD_MUL( T[i]->Y );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->Y, &T[i]->Y, Zi   ) ); MOD_MUL( T[i]->Y );
 
         /*
          * Post-precessing: reclaim some memory by shrinking coordinates
@@ -1109,7 +1168,7 @@ static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
 
 cleanup:
 
-    mbedtls_mpi_free( &u ); mbedtls_mpi_free( &Zi ); mbedtls_mpi_free( &ZZi );
+    mbedtls_mpi_arena_release( ar, mark );
     for( i = 0; i < T_size; i++ )
         mbedtls_mpi_free( &c[i] );
     mbedtls_free( c );
@@ -1123,21 +1182,23 @@ cleanup:
  */
 static int ecp_safe_invert_jac( const mbedtls_ecp_group *grp,
                             mbedtls_ecp_point *Q,
-                            unsigned char inv )
+                            unsigned char inv,
+                            mbedtls_mpi_arena *ar )
 {
     int ret;
     unsigned char nonzero;
-    mbedtls_mpi mQY;
+    size_t mark = mbedtls_mpi_arena_mark( ar );
+    mbedtls_mpi *mQY;
 
-    mbedtls_mpi_init( &mQY );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &mQY ) );
 
     /* Use the fact that -Q.Y mod P = P - Q.Y unless Q.Y == 0 */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &mQY, &grp->P, &Q->Y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( mQY, &grp->P, &Q->Y ) );
     nonzero = mbedtls_mpi_cmp_int( &Q->Y, 0 ) != 0;
-    MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_assign( &Q->Y, &mQY, inv & nonzero ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_assign( &Q->Y, mQY, inv & nonzero ) );
 
 cleanup:
-    mbedtls_mpi_free( &mQY );
+    mbedtls_mpi_arena_release( ar, mark );
 
     return( ret );
 }
@@ -1157,10 +1218,12 @@ cleanup:
  *             3M + 6S + 1a     otherwise
  */
 static int ecp_double_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
-                           const mbedtls_ecp_point *P )
+                           const mbedtls_ecp_point *P,
+                           mbedtls_mpi_arena *ar )
 {
     int ret;
-    mbedtls_mpi M, S, T, U;
+    size_t mark = mbedtls_mpi_arena_mark( ar );
+    mbedtls_mpi *M, *S, *T, *U;
 
 #if defined(MBEDTLS_SELF_TEST)
     dbl_count++;
@@ -1171,65 +1234,68 @@ static int ecp_double_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
         return( mbedtls_internal_ecp_double_jac( grp, R, P ) );
 #endif /* MBEDTLS_ECP_DOUBLE_JAC_ALT */
 
-    mbedtls_mpi_init( &M ); mbedtls_mpi_init( &S ); mbedtls_mpi_init( &T ); mbedtls_mpi_init( &U );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &M ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &S ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &T ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &U ) );
 
     /* Special case for A = -3 */
     if( grp->A.p == NULL )
     {
         /* M = 3(X + Z^2)(X - Z^2) */
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &P->Z,  &P->Z   ) ); MOD_MUL( S );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &T,  &P->X,  &S      ) ); MOD_ADD( T );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &U,  &P->X,  &S      ) ); MOD_SUB( U );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &T,     &U      ) ); MOD_MUL( S );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &M,  &S,     3       ) ); MOD_ADD( M );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,   &P->Z,  &P->Z   ) ); MOD_MUL( *S );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( T,   &P->X,  S       ) ); MOD_ADD( *T );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( U,   &P->X,  S       ) ); MOD_SUB( *U );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,   T,      U       ) ); MOD_MUL( *S );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( M,   S,      3       ) ); MOD_ADD( *M );
     }
     else
     {
         /* M = 3.X^2 */
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &P->X,  &P->X   ) ); MOD_MUL( S );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &M,  &S,     3       ) ); MOD_ADD( M );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,   &P->X,  &P->X   ) ); MOD_MUL( *S );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( M,   S,      3       ) ); MOD_ADD( *M );
 
         /* Optimize away for "koblitz" curves with A = 0 */
         if( mbedtls_mpi_cmp_int( &grp->A, 0 ) != 0 )
         {
             /* M += A.Z^4 */
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &P->Z,  &P->Z   ) ); MOD_MUL( S );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T,  &S,     &S      ) ); MOD_MUL( T );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &T,     &grp->A ) ); MOD_MUL( S );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &M,  &M,     &S      ) ); MOD_ADD( M );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,   &P->Z,  &P->Z   ) ); MOD_MUL( *S );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T,   S,      S       ) ); MOD_MUL( *T );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,   T,      &grp->A ) ); MOD_MUL( *S );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( M,   M,      S       ) ); MOD_ADD( *M );
         }
     }
 
     /* S = 4.X.Y^2 */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T,  &P->Y,  &P->Y   ) ); MOD_MUL( T );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &T,  1               ) ); MOD_ADD( T );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &P->X,  &T      ) ); MOD_MUL( S );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &S,  1               ) ); MOD_ADD( S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T,   &P->Y,  &P->Y   ) ); MOD_MUL( *T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( T,   1               ) ); MOD_ADD( *T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,   &P->X,  T       ) ); MOD_MUL( *S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( S,   1               ) ); MOD_ADD( *S );
 
     /* U = 8.Y^4 */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &U,  &T,     &T      ) ); MOD_MUL( U );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &U,  1               ) ); MOD_ADD( U );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( U,   T,      T       ) ); MOD_MUL( *U );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( U,   1               ) ); MOD_ADD( *U );
 
     /* T = M^2 - 2.S */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T,  &M,     &M      ) ); MOD_MUL( T );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T,  &T,     &S      ) ); MOD_SUB( T );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T,  &T,     &S      ) ); MOD_SUB( T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T,   M,      M       ) ); MOD_MUL( *T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T,   T,      S       ) ); MOD_SUB( *T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T,   T,      S       ) ); MOD_SUB( *T );
 
     /* S = M(S - T) - U */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S,  &S,     &T      ) ); MOD_SUB( S );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &S,     &M      ) ); MOD_MUL( S );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S,  &S,     &U      ) ); MOD_SUB( S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( S,   S,      T       ) ); MOD_SUB( *S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,   S,      M       ) ); MOD_MUL( *S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( S,   S,      U       ) ); MOD_SUB( *S );
 
     /* U = 2.Y.Z */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &U,  &P->Y,  &P->Z   ) ); MOD_MUL( U );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &U,  1               ) ); MOD_ADD( U );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( U,   &P->Y,  &P->Z   ) ); MOD_MUL( *U );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( U,   1               ) ); MOD_ADD( *U );
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, &T ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, &S ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, &U ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, T ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, S ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, U ) );
 
 cleanup:
-    mbedtls_mpi_free( &M ); mbedtls_mpi_free( &S ); mbedtls_mpi_free( &T ); mbedtls_mpi_free( &U );
+    mbedtls_mpi_arena_release( ar, mark );
 
     return( ret );
 }
@@ -1253,10 +1319,12 @@ cleanup:
  * Cost: 1A := 8M + 3S
  */
 static int ecp_add_mixed( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
-                          const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q )
+                          const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q,
+                          mbedtls_mpi_arena *ar )
 {
     int ret;
-    mbedtls_mpi T1, T2, T3, T4, X, Y, Z;
+    size_t mark = mbedtls_mpi_arena_mark( ar );
+    mbedtls_mpi *T1, *T2, *T3, *T4, *X, *Y, *Z;
 
 #if defined(MBEDTLS_SELF_TEST)
     add_count++;
@@ -1282,22 +1350,27 @@ static int ecp_add_mixed( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     if( Q->Z.p != NULL && mbedtls_mpi_cmp_int( &Q->Z, 1 ) != 0 )
         return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
 
-    mbedtls_mpi_init( &T1 ); mbedtls_mpi_init( &T2 ); mbedtls_mpi_init( &T3 ); mbedtls_mpi_init( &T4 );
-    mbedtls_mpi_init( &X ); mbedtls_mpi_init( &Y ); mbedtls_mpi_init( &Z );
-
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T1,  &P->Z,  &P->Z ) );  MOD_MUL( T1 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T2,  &T1,    &P->Z ) );  MOD_MUL( T2 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T1,  &T1,    &Q->X ) );  MOD_MUL( T1 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T2,  &T2,    &Q->Y ) );  MOD_MUL( T2 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T1,  &T1,    &P->X ) );  MOD_SUB( T1 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T2,  &T2,    &P->Y ) );  MOD_SUB( T2 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &T1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &T2 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &T3 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &T4 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &X ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &Y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &Z ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T1,   &P->Z,  &P->Z ) );  MOD_MUL( *T1 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T2,   T1,     &P->Z ) );  MOD_MUL( *T2 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T1,   T1,     &Q->X ) );  MOD_MUL( *T1 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T2,   T2,     &Q->Y ) );  MOD_MUL( *T2 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T1,   T1,     &P->X ) );  MOD_SUB( *T1 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T2,   T2,     &P->Y ) );  MOD_SUB( *T2 );
 
     /* Special cases (2) and (3) */
-    if( mbedtls_mpi_cmp_int( &T1, 0 ) == 0 )
+    if( mbedtls_mpi_cmp_int( T1, 0 ) == 0 )
     {
-        if( mbedtls_mpi_cmp_int( &T2, 0 ) == 0 )
+        if( mbedtls_mpi_cmp_int( T2, 0 ) == 0 )
         {
-            ret = ecp_double_jac( grp, R, P );
+            ret = ecp_double_jac( grp, R, P, ar );
             goto cleanup;
         }
         else
@@ -1307,27 +1380,26 @@ static int ecp_add_mixed( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
         }
     }
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &Z,   &P->Z,  &T1   ) );  MOD_MUL( Z  );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T3,  &T1,    &T1   ) );  MOD_MUL( T3 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T4,  &T3,    &T1   ) );  MOD_MUL( T4 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T3,  &T3,    &P->X ) );  MOD_MUL( T3 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &T1,  &T3,    2     ) );  MOD_ADD( T1 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &X,   &T2,    &T2   ) );  MOD_MUL( X  );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &X,   &X,     &T1   ) );  MOD_SUB( X  );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &X,   &X,     &T4   ) );  MOD_SUB( X  );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T3,  &T3,    &X    ) );  MOD_SUB( T3 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T3,  &T3,    &T2   ) );  MOD_MUL( T3 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T4,  &T4,    &P->Y ) );  MOD_MUL( T4 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &Y,   &T3,    &T4   ) );  MOD_SUB( Y  );
-
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, &X ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, &Y ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, &Z ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( Z,    &P->Z,  T1    ) );  MOD_MUL( *Z  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T3,   T1,     T1    ) );  MOD_MUL( *T3 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T4,   T3,     T1    ) );  MOD_MUL( *T4 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T3,   T3,     &P->X ) );  MOD_MUL( *T3 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( T1,   T3,     2     ) );  MOD_ADD( *T1 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( X,    T2,     T2    ) );  MOD_MUL( *X  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( X,    X,      T1    ) );  MOD_SUB( *X  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( X,    X,      T4    ) );  MOD_SUB( *X  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T3,   T3,     X     ) );  MOD_SUB( *T3 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T3,   T3,     T2    ) );  MOD_MUL( *T3 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T4,   T4,     &P->Y ) );  MOD_MUL( *T4 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( Y,    T3,     T4    ) );  MOD_SUB( *Y  );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, X ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, Y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, Z ) );
 
 cleanup:
 
-    mbedtls_mpi_free( &T1 ); mbedtls_mpi_free( &T2 ); mbedtls_mpi_free( &T3 ); mbedtls_mpi_free( &T4 );
-    mbedtls_mpi_free( &X ); mbedtls_mpi_free( &Y ); mbedtls_mpi_free( &Z );
+    mbedtls_mpi_arena_release( ar, mark );
 
     return( ret );
 }
@@ -1340,11 +1412,12 @@ cleanup:
  * This countermeasure was first suggested in [2].
  */
 static int ecp_randomize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt,
-                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                mbedtls_mpi_arena *ar )
 {
     int ret;
-    mbedtls_mpi l, ll;
-    size_t p_size;
+    mbedtls_mpi *l, *ll;
+    size_t p_size, mark = mbedtls_mpi_arena_mark( ar );
     int count = 0;
 
 #if defined(MBEDTLS_ECP_RANDOMIZE_JAC_ALT)
@@ -1353,34 +1426,38 @@ static int ecp_randomize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *p
 #endif /* MBEDTLS_ECP_RANDOMIZE_JAC_ALT */
 
     p_size = ( grp->pbits + 7 ) / 8;
-    mbedtls_mpi_init( &l ); mbedtls_mpi_init( &ll );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &l ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &ll ) );
 
     /* Generate l such that 1 < l < p */
     do
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &l, p_size, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( l, p_size, f_rng, p_rng ) );
 
-        while( mbedtls_mpi_cmp_mpi( &l, &grp->P ) >= 0 )
-            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &l, 1 ) );
+        while( mbedtls_mpi_cmp_mpi( l, &grp->P ) >= 0 )
+            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( l, 1 ) );
 
         if( count++ > 10 )
-            return( MBEDTLS_ERR_ECP_RANDOM_FAILED );
+        {
+            ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+            goto cleanup;
+        }
     }
-    while( mbedtls_mpi_cmp_int( &l, 1 ) <= 0 );
+    while( mbedtls_mpi_cmp_int( l, 1 ) <= 0 );
 
     /* Z = l * Z */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Z,   &pt->Z,     &l  ) ); MOD_MUL( pt->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Z,   &pt->Z,     l   ) ); MOD_MUL( pt->Z );
 
     /* X = l^2 * X */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ll,      &l,         &l  ) ); MOD_MUL( ll );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->X,   &pt->X,     &ll ) ); MOD_MUL( pt->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( ll,       l,          l   ) ); MOD_MUL( *ll );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->X,   &pt->X,     ll  ) ); MOD_MUL( pt->X );
 
     /* Y = l^3 * Y */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ll,      &ll,        &l  ) ); MOD_MUL( ll );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     &ll ) ); MOD_MUL( pt->Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( ll,       ll,         l   ) ); MOD_MUL( *ll );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     ll  ) ); MOD_MUL( pt->Y );
 
 cleanup:
-    mbedtls_mpi_free( &l ); mbedtls_mpi_free( &ll );
+    mbedtls_mpi_arena_release( ar, mark );
 
     return( ret );
 }
@@ -1512,7 +1589,8 @@ static void ecp_comb_recode_core( unsigned char x[], size_t d,
 static int ecp_precompute_comb( const mbedtls_ecp_group *grp,
                                 mbedtls_ecp_point T[], const mbedtls_ecp_point *P,
                                 unsigned char w, size_t d,
-                                mbedtls_ecp_restart_ctx *rs_ctx )
+                                mbedtls_ecp_restart_ctx *rs_ctx,
+                                mbedtls_mpi_arena *ar )
 {
     int ret;
     unsigned char i;
@@ -1570,7 +1648,7 @@ dbl:
         if( j % d == 0 )
             MBEDTLS_MPI_CHK( mbedtls_ecp_copy( cur, T + ( i >> 1 ) ) );
 
-        MBEDTLS_MPI_CHK( ecp_double_jac( grp, cur, cur ) );
+        MBEDTLS_MPI_CHK( ecp_double_jac( grp, cur, cur, ar ) );
     }
 
 #if defined(MBEDTLS_ECP_RESTARTABLE)
@@ -1589,7 +1667,7 @@ norm_dbl:
 
     MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_INV + 6 * j - 2 );
 
-    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, j ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, j, ar ) );
 
 #if defined(MBEDTLS_ECP_RESTARTABLE)
     if( rs_ctx != NULL && rs_ctx->rsm != NULL )
@@ -1607,7 +1685,7 @@ add:
     {
         j = i;
         while( j-- )
-            MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[i + j], &T[j], &T[i] ) );
+            MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[i + j], &T[j], &T[i], ar ) );
     }
 
 #if defined(MBEDTLS_ECP_RESTARTABLE)
@@ -1626,7 +1704,7 @@ norm_add:
 
     MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_INV + 6 * j - 2 );
 
-    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, j ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, j, ar ) );
 
 cleanup:
 #if defined(MBEDTLS_ECP_RESTARTABLE)
@@ -1648,7 +1726,8 @@ cleanup:
  */
 static int ecp_select_comb( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
                             const mbedtls_ecp_point T[], unsigned char T_size,
-                            unsigned char i )
+                            unsigned char i,
+                            mbedtls_mpi_arena *ar )
 {
     int ret;
     unsigned char ii, j;
@@ -1664,7 +1743,7 @@ static int ecp_select_comb( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     }
 
     /* Safely invert result if i is "negative" */
-    MBEDTLS_MPI_CHK( ecp_safe_invert_jac( grp, R, i >> 7 ) );
+    MBEDTLS_MPI_CHK( ecp_safe_invert_jac( grp, R, i >> 7, ar ) );
 
 cleanup:
     return( ret );
@@ -1681,7 +1760,8 @@ static int ecp_mul_comb_core( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R
                               const unsigned char x[], size_t d,
                               int (*f_rng)(void *, unsigned char *, size_t),
                               void *p_rng,
-                              mbedtls_ecp_restart_ctx *rs_ctx )
+                              mbedtls_ecp_restart_ctx *rs_ctx,
+                              mbedtls_mpi_arena *ar )
 {
     int ret;
     mbedtls_ecp_point Txi;
@@ -1712,10 +1792,10 @@ static int ecp_mul_comb_core( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R
     {
         /* Start with a non-zero point and randomize its coordinates */
         i = d;
-        MBEDTLS_MPI_CHK( ecp_select_comb( grp, R, T, T_size, x[i] ) );
+        MBEDTLS_MPI_CHK( ecp_select_comb( grp, R, T, T_size, x[i], ar ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
         if( f_rng != 0 )
-            MBEDTLS_MPI_CHK( ecp_randomize_jac( grp, R, f_rng, p_rng ) );
+            MBEDTLS_MPI_CHK( ecp_randomize_jac( grp, R, f_rng, p_rng, ar ) );
     }
 
     while( i != 0 )
@@ -1723,9 +1803,9 @@ static int ecp_mul_comb_core( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R
         MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_DBL + MBEDTLS_ECP_OPS_ADD );
         --i;
 
-        MBEDTLS_MPI_CHK( ecp_double_jac( grp, R, R ) );
-        MBEDTLS_MPI_CHK( ecp_select_comb( grp, &Txi, T, T_size, x[i] ) );
-        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, R, &Txi ) );
+        MBEDTLS_MPI_CHK( ecp_double_jac( grp, R, R, ar ) );
+        MBEDTLS_MPI_CHK( ecp_select_comb( grp, &Txi, T, T_size, x[i], ar ) );
+        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, R, &Txi, ar ) );
     }
 
 cleanup:
@@ -1807,7 +1887,8 @@ static int ecp_mul_comb_after_precomp( const mbedtls_ecp_group *grp,
                                 size_t d,
                                 int (*f_rng)(void *, unsigned char *, size_t),
                                 void *p_rng,
-                                mbedtls_ecp_restart_ctx *rs_ctx )
+                                mbedtls_ecp_restart_ctx *rs_ctx,
+                                mbedtls_mpi_arena *ar )
 {
     int ret;
     unsigned char parity_trick;
@@ -1827,8 +1908,8 @@ static int ecp_mul_comb_after_precomp( const mbedtls_ecp_group *grp,
     MBEDTLS_MPI_CHK( ecp_comb_recode_scalar( grp, m, k, d, w,
                                             &parity_trick ) );
     MBEDTLS_MPI_CHK( ecp_mul_comb_core( grp, RR, T, T_size, k, d,
-                                        f_rng, p_rng, rs_ctx ) );
-    MBEDTLS_MPI_CHK( ecp_safe_invert_jac( grp, RR, parity_trick ) );
+                                        f_rng, p_rng, rs_ctx, ar ) );
+    MBEDTLS_MPI_CHK( ecp_safe_invert_jac( grp, RR, parity_trick, ar ) );
 
 #if defined(MBEDTLS_ECP_RESTARTABLE)
     if( rs_ctx != NULL && rs_ctx->rsm != NULL )
@@ -1837,7 +1918,7 @@ static int ecp_mul_comb_after_precomp( const mbedtls_ecp_group *grp,
 final_norm:
 #endif
     MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_INV );
-    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, RR ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, RR, ar ) );
 
 #if defined(MBEDTLS_ECP_RESTARTABLE)
     if( rs_ctx != NULL && rs_ctx->rsm != NULL )
@@ -1872,10 +1953,12 @@ static unsigned char ecp_pick_window_size( const mbedtls_ecp_group *grp,
         w++;
 
     /*
-     * Make sure w is within bounds.
+     * Make sure w is within bounds, unless a static table computed for that
+     * window is used, which does not cost any memory at run time.
      * (The last test is useful only for very small curves in the test suite.)
      */
-    if( w > MBEDTLS_ECP_WINDOW_SIZE )
+    if( ( ! p_eq_g || ! ecp_group_is_static_comb_table( grp ) ) &&
+        w > MBEDTLS_ECP_WINDOW_SIZE )
         w = MBEDTLS_ECP_WINDOW_SIZE;
     if( w >= grp->nbits )
         w = 2;
@@ -1907,6 +1990,9 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     size_t d;
     unsigned char T_size, T_ok;
     mbedtls_ecp_point *T;
+    mbedtls_mpi_arena arena, *ar = &arena;
+
+    mbedtls_mpi_arena_init( ar );
 
     ECP_RS_ENTER( rsm );
 
@@ -1963,7 +2049,7 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     /* Compute table (or finish computing it) if not done already */
     if( !T_ok )
     {
-        MBEDTLS_MPI_CHK( ecp_precompute_comb( grp, T, P, w, d, rs_ctx ) );
+        MBEDTLS_MPI_CHK( ecp_precompute_comb( grp, T, P, w, d, rs_ctx, ar ) );
 
         if( p_eq_g )
         {
@@ -1977,7 +2063,7 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     /* Actual comb multiplication using precomputed points */
     MBEDTLS_MPI_CHK( ecp_mul_comb_after_precomp( grp, R, m,
                                                  T, T_size, w, d,
-                                                 f_rng, p_rng, rs_ctx ) );
+                                                 f_rng, p_rng, rs_ctx, ar ) );
 
 cleanup:
 
@@ -2012,6 +2098,8 @@ cleanup:
     if( ret != 0 )
         mbedtls_ecp_point_free( R );
 
+    mbedtls_mpi_arena_free( ar );
+
     ECP_RS_LEAVE( rsm );
 
     return( ret );
@@ -2032,7 +2120,8 @@ cleanup:
  * Normalize Montgomery x/z coordinates: X = X/Z, Z = 1
  * Cost: 1M + 1I
  */
-static int ecp_normalize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P )
+static int ecp_normalize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P,
+                              mbedtls_mpi_arena *ar )
 {
     int ret;
 
@@ -2058,11 +2147,12 @@ cleanup:
  * Cost: 2M
  */
 static int ecp_randomize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P,
-                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                mbedtls_mpi_arena *ar )
 {
     int ret;
-    mbedtls_mpi l;
-    size_t p_size;
+    mbedtls_mpi *l;
+    size_t p_size, mark = mbedtls_mpi_arena_mark( ar );
     int count = 0;
 
 #if defined(MBEDTLS_ECP_RANDOMIZE_MXZ_ALT)
@@ -2071,26 +2161,29 @@ static int ecp_randomize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P
 #endif /* MBEDTLS_ECP_RANDOMIZE_MXZ_ALT */
 
     p_size = ( grp->pbits + 7 ) / 8;
-    mbedtls_mpi_init( &l );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &l ) );
 
     /* Generate l such that 1 < l < p */
     do
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &l, p_size, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( l, p_size, f_rng, p_rng ) );
 
-        while( mbedtls_mpi_cmp_mpi( &l, &grp->P ) >= 0 )
-            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &l, 1 ) );
+        while( mbedtls_mpi_cmp_mpi( l, &grp->P ) >= 0 )
+            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( l, 1 ) );
 
         if( count++ > 10 )
-            return( MBEDTLS_ERR_ECP_RANDOM_FAILED );
+        {
+            ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+            goto cleanup;
+        }
     }
-    while( mbedtls_mpi_cmp_int( &l, 1 ) <= 0 );
+    while( mbedtls_mpi_cmp_int( l, 1 ) <= 0 );
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &P->X, &P->X, &l ) ); MOD_MUL( P->X );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &P->Z, &P->Z, &l ) ); MOD_MUL( P->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &P->X, &P->X, l  ) ); MOD_MUL( P->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &P->Z, &P->Z, l  ) ); MOD_MUL( P->Z );
 
 cleanup:
-    mbedtls_mpi_free( &l );
+    mbedtls_mpi_arena_release( ar, mark );
 
     return( ret );
 }
@@ -2113,43 +2206,49 @@ cleanup:
 static int ecp_double_add_mxz( const mbedtls_ecp_group *grp,
                                mbedtls_ecp_point *R, mbedtls_ecp_point *S,
                                const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q,
-                               const mbedtls_mpi *d )
+                               const mbedtls_mpi *d,
+                               mbedtls_mpi_arena *ar )
 {
     int ret;
-    mbedtls_mpi A, AA, B, BB, E, C, D, DA, CB;
+    size_t mark = mbedtls_mpi_arena_mark( ar );
+    mbedtls_mpi *A, *AA, *B, *BB, *E, *C, *D, *DA, *CB;
 
 #if defined(MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT)
     if( mbedtls_internal_ecp_grp_capable( grp ) )
         return( mbedtls_internal_ecp_double_add_mxz( grp, R, S, P, Q, d ) );
 #endif /* MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT */
 
-    mbedtls_mpi_init( &A ); mbedtls_mpi_init( &AA ); mbedtls_mpi_init( &B );
-    mbedtls_mpi_init( &BB ); mbedtls_mpi_init( &E ); mbedtls_mpi_init( &C );
-    mbedtls_mpi_init( &D ); mbedtls_mpi_init( &DA ); mbedtls_mpi_init( &CB );
-
-    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &A,    &P->X,   &P->Z ) ); MOD_ADD( A    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &AA,   &A,      &A    ) ); MOD_MUL( AA   );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &B,    &P->X,   &P->Z ) ); MOD_SUB( B    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &BB,   &B,      &B    ) ); MOD_MUL( BB   );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &E,    &AA,     &BB   ) ); MOD_SUB( E    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &C,    &Q->X,   &Q->Z ) ); MOD_ADD( C    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &D,    &Q->X,   &Q->Z ) ); MOD_SUB( D    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &DA,   &D,      &A    ) ); MOD_MUL( DA   );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &CB,   &C,      &B    ) ); MOD_MUL( CB   );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &S->X, &DA,     &CB   ) ); MOD_MUL( S->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &A ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &AA ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &B ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &BB ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &E ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &C ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &D ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &DA ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_arena_get( ar, &CB ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( A,     &P->X,   &P->Z ) ); MOD_ADD( *A    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( AA,    A,       A     ) ); MOD_MUL( *AA   );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( B,     &P->X,   &P->Z ) ); MOD_SUB( *B    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( BB,    B,       B     ) ); MOD_MUL( *BB   );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( E,     AA,      BB    ) ); MOD_SUB( *E    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( C,     &Q->X,   &Q->Z ) ); MOD_ADD( *C    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( D,     &Q->X,   &Q->Z ) ); MOD_SUB( *D    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( DA,    D,       A     ) ); MOD_MUL( *DA   );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( CB,    C,       B     ) ); MOD_MUL( *CB   );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &S->X, DA,      CB    ) ); MOD_MUL( S->X );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S->X, &S->X,   &S->X ) ); MOD_MUL( S->X );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S->Z, &DA,     &CB   ) ); MOD_SUB( S->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S->Z, DA,      CB    ) ); MOD_SUB( S->Z );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S->Z, &S->Z,   &S->Z ) ); MOD_MUL( S->Z );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S->Z, d,       &S->Z ) ); MOD_MUL( S->Z );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->X, &AA,     &BB   ) ); MOD_MUL( R->X );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->Z, &grp->A, &E    ) ); MOD_MUL( R->Z );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &R->Z, &BB,     &R->Z ) ); MOD_ADD( R->Z );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->Z, &E,      &R->Z ) ); MOD_MUL( R->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->X, AA,      BB    ) ); MOD_MUL( R->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->Z, &grp->A, E     ) ); MOD_MUL( R->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &R->Z, BB,      &R->Z ) ); MOD_ADD( R->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->Z, E,       &R->Z ) ); MOD_MUL( R->Z );
 
 cleanup:
-    mbedtls_mpi_free( &A ); mbedtls_mpi_free( &AA ); mbedtls_mpi_free( &B );
-    mbedtls_mpi_free( &BB ); mbedtls_mpi_free( &E ); mbedtls_mpi_free( &C );
-    mbedtls_mpi_free( &D ); mbedtls_mpi_free( &DA ); mbedtls_mpi_free( &CB );
+    mbedtls_mpi_arena_release( ar, mark );
 
     return( ret );
 }
@@ -2168,8 +2267,10 @@ static int ecp_mul_mxz( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     unsigned char b;
     mbedtls_ecp_point RP;
     mbedtls_mpi PX;
+    mbedtls_mpi_arena arena, *ar = &arena;
 
     mbedtls_ecp_point_init( &RP ); mbedtls_mpi_init( &PX );
+    mbedtls_mpi_arena_init( ar );
 
     /* Save PX and read from P before writing to R, in case P == R */
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &PX, &P->X ) );
@@ -2185,7 +2286,7 @@ static int ecp_mul_mxz( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
 
     /* Randomize coordinates of the starting point */
     if( f_rng != NULL )
-        MBEDTLS_MPI_CHK( ecp_randomize_mxz( grp, &RP, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( ecp_randomize_mxz( grp, &RP, f_rng, p_rng, ar ) );
 
     /* Loop invariant: R = result so far, RP = R + P */
     i = mbedtls_mpi_bitlen( m ); /* one past the (zero-based) most significant bit */
@@ -2201,21 +2302,69 @@ static int ecp_mul_mxz( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
          */
         MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &R->X, &RP.X, b ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &R->Z, &RP.Z, b ) );
-        MBEDTLS_MPI_CHK( ecp_double_add_mxz( grp, R, &RP, R, &RP, &PX ) );
+        MBEDTLS_MPI_CHK( ecp_double_add_mxz( grp, R, &RP, R, &RP, &PX, ar ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &R->X, &RP.X, b ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &R->Z, &RP.Z, b ) );
     }
 
-    MBEDTLS_MPI_CHK( ecp_normalize_mxz( grp, R ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_mxz( grp, R, ar ) );
 
 cleanup:
     mbedtls_ecp_point_free( &RP ); mbedtls_mpi_free( &PX );
+    mbedtls_mpi_arena_free( ar );
 
     return( ret );
 }
 
 #endif /* ECP_MONTGOMERY */
 
+#if defined(MBEDTLS_ECP_P256_C)
+/*
+ * Tell if a multiplication can be done by ecp_p256.c: the group must be
+ * secp256r1, and hardware acceleration and restartable operations take
+ * precedence
+ */
+static int ecp_use_p256( const mbedtls_ecp_group *grp,
+                         const mbedtls_ecp_restart_ctx *rs_ctx )
+{
+    if( grp->id != MBEDTLS_ECP_DP_SECP256R1 )
+        return( 0 );
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( 0 );
+#endif
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && ecp_max_ops != 0 )
+        return( 0 );
+#else
+    (void) rs_ctx;
+#endif
+
+    return( 1 );
+}
+#endif /* MBEDTLS_ECP_P256_C */
+
+#if defined(MBEDTLS_ECP_X25519_C)
+/*
+ * Tell if a multiplication can be done by ecp_x25519.c: the group must be
+ * Curve25519, and hardware acceleration takes precedence
+ */
+static int ecp_use_x25519( const mbedtls_ecp_group *grp )
+{
+    if( grp->id != MBEDTLS_ECP_DP_CURVE25519 )
+        return( 0 );
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( 0 );
+#endif
+
+    return( 1 );
+}
+#endif /* MBEDTLS_ECP_X25519_C */
+
 /*
  * Restartable multiplication R = m * P
  */
@@ -2253,6 +2402,21 @@ int mbedtls_ecp_mul_restartable( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
         MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
     }
 
+#if defined(MBEDTLS_ECP_P256_C)
+    if( ecp_use_p256( grp, rs_ctx ) )
+    {
+        ret = mbedtls_ecp_p256_mul( grp, R, m, P, f_rng, p_rng );
+        goto cleanup;
+    }
+#endif
+#if defined(MBEDTLS_ECP_X25519_C)
+    if( ecp_use_x25519( grp ) )
+    {
+        ret = mbedtls_ecp_x25519_mul( R, m, P, f_rng, p_rng );
+        goto cleanup;
+    }
+#endif
+
     ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
 #if defined(ECP_MONTGOMERY)
     if( ecp_get_type( grp ) == ECP_TYPE_MONTGOMERY )
@@ -2297,6 +2461,7 @@ static int ecp_check_pubkey_sw( const mbedtls_ecp_group *grp, const mbedtls_ecp_
 {
     int ret;
     mbedtls_mpi YY, RHS;
+    mbedtls_mpi_arena arena, *ar = &arena;
 
     /* pt coordinates must be normalized for our checks */
     if( mbedtls_mpi_cmp_int( &pt->X, 0 ) < 0 ||
@@ -2306,6 +2471,7 @@ static int ecp_check_pubkey_sw( const mbedtls_ecp_group *grp, const mbedtls_ecp_
         return( MBEDTLS_ERR_ECP_INVALID_KEY );
 
     mbedtls_mpi_init( &YY ); mbedtls_mpi_init( &RHS );
+    mbedtls_mpi_arena_init( ar );
 
     /*
      * YY = Y^2
@@ -2333,6 +2499,7 @@ static int ecp_check_pubkey_sw( const mbedtls_ecp_group *grp, const mbedtls_ecp_
 cleanup:
 
     mbedtls_mpi_free( &YY ); mbedtls_mpi_free( &RHS );
+    mbedtls_mpi_arena_free( ar );
 
     return( ret );
 }
@@ -2370,6 +2537,254 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Maximum width and length of the wNAF representations of ecp_muladd_wnaf()
+ * (widths above 6 are only used by tables of mbedtls_ecp_keypair_precompute)
+ */
+#define WNAF_MAX_W      8
+#define WNAF_MAX_LEN    ( MBEDTLS_ECP_MAX_BITS + 1 )
+
+/*
+ * Pick the width of the wNAF representations based on curve size:
+ * minimize 2^(w-2) precomputed points against nbits / (w + 1) additions
+ * per scalar, within the bounds of MBEDTLS_ECP_WINDOW_SIZE
+ */
+static unsigned char ecp_pick_wnaf_width( const mbedtls_ecp_group *grp )
+{
+    unsigned char w;
+
+    w = grp->nbits >= 384 ? 6 : 5;
+
+    if( w > MBEDTLS_ECP_WINDOW_SIZE )
+        w = MBEDTLS_ECP_WINDOW_SIZE;
+    if( w >= grp->nbits )
+        w = 2;
+
+    return( w );
+}
+
+/*
+ * Compute the width-w NAF of m > 0 (GECC 3.35): each naf[i] is either 0
+ * or odd with |naf[i]| < 2^(w-1), and at most one of any w consecutive
+ * digits is non-zero. The length of the result is at most bitlen(m) + 1.
+ *
+ * Returns the length of the result.
+ */
+static size_t ecp_wnaf_recode( signed char naf[WNAF_MAX_LEN],
+                               const mbedtls_mpi *m, unsigned char w )
+{
+    size_t i, j, len;
+    int word, carry = 0;
+
+    len = mbedtls_mpi_bitlen( m );
+    memset( naf, 0, WNAF_MAX_LEN );
+
+    for( i = 0; i < len || carry != 0; )
+    {
+        if( (int) mbedtls_mpi_get_bit( m, i ) == carry )
+        {
+            i++;
+            continue;
+        }
+
+        /* Next w bits plus the pending carry: always odd here */
+        word = carry;
+        for( j = 0; j < w; j++ )
+            word += mbedtls_mpi_get_bit( m, i + j ) << j;
+
+        /* Digits >= 2^(w-1) become negative and carry into the next ones */
+        carry = ( word >> ( w - 1 ) ) & 1;
+        naf[i] = (signed char)( word - ( carry << w ) );
+        i += w;
+    }
+
+    return( len + 1 );
+}
+
+/*
+ * Precompute T[b * T_size + j] = (2j + 1) X[b] for b < count and j < T_size,
+ * in affine coordinates, with one normalization for the doublings and one
+ * for the rest. X[b] must be valid public keys, so that none of these
+ * points is zero as long as 2 T_size < N.
+ *
+ * T must hold count * T_size initialized points.
+ */
+static int ecp_precompute_wnaf( const mbedtls_ecp_group *grp,
+                                mbedtls_ecp_point T[], size_t T_size,
+                                const mbedtls_ecp_point *X[], size_t count,
+                                mbedtls_mpi_arena *ar )
+{
+    int ret;
+    size_t i, j, b;
+    mbedtls_ecp_point D[2], **TT = NULL;
+
+    mbedtls_ecp_point_init( &D[0] ); mbedtls_ecp_point_init( &D[1] );
+
+    for( b = 0; b < count; b++ )
+        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &T[b * T_size], X[b] ) );
+
+    if( T_size == 1 )
+    {
+        ret = 0;
+        goto cleanup;
+    }
+
+    TT = mbedtls_calloc( count * T_size, sizeof( mbedtls_ecp_point * ) );
+    if( TT == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    for( b = 0; b < count; b++ )
+    {
+        MBEDTLS_MPI_CHK( ecp_double_jac( grp, &D[b], X[b], ar ) );
+        TT[b] = &D[b];
+    }
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, count, ar ) );
+
+    for( b = 0; b < count; b++ )
+    {
+        for( j = 1; j < T_size; j++ )
+        {
+            MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[b * T_size + j],
+                                            &T[b * T_size + j - 1], &D[b], ar ) );
+            TT[b * ( T_size - 1 ) + j - 1] = &T[b * T_size + j];
+        }
+    }
+
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT,
+                                             count * ( T_size - 1 ), ar ) );
+
+    /* Z is left unset, meaning 1, but the table entries are copied */
+    for( i = 0; i < count * ( T_size - 1 ); i++ )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &TT[i]->Z, 1 ) );
+
+cleanup:
+
+    mbedtls_free( TT );
+    mbedtls_ecp_point_free( &D[0] ); mbedtls_ecp_point_free( &D[1] );
+
+    return( ret );
+}
+
+/*
+ * R += d * P where P = T[|d| / 2] is affine, for an odd wNAF digit d:
+ * negative digits use -P = (X, -Y) (Y != 0 since P is not of order 2),
+ * computed in the scratch point tmp so that T is left untouched
+ */
+static int ecp_add_wnaf_digit( const mbedtls_ecp_group *grp,
+                               mbedtls_ecp_point *R,
+                               const mbedtls_ecp_point T[], signed char d,
+                               mbedtls_ecp_point *tmp,
+                               mbedtls_mpi_arena *ar )
+{
+    int ret;
+
+    if( d > 0 )
+        return( ecp_add_mixed( grp, R, R, &T[d / 2], ar ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( tmp, &T[-d / 2] ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &tmp->Y, &grp->P, &tmp->Y ) );
+    MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, R, tmp, ar ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Linear combination R = m * P + n * Q with interleaved wNAF (GECC 3.51):
+ * one chain of doublings is shared by both scalars, and only the odd
+ * multiples P, 3P, ..., (2^(w-1) - 1) P and likewise for Q are needed.
+ * Those of Q are taken from TQ (computed with width wQ) if not NULL.
+ *
+ * Requires 1 <= m, n < N and P, Q valid public keys, so that none of the
+ * precomputed points is zero.
+ *
+ * Cost: about nbits D + 2 nbits / (w + 1) A for the main loop,
+ *       plus 2^(w-1) A + 2 D + 2N(t) + 1N, with t <= 2^(w-1)
+ *
+ * NOT constant-time - ONLY for public scalars, such as in ECDSA verification!
+ */
+static int ecp_muladd_wnaf( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                            const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                            const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
+                            const mbedtls_ecp_point *TQ, unsigned char wQ )
+{
+    int ret;
+    unsigned char w;
+    size_t i, b, len, len_b, T_size, count;
+    signed char naf[2][WNAF_MAX_LEN];
+    const mbedtls_ecp_point *X[2], *Tb[2];
+    mbedtls_ecp_point S, tmp, *T = NULL;
+    mbedtls_mpi_arena arena, *ar = &arena;
+
+    w = ecp_pick_wnaf_width( grp );
+    T_size = (size_t) 1 << ( w - 2 );
+    count = TQ == NULL ? 2 : 1;
+
+    X[0] = P;
+    X[1] = Q;
+
+    mbedtls_ecp_point_init( &S ); mbedtls_ecp_point_init( &tmp );
+    mbedtls_mpi_arena_init( ar );
+
+    T = mbedtls_calloc( count * T_size, sizeof( mbedtls_ecp_point ) );
+    if( T == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+    for( i = 0; i < count * T_size; i++ )
+        mbedtls_ecp_point_init( &T[i] );
+
+    MBEDTLS_MPI_CHK( ecp_precompute_wnaf( grp, T, T_size, X, count, ar ) );
+
+    Tb[0] = T;
+    Tb[1] = TQ == NULL ? T + T_size : TQ;
+
+    len = ecp_wnaf_recode( naf[0], m, w );
+    len_b = ecp_wnaf_recode( naf[1], n, TQ == NULL ? w : wQ );
+    if( len_b > len )
+        len = len_b;
+
+    /*
+     * Main loop, from the most significant digit: S stays zero until the
+     * first addition, so its doublings are skipped until then
+     */
+    MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( &S ) );
+
+    for( i = len; i-- > 0; )
+    {
+        if( mbedtls_mpi_cmp_int( &S.Z, 0 ) != 0 )
+            MBEDTLS_MPI_CHK( ecp_double_jac( grp, &S, &S, ar ) );
+
+        for( b = 0; b < 2; b++ )
+        {
+            if( naf[b][i] != 0 )
+                MBEDTLS_MPI_CHK( ecp_add_wnaf_digit( grp, &S, Tb[b],
+                                                     naf[b][i], &tmp, ar ) );
+        }
+    }
+
+    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, &S, ar ) );
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, &S ) );
+
+cleanup:
+
+    if( T != NULL )
+    {
+        for( i = 0; i < count * T_size; i++ )
+            mbedtls_ecp_point_free( &T[i] );
+        mbedtls_free( T );
+    }
+
+    mbedtls_ecp_point_free( &S ); mbedtls_ecp_point_free( &tmp );
+    mbedtls_mpi_arena_free( ar );
+
+    return( ret );
+}
+
 /*
  * Restartable linear combination
  * NOT constant-time
@@ -2384,6 +2799,7 @@ int mbedtls_ecp_muladd_restartable(
     mbedtls_ecp_point mP;
     mbedtls_ecp_point *pmP = &mP;
     mbedtls_ecp_point *pR = R;
+    mbedtls_mpi_arena arena, *ar = &arena;
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
     char is_grp_capable = 0;
 #endif
@@ -2391,7 +2807,20 @@ int mbedtls_ecp_muladd_restartable(
     if( ecp_get_type( grp ) != ECP_TYPE_SHORT_WEIERSTRASS )
         return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
 
+#if defined(MBEDTLS_ECP_P256_C)
+    /* Other inputs go through the checks and shortcuts of the generic code */
+    if( ecp_use_p256( grp, rs_ctx ) &&
+        mbedtls_ecp_check_privkey( grp, m ) == 0 &&
+        mbedtls_ecp_check_privkey( grp, n ) == 0 &&
+        mbedtls_ecp_check_pubkey( grp, P ) == 0 &&
+        mbedtls_ecp_check_pubkey( grp, Q ) == 0 )
+    {
+        return( mbedtls_ecp_p256_muladd( grp, R, m, P, n, Q ) );
+    }
+#endif
+
     mbedtls_ecp_point_init( &mP );
+    mbedtls_mpi_arena_init( ar );
 
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
     if( ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp ) ) )
@@ -2400,6 +2829,24 @@ int mbedtls_ecp_muladd_restartable(
 
     ECP_RS_ENTER( ma );
 
+    /*
+     * Unless restartable operations are in use, compute both products at
+     * once; other inputs go through the checks and shortcuts below
+     */
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx == NULL || rs_ctx->ma == NULL )
+#endif
+    {
+        if( mbedtls_ecp_check_privkey( grp, m ) == 0 &&
+            mbedtls_ecp_check_privkey( grp, n ) == 0 &&
+            mbedtls_ecp_check_pubkey( grp, P ) == 0 &&
+            mbedtls_ecp_check_pubkey( grp, Q ) == 0 )
+        {
+            MBEDTLS_MPI_CHK( ecp_muladd_wnaf( grp, R, m, P, n, Q, NULL, 0 ) );
+            goto cleanup;
+        }
+    }
+
 #if defined(MBEDTLS_ECP_RESTARTABLE)
     if( rs_ctx != NULL && rs_ctx->ma != NULL )
     {
@@ -2432,7 +2879,7 @@ mul2:
 add:
 #endif
     MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_ADD );
-    MBEDTLS_MPI_CHK( ecp_add_mixed( grp, pR, pmP, pR ) );
+    MBEDTLS_MPI_CHK( ecp_add_mixed( grp, pR, pmP, pR, ar ) );
 #if defined(MBEDTLS_ECP_RESTARTABLE)
     if( rs_ctx != NULL && rs_ctx->ma != NULL )
         rs_ctx->ma->state = ecp_rsma_norm;
@@ -2440,7 +2887,7 @@ add:
 norm:
 #endif
     MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_INV );
-    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, pR ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, pR, ar ) );
 
 #if defined(MBEDTLS_ECP_RESTARTABLE)
     if( rs_ctx != NULL && rs_ctx->ma != NULL )
@@ -2454,6 +2901,7 @@ cleanup:
 #endif /* MBEDTLS_ECP_INTERNAL_ALT */
 
     mbedtls_ecp_point_free( &mP );
+    mbedtls_mpi_arena_free( ar );
 
     ECP_RS_LEAVE( ma );
 
@@ -2471,6 +2919,142 @@ int mbedtls_ecp_muladd( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     return( mbedtls_ecp_muladd_restartable( grp, R, m, P, n, Q, NULL ) );
 }
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+/*
+ * Memory used by a table of T_size affine points: the point structures,
+ * X and Y of at most P.n limbs each, and Z = 1 of one limb
+ */
+static size_t ecp_precomp_size( const mbedtls_ecp_group *grp, size_t T_size )
+{
+    return( sizeof( mbedtls_ecp_precomp ) + T_size *
+            ( sizeof( mbedtls_ecp_point ) +
+              ( 2 * grp->P.n + 1 ) * sizeof( mbedtls_mpi_uint ) ) );
+}
+
+/*
+ * Precompute the odd multiples of key->Q for ecp_muladd_wnaf(), with the
+ * widest window that fits in max_size, but at least 3
+ */
+int mbedtls_ecp_keypair_precompute( mbedtls_ecp_keypair *key,
+                                    size_t max_size )
+{
+    int ret;
+    size_t i;
+    unsigned char w;
+    mbedtls_ecp_precomp *precomp = NULL;
+    const mbedtls_ecp_point *Q = &key->Q;
+    mbedtls_mpi_arena arena, *ar = &arena;
+
+    ecp_precomp_free( key->precomp );
+    key->precomp = NULL;
+
+    if( max_size == 0 )
+        return( 0 );
+
+    if( ecp_get_type( &key->grp ) != ECP_TYPE_SHORT_WEIERSTRASS )
+        return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( &key->grp, Q ) );
+
+    for( w = WNAF_MAX_W; w >= 3; w-- )
+        if( ecp_precomp_size( &key->grp, (size_t) 1 << ( w - 2 ) ) <= max_size )
+            break;
+    if( w < 3 )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    precomp = mbedtls_calloc( 1, sizeof( mbedtls_ecp_precomp ) );
+    if( precomp == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    precomp->grp_id = key->grp.id;
+    precomp->w = w;
+    precomp->T_size = (size_t) 1 << ( w - 2 );
+    precomp->T = mbedtls_calloc( precomp->T_size, sizeof( mbedtls_ecp_point ) );
+    if( precomp->T == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+    for( i = 0; i < precomp->T_size; i++ )
+        mbedtls_ecp_point_init( &precomp->T[i] );
+
+    mbedtls_mpi_arena_init( ar );
+    ret = ecp_precompute_wnaf( &key->grp, precomp->T, precomp->T_size,
+                               &Q, 1, ar );
+    mbedtls_mpi_arena_free( ar );
+    if( ret != 0 )
+        goto cleanup;
+
+    precomp->size = sizeof( mbedtls_ecp_precomp ) +
+                    precomp->T_size * sizeof( mbedtls_ecp_point );
+    for( i = 0; i < precomp->T_size; i++ )
+        precomp->size += ( precomp->T[i].X.n + precomp->T[i].Y.n +
+                           precomp->T[i].Z.n ) * sizeof( mbedtls_mpi_uint );
+
+    key->precomp = precomp;
+
+cleanup:
+    if( ret != 0 )
+        ecp_precomp_free( precomp );
+
+    return( ret );
+}
+
+/*
+ * Linear combination with precomputed multiples of Q
+ * NOT constant-time
+ */
+int mbedtls_ecp_muladd_precomp( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
+             mbedtls_ecp_precomp *precomp )
+{
+    int ret;
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    char is_grp_capable = 0;
+#endif
+
+    if( precomp == NULL )
+        return( mbedtls_ecp_muladd( grp, R, m, P, n, Q ) );
+
+    /*
+     * The table must be that of Q, which was checked when computing it.
+     * Other inputs go through the checks and shortcuts of the generic code,
+     * and so does secp256r1 if it has its own faster implementation.
+     */
+    if( precomp->grp_id != grp->id || grp->id == MBEDTLS_ECP_DP_NONE ||
+#if defined(MBEDTLS_ECP_P256_C)
+        ecp_use_p256( grp, NULL ) ||
+#endif
+        mbedtls_ecp_point_cmp( &precomp->T[0], Q ) != 0 ||
+        mbedtls_ecp_check_privkey( grp, m ) != 0 ||
+        mbedtls_ecp_check_privkey( grp, n ) != 0 ||
+        mbedtls_ecp_check_pubkey( grp, P ) != 0 )
+    {
+        precomp->misses++;
+        return( mbedtls_ecp_muladd( grp, R, m, P, n, Q ) );
+    }
+
+    precomp->hits++;
+
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp ) ) )
+        MBEDTLS_MPI_CHK( mbedtls_internal_ecp_init( grp ) );
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+
+    MBEDTLS_MPI_CHK( ecp_muladd_wnaf( grp, R, m, P, n, Q,
+                                      precomp->T, precomp->w ) );
+
+cleanup:
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( is_grp_capable )
+        mbedtls_internal_ecp_free( grp );
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
+
 #if defined(ECP_MONTGOMERY)
 /*
  * Check validity of a public key for Montgomery curves with x-only schemes
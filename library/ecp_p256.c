@@ -0,0 +1,6568 @@
+/*
+ *  Fixed-width arithmetic for the NIST P-256 curve
+ *
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+/*
+ * References:
+ *
+ * [GK15] S. Gueron, V. Krasnov, Fast prime field elliptic-curve cryptography
+ *        with 256-bit primes, Journal of Cryptographic Engineering 5 (2015)
+ * [EFD]  Explicit-Formulas Database, Jacobian coordinates with a4 = -3
+ *        <https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html>
+ *
+ * Field elements are four 64-bit limbs, least significant first, in
+ * Montgomery form (x * 2^256 mod p), on the stack. Points are in Jacobian
+ * coordinates, the point at infinity having Z = 0.
+ *
+ * Scalars are recoded into signed digits ("Booth" recoding [GK15]) so that
+ * each window selects one of 2^(w-1) points, read in full from the table
+ * and masked, and conditionally negated. Multiplication of the base point
+ * uses a static table of all the digit multiples for every window, so only
+ * additions remain. An addition of equal points is handled by computing the
+ * doubling as well and selecting it with a mask; this is only done for the
+ * additions where the operands can be equal (see p256_mul_var() and
+ * p256_mul_base()), which is decided by their position alone.
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_P256_C)
+
+#include "mbedtls/ecp_p256.h"
+#include "mbedtls/platform_util.h"
+
+#include <string.h>
+
+#if defined(_MSC_VER) || defined(__WATCOMC__)
+  #define UL64(x) x##ui64
+#else
+  #define UL64(x) x##ULL
+#endif
+
+#if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
+    !defined(inline) && !defined(__cplusplus)
+#define inline __inline
+#endif
+
+#if defined(MBEDTLS_HAVE_ASM) && defined(__GNUC__) &&  \
+    ( defined(__amd64__) || defined(__x86_64__) )   &&  \
+    ! defined(MBEDTLS_HAVE_X86_64)
+#define MBEDTLS_HAVE_X86_64
+#endif
+
+#ifndef asm
+#define asm __asm
+#endif
+
+/* Window of the variable point multiplication: 2^(W-1) points */
+#define P256_W                  5
+#define P256_WINDOWS            52      /* ceil( 257 / P256_W ) */
+#define P256_POINTS             ( 1 << ( P256_W - 1 ) )
+
+/* Window of the base point multiplication */
+#define P256_BASE_W             6
+#define P256_BASE_WINDOWS       43      /* ceil( 257 / P256_BASE_W ) */
+#define P256_BASE_POINTS        ( 1 << ( P256_BASE_W - 1 ) )
+
+typedef uint64_t p256_fe[4];
+
+typedef struct
+{
+    p256_fe X, Y, Z;
+}
+p256_jac;
+
+typedef struct
+{
+    p256_fe X, Y;
+}
+p256_aff;
+
+static const p256_fe p256_p = {
+    UL64(0xFFFFFFFFFFFFFFFF), UL64(0x00000000FFFFFFFF),
+    UL64(0x0000000000000000), UL64(0xFFFFFFFF00000001) };
+
+/* 2^512 mod p, to convert into Montgomery form */
+static const p256_fe p256_rr = {
+    UL64(0x0000000000000003), UL64(0xFFFFFFFBFFFFFFFF),
+    UL64(0xFFFFFFFFFFFFFFFE), UL64(0x00000004FFFFFFFD) };
+
+/* 1 in Montgomery form */
+static const p256_fe p256_one = {
+    UL64(0x0000000000000001), UL64(0xFFFFFFFF00000000),
+    UL64(0xFFFFFFFFFFFFFFFF), UL64(0x00000000FFFFFFFE) };
+
+static const p256_fe p256_zero = { 0, 0, 0, 0 };
+
+/*
+ * Precomputed multiples of the base point: p256_base_table[j][i] is
+ * ( i + 1 ) * 2^(P256_BASE_W * j) * G, X then Y in Montgomery form
+ * (generated by scripts/generate_ecp_p256_table.py)
+ */
+static const uint64_t p256_base_table[P256_BASE_WINDOWS][P256_BASE_POINTS][8] = {
+    {
+        { UL64(0x79E730D418A9143C), UL64(0x75BA95FC5FEDB601),
+          UL64(0x79FB732B77622510), UL64(0x18905F76A53755C6),
+          UL64(0xDDF25357CE95560A), UL64(0x8B4AB8E4BA19E45C),
+          UL64(0xD2E88688DD21F325), UL64(0x8571FF1825885D85) },
+        { UL64(0x850046D410DDD64D), UL64(0xAA6AE3C1A433827D),
+          UL64(0x732205038D1490D9), UL64(0xF6BB32E43DCF3A3B),
+          UL64(0x2F3648D361BEE1A5), UL64(0x152CD7CBEB236FF8),
+          UL64(0x19A8FB0E92042DBE), UL64(0x78C577510A5B8A3B) },
+        { UL64(0xFFAC3F904EEBC127), UL64(0xB027F84A087D81FB),
+          UL64(0x66AD77DD87CBBC98), UL64(0x26936A3FB6FF747E),
+          UL64(0xB04C5C1FC983A7EB), UL64(0x583E47AD0861FE1A),
+          UL64(0x788208311A2EE98E), UL64(0xD5F06A29E587CC07) },
+        { UL64(0x74B0B50D46918DCC), UL64(0x4650A6EDC623C173),
+          UL64(0x0CDAACACE8100AF2), UL64(0x577362F541B0176B),
+          UL64(0x2D96F24CE4CBABA6), UL64(0x17628471FAD6F447),
+          UL64(0x6B6C36DEE5DDD22E), UL64(0x84B14C394C5AB863) },
+        { UL64(0xBE1B8AAEC45C61F5), UL64(0x90EC649A94B9537D),
+          UL64(0x941CB5AAD076C20C), UL64(0xC9079605890523C8),
+          UL64(0xEB309B4AE7BA4F10), UL64(0x73C568EFE5EB882B),
+          UL64(0x3540A9877E7A1F68), UL64(0x73A076BB2DD1E916) },
+        { UL64(0x403947373E77664A), UL64(0x55AE744F346CEE3E),
+          UL64(0xD50A961A5B17A3AD), UL64(0x13074B5954213673),
+          UL64(0x93D36220D377E44B), UL64(0x299C2B53ADFF14B5),
+          UL64(0xF424D44CEF639F11), UL64(0xA4C9916D4A07F75F) },
+        { UL64(0x0746354EA0173B4F), UL64(0x2BD20213D23C00F7),
+          UL64(0xF43EAAB50C23BB08), UL64(0x13BA5119C3123E03),
+          UL64(0x2847D0303F5B9D4D), UL64(0x6742F2F25DA67BDD),
+          UL64(0xEF933BDC77C94195), UL64(0xEAEDD9156E240867) },
+        { UL64(0x27F14CD19499A78F), UL64(0x462AB5C56F9B3455),
+          UL64(0x8F90F02AF02CFC6B), UL64(0xB763891EB265230D),
+          UL64(0xF59DA3A9532D4977), UL64(0x21E3327DCF9EBA15),
+          UL64(0x123C7B84BE60BBF0), UL64(0x56EC12F27706DF76) },
+        { UL64(0x75C96E8F264E20E8), UL64(0xABE6BFED59A7A841),
+          UL64(0x2CC09C0444C8EB00), UL64(0xE05B3080F0C4E16B),
+          UL64(0x1EB7777AA45F3314), UL64(0x56AF7BEDCE5D45E3),
+          UL64(0x2B6E019A88B12F1A), UL64(0x086659CDFD835F9B) },
+        { UL64(0x2C18DBD19DC21EC8), UL64(0x98F9868A0FCF8139),
+          UL64(0x737D2CD648250B49), UL64(0xCC61C94724B3428F),
+          UL64(0x0C2B407880DD9E76), UL64(0xC43A8991383FBE08),
+          UL64(0x5F7D2D65779BE5D2), UL64(0x78719A54EB3B4AB5) },
+        { UL64(0xEA7D260A6245E404), UL64(0x9DE407956E7FDFE0),
+          UL64(0x1FF3A4158DAC1AB5), UL64(0x3E7090F1649C9073),
+          UL64(0x1A7685612B944E88), UL64(0x250F939EE57F61C8),
+          UL64(0x0C0DAA891EAD643D), UL64(0x68930023E125B88E) },
+        { UL64(0x04B71AA7D2697768), UL64(0xABDEDEF5CA345A33),
+          UL64(0x2409D29DEE37385E), UL64(0x4EE1DF77CB83E156),
+          UL64(0x0CAC12D91CBB5B43), UL64(0x170ED2F6CA895637),
+          UL64(0x28228CFA8ADE6D66), UL64(0x7FF57C9553238ACA) },
+        { UL64(0xCCC425634B2ED709), UL64(0x0E356769856FD30D),
+          UL64(0xBCBCD43F559E9811), UL64(0x738477AC5395B759),
+          UL64(0x35752B90C00EE17F), UL64(0x68748390742ED2E3),
+          UL64(0x7CD06422BD1F5BC1), UL64(0xFBC08769C9E7B797) },
+        { UL64(0xA242A35BB0CF664A), UL64(0x126E48F77F9707E3),
+          UL64(0x1717BF54C6832660), UL64(0xFAAE7332FD12C72E),
+          UL64(0x27B52DB7995D586B), UL64(0xBE29569E832237C2),
+          UL64(0xE8E4193E2A65E7DB), UL64(0x152706DC2EAA1BBB) },
+        { UL64(0x72BCD8B7BC60055B), UL64(0x03CC23EE56E27E4B),
+          UL64(0xEE337424E4819370), UL64(0xE2AA0E430AD3DA09),
+          UL64(0x40B8524F6383C45D), UL64(0xD766355442A41B25),
+          UL64(0x64EFA6DE778A4797), UL64(0x2042170A7079ADF4) },
+        { UL64(0x808B0B650BC6FB80), UL64(0x5882E0753FFE2E6B),
+          UL64(0xD5EF2F7C2C83F549), UL64(0x54D63C809103B723),
+          UL64(0xF2F11BD652A23F9B), UL64(0x3670C3194B0B6587),
+          UL64(0x55C4623BB1580E9E), UL64(0x64EDF7B201EFE220) },
+        { UL64(0x97091DCBD53C5C9D), UL64(0xF17624B6AC0A177B),
+          UL64(0xB0F139752CFE2DFF), UL64(0xC1A35C0A6C7A574E),
+          UL64(0x227D314693E79987), UL64(0x0575BF30E89CB80E),
+          UL64(0x2F4E247F0D1883BB), UL64(0xEBD512263274C3D0) },
+        { UL64(0x5F3E51C856ADA97A), UL64(0x4AFC964D8F8B403E),
+          UL64(0xA6F247AB412E2979), UL64(0x675ABD1B6F80EBDA),
+          UL64(0x66A2BD725E485A1D), UL64(0x4B2A5CAF8F4F0B3C),
+          UL64(0x2626927F1B847BBA), UL64(0x6C6FC7D90502394D) },
+        { UL64(0xFEA912BAA5659AE8), UL64(0x68363ABA25E1A16E),
+          UL64(0xB8842277752C41AC), UL64(0xFE545C282897C3FC),
+          UL64(0x2D36E9E7DC4C696B), UL64(0x5806244AFBA977C5),
+          UL64(0x85665E9BE39508C1), UL64(0xF720EE256D12597B) },
+        { UL64(0x8A979129D2337A31), UL64(0x5916868F0F862BDC),
+          UL64(0x048099D95DD283BA), UL64(0xE2D1EEB6FE5BFB4E),
+          UL64(0x82EF1C417884005D), UL64(0xA2D4EC17FFFFCBAE),
+          UL64(0x9161C53F8AA95E66), UL64(0x5EE104E1C5FEE0D0) },
+        { UL64(0x562E4CECC135B208), UL64(0x74E1B2654783F47D),
+          UL64(0x6D2A506C5A3F3B30), UL64(0xECEAD9F4C16762FC),
+          UL64(0xF29DD4B2E286E5B9), UL64(0x1B0FADC083BB3C61),
+          UL64(0x7A75023E7FAC29A4), UL64(0xC086D5F1C9477FA3) },
+        { UL64(0x0FC611352F6F3076), UL64(0xC99FFA23E3912A9A),
+          UL64(0x6A0B0685D2F8BA3D), UL64(0xFDC777E8E93358A4),
+          UL64(0x94A787BB35415F04), UL64(0x640C2D6A4D23FEA4),
+          UL64(0x9DE917DA153A35B5), UL64(0x793E8D075D5CD074) },
+        { UL64(0xF4F876532DE45068), UL64(0x37C7A7E89E2E1F6E),
+          UL64(0xD0825FA2A3584069), UL64(0xAF2CEA7C1727BF42),
+          UL64(0x0360A4FB9E4785A9), UL64(0xE5FDA49C27299F4A),
+          UL64(0x48068E1371AC2F71), UL64(0x83D0687B9077666F) },
+        { UL64(0x6D3883B215D02819), UL64(0x6D0D755040DD9A35),
+          UL64(0x61D7CBF91D2B469F), UL64(0xF97B232F2EFC3115),
+          UL64(0xA551D750B24BCBC7), UL64(0x11EA494988A1E356),
+          UL64(0x7669F03193CB7501), UL64(0x595DC55ECA737B8A) },
+        { UL64(0xA4A319ACD837879F), UL64(0x6FC1B49EED6B67B0),
+          UL64(0xE395993332F1F3AF), UL64(0x966742EB65432A2E),
+          UL64(0x4B8DC9FEB4966228), UL64(0x96CC631243F43950),
+          UL64(0x12068859C9B731EE), UL64(0x7B948DC356F79968) },
+        { UL64(0x61E4AD32ED1F8008), UL64(0xE6C9267AD8B17538),
+          UL64(0x1AC7C5EB857FF6FB), UL64(0x994BAAA855F2FB10),
+          UL64(0x84CF14E11D248018), UL64(0x5A39898B628AC508),
+          UL64(0x14FDE97B5FA944F5), UL64(0xED178030D12E5AC7) },
+        { UL64(0x042C2AF497E2FEB4), UL64(0xD36A42D7AEBF7313),
+          UL64(0x49D2C9EB084FFDD7), UL64(0x9F8AA54B2EF7C76A),
+          UL64(0x9200B7BA09895E70), UL64(0x3BD0C66FDDB7FB58),
+          UL64(0x2D97D10878EB4CBB), UL64(0x2D431068D84BDE31) },
+        { UL64(0x4B523EB7172CCD1F), UL64(0x7323CB2830A6A892),
+          UL64(0x97082EC0CFE153EB), UL64(0xE97F6B6AF2AADB97),
+          UL64(0x1D3D393ED1A83DA1), UL64(0xA6A7F9C7804B2A68),
+          UL64(0x4A688B482D0CB71E), UL64(0xA9B4CC5F40585278) },
+        { UL64(0x5E5DB46ACB66E132), UL64(0xF1BE963A0D925880),
+          UL64(0x944A70270317B9E2), UL64(0xE266F95948603D48),
+          UL64(0x98DB66735C208899), UL64(0x90472447A2FB18A3),
+          UL64(0x8A966939777C619F), UL64(0x3798142A2A3BE21B) },
+        { UL64(0xB4241CB13298B343), UL64(0xA3A14E49B44F65A1),
+          UL64(0xC5F4D6CD3AC77ACD), UL64(0xD0288CB552B6FC3C),
+          UL64(0xD5CC8C2F1C040ABC), UL64(0xB675511E06BF9B4A),
+          UL64(0xD667DA379B3AA441), UL64(0x460D45CE51601F72) },
+        { UL64(0xE2F73C696755FF89), UL64(0xDD3CF7E7473017E6),
+          UL64(0x8EF5689D3CF7600D), UL64(0x948DC4F8B1FC87B4),
+          UL64(0xD9E9FE814EA53299), UL64(0x2D921CA298EB6028),
+          UL64(0xFAECEDFD0C9803FC), UL64(0xF38AE8914D7B4745) },
+        { UL64(0xD8C5FCCFC5E3A3D8), UL64(0xBEFD904C4079DFBF),
+          UL64(0xBC6D6A58FEAD0197), UL64(0x39227077695532A4),
+          UL64(0x09E23E6DDBEF42F5), UL64(0x7E449B64480A9908),
+          UL64(0x7B969C1AAD9A2E40), UL64(0x6231D7929591C2A4) },
+    },
+    {
+        { UL64(0xDB6D96F305968B80), UL64(0x380A0913089F73B9),
+          UL64(0x7DA70B83C2C61E01), UL64(0x95FB8394569B38C7),
+          UL64(0x9A3C651280EDFE2F), UL64(0x8F726BB98FAEAF82),
+          UL64(0x8010A4A078424BF8), UL64(0x296720440E844970) },
+        { UL64(0x63C5CB817A2AD62A), UL64(0x7EF2B6B9AC62FF54),
+          UL64(0x3749BBA4B3AD9DB5), UL64(0xAD311F2C46D5A617),
+          UL64(0xB77A8087C2FF3B6D), UL64(0xB46FEAF3367834FF),
+          UL64(0xF8AA266D75D6B138), UL64(0xFA38D320EC008188) },
+        { UL64(0xC0F2AFFC4E6916C6), UL64(0x6FB94957811842DA),
+          UL64(0x6034BCB624B4D157), UL64(0xDE2EFDC7992EFB90),
+          UL64(0xD66F7ECEAC793C87), UL64(0x02F026267DC6FDCD),
+          UL64(0x90D3235C9AA1C501), UL64(0xF6E494962B4666F0) },
+        { UL64(0x486D8FFA696946FC), UL64(0x50FBC6D8B9CBA56D),
+          UL64(0x7E3D423E90F35A15), UL64(0x7C3DA195C0DD962C),
+          UL64(0xE673FDB03CFD5D8B), UL64(0x0704B7C2889DFCA5),
+          UL64(0xF6CE581FF52305AA), UL64(0x399D49EB914D5E53) },
+        { UL64(0x24C97C367B92D453), UL64(0xD2C271A2249A26C0),
+          UL64(0x60EB4B2B89D14A39), UL64(0x1198DE20432E8005),
+          UL64(0x9EABEA75799B80D9), UL64(0xAB6E0C2B8F826AE5),
+          UL64(0xCA004EEDD10061EC), UL64(0x31A9F439E99C4FD8) },
+        { UL64(0x380A496D6EC293CD), UL64(0x733DBDA78E7051F5),
+          UL64(0x037E388DB849140A), UL64(0xEE4B32B05946DBF6),
+          UL64(0xB1C4FDA9CAE368D1), UL64(0x5001A7B0FDB0B2F3),
+          UL64(0x6DF593742E3AC46E), UL64(0x4AF675F239B3E656) },
+        { UL64(0xB20E7C44D67826EB), UL64(0x1212D3CFAC379637),
+          UL64(0x614F67877DE03A5D), UL64(0x7538A2FC802BAA26),
+          UL64(0x133C37A19D252415), UL64(0x7DB390506EB4B587),
+          UL64(0x5D40D7574C49D1D9), UL64(0xF1126B99A801C4BA) },
+        { UL64(0x44E3811039949296), UL64(0x5B63827B361DB1B5),
+          UL64(0x3E5323ED206EAFF5), UL64(0x942370D2C21F4290),
+          UL64(0xF2CAAF2EE0D985A1), UL64(0x192CC64B7239846D),
+          UL64(0x7C0B8F47AE6312F8), UL64(0x7DC61F9196620108) },
+        { UL64(0x40FFC99670961147), UL64(0x79E06842C7C22C8C),
+          UL64(0x63F1ABCC1A97BBBD), UL64(0xE9EA74D0F0730388),
+          UL64(0xA6C3504DD9EFFF66), UL64(0x5354EE3857E02015),
+          UL64(0x3BFED7FE6D7040FA), UL64(0x692C95CC99CA82AC) },
+        { UL64(0xB830FB5BC2DA7DE9), UL64(0xD0E643DF0FF8D3BE),
+          UL64(0x31EE77BA188A9641), UL64(0x4E8AA3AABCF6D502),
+          UL64(0xF9FB65329A49110F), UL64(0xD18317F62DD6B220),
+          UL64(0x7E3CED4152C3EA5A), UL64(0x0D296A147D579C4A) },
+        { UL64(0x688B5ACA942F6C58), UL64(0x6F2789C5495D9439),
+          UL64(0xD54DDB0C504C501D), UL64(0xF16A4D0FBCACE3A7),
+          UL64(0xB76FBC6F056A41EB), UL64(0xE288C255825BD6C5),
+          UL64(0x950377960F42E2D3), UL64(0x9A3C47E3DEB57B44) },
+        { UL64(0x35D6A53EED4C3717), UL64(0x9F8240CF3D0ED2A3),
+          UL64(0x8C0D4D05E5543AA5), UL64(0x45D5BBFBDD33B4B4),
+          UL64(0xFA04CC73137FD28E), UL64(0x862AC6EFC73B3FFD),
+          UL64(0x403FF9F531F51EF2), UL64(0x34D5E0FCBC73F5A2) },
+        { UL64(0x2C9AEF219559FAB0), UL64(0x833361CE62322F2D),
+          UL64(0xD3FD5E2B72BA0DF9), UL64(0xFC85E7329D2D8C0A),
+          UL64(0xCE234675F15DB8D4), UL64(0x6AF7AC2EF52D3F9A),
+          UL64(0x2D55F1693DBF6592), UL64(0xB1C9CC6CD7098E38) },
+        { UL64(0xF252682008913F4F), UL64(0xEA20ED61EAC93D95),
+          UL64(0x51ED38B46CA6B26C), UL64(0x8662DCBCEA4327B0),
+          UL64(0x6DAF295C725D2AAA), UL64(0xBAD2752F8E52DCDA),
+          UL64(0x2210E7210B17DACC), UL64(0xA37F7912D51E8232) },
+        { UL64(0x2A00160CD540CAEB), UL64(0x6F66145EA41A2788),
+          UL64(0xF9C81C3351C811FA), UL64(0xEEE58E0F646F5403),
+          UL64(0x8DF920EFFC18FAE3), UL64(0x7923425E0971EA6C),
+          UL64(0xE0E3DCB2CBA0AEA7), UL64(0xBF1DAF5E4A852DFC) },
+        { UL64(0x4F7081E144CC3ADD), UL64(0xD5FFA1D687BE82CF),
+          UL64(0x89890B6C0EDD6472), UL64(0xADA26E1A3ED17863),
+          UL64(0x276F271563483CAA), UL64(0xE6924CD92F6077FD),
+          UL64(0x05A7FE980A466E3C), UL64(0xF1C794B0B1902D1F) },
+        { UL64(0xEE066357AAF09C1C), UL64(0x1C53878DAB2776D2),
+          UL64(0x2CB5724CAE4E324A), UL64(0x13307CADE0FE8352),
+          UL64(0xEF02BB7854395696), UL64(0x2C592DF3B3B64D31),
+          UL64(0xF005951ABC8B6AEB), UL64(0x5760BE826B91275E) },
+        { UL64(0xE521368882A8042C), UL64(0xD931CFAFCD278298),
+          UL64(0x069A0AE0F597A740), UL64(0x0ADBB3F3EB59107C),
+          UL64(0x983E951E5EAA8EB8), UL64(0xE663A8B511B48E78),
+          UL64(0x1631CC0D8A03F2C5), UL64(0x7577C11E11E271E2) },
+        { UL64(0x085DBF4174A08FF6), UL64(0x80BACE40A576460B),
+          UL64(0xD204CBCF27C1BA49), UL64(0x64D12F32E4806949),
+          UL64(0xCDD4222201DFE8E3), UL64(0x3B5B3C6ED05C83D4),
+          UL64(0xB2C081B3FCEB00C0), UL64(0xE2C23EECDD67D769) },
+        { UL64(0x33B2385C08369A90), UL64(0x2990C59B190EB4F8),
+          UL64(0x819A6145C68EAC80), UL64(0x7A786D622EC4A014),
+          UL64(0x33FAADBE20AC3A8D), UL64(0x31A217815ABA2D30),
+          UL64(0x209D2742DBA4F565), UL64(0xDB2CE9E355AA0FBB) },
+        { UL64(0x6F4F24B563CCE1AD), UL64(0x5166672A9FB43A77),
+          UL64(0xBB7840784FC79D1F), UL64(0xB3821A6CF774BBF5),
+          UL64(0xA27BD4CEDF02F441), UL64(0xC5FA4EB9B84E2ADF),
+          UL64(0x910BCBD7F0B7CDDE), UL64(0xB7E640482E5A1EEC) },
+        { UL64(0x8CEF334B168984DF), UL64(0xE81DCE1733879638),
+          UL64(0xF6E6949C263720F0), UL64(0x5C56FEAFF593CBEC),
+          UL64(0x8BFF5601FDE58C84), UL64(0x74E241172ECCB314),
+          UL64(0xBCF01B614C9A8A78), UL64(0xA233E35E544C9868) },
+        { UL64(0x54934BC9C765D8FB), UL64(0xC1966571B30B751E),
+          UL64(0xC4FD2FCF91A7C817), UL64(0x246FBC7EDCB1C888),
+          UL64(0x27304FFD59CC1BFF), UL64(0xC35C4D8DE59C5811),
+          UL64(0xD863FFB9401F9921), UL64(0x5B14482E2E806961) },
+        { UL64(0xB3156BF38BD7AFF1), UL64(0x1B5EE4CB1D81B146),
+          UL64(0x7BA1AC41D628A915), UL64(0x8F3A8F9CFD89699E),
+          UL64(0x7329B9C9A0748BE7), UL64(0x1D391C95A92E621F),
+          UL64(0xE51E6B214D10A837), UL64(0xD255F53A4947B435) },
+        { UL64(0xC137045A1F20882B), UL64(0x924B16F49B7A050C),
+          UL64(0x8ABA26F5EA6694AF), UL64(0x2906285469826A3E),
+          UL64(0x2EF6D1CBB08C1627), UL64(0x61313884C58C0C34),
+          UL64(0xA5C7C299D8F6F1B4), UL64(0xCD5AAEC0FF3E9F87) },
+        { UL64(0x07669E04F1788EE3), UL64(0xC14F27AFA86938A2),
+          UL64(0x8B47A334E93A01C0), UL64(0xFF627438D9366808),
+          UL64(0x7A0985D8CA2A5965), UL64(0x3D9A5542D6E9B9B3),
+          UL64(0xC23EB80B4CF972E8), UL64(0x5C1C33BB4FDF72FD) },
+        { UL64(0x3BCABDDD4CB3D45A), UL64(0xA9384D6B417D67A1),
+          UL64(0x659F5BBA6AA8FA54), UL64(0x04937621CD0EF0CB),
+          UL64(0xD480B2F5518B2347), UL64(0x153C971E1FE38780),
+          UL64(0x157108EDFE07B538), UL64(0xCA0D8003AB110129) },
+        { UL64(0x0C4A58D474A86108), UL64(0xF8048A8FEE4C5D90),
+          UL64(0xE3C7C924E86D4C80), UL64(0x28C889DE056A1E60),
+          UL64(0x57E2662EB214A040), UL64(0xE8C48E9837E10347),
+          UL64(0x8774286280AC748A), UL64(0xF1C24022186B06F2) },
+        { UL64(0xD0BB3376094E51D7), UL64(0x5110CC2242CD877A),
+          UL64(0x7BD65729CFD197C6), UL64(0xF22994058ACA3171),
+          UL64(0x078475152155AEA5), UL64(0x84F12D489A821A54),
+          UL64(0xB18CC1F93737AF5C), UL64(0x4FBA0CE2BA485845) },
+        { UL64(0xAC2DD4C35F74040A), UL64(0x409AEB71FCEAC957),
+          UL64(0x4FBAD78255C4EC23), UL64(0xB359ED618A7B76EC),
+          UL64(0x12744926ED6F4A60), UL64(0xE21E8D7F4B912DE3),
+          UL64(0xE2575A59FC705A59), UL64(0x72F1D4DEED2DBC0E) },
+        { UL64(0x9679D85AB99772D2), UL64(0x8269717CDDCD1C25),
+          UL64(0x50972045EBDCC377), UL64(0xED13DE836EE2C9DF),
+          UL64(0x9F39F50450A7217A), UL64(0xD33BA941AEE007B6),
+          UL64(0x914F7190FC2BEC9A), UL64(0x70D2254EB0D92487) },
+        { UL64(0x3D2B24B9EB7926B8), UL64(0xBFF88CB3CDBE5509),
+          UL64(0xD0F399AFE4DD640B), UL64(0x3C5FE1302F76ED45),
+          UL64(0x6F3562F43764FB3D), UL64(0x7B5AF3183151B62D),
+          UL64(0xD5BD0BC7D79CE5F3), UL64(0xFDAF6B20EC66890F) },
+    },
+    {
+        { UL64(0x6772B0E5AB4B35A2), UL64(0x1D8B6001F5EEAACF),
+          UL64(0x728F7CE4795B9580), UL64(0x4A20ED2A41FB81DA),
+          UL64(0x9F685CD44FEC01E6), UL64(0x3ED7DDCCA7FF50AD),
+          UL64(0x460FD2640C2D97FD), UL64(0x3A241426EB82F4F9) },
+        { UL64(0x80009862D5D721D5), UL64(0x0C3357A35BD3A182),
+          UL64(0x27F3A83B7AA2CDA4), UL64(0xB58AE74EF6F83085),
+          UL64(0x2A911A812E6DAD6B), UL64(0xDE286051F43D6C5B),
+          UL64(0x4BDCCC41F996C4D8), UL64(0xE7312EC00AE1E24E) },
+        { UL64(0x6FAF68FEAAE6EE70), UL64(0x78F4CC155602B0C9),
+          UL64(0x7E3321A86E94052A), UL64(0x2FB3A0D6734D5D80),
+          UL64(0xF3B98F3BB25A43BA), UL64(0x30BF803119EE2951),
+          UL64(0x7FFEE43321B0612A), UL64(0x12F775E42EB821D0) },
+        { UL64(0xF8D112E76E6485B3), UL64(0x4D3E24DB771C52F8),
+          UL64(0x48E3EE41684A2F6D), UL64(0x7161957D21D95551),
+          UL64(0x19631283CDB12A6C), UL64(0xBF3FA8822E50E164),
+          UL64(0xF6254B633166CC73), UL64(0x3AEFA7AEAEE8CC38) },
+        { UL64(0x46F7008037A929A9), UL64(0x65601A8E19FEC6BD),
+          UL64(0x537F5EDC12AB8B62), UL64(0xE497CD955E5990CF),
+          UL64(0x2FCD387F9AA5B2F9), UL64(0xE5FAA3FF67B78FE8),
+          UL64(0x1BCF538D295D5E30), UL64(0x3A573239A813A7EC) },
+        { UL64(0xE9F5286BD17C2409), UL64(0x2C4E479363264D9B),
+          UL64(0x177042B117F6880F), UL64(0x39B7E2C84CE1EE43),
+          UL64(0xCEC8E722D096F4A9), UL64(0x6861AECBBED5E697),
+          UL64(0xC2D153F06C231911), UL64(0xCC2F42B82890537A) },
+        { UL64(0x33E2CB51D0A917B4), UL64(0xC2CFA3F34899F931),
+          UL64(0xB2C94F4BE9A2F6B6), UL64(0x9707B1817CA162B7),
+          UL64(0xB602A172D5F8B10D), UL64(0xFD3078354FD4542A),
+          UL64(0xEEF226DDDD996992), UL64(0x221FA989EB0A15E1) },
+        { UL64(0x79B0FE623B36F9FD), UL64(0x26543B23FDE19FC0),
+          UL64(0x136E64A0958482EF), UL64(0x23F637719B095825),
+          UL64(0x14CFD596B6A1142E), UL64(0x5EA6AAC6335AAC0B),
+          UL64(0x86A0E8BDF3081DD5), UL64(0x5FB89D79003DC12A) },
+        { UL64(0x73628677DE1132A3), UL64(0x75127E642FA88847),
+          UL64(0x192F7A305B49E660), UL64(0x1A063CFE11436AA9),
+          UL64(0x720014574B710189), UL64(0xFAA946DE2A57378D),
+          UL64(0x5C495C63191C3066), UL64(0x2B4B7E656B7DB4DB) },
+        { UL64(0xA4E3D27AD0630413), UL64(0x5770E38219FA56EB),
+          UL64(0x4465CF7A754C0666), UL64(0xFE9161D26169C5F3),
+          UL64(0x5DF62722DC0EE348), UL64(0x9CC6596A29890454),
+          UL64(0xF043D6189F5D322A), UL64(0xB4CE957A181EE3E9) },
+        { UL64(0x08190A49FE5C62ED), UL64(0x2C57543D3691183D),
+          UL64(0x75EE318BA9044823), UL64(0xD20CE09EAEF28F58),
+          UL64(0x10613D50848A4A66), UL64(0x4B98A1A89FCF2EFB),
+          UL64(0x415F1ED998FC6427), UL64(0x086ABB56E3852B50) },
+        { UL64(0xF615C33AF72E34D4), UL64(0x0BD9EA40110EEC35),
+          UL64(0x1C12BC5BC1DEA34E), UL64(0x686584C949AE4699),
+          UL64(0x13AD95D38C97B942), UL64(0x4609561A4E5C7562),
+          UL64(0x9E94A4AEF2737F89), UL64(0xF57594C6371C78B6) },
+        { UL64(0x5A768CD919EDA9DE), UL64(0x6E3206F48E2A51D2),
+          UL64(0xD356E8C08678A3EF), UL64(0x93F8D36D543F91C9),
+          UL64(0xFEF231F4A4086743), UL64(0x4D379A119148C6C9),
+          UL64(0x00B5581DDC8232CE), UL64(0xA67A72EFD702214B) },
+        { UL64(0x6145A9F617B4E892), UL64(0xFE6402275F229FF1),
+          UL64(0x6DB03EA8DC046BA3), UL64(0x71C873D60351DACC),
+          UL64(0x4BAEE337C2947B5B), UL64(0x900885C7B08B4380),
+          UL64(0x1F1EA661C84579B9), UL64(0xCCDDBB93A5017818) },
+        { UL64(0x554D883DCF9FB480), UL64(0x76CA71C50DFB9A4D),
+          UL64(0xC251142BE04240EA), UL64(0x899BA63DFA7AFC99),
+          UL64(0xED945B129FBBCDA3), UL64(0x3C4DD528A299A4CC),
+          UL64(0x68E8B6098A63C092), UL64(0xECF50A6C3F40621B) },
+        { UL64(0x0F0165FCE3779EE3), UL64(0xE00E7F9DBD495D9E),
+          UL64(0x1FA4EFA220284E7A), UL64(0x4564BADE47AC6219),
+          UL64(0x90E6312AC4708E8E), UL64(0x4F5725FBA71E9ADF),
+          UL64(0xE95F55AE3D684B9F), UL64(0x47F7CCB11E94B415) },
+        { UL64(0x50FD48BEA8ADC201), UL64(0xCE18180040DF06A8),
+          UL64(0x6C07CA42DE82CE22), UL64(0x23646C515A24761A),
+          UL64(0x46CF91F8B268392F), UL64(0xE4B757FF81811486),
+          UL64(0x94DD570BD26102A0), UL64(0x2DC34D2D3E65DF80) },
+        { UL64(0x18FEAF4456DE56D3), UL64(0xB39568E861027922),
+          UL64(0xA2B8685C28A458DC), UL64(0x41A8BF6C6295A817),
+          UL64(0x7B294074CA98D1DC), UL64(0x94C48259B3E013BE),
+          UL64(0xB42ED5242C4F5256), UL64(0x308E8950DA7C9FEC) },
+        { UL64(0x46027083316C541D), UL64(0x7F05BC6BD39EABCC),
+          UL64(0xB837FAA160C20CDC), UL64(0x4F8BF31AACD39D06),
+          UL64(0x8331DC9500512051), UL64(0x5374F462AF2AA2AC),
+          UL64(0x7673D9B4F32AB1A3), UL64(0xA6E151ACD64F49FC) },
+        { UL64(0x7322851B8D946581), UL64(0xF0D13133BDF4A012),
+          UL64(0xA3510F696584DAE0), UL64(0x03A7C1713C9F6C6D),
+          UL64(0x5BE97F38E475381A), UL64(0xCA1BA42285823334),
+          UL64(0xF83CC5C70BE17DDA), UL64(0x158B14940B918C0F) },
+        { UL64(0xB7188A88DBA5F705), UL64(0x5CFEFCA6A1FAD88B),
+          UL64(0xED2D8804338E8595), UL64(0xC0230BF87EB40981),
+          UL64(0x3ED1F1784B87F7C7), UL64(0x9D1D60767F9ED02A),
+          UL64(0x2290268BF23F8D5B), UL64(0xAD904C3586D368B9) },
+        { UL64(0xDC6496052AFBD682), UL64(0xAC08FB131637B0B1),
+          UL64(0xDF9FD488A184F39D), UL64(0x1FC2BC23ACE325B2),
+          UL64(0x29873B36BD6C9A84), UL64(0x462C11153CF8529D),
+          UL64(0xB3E0370DC555212D), UL64(0x31F83F7589AAECC6) },
+        { UL64(0xB1DF7431B7DE5A99), UL64(0xFB528EE6F295873C),
+          UL64(0xECA1500FCC303C95), UL64(0xDB390597CE33B760),
+          UL64(0xD6961486E4769736), UL64(0xD245E428C3339DA2),
+          UL64(0xF5CA7F41FA106CCE), UL64(0x37EDB1327080ACDD) },
+        { UL64(0xDA3A77E5522E6B69), UL64(0x69C908C3BBCD6C18),
+          UL64(0x1F1B9E48D924FD56), UL64(0x37C64E36AA4BB3F7),
+          UL64(0x5A4FDBDFEE478D7D), UL64(0xBA75C8BC0193F7A0),
+          UL64(0x84BC1E8456CD16DF), UL64(0x1FB08F0846FAD151) },
+        { UL64(0x293301EFB26BBB36), UL64(0x4568CAF8A9644DFA),
+          UL64(0x0DACAE053E0C3C0C), UL64(0x2BA6D502ECA651A8),
+          UL64(0xE3BD59686004610B), UL64(0xC2076AF6282B7245),
+          UL64(0xAE61F24A1E94E9A4), UL64(0x0315995C1576F163) },
+        { UL64(0x2AF8FF3D74571547), UL64(0x7EB3EA072CE19B19),
+          UL64(0xB81B62889B099985), UL64(0xDFEC22D6EAA309C5),
+          UL64(0xF9B5A0E2CFC33419), UL64(0x70BFB69CDB65B3A0),
+          UL64(0x75EC15563F524D95), UL64(0xE5ED9737E0802F30) },
+        { UL64(0x6AE7F42B04C753E0), UL64(0x26094200E606D46C),
+          UL64(0x3AB02F39F680DCA4), UL64(0x9B8853A9733B37DA),
+          UL64(0x2E1134AE855D386A), UL64(0xD8A8BEE188ED9B61),
+          UL64(0x2FA08BC083EDD459), UL64(0x944D21512D0FE168) },
+        { UL64(0x8A7CABF9842E9F30), UL64(0xA331D4BF5EAB83AF),
+          UL64(0xD272CFBA017F2A6A), UL64(0x27560ABC83ABA0E3),
+          UL64(0x94B833870E3A6B75), UL64(0x25C6AEA26B9F50F5),
+          UL64(0x803D691DB5FDF6D0), UL64(0x03B77509E6333514) },
+        { UL64(0x745EE234BD14CF6F), UL64(0xDE8B508449C024BB),
+          UL64(0x9C334FDDEF35D7B4), UL64(0xFF647728B764B2B4),
+          UL64(0xF94DEED7CC21E031), UL64(0xE34740B8A0D82885),
+          UL64(0xA70317C4C785D2FB), UL64(0xDC056AC5F8A58CAE) },
+        { UL64(0xC4274E8E8878045F), UL64(0x216698EBEBC325E0),
+          UL64(0x0FEFBBCF09396C56), UL64(0xDC1919150491805E),
+          UL64(0xA74C4E875C5480A2), UL64(0xDEA8D1B372C8CE0A),
+          UL64(0x679F701D7F77FAC1), UL64(0x3EBA00B56D6AB570) },
+        { UL64(0x08004E20F22350CE), UL64(0x6B4545198D601C4E),
+          UL64(0xEA09DC5AD5E177D5), UL64(0x923E19AA7534BAD9),
+          UL64(0xA42905A63180C046), UL64(0x0C279ED0D3C864AA),
+          UL64(0x49F341B6FF905A51), UL64(0x2BE20988A7966B32) },
+        { UL64(0x3617890361A341C1), UL64(0x3604DC600CFD6142),
+          UL64(0x022295EB8533316C), UL64(0x3DBDE4AC44AF2922),
+          UL64(0x898AFC5D1C7EEF69), UL64(0x58896805D14F4FA1),
+          UL64(0x05002160203C21CA), UL64(0x6F0D1F3040EF730B) },
+    },
+    {
+        { UL64(0xFABF770977F7195A), UL64(0x8EC86167ADEB838F),
+          UL64(0xEA1285A8BB4F012D), UL64(0xD68835039A3EAB3F),
+          UL64(0xEE5D24F8309004C2), UL64(0xA96E4B7613FFE95E),
+          UL64(0x0CDFFE12BD223EA4), UL64(0x8F5C2EE5B6739A53) },
+        { UL64(0xED406AA9BD763802), UL64(0xC21486A065303DA1),
+          UL64(0x61AE291EC7E62EC4), UL64(0x622A0492DF99333E),
+          UL64(0x7FD80C9DBB7A8EE0), UL64(0xDC2ED3BC6C01AEDB),
+          UL64(0x35C35A1208BE74EC), UL64(0xD540CB1A469F671F) },
+        { UL64(0x2CE53C5ABF776F5B), UL64(0x6F72407160357B05),
+          UL64(0xB259371771BF3F7A), UL64(0x87D2501C440C4A9F),
+          UL64(0x440552E187B05340), UL64(0xB7BF7CC821624C32),
+          UL64(0x4155A6CE22FACDDB), UL64(0x5A4228CB889837EF) },
+        { UL64(0xA7A8746A584C5E20), UL64(0x267E4EA1B9DC7035),
+          UL64(0x593A15CFB9548C9B), UL64(0x5E6E21354BD012F3),
+          UL64(0xDF31CC6A8C8F936E), UL64(0x8AF84D04B5C241DC),
+          UL64(0x63990A6F345EFB86), UL64(0x6FEF4E61B9B962CB) },
+        { UL64(0x23C48246E1A2E48D), UL64(0xF015E6D1543DCE5C),
+          UL64(0xD19EDB52286D1DE9), UL64(0xD60787F6DF826F56),
+          UL64(0x6E1D5DFE1C1459E3), UL64(0x26E899A49EB06CDC),
+          UL64(0x029560C914A1FBDB), UL64(0x8B78842FB3D3B4F5) },
+        { UL64(0xC56DFA9C22BEECCB), UL64(0x9C41A94AA188D7C0),
+          UL64(0x36C283A170324729), UL64(0x2DA0E250B63F6511),
+          UL64(0x834D9FD27B5E24A0), UL64(0xAC26B71B6C34DD42),
+          UL64(0xE5F1B497329336D9), UL64(0xDC681ACF39E94A9D) },
+        { UL64(0x5C80CCEF6CD77B30), UL64(0x49978299EC99B6D0),
+          UL64(0x6BF4485EB939D335), UL64(0xC53E61AB86D7C147),
+          UL64(0xDD948052FB601DDD), UL64(0x34C5EB393511DD48),
+          UL64(0x91F5C67600E6F61C), UL64(0x33F1B525B1E71F34) },
+        { UL64(0xF6368F0925722608), UL64(0x131260DB131CF5C6),
+          UL64(0x40EB353BFAB4F7AC), UL64(0x85C7888037EEE829),
+          UL64(0x4C1581FFC3BDF24E), UL64(0x5BFF75CBF5C3C5A8),
+          UL64(0x35E8C83FA14E6F40), UL64(0xB81D1C0F0295E0CA) },
+        { UL64(0xDE7153F8EED9DD1D), UL64(0xBA09AD1152EBCB2E),
+          UL64(0xAA41B015E1843FB6), UL64(0xF933A2ABDD4CE6F0),
+          UL64(0x777F834313F6B83F), UL64(0x28DF7DA4DB113A75),
+          UL64(0x6D7D1B3C72A5D143), UL64(0x6F789698966C6DDF) },
+        { UL64(0xED439A33A72BA054), UL64(0xA3170A15EAD265BA),
+          UL64(0xCF7EB903FE99A58E), UL64(0xCF6DB0C633D80C26),
+          UL64(0xD031255EF613E71A), UL64(0x12CCBE5718CA255C),
+          UL64(0xDD21D0537808C40D), UL64(0xF5488EBC3AF2BE6B) },
+        { UL64(0x47110D7C1BE3F9C5), UL64(0x12B9E4485EADB4DD),
+          UL64(0x6E8C09870B713D41), UL64(0xE1E20356733D56AE),
+          UL64(0xE68D6BAB445EA727), UL64(0x9EF4F6EAC934A1A4),
+          UL64(0xE0155547F8CEF1C3), UL64(0xDB5C3909159BDCBF) },
+        { UL64(0xF2EFE23D442A8AD1), UL64(0xC3816A7D06B9C164),
+          UL64(0xA9DF2D8BDC0AA5E5), UL64(0x191AE46F120A8E65),
+          UL64(0x83667F8700611C5B), UL64(0x83171ED7FF109948),
+          UL64(0x33A2ECF8CA695952), UL64(0xFA4A73EEF48D1A13) },
+        { UL64(0x97CACF846604007D), UL64(0x1E92B4B22D47A9F1),
+          UL64(0x858AE0D6374ED165), UL64(0x4C973E6F307AEFB8),
+          UL64(0x6F524A238A10EB72), UL64(0x7B4A92A9EB2849D6),
+          UL64(0x3678BDA42FE91EDD), UL64(0x56092ACD7C0FC35C) },
+        { UL64(0x3513E9F10B10E517), UL64(0x407D25446981C1D4),
+          UL64(0x4953A84860D9ABC1), UL64(0xE38DBDE48C4FD5D0),
+          UL64(0x7E5216C581BB5AB1), UL64(0x328A046B06C5E0A1),
+          UL64(0x5234F64491165EA6), UL64(0xB6E68B0FCFAC0D36) },
+        { UL64(0x091D5B631A093B40), UL64(0xB85C1C075862F24A),
+          UL64(0xC5D74EB53E8F85BF), UL64(0xF51C7746CAB22456),
+          UL64(0xC25CB8D9E761DA89), UL64(0x2670EC2FC0F028B5),
+          UL64(0x873FD30D2DB9AF5C), UL64(0x3D0F1EA18262565E) },
+        { UL64(0xFCDE7CC8F43A730F), UL64(0xE89B6F3C33AB590E),
+          UL64(0xC823F529AD03240B), UL64(0x82B79AFE98BEA5DB),
+          UL64(0x568F2856962FE5DE), UL64(0x0C590ADB60C591F3),
+          UL64(0x1FC74A144A28A858), UL64(0x3B662498B3203F4C) },
+        { UL64(0x755C30E288CE8C4F), UL64(0x56638FC821633C3D),
+          UL64(0x886000FFA05A7C2D), UL64(0x8F92E531010218C6),
+          UL64(0x09EE7903B81764A3), UL64(0x95C236973C634791),
+          UL64(0x3CECF5224E8E2F13), UL64(0x5D1ED66C23C34FF8) },
+        { UL64(0x9EAEFB221930B3BF), UL64(0x25C06B0822A19C73),
+          UL64(0xD0A8572A4BD3A498), UL64(0x20BC852F0CD76351),
+          UL64(0x8301386DB38925DA), UL64(0x85FBE66A64ECF285),
+          UL64(0x53747E84C0C9617F), UL64(0xB0D61D261DBE1772) },
+        { UL64(0xE584C2958D0DFF8A), UL64(0x552BF48BEF246305),
+          UL64(0xC09C21A54F45DB3E), UL64(0xCA3083EC3CEEBB8F),
+          UL64(0xBF4DD07C406DC6E2), UL64(0x0E96626DA7F63001),
+          UL64(0x81A9FBFEAA16CBD3), UL64(0xFE7ECA5C673A1300) },
+        { UL64(0x48FC4ED082DD1B6A), UL64(0x5783A13867B703AF),
+          UL64(0x2463CB9A005D6AAA), UL64(0xD31EC55C706ECD43),
+          UL64(0x9F8ED33F8E9A7641), UL64(0x625453ED098D9E7A),
+          UL64(0xA3BEADE4EC887493), UL64(0x442B80505A795566) },
+        { UL64(0x980C62310C965017), UL64(0xAF8CC0B3400D7A4F),
+          UL64(0xEE5812E248F4CF97), UL64(0xE4587EB8BB90D95E),
+          UL64(0x1B42A57F8152045E), UL64(0xD792B906641C7C2E),
+          UL64(0x9DFCF593A71C87DA), UL64(0xC7AB7D771B0400B9) },
+        { UL64(0x16952D34D85A70E2), UL64(0x7D09FF97C32E1A52),
+          UL64(0xCAD6E43EA62D8ABF), UL64(0x747646DA25AAFEBB),
+          UL64(0x0365C496E54E24BD), UL64(0x1499A41624E850E3),
+          UL64(0x24F6DDF76781D22B), UL64(0x42E555F1BFC35981) },
+        { UL64(0x5B2319C2FACD3338), UL64(0xED9650476F883ED1),
+          UL64(0x370796C316831619), UL64(0x8DB73469206B61AA),
+          UL64(0x0A0E5D171FA908E8), UL64(0xE87271E3B45440FA),
+          UL64(0x7F6AE03E072BDB98), UL64(0x0687F75528C3B98A) },
+        { UL64(0x91E3CF0D6C39765A), UL64(0xA2DB3ACDAC3CCA0B),
+          UL64(0x288F2F08CB953B50), UL64(0x2414582CCF43CF1A),
+          UL64(0x8DEC8BBC60EEE9A8), UL64(0x54C79F02729AA042),
+          UL64(0xD81CD5EC6532F5D5), UL64(0xA672303ACF82E15F) },
+        { UL64(0xB3BD03E2C373F5FF), UL64(0x80A8A8B4E7FC6341),
+          UL64(0xB72952D6A0087BDF), UL64(0x803CBB9DC048A38E),
+          UL64(0xCF0A657ECCF8B000), UL64(0x8C54C01867E1EB09),
+          UL64(0x88F91026F0B646FC), UL64(0x9D0DF2537DFF4BD8) },
+        { UL64(0x4EFBC98048C6D542), UL64(0x269CC200C925F42E),
+          UL64(0xB55A446ABCF6FE3E), UL64(0xB002DBD5AC67E5C5),
+          UL64(0x91ECEE64EEDA8ED8), UL64(0x8989F92DBAE071D2),
+          UL64(0x9245DBE0AF7EBF53), UL64(0xD141E6E79EEFA781) },
+        { UL64(0x9728490B2DEB7E9F), UL64(0x8877C3C602C7256B),
+          UL64(0xD29DAA1D2232AF73), UL64(0xC94B90211AB049E8),
+          UL64(0xDBE4DF53E6E4BF94), UL64(0x4A7324E74D7B1006),
+          UL64(0x0446D4560A6A8BDF), UL64(0xABF2F98B5CA35589) },
+        { UL64(0x46DF582D3BFAB839), UL64(0x92474E042F8ADADE),
+          UL64(0x36A7766A147A1BC3), UL64(0xB6940F540DC0F979),
+          UL64(0x44738EF2F2759F25), UL64(0x9DD95789A719F4C6),
+          UL64(0x2859B7F40750C345), UL64(0x5E788BF2B22180D5) },
+        { UL64(0x4B215F016671B47E), UL64(0xB67633CA4A8DAE2A),
+          UL64(0x2915120F79FD3CDB), UL64(0xC1F8A06FB064E6DE),
+          UL64(0xF4D5368CC1D57420), UL64(0x6ADA51A8E18DE475),
+          UL64(0xA0F0D47CC749D4B0), UL64(0xABFA2C0074526AA5) },
+        { UL64(0x3FF2B773FC59173C), UL64(0xF68612A5A2A0919C),
+          UL64(0x9CA8AE28234C7B15), UL64(0xFDF658AFEDBEE7DC),
+          UL64(0x2C55D9ADAB18965F), UL64(0xB9901F125C00DE44),
+          UL64(0x8B70AAF1EE360B51), UL64(0x3E4BA9D505604FE0) },
+        { UL64(0xBEB8E482F0D2772B), UL64(0xC516AB652DE60699),
+          UL64(0x1E4F1E34C6D4F7F9), UL64(0x239888BF5CECE4EE),
+          UL64(0x7AC586FEBC03D238), UL64(0x8CD3C7157D353A6F),
+          UL64(0x0296AADEB3F1FD65), UL64(0xE3B8EDD43A1E535F) },
+        { UL64(0x376AAFA8719C0563), UL64(0xCD8AD2DCBC5FC79F),
+          UL64(0x303FDB9FCB750CD3), UL64(0x14FF052F4418B08E),
+          UL64(0xF75084CF3E2D6520), UL64(0x7EBDF0F8144ED509),
+          UL64(0xF43BF0F2D3F25B98), UL64(0x86AD71CFA354D837) },
+    },
+    {
+        { UL64(0xD9D0C8C4868AF75D), UL64(0xD7325CFF45C8C7EA),
+          UL64(0xAB471996CC81ECB0), UL64(0xFF5D55F3611824ED),
+          UL64(0xBE3145411977A0EE), UL64(0x5085C4C5722038C6),
+          UL64(0x2D5335BFF94BB495), UL64(0x894AD8A6C8E2A082) },
+        { UL64(0x540234B22C11BB37), UL64(0x2D0366DDED4C74A3),
+          UL64(0xF9A968DAEEC5F25D), UL64(0x3660106867B63142),
+          UL64(0x07CD6D2C68D7B6D4), UL64(0xA8F74F090C842942),
+          UL64(0xE27514047768B1EE), UL64(0x4B5F7E89FE62AEE4) },
+        { UL64(0xD1E059B21994EF20), UL64(0x2A653B69638AE318),
+          UL64(0x70D5EB582F699010), UL64(0x279739F709F5F84A),
+          UL64(0x5DA4663C8B799336), UL64(0xFDFDF14D203C37EB),
+          UL64(0x32D8A9DCA1DBFB2D), UL64(0xAB40CFF077D48F9B) },
+        { UL64(0xF2369F0B879FBBED), UL64(0x0FF0AE86DA9D1869),
+          UL64(0x5251D75956766F45), UL64(0x4984D8C02BE8D0FC),
+          UL64(0x7ECC95A6D21008F0), UL64(0x29BD54A03A1A1C49),
+          UL64(0xAB9828C5D26C50F3), UL64(0x32C0087C51D0D251) },
+        { UL64(0xF61790ABFBAF50A5), UL64(0xDF55E76B684E0750),
+          UL64(0xEC516DA7F176B005), UL64(0x575553BB7A2DDDC7),
+          UL64(0x37C87CA3553AFA73), UL64(0x315F3FFC4D55C251),
+          UL64(0xE846442AAF3E5D35), UL64(0x61B911496495FF28) },
+        { UL64(0x47FEEB6662B5F3AF), UL64(0xCEFAB5610ABB3734),
+          UL64(0x449DE60E19F35CB1), UL64(0x39F8DB14157F0EB9),
+          UL64(0xFFAECC5B3C61BFD6), UL64(0xA5A4D41D41216703),
+          UL64(0x7F8FABED224E1CC2), UL64(0x0D5A8186871AD953) },
+        { UL64(0x4BDF3A4956F90823), UL64(0xBA0F5080741D777B),
+          UL64(0x091D71C3F38BF760), UL64(0x9633D50F9B625B02),
+          UL64(0x03ECB743B8C9DE61), UL64(0xB47512545DE74720),
+          UL64(0x9F9DEFC974CE1CB2), UL64(0x774A4F6A00BD32EF) },
+        { UL64(0x190D8EA601799A52), UL64(0xA20CEC41B86D2952),
+          UL64(0x3062FFB27FFF2A7C), UL64(0x741B32E579F19D37),
+          UL64(0xF80D81814EB57D47), UL64(0x7A2D0ED416AEF06B),
+          UL64(0x09735FB01CECB588), UL64(0x1641CAAAC6061F5B) },
+        { UL64(0x327BC002B0131E5B), UL64(0x1739E6D5CB2514D9),
+          UL64(0xC8CBDAFE55A81543), UL64(0x5BB1A36CE1137243),
+          UL64(0x205DA3C517325327), UL64(0xC35C1A36515A057E),
+          UL64(0xF00F64C942925F9B), UL64(0xBD14633CB7D59F7A) },
+        { UL64(0xAE2AD171656E8C3A), UL64(0xC0E2A4631ACD0705),
+          UL64(0x006F6A8AA0B6055C), UL64(0xAF4513D72B65A26E),
+          UL64(0x3F549E14D616D5BC), UL64(0x64EE395571253B1F),
+          UL64(0xE8B10BC1B8CE243A), UL64(0xBCBEACE5913A4E77) },
+        { UL64(0x47C1004341F37DBD), UL64(0x96ECCAE36168ECF6),
+          UL64(0x65BDE59D1CA46AA3), UL64(0x38A7027AB8698FFA),
+          UL64(0xA2B89DC86DC34437), UL64(0x5A0A118D43A4153F),
+          UL64(0x9E330A861CE22FD8), UL64(0x28382AF6B3BBD3BC) },
+        { UL64(0x68D32256F779D6A7), UL64(0x20423B4D19E7284E),
+          UL64(0xDE19AA1B38F3B153), UL64(0x73D0B6C28444F703),
+          UL64(0x666161489C64E6A3), UL64(0x99587C3737256224),
+          UL64(0x6F5277FE61331563), UL64(0x7174AD4AA656502E) },
+        { UL64(0x0B2E27C0D81E0271), UL64(0xA67A7596117A317C),
+          UL64(0x17F08928A6723D99), UL64(0x71A75681485310A3),
+          UL64(0x90465462AFB66CA9), UL64(0x185E97CCFBBE229D),
+          UL64(0x6A1A606ADDAD8FC2), UL64(0x2431F316B3C797CF) },
+        { UL64(0xEC1FFC920133918D), UL64(0x15D9BF5EB2C9EF97),
+          UL64(0x7885B542FC6CBB9A), UL64(0x8ABE64535720CF5D),
+          UL64(0x4E715DCED4EC68AB), UL64(0x57A67614279C24A3),
+          UL64(0x788ED52A31BB61CF), UL64(0xABA82444F437A003) },
+        { UL64(0x4703401193529432), UL64(0x1F106BDD30743462),
+          UL64(0xABFB9964CD66D8CA), UL64(0x934D9D5AE9BDADD5),
+          UL64(0x5976D815908E3D22), UL64(0x344A362F28E057BD),
+          UL64(0xF92CDADC5443DFB3), UL64(0x001297ADF089603B) },
+        { UL64(0x7F99824F20151427), UL64(0x206828B692430206),
+          UL64(0xAA9097D7E1112357), UL64(0xACF9A2F209E414EC),
+          UL64(0xDBDAC9DA27915356), UL64(0x7E0734B7001EFEE3),
+          UL64(0x54FAB5BBD2B288E2), UL64(0x4C630FC4F62DD09C) },
+        { UL64(0x4A2FCE605044066B), UL64(0x904A019CFA3A47F4),
+          UL64(0xBA81EA9C0C5C0A60), UL64(0xD7E4EA0D96C098BD),
+          UL64(0xEFE700419CD50A02), UL64(0xC0C839D42D7F048C),
+          UL64(0xE2DAF264E09B561F), UL64(0x0CBC13185034B18B) },
+        { UL64(0x6D883E66BD70A5E1), UL64(0x9BD884C1D05DE713),
+          UL64(0x48D9D445D4D8487D), UL64(0x8440CD8B0EEAE405),
+          UL64(0xA3CD0F293D26F83E), UL64(0x3FD9453022A3C5E4),
+          UL64(0x63A078663FFA2CA7), UL64(0xBFEADD2900D4A097) },
+        { UL64(0x11E5F2E388323F7A), UL64(0xE07A74C2927584CD),
+          UL64(0x1E774B3495613D2D), UL64(0x9C9B52C52C787488),
+          UL64(0x3CDD3C3EBE421F08), UL64(0x5FF7819E223E3D5F),
+          UL64(0xBA8739B2C1DA09B9), UL64(0x6B7263164E8B491B) },
+        { UL64(0x13AEA559D68432BA), UL64(0x940043FBD33915DB),
+          UL64(0x476C7C94E2E8DA08), UL64(0x6B1630C4443065BB),
+          UL64(0xD6D8546D19F06C75), UL64(0x7E1E98C22EB35ABD),
+          UL64(0x751C9310F0157D8E), UL64(0xDEF84327F6FA6075) },
+        { UL64(0xB5AFD13CA0943BEF), UL64(0xD651772957ABB1CC),
+          UL64(0x9D5A52DC9B61B5BC), UL64(0x85CEFAA6806E31CD),
+          UL64(0xAB84257A720A1DEA), UL64(0x6A60261BCED70D35),
+          UL64(0xC023F94DB9D6DA61), UL64(0x947F7EEC54A0AE0E) },
+        { UL64(0x765B993C3A7A4E0E), UL64(0xFB8F4AEF9D79D314),
+          UL64(0x5EA2C50E2A19EB24), UL64(0x925016E5B891BC8C),
+          UL64(0x8F70AFDC3AD1ECE7), UL64(0x0ABBA84CF08FABE2),
+          UL64(0x0A9922C815F6132B), UL64(0x6C0213735D076D77) },
+        { UL64(0xC3B787569F83B787), UL64(0xD6D249263694DDD7),
+          UL64(0x58D248945D70A02E), UL64(0xAC16670E8C278C6A),
+          UL64(0x71A94D58E370B6E6), UL64(0xE4D763840253DB05),
+          UL64(0x99B1C98814B32CFE), UL64(0x4E6BD870CC78CC95) },
+        { UL64(0x00AF2615A4453961), UL64(0x1705494B993D112C),
+          UL64(0x0032E12AA1CDD652), UL64(0x0EBFA612046D9CB3),
+          UL64(0x9F03A9F31B63728C), UL64(0x8F3618A2DE022B05),
+          UL64(0xD5B24D903E77C5C9), UL64(0x837838A372ACB77C) },
+        { UL64(0xF5F7CA79C8B63614), UL64(0xF3BFB2158AF4903C),
+          UL64(0x2BDB9F5496D47BD3), UL64(0xD6E715300E8A63BA),
+          UL64(0x67E90A497A93BEC4), UL64(0x8613478B8C1E63EE),
+          UL64(0xE36BD9C8F2DDE561), UL64(0x681486518A768689) },
+        { UL64(0xFE65CBD98FCEB047), UL64(0xDE872EF53F8B11A1),
+          UL64(0x9ABA0D3D8FEC802F), UL64(0x139F1D329A9F381D),
+          UL64(0x0721AED9C587958D), UL64(0x066A015CB9F6A7DA),
+          UL64(0x059EC4E3ED5D9D06), UL64(0x144285716CBACA1F) },
+        { UL64(0xEF617A9494AA531C), UL64(0x9AC35E2FD6F4AD87),
+          UL64(0xBCD2A047122468FB), UL64(0xBD7A423FEF7C5CA6),
+          UL64(0xAB58CB52064C8040), UL64(0x93EF4ED54A644716),
+          UL64(0xF7D17097C32CD48D), UL64(0xB249A173D17FCF42) },
+        { UL64(0x66FE0FFFE298CDF5), UL64(0x3F61BEA47B2E51B6),
+          UL64(0x7D372117BAD3AFA4), UL64(0x6521A09CEF656E2F),
+          UL64(0xB3B8C966E8A58FE7), UL64(0x25203A115A47EBC7),
+          UL64(0xFE81588D5C4BE573), UL64(0x6132E2F31F49A03C) },
+        { UL64(0xBBE5C108B7A7ECC4), UL64(0x62A5A78EBFD22E4C),
+          UL64(0xB7974033DF188BD2), UL64(0xCF11DEEA4DF7D1AE),
+          UL64(0x99CC774A53ACE3EA), UL64(0xE0373A71105CC1F6),
+          UL64(0xD751987F133D7A20), UL64(0xAB86EE04AE215871) },
+        { UL64(0xEC1AB0130F8C2C99), UL64(0x60E8968FF17725C2),
+          UL64(0xE1A4A593940A980B), UL64(0x15ED15B020E9CCB1),
+          UL64(0x77D754CC64A00BEC), UL64(0x90D09C3341687382),
+          UL64(0x294FE02DC31FB651), UL64(0x8372CD1A1C94AE53) },
+        { UL64(0x2094F9A280CD10E6), UL64(0x045232AA7B8A0DA7),
+          UL64(0x969A81B69C03244E), UL64(0x1293B4CA7E98D955),
+          UL64(0x1631421DD68F3AB0), UL64(0xA0106422C3738C82),
+          UL64(0xC5F43845F82C4FF9), UL64(0xB479ACBE1AA0F58F) },
+        { UL64(0x8537107A1AC2703B), UL64(0xB49258D86BC857B5),
+          UL64(0x57DF14DEBCDACCD1), UL64(0x24AB68D7C4AE8529),
+          UL64(0x7ED8B5D4734E59D0), UL64(0x5F8740C8C495CC80),
+          UL64(0x84AEDD5A291DB9B3), UL64(0x80B360F84FB995BE) },
+    },
+    {
+        { UL64(0x55D5C68DA61A76FA), UL64(0x598B441DCA1554DC),
+          UL64(0xD39923B9773B279C), UL64(0x33331D3C36BF9EFC),
+          UL64(0x2D4C848E298DE399), UL64(0xCFDB8E77A1A27F56),
+          UL64(0x94C855EA57B8AB70), UL64(0xDCDB9DAE6F7879BA) },
+        { UL64(0x4C4F07367F636A38), UL64(0x9F943FB70E76D5CB),
+          UL64(0xB03510BAA8B68B8B), UL64(0xC246780A9ED07A1F),
+          UL64(0x3C0514156D549FC2), UL64(0xC2953F31607781CA),
+          UL64(0x955E2C69D8D95413), UL64(0xB300FADC7BD282E3) },
+        { UL64(0xA14B1163C27901B4), UL64(0xFD9236E0899B8BF3),
+          UL64(0x42B091ECCBC6DA0A), UL64(0xBB1DAC6F5AD1D297),
+          UL64(0x80E61D53A91CF76E), UL64(0x4110A412D31F1EE7),
+          UL64(0x2D87C3BA13EFCF77), UL64(0x1F374BB4DF450D76) },
+        { UL64(0x202886024147519A), UL64(0xD0981EAC26B372F0),
+          UL64(0xA9D4A7CAA785EBC8), UL64(0xD953C50DDBDF58E9),
+          UL64(0x9D6361CCFD590F8F), UL64(0x72E9626B44E6C917),
+          UL64(0x7FD9611022EB64CF), UL64(0x863EBB7E9EB288F3) },
+        { UL64(0x15E10A0A097E4403), UL64(0xCB3D0A8619854665),
+          UL64(0x88D8E211D67D4826), UL64(0xB39AF66E0B9D2839),
+          UL64(0xA5F94588BD475CA8), UL64(0xE06B7966C077B80B),
+          UL64(0xFEDB1485DA27C26C), UL64(0xD290D33AFE0FD5E0) },
+        { UL64(0x686202F31306583D), UL64(0x05B10DA0437C622E),
+          UL64(0xBF9AAA0F076A7BC8), UL64(0x25E94EFB8F8F4E43),
+          UL64(0x8A35C9B7FA3DC26D), UL64(0xE0E5FB9396FF03C5),
+          UL64(0xA77E3843EBC394CE), UL64(0xCEDE65958361DE60) },
+        { UL64(0xBF9075090C22B540), UL64(0x2CDE42AAB7C267D4),
+          UL64(0xBA18F9ED5AB0D693), UL64(0x3BA62AA66E4660D9),
+          UL64(0xB24BF97BAB9EA96A), UL64(0x5D039642E3B60E32),
+          UL64(0x4E6A45067C4D9BD5), UL64(0x666C5B9E7ED4A6A4) },
+        { UL64(0x877B7CF5678A31B0), UL64(0xD50301AE3998B620),
+          UL64(0x734257C5C00FB396), UL64(0xF9FB18A004E672A6),
+          UL64(0xFF8BD8EBE8758851), UL64(0x1E64E4C65D99BA44),
+          UL64(0x4B8EAEDF7DFD93B7), UL64(0xBA2F2A9804E76B8C) },
+        { UL64(0xAE02A2F09B56DDBD), UL64(0x1339B5AC8A2F1CF3),
+          UL64(0xF2B569C7839DFF0D), UL64(0xB0B9E864FEE9A43D),
+          UL64(0x4FF8CA4177BB064E), UL64(0x145A2812FD249F63),
+          UL64(0x3AB7BEACF86F689A), UL64(0x9BAFEC2701D35F5E) },
+        { UL64(0xBBA23FDDAE57C7B7), UL64(0x345342F21B932522),
+          UL64(0xFD9C80FE556D4AA3), UL64(0xA03907BA6525BB61),
+          UL64(0x38B010E1FF218933), UL64(0xC066B654AA52117B),
+          UL64(0x8E14192094F2E6EA), UL64(0x66A27DCA0D32F2B2) },
+        { UL64(0xB2E6B121FBABBE92), UL64(0x281850FBE1330076),
+          UL64(0x093581EC97890015), UL64(0x69B1DDED75FF77F5),
+          UL64(0x7CF0B18FAB105105), UL64(0x953CED31A89CCFEF),
+          UL64(0x3151F85FEB914009), UL64(0x3C9F1B8788ED48AD) },
+        { UL64(0xA18F07E0E90FB21E), UL64(0x00FD2B80BBA7FCA1),
+          UL64(0x20387F2795CD67B5), UL64(0x5B89A4E7D39707F7),
+          UL64(0x8F83AD3F894407CE), UL64(0xA0025B946C226132),
+          UL64(0xC79563C7F906C13B), UL64(0x5F548F314E7BB025) },
+        { UL64(0xFF7589494FDE0C1F), UL64(0xBF8A1ABEE5B6EC20),
+          UL64(0x702278FB87E1DB6C), UL64(0xC447AD7A35ED658F),
+          UL64(0x48D4AA3803D0CCF2), UL64(0x80ACB338819A7C03),
+          UL64(0x9BC7C89E6E17CECC), UL64(0x46736B8B03BE1D82) },
+        { UL64(0x2126F742D43B5EAA), UL64(0x054A0766DFA59B85),
+          UL64(0x9D0D5E36126BFD45), UL64(0xA1F8FBD7384F8A8F),
+          UL64(0x317680F5D563FCCC), UL64(0x48CA5055F280A928),
+          UL64(0xE00B81B227B578CF), UL64(0x10AAD9182994A514) },
+        { UL64(0xE63F301F358BCDC0), UL64(0x07689E990A9D47F8),
+          UL64(0x1F689E2F4F43D43A), UL64(0x4D542A1690920904),
+          UL64(0xAEA293D59CA0A707), UL64(0xD061FE458AC68065),
+          UL64(0x1033BF1B0090008C), UL64(0x29749558C08A6DB6) },
+        { UL64(0x0EE6D3A7C35D8794), UL64(0x042E65580356BAE5),
+          UL64(0x9F59698D643322FD), UL64(0x9379AE1550A61967),
+          UL64(0x64B9AE62FCC9981E), UL64(0xAED3D6316D2934C6),
+          UL64(0x2454B3025E4E65EB), UL64(0xAB09F647F9950428) },
+        { UL64(0x34C99E50A66E71CD), UL64(0x1794F91575B713E9),
+          UL64(0x1E40DE90E04557B9), UL64(0x3C178C8B267D5618),
+          UL64(0x9062107DC97932AD), UL64(0xA2201D5281311BD3),
+          UL64(0x35D65EEBBC5BB79E), UL64(0xEF610FA6B75CF4D0) },
+        { UL64(0xC1702A6199E0CA30), UL64(0xBFD46A6B99560AE8),
+          UL64(0xB76BD5E6611CC30C), UL64(0x1E0EB78B755B986A),
+          UL64(0x7EF39F7734914BBD), UL64(0xE2C04CFFA19556EA),
+          UL64(0xF78B8ECE69D53157), UL64(0xD4E52678A6E10465) },
+        { UL64(0x3E40E5ECF614A37B), UL64(0x74F29D0406FA74C2),
+          UL64(0x6AFC95D861280D86), UL64(0xBAEAC702AEF1089F),
+          UL64(0xE42A7D2B3466B4AB), UL64(0x20F319D4C85DD595),
+          UL64(0xBA48491ED4F5C254), UL64(0xEDC1DDDB3331438A) },
+        { UL64(0xC1B3D3D331B85F09), UL64(0x0F45354AA88AE64A),
+          UL64(0xA8B626D32FEC50FD), UL64(0x1BDCFBD4E828834F),
+          UL64(0xE45A2866CD522539), UL64(0xFA9D4732810F7AB3),
+          UL64(0xD8C1D6B4C905F293), UL64(0x10AC80473461B597) },
+        { UL64(0x11EF9236C2436A05), UL64(0x97633EB6E54B303D),
+          UL64(0xD2174994FD9E0CF1), UL64(0x9511C14498D5EB8D),
+          UL64(0xE577FDC1E78C2E6C), UL64(0x8DF37401BE4F6577),
+          UL64(0x3B1282A5D38156A7), UL64(0xE07F96EB0716BE53) },
+        { UL64(0x29CD3837741F2591), UL64(0x4BDBC49D64396EE2),
+          UL64(0xE6597102269D268F), UL64(0x896B39C6CE9A6305),
+          UL64(0xC05E247110B30245), UL64(0x845219A8A9130072),
+          UL64(0x88158CB10E2A9FC2), UL64(0xCBC6F64139F191C6) },
+        { UL64(0x7EA34678D3B68256), UL64(0x01FD4AF594D90831),
+          UL64(0x7C914F2F6F2F9592), UL64(0xBA09D623F5B35508),
+          UL64(0x27BBDD74C1957C1A), UL64(0xAB2A5517D716D57C),
+          UL64(0xD3A4292D8F3F8552), UL64(0x46979CB2C6047C50) },
+        { UL64(0xE2C815366D91CD2C), UL64(0x40A2BEEADAA3F0E4),
+          UL64(0xFB167A592441E083), UL64(0x004675E9E9240347),
+          UL64(0x7848AAFF840E446E), UL64(0x9F9F258FEA308F72),
+          UL64(0x50F12899639BFAD9), UL64(0x0939AE63205C0AF6) },
+        { UL64(0xBCCDDE3E486D7938), UL64(0xAFB4C0EA81EA8F45),
+          UL64(0x3EF12A5CB2B552DA), UL64(0x6FE6A3783878EAE2),
+          UL64(0x3FB853988D548F55), UL64(0x47AAA3C5793C33AF),
+          UL64(0x494E2D21115AAB29), UL64(0xD2ADCEBA50BEACDE) },
+        { UL64(0x465D1236F195AFE5), UL64(0x03DB3C122DCD4413),
+          UL64(0xF1CF3B35C8F7B15D), UL64(0xBC8D30E2B54FC17F),
+          UL64(0xE73AA3B940E672AE), UL64(0xA032848D02F38F75),
+          UL64(0x1CA0DB213BB10A05), UL64(0xC5E9A72F688D902A) },
+        { UL64(0xF567DB5DE7E4DDBC), UL64(0xBE839B28E7613B63),
+          UL64(0x81CC77C67DA6040D), UL64(0x692B88FB234D1026),
+          UL64(0x6E9D35FAD0593582), UL64(0xC7413CFE56051B98),
+          UL64(0x3CCEED5EF46B2352), UL64(0xB76F16213AA45285) },
+        { UL64(0xBBB175146FC627E2), UL64(0xA0569BC591573A51),
+          UL64(0xA7016D9E358243D5), UL64(0x0DAC0C56AC1D6692),
+          UL64(0x993833B5DA590D5F), UL64(0xA8067803DE817491),
+          UL64(0x65B4F2124DBF75D0), UL64(0xCC960232CCF80CFB) },
+        { UL64(0x87DDF5F7BECC3C5E), UL64(0x21FEAFA76D35F8B9),
+          UL64(0x41279C51751D77CF), UL64(0x47C726EB6FC92B50),
+          UL64(0x4B18B7C84CFB54F4), UL64(0xB0F88DABA618CFEE),
+          UL64(0x3F469A005C95E0C8), UL64(0xCF1228F3D11839DF) },
+        { UL64(0x1F32CB54BD057D98), UL64(0x79051A02E1C45787),
+          UL64(0xAC8594207D7632CB), UL64(0xCE8B265BFE039421),
+          UL64(0x1F9E0D3E597E6848), UL64(0xD001F414E2640918),
+          UL64(0xE83748CD8A350DC9), UL64(0x0EDDC81E7B4F0444) },
+        { UL64(0x7A08948E45C6A9D0), UL64(0xB7293CE50C20D8B7),
+          UL64(0x715A572974670371), UL64(0x6AA9E798AE724540),
+          UL64(0x79D5EBECF971B642), UL64(0x6FD7B2BBAAD498F3),
+          UL64(0xFF46B6F93969D46B), UL64(0xD7389AE329D2E155) },
+        { UL64(0xB2083A1222248ACC), UL64(0x1F6EC0EF3264E366),
+          UL64(0x5659B7045AFDEE28), UL64(0x7A823A40E6430BB5),
+          UL64(0x24592A04E1900A79), UL64(0xCDE09D4AC9EE6576),
+          UL64(0x52B6463F4B5EA54A), UL64(0x1EFE9ED3D3CA65A7) },
+    },
+    {
+        { UL64(0xE27A6DBE305406DD), UL64(0x8EB7DC7FDD5D1957),
+          UL64(0xF54A6876387D4D8F), UL64(0x9C479409C7762DE4),
+          UL64(0xBE4D5B5D99B30778), UL64(0x25380C566E793682),
+          UL64(0x602D37F3DAC740E3), UL64(0x140DEABE1566E4AE) },
+        { UL64(0xEAEE6126C49A861E), UL64(0x024F3B65E14F0D06),
+          UL64(0x51A3F1E8C69BFC17), UL64(0xC3C3A8E9A7686381),
+          UL64(0x3400752CB103D4C8), UL64(0x02BC46139218B36B),
+          UL64(0xC67F75EB7651504A), UL64(0xD6848B56D02AEBFA) },
+        { UL64(0x958381DB1782269B), UL64(0xAE34BF792597E550),
+          UL64(0xBB5C60645F385153), UL64(0x6F0E96AFE3088048),
+          UL64(0xBF6A021577884456), UL64(0xB3B5688C69310EA7),
+          UL64(0x17C9429504FAD2DE), UL64(0xE020F0E517896D4D) },
+        { UL64(0xCCA4428DBBE5A1A9), UL64(0x8187FD5F3126BD67),
+          UL64(0x0036973A48105826), UL64(0xA39B6663B8BD61A0),
+          UL64(0x6D42DEEF2D65A808), UL64(0x4969044F94636B19),
+          UL64(0xF611EE47DD5D564C), UL64(0x7B2F3A49D2873077) },
+        { UL64(0x03B0D8DD0F82B214), UL64(0x460C34F9F103CBC6),
+          UL64(0xF32E5C0318D79E19), UL64(0x8B8888BAA84117F8),
+          UL64(0x8F3C37DCC0722677), UL64(0x10D21BE91C1C0F27),
+          UL64(0xD47C8468E0F7A0C6), UL64(0x9BF02213ADECC0E0) },
+        { UL64(0x97554160B7FE7B6E), UL64(0x7D16189A400A3FB2),
+          UL64(0xD73E9BEAE328CA1E), UL64(0x0DD04B97E793D8CC),
+          UL64(0xA9C83C9B506DB8CC), UL64(0x5CD47AAECF38814C),
+          UL64(0x26FC430DB64B45E6), UL64(0x079B5499D818EA84) },
+        { UL64(0x03B5D21AE0AC2941), UL64(0x279B0254C2D31937),
+          UL64(0x3307C052CAC992D0), UL64(0x6AA7CB92EFA8B1F3),
+          UL64(0x5A1825800D37C7A5), UL64(0x13380C37342D5422),
+          UL64(0x92AC2D66D5D2EF92), UL64(0x035A70C9030C63C6) },
+        { UL64(0x5109B78571BA1861), UL64(0x48B22D5CD0C8F93D),
+          UL64(0xE8FA84A78633BB93), UL64(0x53FBA6BA5AEBBD08),
+          UL64(0x7FF27DF3E5EEA7D8), UL64(0x521C879668CA7158),
+          UL64(0xB9D5133BCE6F1A05), UL64(0x2D50CD53FD0EBEE4) },
+        { UL64(0x14EBA133F74CFF17), UL64(0x240AAA03ECB813F2),
+          UL64(0xCFBB65406F665BEE), UL64(0x084B1FE4A425AD73),
+          UL64(0x009D5D16D081F6A6), UL64(0x35304FE8EEF82C90),
+          UL64(0xF20346D5AA9EAA22), UL64(0x0ADA9F07AC1C91E3) },
+        { UL64(0x7D9B3E23B40DF1CF), UL64(0x5933737394E971B4),
+          UL64(0xBF57BD14669CF921), UL64(0x865DAEDF0C1A1064),
+          UL64(0x3EB70BD383279125), UL64(0xBC3D5B9F34ECDAAB),
+          UL64(0x91E3ED7E5F755CAF), UL64(0x49699F54D41E6F02) },
+        { UL64(0x304177580F3E4834), UL64(0xFDBB21C217A9AFCB),
+          UL64(0x756FA17F2F9A67B3), UL64(0x2A6B2421A245C1A8),
+          UL64(0x64BE27944AF02291), UL64(0xADE465C62A5804FE),
+          UL64(0x8DFFBD39A6F08FD7), UL64(0xC4EFA84CAA14403B) },
+        { UL64(0xDAB4804647718427), UL64(0xDF17FF9B6E830F8B),
+          UL64(0x408D7EE8E49A1347), UL64(0x6AC71E2391C1D4AE),
+          UL64(0xC8CBB9FD1DEFD73C), UL64(0x19840657BBBBFEC5),
+          UL64(0x39DB1CB59E7EF8EA), UL64(0x78AA829664105F30) },
+        { UL64(0xCDBEF1C2065FEF4A), UL64(0x77E60F7DFD5B92E3),
+          UL64(0xD7C549F026708350), UL64(0x201B3AD034F121BF),
+          UL64(0x5FCAC2A10334FC14), UL64(0x8A9A9E09344552F6),
+          UL64(0x7DD8A1D397653082), UL64(0x5FC0738F79D4F289) },
+        { UL64(0x67608E71BD3502BA), UL64(0x4EF41F24B4DE75A0),
+          UL64(0xB08DDE5EFD6125E5), UL64(0xDE484825A409543F),
+          UL64(0x1F198D9865CC2295), UL64(0x428A37716E0EDFA2),
+          UL64(0x4F9697A2ADF35FC7), UL64(0x01A43C79F7CAC3C7) },
+        { UL64(0xC1258D5B7CAE440C), UL64(0x21C08B41402B7531),
+          UL64(0xF61A8955DE932321), UL64(0x3568FAF82D1408AF),
+          UL64(0x71B15E999ECF965B), UL64(0xF14ED248E917276F),
+          UL64(0xC6F4CAA1820CF9E2), UL64(0x681B20B218D83C7E) },
+        { UL64(0x889F6D65533EF217), UL64(0x7158C7E4C3CA2E87),
+          UL64(0xFB670DFBDC2B4167), UL64(0x75910A01844C257F),
+          UL64(0xF336BF07CF88577D), UL64(0x22245250E45E2ACE),
+          UL64(0x2ED92E8D7CA23D85), UL64(0x29F8BE4C2B812F58) },
+        { UL64(0xD65BF1973467BA92), UL64(0x8C9B46DBF70954B0),
+          UL64(0x97C8A0F30E78F15D), UL64(0xA8F3A69A85A4C961),
+          UL64(0x4242660F61E4CE9B), UL64(0xBF06AAB36EA6790C),
+          UL64(0xC6706F8EEC986416), UL64(0x9E56DEC19A9FC225) },
+        { UL64(0x4BEE32719A5103F1), UL64(0x5243EFC6F50EAC06),
+          UL64(0xB8E122CB6ADCC119), UL64(0x1B7FAA84C0B80A08),
+          UL64(0x32C3D1BD6DFCD08C), UL64(0x129DEC4E0BE427DE),
+          UL64(0x98AB679C1D263C83), UL64(0xAFC83CB7CEF64EFF) },
+        { UL64(0x1D87E47D3FDF5A51), UL64(0x7AFB5F9355C9CAB0),
+          UL64(0x91BBF58F89E0586E), UL64(0x7C72C0180D843709),
+          UL64(0xA9A5AAFB99B5C3DC), UL64(0xA48A0F1D3844AEB0),
+          UL64(0x7178B7DDB667E482), UL64(0x453985E96E23A59A) },
+        { UL64(0xAA6A4DE0EAF4B8A5), UL64(0x68CFD9CA4BC60E32),
+          UL64(0x668A4B017FD15E70), UL64(0xD9F0694AF27DC09D),
+          UL64(0xF6C3CAD5BA708BCD), UL64(0x5CD2BA695BB95C2A),
+          UL64(0xAA28C1D333C0A58F), UL64(0x23E274E3ABC77870) },
+        { UL64(0xECCFC82D1CC1884B), UL64(0xC85AC2015D4753B4),
+          UL64(0xC7A6CAAC658E099F), UL64(0xCF46369E04B27390),
+          UL64(0xE2E7D049506467EA), UL64(0x481B63A237CDECCC),
+          UL64(0x4029ABD8ED80143A), UL64(0x28BFE3C7BCB00B88) },
+        { UL64(0xFF57F82F33E24A0B), UL64(0x9CBEE23FF2565079),
+          UL64(0x16353427EB5F5825), UL64(0x276FEEC4E948D662),
+          UL64(0xD1B62BC6DA10032B), UL64(0x718351DDF0E72A53),
+          UL64(0x934520762420E7BA), UL64(0x96368FFF3A00118D) },
+        { UL64(0xD89753159C7C4C6B), UL64(0x603AA3C0D7409AF7),
+          UL64(0xB8D53D0C007132FB), UL64(0x68D12AF7A6849238),
+          UL64(0xBE0607E7BF5D9279), UL64(0x9AA50055AADA74CE),
+          UL64(0xE81079CBBA7E8CCB), UL64(0x610C71D1A5F4FF5E) },
+        { UL64(0x184781BFE3B6A661), UL64(0x7751CB1DE6D279F7),
+          UL64(0xF8FF95D6C59EB662), UL64(0x186D90B758D3DEA7),
+          UL64(0x0E4BB6C1DFB4F754), UL64(0x5C5CF56B2B2801DC),
+          UL64(0xC561E4521F54564D), UL64(0xB4FB8C60F0DD7F13) },
+        { UL64(0xAC4C200B29FC81B3), UL64(0xEBC3E09F171D87C1),
+          UL64(0x917995301481AA9E), UL64(0x051B92E192E114FA),
+          UL64(0xDF8F92E9ECB5537F), UL64(0x44B1B2CC290C7483),
+          UL64(0xA711455A2ADEB016), UL64(0x964B685681A10C2C) },
+        { UL64(0x73F459084088567A), UL64(0xEB6B280E1F214A61),
+          UL64(0x8C9ADC34CAF0C13D), UL64(0x39D12938F561FB80),
+          UL64(0xB2DC3A5EBC6EDFB4), UL64(0x7485B1B1FE4D210E),
+          UL64(0x062E0400E186AE72), UL64(0x91E32D5C6EEB3B88) },
+        { UL64(0xC7E9AE85B134DEFA), UL64(0x6073B1D01BB2D475),
+          UL64(0xB9AD615E2863C00D), UL64(0x9E29493D525F4AC4),
+          UL64(0xC32B1DEA4E9ACF4F), UL64(0x3E1F01C8A50DB88D),
+          UL64(0xB05D70EA04DA916C), UL64(0x714B0D0AD865803E) },
+        { UL64(0x5945920CE079AFEE), UL64(0x686E17A06789831F),
+          UL64(0x5966BEE8B74A5AE5), UL64(0x38A673A21E258D46),
+          UL64(0xBD1CC1F283141C95), UL64(0x3B2ECF4F0E96E486),
+          UL64(0xCD3AA89674E5FC78), UL64(0x415EC10C2482FA7A) },
+        { UL64(0x85205A316EC3F510), UL64(0x2C7E4A14D2980475),
+          UL64(0xDE3C19C06F30EBFD), UL64(0xDB1C1F38D4B7E644),
+          UL64(0xFE291A755DCE364A), UL64(0xB7B22A3C058F5BE3),
+          UL64(0x2CD2C30237FEA38C), UL64(0x2930967A2E17BE17) },
+        { UL64(0x020F795EA15B0A44), UL64(0x8F37C8D78958A958),
+          UL64(0x63B7E89BA4B675B5), UL64(0xB4FB0C0C0FC31AEA),
+          UL64(0xED95E639A7FF1F2E), UL64(0x9880F5A3619614FB),
+          UL64(0xDEB6FF02947151AB), UL64(0x5BC5118CA868DCDB) },
+        { UL64(0xF197CB91349F7AED), UL64(0x3B2B5A008FCA8420),
+          UL64(0x7C175EE823AAF6D8), UL64(0x54DCF42135AF32B6),
+          UL64(0x0BA1430727D6561E), UL64(0x879D5EE4D175B1E2),
+          UL64(0xC7C4367399807DB5), UL64(0x77A544559CD55BCD) },
+        { UL64(0xFBB9B2452133FFD9), UL64(0x39A8B2F1830F1A20),
+          UL64(0x484BC97DD5A1F52A), UL64(0xD6AEBF56A40EDDF8),
+          UL64(0x32257ACB76CCDAC6), UL64(0xAF4D36EC1586FF27),
+          UL64(0x8EAA8863F8DE7DD1), UL64(0x0045D5CF88647C16) },
+    },
+    {
+        { UL64(0xA6F3D574C005979D), UL64(0xC2072B426A40E350),
+          UL64(0xFCA5C1568DE2ECF9), UL64(0xA8C8BF5BA515344E),
+          UL64(0x97AEE555114DF14A), UL64(0xD4374A4DFDC5EC6B),
+          UL64(0x754CC28F2CA85418), UL64(0x71CB9E27D3C41F78) },
+        { UL64(0x8910507903605C39), UL64(0xF0843D9EA142C96C),
+          UL64(0xF374493416923684), UL64(0x732CAA2FFA0A2893),
+          UL64(0xB2E8C27061160170), UL64(0xC32788CC437FBAA3),
+          UL64(0x39CD818EA6EDA3AC), UL64(0xE2E942399E2B2E07) },
+        { UL64(0x6967D39B0260E52A), UL64(0xD42585CC90653325),
+          UL64(0x0D9BD60521CA7954), UL64(0x4FA2087781ED57B3),
+          UL64(0x60C1EFF8E34A0BBE), UL64(0x56B0040C84F6EF64),
+          UL64(0x28BE2B24B1AF8483), UL64(0xB2278163F5531614) },
+        { UL64(0x8DF275455922AC1C), UL64(0xA7B3EF5CA52B3F63),
+          UL64(0x8E77B21471DE57C4), UL64(0x31682C10834C008B),
+          UL64(0xC76824F04BD55D31), UL64(0xB6D1C08617B61C71),
+          UL64(0x31DB0903C2A5089D), UL64(0x9C092172184E5D3F) },
+        { UL64(0xDD7CED5BC00CC638), UL64(0x1A2015EB61278FC2),
+          UL64(0x2E8E52886A37F8D6), UL64(0xC457786FE79933AD),
+          UL64(0xB3FE4CCE2C51211A), UL64(0xAD9B10B224C20498),
+          UL64(0x90D87A4FD28DB5E5), UL64(0x698CD1053ACA2FC3) },
+        { UL64(0x4F112D07E91B536D), UL64(0xCEB982F29EBA09D6),
+          UL64(0x3C157B2C197C396F), UL64(0xE23C2D417B66EB24),
+          UL64(0x480C57D93F330D37), UL64(0xB3A4C8A179108DEB),
+          UL64(0x702388DECB199CE5), UL64(0x0B019211B944A8D4) },
+        { UL64(0x24F2A692840BB336), UL64(0x7C353BDCA669FA7B),
+          UL64(0xDA20D6FCDEC9C300), UL64(0x625FBE2FA13A4F17),
+          UL64(0xA2B1B61ADBC17328), UL64(0x008965BFA9515621),
+          UL64(0x49690939C620FF46), UL64(0x182DD27D8717E91C) },
+        { UL64(0x5ACE5035EA6C3997), UL64(0x54259AAAC2610BEF),
+          UL64(0xEF18BB3F3C80DD39), UL64(0x6910B95B5FC3FA39),
+          UL64(0xFCE2F51043E09AEE), UL64(0xCED56C9FA7675665),
+          UL64(0x10E265ACD872DB61), UL64(0x6982812EAE9FCE69) },
+        { UL64(0x29BE11C6CE800998), UL64(0x72BB1752B90360D9),
+          UL64(0x2C1931975A4AD590), UL64(0x2BA2F5489FC1DBC0),
+          UL64(0x7FE4EEBBE490EBE0), UL64(0x12A0A4CD7FAE11C0),
+          UL64(0x7197CF81E903BA37), UL64(0xCF7D4AA8DE1C6DD8) },
+        { UL64(0x92AF6BF43FD5684C), UL64(0x2B26EECF80360AA1),
+          UL64(0xBD960F3000546A82), UL64(0x407B3C43F59AD8FE),
+          UL64(0x86CAE5FE249C82BA), UL64(0x9E0FAEC72463744C),
+          UL64(0x87F551E894916272), UL64(0x033F93446CEB0615) },
+        { UL64(0x1E5EB0D18BE82E84), UL64(0x89967F0E7A582FEF),
+          UL64(0xBCF687D5A6E921FA), UL64(0xDFEE4CF3D37A09BA),
+          UL64(0x94F06965B493C465), UL64(0x638B9A1C7635C030),
+          UL64(0x7666786466F05E9F), UL64(0xCCAF6808C04DA725) },
+        { UL64(0xCA2EB690768FCCFC), UL64(0xF402D37DB835B362),
+          UL64(0x0EFAC0D0E2FDFCCE), UL64(0xEFC9CDEFB638D990),
+          UL64(0x2AF12B72D1669A8B), UL64(0x33C536BC5774CCBD),
+          UL64(0x30B21909FB34870E), UL64(0xC38FA2F77DF25ACA) },
+        { UL64(0x74C5F02BBF81F3F5), UL64(0x0525A5AEAF7E4581),
+          UL64(0x88D2AABA433C54AE), UL64(0xED9775DB806A56C5),
+          UL64(0xD320738AC0EDB37D), UL64(0x25FDB6EE66CC1F51),
+          UL64(0xAC661D1710600D76), UL64(0x931EC1F3BDD1ED76) },
+        { UL64(0x65C11D6219EE43F1), UL64(0x5CD57C3E60829D97),
+          UL64(0xD26C91A3984BE6E8), UL64(0xF08D93098B0C53BD),
+          UL64(0x94BC9E5BC016E4EA), UL64(0xD391683911D43D2B),
+          UL64(0x886C5AD773701155), UL64(0xE037762620B00715) },
+        { UL64(0x7F01C9ECAA80BA59), UL64(0x3083411A68538E51),
+          UL64(0x970370F1E88128AF), UL64(0x625CC3DB91DEC14B),
+          UL64(0xFEF9666C01AC3107), UL64(0xB2A8D577D5057AC3),
+          UL64(0xB0F2629992BE5DF7), UL64(0xF579C8E500353924) },
+        { UL64(0xB8FA3D931341ED7A), UL64(0x4223272CA7B59D49),
+          UL64(0x3DCB194783B8C4A4), UL64(0x4E413C01ED1302E4),
+          UL64(0x6D999127E17E44CE), UL64(0xEE86BF7533B3ADFB),
+          UL64(0xF6902FE625AA96CA), UL64(0xB73540E4E5AAE47D) },
+        { UL64(0x32801D7B1B4A158C), UL64(0xE571C99E27E2A369),
+          UL64(0x40CB76C010D9F197), UL64(0xC308C2893167C0AE),
+          UL64(0xA6EF9DD3EB7958F2), UL64(0xA7226DFC300879B1),
+          UL64(0x6CD0B3627EDF0636), UL64(0x4EFBCE6C7BC37EED) },
+        { UL64(0x75F92A058D699021), UL64(0x586D4C79772566E3),
+          UL64(0x378CA5F1761AD23A), UL64(0x650D86FC1465A8AC),
+          UL64(0x7A4ED457842BA251), UL64(0x6B65E3E642234933),
+          UL64(0xAF1543B731AAD657), UL64(0xA4CEFE98CBFEC369) },
+        { UL64(0xB587DA909F47BEFB), UL64(0x6562E9FB41312D13),
+          UL64(0xA691EA59EFF1CEFE), UL64(0xCC30477A05FC4CF6),
+          UL64(0xA16324610B0FFD3D), UL64(0xA1F16F3B5B355956),
+          UL64(0x5B148D534224EC24), UL64(0xDC834E7BF977012A) },
+        { UL64(0x7BFC5E75B2C69DBC), UL64(0x3AA77A2903C3DA6C),
+          UL64(0xDE0DF03CCA910271), UL64(0xCBD5CA4A7806DC55),
+          UL64(0xE1CA58076DB476CB), UL64(0xFDE15D625F37A31E),
+          UL64(0xF49AF520F41AF416), UL64(0x96C5C5B17D342DB5) },
+        { UL64(0x155C43B7EB4CEB9B), UL64(0x2E9930104E77371A),
+          UL64(0x1D2987DA675D43AF), UL64(0xEF2BC1C08599FD72),
+          UL64(0x96894B7B9342F6B2), UL64(0x201EADF27C8E71F0),
+          UL64(0xF3479D9F4A1F3EFC), UL64(0xE0F8A742702A9704) },
+        { UL64(0xEAFD44B6B3EBA40C), UL64(0xF9739F29C1C1E0D0),
+          UL64(0x0091471A619D505E), UL64(0xC15F9C969D7C263E),
+          UL64(0x5BE4728583AFBE33), UL64(0xA3B6D6AF04F1E092),
+          UL64(0xE76526B9751A9D11), UL64(0x2EC5B26D9A4AE4D2) },
+        { UL64(0xEB66F4D902F6FB8D), UL64(0x4063C56196912164),
+          UL64(0xEB7050C180EF3000), UL64(0x288D1C33EAA5B3F0),
+          UL64(0xE87C68D607806FD8), UL64(0xB2F7F9D54BBBF50F),
+          UL64(0x25972F3AAC8D6627), UL64(0xF854777410E8C13B) },
+        { UL64(0xCC50EF6C872B4A60), UL64(0xAB2A34A44613521B),
+          UL64(0x39C5C190983E15D1), UL64(0x61DDE5DF59905512),
+          UL64(0xE417F6219F2275F3), UL64(0x0750C8B6451D894B),
+          UL64(0x75B04AB978B0BDAA), UL64(0x3BFD9FD4458589BD) },
+        { UL64(0xF1013E30EE9120B6), UL64(0x2B51AF9323A4743E),
+          UL64(0xEA96FFAE48D14D9E), UL64(0x71DC0DBE698A1D32),
+          UL64(0x914962D20180CCA4), UL64(0x1AE60677C3568963),
+          UL64(0x8CF227B1437BC444), UL64(0xC650C83BC9962C7A) },
+        { UL64(0x23C2C7DDFE7CCFC4), UL64(0xF925C89D1B929D48),
+          UL64(0x4460F74B06783C33), UL64(0xAC2C8D49A590475A),
+          UL64(0xFB40B407B807BBA0), UL64(0x9D1E362D69FF8F3A),
+          UL64(0xA33E9681CBEF64A4), UL64(0x67ECE5FA332FB4B2) },
+        { UL64(0x6900A99B739F10E3), UL64(0xC3341CA9FF525925),
+          UL64(0xEE18A626A9E2D041), UL64(0xA5A8368529580DDD),
+          UL64(0xF3470C819D7DE3CD), UL64(0xEDF025862062CF9C),
+          UL64(0xF43522FAC010EDB0), UL64(0x3031413513A4B1AE) },
+        { UL64(0xC792E02ADB22B94B), UL64(0x993D8AE9A1EAA45B),
+          UL64(0x8AAD6CD3CD1E1C63), UL64(0x89529CA7C5CE688A),
+          UL64(0x2CCEE3AAE572A253), UL64(0xE02B643802A21EFB),
+          UL64(0xA7091B6EC9430358), UL64(0x06D1B1FA9D7DB504) },
+        { UL64(0x58846D32C4744733), UL64(0x40517C71379F9E34),
+          UL64(0x2F65655F130EF6CA), UL64(0x526E4488F1F3503F),
+          UL64(0x8467BD177EE4A976), UL64(0x1D9DC913921363D1),
+          UL64(0xD8D24C33B069E041), UL64(0x5EB5DA0A2CDF7F51) },
+        { UL64(0x1C0F3CB1197B994F), UL64(0x3C95A6C52843EAE9),
+          UL64(0x7766FFC9A6097EA5), UL64(0x7BEA4093D723B867),
+          UL64(0xB48E1F734DB378F9), UL64(0x70025B00E37B77AC),
+          UL64(0x943DC8E7AF24AD46), UL64(0xB98A15AC16D00A85) },
+        { UL64(0x3ADC38BA2743B004), UL64(0xB1C7F4F7334415EE),
+          UL64(0xEA43DF8F1E62D05A), UL64(0x326189059D76A3B6),
+          UL64(0x2FBD0BB5A23A0F46), UL64(0x5BC971DB6A01918C),
+          UL64(0x7801D94AB4743F94), UL64(0xB94DF65E676AE22B) },
+        { UL64(0xAAFCBFABAF95894C), UL64(0x7B9BDC07276B2241),
+          UL64(0xEAF983625BDDA48B), UL64(0x5977FAF2A3FCB4DF),
+          UL64(0xBED042EF052C4B5B), UL64(0x9FE87F71067591F0),
+          UL64(0xC89C73CA22F24EC7), UL64(0x7D37FA9EE64A9F1B) },
+    },
+    {
+        { UL64(0xCC7A64880A750C0F), UL64(0x39BACFE34E548E83),
+          UL64(0x3D418C760C110F05), UL64(0x3E4DAA4CB1F11588),
+          UL64(0x2733E7B55FFC69FF), UL64(0x46F147BC92053127),
+          UL64(0x885B2434D722DF94), UL64(0x6A444F65E6FC6B7C) },
+        { UL64(0x7A1A465AC3F16EA8), UL64(0x115A461DB2F1D11C),
+          UL64(0x4767DD956C68A172), UL64(0x3392F2EBD13A4698),
+          UL64(0xC7A99CCDE526CDC7), UL64(0x8E537FDC22292B81),
+          UL64(0x76D8CF69A6D39198), UL64(0xFFC5FF432446852D) },
+        { UL64(0x6D0B16F4BDAEDFBD), UL64(0x23FD326086746CED),
+          UL64(0x8BFB1D2FFF4B3E17), UL64(0xC7F2EC2D019C14C8),
+          UL64(0x3E0832F245104B0D), UL64(0x5F00DAFBADEA2B7E),
+          UL64(0x29E5CF6699FBFB0F), UL64(0x264F972361827CDA) },
+        { UL64(0x97B14F7EA90567E6), UL64(0x513257B7B6AE5CB7),
+          UL64(0x85454A3C9F10903D), UL64(0xD8D2C9AD69BC3724),
+          UL64(0x38DA93246B29CB44), UL64(0xB540A21D77C8CBAC),
+          UL64(0x9BBFE43501918E42), UL64(0xFFFA707A56C3614E) },
+        { UL64(0x6EB1A2F3E30BC27F), UL64(0xE5F0C05AB0836511),
+          UL64(0x4D741BBF4965AB0E), UL64(0xFEEC41CA83464BBD),
+          UL64(0x1ACA705F99D0B09F), UL64(0xC5D6CC56F42DA5FA),
+          UL64(0x49964EDDCC52B931), UL64(0x8AE59615C884D8D8) },
+        { UL64(0x0CE4E3F1D4E353B7), UL64(0x062D8A14EF46B0A0),
+          UL64(0x6408D5AB574B73FD), UL64(0xBC41D1C9D3273FFD),
+          UL64(0x3538E1E76BE77800), UL64(0x71FE8B37C5655031),
+          UL64(0x1CD916216B9B331A), UL64(0xAD825D0BBB388F73) },
+        { UL64(0xF634B57B39F8868A), UL64(0xE27F4FD475CC69AF),
+          UL64(0xA47E58CBD0D5496E), UL64(0x8A26793FD323E07F),
+          UL64(0xC61A9B72FA30F349), UL64(0x94C9D9C9B696D134),
+          UL64(0x792BECA85880A6D1), UL64(0xBDCC4645AF039995) },
+        { UL64(0x56C2E05B1CB76219), UL64(0x0EC0BF9171567E7E),
+          UL64(0xE7076F8661C4C910), UL64(0xD67B085BBABC04D9),
+          UL64(0x9FB904595E93A96A), UL64(0x7526C1EAFBDC249A),
+          UL64(0x0D44D367ECDD0BB7), UL64(0x953999179DC0D695) },
+        { UL64(0xCE7EF8E58C796C3C), UL64(0x9ADAAE84DD66E57A),
+          UL64(0x784AE13E45227F33), UL64(0xB046C5B82A85E757),
+          UL64(0xB7AA50AEEC37631F), UL64(0xBEDC4FCA3B300758),
+          UL64(0x0F82567E0AC9700B), UL64(0x1071D9D44FF5F8D2) },
+        { UL64(0x61360EE99E240D18), UL64(0x057CDCACB4B94466),
+          UL64(0xE7667CD12FE5325C), UL64(0x1FA297B521974E3B),
+          UL64(0xFA4081E7DB083D76), UL64(0x31993BE6F206BD15),
+          UL64(0x8949269B14C19F8C), UL64(0x21468D72A9D92357) },
+        { UL64(0xD09EF6C4E51A2811), UL64(0x39F6862BB8FB66B9),
+          UL64(0x64E77F8D22DFAA99), UL64(0x7B10504461B08AAC),
+          UL64(0x71704E4C4A7DF332), UL64(0xD09734342FFE015B),
+          UL64(0xAB0EAF4408D3020E), UL64(0x28B1909EED63B97A) },
+        { UL64(0x2CCBC583A4C506EC), UL64(0x957ED188D1ACFE97),
+          UL64(0x8BAED83312F1AEA2), UL64(0xEF2A6CB48325362D),
+          UL64(0x130DDE428E195C43), UL64(0xC842025A0E6050C6),
+          UL64(0x2DA972A708686A5D), UL64(0xB52999A1E508B4A8) },
+        { UL64(0x2F3FA882CDADCD4F), UL64(0xA4EF68595F631995),
+          UL64(0xE52CA2F9E531766F), UL64(0x20AF5C3057E2C1D3),
+          UL64(0x1E4828F6E51E94B8), UL64(0xF900A1751A2F5D4F),
+          UL64(0xE831ADB3392C58A0), UL64(0x4C5A90CA1B6E5866) },
+        { UL64(0xD9F090B910A5A8BD), UL64(0xCA91D249096864DA),
+          UL64(0x8E6A93BE3F67DBC1), UL64(0xACAE6FBAF5F4764C),
+          UL64(0x1563C6E0D21411A0), UL64(0x28FA787FDA0A4AD8),
+          UL64(0xD524491C908C8030), UL64(0x1257BA0E4C795F07) },
+        { UL64(0x5F3DCBA86182827C), UL64(0xD1A448DDBD7E7252),
+          UL64(0x2D8F96FCF493B815), UL64(0xBA0A4C263B0AA95F),
+          UL64(0x88A1514063A0007F), UL64(0x9564C25E6A9C5846),
+          UL64(0x5A4D7B0FDC0FCBCA), UL64(0x2275DAA33F8A740E) },
+        { UL64(0x83F49167CECA9754), UL64(0x426D2CF64B7939A0),
+          UL64(0x2555E355723FD0BF), UL64(0xA96E6D06C4F144E2),
+          UL64(0x4768A8DD87880E61), UL64(0x15543815E508E4D5),
+          UL64(0x09D7E772B1B65E15), UL64(0x63439DD6AC302FA0) },
+        { UL64(0x159591CC0461086B), UL64(0xB695AA9495E66E51),
+          UL64(0x2D4C946779DED531), UL64(0xBD2482BA89C2BE79),
+          UL64(0x8EE2658AA20BBF19), UL64(0xC000528A32247917),
+          UL64(0xD924BE4AFFEAE845), UL64(0x51312BEBED992C8B) },
+        { UL64(0xB93F802FC14E35C2), UL64(0x71735B7C4341333C),
+          UL64(0x03A2510416D4F362), UL64(0x3F4D069BBF433C8E),
+          UL64(0x0D83AE01F78F5A7C), UL64(0x50A8FFBE7C4EED07),
+          UL64(0xC74F890676E10F83), UL64(0x7D0809669DDAF8E1) },
+        { UL64(0x3A01B958DC752BD9), UL64(0x2BABDBC20C215D45),
+          UL64(0xE689D79A131641C1), UL64(0x48E8F0DA80E05ED4),
+          UL64(0x4B505FEB77BB70C4), UL64(0xEFBD3E2BB6057EF7),
+          UL64(0x7583E22DCE603CA5), UL64(0xFBE3B1F22C5C70C7) },
+        { UL64(0xB11DF8E1698E04CC), UL64(0x877BE203169005C8),
+          UL64(0x32749E8C4F3C6179), UL64(0x2DBC9D0A7853FC05),
+          UL64(0x187D4F939454D937), UL64(0xE682CE9DB4800E1B),
+          UL64(0xA9129AD8165E68E8), UL64(0x0FE29735BE7F785B) },
+        { UL64(0x8EC1ECF029E5E35A), UL64(0x2F3168E58645C2B3),
+          UL64(0xE9297362C7F94CB2), UL64(0x4FBF1466D1C90B39),
+          UL64(0x3E4F7656920BAE2A), UL64(0x805D04B9F1BEB172),
+          UL64(0x729A7208DBDBD4B4), UL64(0x1AADE45687AECA53) },
+        { UL64(0x5303F40C5B9E02B7), UL64(0xA37C969235EE04E8),
+          UL64(0x5F46CC2034D6632B), UL64(0x55EF72B296AC545B),
+          UL64(0xABEC5C1F7B91B062), UL64(0x0A79E1C7BB33E821),
+          UL64(0xBB04B4283A9F4117), UL64(0x0DE1F28FFD2A475A) },
+        { UL64(0xB0FF1F541934A508), UL64(0x19E1397604BBF31A),
+          UL64(0xB2A8E6033717A6B4), UL64(0xD601E45D0EF12CB9),
+          UL64(0x563F0AF5B515E98E), UL64(0x9B129DB633984F9B),
+          UL64(0xE34ABA2FA47E4A65), UL64(0xB56F82D19E3F9D82) },
+        { UL64(0x31019CCF3A4434B4), UL64(0xA34581111A7954DC),
+          UL64(0xA9DAC80DE34972A7), UL64(0xB043D05474F6B8DD),
+          UL64(0x021C319E11137B1A), UL64(0x00A754CEED5CC03F),
+          UL64(0x0AA2C794CBEA5AD4), UL64(0x093E67F470C015B6) },
+        { UL64(0x0203EFFDB1209B86), UL64(0x21F063EDB19D6CBF),
+          UL64(0x59F53476980F275B), UL64(0x202456D7B7AC5E80),
+          UL64(0xE5A8C05F4900EDC9), UL64(0x04C08EB470F01E86),
+          UL64(0xF74AC2241DCD98CE), UL64(0x7E77CC0CE2E830DB) },
+        { UL64(0x72CDFEE9C97E3F6B), UL64(0xC10BCAB4B6DA7461),
+          UL64(0x3B02D2FCB59806B9), UL64(0x85185E89A1DE6F47),
+          UL64(0x39E6931F0EB6C4D4), UL64(0x4D4440BDD4FA5B04),
+          UL64(0x5418786E34BE7EB8), UL64(0x6380E5219D7259BC) },
+        { UL64(0x74E37234A9747EDE), UL64(0x4FC9FBB1361B1013),
+          UL64(0xE7B533733CF357EF), UL64(0x6AA2DD2C991C4193),
+          UL64(0x7887E4D2A770917A), UL64(0xDD1809B4C20D24CB),
+          UL64(0x004CD7C38E9C2D3E), UL64(0xC77C5BABA9970ABE) },
+        { UL64(0x20AC0351D598D710), UL64(0x272C4166CB3A4DA4),
+          UL64(0xDB82FE1ACA71DE1F), UL64(0x746E79F2D8F54B0F),
+          UL64(0x6E7FC7364B573E9B), UL64(0x75D03F46FD4B5040),
+          UL64(0x5C1CC36D0B98D87B), UL64(0x513BA3F11F472DA1) },
+        { UL64(0x52927EAAC3AF237F), UL64(0xFAA06065D7398767),
+          UL64(0x042E72B497C6CE0B), UL64(0xDAED0CC40A9F2361),
+          UL64(0xDDC2E11C2FC1BB4A), UL64(0x631DA5770C1A9EF8),
+          UL64(0x8A4CFE44680272BF), UL64(0xC76B9F7262FB5CC3) },
+        { UL64(0x79D0AF26ABB177DD), UL64(0xF82AB5687891D564),
+          UL64(0x2B6768A972232173), UL64(0xEFBB3BB08C1F6619),
+          UL64(0xB29C11DBA6D18358), UL64(0x519E2797B0916D3A),
+          UL64(0xD4DC18F09188E290), UL64(0x648E86E398B0CA7F) },
+        { UL64(0x248F814538B3AAE3), UL64(0xB5345864BC204334),
+          UL64(0x66D6B5BC1D127524), UL64(0xE312080D14F572D3),
+          UL64(0x13ED15A716ABAFEB), UL64(0x6F18CE27DBA967BE),
+          UL64(0x96C9E826EF08552D), UL64(0x2C191B06BE2B63E0) },
+        { UL64(0x859D3145983C38B5), UL64(0xB14F176C637ABC8B),
+          UL64(0x2793FB9DCAFF7BE6), UL64(0xEBE5A55F35A66A5A),
+          UL64(0x7CEC1DCD9F87DC59), UL64(0x7C595CD3FBDBF560),
+          UL64(0x5B543B2226EB3257), UL64(0x69080646C4C935FD) },
+    },
+    {
+        { UL64(0xB93452381D531696), UL64(0x57201C0088CDDE69),
+          UL64(0xDDE922519A86AFC7), UL64(0xE3043895BD35CEA8),
+          UL64(0x7608C1E18555970D), UL64(0x8267DFA92535935E),
+          UL64(0xD4C60A57322EA38B), UL64(0xE0BF7977804EF8B5) },
+        { UL64(0x6233EA68C094DBB5), UL64(0xB77D062ED968D410),
+          UL64(0x3E719BBC58B3002D), UL64(0x68E7DD3D3DC49D58),
+          UL64(0x8D825740013A5E58), UL64(0x213117473C9E3C1B),
+          UL64(0x0CB0A2A77C99B6AB), UL64(0x5C48A3B3C2F888F2) },
+        { UL64(0x4C5C4BE12927D4CA), UL64(0xB0F23F16518F848E),
+          UL64(0x84F789220C757BCB), UL64(0x35BD1CBB325DEB96),
+          UL64(0xBDB186FB7D0DE10A), UL64(0xD07350E3B22C9685),
+          UL64(0x3F95393EEF45C641), UL64(0xB8870FF1D07B6D44) },
+        { UL64(0xC7913E91991724F3), UL64(0x5EDA799C39CBD686),
+          UL64(0xDDB595C763D4FC1E), UL64(0x6B63B80BAC4FED54),
+          UL64(0x6EA0FC697E5FB516), UL64(0x737708BAD0F1C964),
+          UL64(0x9628745F11A92CA5), UL64(0x61F379589A86967A) },
+        { UL64(0x64CF0A6547A2659F), UL64(0x1218F43033380BCB),
+          UL64(0xFC1DE4E40FD98A74), UL64(0xAEC4EC8FF09EEDB8),
+          UL64(0xDE6DB5E195C56083), UL64(0x3307B05607DC16A1),
+          UL64(0x1482C186C0D47097), UL64(0xA08319AC514C3A66) },
+        { UL64(0x5320FD610979E6B3), UL64(0x1D0BD3E593D40723),
+          UL64(0x0AC006FCAA80BACC), UL64(0xB1D9C60ED2002515),
+          UL64(0x610E7ED0AF780B92), UL64(0xF5BF446E80A9CE31),
+          UL64(0x441C011D3C20B54B), UL64(0x77F76DA1191596C3) },
+        { UL64(0x972E5B2B4D4094B4), UL64(0x4B49954F5E96DE5F),
+          UL64(0x6CA8E40A4F870D59), UL64(0x9EE2886F45A68DEF),
+          UL64(0xAE0260ECC4439A13), UL64(0x45AECD3EB4CFB71F),
+          UL64(0x50C5D9B64E327620), UL64(0x470ADADB86182CF3) },
+        { UL64(0x9AF39B2CAA665072), UL64(0x78322FA4EFD324EF),
+          UL64(0x3D153394C327BD31), UL64(0x81D5F2713129DAB0),
+          UL64(0xC72E0C42F48027F5), UL64(0xAA40CDBC8536E717),
+          UL64(0xF45A657A2D369D0F), UL64(0xB03BBFC4EA7F74E6) },
+        { UL64(0x4AB70789F37C69F0), UL64(0x3226D87801C5802D),
+          UL64(0x4FE7424C360DF497), UL64(0x9EAED4E55F890D50),
+          UL64(0x208E995CDD3729C6), UL64(0xF743BD5CD00DEAF3),
+          UL64(0xFE5A1310F161847D), UL64(0x34E775A2941A3F25) },
+        { UL64(0x7A04D5429B6A42EA), UL64(0xFA597E853DAF41B9),
+          UL64(0x4C58EC27726B0B89), UL64(0xED8EB16A030D43DE),
+          UL64(0x65E1E5E1EC9DCF57), UL64(0xB7A770C1697CFF81),
+          UL64(0x1E6D918F9F6E2B22), UL64(0x7C277A9AC64E82B7) },
+        { UL64(0xE5C869C87B1F35CF), UL64(0x29FA693755D1D237),
+          UL64(0x05C574EEDE579C44), UL64(0x45BB912B336D590C),
+          UL64(0x5D172D85777D4DEB), UL64(0x1A37CCA97B6C6567),
+          UL64(0x1CA1433A25373A8A), UL64(0xD23C94A81C77353A) },
+        { UL64(0x46A8C4180D738DED), UL64(0x6F1A5BB0E0DE5729),
+          UL64(0xF10230B98BA81675), UL64(0x32C6F30C112B33D4),
+          UL64(0x7559129DD8FFFB62), UL64(0x6A281B47B459BF05),
+          UL64(0x77C1BD3AFA3B6776), UL64(0x0709B3807829973A) },
+        { UL64(0x7989227CC935A361), UL64(0xFD17F8AAE39A0A7E),
+          UL64(0x2E5C5E86269163BA), UL64(0x07C98E78C663EAF4),
+          UL64(0x64E8209A422EA36E), UL64(0x1BE8B3914C6A0882),
+          UL64(0x4BAC4503EC4FA55E), UL64(0xBAEEA7CAAD7868DF) },
+        { UL64(0x0875E0C1DA36CB47), UL64(0xFDF5B7CB1E0210F0),
+          UL64(0x7E0C7E4D3A3787C8), UL64(0xF043F5262B1C741F),
+          UL64(0x76DF1B006D74D72D), UL64(0x0514DF7338B45BA9),
+          UL64(0xAECF7C3E0A6B797A), UL64(0x5E30B285DDEAAC39) },
+        { UL64(0xFF69339CAC69E3DB), UL64(0x74ECC83C59E9D6BD),
+          UL64(0x67237B37820A8482), UL64(0x943A3035072DFA23),
+          UL64(0x6E4210D28F48BDB8), UL64(0x885175162EECC7F4),
+          UL64(0x0B05C5F4632A187F), UL64(0xCAFDFB5ED97D1D4C) },
+        { UL64(0x8C26B232A3326505), UL64(0x38D69272EE1D41BF),
+          UL64(0x0459453EFFE32AFA), UL64(0xCE8143AD7CB3EA87),
+          UL64(0x932EC1FA7E6AB666), UL64(0x6CD2D23022286264),
+          UL64(0x459A46FE6736F8ED), UL64(0x50BF0D009ECA85BB) },
+        { UL64(0x06C16BBA3DA2EBB4), UL64(0xF35B21BB32557C3E),
+          UL64(0x95B1231230076711), UL64(0x873AA0761B7611F0),
+          UL64(0x31F69026EA3A6D61), UL64(0x7AC9B86B42A6BE4C),
+          UL64(0xD3B5D7C74B6C2802), UL64(0xCD4894ACAB281DE0) },
+        { UL64(0x15C78F7D605238A5), UL64(0xE9D87842448496AB),
+          UL64(0xCFCF75D0D210ACC1), UL64(0x2948F2295C8C14E2),
+          UL64(0xE81FD76DE8DAF0CB), UL64(0xD02D11E4A03BE800),
+          UL64(0x0C4DF3518778D30C), UL64(0x3482BC96965139CB) },
+        { UL64(0xEFA0D70149811D68), UL64(0xE4F6C8E51EA1A04E),
+          UL64(0x5990E1FD82237640), UL64(0xEFA225F91D80DB96),
+          UL64(0x17431C953A96CCDA), UL64(0x461BAAC1FC3FA192),
+          UL64(0x3BE2F407BBC184B4), UL64(0xD776DE1D0D05D39C) },
+        { UL64(0x0B825852877A21EC), UL64(0x300414A70F537A94),
+          UL64(0x3F1CBA4021A9A6A2), UL64(0x50824EEE76943C00),
+          UL64(0xA0DBFCECF83CBA5D), UL64(0xF953814893B4F3C0),
+          UL64(0x6174416248F24DD7), UL64(0x5322D64DE4FB09DD) },
+        { UL64(0xF1B09ED2DC73A705), UL64(0x142B00C801A11A6E),
+          UL64(0x726484B098A132C9), UL64(0xF3B5EF6326E1567A),
+          UL64(0x43BED2D0574BFC03), UL64(0x74791E38768F722F),
+          UL64(0x7A189FB34CE97ED8), UL64(0x2B9B2C96168A5F43) },
+        { UL64(0x56B6CF278A448BBC), UL64(0x0CA898DFC85251DA),
+          UL64(0x9082CAD836E79B24), UL64(0x2E7B9ED31A8E51A7),
+          UL64(0xDC7D318A43E1C802), UL64(0x4750E523CBF8689D),
+          UL64(0x9887A072F0071B1A), UL64(0x52090F87814BFDC1) },
+        { UL64(0x4821852E8D736EB9), UL64(0x29A928D3544C1E6B),
+          UL64(0x1AA411AE77800586), UL64(0xE94D067B1B0A5793),
+          UL64(0xB59D8B4BA65E46AD), UL64(0x3C62BA87CD941804),
+          UL64(0xFDB54B789920E61B), UL64(0xE923F2840A181AAC) },
+        { UL64(0x574473843D9325F3), UL64(0xA9BEF2D0F371CB84),
+          UL64(0x77D2188BA61E36C5), UL64(0xBBD6A7D7C602DF72),
+          UL64(0xBA3AA9028F61BC0B), UL64(0xF49085ED6ED0B6A1),
+          UL64(0x8BC625D6AE6E8298), UL64(0x832B0B1DA2E9C01D) },
+        { UL64(0xC2B45C8270D1CAA0), UL64(0x44CE41D0724AB557),
+          UL64(0x57984BAC138271FD), UL64(0x67E0C934CB3608C8),
+          UL64(0xC888FA455455F703), UL64(0xE9C5B8B4727B02B0),
+          UL64(0xDC3EF0F07C7130A4), UL64(0xD9E4BEA34B09270C) },
+        { UL64(0x5BEBF2196196BC6E), UL64(0x0E66736BEF097EFD),
+          UL64(0x1128F3B8EA87293A), UL64(0x2998E4056ADDFCDE),
+          UL64(0x55CC31B85D16C961), UL64(0x87A434E12418F056),
+          UL64(0x2E94AACCDC9FE819), UL64(0x94A486C1A56490C6) },
+        { UL64(0x8A4D83D4CB8D2BB3), UL64(0xEA796AA8FFD2B1FD),
+          UL64(0x6575AB5104CA79F6), UL64(0xF4F0D536C46B86CF),
+          UL64(0x461EC5D9670E6B58), UL64(0x705053F80EAED108),
+          UL64(0xDAF45BCE14DD16F7), UL64(0x406F2D49C4B2CF65) },
+        { UL64(0xA337C447F1F0CED1), UL64(0x800CC7939492DD2B),
+          UL64(0x4B93151DBEA08EFA), UL64(0x820CF3F8DE0A741E),
+          UL64(0xFF1982DC1C0F7D13), UL64(0xEF92196084DDE6CA),
+          UL64(0x1AD7D97245F96EE3), UL64(0x319C8DBE29DEA0C7) },
+        { UL64(0x6D1CDC80E82EF5F8), UL64(0x095DF9F02F1C7FB3),
+          UL64(0xC87F34B9A3CFD888), UL64(0xD5D77095340208E1),
+          UL64(0x4A1AECE4918851CB), UL64(0xD7B1F5C1602B7142),
+          UL64(0xF0D39813C6524F82), UL64(0xF6D96EAE6BB01DB5) },
+        { UL64(0x1FF2385BDE259EC8), UL64(0xF6B0836A30F67B0D),
+          UL64(0x04CC65B006661CFF), UL64(0x467E6358D4230F5C),
+          UL64(0xCE468C802DBED3D3), UL64(0x7B984262F1920DA6),
+          UL64(0x34D257421537479F), UL64(0x5C8AA88C87BB8DE1) },
+        { UL64(0x32F768A154AFA56A), UL64(0xA51EECA3FAF184E5),
+          UL64(0x20CECB44618C7468), UL64(0x3434D15F87862CC0),
+          UL64(0x713C3811AEF55DF6), UL64(0x2CD7C04981E3F8F0),
+          UL64(0xEE68D439FF2F99BE), UL64(0x79B64EE72B5DA6A6) },
+        { UL64(0xD3EA38717B82B99B), UL64(0x75922D4D470EB624),
+          UL64(0x8F66EC543B95D466), UL64(0x66E673CCBEE1E346),
+          UL64(0x6AFE67C4B5F2B89A), UL64(0x3DE9C1E6290E5CD3),
+          UL64(0x8C278BB6310A2ADA), UL64(0x420FA3840BDB323B) },
+    },
+    {
+        { UL64(0x646F96796424C49B), UL64(0xF888DFE867C241C9),
+          UL64(0xE12D4B9324F68B49), UL64(0x9A6B62D8A571DF20),
+          UL64(0x81B4B26D179483CB), UL64(0x666F96329511FAE2),
+          UL64(0xD281B3E4D53AA51F), UL64(0x7F96A7657F3DBD16) },
+        { UL64(0x8553D37C051AF62B), UL64(0xE9A998EB0BF94496),
+          UL64(0xE0844F9FB0D59AA1), UL64(0x983FD558E6AFB813),
+          UL64(0x9670C0CA65D69804), UL64(0x732B22DE6EA5FF2D),
+          UL64(0xD7640BA95FD8623B), UL64(0x9F619163A6351782) },
+        { UL64(0xF167B4E0BDEFDD4F), UL64(0x69958465F366E401),
+          UL64(0x5AA368ABA73BBEC0), UL64(0x121487097B240C21),
+          UL64(0x378C323318969006), UL64(0xCB4D73CEE1FE53D1),
+          UL64(0x5F50A80E130C4361), UL64(0xD67F59517EF5212B) },
+        { UL64(0x332F81088CAD38C0), UL64(0x471B7E906BD68AE2),
+          UL64(0x56AC3FB20D8E27A3), UL64(0xB54660DB136B4B0D),
+          UL64(0x123A1E11A6FD8DE4), UL64(0x44DBFFEAA37799EF),
+          UL64(0x4540B977CE6AC17C), UL64(0x495173A8AF60ACEF) },
+        { UL64(0xEB4437434573EAB0), UL64(0x11570DFBD1AC6031),
+          UL64(0xF7D9B45B44DD9AFD), UL64(0xB8066ADD22067231),
+          UL64(0x15F92AD8F8A3F0B4), UL64(0x9E0E4899E0ACE2A2),
+          UL64(0xBDCD0AADFAB38B80), UL64(0x46506AE917020052) },
+        { UL64(0x429A69F78FCA399D), UL64(0xFE9E27D20207BB63),
+          UL64(0xEC655ED68788F582), UL64(0xA426D748ADB75F6E),
+          UL64(0x18695C02CA81C66D), UL64(0x84FB8D27A531D425),
+          UL64(0x3A3A8956DEFF48BA), UL64(0xAF1D0D56766D2247) },
+        { UL64(0x5A059565352C4B5C), UL64(0x49261531590BC3E2),
+          UL64(0x809F7521F66F9F5F), UL64(0x2BAEF6BFC70A4A9B),
+          UL64(0xE7E6FA6509ED3561), UL64(0x11370233984B230C),
+          UL64(0x2151659BD04CDC69), UL64(0xBDB83C63F007D416) },
+        { UL64(0x9EBB284D391C2A82), UL64(0xBCDD4863158308E8),
+          UL64(0x006F16EC83F1EDCA), UL64(0xA13E2C37695DC6C8),
+          UL64(0x2AB756F04A057A87), UL64(0xA8765500A6B48F98),
+          UL64(0x4252FACE68651C44), UL64(0xA52B540BE1765E02) },
+        { UL64(0xCB35A1A85CA37FF0), UL64(0xE1A04F1CCD2F1C8F),
+          UL64(0x238816CE15A26112), UL64(0xE206A111095B177E),
+          UL64(0x3C10B6048A424149), UL64(0xC6A3F56774752CFB),
+          UL64(0xBF16A37A47F1DBB8), UL64(0x7C372F9AD31A3DFB) },
+        { UL64(0x122D05B5C20B4D2A), UL64(0xFF659CF50C662A67),
+          UL64(0xED57C128E8FFC9E9), UL64(0x0FBB15859E987683),
+          UL64(0xADD70DF247319A2B), UL64(0x4B98BABA374BE470),
+          UL64(0xF03D747356A7B307), UL64(0x342E696E3EFEBF30) },
+        { UL64(0xF84B48F7864AC537), UL64(0x04713409A6940D3D),
+          UL64(0x014DB22D6174C7AE), UL64(0xC73A1C438C213034),
+          UL64(0x18AC4EA5FFDD93EC), UL64(0x724FC7576102783E),
+          UL64(0x9FE13FCC91C3E83F), UL64(0x92A8C2C8F08F0BF5) },
+        { UL64(0x7F2E22FD8F67F6DE), UL64(0xAB018833D8693177),
+          UL64(0x266D1DB6863ECA95), UL64(0x6BB7732B31B5EF2B),
+          UL64(0x4FA927C6915F80CE), UL64(0x6FA1D6D25F90EFD8),
+          UL64(0x7BD75DE8456B48AD), UL64(0xD2CB507A845B6429) },
+        { UL64(0xA72CF82AE255D7EC), UL64(0x52025C23A460E204),
+          UL64(0x10AE542D7D5B0A44), UL64(0xA85143109305AEDA),
+          UL64(0x958315F5A14BBFE8), UL64(0x3F361826385365FE),
+          UL64(0xC2B3A36B66D95040), UL64(0x12C7B3347CF4EDA2) },
+        { UL64(0xA545B4D1E744119D), UL64(0x4C93B169829A71E7),
+          UL64(0x2DBB908C6117FCBF), UL64(0x4DC97320B35A3D85),
+          UL64(0x94C04F856BF88105), UL64(0x452E1BCE1B51BC1F),
+          UL64(0x0C41FF50B3013AF3), UL64(0xF07AF445224D7E24) },
+        { UL64(0xBDB9E57CA3D24F6A), UL64(0x8A8246D7F345A763),
+          UL64(0x73BD2A6D98CFBB5F), UL64(0x1DD8E85E86ED04DB),
+          UL64(0x76F2DA42C01F420B), UL64(0x7EF0547364407BC7),
+          UL64(0x7E98BA7FAFF548F5), UL64(0x6B7AFBEEFD30B64A) },
+        { UL64(0x4F922FC516A0D2BB), UL64(0x0D5CC16C1A623499),
+          UL64(0x9241CF3A57C62C8B), UL64(0x2F5E6961FD1B667F),
+          UL64(0x5C15C70BF5A01797), UL64(0x3D20B44D60956192),
+          UL64(0x04911B37071FDB52), UL64(0xF648F9168D6F0F7B) },
+        { UL64(0x067639EAEB2572F8), UL64(0xB0CEF632D70853CE),
+          UL64(0xD87F1F31E9989004), UL64(0x94AA7236A26582C0),
+          UL64(0x4211B8E5B0C2C656), UL64(0x05AAA79BA257414E),
+          UL64(0x0672F841E0F09AB0), UL64(0xA3C5F9BF3EC81C65) },
+        { UL64(0x4CF6379AE003F0FA), UL64(0x7917E0871E75C8B0),
+          UL64(0x1DC059FCA1383C9F), UL64(0xA8614EA664480967),
+          UL64(0xC34D0D0179625DD1), UL64(0x7D47A1E14200E788),
+          UL64(0xAEF99D1EA754A59D), UL64(0x1C812D0049B14178) },
+        { UL64(0xA4A11BB60877B3A7), UL64(0x244D11A62CD521A9),
+          UL64(0x464B19B7BFF5C62C), UL64(0x27F3EBA79076657C),
+          UL64(0x483ABF970C7581A9), UL64(0x2EF108E0AE0B22F3),
+          UL64(0xD603F3665064BCD5), UL64(0xCF4875A75BF5025E) },
+        { UL64(0xAB9302E5D0D5D22C), UL64(0xD0A7E6B030124030),
+          UL64(0xE262C57B4F0AA1F4), UL64(0x497A58A50BBA202E),
+          UL64(0x109FD21EE6CFCCAC), UL64(0xB596CCE68A1927EC),
+          UL64(0x48B9F7E83B02E85A), UL64(0xBF7EF83C08591134) },
+        { UL64(0xE05E91B162EDC562), UL64(0xB5E1FE7262BCD185),
+          UL64(0x1D526908B8105B19), UL64(0x0D11447E896BBB22),
+          UL64(0x647AAA492C2213F0), UL64(0xF6C9F8C62E2FC14B),
+          UL64(0x90CA259ABC4168C6), UL64(0x3BB92762DD8E3461) },
+        { UL64(0x157FC0945B20189A), UL64(0x6E72C62D0BF5C8AB),
+          UL64(0xF7F489E1357750B7), UL64(0x18511AB2F87D31C5),
+          UL64(0xA4267827005F35C5), UL64(0xA28CA0549480ED6D),
+          UL64(0x20EFDE7C77247DB2), UL64(0x5E160439A4149D60) },
+        { UL64(0x5C10B148F3DEAE70), UL64(0x02044B536EABC433),
+          UL64(0x1E82790CFE63F18E), UL64(0x2886B65AAA695FF1),
+          UL64(0x994FDF934627A4ED), UL64(0xE9B4DEC0872EB0B9),
+          UL64(0x4C0BEC8D58F7A28F), UL64(0xC30C4DEDEAF9C5FE) },
+        { UL64(0x6DC1ACAFE60B7CF7), UL64(0x25860A5084A9D869),
+          UL64(0x56FC6F09E7BA8AC4), UL64(0x828C5BD06148D29E),
+          UL64(0xAC6B435EDC55AE5F), UL64(0xA527F56CC0117411),
+          UL64(0x94D5045EFD24342C), UL64(0x2C4C0A3570B67C0D) },
+        { UL64(0x69F63538B65579CD), UL64(0xD070605CADF933A1),
+          UL64(0x017E870583BE9F6C), UL64(0xE9442FAAB247B8A1),
+          UL64(0x54EEFF9E540D3D68), UL64(0x1F3EDEABCAE3BE19),
+          UL64(0x95C528B07035311B), UL64(0xB35D3AB796BCC0A7) },
+        { UL64(0x9BCA3CFA5ED398B5), UL64(0x6A60B4651353DDD7),
+          UL64(0x905C17BB1A1C51D1), UL64(0x27A304817F5CF91B),
+          UL64(0xC4660CF39ED6BF0A), UL64(0xB0B03FB1F79E1D56),
+          UL64(0xE3A13BF136001354), UL64(0x9A7250541F2B2B2A) },
+        { UL64(0xB4897D052106E16D), UL64(0x85BBDF9B50A07F8C),
+          UL64(0x42632A3D6C49FFD7), UL64(0xB7885E7C600720B8),
+          UL64(0x6FA47FDCDEB694AC), UL64(0x384614F58AE0D179),
+          UL64(0x78FCBA29BD124AB3), UL64(0xBB113D9E748F12EA) },
+        { UL64(0x3C23EF99A7CD3018), UL64(0x2C3FC50683DEFD8F),
+          UL64(0xF97A45FF2B88499B), UL64(0xAEAA3221346E7F6A),
+          UL64(0xE747348450F32730), UL64(0xC2C0B8BB0FD6CA41),
+          UL64(0xA9882079AF17C114), UL64(0x0635F7A61BDE7204) },
+        { UL64(0xC3B013D0F38493FE), UL64(0xA32CAE9607BAF718),
+          UL64(0x371DA6C22095B3BA), UL64(0x031C0ABDB041909E),
+          UL64(0x11CC6DBE431A9E60), UL64(0x7E9194765BF38F6E),
+          UL64(0xBE47F076462A4A33), UL64(0x33B3C9DF3041B830) },
+        { UL64(0xA7D74D4E7B63BD85), UL64(0xEA36C65543E23DA6),
+          UL64(0xCD7B7D7FE5A79629), UL64(0x1FB1F74713CAC01D),
+          UL64(0xAA0FE1459028DED3), UL64(0xB123CA3B19572097),
+          UL64(0x21A8746D74838677), UL64(0x1CFC7ACB63ABCCC6) },
+        { UL64(0x02653302E5053D70), UL64(0x3C33E35BB8C6BFC9),
+          UL64(0xA72C4B409A021EE9), UL64(0xE11B800D3F6527E4),
+          UL64(0x8FC1D44AB6DC37B5), UL64(0x5D8606B5F580E474),
+          UL64(0xDF25754A87B5B0FA), UL64(0xBAF50CE8BB692A5E) },
+        { UL64(0x027CC8B8FAC61D9A), UL64(0x7D25E062E3C6FE8A),
+          UL64(0xE08805BFE5BFF503), UL64(0x13271E6C6FF632F7),
+          UL64(0x55DCA6C0232F76A5), UL64(0x8957C32D701EF426),
+          UL64(0xEE728BCBA10A5178), UL64(0x5EA60411B62C5173) },
+    },
+    {
+        { UL64(0x9AD5462BB4D8BC50), UL64(0x181C0B16A9195770),
+          UL64(0xEBD4FE1C78412A68), UL64(0xAE0341BCC0DFF48C),
+          UL64(0xB6BC45CF7003E866), UL64(0xF11A6DEA8A24A41B),
+          UL64(0x5407151AD04C24C2), UL64(0x62C9D27DDA5B7B68) },
+        { UL64(0x0A50B12E523B8BF6), UL64(0x8009EB5B8F910C1B),
+          UL64(0xF535AF824A167588), UL64(0x0F835F9CFB2A2ABD),
+          UL64(0xF59B29312AFCEB62), UL64(0xC797DF2A169D383F),
+          UL64(0xEB3F5FB066AC02B0), UL64(0x029D4C6FDAA2D0CA) },
+        { UL64(0xB82226052B7CE542), UL64(0xE6D4CE997472BDE1),
+          UL64(0x53E16EBE09D2F4DA), UL64(0x180FF42E53B92B2E),
+          UL64(0xC59BCC022C34A1C6), UL64(0x3803D6F9422C46C2),
+          UL64(0x18AFF74F5C14A8A2), UL64(0x55AEBF8010A08B28) },
+        { UL64(0x58AF2010F5B343BC), UL64(0x0F2E400AF2F142FE),
+          UL64(0x3483BFDEA85F4BDF), UL64(0xF0B1D09303BFEAA9),
+          UL64(0x2EA01B95C7081603), UL64(0xE943E4C93DBA1097),
+          UL64(0x47BE92ADB438F3A6), UL64(0x00BB7742E5BF6636) },
+        { UL64(0x137A4FB486DF2A61), UL64(0xA1ED9C07ECF7B4A2),
+          UL64(0xB2E460E27BD042FF), UL64(0xB7F5E2FA5F62F5EC),
+          UL64(0x7AA6EC6BCC2423B7), UL64(0x75CE0A7FBA63EEA7),
+          UL64(0x67A45FB1F250A6E1), UL64(0x93BC919CE53CDC9F) },
+        { UL64(0xEC2FCCAADDCE3345), UL64(0x2A6811B7012A4350),
+          UL64(0x96760FF1AC598BDC), UL64(0x054D652AD1BF4128),
+          UL64(0x0A1151D492A21005), UL64(0xAD7F397133110FDF),
+          UL64(0x8C95928C1960100F), UL64(0x6C91C8257BF03362) },
+        { UL64(0x19E6125DEC3F1DEC), UL64(0x07B1F040911178DA),
+          UL64(0xD93EDEDA904A6738), UL64(0x55187A5A0BEBEDCD),
+          UL64(0xF7D04722EB329D41), UL64(0xF449099EF170B391),
+          UL64(0xFD317A69CA99F828), UL64(0x50C3DB2B34A4976D) },
+        { UL64(0xB674481B7BFE7178), UL64(0x4E1DEBAE65405868),
+          UL64(0x061B2821C48C867D), UL64(0x69C15B35513B30EA),
+          UL64(0x3B4A166636871088), UL64(0xE5E29F5D1220B1FF),
+          UL64(0x4B82BB35233D9F4D), UL64(0x4E07633318CDC675) },
+        { UL64(0x78D2E8DFCB564473), UL64(0x4349A97357D5621A),
+          UL64(0x9D835D89218F8B24), UL64(0x01FE7BC5079B6EE2),
+          UL64(0xE57F2A2B5B3B5DCE), UL64(0x5A8637B75FE55565),
+          UL64(0x83FF34AEA41DBAE7), UL64(0xFCE1199C950A7A8F) },
+        { UL64(0x374F541F3E707706), UL64(0x9A4D3638A831D0CF),
+          UL64(0x4AB4F4831518CA04), UL64(0x54E3EE5DFE38C318),
+          UL64(0x383AE36403C8819B), UL64(0xA9D1DAA12E17864C),
+          UL64(0x245A97B350EEAA5B), UL64(0x5362D00999BF4E83) },
+        { UL64(0xFC0313C29BD43980), UL64(0x9C954B70F172DB29),
+          UL64(0x679BDCB7F954A21A), UL64(0x6B48170954E2E4FC),
+          UL64(0x318AF5F530BAF1D0), UL64(0x26EA8A3CCBF92060),
+          UL64(0xC3C69D7CCD5AE258), UL64(0xA73BA0470EAD07C9) },
+        { UL64(0x3A63C39731815E69), UL64(0x6DF9CBD6DCDD2802),
+          UL64(0x4C47ED4A15B4F6AF), UL64(0x62009D826AC0F978),
+          UL64(0x664D80D28B898FC7), UL64(0x72F1EEDA2C17C91F),
+          UL64(0x9E84D3BC7AAE6609), UL64(0x58C7C19528376895) },
+        { UL64(0xDCFF7630D9294F07), UL64(0x89B765D68DBA8FD0),
+          UL64(0x553E55DE8DBCACCD), UL64(0x9B4A009EED702BF8),
+          UL64(0xF6E534DD27B8CA0D), UL64(0xC4496B346177FD52),
+          UL64(0x378CE6F6C87BB7B7), UL64(0x68633D4844CC19F0) },
+        { UL64(0x73DEB9915E422063), UL64(0x7AD264274A751BC0),
+          UL64(0xE6DCE2224414344F), UL64(0xAD01EFF785811F28),
+          UL64(0x25486590BA68B72B), UL64(0xDB93264A203635AF),
+          UL64(0x1EB01F8A2822660A), UL64(0xAE2DCEE8EE598C64) },
+        { UL64(0x3559E7B67DC17874), UL64(0xD0CAF0EF8195CC2A),
+          UL64(0x07C067880CD24DD9), UL64(0x01A99EA002857C41),
+          UL64(0xD86579E490F82F63), UL64(0xB1E0658AE41C9237),
+          UL64(0x075FFAFD93FD1E79), UL64(0x6E70403547F60B8F) },
+        { UL64(0x0D53F5C7A3E6FCED), UL64(0xE8CBBDD5F45FBDEB),
+          UL64(0xF85C01DF13339A70), UL64(0x0FF71880142CEB81),
+          UL64(0x4C4E8774BD70437A), UL64(0x5FB32891BA0BDA6A),
+          UL64(0x1CDBEBD2F18BD26E), UL64(0x2F9526F103A9D522) },
+        { UL64(0x765186DABE51B0A6), UL64(0x5376E9F473CE9088),
+          UL64(0xE3ED800B5B5BD85A), UL64(0x242895524DC1E604),
+          UL64(0xE76DCC47EF27D35E), UL64(0x4396EED69000A67D),
+          UL64(0x73B33BA084DE92C1), UL64(0x226453AE377601FE) },
+        { UL64(0xECFC6075C1F7E9C2), UL64(0x6A217620BE5AEC34),
+          UL64(0x3781D0549EA33BA8), UL64(0x84EF35ABD86B85D4),
+          UL64(0x914AA33C461FEE83), UL64(0xF311E5C9B25F7D6C),
+          UL64(0xC6110DAAC33D495C), UL64(0x8A7EE583818554B9) },
+        { UL64(0x3612732AA7F4EC0E), UL64(0xEE3E88D09D71348F),
+          UL64(0xB7A107E47599CFDB), UL64(0x1F5DE7E8611B51C6),
+          UL64(0xD6A11D591051AAAA), UL64(0x3DE531F055F0C386),
+          UL64(0x09F95C7309F20E66), UL64(0x6421AA1A9E414B79) },
+        { UL64(0xA752C905A8271D7E), UL64(0x4735DFA558E5810B),
+          UL64(0xE18A44EE5D925AEB), UL64(0x9708697F13C8A853),
+          UL64(0x8377D540BFCC9A0B), UL64(0x7B27E01CE574D403),
+          UL64(0x3D3D180CCF60A8A6), UL64(0xE48EF152F1C298BF) },
+        { UL64(0xB8B660B1B829B060), UL64(0x9FA73EF15F55C69B),
+          UL64(0xC75F19ECEF207888), UL64(0xB19B2B60282B129E),
+          UL64(0xB2F327EEBF4730C7), UL64(0xEB9DF659C973C0BE),
+          UL64(0xD14913C165C1DB98), UL64(0x80F57DD4F79D1A9C) },
+        { UL64(0x1104026F66392821), UL64(0x253DBEF7E1798449),
+          UL64(0x3C4B34373F3E5618), UL64(0x5B5546D62C64E041),
+          UL64(0xADB5327957C5762B), UL64(0x5DCBD0F092958DF3),
+          UL64(0x2C457444F64FBDBE), UL64(0xB4ABC3821D408175) },
+        { UL64(0x0C2DE79BE919D779), UL64(0x1584694A242E78BD),
+          UL64(0xA4756D94F61376C9), UL64(0xFBCCA7BC34DC2798),
+          UL64(0x5E875319108DF0A1), UL64(0xE2EC01AE293E899D),
+          UL64(0xC928A4EF92357091), UL64(0xD5A28987F62ED065) },
+        { UL64(0x313A2E8C0AEAA3C0), UL64(0x89F46D9EABE85B0A),
+          UL64(0xD2889EBD2DA97D3A), UL64(0x9484026A103F8CBA),
+          UL64(0x52159F8A87D83B5F), UL64(0xDB2220D6B1EF0295),
+          UL64(0xBDA0746E03C01ACF), UL64(0x4F97B2A714419FE3) },
+        { UL64(0xAC0436F72555209F), UL64(0x203466A2162773EC),
+          UL64(0xC53F8739B48E59FE), UL64(0xB24CDA2B88845660),
+          UL64(0x8D74B5F9FA5E399A), UL64(0xFF3DED0B6F92255E),
+          UL64(0xC76C31FE045C9E0A), UL64(0x85BAA0446D2B4662) },
+        { UL64(0xB8AF8BBEEDF05D51), UL64(0x8653C7A6718F8DB8),
+          UL64(0x14FEB48BCF00FFDD), UL64(0xFCBCF7DB5CA9E140),
+          UL64(0x73B4ECE8D9D8FDB7), UL64(0xDC69D3682F389921),
+          UL64(0x10D32EE4C88BC219), UL64(0xC04D2C27921C2D96) },
+        { UL64(0x6981FDB83D1073FD), UL64(0x252AF70D6C78200E),
+          UL64(0x60D0E867A9EF577E), UL64(0x66E63FE8A413E067),
+          UL64(0xBBDCB173B914153A), UL64(0xB59AE623CCB4A0A8),
+          UL64(0x340530203C35B8A0), UL64(0x19B8816F30DAF2FF) },
+        { UL64(0xCCBF7AC2C880E5CA), UL64(0x8299DBEE8D11C450),
+          UL64(0xBB27D11B0F77A6BF), UL64(0xC601630B5EDCE793),
+          UL64(0xDB73B9FB79E7F8EA), UL64(0xE448BBA7F4367288),
+          UL64(0xF5B6416FB035571B), UL64(0x981B8F5DA48891A2) },
+        { UL64(0x009690FFB4FBFAA0), UL64(0x8BBBDAB73619C6DB),
+          UL64(0xC6D44273728356E8), UL64(0xFD76F0D8E453EC35),
+          UL64(0x775C2554AAC28A29), UL64(0x28F7AF9D5C55E4F0),
+          UL64(0xBACF54A688E8AD4D), UL64(0x85B018E80AA76DDF) },
+        { UL64(0x8FC8B3B909C37A93), UL64(0x758FEBCBA199B02C),
+          UL64(0x5C9B45388F3B208C), UL64(0x7C8584DEF2BA90F0),
+          UL64(0x52751A1CB395CCE3), UL64(0xBB59E4EBC1D45F50),
+          UL64(0xF7CDB911B0635DAC), UL64(0xE924D371D3243694) },
+        { UL64(0x6532C0FD6553A8D6), UL64(0x42B8CBA545165A6D),
+          UL64(0x9C6D88EA3CF12D92), UL64(0x0EC93530906DB0C5),
+          UL64(0x494606F8ECCC6CDF), UL64(0xA7ED66FCC6387899),
+          UL64(0x91022E178A35AE4C), UL64(0x28DBCAE6ECA7BEC3) },
+        { UL64(0x40CE305192C4D684), UL64(0x8B04D7257612EFCD),
+          UL64(0xB9DCDA366F9CAE20), UL64(0x0EDC4D24F058856C),
+          UL64(0x64F2E6BF85427900), UL64(0x3DE81295DC09DFEA),
+          UL64(0xD41B4487379BF26C), UL64(0x50B62C6D6DF135A9) },
+    },
+    {
+        { UL64(0x0DB2FB5ED005832A), UL64(0x5F5EFD3B91042E4F),
+          UL64(0x8C4FFDC6ED70F8CA), UL64(0xE4645D0BB52DA9CC),
+          UL64(0x9596F58BC9001D1F), UL64(0x52C8F0BC4E117205),
+          UL64(0xFD4AA0D2E398A084), UL64(0x815BFE3A104F49DE) },
+        { UL64(0x54EB3ACCE548B37B), UL64(0xB38E754284D40549),
+          UL64(0x8C3DAA517B341B4F), UL64(0x2F6928EC690BF7FA),
+          UL64(0x0496B32386CE6C41), UL64(0x01BE1C5510ADADCD),
+          UL64(0xC04E67E74BB5FAF9), UL64(0x3CBAF678E15C9985) },
+        { UL64(0x524D226AD7AB9A2D), UL64(0x9C00090D7DFAE958),
+          UL64(0x0BA5F5398751D8C2), UL64(0x8AFCBCDD3AB8262D),
+          UL64(0x57392729E99D043B), UL64(0xEF51263BAEBC943A),
+          UL64(0x9FEACE9320862935), UL64(0x639EFC03B06C817B) },
+        { UL64(0xE839BE7D341D81DC), UL64(0xCDDB688932148379),
+          UL64(0xDA6211A1F7026EAD), UL64(0xF3B2575FF4D1CC5E),
+          UL64(0x40CFC8F6A7A73AE6), UL64(0x83879A5E61D5B483),
+          UL64(0xC5ACB1ED41A50EBC), UL64(0x59A60CC83C07D8FA) },
+        { UL64(0xDEC98D4AC3B81990), UL64(0x1CB837229E0CC8FE),
+          UL64(0xFE0B0491D2B427B9), UL64(0x0F2386ACE983A66C),
+          UL64(0x930C4D1EB3291213), UL64(0xA2F82B2E59A62AE4),
+          UL64(0x77233853F93E89E3), UL64(0x7F8063AC11777C7F) },
+        { UL64(0x604AC97C59371000), UL64(0xE1C48C707F759C18),
+          UL64(0x3F62ECC5A5DB6B65), UL64(0x0A78B17338A21495),
+          UL64(0x6BE1819DBCC8AD94), UL64(0x70DC04F6D89C3400),
+          UL64(0x462557B4A6B4840A), UL64(0x544C6ADE60BD21C0) },
+        { UL64(0x36E607CF02FF6072), UL64(0xA47D2CA98AD98CDC),
+          UL64(0xBF471D1EF5F56609), UL64(0xBCF86623F264ADA0),
+          UL64(0xB70C0687AA9E5CB6), UL64(0xC98124F217401C6C),
+          UL64(0x8189635FD4A61435), UL64(0xD28FB8AFA9D98EA6) },
+        { UL64(0x439530B665C7322D), UL64(0xCF12CC01B3C1B3FB),
+          UL64(0xC70B01860172F685), UL64(0xB915EE221B58391D),
+          UL64(0x9AFDF03BA317DB24), UL64(0x87DEC65917B8FFC4),
+          UL64(0x7F46597BE4D3D050), UL64(0x80A1C1ED006500E7) },
+        { UL64(0x3D4DA8C3017025F3), UL64(0xEFCF628CFB9579B4),
+          UL64(0x5C4D00161F3716EC), UL64(0x9C27EBC46801116E),
+          UL64(0x5EBA0EA11DA1767E), UL64(0xFE15145247004C57),
+          UL64(0x3ACE6DF68C2373B7), UL64(0x75C3DFFE5DBC37AC) },
+        { UL64(0xA2A147DBA28A0749), UL64(0x246C20D6EE519165),
+          UL64(0x5068D1B1D3810715), UL64(0xB1E7018C748160B9),
+          UL64(0x03F5B1FAF380FF62), UL64(0xEF7FB1DDF3CB2C1E),
+          UL64(0xEAB539A8FC91A7DA), UL64(0x83DDB707F3F9B561) },
+        { UL64(0xB57276D980101B98), UL64(0x760883FDB82F0F66),
+          UL64(0x89D7DE754BC3EFF3), UL64(0x03B606435DC2AB40),
+          UL64(0xCD6E53DFE05BEEAC), UL64(0xF2F1E862BC3325CD),
+          UL64(0xDD0F7921774F03C3), UL64(0x97CA72214552CC1B) },
+        { UL64(0xE79A4AF09CEC46EA), UL64(0xB15347A1658B9BC7),
+          UL64(0x6BD2796F35AF2F75), UL64(0xAC9579904051C435),
+          UL64(0x2669DDA3C33A655D), UL64(0x5D503C2E88514AA3),
+          UL64(0xDFA113373753DD41), UL64(0x3F0546730B754F78) },
+        { UL64(0x760CB3B5E224C5D7), UL64(0xFA3BAF8C68616919),
+          UL64(0x9FBCA1138D142552), UL64(0x1AB18BF17669EBF5),
+          UL64(0x55E6F53E9BDF25DD), UL64(0x04CC0BF3CB6CD154),
+          UL64(0x595BEF4995E89080), UL64(0xFE9459A8104A9AC1) },
+        { UL64(0x49D66316A8123EF0), UL64(0x73C32DB4E7F95438),
+          UL64(0x2E2ED2090D9E7854), UL64(0xF98A93299D9F0507),
+          UL64(0xC5D33CF60C6AA20A), UL64(0x9A32BA1475279BB2),
+          UL64(0x7E3202CB774A7307), UL64(0x64ED4BC4E8C42DBD) },
+        { UL64(0x694B64C5ABB020E8), UL64(0x3D18C18419C4EEC7),
+          UL64(0x9C4673EF1C4793E5), UL64(0xC7B8AEB5056092E6),
+          UL64(0x3AA1CA43F0F8C16B), UL64(0x224ED5ECD679B2F6),
+          UL64(0x0D56EEAF55A205C9), UL64(0xBFE115BA4B8E028B) },
+        { UL64(0x3E22A7B397ACF4EC), UL64(0x0426C4005EA8B640),
+          UL64(0x5E3295A64E969285), UL64(0x22AABC59A6A45670),
+          UL64(0xB929714C5F5942BC), UL64(0x9A6168BDFA3182ED),
+          UL64(0x2216A665104152BA), UL64(0x46908D03B6926368) },
+        { UL64(0x9B8BE0247FCBA850), UL64(0x81EB5797820A181E),
+          UL64(0xA0F2812230A01211), UL64(0x7E9CDC3CAE7B8821),
+          UL64(0x202332CC72CE15E7), UL64(0xCD3CB2BBCB8238D7),
+          UL64(0xE4AB63DFC6E82C43), UL64(0x58BD00283183D717) },
+        { UL64(0xD18D46E8F32942AB), UL64(0x6C766EF610882418),
+          UL64(0x8EFFCB1A0CC6CD6B), UL64(0x5A1DA05C68D85960),
+          UL64(0xC7A5F4A532296E1C), UL64(0x3D0F1E43C90D2EC8),
+          UL64(0x29943A22899729D9), UL64(0x877A8A26360E5317) },
+        { UL64(0x02D57B7E717ED7B5), UL64(0xD22E5B244DBCE1A2),
+          UL64(0x174BD7712A4CDCF5), UL64(0xA6FDB801408205BB),
+          UL64(0x67B4B0695E1387E9), UL64(0x332B19A10591A442),
+          UL64(0x24EDD916CCACF366), UL64(0xBE34CC4534958A50) },
+        { UL64(0x81597699061C184B), UL64(0x653D105C63898952),
+          UL64(0xDA9106DE7B5EFCAD), UL64(0xA0335AA68AA61452),
+          UL64(0x337D7C894FFABA04), UL64(0x9DCED4FE8EA990F6),
+          UL64(0x3628B3B6268C5728), UL64(0xF9937089C2AA21EC) },
+        { UL64(0xA3F46E1E3E66D391), UL64(0xB4A732CD7D6369B2),
+          UL64(0x99C3B85D402C1022), UL64(0x7DCCFCBE2B54932E),
+          UL64(0xA6DDAA7B56B1DFE2), UL64(0x31DC78A5E34A82C9),
+          UL64(0x8ABEB3DA704F3941), UL64(0xDF11A36CCA55FA98) },
+        { UL64(0xD53B8E3489861966), UL64(0x79FB20A1A0EA996B),
+          UL64(0x300647D95AD37F43), UL64(0xB44DB4A853A7E3CD),
+          UL64(0x9EE3E1B92E6659FB), UL64(0x4B3263725F687220),
+          UL64(0x6EC26825B1A10143), UL64(0xB4B6762B867D6F0B) },
+        { UL64(0x6C01F77A16E00C1B), UL64(0x82515490839EAAAC),
+          UL64(0x62F3A4EF3470D334), UL64(0x5A29A6491C1DCD6C),
+          UL64(0x46B6782ECE997A25), UL64(0x9978FB35D3579953),
+          UL64(0x98F5A9DF0960E0CE), UL64(0x547DC8391F527A4C) },
+        { UL64(0x52CB8AC6C2BABCC1), UL64(0x4748D448FE81AE8D),
+          UL64(0x5844F03F80F1A711), UL64(0x3DB784B2F8DF4AC4),
+          UL64(0xAD918F122DF1FE36), UL64(0xE40F25B9F33CC7C0),
+          UL64(0x4700D0E73B5E5555), UL64(0x5C28FA08B03326F9) },
+        { UL64(0x395B15835D9DC24F), UL64(0xA4256932C73AE680),
+          UL64(0x0542960EFAA2C8E9), UL64(0x2BB3ADEE71068C6A),
+          UL64(0xA706099B570B4554), UL64(0x85D12BB5F4E278D6),
+          UL64(0xD78AF6F664296843), UL64(0xC7D3B3888428C633) },
+        { UL64(0x4C3B6709DB3F9758), UL64(0x169EDA4E341D8C1A),
+          UL64(0xBD4F2F189613A6D2), UL64(0x9A002B4ED7CDA536),
+          UL64(0x97BDF8D1776103B9), UL64(0x9C670D34B37945BA),
+          UL64(0x9B83E384D78C5BBF), UL64(0x6E2D3BCF518D14B2) },
+        { UL64(0x34D44F9343B7E597), UL64(0xDDE440A7C2530F42),
+          UL64(0x7270A0817856BDB9), UL64(0x86A945EB5353032F),
+          UL64(0x6C2F8E9966D39810), UL64(0x0642A31B9B8B4B6B),
+          UL64(0x51679E62D1509D82), UL64(0x0120001C90F8FF16) },
+        { UL64(0x50A1C1062E36E34A), UL64(0x74E8F58CE024ED1A),
+          UL64(0x3F0F1DFA1300D726), UL64(0x6680DF267B4A2D18),
+          UL64(0x12B5979D8235B3B7), UL64(0x1D2FAFCB8A611493),
+          UL64(0x73EBDA968848ECE5), UL64(0xE996C275A413E399) },
+        { UL64(0x46B7D7C7495FF000), UL64(0xE60ED097BAED95D1),
+          UL64(0xAA8804AC6E38F9C0), UL64(0x92990C0645C6F9BB),
+          UL64(0xCAE6A439C0919851), UL64(0x713DFF151BF5E1F2),
+          UL64(0x5D262C302EB38CDB), UL64(0xB73D505190DF31DF) },
+        { UL64(0x85C832C2E55B2FE5), UL64(0xF25121659119DEFC),
+          UL64(0xFCFDE3BC99B00FE4), UL64(0x8067F5E3D1908B17),
+          UL64(0xE921F6B31443AE42), UL64(0xA2CFED9264EA593B),
+          UL64(0x1589B96259E07A35), UL64(0xC6BB390A0DA762DD) },
+        { UL64(0x921E7B1C32D9268C), UL64(0x34DB2B964276FAD4),
+          UL64(0x0EC56D34CC44E730), UL64(0x59BE3A46096545B7),
+          UL64(0xE9FDBC9766CF3A6A), UL64(0x7B2F83EDD04E9B53),
+          UL64(0x6D99B3CC8FBAE3E7), UL64(0x8EB5646C7ADA3A40) },
+        { UL64(0xA9F5D8745A1251FB), UL64(0x967747A8C72725C7),
+          UL64(0x195C33E531FFE89E), UL64(0x609D210FE964935E),
+          UL64(0xCAFD6CA82FE12227), UL64(0xAF9B5B960426469D),
+          UL64(0x2E9EE04C5693183C), UL64(0x1084A333C8146FEF) },
+    },
+    {
+        { UL64(0x96649933AED1D1F7), UL64(0x566EAFF350563090),
+          UL64(0x345057F0AD2E39CF), UL64(0x148FF65B1F832124),
+          UL64(0x042E89D4CF94CF0D), UL64(0x319BEC84520C58B3),
+          UL64(0x2A2676265361AA0D), UL64(0xC86FA3028FBC87AD) },
+        { UL64(0x6B66D7E1ADC1696F), UL64(0x98EBE5930ACD72D0),
+          UL64(0x65F24550CC1B7435), UL64(0xCE231393B4B9A5EC),
+          UL64(0x234A22D4DB067DF9), UL64(0x98DDA095CAFF9B00),
+          UL64(0x1BBC75A06100C9C1), UL64(0x1560A9C8939CF695) },
+        { UL64(0x0850325EFE51BF74), UL64(0x9C4F579E5E460094),
+          UL64(0x5C87B92A76DA2F25), UL64(0x889DE4E06FEBEF33),
+          UL64(0x6900EC06646083CE), UL64(0xBE2A0335BFE12773),
+          UL64(0xADD1DA35C5344110), UL64(0x757568B7B802CD20) },
+        { UL64(0xE4050F1CF1C367CA), UL64(0x9BC85A9BC90FBC7D),
+          UL64(0xA373C4A2E1A11032), UL64(0xB64232B7AD0393A9),
+          UL64(0xF5577EB0167DAD29), UL64(0x1604F30194B78AB2),
+          UL64(0x0BAA94AFE829348B), UL64(0x77FBD8DD41654342) },
+        { UL64(0x6FF651B494A7CD2E), UL64(0x5671FFD10699336C),
+          UL64(0x6F5FD2CC979A896A), UL64(0x11E893A8D8148CEF),
+          UL64(0x988906A165CF7B10), UL64(0x81B67178C50D8485),
+          UL64(0x7C0DEB358A35B3DE), UL64(0x423AC855C1D29799) },
+        { UL64(0x719F69E109618708), UL64(0xCC9E8364C183F9B1),
+          UL64(0xEC203A95366A21AF), UL64(0x6AEC5D6D068B141F),
+          UL64(0xEE2DF78A994F04E9), UL64(0xB39CCAE8271245B0),
+          UL64(0xB875A4A997E43F4F), UL64(0x507DFE11DB2CEA98) },
+        { UL64(0x314B7AEA5232123D), UL64(0x08307C8C65AE86DB),
+          UL64(0x06E7165CAA4668ED), UL64(0xB170458BB4D3EC39),
+          UL64(0x4D2E3EC6C19BB986), UL64(0xC5F34846AE0304ED),
+          UL64(0x917695A06C9F9722), UL64(0x6C7F73174CAB1C0A) },
+        { UL64(0x31F14802FCF0A7FD), UL64(0x42FD07895488B01E),
+          UL64(0x71D78D6D9952B498), UL64(0x8EB572D907AC5201),
+          UL64(0xE0A2A44C4D194A88), UL64(0xD2B63FD9BA017E66),
+          UL64(0x78EFC6C8F888AEFC), UL64(0xB76F6BDA4A881A11) },
+        { UL64(0xBF0BE101B2A67238), UL64(0x3556D367AF9C14F2),
+          UL64(0x104B7831A5662075), UL64(0x58CA59BB79D9E60A),
+          UL64(0x4BC45392A569A73B), UL64(0x517A52E85698F6C9),
+          UL64(0x85643DA5AEADD755), UL64(0x1AED0CD52A581B84) },
+        { UL64(0xA0F726BC19F9E967), UL64(0xD9D03152E8FBBF4E),
+          UL64(0xCFD6F51DB7707D40), UL64(0x633084D963F6E6E0),
+          UL64(0xEDCD9CDC55667EAF), UL64(0x73B7F92B2E44D56F),
+          UL64(0xFB2E39B64E962B14), UL64(0x7D408F6EF671FCBF) },
+        { UL64(0x9EEA3075F8DFCF8A), UL64(0xA284F0AA95669825),
+          UL64(0xB3FCA250867D3FD8), UL64(0x20757B5F269D691E),
+          UL64(0xF2C2402093B8A5DE), UL64(0xD3F93359EBC06DA6),
+          UL64(0x1178293EB2739C33), UL64(0xD2A3E770BCD686E5) },
+        { UL64(0xA2F7932C68AF43EE), UL64(0x5502468E703D00BD),
+          UL64(0xE5DC978F2FB061F5), UL64(0xC9A1904A28C815AD),
+          UL64(0xD3AF538D470C56A4), UL64(0x159ABC5F193D8CED),
+          UL64(0x2A37245F20108EF3), UL64(0xFA17081E223F7178) },
+        { UL64(0x2A206E8DECF2A73A), UL64(0x066A63978E551994),
+          UL64(0x3A6A088AB98D53A2), UL64(0x0CE7C67C2D1124AA),
+          UL64(0x48CEC671759A113C), UL64(0xE3B373D34F6F67FA),
+          UL64(0x5455D479FD36727B), UL64(0xE5A428EEA13C0D81) },
+        { UL64(0x6BFEEA5F16B1BD5E), UL64(0xF957E4204DE30AD3),
+          UL64(0xCBAF664E6A353B9E), UL64(0x5C87331226D14FEB),
+          UL64(0x4E87F98CB65F57CB), UL64(0xDB60A6215E0CDD41),
+          UL64(0x67C16865A6881440), UL64(0x1093EF1A46AB52AA) },
+        { UL64(0x93BCCBBABB2EEC64), UL64(0xA0C23B64DA03ADBE),
+          UL64(0x5F7AA00AE0E86AC4), UL64(0x470B941EFC1401E6),
+          UL64(0x5AD8D6799DF43574), UL64(0x4CCFB8A90F65D810),
+          UL64(0x1BCE80E3AA7FBD81), UL64(0x273291AD9508D20A) },
+        { UL64(0x1FE2A9B2B4B4B67C), UL64(0xC1D10DF0E8020604),
+          UL64(0x9D64ABFCBC8058D8), UL64(0x8943B9B2712A0FBB),
+          UL64(0x90EED9143B3DEF04), UL64(0x85AB3AA24CE775FF),
+          UL64(0x605FD4CA7BBC9040), UL64(0x8B34A564E2C75DFB) },
+        { UL64(0x25759F7CE382360F), UL64(0xB6DB05C988BF5857),
+          UL64(0x2917D61D6C58D46C), UL64(0x14F8E491FD20CB7A),
+          UL64(0xB68A727A11C20340), UL64(0x0386F86FAF7CCBB6),
+          UL64(0x5C8BC6CCFEE09A20), UL64(0x7D76FF4ABB7EEA35) },
+        { UL64(0x4DABCAAAAA8A5288), UL64(0x91CC0C8AAF23A1C9),
+          UL64(0x34C72C6A3F220E0C), UL64(0xBCC20BDF1232144A),
+          UL64(0x6E2F42DAA20EDE1B), UL64(0xC441F00C74A00515),
+          UL64(0xBF46A5B6734B8C4B), UL64(0x574095037B56C9A4) },
+        { UL64(0xB46836A53FF3571B), UL64(0x24F98B78837927C1),
+          UL64(0x6254256A4533C716), UL64(0xF27ABB0BD07EE196),
+          UL64(0xD7CF64FC5C6D5BFD), UL64(0x6915C751F0CD7A77),
+          UL64(0xD9F590128798F534), UL64(0x772B0DA8F81D8B5F) },
+        { UL64(0x5C18ACF88E2F7D90), UL64(0xFDBF33D777BE32CD),
+          UL64(0x0A085CD7D2EB5EE9), UL64(0x2D702CFBB3201115),
+          UL64(0xB6E0EBDB85C88CE8), UL64(0x23A3CE3C1E01D617),
+          UL64(0x3041618E567333AC), UL64(0x9DD0FD8F157EDB6B) },
+        { UL64(0x386BDA73CE07D1B0), UL64(0xD82910C258AD4178),
+          UL64(0x124F82CFCD2617F4), UL64(0xCC2F5E8DEF691770),
+          UL64(0x82702550B8C30CCC), UL64(0x7B856AEA1A8E575A),
+          UL64(0xBB822FEFB1AB9459), UL64(0x085928BCEC24E38E) },
+        { UL64(0x80463D118FB98871), UL64(0xCB26F5C3BBC76AFF),
+          UL64(0xD4AB8EDDFBE03614), UL64(0xC8EB579BC0CF2DEE),
+          UL64(0xCC004C15C93BAE41), UL64(0x46FBAE5D3AECA3B2),
+          UL64(0x671235CF0F1E9AB1), UL64(0xADFBA9349EC285C1) },
+        { UL64(0xA36C936BB57C6477), UL64(0x871F8B64E94DBCC6),
+          UL64(0x28D0FB62A591A67B), UL64(0x9D40E081C1D926F5),
+          UL64(0x3111EAF6F2D84B5A), UL64(0x228993F9A565B644),
+          UL64(0x0CCBF5922C83188B), UL64(0xF87B30AB3DF3E197) },
+        { UL64(0xB2B2610798FA7AAA), UL64(0x41209EE4F073AA4E),
+          UL64(0xF1570359F2D6B19B), UL64(0xCBE6868CFC577CAF),
+          UL64(0x186C4BDC32C04DD3), UL64(0xA6C35FAECFEEE397),
+          UL64(0xB4A1B312F086C0CF), UL64(0xE0A5CCC6D9461FE2) },
+        { UL64(0xD24E2679A7AAE5D3), UL64(0x7076013D0DE5C1C4),
+          UL64(0x2D50F8BABB05B629), UL64(0x73C1ABE26E66EFBB),
+          UL64(0xEFD4B422F2488AF7), UL64(0xE4105D02663BA575),
+          UL64(0x7EB60A8B53A69457), UL64(0x62210008C945973B) },
+        { UL64(0x1D8E32864B66ABFB), UL64(0xD26F52E559030900),
+          UL64(0x1EE3F6435584941A), UL64(0x6D3B3730569F5958),
+          UL64(0x9FF2A62F4789DBA5), UL64(0x91FCB81572B5C9B7),
+          UL64(0xF446CB7D6C8F9A0E), UL64(0x48F625C139B7ECB5) },
+        { UL64(0x7B7C147730448112), UL64(0x82B51AF1E4A38656),
+          UL64(0x2BF2028A2F315010), UL64(0xC9A4A01F6EA88CD4),
+          UL64(0xF63E95D8257E5818), UL64(0xDD8EFA10B4519B16),
+          UL64(0xED8973E00DA910BF), UL64(0xED49D0775C0FE4A9) },
+        { UL64(0x516FF3A36FA6110C), UL64(0x74FB1EB1FB93561F),
+          UL64(0x6C0C90478457522B), UL64(0xCFD321046BB8BDC6),
+          UL64(0x2D6884A2CC80AD57), UL64(0x7C27FC3586A9B637),
+          UL64(0x3461BAEDADF4E8CD), UL64(0x1D56251A617242F0) },
+        { UL64(0x719946D1A995E094), UL64(0x65E848F6E51E04D8),
+          UL64(0xE62F33006A1E3113), UL64(0x1541C7C1501DE503),
+          UL64(0x4DAAC9FAF4ACFADE), UL64(0x0E58589744CD0B71),
+          UL64(0x544FD8690A51CD77), UL64(0x60FC20ED0031016D) },
+        { UL64(0x3FE712AF64DB4444), UL64(0x19E9D634BECDD480),
+          UL64(0xE08BC047A930978A), UL64(0x2DBF24ECA1280733),
+          UL64(0x3C0AE38C2CD706B2), UL64(0x5B012A5B359017B9),
+          UL64(0x3943C38C72E0F5AE), UL64(0x786167EA57176FA3) },
+        { UL64(0xFA979FB7ABEA49B1), UL64(0xB4B1D27D10E2C6C5),
+          UL64(0xBD61C2C423AFDE7A), UL64(0xEB6614F89786D358),
+          UL64(0x4A5D816B7F6F7459), UL64(0xE431A44F09360E7B),
+          UL64(0x8C27A032C309914C), UL64(0xCEA5D68ACAEDE3D8) },
+        { UL64(0xB84011A9431DD80E), UL64(0xEB7C7CCA73306CD9),
+          UL64(0x20FADD29D1B3B730), UL64(0x83858B5BFE37B3D3),
+          UL64(0xBF4CD193B6251D5C), UL64(0x1CCA1FD31352D952),
+          UL64(0xC66157A490FBC051), UL64(0x7990A63889B98636) },
+    },
+    {
+        { UL64(0xE5AA692A87DEC0E1), UL64(0x010DED8DF7B39D00),
+          UL64(0x7B1B80C854CFA0B5), UL64(0x66BEB876A0F8EA28),
+          UL64(0x50D7F5313476CD0E), UL64(0xA63D0E65B08D3949),
+          UL64(0x1A09EEA953479FC6), UL64(0x82AE9891F499E742) },
+        { UL64(0xAB58B9105CA7D866), UL64(0x582967E23ADB3B34),
+          UL64(0x89AE4447CCEAC0BC), UL64(0x919C667C7BF56AF5),
+          UL64(0x9AEC17B160F5DCD7), UL64(0xEC697B9FDDCAADBC),
+          UL64(0x0B98F341463467F5), UL64(0xB187F1F7A967132F) },
+        { UL64(0x90FE7A1D214AEB18), UL64(0x1506AF3C741432F7),
+          UL64(0xBB5565F9E591A0C4), UL64(0x10D41A77B44F1BC3),
+          UL64(0xA09D65E4A84BDE96), UL64(0x42F060D8F20A6A1C),
+          UL64(0x652A3BFDF27F9CE7), UL64(0xB6BDB65C3B3D739F) },
+        { UL64(0xEB5DDCB6EC7FAE9F), UL64(0x995F2714EFB66E5A),
+          UL64(0xDEE95D8E69445D52), UL64(0x1B6C2D4609E27620),
+          UL64(0x32621C318129D716), UL64(0xB03909F10958C1AA),
+          UL64(0x8C468EF91AF4AF63), UL64(0x162C429FFBA5CDF6) },
+        { UL64(0x2F682343753B9371), UL64(0x29CAB45A5F1F9CD7),
+          UL64(0x571623ABB245DB96), UL64(0xC507DB093FD79999),
+          UL64(0x4E2EF652AF036C32), UL64(0x86F0CC7805018E5C),
+          UL64(0xC10A73D4AB8BE350), UL64(0x6519B3977E826327) },
+        { UL64(0xE8CB5EEF9C053DF7), UL64(0x8DE25B37B300EA6F),
+          UL64(0xDB03FA92C849CFFB), UL64(0x242E43A7E84169BB),
+          UL64(0xE4FA51F4DD6F958E), UL64(0x6925A77FF4445A8D),
+          UL64(0xE6E72A50E90D8949), UL64(0xC66648E32B1F6390) },
+        { UL64(0xB2AB1957173E460C), UL64(0x1BBBCE7530704590),
+          UL64(0xC0A90DBDDB1C7162), UL64(0x505E399E15CDD65D),
+          UL64(0x68434DCB57797AB7), UL64(0x60AD35BA6A2CA8E8),
+          UL64(0x4BFDB1E0DE3336C1), UL64(0xBBEF99EBD8B39015) },
+        { UL64(0x6C3B96F31711EBEC), UL64(0x2DA40F1FCE98FDC4),
+          UL64(0xB99774D357B4411F), UL64(0x87C8BDF415B65BB6),
+          UL64(0xDA3A89E3C2EEF12D), UL64(0xDE95BB9B3C7471F3),
+          UL64(0x600F225BD812C594), UL64(0x54907C5D2B75A56B) },
+        { UL64(0xA93CC5F08DB60E35), UL64(0x743E3CD6FA833319),
+          UL64(0x7DAD5C41F81683C9), UL64(0x70C1E7D99C34107E),
+          UL64(0x0EDC4A39A6BE0907), UL64(0x36D4703586D0B7D3),
+          UL64(0x8C76DA03272BFA60), UL64(0x0B4A07EA0F08A414) },
+        { UL64(0x699E4D2945C1DD53), UL64(0xCADC5898231DEBB5),
+          UL64(0xDF49FCC7A77F00E0), UL64(0x93057BBFA73E5A0E),
+          UL64(0x2F8B7ECD027A4CD1), UL64(0x114734B3C614011A),
+          UL64(0xE7A01DB767677C68), UL64(0x89D9BE5E7E273F4F) },
+        { UL64(0xD225CB2E089808EF), UL64(0xF1F7A27DD59E4107),
+          UL64(0x53AFC7618211B9C9), UL64(0x0361BC67E6819159),
+          UL64(0x2A865D0B7F071426), UL64(0x6A3C1810E7072567),
+          UL64(0x3E3BCA1E0D6BCABD), UL64(0xA1B02BC1408591BC) },
+        { UL64(0xE0DEEE5931FBA239), UL64(0xF47424D398BD91D1),
+          UL64(0x0F8886F4071A3C1D), UL64(0x3F7D41E8A819233B),
+          UL64(0x708623C2CF6EB998), UL64(0x86BB49AF609A287F),
+          UL64(0x942BB24963C90762), UL64(0x0EF6EEA555A9654B) },
+        { UL64(0x5F6D2D7236F5DEFE), UL64(0xFA9922DC56F99176),
+          UL64(0x6C8C5ECEF78CE0C7), UL64(0x7B44589DBE09B55E),
+          UL64(0xE11B3BCA9EA83770), UL64(0xD7FA2C7F2AB71547),
+          UL64(0x2A3DD6FA2A1DDCC0), UL64(0x09ACB4305A7B7707) },
+        { UL64(0x4ADD4A2E649D4E57), UL64(0xCD53A2B01917526E),
+          UL64(0xC526233020B44AC4), UL64(0x4028746ABAA2C31D),
+          UL64(0x5131839064291D4C), UL64(0xBF48F151EE5AD909),
+          UL64(0xCCE57F597B185681), UL64(0x7C3AC1B04854D442) },
+        { UL64(0x65587DC3C093C171), UL64(0xAE7ACB2424F42B65),
+          UL64(0x5A338ADB955996CB), UL64(0xC8E656756051F91B),
+          UL64(0x66711FBA28B8D0B1), UL64(0x15D74137B6C10A90),
+          UL64(0x70CDD7EB3A232A80), UL64(0xC9E2F07F6191ED24) },
+        { UL64(0xA80D1DB6F79588C0), UL64(0xFA52FC69B55768CC),
+          UL64(0x0B4DF1AE7F54438A), UL64(0x0CADD1A7F9B46A4F),
+          UL64(0xB40EA6B31803DD6F), UL64(0x488E4FA555EAAE35),
+          UL64(0x9F047D55382E4E16), UL64(0xC9B5B7E02F6E0C98) },
+        { UL64(0x6B1BD2D395762649), UL64(0xA9604EE7C7AEA3F6),
+          UL64(0x3646FF276DC6F896), UL64(0x9BF0E7F52860BAD1),
+          UL64(0x2D92C8217CB44B92), UL64(0xA2F5CE63AEA9C182),
+          UL64(0xD0A2AFB19154A5FD), UL64(0x482E474C95801DA6) },
+        { UL64(0xC19972D0B611C24B), UL64(0x1D468E6560A8F351),
+          UL64(0xEB7580697BCF6421), UL64(0xEC9DD0EE88FBC491),
+          UL64(0x5B59D2BF956C2E32), UL64(0x73DC6864DCDDF94E),
+          UL64(0xFD5E2321BCEE7665), UL64(0xA7B4F8EF5E9A06C4) },
+        { UL64(0xFBA918DD7280F855), UL64(0xBBAAC2608BAEC688),
+          UL64(0xA3B3F00F33400F42), UL64(0x3D2DBA2966F2E6E4),
+          UL64(0xB6F71A9498509375), UL64(0x8F33031FCEA423CC),
+          UL64(0x009B8DD04807E6FB), UL64(0x5163CFE55CDB954C) },
+        { UL64(0x03CC8F17CF41C6E8), UL64(0xF1F03C2A037B925C),
+          UL64(0xC39C19CC66D2427C), UL64(0x823D24BA7B6C18E4),
+          UL64(0x32EF9013901F0B4F), UL64(0x684360F1F8941C2E),
+          UL64(0x0EBAFF522C28092E), UL64(0x7891E4E3256C932F) },
+        { UL64(0x51264319AC445E3D), UL64(0x553432E78EA74381),
+          UL64(0xE6EEAA6967E9C50A), UL64(0x27CED28462E628C7),
+          UL64(0x3F96D3757A4AFA57), UL64(0xDE0A14C3E484C150),
+          UL64(0x364A24EB38BD9923), UL64(0x1DF18DA0E5177422) },
+        { UL64(0x174E8F82D8D38A9B), UL64(0x2E97C600E7DE1391),
+          UL64(0xC5709850A1C175DD), UL64(0x969041A032AE5035),
+          UL64(0xCBFD533B76A2086B), UL64(0xD6BBA71BD7C2E8FE),
+          UL64(0xB2D58EE6099DFB67), UL64(0x3A8B342D064A85D9) },
+        { UL64(0x3BC07649522F9BE3), UL64(0x690C075BDF1F49A8),
+          UL64(0x80E1AEE83854EC42), UL64(0x2A7DBF4417689DC7),
+          UL64(0xC004FC0E3FAF4078), UL64(0xB2F02E9EDF11862C),
+          UL64(0xF10A5E0FA0A1B7B3), UL64(0x30ACA6238936EC80) },
+        { UL64(0xF83CBF0502F40D9A), UL64(0x4681C4682C318A4D),
+          UL64(0x985756180E9C2674), UL64(0xBE79D0461847092E),
+          UL64(0xAF1E480A78BD01E0), UL64(0x6DD359E472A51DB9),
+          UL64(0x62CE3821E3AFBAB6), UL64(0xC5CEE5B617733199) },
+        { UL64(0xE08B30D46FFD9FBB), UL64(0x6E5BC69936C610B7),
+          UL64(0xF343CFF29CE262CF), UL64(0xCA2E4E3568B914C1),
+          UL64(0x011D64C016DE36C5), UL64(0xE0B10FDD42E2B829),
+          UL64(0x789429816685AAF8), UL64(0xE7511708230EDE97) },
+        { UL64(0x671ED8FC3B922BF8), UL64(0xE4D8C0A04C29B133),
+          UL64(0x87EB12393B6E99C4), UL64(0xAFF3974C8793BEBA),
+          UL64(0x037494052C18DF9B), UL64(0xC5C3A29391007139),
+          UL64(0x6A77234FE37A0B95), UL64(0x02C29A21B661C96B) },
+        { UL64(0xC3AAF1D6141ECF61), UL64(0x9195509E3BB22F53),
+          UL64(0x2959740422D51357), UL64(0x1B083822537BED60),
+          UL64(0xCD7D6E35E07289F0), UL64(0x1F94C48C6DD86EFF),
+          UL64(0xC8BB1F82EB0F9CFA), UL64(0x9EE0B7E61B2EB97D) },
+        { UL64(0x5A52FE2E34D74E31), UL64(0xA352C3103BF79AB6),
+          UL64(0x97FF6C5AABFEEB8F), UL64(0xBFBE8FEFF5C97305),
+          UL64(0xD6081CE6A7904608), UL64(0x1F812F3AC4FCA249),
+          UL64(0x9B24BC9AB9E5E200), UL64(0x91022C6738012EE8) },
+        { UL64(0xE83D9C5D30A713A1), UL64(0x4876E3F084EF0F93),
+          UL64(0xC9777029C1FBF928), UL64(0xEF7A6BB3BCE7D2A4),
+          UL64(0xB8067228DFA2A659), UL64(0xD5CD3398D877A48F),
+          UL64(0xBEA4FD8F025D0F3F), UL64(0xD67D2E352EAE7C2B) },
+        { UL64(0x184DE7D7CC5F4394), UL64(0xB5551B5C4536E142),
+          UL64(0x2E89B212D34AA60A), UL64(0x14A96FEAF50051D5),
+          UL64(0x4E21EF740D12BB0B), UL64(0xC522F02060B9677E),
+          UL64(0x8B12E4672DF7731D), UL64(0x39F803827B326D31) },
+        { UL64(0xDFB8630C39024A94), UL64(0xAACB96A897319452),
+          UL64(0xD68A3961EDA3867C), UL64(0x0C58E2B077C4FFCA),
+          UL64(0x3D545D634DA919FA), UL64(0xEF79B69AF15E2289),
+          UL64(0x54BC3D3D808BAB10), UL64(0xC8AB300745F82C37) },
+        { UL64(0xC12738B67C4A658A), UL64(0xB3C4763940E72182),
+          UL64(0x3B77BE468798E44F), UL64(0xDC047DF217A7F85F),
+          UL64(0x2439D4C55E59D92D), UL64(0xCEDCA475E8E64D8D),
+          UL64(0xA724CD0D87CA9B16), UL64(0x35E4FD59A5540DFE) },
+    },
+    {
+        { UL64(0x9894344F3A29467A), UL64(0xDE81E949C51EBA6D),
+          UL64(0xDAEA066BA5E5C2F2), UL64(0x3FC8A61408C8C7B3),
+          UL64(0x7ADFF88F06D0DE9F), UL64(0xBBC11CF53B75CE0A),
+          UL64(0x9FBB7ACCFBBC87D5), UL64(0xA1458E267BADFDE2) },
+        { UL64(0x1CB43668E039C256), UL64(0x5F26FB8B7C17FD5D),
+          UL64(0xEEE426AF79AA062B), UL64(0x072002D0D78FBF04),
+          UL64(0x4C9CA237E84FB7E3), UL64(0xB401D8A10C82133D),
+          UL64(0xAAA525926D7E4181), UL64(0xE943083373DBB152) },
+        { UL64(0x2F5FAD1E6EE7C983), UL64(0xEB0F9D7CB41328F5),
+          UL64(0x9BA68B441D78D5F7), UL64(0xA06B3B9E35BC726F),
+          UL64(0xA2550255593E1FF1), UL64(0x552DD43DDFBEC115),
+          UL64(0x2C48A7ABBBA8F046), UL64(0xD4FC56A3AD0BF133) },
+        { UL64(0xF92DDA31BE24319A), UL64(0x03F7D28BE095A8E7),
+          UL64(0xA52FE84098782185), UL64(0x276DDAFE29C24DBC),
+          UL64(0x80CD54961D7A64EB), UL64(0xE43608897F1DBE42),
+          UL64(0x2F81A8778438D2D5), UL64(0x7E4D52A885169036) },
+        { UL64(0x62F21CEFBA04B5D1), UL64(0x9A442707224C7352),
+          UL64(0xBF07966C33C6171F), UL64(0xDB7BA8911E0816B0),
+          UL64(0x306FEA59033745A9), UL64(0x2AACF7E0C0A78F67),
+          UL64(0xB5AA3883AD251BF9), UL64(0x345AEDE926BD7086) },
+        { UL64(0x19E3D5B11D59715D), UL64(0xC7EAA762D788983E),
+          UL64(0xE5A730B0ABF1F248), UL64(0xFBAB8084FAE3FD83),
+          UL64(0x65E50D2153765B2F), UL64(0xBDD4E083FA127F3D),
+          UL64(0x9CF3C074397B1B10), UL64(0x59F8090CB1B59FD3) },
+        { UL64(0xDC1DE17D98119F10), UL64(0x74353C5D488C36A6),
+          UL64(0x14AAF33A3D8E23DF), UL64(0x31E075C078BAF593),
+          UL64(0x0F7CA03A46D1CA3C), UL64(0x99C5E3AC47B660C7),
+          UL64(0x70D0241388FE2E59), UL64(0x2E9A6BE12A7EC005) },
+        { UL64(0x7B15FD9D615FAA8F), UL64(0x8FA1EB40968554ED),
+          UL64(0x7BB4447E7AA44882), UL64(0x2BB2D0D1029FFF32),
+          UL64(0x075E2A646CAA6D2F), UL64(0x8EB879DE22E7351B),
+          UL64(0xBCD5624E9A506C62), UL64(0x218EAEF0A87E24DC) },
+        { UL64(0xAC449695241FBD6F), UL64(0x67C9B170081C1223),
+          UL64(0x16868F21B56AAC6F), UL64(0x34BD8FA3F8BCB721),
+          UL64(0x06B6BD33B6691C76), UL64(0x6C924766381A7973),
+          UL64(0x6A12444CA54078DB), UL64(0xD02E91A96D1051CC) },
+        { UL64(0x37E5684744DDFA35), UL64(0x9CCFC5C5DAB3F747),
+          UL64(0x9AC1DF3F1EE96CF4), UL64(0x0C0571A13B480B8F),
+          UL64(0x2FBEB3D54B3A7B3C), UL64(0x35C036695DCDBB99),
+          UL64(0x52A0F5DCB2415B3A), UL64(0xD57759B44413ED9A) },
+        { UL64(0x077379C00B33D3F8), UL64(0x421883C67064E409),
+          UL64(0x2D0873D76C29C8F6), UL64(0xBFA433A3D274C0C8),
+          UL64(0x56DC778F23A5891E), UL64(0xD663BF6535E2DE04),
+          UL64(0x488FDB485DB517CE), UL64(0x00BBA55E19B226C2) },
+        { UL64(0x1FE647D83D30A2C5), UL64(0x0857F77EF78A81DC),
+          UL64(0x11D5A334131A4A9B), UL64(0xC0A94AF929D393F5),
+          UL64(0xBC3A5C0BDAA6EC1A), UL64(0xBA9FE49388D2D7ED),
+          UL64(0xBB4335B4BB614797), UL64(0x991C4D6872F83533) },
+        { UL64(0xEDBBEEE78A058FB6), UL64(0xB9D19DDCFB09121A),
+          UL64(0xA41BB45BD34DDDCE), UL64(0x2DBC80B900964BC4),
+          UL64(0x4ED9137D1D6CB654), UL64(0x1B9016DB483D01C5),
+          UL64(0x5FC501BC6528E22E), UL64(0xB2D2F8816CAD646B) },
+        { UL64(0x53258C28D2F01CB3), UL64(0x93D6EAA3D75DB0B1),
+          UL64(0x419A2B0DE87D0DB4), UL64(0xA1E48F03D8FE8493),
+          UL64(0xF747FAF6C508B23A), UL64(0xF137571A35D53549),
+          UL64(0x9F5E58E2FCF9B838), UL64(0xC7186CEEA7FD3CF5) },
+        { UL64(0x5E76FB2F286BAD39), UL64(0xBAD9EFE39DCAD1E2),
+          UL64(0x60E75190EDC7E904), UL64(0x6A6F063E0FECB5A5),
+          UL64(0x5150ED85AED8ACC3), UL64(0xB56CCFBC6D20AF6C),
+          UL64(0x7E0D1E982C69DBFA), UL64(0xABF5628A7C7E10A9) },
+        { UL64(0x77B868CEE978A1D3), UL64(0xE3A68B337AB92D04),
+          UL64(0x5102979487A5B862), UL64(0x5F0606C33A61D41D),
+          UL64(0x2814BE276F9326F1), UL64(0x2F521C14C6FE3C2E),
+          UL64(0x17464D7DACDF7351), UL64(0x10F5F9D3777F7E44) },
+        { UL64(0x1D2164197408A2AB), UL64(0xAE55D5185928916A),
+          UL64(0xDF75684AF3165EEA), UL64(0x538364D5D84EEF59),
+          UL64(0xB54E201570563B1A), UL64(0x74D9BBA76B4CEFFF),
+          UL64(0xFCBECBD87A0682DC), UL64(0x0E00A402F193116C) },
+        { UL64(0xCE8E616B269FB37D), UL64(0xAAF738047DE62DE5),
+          UL64(0xABA111754FDD4153), UL64(0x515759BA3770B49B),
+          UL64(0x8B09EBF8AA423A61), UL64(0x592245A1CD41FB92),
+          UL64(0x1CBA8EC19B4C8936), UL64(0xA87E91E3AF36710E) },
+        { UL64(0x65F68985849FC416), UL64(0x3C03A934CDBAA73C),
+          UL64(0x112F311BBFCB6647), UL64(0x69C11340DE4E93CD),
+          UL64(0xBD2458B966DB537B), UL64(0xF974B018885B07E7),
+          UL64(0x5DB145A570C8D332), UL64(0x30FDD0D1549B837B) },
+        { UL64(0x1FD84CE43D34A2E3), UL64(0xEE3759CEB43B5D61),
+          UL64(0x895BC78C619186C7), UL64(0xF19C3809CBB9725A),
+          UL64(0xC0BE21AADE744B1F), UL64(0xA7D222B060F8056B),
+          UL64(0x74BE6157B23EFE11), UL64(0x6FAB2B4F0CD68253) },
+        { UL64(0x3E5C1D73512358B4), UL64(0xCB5742B230BB99C9),
+          UL64(0x4A2E2FA83C2D031A), UL64(0x371BC92BFB9878B8),
+          UL64(0x1EA71F9C8275656C), UL64(0x14F794A21C0300A1),
+          UL64(0x08EAE79826EA54E5), UL64(0xCF5854E5171A54C6) },
+        { UL64(0xAD33EA5F4BF1D725), UL64(0x9C1D8EE24F6C950F),
+          UL64(0x544EE78AA377AF06), UL64(0x54F489BB94A113E1),
+          UL64(0x8F11D634992FB7E8), UL64(0x0169A7AAA2A44347),
+          UL64(0x1D49D4AF95020E00), UL64(0x95945722E08E120B) },
+        { UL64(0x280AFBB3B7BA3886), UL64(0x08803A3E368934A8),
+          UL64(0xF980DF6531F671AB), UL64(0x90894AEA1A724791),
+          UL64(0x545B66A98D1DA350), UL64(0x9DF4FBBF411353A5),
+          UL64(0x1552743CA398088A), UL64(0xD1C14CDEB82D5717) },
+        { UL64(0xB6E33878A4D32282), UL64(0xE36E029D48020AE7),
+          UL64(0xE05847FB37A9B750), UL64(0xF876812CB29E3819),
+          UL64(0x84AD138ED23A17F0), UL64(0x6D7B4480F0B3950E),
+          UL64(0xDFA8AEF42FD67AE0), UL64(0x8D3EEA2452333AF6) },
+        { UL64(0xB28D3AFDF5C5EC83), UL64(0x8D6AF6C191049FAD),
+          UL64(0x417964FFFFBE1E1A), UL64(0xBACE9EEAF51C790A),
+          UL64(0x42022236B20F2979), UL64(0x6B05B729765D3801),
+          UL64(0xBE0EE2006D6DE3E7), UL64(0xB96ED5011E01AF3A) },
+        { UL64(0x0D052075B15D5ACC), UL64(0xC6D9C79FBD815BC4),
+          UL64(0x8DCAFD88DFA36CF2), UL64(0x908CCBE238AA9070),
+          UL64(0x638722C4BA35AFCE), UL64(0x5A3DA8B0FD6ABF0B),
+          UL64(0x2DCE252CC9C335C1), UL64(0x84E7F0DE65AA799B) },
+        { UL64(0xEF8762ECE0EDBC62), UL64(0x33449828852773FB),
+          UL64(0x2C9B90F3C3AE3885), UL64(0xD8191812731E56B2),
+          UL64(0x205D7E95736831F0), UL64(0xC3818D48D641C15D),
+          UL64(0xC6B63839F43E157C), UL64(0x5516044736AD51F0) },
+        { UL64(0x2101A522B99A72CB), UL64(0x06DE6E6787618016),
+          UL64(0x5FF8C7CDE6F3653E), UL64(0x0A821AB5C7A6754A),
+          UL64(0x7E3FA52B7CB0B5A2), UL64(0xA7FB121CC9048790),
+          UL64(0x1A72502006CE053A), UL64(0xB490A31F04E929B0) },
+        { UL64(0x70BB7719BC407E6E), UL64(0x231328EFD84CEB41),
+          UL64(0x8BCA6A1FC104BB20), UL64(0xD6F4E425280B9071),
+          UL64(0xB41B95A292896A82), UL64(0x735CF435FA34DF67),
+          UL64(0xBC331A08D9D6D769), UL64(0x579786052682747E) },
+        { UL64(0xE17BE47D62DD61AD), UL64(0x781A961C6BE01371),
+          UL64(0x1063BFD3DAE3CBBA), UL64(0x356474067F73C9BA),
+          UL64(0xF50E957B2736A129), UL64(0xA6313702ED13F256),
+          UL64(0x9436EE653A19FCC5), UL64(0xCF2BDB29E7A4C8B6) },
+        { UL64(0x698AF74287F3B8BE), UL64(0x4F5D9D1AD1A1591D),
+          UL64(0x540FAC3C0FE4ACE1), UL64(0x83A69B24C6894A7D),
+          UL64(0x935C07EEAD6FEB46), UL64(0xE02CBD887FF325FA),
+          UL64(0xE8F08C9DBCC6380B), UL64(0x9C7FF40FA6E045CE) },
+        { UL64(0xB06B1244C5F95CD8), UL64(0xDA8C8AF0F4AB95F4),
+          UL64(0x1BAE59C2B9E5836D), UL64(0x07D51E7E3ACFFFFC),
+          UL64(0x01E15E6AC2CCBCDA), UL64(0x3BC1923F8528C3E0),
+          UL64(0x43324577A49FEAD4), UL64(0x61A1B8842AA7A711) },
+    },
+    {
+        { UL64(0x4FE7EE31B0E63D34), UL64(0xF4600572A9E54FAB),
+          UL64(0xC0493334D5E7B5A4), UL64(0x8589FB9206D54831),
+          UL64(0xAA70F5CC6583553A), UL64(0x0879094AE25649E5),
+          UL64(0xCC90450710044652), UL64(0xEBB0696D02541C4F) },
+        { UL64(0x758C1A3EA2DEE7A6), UL64(0xDCDE2F3C734B2284),
+          UL64(0xABA445D24EABA6AD), UL64(0x35AAF66876CEE0A7),
+          UL64(0x7E0B04A9E5AA049A), UL64(0xE74083AD91103E84),
+          UL64(0xBEB183CE40AFECC3), UL64(0x6B89DE9FEA043F7A) },
+        { UL64(0xB99F0E0399375235), UL64(0x7614C847B9917970),
+          UL64(0xFEC93CE9524EC067), UL64(0xE40E7BF89B122520),
+          UL64(0xB5670631EE4C4774), UL64(0x6F03847A3B04914C),
+          UL64(0xC96E9429DC9DD226), UL64(0x43489B6C8C57C1F8) },
+        { UL64(0x0E299D23FE67BA66), UL64(0x9145076093CF2F34),
+          UL64(0xF45B5EA997FCF913), UL64(0x5BE008438BD7DDDA),
+          UL64(0x358C3E05D53FF04D), UL64(0xBF7CCDC35DE91EF7),
+          UL64(0xAD684DBFB69EC1A0), UL64(0x367E7CF2801FD997) },
+        { UL64(0x46FFD227CC2338FB), UL64(0x89FF6FA990E26153),
+          UL64(0xBE570779331A0076), UL64(0x43D241C506E1F3AF),
+          UL64(0xFDCDB97DDE9B62A3), UL64(0x6A06E984A0AE30EA),
+          UL64(0xC9BF16804FBDDF7D), UL64(0x170471A2D36163C4) },
+        { UL64(0xFF5BA8AE3113655E), UL64(0xFA2C6E2B57B83180),
+          UL64(0x1C48271977E0EABE), UL64(0xF9F3C555337FEA97),
+          UL64(0x340F7022A42581CB), UL64(0xE1DE0BC218F710E3),
+          UL64(0xEE640ADEF62E5AA8), UL64(0x16B2389149428940) },
+        { UL64(0x361619E455950CC3), UL64(0xC71D665C56B66BB8),
+          UL64(0xEA034B34AFAC6D84), UL64(0xA987F832E5E4C7E3),
+          UL64(0xA07427727A79A6A7), UL64(0x56E5D017E26D6C23),
+          UL64(0x7E50B97638167E10), UL64(0xAA6C81EFE88AA84E) },
+        { UL64(0x0CA1F3B7B0DC8595), UL64(0x27DE46089F1D9F2E),
+          UL64(0x1AF3BF39BADD82A7), UL64(0x79356A7965862448),
+          UL64(0xC0602345F5F9A052), UL64(0x1A8B0F89139A42F9),
+          UL64(0xB53EEE42844D40FC), UL64(0x93B0BFE54E5B6368) },
+        { UL64(0x473959D74D325BBF), UL64(0x2A61BEEC8D6114B9),
+          UL64(0x25672A94924BE2EE), UL64(0xA48595DBF2C23D0C),
+          UL64(0xE476848B6A221838), UL64(0xE743E69A35C1B673),
+          UL64(0x2AB42499D8468503), UL64(0x62AA0054E9E90BA7) },
+        { UL64(0x358D13F1BC482911), UL64(0x685D1971B7FA7F26),
+          UL64(0x3E67A51D2BE1AEE4), UL64(0xE041850998D114A9),
+          UL64(0x59639F604E052561), UL64(0x32075C49155D0818),
+          UL64(0x2AA2343B67B64B1C), UL64(0x1B445E2967F53E6A) },
+        { UL64(0xBDFB271773A904E0), UL64(0x7CE1E40B28888D73),
+          UL64(0x2E7E35F6EAA97D1B), UL64(0xD061772AA9AFA097),
+          UL64(0x434AC7C47A1F7C59), UL64(0x6E21124AE79B7B9A),
+          UL64(0x055ACFF3BB22ECC7), UL64(0x8BFD7AC984C858D3) },
+        { UL64(0x5434DD02C024789C), UL64(0x90DCA9EA41B57BFC),
+          UL64(0x8AA898E2243398DF), UL64(0xF607C834894A94BB),
+          UL64(0xBB07BE97C2C99B76), UL64(0x6576BA6718C29302),
+          UL64(0x3D79EFCCE703A88C), UL64(0xF259CED7B6A0D106) },
+        { UL64(0x2FD57DF59F1F68AD), UL64(0x5DDCC6DBB06470C8),
+          UL64(0x801B6451A9B47307), UL64(0x6B51C8E376551BF4),
+          UL64(0xEF0BD1F7D44E1DA9), UL64(0x714BCB1D4D4E600C),
+          UL64(0xC57BB9E40C6540C7), UL64(0x71BD1EC2327CC644) },
+        { UL64(0x00CD33B5CFD84F0A), UL64(0xCFA568F74E6B0DDD),
+          UL64(0x1C694EDB2D0F48F4), UL64(0x2747C7CCFEFF7DD8),
+          UL64(0xCEDAECADAC8C24B2), UL64(0xDB29DE3F0742A5E5),
+          UL64(0xE35D8FBB3090296D), UL64(0x788CABF7B11FB54A) },
+        { UL64(0x9A52CF7E7F4DD81F), UL64(0xA0132BE15E69C05E),
+          UL64(0x90DAB7472A0F4D72), UL64(0xC142F911312D6706),
+          UL64(0xE8D3631F8261998B), UL64(0xF0F42FAE615C1C94),
+          UL64(0x2F4E948CAEC3FA5D), UL64(0x242AE7A8A374101E) },
+        { UL64(0x0F893A5DC8DE610B), UL64(0xE8C515FB67E223CE),
+          UL64(0x7774BFA64EAD6DC5), UL64(0x89D20F95925C728F),
+          UL64(0x7A1E0966098583CE), UL64(0xA2EEDB9493F2A7D7),
+          UL64(0x1B2820974C304D4A), UL64(0x0842E3DAC077282D) },
+        { UL64(0x1FA878CAD088BE52), UL64(0x89C2CB07A9E1E656),
+          UL64(0x385BC5C3219D62DB), UL64(0xD82B676B5FDA2752),
+          UL64(0x2449DC9EE304EAFC), UL64(0x1E9E7991632F4EA2),
+          UL64(0x3036E061CDD5E0B9), UL64(0x75A6F6FF830825BC) },
+        { UL64(0x2E5B260481F65E9B), UL64(0x480156C04901F837),
+          UL64(0x557F86ABB857B733), UL64(0x88E3ED0E735B4411),
+          UL64(0xC337680D2A33732E), UL64(0xA599BFCB31C9C11F),
+          UL64(0xB282F851A95201C4), UL64(0xD342DA8A854DDF95) },
+        { UL64(0xB10FCDDC449DEDB4), UL64(0x2C890042D1244ACF),
+          UL64(0x9B3072CAC7FC7017), UL64(0x1ACDA6859CE8063F),
+          UL64(0xD243313C7F51E2F5), UL64(0x52A3F1A4D73D9578),
+          UL64(0xDA785B7A64F0CE6E), UL64(0x2E766315442A4C2D) },
+        { UL64(0xE4D972A33B9E2D7B), UL64(0x7CC60B27C48218FF),
+          UL64(0x8FC7083884149D91), UL64(0x5C04346F2F461ECC),
+          UL64(0xEBE9FDF2614650A9), UL64(0x5E35B537C1F666AC),
+          UL64(0x645613D188BABC83), UL64(0x88CACE3AC5E1C93E) },
+        { UL64(0x94F9B004151F111A), UL64(0xC7A5035B07DBC5FA),
+          UL64(0x53958EA7609E49D7), UL64(0x0526B4D79013F4C0),
+          UL64(0x66DE5EBB593E2FBD), UL64(0x6E7CF8B44C2E0C37),
+          UL64(0x6F72FC8B8C983E78), UL64(0x6FAB9B632348F9D7) },
+        { UL64(0x58D02E81EB70AC59), UL64(0xF522769B4417D8F7),
+          UL64(0x9F3063D5077274FF), UL64(0xF5AC6F4F340FE8AC),
+          UL64(0xCE72D9D1B50914BA), UL64(0xB3835984B7BC255C),
+          UL64(0x145D3FA77CA5038F), UL64(0x7ACDA3C6AD8FAB13) },
+        { UL64(0xC748A3526A3D8468), UL64(0x3FAB479927E38032),
+          UL64(0x91AD3629FA430CE7), UL64(0xC5AF0B2C71614C44),
+          UL64(0xCEDE3FA50C211611), UL64(0x6E6889BA02338083),
+          UL64(0xEE0A195977F0FE32), UL64(0x01EA905D0F4BBC5A) },
+        { UL64(0x209CA3753DE92E23), UL64(0xCCB03CC85FBBB6E3),
+          UL64(0xCCB90F03D7B1487E), UL64(0xFA9C2A38C710941F),
+          UL64(0x756C38236724CEED), UL64(0x3A902258192D0323),
+          UL64(0xB150E519EA5E038E), UL64(0xDCBA2865C7427591) },
+        { UL64(0x12CFB25E8193DB48), UL64(0xDDB4AE633BEA708C),
+          UL64(0xDAAE102EF181F821), UL64(0x9D9D923024A089D9),
+          UL64(0x71C4122DA0876AEA), UL64(0x1A63EA3BBBE19C09),
+          UL64(0x3B898076016F8D0C), UL64(0xA5CCCC5DAEA6B713) },
+        { UL64(0x510E8EE306F6E97D), UL64(0x684A8FC5B00EAA8C),
+          UL64(0x15313579B93FBF33), UL64(0xE67F5FA6F66B1723),
+          UL64(0x815881F6CE86748C), UL64(0xC1CED318EAD58B10),
+          UL64(0x8662775BF2F33393), UL64(0x7AC0C9047D836FF2) },
+        { UL64(0xC3F22BAF4A8E2F61), UL64(0x77D29EDE176DA6A6),
+          UL64(0x40A55F211607DA63), UL64(0x858B38561452E391),
+          UL64(0x0DD3C267FE1B3C56), UL64(0x66C04BDD7D55227A),
+          UL64(0xFBD2FE55E6404E09), UL64(0x5981CF49EA9CFCBC) },
+        { UL64(0xE549237F78890732), UL64(0xC443BEF953FCB4D9),
+          UL64(0x9884D8A6EB3480D6), UL64(0x8A35B6A13048B186),
+          UL64(0xB4E4471665E9A90A), UL64(0x45BF380D653006C0),
+          UL64(0x8F3F820D4FE9AE3B), UL64(0x244A35A0979A3B71) },
+        { UL64(0xAE46A902AEA870AF), UL64(0xA9B9FCF57CBEDC99),
+          UL64(0x74F2CA3F79B7E793), UL64(0xADB8F2231DBEEB28),
+          UL64(0x6302060E6764DF85), UL64(0x363320D257EBD554),
+          UL64(0xD9FD573E798D22E1), UL64(0x285F85F5EBB67DED) },
+        { UL64(0x0AACD6138AEB55C9), UL64(0x79791DA4D86885F0),
+          UL64(0x165E826744B05F23), UL64(0x9EE5F5E8284548ED),
+          UL64(0x9FD548CC85B661B8), UL64(0x257037C089C58689),
+          UL64(0x9B47306FF9290CB2), UL64(0x56BA2EEB0677ECF4) },
+        { UL64(0xD86B329211CAA2B5), UL64(0x2A26258E39337BD1),
+          UL64(0x4DC5A9B579C8C291), UL64(0x16443D87741942E6),
+          UL64(0x6BC9A2F8F811400C), UL64(0x819C69359EEB4E0E),
+          UL64(0xE1BE7273CE0C214B), UL64(0x429AFB8184B61581) },
+        { UL64(0xA1010E9D74CD06FF), UL64(0x9C17C7DFACA3EEAC),
+          UL64(0x74C86CD38063AA2B), UL64(0x8595C4B3734614FF),
+          UL64(0xA3DE00CA990F62CC), UL64(0xD9BED213CA0C3BE5),
+          UL64(0x7886078ADF8CE9F5), UL64(0xDDB27CE35CD44444) },
+    },
+    {
+        { UL64(0x9C7C581D26EE8382), UL64(0xCF17DCC5359D638E),
+          UL64(0xEE8273ABB728AE3D), UL64(0x1D112926F821F047),
+          UL64(0x1149847750491A74), UL64(0x687FA761FDE0DFB9),
+          UL64(0x2C2580227EA435AB), UL64(0x6B8BDB9491CE7E3F) },
+        { UL64(0xB23A03A553FB2B56), UL64(0x6CE141E74E057F78),
+          UL64(0x796525C389E490D9), UL64(0x0BC95725A31A7E75),
+          UL64(0x1EC567911220FD06), UL64(0x716E3A3C408B0BD6),
+          UL64(0x31CD6BF7E8EBEBA9), UL64(0xA7326CA6BEE6B670) },
+        { UL64(0x6095355699F241D7), UL64(0xEE4ADBD7001A349D),
+          UL64(0x0B35BF6AAA89E491), UL64(0x7F0076F4136F7546),
+          UL64(0xD19A18BA9264DA3D), UL64(0x6EB2D2CD62A7A28B),
+          UL64(0xCDBA941F8761C971), UL64(0x1550518BA3BE4A5D) },
+        { UL64(0x20D3C982CF7D62D2), UL64(0x1F36E29D23BA8150),
+          UL64(0x48AE0BF092763F9E), UL64(0x7A527E6B1D3A7007),
+          UL64(0xB4A89097581A85E3), UL64(0x1F1A520FDC158BE5),
+          UL64(0xF98DB37D167D726E), UL64(0x8802786E1113E862) },
+        { UL64(0xC3C398966BCEFC18), UL64(0xB754B34318636E00),
+          UL64(0x6FB6A168F53B1991), UL64(0x87181B55B84C2FE5),
+          UL64(0x1686C9102721BC8C), UL64(0xC649066095030E2A),
+          UL64(0x18FDEB2F97DF55DA), UL64(0x10D52CFC7C27D231) },
+        { UL64(0x2A01E09C118731B9), UL64(0xB6C46182CD393CD8),
+          UL64(0x5ED7DD657508E328), UL64(0x6402CA1B681DA8FA),
+          UL64(0x603ABE86CE9F272D), UL64(0x9363435C29167C9C),
+          UL64(0x4814F7C1C45A2A42), UL64(0x146562229A22CACD) },
+        { UL64(0xB4526431323B470C), UL64(0x40CD4E1AD536E418),
+          UL64(0x430FDD3D01933BC0), UL64(0x3D3E6DDE07649023),
+          UL64(0x4B0564EF2E9523B1), UL64(0x8C0D31059079BC4F),
+          UL64(0x496C6967837D3D58), UL64(0x3A79F66089123B5F) },
+        { UL64(0xEFB2149E36F09AB0), UL64(0x03F163CA4A10BB5B),
+          UL64(0xD029704506E20998), UL64(0x56F0AF001B5A3BAB),
+          UL64(0x7AF4CFEC70880E0D), UL64(0x7332A66FBE3D913F),
+          UL64(0x32E6C84A7ECEB4BD), UL64(0xEDC4A79A9C228F55) },
+        { UL64(0x2999149EA32F699A), UL64(0x6D6C8E1172186170),
+          UL64(0xAD74494F45546E52), UL64(0x2B3CB53989EFE7FE),
+          UL64(0xB9A2E60EE42FB031), UL64(0xF858FD0D670E4823),
+          UL64(0xEBCAAB7E492C636D), UL64(0x40E072FCD32C4670) },
+        { UL64(0x457A6A66B2344E1D), UL64(0xDEC81F2A8F37DCFE),
+          UL64(0x61D5F83EAB40F9D5), UL64(0x5CA82776F1DF043C),
+          UL64(0x2174681EF846677C), UL64(0x7C241F4F516D1628),
+          UL64(0xF54994C31F01374F), UL64(0x253C8367DF0F210C) },
+        { UL64(0xC94DBEEB20E91820), UL64(0x19AAC20462B641E7),
+          UL64(0xC22834F08B49CF50), UL64(0x47E8C74B8E5D5A6D),
+          UL64(0x78160CDCF42ACB6A), UL64(0x7A5364753A3568B9),
+          UL64(0x4A28D5476CD1EB71), UL64(0x0360BC3F8C8FBC11) },
+        { UL64(0xF6E894D1F4C6B6EC), UL64(0x526B082718B3CD9B),
+          UL64(0x73F952A812117FBF), UL64(0x2BE864B011945BF5),
+          UL64(0x86F18EA542099B64), UL64(0x2770B28A07548CE2),
+          UL64(0x97390F28295C1C9C), UL64(0x672E6A43CB5206C3) },
+        { UL64(0x66502B738EBADAF8), UL64(0x27BAFE8EF9A04C07),
+          UL64(0x74DA432F1BF6AE04), UL64(0x271D8268278D403B),
+          UL64(0x018B91AC93471B57), UL64(0x01096869B276C51F),
+          UL64(0x5B79C1016DC57DD2), UL64(0xB623345E806C80A5) },
+        { UL64(0x89D24349E9D72088), UL64(0xD5317A033E9CF6E0),
+          UL64(0x5BC61A9D73C8F8EA), UL64(0x48F9C2C8F10F5A3D),
+          UL64(0x472414DF086B9507), UL64(0x79818CDFAE549B92),
+          UL64(0x3D24A77A62A415BF), UL64(0xB92DF59FD3B22976) },
+        { UL64(0x80450F8EE71FCF44), UL64(0x2763DDFDDB0A9986),
+          UL64(0x8C288C7A9668BCF2), UL64(0xD7D09B350392E2F6),
+          UL64(0x0A3D54826506DD7A), UL64(0x9B43DAC1CDCE9D4F),
+          UL64(0x8D154F61458B63B8), UL64(0x77BDA4D0129C973B) },
+        { UL64(0xC37C7DD0C55C4496), UL64(0xA6A9635725BBABD2),
+          UL64(0x5B7E63F2ADD7F363), UL64(0x9DCE37822E73F1DF),
+          UL64(0xE1E5A16AB2B91F71), UL64(0xE44898235BA0163C),
+          UL64(0xF2759C32F6E515AD), UL64(0xA5E2F1F88615EECF) },
+        { UL64(0x0B6C0D19EBA6ABCE), UL64(0x6CAAC445649EEEE4),
+          UL64(0x59B4F283B465E10E), UL64(0xD76704F2F729212D),
+          UL64(0x8D4E738370D1EE92), UL64(0xFBCAC28BEA6C1EB5),
+          UL64(0x2C84218B4EF28E05), UL64(0x2C52F7D07E6C6E0D) },
+        { UL64(0xD8134CF00FE09616), UL64(0x4A31E59AE48C8CC3),
+          UL64(0x5C0AE5665FB87B82), UL64(0xDC2EF15AB2BD26A7),
+          UL64(0x63EBAEF55B781765), UL64(0x4F6CC83C5339585E),
+          UL64(0xD08AE201ABFC78E4), UL64(0x98E7EE9A1FBE2A56) },
+        { UL64(0x0A4897DD0E1489A2), UL64(0xC09F8736E93D987F),
+          UL64(0x427A00B8EA79A437), UL64(0x3E2B39E4AF89E9FA),
+          UL64(0x451C2D2F7E8138F1), UL64(0x08CDE41137148BB0),
+          UL64(0x016968C70D50E541), UL64(0x2BDCEEE1DD471291) },
+        { UL64(0xCACCE2C847C64367), UL64(0x6A496B9F45AF4EC0),
+          UL64(0x2A0836F36034042C), UL64(0x14A1F3900B6C62EA),
+          UL64(0xE7FA93633EF1F540), UL64(0xD323B30A72A76D93),
+          UL64(0xFFEEC8B50FEAE451), UL64(0x4EAFC172BD04EF87) },
+        { UL64(0x3BDB1E1B6C484007), UL64(0xE110D5A1E6BE0202),
+          UL64(0x1C24E1AE15665AAE), UL64(0xFA0EF6897C9C9D27),
+          UL64(0x01A0662A9D22B607), UL64(0x18C364CE6722F147),
+          UL64(0x0446146D7521F74C), UL64(0x39777A4E9FA8ABB8) },
+        { UL64(0x36A7B30C8DEAE427), UL64(0xB4AC5F5AB62E583E),
+          UL64(0xACEF9FA2DF0A39A9), UL64(0xC929A6045D659039),
+          UL64(0xE14D9D6EFC262F7E), UL64(0x15E6D62D05538D9D),
+          UL64(0xEE42A77EC488F9E0), UL64(0xAE836365892C8A42) },
+        { UL64(0x90ABDD1B1AF533FD), UL64(0x7C3D2576750F0ACB),
+          UL64(0xFA0AC55AC76CC9C8), UL64(0xC3B4302E5275AA05),
+          UL64(0xE2CBB31DEF2DC19E), UL64(0x5F3DB7513806357B),
+          UL64(0x6474DF00F509F98E), UL64(0x9BA75F1E28EBBD89) },
+        { UL64(0x74519BE7ABDED551), UL64(0x03D358B8C8B74410),
+          UL64(0x4D00B10B0E10D9A9), UL64(0x6392B0B128DA52B7),
+          UL64(0x6744A2980B75C904), UL64(0xC305B0AEA8F7F96C),
+          UL64(0x042E421D182CF932), UL64(0xF6FC5D509E4636CA) },
+        { UL64(0x47CB1FE05FD676DF), UL64(0x69C642919BA8960B),
+          UL64(0x40D023060165DE6D), UL64(0x783BF44ED6B8B29A),
+          UL64(0xC84E19FB6ED098BD), UL64(0x601F09F7FFBE6123),
+          UL64(0x87AE89C5A0E24A3A), UL64(0x07864E9C5E05AC2A) },
+        { UL64(0x850F9EFD392C5E00), UL64(0xC29F667FE2511BDE),
+          UL64(0xF5CF406D8431298F), UL64(0xF90B10C879C0D05D),
+          UL64(0xFB3E9B1D0038F012), UL64(0x84C04E7A0A8C9799),
+          UL64(0xB76102D496C8E986), UL64(0xDEA63B13176DA675) },
+        { UL64(0x2FAFC2EFDDF55369), UL64(0x70BFF06F24AC63B9),
+          UL64(0x1E1A37426E926ADD), UL64(0x773537ADFDFA18CF),
+          UL64(0xD211EA635984B552), UL64(0xB17EED4D8C1AED24),
+          UL64(0x5DE9DE74140B8B67), UL64(0x742501C8768BFF57) },
+        { UL64(0xE4435A51B3E59B89), UL64(0x136139554133A1C9),
+          UL64(0x87F46973440BEE59), UL64(0x714710F800C401E4),
+          UL64(0xC0CF4BCED6C446C9), UL64(0xE0AA7FD66C4D5368),
+          UL64(0xDE5D811AFC68FC37), UL64(0x61FEBD72B7C2A057) },
+        { UL64(0x90FF2B91BE4725E8), UL64(0x710ABFF65E81001E),
+          UL64(0x15EB3476C5EF04F3), UL64(0xCCDAB51B3C0DA2B7),
+          UL64(0x883840A52CC0652B), UL64(0xD1FC7D9DF5E4A856),
+          UL64(0xEBBC3953070FFC88), UL64(0x340F947D91EFEDC1) },
+        { UL64(0x1EDDBEBB6DBD11CF), UL64(0x8297AA45C619E203),
+          UL64(0x6354826F962BD2A6), UL64(0xBA3F3F67FA12EDC7),
+          UL64(0x25220F1DFC7AD88D), UL64(0x5D059F818683C801),
+          UL64(0x0577F26E2D385764), UL64(0xA574C646A453E80D) },
+        { UL64(0x89D16C71B8F4E30C), UL64(0x9E2DABFBC63DFA29),
+          UL64(0x6033065EDFDE5CEB), UL64(0x072B1D1F0F3C45C6),
+          UL64(0x0CD0BC2AB8D429EC), UL64(0xE747438CC2471F89),
+          UL64(0x131CE856319D679E), UL64(0x7520A22887B24EBA) },
+        { UL64(0x795847C9D64CC78C), UL64(0x6C50621B9B6CB27B),
+          UL64(0x07099BF8DF8022AB), UL64(0x48F862EBC04EDA1D),
+          UL64(0xD12732EDE1603C16), UL64(0x19A80E0F5C9A9450),
+          UL64(0xE2257F54B429B4FC), UL64(0x66D3B2C645460515) },
+    },
+    {
+        { UL64(0x8DE2B7BC453CADD6), UL64(0x203900A7BC0BC1F8),
+          UL64(0xBCD86E47A6ABD3AF), UL64(0x911CAC128502EFFB),
+          UL64(0x2D550242EC965469), UL64(0x0E9F769229E0017E),
+          UL64(0x633F078F65979885), UL64(0xFB87D4494CF751EF) },
+        { UL64(0x6066E2A2D551EE10), UL64(0x87A8F1D8727E09A6),
+          UL64(0x00D08BAB2C01148D), UL64(0x6DA8E4F1424F33FE),
+          UL64(0x466D17F0CF9A4E71), UL64(0xFF5020103BF5CB19),
+          UL64(0xDCCF97D8D062ECC0), UL64(0x80C0D9AF81D80AC4) },
+        { UL64(0x1A0445FF1D7AADAB), UL64(0x65D38260D5F6A67C),
+          UL64(0x6E62FB0891CFB26F), UL64(0xEF1E0FA55C7D91D6),
+          UL64(0x47E7C7BA33DB72CD), UL64(0x017CBC09FA7C74B2),
+          UL64(0x3C931590F50A503C), UL64(0xCAC54F60616BAA42) },
+        { UL64(0x98857CEB1BF4581C), UL64(0xE635E186ACA7B166),
+          UL64(0x278DDD22659722AC), UL64(0xA0903C4C1DB68007),
+          UL64(0x366E458948F21402), UL64(0x31B49C14B96ABDA2),
+          UL64(0x329C4B09E0403190), UL64(0x97197CA3D29F43FE) },
+        { UL64(0x7173DD5D4B07E2B1), UL64(0xD144C4CB8D9EA221),
+          UL64(0xE8B04EA41105AB14), UL64(0x92DDA542FE80D8F1),
+          UL64(0xE9982FA8CF03DCE6), UL64(0x8B5EA9651A22CFFC),
+          UL64(0xF7F4EA7F3FAD88C4), UL64(0x62DB773E6A5BA95C) },
+        { UL64(0x18BD3FB4820357C7), UL64(0x992039AE6F1458AD),
+          UL64(0x9A1DF3C525B44AA1), UL64(0x2D780357ED3D5281),
+          UL64(0x58CF7E4DC77AD4D4), UL64(0xD49A7998F9DF4FC4),
+          UL64(0x4465A8B51D71205E), UL64(0xA0EE0EA6649254AA) },
+        { UL64(0x4BAAE6E89C92B235), UL64(0xA73BBD0E6B3993A1),
+          UL64(0xD06D60EC693DD031), UL64(0x03CAB91B7156881C),
+          UL64(0xD615862F1DB3574B), UL64(0x485B018564BB061A),
+          UL64(0x27434988A0181E06), UL64(0x2CD61AD4C1C0C757) },
+        { UL64(0x03E2DE1CF3480D4A), UL64(0xF0D8EDC7BC8ACF1A),
+          UL64(0xF23E330368295A9C), UL64(0xFADD5F68C546A97D),
+          UL64(0x895597AD96F8ACB1), UL64(0xBDDD49D5671BDAE2),
+          UL64(0x16FCD52821DD43F4), UL64(0xA5A454126619141A) },
+        { UL64(0xC85C34D3030D86A0), UL64(0xF14B2E80213CE95E),
+          UL64(0xCE3EED9BF07E6D7F), UL64(0x476C3E21A3A3EC79),
+          UL64(0xB4EC11F2CADEA5D3), UL64(0xD1AD5F12CCA936AA),
+          UL64(0x1724609E34E61C7D), UL64(0xCC520DF32FD67BA2) },
+        { UL64(0x6BFBE2A8A9A17F2A), UL64(0x1CAC2F6003D95017),
+          UL64(0x38C062578EA2B48C), UL64(0x21CA4D5CCC3CC38A),
+          UL64(0xFF067A5467452091), UL64(0x63BFDF5D139D462C),
+          UL64(0x221376A11450006F), UL64(0xC81AFE5E332A9AEC) },
+        { UL64(0x11A09A99BAFEA141), UL64(0x7FE0414B19D41640),
+          UL64(0xD66B072AF3B609D1), UL64(0x27F7DE34BC5554D2),
+          UL64(0xD66529AFBC517B45), UL64(0x8BE4352112D18D9F),
+          UL64(0x942192E14E0DEFD7), UL64(0xB465871F90C0AF1E) },
+        { UL64(0xFA32C79F439F29CF), UL64(0x7BF321C04DD82A3B),
+          UL64(0xFF127F54EAA2C1B1), UL64(0xA8365F2DF35E9618),
+          UL64(0x852D29024D0EF8DD), UL64(0x395CE2C159228C4A),
+          UL64(0xB69F44E8215AFED3), UL64(0x16C1F898B27458E3) },
+        { UL64(0x170F87E0F33F25BC), UL64(0x24DCB667C339C098),
+          UL64(0xBF1702A4AB073EAE), UL64(0xADA6919C238CFB44),
+          UL64(0x53008511DDEE6375), UL64(0xDB92FA85B8DB60AD),
+          UL64(0x50B6A366A421210E), UL64(0xDC7BF8EB4C37558F) },
+        { UL64(0xE47BA1082E4F257E), UL64(0xCF0EE2DF35689D7C),
+          UL64(0x8B8FC38E321BA0D0), UL64(0x9470C64C0F745E8B),
+          UL64(0xA73887F5D65FA22F), UL64(0xA581F89BC2A7EFBE),
+          UL64(0x835A0BA6EEE4C98A), UL64(0x86E183E9A3291A71) },
+        { UL64(0xFB5487B089E4043B), UL64(0x4DE49DEF09799BD2),
+          UL64(0x9DA870C0B3E760BE), UL64(0x5E4E1DD389EE1539),
+          UL64(0x1B3849FA915705DB), UL64(0x7CE5E1945EAC0E81),
+          UL64(0x7C1772A0B00D3F5C), UL64(0x547926766C00B5A1) },
+        { UL64(0x8CE9B6BFC360E25A), UL64(0xE6425195075A1A78),
+          UL64(0x9DC756A8481732F4), UL64(0x83C0440F5432B57A),
+          UL64(0xC670B3F1D720281F), UL64(0x2205910ED135E051),
+          UL64(0xDED14B0EDB052BE7), UL64(0x697B3D27C568EA39) },
+        { UL64(0x2E3A6CF11AF6714B), UL64(0x770F8EA63C13B96F),
+          UL64(0x98C242FB4C8CFF95), UL64(0x67EC9A0C95A0BE91),
+          UL64(0xEEF0335AEB8EE7CF), UL64(0x63F34CE73371C424),
+          UL64(0x980B399531EDE505), UL64(0x7CE83AFE9B3F3619) },
+        { UL64(0xB3F1BD2E795E4A1C), UL64(0x85D3187EA1CDCA89),
+          UL64(0x15E44E3C3541683D), UL64(0x2A8C239C80ED4067),
+          UL64(0xBDE6025ABFC508ED), UL64(0xB1631E313BF2C5ED),
+          UL64(0xB2CB3B3BE7D9A112), UL64(0x0554C14F7C7838CC) },
+        { UL64(0x1BE6B727AA88E0BF), UL64(0xD764C2BA64E83507),
+          UL64(0x4ABCF397BAD7EB86), UL64(0xB2FD1CBF7920B74F),
+          UL64(0x65E8915BF13D032B), UL64(0x9D264ABB19FBD622),
+          UL64(0x2F62AF792F48A2B4), UL64(0x22A9B05F8619BAEC) },
+        { UL64(0xDEF29005DC453233), UL64(0xC208C47A2FAC4BCF),
+          UL64(0x6057A3FEAC3D55AC), UL64(0x1723725D902C1207),
+          UL64(0x9C31C62733EB0FEC), UL64(0x4913CCDBBB3C63BB),
+          UL64(0x113E542B07305838), UL64(0x9D48E72A310C2D97) },
+        { UL64(0xC1D52754B8316B58), UL64(0x9435A342811FAB60),
+          UL64(0xE126C3766102C935), UL64(0x7A4F15953E25292E),
+          UL64(0x1BC3E7C3032CAD59), UL64(0x4B2D7A81FE2A1CB6),
+          UL64(0xA80BF4E2E08BA6CB), UL64(0xB7FCC9B28CF90268) },
+        { UL64(0xA2E2D1A751288296), UL64(0xBACA527BF66DDBB0),
+          UL64(0x409B418F80313CD4), UL64(0x2B4B1AE8873C6A8B),
+          UL64(0xB8E95EC72A93295F), UL64(0x0EF650902E5A795F),
+          UL64(0x165AC8882F876AFA), UL64(0x90CA87D925C1E203) },
+        { UL64(0xBC128DA793CE7936), UL64(0x3CC69AD639BE9DF9),
+          UL64(0x6965991FECB6D37C), UL64(0x64E001BFB8B5FFA3),
+          UL64(0x5D610ABF9334010D), UL64(0x718FEEB0DFDA3F0C),
+          UL64(0x5B2B1EA8030540D7), UL64(0x59F22F73F4B4D337) },
+        { UL64(0x54424EC4D9BBEB3D), UL64(0x34CEAFE3D7B2921C),
+          UL64(0x5E68022E296D37C5), UL64(0xA28E0A2B359F16B0),
+          UL64(0xFDD82DD9BC3F9D73), UL64(0x6939A8F9BAF3E1FF),
+          UL64(0x55CFF45C31736DC4), UL64(0x910F56427892E8E7) },
+        { UL64(0xDF35BF05AAD0042C), UL64(0x2925EC7028DA6ACC),
+          UL64(0x822AA804E1AA3F5C), UL64(0xB5EDEC7D3D348E63),
+          UL64(0x03362830B4F6B2CF), UL64(0x08BFCB0D096BBA2A),
+          UL64(0x8AFDE4649FEC3F04), UL64(0xFB402E4F1C434E17) },
+        { UL64(0xB6C46C9D8ACEC326), UL64(0xACF5583D296CB8C0),
+          UL64(0x2552CAC6CF077208), UL64(0x5261EF830DA03DD6),
+          UL64(0xF6A7EE305D0046B4), UL64(0x24865C96CB0A3E85),
+          UL64(0x715991448BDF7A89), UL64(0x221D5CDBF8E42383) },
+        { UL64(0x951DAAF43547DC09), UL64(0xB982D50BD4AEACD4),
+          UL64(0xDCC9942B459F1156), UL64(0x8067B1E2FA45B272),
+          UL64(0xE2FBD00CD6A3FBB7), UL64(0x46FC24DDCA742D37),
+          UL64(0x664544767B26FBDD), UL64(0x3FA6A3612FD8F67C) },
+        { UL64(0xDE09B349DFE39260), UL64(0x984612F773549093),
+          UL64(0x7CEDE28167853B02), UL64(0x7D809BB429D17703),
+          UL64(0x450B6BFB2756C4F0), UL64(0xC59FF9BA93F02B80),
+          UL64(0x3E69545720AD9561), UL64(0x0C7CF0BE3331E2C7) },
+        { UL64(0x42727C9BCA9C4803), UL64(0x7C14034629DCDA5E),
+          UL64(0x00ECAB39BA21F617), UL64(0xB52BB196F0BAEFC1),
+          UL64(0x56D503DE73AC1C74), UL64(0x082DCE0F539C9D2C),
+          UL64(0xF7770A8AFA3C9587), UL64(0x96895A7A595C7E7D) },
+        { UL64(0x29DB69D26EFAFB47), UL64(0x04B9E9F2EE5E7429),
+          UL64(0x91F21D3888E90203), UL64(0xCF3F8E797ADFA615),
+          UL64(0x89F9121C61EBE737), UL64(0x8759690606BA03BD),
+          UL64(0x1AC27A729778FEB7), UL64(0xE018723C34726018) },
+        { UL64(0x7C42CF86FC70937E), UL64(0x5BF83375A1118F05),
+          UL64(0x11C0541339E9BF98), UL64(0x4AA2F304ACFA08F9),
+          UL64(0xD6614D1ADA8B6FB3), UL64(0x92733B775B05AD0B),
+          UL64(0xCF8ED5F13015DD66), UL64(0x1BADEF18D8150A32) },
+        { UL64(0x2E599B9AFB3FF9ED), UL64(0x28C2E0AB17F6515C),
+          UL64(0x1CBEE4FD474DA449), UL64(0x071279A44F364452),
+          UL64(0x97ABFF6601FBE855), UL64(0x3EE394E85FDA51C4),
+          UL64(0x190385F667597C0B), UL64(0x6E9FCCC6A27EE34B) },
+    },
+    {
+        { UL64(0x3BC77ADEDDA492F8), UL64(0xC11A3AEA78297205),
+          UL64(0x5E89A3E734931B4C), UL64(0x17512E2E9F5694BB),
+          UL64(0x5DC349F3177BF8B6), UL64(0x232EA4BA08C7FF3E),
+          UL64(0x9C4F9D16F511145D), UL64(0xCCF109A333B379C3) },
+        { UL64(0x60E2857080EB24A9), UL64(0x7BEDFB4D488E0CFD),
+          UL64(0x721EBBD7C259CDB8), UL64(0x0B0DA855BC6390A9),
+          UL64(0x2B4D04DBDE314C70), UL64(0xCDBF1FBC6C32E846),
+          UL64(0x33833EABB162FC9E), UL64(0x9939B48BB0DD3AB7) },
+        { UL64(0xC42B8AB197C3DFB9), UL64(0x55A549B0CF168154),
+          UL64(0xAD6748E7C1B50692), UL64(0x2775780F6FC5CBCB),
+          UL64(0x4EAB80B8E1C9D7C8), UL64(0x8C69DAE13FDBCD56),
+          UL64(0x47E6B4FB9969EACE), UL64(0x002F1085A705CB5A) },
+        { UL64(0x96892C1F711B0EB9), UL64(0xB905F2C8780AB954),
+          UL64(0xACE26309A20792DB), UL64(0xEC8AC9B30684E126),
+          UL64(0x486AD8B6B40A2447), UL64(0x60121FC19FE3FB24),
+          UL64(0x5626FCCF1A8E3B3F), UL64(0x4E5686226AD1F394) },
+        { UL64(0x2BFB43183037BF52), UL64(0xB61E6DB578C725D7),
+          UL64(0x8EFD4060BBB3E5D7), UL64(0x2E014701DBAC488E),
+          UL64(0xAC75CF9A360AA449), UL64(0xB70CFD0579634D08),
+          UL64(0xA591536DFFFB15EF), UL64(0xB2C37582D07C106C) },
+        { UL64(0x5CFBBB22236F4A98), UL64(0x0B0C59E9066800BB),
+          UL64(0x4AC69A8F5A9A7774), UL64(0x2B33F804D6BEC948),
+          UL64(0xB372929532E6C466), UL64(0x68956D0F4E599C73),
+          UL64(0xA47A249F155C31CC), UL64(0x24D80F0DE1CE284E) },
+        { UL64(0xF347A70D6457D188), UL64(0x86EDA86B8B7A388B),
+          UL64(0xB7CDFF060CCD6013), UL64(0xBEB1B6C7D0053FB2),
+          UL64(0x0B02238799240A9F), UL64(0x1BBB384F776189B2),
+          UL64(0x8695E71E9066193A), UL64(0x2EB5009706FFAC7E) },
+        { UL64(0x5A4B46C64A8A3D62), UL64(0x8469C4D0247743D2),
+          UL64(0x2BB3A13D88F7E433), UL64(0x62B23A1001BE5849),
+          UL64(0xE83596B4A63D1A4C), UL64(0x454E7FEA7D183F3E),
+          UL64(0x643FCE6117AFB01C), UL64(0x4E65E5E61C4C3638) },
+        { UL64(0x4065508DA35FCD5F), UL64(0x8965DF8C495CCAEB),
+          UL64(0x0F2DA85012E1A962), UL64(0xEE471B94C1CF1CC4),
+          UL64(0xCEF19BC80A08FB75), UL64(0x704958F581DE3591),
+          UL64(0x2867F8B23AEF4F88), UL64(0x8D749384EA9F9A5F) },
+        { UL64(0xB7E830E3DC09508B), UL64(0xFAF6D2CF74317655),
+          UL64(0x72606CEBDF690355), UL64(0x48BB92B3D0C3DED6),
+          UL64(0x65B754845C7CF892), UL64(0xF6CD7AC9D5D5F01F),
+          UL64(0xC2C30A5996401D69), UL64(0x91268650ED921878) },
+        { UL64(0xE38B5FF98D2668D5), UL64(0x0715281A7AD81965),
+          UL64(0x1BC8FC7C03C6CE11), UL64(0xCBBEE6E28B650436),
+          UL64(0x06B00FE80CDB9808), UL64(0x17D6E066FE3ED315),
+          UL64(0x2E9D38C64D0B5018), UL64(0xAB8BFD56844DCAEF) },
+        { UL64(0xE5DB77176ADD8545), UL64(0x1B71CB6672C49B66),
+          UL64(0xD856073968421D77), UL64(0x03840FE883E3AFEA),
+          UL64(0xB391DAD51EC69977), UL64(0xAE243FB9307F6726),
+          UL64(0xC88AC87BE8CA160C), UL64(0x5174CCED4CE355F4) },
+        { UL64(0xD4F9497D53A4F566), UL64(0x8973466497B56810),
+          UL64(0xF8E1DA740494A621), UL64(0x82546A938D011C68),
+          UL64(0x1F3ACB19C61AC162), UL64(0x52F8FA9CABAD0D3E),
+          UL64(0x15356523B4B7EA43), UL64(0x5A16AD61AE608125) },
+        { UL64(0x752067F8FF81578E), UL64(0x786221509045447D),
+          UL64(0xC0C22FCF0505AA6F), UL64(0x1030F0A66BED1C77),
+          UL64(0x31F29F151F0BD739), UL64(0x2D7989C7E6DEBE85),
+          UL64(0x5C070E728E677E98), UL64(0x0A817BD306E81FD5) },
+        { UL64(0x0F816A727FE02299), UL64(0x6335CCC2294F3319),
+          UL64(0x3820179F4745C5BE), UL64(0xE647B782922F066E),
+          UL64(0xC22E49DE02CAFB8A), UL64(0x299BC2FFFCC2ECCC),
+          UL64(0x9A8FEEA26E0E8282), UL64(0xA627278BFE893205) },
+        { UL64(0xC1E17EB6CBC613E5), UL64(0x33131D55497EA61C),
+          UL64(0x2F69D39EAF7EDED5), UL64(0x73C2F434DE6AF11B),
+          UL64(0x4CA52493A4A375FA), UL64(0x5F06787CB833C5C2),
+          UL64(0x814E091F3E6E71CF), UL64(0x76451F578B746666) },
+        { UL64(0x6E57C18CB533E92A), UL64(0x339BCAFE55BFB5DE),
+          UL64(0xA1EA8B9C01EEA2EB), UL64(0x6023B4F5F4F8A7D6),
+          UL64(0x5E52E4AE52B54E42), UL64(0x1CBA55E084BF70DC),
+          UL64(0x22097ABA3F06A48D), UL64(0x5513633FE90BBFA9) },
+        { UL64(0x01C7E082E1539388), UL64(0xFD286F30759A9C6B),
+          UL64(0x94581041176BACFB), UL64(0xE580F07C3BC3DE53),
+          UL64(0xDCDB6F75884D772F), UL64(0xD75C3BB840BB9D4F),
+          UL64(0xDC6C2E4EDB083011), UL64(0xE18789A2CD9C298D) },
+        { UL64(0xA5F2101CFFA0CE82), UL64(0x7C6D36E54B343440),
+          UL64(0x82528D290C74A303), UL64(0xD083A8C204D4AB17),
+          UL64(0xCFF14EDD76001E0D), UL64(0xC911C202C9662EC7),
+          UL64(0xDB34FB98810278C6), UL64(0xA1B4250E5EE4E368) },
+        { UL64(0x5EE6AB8495FE1347), UL64(0xAB0F6C396F24503C),
+          UL64(0x807E3FFB4486DD6B), UL64(0xF00B6C748002FEF5),
+          UL64(0x48BFF9A6A7862999), UL64(0x85E5A06CBED89E26),
+          UL64(0x86D311AF3D8419EB), UL64(0x24F3AD7834733F16) },
+        { UL64(0x9CACEE5E5A6FA2AA), UL64(0x0686D78375D4E623),
+          UL64(0x3F728D0A0B28185D), UL64(0x7912B060DD3CED6F),
+          UL64(0x8D3129FAF014CC5A), UL64(0x321DDE5CD7395AEA),
+          UL64(0x9607B2D66B0FBAAB), UL64(0xBC5911AE07AFBD99) },
+        { UL64(0x5E20551311820D44), UL64(0x0C651BCC86C4473A),
+          UL64(0x1D230C2B9BD80EEF), UL64(0x042C4A1207515BE5),
+          UL64(0x42517CA0BFE9E284), UL64(0xE8F605782369827A),
+          UL64(0x184F04F01638699D), UL64(0x174618EDF2BC6D05) },
+        { UL64(0x7C3778D5651CF177), UL64(0x1B685555D852BD0F),
+          UL64(0x4A03F682F3461FF8), UL64(0xC1098C359B12CA7B),
+          UL64(0x6A0553D25D983401), UL64(0xE0C0768F3DC687B0),
+          UL64(0x7C44A33E344B732E), UL64(0x5EB171C364B70A02) },
+        { UL64(0x5E3E03FC6C68D687), UL64(0x3E732C3D1FF052C7),
+          UL64(0xF2D0EFA66ED16E7A), UL64(0x63D92B26B65BB746),
+          UL64(0xFFCD82BADD44867C), UL64(0xA71B4A9EF8C081B8),
+          UL64(0x6C1676A7736C8785), UL64(0xBE2C06169D8932D0) },
+        { UL64(0xD1638849B50939F2), UL64(0xFC33692CBA90858E),
+          UL64(0x2B4A0A912FA6008E), UL64(0xC00190C797A33940),
+          UL64(0x8AFF14FDD62D3C10), UL64(0x98C64D09571989C1),
+          UL64(0x8224EA2800E5FEBA), UL64(0x913CB90CF9A9C5C1) },
+        { UL64(0x7BFA1A4B9ECA1C9F), UL64(0x960BC1DC8CE5E535),
+          UL64(0xE267D9F317EEC30A), UL64(0x06FB89EF6C257D38),
+          UL64(0x2328999AD364A26D), UL64(0x69B794CB26EAAB58),
+          UL64(0xAD28AB1FB85BA596), UL64(0x05DCBFF356D0AA94) },
+        { UL64(0x14D79E80A3A1A602), UL64(0xFC4F185E22C3D6AF),
+          UL64(0x232FA56BB7F667C8), UL64(0x49D0BC918F3EEAF8),
+          UL64(0xE89151B95870E248), UL64(0x70AB0E703D4409AB),
+          UL64(0x22D8E910800783E8), UL64(0x9B2C7BB2A2AC7762) },
+        { UL64(0x53376D282BCFFBC4), UL64(0x708817A706EADB7A),
+          UL64(0x6FF50E05CD35AE69), UL64(0x63B5FB7574BC7FDE),
+          UL64(0x71C9E953E7FE08C4), UL64(0xB4D8BFD4F583CA18),
+          UL64(0xDE8D788245E81C5C), UL64(0xA5F5E93CE0474138) },
+        { UL64(0xD4D75F4BF0831932), UL64(0x5E770AC477FE8CC9),
+          UL64(0x52B5E748862E72A2), UL64(0xE9A45482501D35FE),
+          UL64(0x8A93E7424A9AB187), UL64(0x5A72506DE88CA017),
+          UL64(0xE680DCB201EB2DEF), UL64(0xDC5AA4E6BA68209D) },
+        { UL64(0x426C160F293C9F31), UL64(0x8EB56333E864D7A7),
+          UL64(0xBE1164023EBBBA30), UL64(0x64C2BAE32FD5A302),
+          UL64(0x800601E1265AFF7B), UL64(0x52D8A88066FD4B14),
+          UL64(0x5ABA20E746075A9C), UL64(0xDAA32BF87E1234C6) },
+        { UL64(0x457497A5C4562FC8), UL64(0x44FD8E8AF3E2BFF8),
+          UL64(0x1923493549C97D59), UL64(0xDAE307564036BBE4),
+          UL64(0xF137785149ADA0ED), UL64(0xC6D362C580EF87AA),
+          UL64(0xC597431230A55C6A), UL64(0x568407E515EC5A37) },
+        { UL64(0x80F9BDEF694DB7E0), UL64(0xEDCA8787B9FCDDC6),
+          UL64(0x51981C3403B8DCE1), UL64(0x4274DCF170E10BA1),
+          UL64(0xF72743B86DEF6D1A), UL64(0xD25B1670EBDB1866),
+          UL64(0xC4491E8C050C6F58), UL64(0x2BE2B2AB87FBD7F5) },
+    },
+    {
+        { UL64(0x3E0E5C9DD111F8EC), UL64(0xBCC33F8DB7C4E760),
+          UL64(0x702F9A91BD392A51), UL64(0x7DA4A795C132E92D),
+          UL64(0x1A0B0AE30BB1151B), UL64(0x54FEBAC802E32251),
+          UL64(0xEA3A5082694E9E78), UL64(0xE58FFEC1E4FE40B8) },
+        { UL64(0xFBB8349D29C4120B), UL64(0x9F94391FC0D0D915),
+          UL64(0xC4074FA75410BA51), UL64(0xA66ADBF6150A5911),
+          UL64(0xC164543C34BFCA38), UL64(0xE0F27560B9E1CCFC),
+          UL64(0x99DA0F53E820219C), UL64(0xE8234498C6B4997A) },
+        { UL64(0x7B23C513516E19E4), UL64(0x56E2E847C5C4D593),
+          UL64(0x9F727D735CE71EF6), UL64(0x5B6304A6F79A44C5),
+          UL64(0x6638A7363AB7E433), UL64(0x1ADEA470FE742F83),
+          UL64(0xE054B8545B7FC19F), UL64(0xF935381ABA1D0698) },
+        { UL64(0xB5504F9D918E4936), UL64(0x65035EF6B2513982),
+          UL64(0x0553A0C26F4D9CB9), UL64(0x6CB10D56BEA85509),
+          UL64(0x48D957B7A242DA11), UL64(0x16A4D3DD672B7268),
+          UL64(0x3D7E637C8502A96B), UL64(0x27C7032B730D463B) },
+        { UL64(0x55366B7D5846426F), UL64(0xE7D09E89247D441D),
+          UL64(0x510B404D736FBF48), UL64(0x7FA003D0E784BD7D),
+          UL64(0x25F7614F17FD9596), UL64(0x49E0E0A135CB98DB),
+          UL64(0x2C65957B2E83A76A), UL64(0x5D40DA8DCDDBE0F8) },
+        { UL64(0x37F68BB4A595939D), UL64(0x0355647928740217),
+          UL64(0x8E740E7C84AD7612), UL64(0xD89BC8439044695F),
+          UL64(0xF7F3DA5D85A9184D), UL64(0x562563BB9FC0B074),
+          UL64(0x06D2E6AAF88A888E), UL64(0x612D8643161FBE7C) },
+        { UL64(0x9FB3BBA354530BB2), UL64(0xBDE3EF77CB0869EA),
+          UL64(0x89BC90460B431163), UL64(0x4D03D7D2E4819A35),
+          UL64(0x33AE4F9E43B6A782), UL64(0x216DB3079C88A686),
+          UL64(0x91DD88E000FFEDD9), UL64(0xB280DA9F12BD4840) },
+        { UL64(0x458F86913E538CD7), UL64(0xA7001F6C8E08AD53),
+          UL64(0x52B8C6E6BF5D15FF), UL64(0x548234A4011215DD),
+          UL64(0xFF5A9D2D3D5B4045), UL64(0xB0FFEEB64A904190),
+          UL64(0x55A3ACA448607F8B), UL64(0x8CBD665C30A0672A) },
+        { UL64(0xA37F3573F37F5937), UL64(0xEB0F6C7DD1E4FCA5),
+          UL64(0x2965A554AC8AB0FC), UL64(0x17FBF56C274676AC),
+          UL64(0x2E2F6BD9ACF7D720), UL64(0x41FC8F8810224766),
+          UL64(0x517A14B385D53BEF), UL64(0xDAE327A57D76A7D1) },
+        { UL64(0x515D5C891F5F82DC), UL64(0x9A7F67D76361079E),
+          UL64(0xA8DA81E311A35330), UL64(0xE44990C44B18BE1B),
+          UL64(0xC7D5ED95AF103E59), UL64(0xECE8ABA78DAC9261),
+          UL64(0xBE82B0999394B8D3), UL64(0x6830F09A16ADFE83) },
+        { UL64(0x43C41AC194D7D9B1), UL64(0x5BAFDD82C82E7F17),
+          UL64(0xDF0614C15FDA0FCA), UL64(0x74B043A7A8AE37AD),
+          UL64(0x3BA6AFA19E71734C), UL64(0x15D5437E9C450F2E),
+          UL64(0x4A5883FE67E242B1), UL64(0x5143BDC22C1953C2) },
+        { UL64(0xA2A9CE7C6B53F5F9), UL64(0x642465951B176D99),
+          UL64(0xB1298D36B95C081B), UL64(0x53505BB81D9A9EE6),
+          UL64(0x3F6F9E61F2BA70B0), UL64(0xD07E16C98AFAD453),
+          UL64(0x9F1694BBE7EB4A6A), UL64(0xDFEBCED93CB0BC8E) },
+        { UL64(0xC676D7F2B1F3390B), UL64(0x9F7A1B8CA5B61272),
+          UL64(0x4EBEBFC9C2E127A9), UL64(0x4602500C5DD997BF),
+          UL64(0x7F09771C4711230F), UL64(0x058EB37C020F09C1),
+          UL64(0xAB693D4BFEE5E38B), UL64(0x9289EB1F4653CBC0) },
+        { UL64(0xA44D2B391770F5A7), UL64(0xE4D4D7910E44EB82),
+          UL64(0x42E69D1E3F69712A), UL64(0xBF11C4D6AC6A820E),
+          UL64(0xB5E7F3E542C4224C), UL64(0xD6B4E81C449D941C),
+          UL64(0x5D72BD165450E878), UL64(0x6A61E28AEE25AC54) },
+        { UL64(0x54DA9DC7AB952578), UL64(0xB5423DF226E84D0B),
+          UL64(0xA8B64EEB9B872042), UL64(0xAC2057825990F6DF),
+          UL64(0x4FF696EB21F4C77A), UL64(0x1A79C3E4AAB273AF),
+          UL64(0x29BC922E9436B3F1), UL64(0xFF807EF8D6D9A27A) },
+        { UL64(0xC7F3A8F833F6746C), UL64(0x21E46F65FEA990CA),
+          UL64(0x915FD5C5CADDB0A9), UL64(0xBD41F01678614555),
+          UL64(0x346F4434426FFB58), UL64(0x8055943614DBC204),
+          UL64(0xF3DD20FE5A969B7F), UL64(0x9D59E956E899A39A) },
+        { UL64(0xE4CA688FD06F56C0), UL64(0xA48AF70DDF027972),
+          UL64(0x691F0F045E9A609D), UL64(0xA9DD82CDEE61270E),
+          UL64(0x8903CA63A0EF18D3), UL64(0x9FB7EE353D6CA3BD),
+          UL64(0xA7B4A09CABF47D03), UL64(0x4CDADA011C67DE8E) },
+        { UL64(0xF9A0563774921592), UL64(0xB4F1261DB9BB9D31),
+          UL64(0x551429B74E9C5459), UL64(0xBE182E6F6EA71F53),
+          UL64(0xD3A3B07CDFC50573), UL64(0x9BA1AFDA62BE8D44),
+          UL64(0x9BCFD2CB52AB65D3), UL64(0xDF11D547A9571802) },
+        { UL64(0xAC127DC1E038A675), UL64(0x729DEFF38C5C6320),
+          UL64(0xB7DF8FD4A90D2C53), UL64(0x9B74B0EC681E7CD3),
+          UL64(0x5CB5A623DAB407E5), UL64(0xCDBD361576B340C6),
+          UL64(0xA184415A7D28392C), UL64(0xC184C1D8E96F7830) },
+        { UL64(0xB189B6845E43FC61), UL64(0xF3282375E0D3AB57),
+          UL64(0x4FA34B67B1181DA8), UL64(0x621ED0B299EE52B8),
+          UL64(0x9B178DE1AD990676), UL64(0xD51DE67B56D54065),
+          UL64(0x2A2C27C47538C201), UL64(0x33856EC838A40F5C) },
+        { UL64(0x86A9303B2F7E85C3), UL64(0x5FCE462171988F9B),
+          UL64(0x5B935BF6C138ACB5), UL64(0x30EA7D6725661212),
+          UL64(0xEF1EB5F4E51AB9A2), UL64(0x0587C98AAE067C78),
+          UL64(0xB3CE1B3C77CA9CA6), UL64(0x2A553D4D54B5F057) },
+        { UL64(0x89E468B2CD21AB3D), UL64(0xE504F022C393D392),
+          UL64(0xAB21E1D4A5013AF9), UL64(0xE3283F78C2C28ACB),
+          UL64(0xF38B35F6226BF99F), UL64(0xE83542740E291E69),
+          UL64(0x61673A15B20C162D), UL64(0xC101DC75B04FBDBE) },
+        { UL64(0x2C7156E10B1894A0), UL64(0x92034001D81C68C0),
+          UL64(0xED225D00C8B115B5), UL64(0x237F9C2283B907F2),
+          UL64(0x0EA2F32F4470E2C0), UL64(0xB725F7C158BE4E95),
+          UL64(0x0F1DCAFAB1AE5463), UL64(0x59ED51871BA2FC04) },
+        { UL64(0x35DBBEE206DDD657), UL64(0xE7CBDD112FF3A96D),
+          UL64(0x88381968076BE758), UL64(0x2D737E7208C91F5D),
+          UL64(0x5F83AB6286EC3776), UL64(0x98AA649D945FA7A1),
+          UL64(0xF477EC3772EF0933), UL64(0x66F52B1E098C17B1) },
+        { UL64(0xD1B0CCDEC9520711), UL64(0x55A9E4ED3C8B84BF),
+          UL64(0x9426BD39A1FEF314), UL64(0x4F5F638E6EB93F2B),
+          UL64(0xBA2A1ED32BF9341B), UL64(0xD63C13214D42D5A9),
+          UL64(0xD2964A89316DC7C5), UL64(0xD1759606CA511851) },
+        { UL64(0xB12EC10ECFE57BBD), UL64(0x82C7B65635A0C2B5),
+          UL64(0xDDC7D5CD161C67BD), UL64(0xE32E8985AE3A32CC),
+          UL64(0x7ABA9444D11A5529), UL64(0xE964ED022427FA1A),
+          UL64(0x1528392D24A1770A), UL64(0xA152CE2C12C72FCD) },
+        { UL64(0xEDF69FEAF8C51187), UL64(0x05BB67EC741E4DA7),
+          UL64(0x47DF0F3208114345), UL64(0x56FACB07BB9792B1),
+          UL64(0xF3E007E98F6229E4), UL64(0x62D103F4526FBA0F),
+          UL64(0x4F33BEF7B0339D79), UL64(0x9841357BB59BFEC1) },
+        { UL64(0xAE1E0B67E28EF5BA), UL64(0x2C9A4699CB18E169),
+          UL64(0x0ECD0E331E6BBD20), UL64(0x571B360EAF5E81D2),
+          UL64(0xCD9FEA58101C1D45), UL64(0x6651788E18880452),
+          UL64(0xA99726351F8DD446), UL64(0x44BED022E37281D0) },
+        { UL64(0x830E6EEA60DBAC1F), UL64(0x23D8C484DA06A2F7),
+          UL64(0x896714B050CA535B), UL64(0xDC8D3644EBD97A9B),
+          UL64(0x106EF9FAB12177B4), UL64(0xF79BF464534D5D9C),
+          UL64(0x2537A349A6AB360B), UL64(0xC7C54253A00C744F) },
+        { UL64(0xF0F82DE5FACF69D4), UL64(0x363B7E764775344C),
+          UL64(0x6894F312B2E36D04), UL64(0x3C6CB4FE11D1C9A5),
+          UL64(0x85D9C3394008E1F2), UL64(0x5E9A85EA249F326C),
+          UL64(0xDC35C60A678C5E06), UL64(0xC08B944F9F86FBA9) },
+        { UL64(0x24D661D168754AB0), UL64(0x801FCE1D6F429A76),
+          UL64(0xC068A85FA58CE769), UL64(0xEDC35C545D5ECA2B),
+          UL64(0xEA31276FA3F660D1), UL64(0xA0184EBEB8FC7167),
+          UL64(0x0F20F21A1D8DB0AE), UL64(0xD96D095F56C35E12) },
+        { UL64(0x3C2F0BA9B733AA5F), UL64(0xDECE47CBF05AF235),
+          UL64(0xF8E3F715A2AC82A5), UL64(0xC97BA6412203F18A),
+          UL64(0xC3AF550409C11060), UL64(0x56EA2C0546AF512D),
+          UL64(0xFAC28DAFF3F28146), UL64(0x87FAB43A959EF494) },
+    },
+    {
+        { UL64(0x09891641D4C5105F), UL64(0x1AE80F8E6D7FBD65),
+          UL64(0x9D67225FBEE6BDB0), UL64(0x3B433B597FC4D860),
+          UL64(0x44E66DB693E85638), UL64(0xF7B59252E3E9862F),
+          UL64(0xDB785157665C32EC), UL64(0x702FEFD7AE362F50) },
+        { UL64(0x3754475D0FEFB0C3), UL64(0xD48FB56B46D7C35D),
+          UL64(0xA070B633363798A4), UL64(0xAE89F3D28FDB98E6),
+          UL64(0x970B89C86363D14C), UL64(0x8981752167ABD27D),
+          UL64(0x9BF7D47444D5A021), UL64(0xB3083BAFCAC72AEE) },
+        { UL64(0x389741DEBE949A44), UL64(0x638E9388546A4FA5),
+          UL64(0x3FE6419CA0047BDC), UL64(0x7047F648AAEA57CA),
+          UL64(0x54E48A9041FBAB17), UL64(0xDA8E0B28576BDBA2),
+          UL64(0xE807EEBCC72AFDDC), UL64(0x07D3336DF42577BF) },
+        { UL64(0x62A8C244BFE20925), UL64(0x91C19AC38FDCE867),
+          UL64(0x5A96A5D5DD387063), UL64(0x61D587D421D324F6),
+          UL64(0xE87673A2A37173EA), UL64(0x2384800853778B65),
+          UL64(0x10F8441E05BAB43E), UL64(0xFA11FE124621EFBE) },
+        { UL64(0x047B772E81685D7B), UL64(0x23F27D81BF34A976),
+          UL64(0xC27608E2915F48EF), UL64(0x3B0B43FAA521D5C3),
+          UL64(0x7613FB2663CA7284), UL64(0x7F5729B41D4DB837),
+          UL64(0x87B14898583B526B), UL64(0x00B732A6BBADD3D1) },
+        { UL64(0x8E02F4262048E396), UL64(0x436B50B6383D9DE4),
+          UL64(0xF78D3481471E85AD), UL64(0x8B01EA6AD005C8D6),
+          UL64(0xD3C7AFEE97015C07), UL64(0x46CDF1A94E3BA2AE),
+          UL64(0x7A42E50183D3A1D2), UL64(0xD54B5268B541DFF4) },
+        { UL64(0x3F24CF304E23E9BC), UL64(0x4387F816126E3624),
+          UL64(0x26A46A033B0B6D61), UL64(0xAF1BC8458B2D777C),
+          UL64(0x25C401BA527DE79C), UL64(0x0E1346D44261BBB6),
+          UL64(0x4B96C44B287B4BC7), UL64(0x658493C75254562F) },
+        { UL64(0x23F949FEB8A24A20), UL64(0x17EBFED1F52CA53F),
+          UL64(0x9B691BBEBCFB4853), UL64(0x5617FF6B6278A05D),
+          UL64(0x241B34C5E3C99EBD), UL64(0xFC64242E1784156A),
+          UL64(0x4206482F695D67DF), UL64(0xB967CE0EEE27C011) },
+        { UL64(0x65DB375121C80B5D), UL64(0x2E7A563CA31ECCA0),
+          UL64(0xE56FFC4E5238A07E), UL64(0x3D6C296632CED854),
+          UL64(0xE99D7D1AAF70B885), UL64(0xAFC3BAD92D686459),
+          UL64(0x9C78BF460CC8BA5B), UL64(0x5A43951918955AA3) },
+        { UL64(0xF8B517A85FE4E314), UL64(0xE60234D0FCB8906F),
+          UL64(0xFFE542ACF2061B23), UL64(0x287E191F6B4CB59C),
+          UL64(0x21857DDC09D877D8), UL64(0x1C23478C14678941),
+          UL64(0xBBF0C056B6E05EA4), UL64(0x82DA4B53B01594FE) },
+        { UL64(0xF7526791FADB8608), UL64(0x049E832D7B74CDF6),
+          UL64(0xA43581CCC2B90A34), UL64(0x73639EB89360B10C),
+          UL64(0x4FBA331FE1E4A71B), UL64(0x6FFD6B938072F919),
+          UL64(0x6E53271C65679032), UL64(0x67206444F14272CE) },
+        { UL64(0xC0F734A3B2335834), UL64(0x9526205A90EF6860),
+          UL64(0xCB8BE71704E2BB0D), UL64(0x2418871E02F383FA),
+          UL64(0xD71776814082C157), UL64(0xCC914AD029C20073),
+          UL64(0xF186C1EBE587E728), UL64(0x6FDB3C2261BCD5FD) },
+        { UL64(0x30D014A6F2F9F8E9), UL64(0x963ECE234FEC49D2),
+          UL64(0x862025C59605A8D9), UL64(0x3987444519F8929A),
+          UL64(0x01B6FF6512BF476A), UL64(0x598A64D809CF7D91),
+          UL64(0xD7EC774993BE56CA), UL64(0x10899785CBB33615) },
+        { UL64(0xB8A092FD02EEE3AD), UL64(0xA86B3D3530145270),
+          UL64(0x323D98C68512B675), UL64(0x4B8BC78562EBB40F),
+          UL64(0x7D301F54413F9CDE), UL64(0xA5E4FB4F2BAB5664),
+          UL64(0x1D2B252D1CBFEC23), UL64(0xFCD576BBE177120D) },
+        { UL64(0x04427D3E83731A34), UL64(0x2BB9028EED836E8E),
+          UL64(0xB36ACFF8B612CA7C), UL64(0xB88FE5EFD3D9C73A),
+          UL64(0xBE2A6BC6EDEA4EB3), UL64(0x43B93133488EEC77),
+          UL64(0xF41FF566B17106E1), UL64(0x469E9172654EFA32) },
+        { UL64(0xB4480F0441C23FA3), UL64(0xB4712EB0C1989A2E),
+          UL64(0x3CCBBA0F93A29CA7), UL64(0x6E205C14D619428C),
+          UL64(0x90DB7957B3641686), UL64(0x0432691D45AC8B4E),
+          UL64(0x07A759ACF64E0350), UL64(0x0514D89C9C972517) },
+        { UL64(0x1701147FA8E67FC3), UL64(0x9E2E0B8BAB2085BE),
+          UL64(0xD5651824AC284E57), UL64(0x890D432574893664),
+          UL64(0x8A7C5E6EC55E68A3), UL64(0xBF12E90B4339C85A),
+          UL64(0x31846B85F922B655), UL64(0x9A54CE4D0BF4D700) },
+        { UL64(0xD7F4E83AF1A14295), UL64(0x916F955CB285D4F9),
+          UL64(0xE57BB0E099FFDABA), UL64(0x28A43034EAB0D152),
+          UL64(0x0A36FFA2B8A9CEF8), UL64(0x5517407EB9EC051A),
+          UL64(0x9C796096EA68E672), UL64(0x853DB5FBFB3C77FB) },
+        { UL64(0x21474BA9E864A51A), UL64(0x6C2676996E8A1B8B),
+          UL64(0x7C82362694120A28), UL64(0xE61E9A488383A5DB),
+          UL64(0x7DD750039F84216D), UL64(0xAB020D07AD43CD85),
+          UL64(0x9437AE48DA12C659), UL64(0x6449C2EBE65452AD) },
+        { UL64(0xCC7C4C1C2CF9D7C1), UL64(0x1320886AEE95E5AB),
+          UL64(0xBB7B9056BEAE170C), UL64(0xC8A5B250DBC0D662),
+          UL64(0x4ED81432C11D2303), UL64(0x7DA669121F03769F),
+          UL64(0x3AC7A5FD84539828), UL64(0x14DADA943BCCDD02) },
+        { UL64(0x8B84C3217EF6B0D1), UL64(0x52A9477A7C933F22),
+          UL64(0x5EF6728AFD440B82), UL64(0x5C3BD8596CE4BD5E),
+          UL64(0x918B80F5F22C2D3E), UL64(0x368D5040B7BB6CC5),
+          UL64(0xB66142A12695A11C), UL64(0x60AC583AEB19EA70) },
+        { UL64(0x317CBB980EAB2437), UL64(0x8CC08C555E2654C8),
+          UL64(0xFE2D6520E6D8307F), UL64(0xE9F147F357428993),
+          UL64(0x5F9C7D14D2FD6CF1), UL64(0xA3ECD0642D4FCBB0),
+          UL64(0xAD83FEF08E7341F7), UL64(0x643F23A03A63115C) },
+        { UL64(0xD38A78ABE65AB743), UL64(0xBF7C75B135EDC89C),
+          UL64(0x3DD8752E530DF568), UL64(0xF85C4A76E308C682),
+          UL64(0x4C9955B2E68ACF37), UL64(0xA544DF3DAB32AF85),
+          UL64(0x4B8EC3F5A25CF493), UL64(0x4D8F27641A622FEB) },
+        { UL64(0x7BB4F7AAF0DCBC49), UL64(0x7DE551F970BBB45B),
+          UL64(0xCFD0F3E49F2CA2E5), UL64(0xECE587091F5C76EF),
+          UL64(0x32920EDD167D79AE), UL64(0x039DF8A2FA7D7EC1),
+          UL64(0xF46206C0BB30AF91), UL64(0x1FF5E2F522676B59) },
+        { UL64(0x11F4A0396EA51D66), UL64(0x506C1445807D7A26),
+          UL64(0x60DA5705755A9B24), UL64(0x8FC8CC321F1A319E),
+          UL64(0x83642D4D9433D67D), UL64(0x7FA5CB8F6A7DD296),
+          UL64(0x576591DB9B7BDE07), UL64(0x13173D25419716FB) },
+        { UL64(0xEA30599DD5B340FF), UL64(0xFC6B5297B0FE76C5),
+          UL64(0x1C6968C8AB8F5ADC), UL64(0xF723C7F5901C928D),
+          UL64(0x4203C3219773D402), UL64(0xDF7C6AA31B51DD47),
+          UL64(0x3D49E37A552BE23C), UL64(0x57FEBEE80B5A6E87) },
+        { UL64(0xC5ECBEE47BD8E739), UL64(0x79D44994AE63BF75),
+          UL64(0x168BD00F38FB8923), UL64(0x75D48EE4D0533130),
+          UL64(0x554F77AADB5CDF33), UL64(0x3396E8963C696769),
+          UL64(0x2FDDDBF2D3FD674E), UL64(0xBBB8F6EE99D0E3E5) },
+        { UL64(0x51B90651CBAE2F70), UL64(0xEFC4BC0593AAA8EB),
+          UL64(0x8ECD8689DD1DF499), UL64(0x1AEE99A822F367A5),
+          UL64(0x95D485B9AE8274C5), UL64(0x6C14D4457D30B39C),
+          UL64(0xBAFEA90BBCC1EF81), UL64(0x7C5F317AA459A2ED) },
+        { UL64(0x012110754EF44227), UL64(0xA17BED6EDC20F496),
+          UL64(0x0CDFE424819853CD), UL64(0x13793298F71E2CE7),
+          UL64(0x3C1F3078DBBE307B), UL64(0x6DD1C20E76EE9936),
+          UL64(0x23EE4B57423CAA20), UL64(0x4AC3793B8EFB840E) },
+        { UL64(0x934438EBED1F8CA0), UL64(0x3E5466584EBB25A2),
+          UL64(0xC415AF0EC069896F), UL64(0xC13EDDB09A5AA43D),
+          UL64(0x7A04204FD49EB8F6), UL64(0xD0D5BDFCD74F1670),
+          UL64(0x3697E28656FC0558), UL64(0x1020737101CEBADE) },
+        { UL64(0x5F87E6900647A82B), UL64(0x908E0ED48F40054F),
+          UL64(0xA9F633D479853803), UL64(0x8ED13C9A4A28B252),
+          UL64(0x3E2EF6761F460F64), UL64(0x53930B9B36D06336),
+          UL64(0x347073AC8FC4979B), UL64(0x84380E0E5ECD5597) },
+        { UL64(0xE3B22C6BC4FE3C39), UL64(0xBA4A81536C7BEBDF),
+          UL64(0xF23AB6B725693459), UL64(0x53BC377014922B11),
+          UL64(0x4645C8AB5AFC60DB), UL64(0xAA02235520B9F2A3),
+          UL64(0x52A2954CCE0FC507), UL64(0x8C2731BB7CE1C2E7) },
+    },
+    {
+        { UL64(0x6A7091C2E48FB889), UL64(0x26882C137B8A9D06),
+          UL64(0xA24986631B82A0E2), UL64(0x844ED7363518152D),
+          UL64(0x282F476FD86E27C7), UL64(0xA04EDACA04AFEFDC),
+          UL64(0x8B256EBC6119E34D), UL64(0x56A413E90787D78B) },
+        { UL64(0x82EE061D5A74BE50), UL64(0xE41781C4DEA16FF5),
+          UL64(0xE0B0C81E99BFC8A2), UL64(0x624F4D690B547E2D),
+          UL64(0x3A83545DBDCC9AE4), UL64(0x2573DBB6409B1E8E),
+          UL64(0x482960C4A6C93539), UL64(0xF01059AD5AE18798) },
+        { UL64(0x38151E274D559D96), UL64(0x4F18C0D3B8DB6C01),
+          UL64(0x49A3AA836F9921AF), UL64(0xDBEAB27B8C046029),
+          UL64(0x242B9EAA7040BF3B), UL64(0x39C479E51614B091),
+          UL64(0x338EDE2B0E4BAF5D), UL64(0x5BB192B7F0A53945) },
+        { UL64(0x715C9F973112795F), UL64(0xE8244437984E6EE1),
+          UL64(0x55CB4858ECB66BCD), UL64(0x7C136735ABAFFBEE),
+          UL64(0x546615955DBEC38E), UL64(0x51C0782C388AD153),
+          UL64(0x9BA4C53AC6E0952F), UL64(0x27E6782A1B21DFA8) },
+        { UL64(0x7D89C251EC5D7F65), UL64(0x0C8F561690394087),
+          UL64(0x609E1CFCF0691AB3), UL64(0x2A0300BFE9B20B21),
+          UL64(0xBF532FADB114FAF4), UL64(0x328FC0B9521BF5D1),
+          UL64(0xBD51F93C3BFC36DE), UL64(0xD989050E7A4E5F60) },
+        { UL64(0x682F903D4ED2DBC2), UL64(0x0EBA59C87C3B2D83),
+          UL64(0x8E9DC84D9C7E9335), UL64(0x5F9B21B00EB226D7),
+          UL64(0xE33BD394AF267BAE), UL64(0xAA86CC25BE2E15AE),
+          UL64(0x4F0BF67D6A8EC500), UL64(0x5846AA44F9630658) },
+        { UL64(0x6786BA38E7E0C278), UL64(0x09BF87CE588B2E6F),
+          UL64(0x723B7022465FEE3A), UL64(0x08B8411464682394),
+          UL64(0x0EB52CE029E64629), UL64(0xADB60E8FCCA78E43),
+          UL64(0x20DD7062B654A991), UL64(0x4281D428C69A6FE5) },
+        { UL64(0xFEB09740E2C2BF15), UL64(0x627A2205A9E99704),
+          UL64(0xEC8D73D0C2FBC565), UL64(0x223EED8FC20C8DE8),
+          UL64(0x1EE32583A8363B49), UL64(0x1A0B6CB9C9C2B0A6),
+          UL64(0x49F7C3D290DBC85C), UL64(0xA8DFBB971EF4C1AC) },
+        { UL64(0x5C257CA3C01E2EE1), UL64(0x1FB43A1427C36961),
+          UL64(0xD594A7CB3472F324), UL64(0xC15EC024660ABE10),
+          UL64(0xB176D4496B614CED), UL64(0x0B04734D62DBB885),
+          UL64(0x2CB753C636DDB587), UL64(0x9A1C80E614CD340C) },
+        { UL64(0xAFB34D4C65C7C2AB), UL64(0x1D4610E7E2C5EA84),
+          UL64(0x893F6D1B973C4AB5), UL64(0xA3CDD7E9945BA5C4),
+          UL64(0x60514983064417EE), UL64(0x1459B23CAD6BDF2B),
+          UL64(0x23B2C3415CF726C3), UL64(0x3A82963532D6354A) },
+        { UL64(0xE9F65696C06FE7CD), UL64(0x510630579AFD3A15),
+          UL64(0x3DCDACA6185360ED), UL64(0x2741703DC1853D2F),
+          UL64(0xBD8AD84A1A33F1A0), UL64(0x5F6C698CC35CB07C),
+          UL64(0x212BD1196561E6B9), UL64(0xF149CD7E617B4FD7) },
+        { UL64(0x294F901FAB192C18), UL64(0xEC5FCBFE7030164F),
+          UL64(0xE2E2FCB7E2246BA6), UL64(0x1E7C88B3221A1A0C),
+          UL64(0x72C7DD93C92D88C5), UL64(0x41C2148E1106FB59),
+          UL64(0x547DD4F5A0F60F14), UL64(0xED9B52B263960F31) },
+        { UL64(0x1CE3C9C530E82BF8), UL64(0x4D6625420DBB772A),
+          UL64(0x19E25A60D9C17214), UL64(0x13BCF84C7722FA55),
+          UL64(0x228ACA0EF89EF7A7), UL64(0x03D64E2FFD3ED455),
+          UL64(0xF1C390F5DDE6C904), UL64(0x731452A67678E18A) },
+        { UL64(0x6C8349EBB0A5B358), UL64(0xB154C5C29E7E2ED6),
+          UL64(0xCAD5ECCFEDA462DB), UL64(0xF2D6DBE42DE66B69),
+          UL64(0x426AEDF38665E5B2), UL64(0x488A85137B7F5723),
+          UL64(0x15CC43B38BCBB386), UL64(0x27AD0AF3D791D879) },
+        { UL64(0x3C006E61A0632CBA), UL64(0x920D924845B35CCD),
+          UL64(0x4B3379FB7C5C7F65), UL64(0x526CDF10B05E050B),
+          UL64(0x3188E936D21BF1AE), UL64(0xB3E07B39624BBD2F),
+          UL64(0x7B9BFCF31367A541), UL64(0x039F8EC88A367927) },
+        { UL64(0xC16C236E846E364F), UL64(0x7F33527CDEA50CA0),
+          UL64(0xC48107750926B86D), UL64(0x6C2A36090598E70C),
+          UL64(0xA6755E52F024E924), UL64(0xE0FA07A49DB4AFCA),
+          UL64(0x15C3CE7D66831790), UL64(0x5B4EF350A6CBB0D6) },
+        { UL64(0x348504E0436982F4), UL64(0xC94905EED8E3EC79),
+          UL64(0xB92CFDCB3509179E), UL64(0x245266D0F9E6D914),
+          UL64(0x8BAA50D0AD316955), UL64(0x77235C79CA227F60),
+          UL64(0xF2C927C951E5F9D8), UL64(0xEBBF8C30E679940F) },
+        { UL64(0x2C4AAFC4B6205969), UL64(0x42563F02F6C7854F),
+          UL64(0x016ACED51D983B48), UL64(0xFEB356D899949755),
+          UL64(0x8C2A2C81D1A39BD7), UL64(0x8F44340FE6934AE9),
+          UL64(0x148CF91C447904DA), UL64(0x7340185F0F51A926) },
+        { UL64(0xE4E95F66CEAC6990), UL64(0x17DC1D16BE6C16CE),
+          UL64(0x2967A05545AD0CBE), UL64(0xDD0E2F97716F7EB6),
+          UL64(0x338B7FF32DC33B91), UL64(0xDCF6AEF52FE976DE),
+          UL64(0xF51CF71C43193F6E), UL64(0x15E444C4E8C077E3) },
+        { UL64(0x2F8F00FB7409AB46), UL64(0x057E78E680E289B2),
+          UL64(0x03E5022CA888E5D1), UL64(0x3C87111A9DEDE4E2),
+          UL64(0x5B9B0E1C7809460B), UL64(0xE751C85271C9ABC7),
+          UL64(0x8B944E28C7CC1DC9), UL64(0x4F201FFA1D3CFA08) },
+        { UL64(0x6078FE2D0F9FC049), UL64(0xD99D975040F6D11A),
+          UL64(0x87AE9A970854C0B7), UL64(0xF4CEB09C9302FB79),
+          UL64(0x502F01682C32A83F), UL64(0x1E352771B1685024),
+          UL64(0x970DF6F266792B19), UL64(0xF507D0BB9C8D87FD) },
+        { UL64(0x02FC905C3E6721CE), UL64(0xD52D70DAD0B3674C),
+          UL64(0x5DC2E5CA18810DA4), UL64(0xA984B2735C69DD99),
+          UL64(0x63B9252784DE5CA4), UL64(0x2F1C9872C852DEC4),
+          UL64(0x18B03593C2E3DE09), UL64(0x19D70B019813DC2F) },
+        { UL64(0x154E40CE426338B2), UL64(0x7B2CB00096AA88C9),
+          UL64(0xD5C901FCAD51F925), UL64(0x5ABD216C7ED0EE10),
+          UL64(0x73C3D557F87DE164), UL64(0x693AD1DCE139516D),
+          UL64(0xB4767B3A3EBD547A), UL64(0xB8B3C24C20F4A982) },
+        { UL64(0x42806B2DA6DC1D29), UL64(0xD3030009F871E144),
+          UL64(0xA1FEB333AAF49276), UL64(0xB5583B9EC70BC04B),
+          UL64(0x1DB0BE7895695F20), UL64(0xFC84181189D012B5),
+          UL64(0x6409F27205F61643), UL64(0x40D34174D5883128) },
+        { UL64(0x64FBA0CD08567C7B), UL64(0xC9EA590DA2CBFB54),
+          UL64(0x666F7716136D0D73), UL64(0x2CA0964838F2A30D),
+          UL64(0x7FA545240F4E0CA9), UL64(0xEF3301A8C1BEB84B),
+          UL64(0x45CB930EBC62B92A), UL64(0x964AC7059BB6CBEA) },
+        { UL64(0xD79196F567419833), UL64(0x6059E252863B7B08),
+          UL64(0x84DA18171C56700C), UL64(0x5758EE56B28D3EC4),
+          UL64(0x7DA2771D013B0EA6), UL64(0xFDDF524B54C5E9B9),
+          UL64(0x7DF4FAF824305D80), UL64(0x58F5C1BF3A97763F) },
+        { UL64(0xEAF671CC81F5261F), UL64(0x7D083506BCFE83EF),
+          UL64(0x94CDC50B3188536E), UL64(0x410B2C4124DD3ECD),
+          UL64(0x57CB99CC0205520C), UL64(0x23F3A2685F06446D),
+          UL64(0xB2B27E4349A04B17), UL64(0xABB266F381785A12) },
+        { UL64(0xA5AF37F17C696042), UL64(0xD4CBA22C4A2538DE),
+          UL64(0x211CB9959EA42600), UL64(0xCD105F417B069889),
+          UL64(0xB1E1CF19DDB81E74), UL64(0x472F2D895157B8CA),
+          UL64(0x086FB008EE9DB885), UL64(0x365CD5700F26D131) },
+        { UL64(0x00A7BA5D66B7FE5A), UL64(0x818674AC05FD5D56),
+          UL64(0x688FB03C04145A57), UL64(0x76C1658897D5832C),
+          UL64(0xA0F0DCD81245ABA7), UL64(0xDD077CAA1847F6E9),
+          UL64(0xF90353140D34ADD0), UL64(0x22E37C1148B73DED) },
+        { UL64(0x284B02BBA2BE7053), UL64(0xDCBBF7C67AB9A6D6),
+          UL64(0x4425559C20F7A530), UL64(0x961F2DFA188767C8),
+          UL64(0xE2FD943570DC80C4), UL64(0x104D6B63F0784120),
+          UL64(0x7F592BC153567122), UL64(0xF6BC1246F688AD77) },
+        { UL64(0xFDFE436BB70AB006), UL64(0x57E7D11918991A1D),
+          UL64(0x3A54422834D4C0B0), UL64(0x26091DD432B58404),
+          UL64(0x8B116DFC272AF899), UL64(0x51F8DC8734118777),
+          UL64(0xC0F0A340DFA7F0BC), UL64(0x22C5A5F656AD97DD) },
+        { UL64(0x05214C050F15DDE9), UL64(0xA47A76A80D5F2B82),
+          UL64(0xBB254D3062E82B62), UL64(0x11A05FE03EC955EE),
+          UL64(0x7EAFF46E9D529B36), UL64(0x55AB13018F9E3DF6),
+          UL64(0xC463E37199317698), UL64(0xFD251438CCDA47AD) },
+    },
+    {
+        { UL64(0xE13122F3DBFB894E), UL64(0xBE9B79F6CE274B18),
+          UL64(0x85A49DE5CA58AADF), UL64(0x2495775811487351),
+          UL64(0x111DEF61BB939099), UL64(0x1D6A974A26D13694),
+          UL64(0x4474B4CED3FC253B), UL64(0x3A1485E64C5DB15E) },
+        { UL64(0xEBDE86EC1ED66F18), UL64(0x225D906BD61FCE43),
+          UL64(0x5CAB07D6E8BED74D), UL64(0x16E4617F27855AB7),
+          UL64(0x6568AADDB2FBC3DD), UL64(0xEDB5484F8AEDDF5B),
+          UL64(0x878F20E86DCF2FAD), UL64(0x3516497C615F5699) },
+        { UL64(0x5158AEE8707BACE2), UL64(0x458D14C6F86D1C56),
+          UL64(0x15EBF15CC1B9BEE2), UL64(0xA015DF660F379CC0),
+          UL64(0xB24CEBA3202ED161), UL64(0x4558F687204B3DF0),
+          UL64(0x890E8EEDBE264C04), UL64(0xB5B7871090DE8BB7) },
+        { UL64(0xEF0A3FECFA181E69), UL64(0x9EA02F8130D69A98),
+          UL64(0xB2E9CF8E66EAB95D), UL64(0x520F2BEB24720021),
+          UL64(0x621C540A1DF84361), UL64(0x1203772171FA6D5D),
+          UL64(0x6E3C7B510FF5F6FF), UL64(0x817A069BABB2BEF3) },
+        { UL64(0x7E2B2F119781CD05), UL64(0x77A8C2E27EAFA12B),
+          UL64(0x78FDD03CA381385E), UL64(0xAB3B54BB15AB85AD),
+          UL64(0x48BE55AACF1C8AD4), UL64(0x57A60C58528ABC81),
+          UL64(0xF8AFB5FE4A6893B3), UL64(0xBDD179CF9A66CCCB) },
+        { UL64(0xF14F7D77656C09B1), UL64(0x4B40AC9529A9DF00),
+          UL64(0xE9DC488214103833), UL64(0x4C633233421745C7),
+          UL64(0xD22FCCC575C20369), UL64(0x47F242A589370C36),
+          UL64(0x1E8C16AE4EDAECCF), UL64(0xAD8EABB04FCF78C4) },
+        { UL64(0x3DE605BA9EC598CF), UL64(0x1933D3AE4D3029AE),
+          UL64(0x6BF2FABD9B140516), UL64(0x712DFC5559A7D01C),
+          UL64(0xFF3EAAE0D2576366), UL64(0x36E407F948701CF8),
+          UL64(0xEDE21D89B41F4BD4), UL64(0xC5292F5C666EEFA9) },
+        { UL64(0x83572FB6B294CDA6), UL64(0x6CE9BF75B9039F34),
+          UL64(0x20E012F0095CBB21), UL64(0xA0AECC1BD063F0DA),
+          UL64(0x57C21C3AF02909E5), UL64(0xC7D59ECF48CE9CDC),
+          UL64(0x2732B8448AE336F8), UL64(0x056E37233F4F85F4) },
+        { UL64(0xF2B75D21EF78A852), UL64(0xBA38CD34DD31A900),
+          UL64(0x72B3A68658FFE18A), UL64(0x7464190CBFD95745),
+          UL64(0x406E532177ED6E81), UL64(0x1AF0975BDE535EAB),
+          UL64(0x66BA22C760C54C82), UL64(0x88E3B1CEB00A2FE0) },
+        { UL64(0x55B7F977F0337B15), UL64(0x3BC872A30E94973A),
+          UL64(0x624AD983770DEEA0), UL64(0xCAAB336413A5EFDB),
+          UL64(0x391DD0027A0D4247), UL64(0x39590D5DF312AED5),
+          UL64(0x532802C9351365AC), UL64(0xDD2E824578A2E22A) },
+        { UL64(0x98C6A6A52EBEE687), UL64(0xCDF65BFA56C1C731),
+          UL64(0x48E8132772DEF210), UL64(0x4EA119418083B5A5),
+          UL64(0x3FDCEA4FFFEBB525), UL64(0x55AAEA19FB50BF72),
+          UL64(0x5FBEDC0A2A85B40C), UL64(0x0D6FD954BF44F29F) },
+        { UL64(0x8A10B53189E800CA), UL64(0x50FE0C17145208FD),
+          UL64(0x9E43C0D3B714BA37), UL64(0x427D200E34189ACC),
+          UL64(0x05DEE24FE616E2C0), UL64(0x9C25F4C8EE1854C1),
+          UL64(0x4D3222A58F342A73), UL64(0x0807804FA027C952) },
+        { UL64(0xBABFB7F82E8F326F), UL64(0xED9CAC225625A519),
+          UL64(0xF1109C1A0EDAE0A9), UL64(0x45F80A9858521259),
+          UL64(0x37A44B075AB71F44), UL64(0x21699EB64A21161B),
+          UL64(0xB523FDDF56FE67EE), UL64(0x9F5C3A2120B9F72E) },
+        { UL64(0xBA414A3350D26E73), UL64(0x4569449475F72688),
+          UL64(0xD482A6E3B1550F82), UL64(0xDE7FF7E643166D7E),
+          UL64(0xAD97C6689C94222A), UL64(0x90A5922D72FA9840),
+          UL64(0x371886BD32E6AA5F), UL64(0xF1BD4F677F5E0D44) },
+        { UL64(0x058EB276FBA319C5), UL64(0xD33A91127F7FA54A),
+          UL64(0xF060C1B4932A2DAB), UL64(0xCE3A224E79C7D9BF),
+          UL64(0x6FB0388C0BA92823), UL64(0x8D31738A69787881),
+          UL64(0x2D86EB0203CD00B7), UL64(0x4E6E44512B69911B) },
+        { UL64(0xC222653A4F0D56F3), UL64(0x961E4047CA28B805),
+          UL64(0x2C03F8B04A73434B), UL64(0x4C966787AB712A19),
+          UL64(0xCC196C42864FEE42), UL64(0xC1BE93DA5B0ECE5C),
+          UL64(0xA87D9F22C131C159), UL64(0x2BB6D593DCE45655) },
+        { UL64(0xEC955AA94C894042), UL64(0x9D32179AF22F92ED),
+          UL64(0x5E020FF0FA286508), UL64(0x4649863A239B1CDA),
+          UL64(0xA5711B9211F1458F), UL64(0x7DD493ECDE9B356D),
+          UL64(0xE4F9068280AD8194), UL64(0x81867AC1FE309773) },
+        { UL64(0xE9DD96FEAD78913C), UL64(0x325EB51486EEB7B5),
+          UL64(0x85747461A193B08E), UL64(0xF5840DAA5ADC3541),
+          UL64(0xC11D0C44DB369FDA), UL64(0x3AB14AD9AD759205),
+          UL64(0x533F9A3D038FAFA2), UL64(0xFDDF6553FDE3F704) },
+        { UL64(0xBEAF69902915A4C6), UL64(0xD5DBC04D37C31C11),
+          UL64(0xA7A72ABA281FCBC8), UL64(0xA178F28D3F4AE621),
+          UL64(0x23DDDC769B8D0895), UL64(0x88AED78493B206D0),
+          UL64(0x6EE61A090E32A4E4), UL64(0x1D482E3B262F03F4) },
+        { UL64(0x22C49EC9B809B7CE), UL64(0x8A41486BE2C72C2C),
+          UL64(0x813B9420FEA0BF36), UL64(0xB3D36EE9A66DAC69),
+          UL64(0x6FDDC08A328CC987), UL64(0x0A3BCD2C3A326461),
+          UL64(0x7103C49DD810DBBA), UL64(0xF9D81A284B78A4C4) },
+        { UL64(0xFED1D8E8DD180B99), UL64(0xDD8C333FD33A3949),
+          UL64(0xCDDFDF2DB9B72399), UL64(0xADA6E53E8C785526),
+          UL64(0xA0DFBFEDC1BDE1B4), UL64(0xC7436B812477D54E),
+          UL64(0x27ECD641E73245E8), UL64(0xB68F77F1E097CC90) },
+        { UL64(0x1AA3621E2B625C66), UL64(0x48DC5DAEA9EAE50F),
+          UL64(0x5706ACC27D52A158), UL64(0x0A1551A2A991A25C),
+          UL64(0x4654046A970DB4EB), UL64(0x2BBE4D4D35FF7E4B),
+          UL64(0xD9856AE718A62FB9), UL64(0xACA0160410A7D38E) },
+        { UL64(0x6BA0BBEB7A76DB89), UL64(0x1BC5C3BD13352AF5),
+          UL64(0xB83EFE18DD44BD08), UL64(0x4BD6BEA78DD82449),
+          UL64(0x4A973124DAF9D90E), UL64(0x6EDB890C3332D84C),
+          UL64(0xC23E39E69BBB841B), UL64(0xC38F354507AE3E6D) },
+        { UL64(0x3DE865ADE4D55941), UL64(0xDEDAFA5E30384087),
+          UL64(0x6F414ABB4EF18B9B), UL64(0x9EE9EA42FAEE5268),
+          UL64(0x260FAA1637A55A4A), UL64(0xEB19A514015F93B9),
+          UL64(0x51D7EBD29E9C3598), UL64(0x523FC56D1932178E) },
+        { UL64(0x9FC6DD089ACFF1C8), UL64(0x20E8AC2F9B25B60D),
+          UL64(0x222930ABD4D95C4C), UL64(0x1E77B04E15B2507B),
+          UL64(0x7A6B88192D9CDAEB), UL64(0xF15D4D183197793A),
+          UL64(0x38702A721CED4B92), UL64(0x948D92B037EA9334) },
+        { UL64(0xDAF89FA316F39D1D), UL64(0x4FDFECA360286F51),
+          UL64(0x1D37C5E979053AD2), UL64(0xDEA70E301958FA40),
+          UL64(0xD00A96EF251FE67C), UL64(0xD8C01A2BEB94BE74),
+          UL64(0x0E2A44380CFD4B75), UL64(0x871BC7B285BDF22C) },
+        { UL64(0x9FFF94283C8622F4), UL64(0xB76E328F8C468440),
+          UL64(0x60C5E19731AE0F70), UL64(0xF86DD177EC729CBC),
+          UL64(0x21813530F3F497A2), UL64(0x7F3192C15920FEE7),
+          UL64(0x0E0F0C31E1C51EE5), UL64(0xF336CD7322F4DD10) },
+        { UL64(0x501D070CB98FE684), UL64(0xD60FBE9A124A1458),
+          UL64(0xA45761C892BC6B3F), UL64(0xF5384858FE6F27CB),
+          UL64(0x4B0271F7B59E763B), UL64(0x3D4606A95B5A8E5E),
+          UL64(0x1EDA5D9B05A48292), UL64(0xDA7731D0E6FEC446) },
+        { UL64(0x277B5177EB18FF20), UL64(0x48002E9828F06D62),
+          UL64(0xECE8D6C30E506D8D), UL64(0x5CDE0A58CD9FF963),
+          UL64(0x3B97CDB74E3BAA0E), UL64(0x50560C0B631238F9),
+          UL64(0xE1C31B35CF79793D), UL64(0x95D12F14355E2178) },
+        { UL64(0x3D21B9C32F428837), UL64(0x73C96B1E0F3402BF),
+          UL64(0x6CF7BFC9424FF39E), UL64(0xCA2DA459F6D0D696),
+          UL64(0x3CF1D69D3BB8154E), UL64(0xC2429B165430EDB4),
+          UL64(0xD3C6478A15D0D375), UL64(0x5E33067F7DE4376B) },
+        { UL64(0x378C305DCB205962), UL64(0xE1409F9D3D04599A),
+          UL64(0x84ECBA278057C1B2), UL64(0xCC92ACE7A2BD80B1),
+          UL64(0xCB5311DB4CC4C760), UL64(0x18F0CE63466D8EFE),
+          UL64(0x0DA0EB1B087249EE), UL64(0x7D47E3FB56FBDEF3) },
+        { UL64(0xA3E3369390D45871), UL64(0xE976404006166D8D),
+          UL64(0xB5C3368289A90403), UL64(0x4BD1798372F1D637),
+          UL64(0xA616679ED5D2C53A), UL64(0x5EC4BCD8FDCF3B87),
+          UL64(0xAE6D7613B66A694E), UL64(0x7460FC76E3FC27E5) },
+    },
+    {
+        { UL64(0x80531FE1C63C4962), UL64(0x50541E89981FDB25),
+          UL64(0xDC1291A1FD4C2B6B), UL64(0xC0693A17A6DF4FCA),
+          UL64(0xB2C4604E0117F203), UL64(0x245F19630A99B8D0),
+          UL64(0xAEDC20AAC6212C44), UL64(0xB1ED4E56520F52A8) },
+        { UL64(0xB5560FB6700A1ACD), UL64(0xE823FD73FD999681),
+          UL64(0xDA915D1F6CB4E1BA), UL64(0x0D0301186EBE00A3),
+          UL64(0x744FB0C989FCA8CD), UL64(0x970D01DBF9DA0E0B),
+          UL64(0x0AD8C5647931D76F), UL64(0xB15737BFF659B96A) },
+        { UL64(0x18F37A9C6BDF22DA), UL64(0xEFBC432F90DC82DF),
+          UL64(0xC52CEF8E5D703651), UL64(0x82887BA0D99881A5),
+          UL64(0x7CEC9DDAB920EC1D), UL64(0xD0D7E8C3EC3E8D3B),
+          UL64(0x445BC3954CA88747), UL64(0xEDEAA2E09FD53535) },
+        { UL64(0xA12B384ECE53C2D0), UL64(0x779D897D5E4606DA),
+          UL64(0xA53E47B073EC12B0), UL64(0x462DBBBA5756F1AD),
+          UL64(0x69FE09F2CAFE37B6), UL64(0x273D1EBFECCE2E17),
+          UL64(0x8AC1D5383CF607FD), UL64(0x8035F7FF12E10C25) },
+        { UL64(0xB7D4CC0F296C9005), UL64(0x4B9094FA7B0AEBDB),
+          UL64(0xE1BF10F1C00EC8D4), UL64(0xD807B1C4D667C101),
+          UL64(0xA9412CDFBE713383), UL64(0x435E063E81142BA1),
+          UL64(0x984C15ECAF0A6BDC), UL64(0x592C246092A3DAB9) },
+        { UL64(0xCA442D5A2093C22A), UL64(0xEBD0BD31D5703AED),
+          UL64(0x308F2AFD653287B6), UL64(0x9BB88BAC0D1BC8BA),
+          UL64(0xFBAF853875C1E3B2), UL64(0xBD2AC950CA11447C),
+          UL64(0x286D816CEA5C4C8D), UL64(0xDC3AA80028DC3208) },
+        { UL64(0x9365690016E23E9D), UL64(0xCB220C6BA7CC41E1),
+          UL64(0xB36B20C369D6245C), UL64(0x2D63C348B62E9A6A),
+          UL64(0xA3473E19CDC0BCB5), UL64(0x70F18B3F8F601B98),
+          UL64(0x8AD7A2C7CDE346E4), UL64(0xAE9F6EC3BD3AAA64) },
+        { UL64(0x854D34C77E6C5520), UL64(0xC27DF9EFDCB9EA58),
+          UL64(0x405F2369D686666D), UL64(0x29D1FEBF0417AA85),
+          UL64(0x9846819E93470AFE), UL64(0x3E6A9669E2A27F9E),
+          UL64(0x24D008A2E31E6504), UL64(0xDBA7CECF9CB7680A) },
+        { UL64(0x030223503274C7E1), UL64(0x61EE8C934C4B6C26),
+          UL64(0x3C4397E3199389CE), UL64(0xE0082600488757CE),
+          UL64(0xAAC3A2DF06B4DAFB), UL64(0x45AF0700DDFF5B6A),
+          UL64(0x0A5974248C1D9FA0), UL64(0x1640087D391FC68B) },
+        { UL64(0x26A43E41D07FA53D), UL64(0x3154A78A74E35BC5),
+          UL64(0x7B768924E0DA2F8C), UL64(0xBA964A2B23613F9A),
+          UL64(0x5A548D35BA1D16C4), UL64(0x2E1BFED1FB54D057),
+          UL64(0xFF992136BC640205), UL64(0xF39CB9148156DF29) },
+        { UL64(0xF4873FCF4E5548BD), UL64(0x8725DA3F03CE57F0),
+          UL64(0xD82F5C95CA953258), UL64(0xAC647F127CF0747E),
+          UL64(0xFF2038B02D570BD5), UL64(0xB0C2A767A13AE03F),
+          UL64(0xEBAA27CDE9932D16), UL64(0xA686E3FC1234E901) },
+        { UL64(0xC913E64699B444AD), UL64(0xDDFCE99DC40504C5),
+          UL64(0x58482A99D42E53DB), UL64(0x9AAF2C25D1AFF537),
+          UL64(0xEE90F7962664CF67), UL64(0x74AB5C99F1393E2B),
+          UL64(0xFAD0FAEAE6225BB0), UL64(0xC355648C2D63DD6C) },
+        { UL64(0x9F80435E63261ECC), UL64(0x6302A62E4337D6C9),
+          UL64(0x91916A49CA4958A0), UL64(0x554958993149D5D3),
+          UL64(0x378D020B9F91DE3C), UL64(0x47B839A34DD25170),
+          UL64(0x2825854138B7F258), UL64(0xEA5B14F7437E7DEC) },
+        { UL64(0xE4E31D271D91CF9D), UL64(0xCB35D4FDB377B20A),
+          UL64(0x74DE1E45055E1327), UL64(0x3298E31B28703E75),
+          UL64(0x55087237DE013339), UL64(0x32CBF30123D101C6),
+          UL64(0xC70DBA22E8AAB0DC), UL64(0x4A52623D3D155BB9) },
+        { UL64(0x74F08736B0018F44), UL64(0xF4A03417B446D0F5),
+          UL64(0x66A4AA2FA40CA6B2), UL64(0x215679F0BADB60ED),
+          UL64(0x3871195A323E4EEF), UL64(0x8F0940C320952B16),
+          UL64(0xFE8DAC62879D5F7D), UL64(0x649CB623C1A6E875) },
+        { UL64(0xECAFF541338D6E43), UL64(0x56F7DD734541D5CC),
+          UL64(0xB5D426DE96BC88CA), UL64(0x48D94F6B9ED3A2C3),
+          UL64(0x6354A3BB2EF8279C), UL64(0xD575465B0B1867F2),
+          UL64(0xEF99B0FF95225151), UL64(0xF3E19D88F94500D8) },
+        { UL64(0xA26A9087133EC108), UL64(0x5DC5699F2712BDC0),
+          UL64(0x96903F4DD14224A9), UL64(0x3DA5992429E47B80),
+          UL64(0xB717712FF9DBBA5A), UL64(0x9E52004B756391C9),
+          UL64(0xE669A11DCC9D219C), UL64(0x3B6E6B84D1D6C07D) },
+        { UL64(0xDBF435ACC85DCF57), UL64(0x61745658C88F5415),
+          UL64(0x26367E9A17C55807), UL64(0x22D077A5CA90C56F),
+          UL64(0xFBF72258A2E04E76), UL64(0xBA965D3E6E06E405),
+          UL64(0x5724D06FE3E6F954), UL64(0x3E47D47581251A74) },
+        { UL64(0x5FEEC06A676FEADB), UL64(0xFC449BC59D69F322),
+          UL64(0x1D8D7B5E7CDA8895), UL64(0x5ED54DC11A3314A7),
+          UL64(0x1A11D2AE6DE889C0), UL64(0xB2A979724CED2BD9),
+          UL64(0x6ECF6989306A5EF6), UL64(0x1611D57B8CC8A249) },
+        { UL64(0xB8BA0151E0FB82F7), UL64(0x0D160726D5668AC2),
+          UL64(0x622BA25814D711B0), UL64(0x6ADDF5577F3FE2F2),
+          UL64(0x2B831E1C6B9C9435), UL64(0xCE3A060AB73826BD),
+          UL64(0x93FA11C11C240F89), UL64(0x4F9CC8D8956E303A) },
+        { UL64(0x2D9942BA007CBF87), UL64(0x4E62BCE6DF3FC926),
+          UL64(0xE7EEE5B0E4560AFF), UL64(0xE51963BB7CB009B7),
+          UL64(0xAA5118CEE29B37DD), UL64(0x5CD84A4747263903),
+          UL64(0x3050CAA6620055D8), UL64(0x7EF576A76C4B1E3D) },
+        { UL64(0x4B9331F6641F82C9), UL64(0xD97C7C54DFFEC756),
+          UL64(0xF5EE6D1F1A9158AB), UL64(0x054493A385C3DA7F),
+          UL64(0xA57A05F5EB7D96DF), UL64(0xA3AFD447E4473A39),
+          UL64(0x42A4D9C488E16D55), UL64(0x83E144F5F5F876AE) },
+        { UL64(0x9026A4DDE6008FF1), UL64(0x49E995AD1C8CD96C),
+          UL64(0x80722E73503E589B), UL64(0x05BCBCE184C2BC26),
+          UL64(0x255F9ABBD4682C2C), UL64(0xC42BCFC2F084D456),
+          UL64(0xA0EAE9B0641C0767), UL64(0x1B45632D864C9A2D) },
+        { UL64(0x92A83268E32DD620), UL64(0x913EC99F627849A2),
+          UL64(0xEDD8FDFA2C378882), UL64(0xAF96F33EEE6F8CFE),
+          UL64(0xC06737E5DC3FA8A5), UL64(0x236BB531B0B03A1D),
+          UL64(0x33E59F2989F037B0), UL64(0x13F9B5A7D9A12A53) },
+        { UL64(0xCF25793B6AE024E0), UL64(0x1B6607B484B5C4B0),
+          UL64(0x9579FA903F1624C8), UL64(0x37FB65BE68BD57E8),
+          UL64(0xD693A55EFC39C203), UL64(0x4E267AC4C87252E9),
+          UL64(0xB8D78BB09F899413), UL64(0xE4C014070B3B8508) },
+        { UL64(0x50D8AE9559029AA6), UL64(0xD74E292C5A4DB2ED),
+          UL64(0x0B9C3355848F373D), UL64(0xEC018DB6AC45AB38),
+          UL64(0x1F44690269CC53A8), UL64(0x8C4B628D1A879864),
+          UL64(0x1C743D284B13475E), UL64(0xBF4A933873DE19F6) },
+        { UL64(0x662906E5BC3F3553), UL64(0xDE38D53531459684),
+          UL64(0x8F46A8C634F7280D), UL64(0xAAF91B873D24198E),
+          UL64(0xECD5EE115F9B117E), UL64(0xCE00FFBE50AE8DDA),
+          UL64(0x263A3D4E7710A9AE), UL64(0x0FF3F721F26BA74F) },
+        { UL64(0x4A8A4F47F0CEFA69), UL64(0xDC8E4CBAA4546866),
+          UL64(0x359BA69B23F603C1), UL64(0xDAB4D601187B7AC5),
+          UL64(0xA6CA4337C1EBC8D9), UL64(0x9FA6585452B4074B),
+          UL64(0x1A4B4F81902FB733), UL64(0xD2BB5D7AA525DEAA) },
+        { UL64(0xCC287AC2E6B3577A), UL64(0xD7528CA7F612003B),
+          UL64(0x8AFDB6F12C1400B8), UL64(0x103A2ED346A2DD8D),
+          UL64(0xC8F8C54D2EE21339), UL64(0x8F011B92355A2D20),
+          UL64(0x81C6FC9F1346F2AC), UL64(0xDB6042F005A6D24B) },
+        { UL64(0xEB2E92D5F81F9567), UL64(0x54CB95EA4D698470),
+          UL64(0x5F2ACB28E04C81EB), UL64(0x1C1EBFC4F8CEEC64),
+          UL64(0x8F799FAC06E07423), UL64(0x72225F9937FA0C85),
+          UL64(0xB0CD861634F4DB44), UL64(0x5EC36159752C9091) },
+        { UL64(0xFC90E3630DA4F996), UL64(0x8CECA49DAA6D6FE4),
+          UL64(0x1084AFFDBDFC619B), UL64(0x2029F672C1140B04),
+          UL64(0x606EC25F136F3E5E), UL64(0x6D24149B02224C4A),
+          UL64(0xABB0F142CFDFCF4C), UL64(0xE40D0419FAB1A0ED) },
+        { UL64(0x0D0DF6CE51EFB310), UL64(0xCB5B2EB4958DF5BE),
+          UL64(0xD6459E2936158E59), UL64(0x82AAE2B91466E336),
+          UL64(0xFB658A39411AA636), UL64(0x7152ECC5D4C0A933),
+          UL64(0xF10C758A49F026B7), UL64(0xF4837F97CB09311F) },
+    },
+    {
+        { UL64(0x994F523A626332D5), UL64(0x7BC388335561BB44),
+          UL64(0x005ED4B03D845EA2), UL64(0xD39D3EE1C2A1F08A),
+          UL64(0x6561FDD3E7676B0D), UL64(0x620E35FFFB706017),
+          UL64(0x36CE424FF264F9A8), UL64(0xC4C3419FDA2681F7) },
+        { UL64(0x00F831769BB81648), UL64(0xD69EB485653120D0),
+          UL64(0xD17D75F44CCABC62), UL64(0x34A07F82B749FCB1),
+          UL64(0x2C3AF787BBFB5554), UL64(0xB06ED4D062E283F8),
+          UL64(0x5722889FA19213A0), UL64(0x162B085EDCF3C7B4) },
+        { UL64(0x36D90DDAEB300F7A), UL64(0x9DCF7DFCEDB5E801),
+          UL64(0x645CB26874D5244C), UL64(0xA127EE79348E3AA2),
+          UL64(0x488ACC53575F1DBB), UL64(0x95037E8580E6161E),
+          UL64(0x57E59283292650D0), UL64(0xABE67D9914938216) },
+        { UL64(0x32670D2F7189E71F), UL64(0xC64387485ECF91E7),
+          UL64(0x15758E57DB757A21), UL64(0x427D09F8290A9CE5),
+          UL64(0x846A308F38384A7A), UL64(0xAAC3ACB4B0732B99),
+          UL64(0x9E94100917845819), UL64(0x95CBA111A7CE5E03) },
+        { UL64(0xEB81AA377378058E), UL64(0x41C746A104411154),
+          UL64(0xA10C73BCFB828AC7), UL64(0x6439BE919D972B29),
+          UL64(0x4BF3B4B043A2FBAD), UL64(0x39E6DADF82B5E840),
+          UL64(0x4F7164086397BD4C), UL64(0x0F7DE5687F1EECCB) },
+        { UL64(0xDB332A73F37EC3C3), UL64(0xC65259BDDD59EBA0),
+          UL64(0x2291709CDB4D3257), UL64(0x9A793B25BD389390),
+          UL64(0xF39FE34BE43756F0), UL64(0x2F76BDCE9AFB56C9),
+          UL64(0x9F37867A61208B27), UL64(0xEA1D4307089972C3) },
+        { UL64(0xD0A744878A429F4F), UL64(0x0649712BDB516609),
+          UL64(0xB826BA57E769B5DF), UL64(0x82335DF21FC7AAF2),
+          UL64(0x2389F0675C93D995), UL64(0x59AC367A68677BE6),
+          UL64(0xA77985FF21D9951B), UL64(0x038956FB85011CCE) },
+        { UL64(0x97B7851AAACA5E9B), UL64(0x518AA52156713B97),
+          UL64(0x3357E8C7150A61F6), UL64(0x7842E7E2EC2C2B69),
+          UL64(0x8DFFAF656868A548), UL64(0xD963BD82E068FC81),
+          UL64(0x64DA5C8B65917733), UL64(0x927090FF7B247328) },
+        { UL64(0xD6FFDB942F6D0D97), UL64(0x05C3EE41443B9373),
+          UL64(0xB2E541EBFFD36DB6), UL64(0xB7415A96CE1DCC3E),
+          UL64(0xE383682E163AA2F6), UL64(0x46FEBDD42F3AF218),
+          UL64(0x90A0507EBAFDBADB), UL64(0x4CA8AB4DCE52E21A) },
+        { UL64(0xA3F0832E1B7CFB73), UL64(0x7A8AFE523EC354C9),
+          UL64(0xAE91C97E378EADCA), UL64(0x7449C599AC3B32BB),
+          UL64(0xA619C3710B1C4655), UL64(0x692E4C6AF79DA87E),
+          UL64(0xFF3F5D86DE38D96A), UL64(0xC5320F421C08C0EC) },
+        { UL64(0x92A6F2BC8FEC5DEC), UL64(0xA71383FF84D6786C),
+          UL64(0x87588C06DBFFA084), UL64(0x0D85F5CA6857E715),
+          UL64(0xE87311B3B6C774D4), UL64(0x672357C84C3521A8),
+          UL64(0xE5FE74615B29FE0F), UL64(0x02BC51105B7158CD) },
+        { UL64(0x37A01E48A105FC8E), UL64(0x769D754A289BA48C),
+          UL64(0xC08C6FE1D51C2180), UL64(0xB032DD33B7BD1387),
+          UL64(0x953826DB020B0AA6), UL64(0x05137E800664C73C),
+          UL64(0xC66302C4660CF95D), UL64(0x99004E11B2CEF28A) },
+        { UL64(0x824F5B284F973536), UL64(0xB43E299ED35B04EA),
+          UL64(0xC72C88F74DA03089), UL64(0x8269D57A45A2E42C),
+          UL64(0x7C1E63FC6607B38E), UL64(0xE89E2AAF29390B0C),
+          UL64(0xC7C740DA1BEE2869), UL64(0x8556F6FCAF3FB974) },
+        { UL64(0x1A0A3995A4B6BED1), UL64(0x2DAB579597095C54),
+          UL64(0x06C6A1FF2AA73CE9), UL64(0xADD0A54B4DE438A7),
+          UL64(0x160B6B1AFCA906CD), UL64(0x25FC601629DE10DD),
+          UL64(0x348E9C99D3633DA3), UL64(0x1FE3F746158A4D5A) },
+        { UL64(0xC253EDC88BE85C1D), UL64(0xDD3D0E483CA09CB6),
+          UL64(0xB997F6879AE3055A), UL64(0x0C929AD007431DBF),
+          UL64(0xCEF1621584D2DB42), UL64(0xB50DF3EF078828CD),
+          UL64(0x4589DA9D6DBD4B66), UL64(0xBC4FD2E3D99C2B04) },
+        { UL64(0x214BC9A7D298C241), UL64(0xE3B697BA56807CFD),
+          UL64(0xEF1C78024564EADB), UL64(0xDDE8CDCFB48149C5),
+          UL64(0x946BF0A75A4D2604), UL64(0x27154D7F6C1538AF),
+          UL64(0x95CC9230DE5B1FCC), UL64(0xD88519E966864F82) },
+        { UL64(0x9901A9EA6286BC77), UL64(0x249DFE5869794DB0),
+          UL64(0xC4370BBDBBA6CD21), UL64(0x718F813121FC5E6B),
+          UL64(0x9CDFEDBD22C78B61), UL64(0x4B313EECD9D43D71),
+          UL64(0x4144031F19BB1B22), UL64(0x974973AB07A33158) },
+        { UL64(0x67AADEF406366526), UL64(0xD7D53019AE535D96),
+          UL64(0x72FADBA7E3A2EBC6), UL64(0xA32313A575269D16),
+          UL64(0x97FA1A69B50D922E), UL64(0x4C6E28CFCA202B45),
+          UL64(0xB7BD110068100B91), UL64(0xE02E418D73C96A5D) },
+        { UL64(0xFA9E6EDC8E805546), UL64(0xC0E0E67882639840),
+          UL64(0x430858A4B7BE643D), UL64(0x1D42241418CF5F1E),
+          UL64(0x05990C629FEF49AF), UL64(0x4846E0CD5EC31D32),
+          UL64(0x46DB47A8BABF85D4), UL64(0x5F66C9F1AA759F7F) },
+        { UL64(0x1013E4F796EA6CA1), UL64(0x567CDC2A1F792871),
+          UL64(0xADB728705C658D45), UL64(0xF7C1FF4ACE600E98),
+          UL64(0xA1BA86574B6CAD39), UL64(0x3D58D634BA20B428),
+          UL64(0xC0011CDEA2E6FDFB), UL64(0xA832367A7B18960D) },
+        { UL64(0xB7392C8F50521507), UL64(0xACB3914BE5EF2E9D),
+          UL64(0x9A70B178EA446F85), UL64(0xBD4C43A698D8C3EE),
+          UL64(0xA973BBE5844C0177), UL64(0x299B274D062AB3EA),
+          UL64(0x26BA0E7C856ADAAF), UL64(0x139B9194765CB2B8) },
+        { UL64(0x7B21E79BBD9FD387), UL64(0xB48F769A241C0C71),
+          UL64(0x83E368368B725A93), UL64(0xEF9D4F551F5B96E1),
+          UL64(0xC67139A42A9910A0), UL64(0x71E1C8A24E095E76),
+          UL64(0x212F7F362719B8F2), UL64(0x9F75EB3F00FA1217) },
+        { UL64(0x4E118E6E343E6DB6), UL64(0x98BD555925B6993F),
+          UL64(0xB40DD514B32EFA85), UL64(0x7E3055807A24E3A1),
+          UL64(0x7DCC9550775857C3), UL64(0x056311122C9BC1B0),
+          UL64(0x6EAE85D502A5DCE9), UL64(0xE53FC9AA34EB4172) },
+        { UL64(0x47618C9F0E4938F7), UL64(0x58D47D69DC83719E),
+          UL64(0xD74C1A23F41A64CC), UL64(0x5D28E068B5829F66),
+          UL64(0xD8D37529210466F6), UL64(0x2AF1152FC6A64EF8),
+          UL64(0x55D4485C19CE6A7A), UL64(0x6D0BD2F5F648E2D7) },
+        { UL64(0xF02D6AB1F89DB521), UL64(0x46F41AFC650CEDC6),
+          UL64(0xB1BC73961C8ADF71), UL64(0xD2147FCB7EBDB1B9),
+          UL64(0xCAAF0EF7C1080363), UL64(0xF90B1AF3D95C09C5),
+          UL64(0x7AAFBFD4F6F44883), UL64(0x9B64E0878A8D9B6D) },
+        { UL64(0xEEFC9CE8BD356AE5), UL64(0x3D98A6C02ED25AF4),
+          UL64(0x3173F5646319D884), UL64(0x2B2DED64CA6C4F16),
+          UL64(0xE27B19E5CE6DFCD0), UL64(0xA369BC5FA0D887CA),
+          UL64(0x59C2606E07463710), UL64(0x15C1112AF3C6E74E) },
+        { UL64(0x4ABA30007E7A13A0), UL64(0xF483BB4789BBAAF5),
+          UL64(0x7C0D50F69FFD273F), UL64(0x7E63C191F4A4D692),
+          UL64(0x8BDA344042F2D6E6), UL64(0xD7CFCDC2938B72C6),
+          UL64(0xD28AFBD26F6E54E9), UL64(0xD40423B6C28B3FE5) },
+        { UL64(0x1ECC032AF416448D), UL64(0x4A7E8C10EC76D971),
+          UL64(0x854F9805B90B6EAE), UL64(0xFD0B15324BED0594),
+          UL64(0x89F71848D98B5CA3), UL64(0xD01FE5FCF039B3EF),
+          UL64(0x4481332E627BDA2E), UL64(0xE67CECD7A5073E41) },
+        { UL64(0x2E6916468A9CECCD), UL64(0xCC92EBCC053A6DA1),
+          UL64(0xA80076B8783A6B64), UL64(0x42D0E8A0A5992FA2),
+          UL64(0xD9C71C537C56EC30), UL64(0x388B6A966B6BC769),
+          UL64(0xA0C233ABD3BF9FC7), UL64(0xD0F55BD02FC45369) },
+        { UL64(0xA72C33023292EEF9), UL64(0x0F5A40369F8C1116),
+          UL64(0x429E6EF03E96A791), UL64(0x60EB6181F3843939),
+          UL64(0xAF49F083902518D3), UL64(0xFE65C013B9E8390B),
+          UL64(0x7AB97CB3EC4D34A4), UL64(0x72427A088B4F853D) },
+        { UL64(0x3883FC682EFEAD1F), UL64(0xDD7224A1FC4D8D68),
+          UL64(0x5C4E844C9F1DAFDD), UL64(0x7F40D18E15119B7D),
+          UL64(0x79C6D14CB7C268EB), UL64(0x65B4C855C2AE89E1),
+          UL64(0x3508BB997CB0D9A2), UL64(0xBC2C635B2EC64A5B) },
+        { UL64(0xB828DD1A7CB1282C), UL64(0xA08D7626BE46973A),
+          UL64(0x6BAF8D40E708D6B2), UL64(0x72571FA14DAEB3F3),
+          UL64(0x85B1732FF22DFD98), UL64(0x87AB01A70087108D),
+          UL64(0xAAAAFEA85988207A), UL64(0xCCC832F869F00755) },
+    },
+    {
+        { UL64(0x488F1185CA8D9D1A), UL64(0xADF2C77DD987DED2),
+          UL64(0x5F3039F060C46124), UL64(0xE5D70B7571E095F4),
+          UL64(0x82D586506260E70F), UL64(0x39D75EA7F750D105),
+          UL64(0x8CF3D0B175BAC364), UL64(0xF3A7564D21D01329) },
+        { UL64(0xB24AA43E3FCD3EFC), UL64(0xDD26C034B8088E9A),
+          UL64(0xA5EF4DC9BD3D46EA), UL64(0xA2F99D588A4C6A6F),
+          UL64(0xDDABD3552F1DA46C), UL64(0x72C3F8CE1AFACDD1),
+          UL64(0xD90C4EEE92D40578), UL64(0xD28BB41FCA623B94) },
+        { UL64(0x242792D2E7417CE1), UL64(0xFF42BC71970EE7F5),
+          UL64(0x1FF4DC6D5C67A41E), UL64(0x77709B7B20882A58),
+          UL64(0x3554731DBE217F2C), UL64(0x2AF2A8CD5BB72177),
+          UL64(0x58EEE769591DD059), UL64(0xBB2930C94BBA6477) },
+        { UL64(0x1E6ADDDAF176F2C0), UL64(0x01CA4604E2572658),
+          UL64(0x0A404DED85342FFB), UL64(0x8CF60F96441838D6),
+          UL64(0x9BBC691CC9071C4A), UL64(0xFD58874434442803),
+          UL64(0x97101C85809C0D81), UL64(0xA7FB754C8C456F7F) },
+        { UL64(0x6AF7A1D5AF71013F), UL64(0xE68216E50BEDC946),
+          UL64(0xF4CBA30BD27370A0), UL64(0x7981AFBF870421CC),
+          UL64(0x02496A679449F0E1), UL64(0x86CFC4BE0A47EDAE),
+          UL64(0x3073C936B1FECA22), UL64(0xF569461203F8F8FB) },
+        { UL64(0xBCADD6715BDE48F8), UL64(0xC97038732189BC7D),
+          UL64(0x5D45299EC709EE8A), UL64(0xD1287EE2845AAFF8),
+          UL64(0x7D1F8874DB1DBF1F), UL64(0xEA46588B990C88D6),
+          UL64(0x60BA649A84368313), UL64(0xD5FDCBCE60D543AE) },
+        { UL64(0xCF3DE9959890272D), UL64(0x75F3432A3E713A10),
+          UL64(0x5E13479FE28227B8), UL64(0xB8561EA9FEFACDC8),
+          UL64(0xA6A297A08332AAFD), UL64(0x9B0D8BB573809B62),
+          UL64(0xD2FA1CFD0C63036F), UL64(0x7A16EB55BD64BDA8) },
+        { UL64(0xF7E48E8A2AC13E27), UL64(0x4494F6DF4EB1A9F5),
+          UL64(0xEDBF84EB981F0A62), UL64(0x49BADC32536438F0),
+          UL64(0x50BEA541004F7571), UL64(0xBAC67D10DF1C94EE),
+          UL64(0x253D73A1B727BC31), UL64(0xB3D01CF230686E28) },
+        { UL64(0xA40BC039306A5A3B), UL64(0x4E0A41FD96783A1B),
+          UL64(0xA1E8D39A0253CDD4), UL64(0x6480BE26C7388638),
+          UL64(0xEE365E1D2285F382), UL64(0x188D8D8FEC0B5C36),
+          UL64(0x34EF1A481F0F4D82), UL64(0x1A8F43E1A487D29A) },
+        { UL64(0xA5A8147C3902DDA5), UL64(0x35D2F706FE6973B4),
+          UL64(0x5AC2EFCFC257457E), UL64(0x933F48D48700611B),
+          UL64(0xC365AF884912BEB2), UL64(0x7F5A4DE6162EDF94),
+          UL64(0xC646BA7C0C32F34B), UL64(0x632C6AF3B2091074) },
+        { UL64(0x10F6A3339BB26F5F), UL64(0x1E85DB8E044D85B6),
+          UL64(0xC3697A0894197E54), UL64(0x65E18CC0A7CB4EA8),
+          UL64(0xA38C4F50A471FE6E), UL64(0xF031747A2F13439C),
+          UL64(0x53C4A6BAC007318B), UL64(0xA8DA3EE51DECCB3D) },
+        { UL64(0xBFC01ADF5CA48F3F), UL64(0x64352F06E22A9B84),
+          UL64(0xCEE54DA1C1099E4A), UL64(0xBBDA54E8FA1B89C0),
+          UL64(0x166A3DF56F6E55FB), UL64(0x1CA44A2420176F88),
+          UL64(0x936AFD88DFB7B5FF), UL64(0xE34C24378611D4A0) },
+        { UL64(0x5F24416D3E554892), UL64(0x8413B53D430E2A45),
+          UL64(0x99C56AEE9032A2A0), UL64(0x09432BF6EEC367B1),
+          UL64(0x552850C6DAF0ECC1), UL64(0x49EBCE555BC92048),
+          UL64(0xDFB66BA654811307), UL64(0x1B84F7976F298597) },
+        { UL64(0xD5B5D9EB70F8D5A4), UL64(0x375ADDE7D7BBB228),
+          UL64(0x31E88B860C1C0B32), UL64(0xD1F568C4173EDBAA),
+          UL64(0x1592FC835459DF02), UL64(0x2BEAC0FB0FCD9A7E),
+          UL64(0xB0A6FDB81B473B0A), UL64(0xE3224C6F0FE8FC48) },
+        { UL64(0xA1A5C8455777E189), UL64(0xCC10BEE0456F2829),
+          UL64(0x8AD95C56DA762BD5), UL64(0x152E2214E9D91DA8),
+          UL64(0x975B0E727CB23C74), UL64(0xFD5D7670A90C66DF),
+          UL64(0xB5B5B8AD225FFC53), UL64(0xAB6DFF73FADED2AE) },
+        { UL64(0xD433E50F6D3549CF), UL64(0x6F33696FFACD665E),
+          UL64(0x695BFDACCE11FCB4), UL64(0x810EE252AF7C9860),
+          UL64(0x65450FE17159BB2C), UL64(0xF7DFBEBE758B357B),
+          UL64(0x2B057E74D69FEA72), UL64(0xD485717A92731745) },
+        { UL64(0x8D6D7684B376D7EF), UL64(0x3DBF02AC48D5DA81),
+          UL64(0xFAA5385A1B89139C), UL64(0x504DCB856820A7CE),
+          UL64(0xC0982145E61A9D26), UL64(0xF35C6C32AC5D25AF),
+          UL64(0xAA3BA2674E27B3C2), UL64(0x2E69A3A09F6C7AC5) },
+        { UL64(0x906A5C1DF30B86CF), UL64(0xB16F66FC4D07EF87),
+          UL64(0xA975C2DAD4012261), UL64(0xE69748E60FBC361E),
+          UL64(0xA2A035362D9900C7), UL64(0x1F2A3CE17CF6AA0F),
+          UL64(0x80D5443AA1E33887), UL64(0x6ADA248B5B47B4DF) },
+        { UL64(0x1F9FBB08DD3C721A), UL64(0x93A1F97E46B2229C),
+          UL64(0x4EE5AD4631BA7EFB), UL64(0x6BAA5CA5F3AE10A3),
+          UL64(0x7D81FC3E746C0204), UL64(0x9ECC90F02B9A060B),
+          UL64(0xDB58162F7B688CA7), UL64(0xF4772A99F554C1DF) },
+        { UL64(0xEDB24E7C67DC4BF4), UL64(0xCBE4C743AA4A827B),
+          UL64(0x229472F5FACFF82B), UL64(0x2CEFBB82CF2C4A9B),
+          UL64(0x386E06B859367FF1), UL64(0x32245978A3CDAF75),
+          UL64(0x2DBDD36D9807B198), UL64(0x437495E7B78511E9) },
+        { UL64(0x34166E6577DDA727), UL64(0xB6A4A3C13EAAAACF),
+          UL64(0x9CCD49C29D2C6240), UL64(0xC2E17F3DA42BA163),
+          UL64(0x91F9EB5C7C6D2133), UL64(0x85CEBD2AE6A97606),
+          UL64(0x806E35BD65B00DFB), UL64(0x9E9F7906B9392A82) },
+        { UL64(0x239F298A4D0D2B3B), UL64(0x6C9760CFDBB207F1),
+          UL64(0xC8BF203FD4F92EEB), UL64(0x290B2AE47EA74E9B),
+          UL64(0x1FA69337163A7D3D), UL64(0xD0295EE887EFA414),
+          UL64(0x54844037F9F8273F), UL64(0x3046A862E341AB58) },
+        { UL64(0xFB9FE95338C6FC0B), UL64(0xE494E2E8AC9579C8),
+          UL64(0xC424EF6F69D7CA8B), UL64(0x630E52154FB857EC),
+          UL64(0xF013112B42E2DF48), UL64(0xEFADC908625204BF),
+          UL64(0x7D8BB16C1163B0CE), UL64(0xDF5147E3B7146889) },
+        { UL64(0x5B378B05A2BF75AD), UL64(0xFE374B6625DA1E92),
+          UL64(0xFB4C8100FF766712), UL64(0xBC606380CBC84660),
+          UL64(0x27266EC96C10ADE4), UL64(0xB46AC2B57AB6ECA7),
+          UL64(0xFDC673D7BB28E800), UL64(0xB5645F2023C0E3FE) },
+        { UL64(0x76430E5F30562B28), UL64(0x6741CA1036EAD806),
+          UL64(0xBF6E5031937F1293), UL64(0x32C3096E22299AF0),
+          UL64(0xD6A3B1612145DD22), UL64(0x6C499057D75E8633),
+          UL64(0xA599765139F1C2BD), UL64(0x3B900C6D6B1FABF5) },
+        { UL64(0xE8296816E7437C63), UL64(0x38A7C0D276164C11),
+          UL64(0x1F1095F99C29840E), UL64(0x1912B9B357B9093F),
+          UL64(0xFE09D504F839C817), UL64(0x1F64FB3BBDDD4BDD),
+          UL64(0xEF42ED5BDB044534), UL64(0x1560DD95B4E821C8) },
+        { UL64(0xDE39AF5070B9524E), UL64(0x796995E9ADD1C868),
+          UL64(0x9790B828329A4CC9), UL64(0x1EEBA2B75B62AE64),
+          UL64(0x617BD3F6D7E3C12F), UL64(0xDB7E711CDF336421),
+          UL64(0x7DFC0937D78907CF), UL64(0x88937A99841A8BD5) },
+        { UL64(0xB9A5C24D5D0A41BA), UL64(0x58298402B66C861E),
+          UL64(0x99DB6EF84C71CDFC), UL64(0x69E2AAAAE6364CD9),
+          UL64(0x4BF09418648BC7D9), UL64(0x5AB3C2E9EB713C6F),
+          UL64(0x6A75D5580C6E52C2), UL64(0x462B8A24E5600012) },
+        { UL64(0xCA544208FE82858E), UL64(0x51A3AF4A3EC21A90),
+          UL64(0x63C19E63C27614D4), UL64(0x32088C95E005E739),
+          UL64(0x7C5025F9944A8D00), UL64(0x8F98E37D9A942A48),
+          UL64(0x53357351535C45E7), UL64(0xFE41F11C44891F80) },
+        { UL64(0x20F9E19C5DA2C390), UL64(0x1F69E62FDABD6D8A),
+          UL64(0x1B9EB62E27AABB65), UL64(0xBB0983373DBBBBB5),
+          UL64(0x7D3B88C9823632DA), UL64(0x6C8974F3A759E7DE),
+          UL64(0x496578083D52876C), UL64(0xB56473BCE045CDD8) },
+        { UL64(0x5DE57E0E0053E747), UL64(0x04D36592561C8A53),
+          UL64(0x6A06D378CA7F2EAD), UL64(0xB361562014F859DB),
+          UL64(0x4EB191171419F8F8), UL64(0xD0BF4525603B9932),
+          UL64(0xFC3E45CD9DA15898), UL64(0x5EE89F7179328D14) },
+        { UL64(0x896C42E8EE36860C), UL64(0xDAF04DFD4113C22D),
+          UL64(0x1ADBB7B744104213), UL64(0xE5FD5FA11FD394EA),
+          UL64(0x68235D941A4E0551), UL64(0x6772CFBE18D10151),
+          UL64(0x276071E309984523), UL64(0xE4E879DE5A56BA98) },
+    },
+    {
+        { UL64(0xAAAFAFB0285B9491), UL64(0x01A0BE881E4C705E),
+          UL64(0xFF1D4F5D2AD9CAAB), UL64(0x6E349A4AC37A233F),
+          UL64(0xCF1C12464A1C6A16), UL64(0xD99E6B6629383260),
+          UL64(0xEA3D43665F6D5471), UL64(0x36974D04FF8CC89B) },
+        { UL64(0x27F29E148F929057), UL64(0x7A64AE06C0C853DF),
+          UL64(0x256CD18358E9C5CE), UL64(0x9D9CCE82DED092A5),
+          UL64(0xCC6E59796E93B7C7), UL64(0xE1E4709231BB9E27),
+          UL64(0xB70B3083AA9E29A0), UL64(0xBF181A753785E644) },
+        { UL64(0x8ED6E8C85C0A3F1E), UL64(0xBCAD24927C87C37F),
+          UL64(0xFDFB62BB9EE3B78D), UL64(0xEBA8E477CBCEBA46),
+          UL64(0x37D38CB0EEAEDE4B), UL64(0x0BC498E87976DEB6),
+          UL64(0xB2944C046B6147FB), UL64(0x8B123F35F71F9609) },
+        { UL64(0xD3B3A13F1402B9D0), UL64(0x573441C32C7BC863),
+          UL64(0x4B301EC4578C3E6E), UL64(0xC26FC9C40ADAF57E),
+          UL64(0x96E71BFD7493CEA3), UL64(0xD05D4B3F1AF81456),
+          UL64(0xDACA2A8A6A8C608F), UL64(0x53EF07F60725B276) },
+        { UL64(0xBAE023F0C7435978), UL64(0xB152C88820E30E19),
+          UL64(0x9C241645E3FA6FAF), UL64(0x735D95C184823E60),
+          UL64(0x0319757303955317), UL64(0x0B4B02A9F03B4995),
+          UL64(0x076BF55970274600), UL64(0x32C5CC53AAF57508) },
+        { UL64(0x0318DBFDD5C7C5D2), UL64(0xB38F8DA7072B342D),
+          UL64(0x3569BDDC7B8DE38A), UL64(0xF25B5887A1C94842),
+          UL64(0xB2D5B2842946AD60), UL64(0x854F29ADE9D1707E),
+          UL64(0xAA5159DC2C6A4509), UL64(0x899F94C057189837) },
+        { UL64(0x27F536E049CE89E7), UL64(0x18908539CC890CB5),
+          UL64(0x308909ABD83C2AA1), UL64(0xECD3142B1AB73BD3),
+          UL64(0x6A85BF59B3F5AB84), UL64(0x3C320A68F2BEA4C6),
+          UL64(0xAD8DC5386DA4541F), UL64(0xEAF34EB0B7C41186) },
+        { UL64(0xA6B5C9D646AC49D2), UL64(0x42C77C0B83137AA9),
+          UL64(0x24D000FC68225A38), UL64(0x0F63CFC82FE1E907),
+          UL64(0x22D1B01BC6441F95), UL64(0x7D38F719EC8E448F),
+          UL64(0x9B33FA5F787FB1BA), UL64(0x94DCFDA1190158DF) },
+        { UL64(0x63C79326490A1ACA), UL64(0xCB64DD9C41526B02),
+          UL64(0xBB772591A2979258), UL64(0x3F58297048D97846),
+          UL64(0xD66B70D17C213BA7), UL64(0xC28FEBB5E8A0CED4),
+          UL64(0x6B911831C10338C1), UL64(0x0D54E389BF0126F3) },
+        { UL64(0x40242EFEB483689B), UL64(0x2575D3F6513AC262),
+          UL64(0xF30037C80CA6DB72), UL64(0xC9FCCE8298864BE2),
+          UL64(0x84A112FF0149362D), UL64(0x95E575821C4AE971),
+          UL64(0x1FA4B1A8945CF86C), UL64(0x4525A7340B024A2F) },
+        { UL64(0xCAEAD1C2C905D85F), UL64(0xE9D7F7900733AE57),
+          UL64(0x24C9A65CF07CDD94), UL64(0x7389359CA4B55931),
+          UL64(0xF58709B7367E45F7), UL64(0x1F203067CB7E7ADC),
+          UL64(0x82444BFFC7B72818), UL64(0x07303B35BAAC8033) },
+        { UL64(0x057FED45526F09FD), UL64(0xE8A4F10C8128240A),
+          UL64(0x9332EFC4FF2BFD8D), UL64(0x214E77A0BD35AA31),
+          UL64(0x32896D7314FAA40E), UL64(0x767867EC01E5F186),
+          UL64(0xC9ADF8F117A1813E), UL64(0xCB6CDA7854741795) },
+        { UL64(0xB7B4D00101DAE185), UL64(0x45434E0B9B7A94BC),
+          UL64(0xF54339AFFBD8CB0B), UL64(0xDCC4569EE98EF49E),
+          UL64(0x7789318A09A51299), UL64(0x81B4D206B2B025D8),
+          UL64(0xF64AA418FAE85792), UL64(0x3E50258FACD7BAF7) },
+        { UL64(0xC072EBD3A19FD868), UL64(0x612E481CDB8DDD3B),
+          UL64(0xB4E1D7541A64D852), UL64(0x00EF95ACC4C6C4AB),
+          UL64(0x1536D2EDAA0A6C46), UL64(0x6129408643774790),
+          UL64(0x54AF25E8343FDA10), UL64(0x9FF9D98DFD25D6F2) },
+        { UL64(0x4CD296DF5579BEA4), UL64(0x10E35AC85CEEDAF1),
+          UL64(0x04C4C5FDE3BCC5B1), UL64(0x95F9EE8A89412CF9),
+          UL64(0x2C9459EE82B6EB0F), UL64(0x2E84576595C2AADD),
+          UL64(0x774A84AED327FCFE), UL64(0xD8C937220368D476) },
+        { UL64(0x211CDE10296C36EF), UL64(0x7EE8967282C4DA77),
+          UL64(0xB617D270A57836DA), UL64(0xF0CD9C319CB7560B),
+          UL64(0x01FDCBF7E455FE90), UL64(0x3FB53CBB7E7334F3),
+          UL64(0x781E2EA44E7DE4EC), UL64(0x8ADAB3AD0B384FD0) },
+        { UL64(0x60E690F2BBBAB3B8), UL64(0x4851F8AE8B04816B),
+          UL64(0xC72046AB9C92E4D2), UL64(0x518C74A17CF3136B),
+          UL64(0xFF4EB50AF9877D4C), UL64(0x14578D90A919CABB),
+          UL64(0x8218F8C4AC5EB2B6), UL64(0xA3CCC547542016E4) },
+        { UL64(0xE33EA76C1EEA7B85), UL64(0x2352B46192D4F85E),
+          UL64(0xF101D334AFE115BB), UL64(0xFABC1294889175A3),
+          UL64(0x7F6BCDC05233F925), UL64(0xE0A802DBE77FEC55),
+          UL64(0xBDB47B758069B659), UL64(0x1C5E12DEF98FBD74) },
+        { UL64(0x656C465889D8DDBB), UL64(0x8830B26E70F38EE8),
+          UL64(0x4320FD5CDE1212B0), UL64(0xC34F30CFE4A2EDB2),
+          UL64(0xABB131A356AB64B8), UL64(0x7F77F0CCD99C5D26),
+          UL64(0x66856A37BF981D94), UL64(0x19E76D09738BD76E) },
+        { UL64(0x1C6BD47D53B618C0), UL64(0xC424F46C6A227923),
+          UL64(0x7303FFDEDD92D964), UL64(0xE971287871B5ABF2),
+          UL64(0x8F48A632F815561D), UL64(0x85F48FF5D3C055D1),
+          UL64(0x222A14277525684F), UL64(0xD0D841A067360CC3) },
+        { UL64(0x860C44B1F2C34A99), UL64(0x3B00ACA4BF5855AC),
+          UL64(0xABF6AAA0FAAF37BE), UL64(0x65F436822A53EC08),
+          UL64(0x1D9A5801A11B12E1), UL64(0x78A7AB2CE20ED475),
+          UL64(0x0DE1067E9A41E0D5), UL64(0x30473F5F305023EA) },
+        { UL64(0xDBB7B352F97F68C6), UL64(0x0C773B500B02CF58),
+          UL64(0xEA2E48213C1F96D9), UL64(0xFFB357B0EEE01815),
+          UL64(0xB9C924CDE0F28039), UL64(0x0B36C95A46A3FBE4),
+          UL64(0x1FAAAEA45E46DB6C), UL64(0xCAE575C31928AAFF) },
+        { UL64(0x263C962A70CBB96C), UL64(0xE034362ABCD124A9),
+          UL64(0xF120DB283C2AE58D), UL64(0xB9A38D49FEF6D507),
+          UL64(0xB1FD2A821FF140FD), UL64(0xBD162F3020AEE7E0),
+          UL64(0x4E17A5D4CB251949), UL64(0x2AEBCB834F7E1C3D) },
+        { UL64(0x01778A2B599FF0F9), UL64(0x68A923D78104FC6B),
+          UL64(0x5BFA44DFDA694FF3), UL64(0x4F7199DBF7667F12),
+          UL64(0xC06D8FF6E46F2A79), UL64(0x08B5DEADE9F8131D),
+          UL64(0x02519A59ABB4CE7C), UL64(0xC4F710BCB42AEC3E) },
+        { UL64(0xD8BFD3CAC0C22719), UL64(0xC60209E4C9CA151E),
+          UL64(0x7A744AB5D9A1A69C), UL64(0x6DE5048B14937F8F),
+          UL64(0x171938D8E115AC04), UL64(0x7DF709401C6B16D2),
+          UL64(0xA6AEB6637F8E94E7), UL64(0xC130388E2A2CF094) },
+        { UL64(0xCDB6719D786F337C), UL64(0xD9C01CD2E704397D),
+          UL64(0x0F4A3F20555C2FEF), UL64(0x004525097C0AF223),
+          UL64(0x54A5804784DB8E76), UL64(0x3BACF1AA93C8AA06),
+          UL64(0x11CA957CF7919422), UL64(0x5064105378CDAA40) },
+        { UL64(0x9F6EB7316C67A775), UL64(0xCB10471AEFC5D0B1),
+          UL64(0xB433750CE1B806B2), UL64(0x19C5714D57B1AE7E),
+          UL64(0xC0DC8B7BED03FD3F), UL64(0xDD03344F31BC194E),
+          UL64(0xA66C52A78C6320B5), UL64(0x8BC82CE3D0B6FD93) },
+        { UL64(0xB228A90F0E0B040D), UL64(0xBAF02D8245FF897F),
+          UL64(0x2AAC79E600FA6122), UL64(0x248288178E36F557),
+          UL64(0xB9521D31113EC356), UL64(0x9E48861E15EFF1F8),
+          UL64(0x2AA1D412E0D41715), UL64(0x71F8620353F131B8) },
+        { UL64(0x6D2A483D6F73C51E), UL64(0xA4CB2412EA0DC2DD),
+          UL64(0x50663C411EB917FF), UL64(0x3D3A74CFEADE299E),
+          UL64(0x29B3990F4A7A9202), UL64(0xA9BCCF59A7B15C3D),
+          UL64(0x66A3CCDCA5DF9208), UL64(0x48027C1443F2F929) },
+        { UL64(0xE044A3BB098CAFB4), UL64(0x27ED231060D48CAF),
+          UL64(0x542B56753A31B84D), UL64(0xCBF3DD50FCDDBED7),
+          UL64(0x25031F1641B1D830), UL64(0xA7EC851DCB0C1E27),
+          UL64(0xAC1C8FE0B5AE75DB), UL64(0xB24C755708C52120) },
+        { UL64(0x1FBB0E71D607039E), UL64(0x2B70E215CD3A4546),
+          UL64(0x32D2F01D53324091), UL64(0xB796FF08180AB19B),
+          UL64(0x32D87A863C57C4AA), UL64(0x2AED9CAFB7C49A27),
+          UL64(0x9FB35EAC31630D98), UL64(0x338E8CDF5C3E20A3) },
+        { UL64(0x3014368B4ED80940), UL64(0x67E6D0567A6FCEDD),
+          UL64(0x7C208C49CA97579F), UL64(0xFE3D7A81A23597F6),
+          UL64(0x5E2032027E096AE2), UL64(0xB1F3E1E724B39366),
+          UL64(0x26DA26F32FDCDFFC), UL64(0x79422F1D6097BE83) },
+    },
+    {
+        { UL64(0x263A2CFB9DB3B381), UL64(0x9C3A2DEED4DF0A4B),
+          UL64(0x728D06E97D04E61F), UL64(0x8B1ADFBC42449325),
+          UL64(0x6EC1D9397E053A1B), UL64(0xEE2BE5C766DAF707),
+          UL64(0x80BA1E14810AC7AB), UL64(0xDD2AE778F530F174) },
+        { UL64(0x0435D97A205B9D8B), UL64(0x6EB8F064056756D4),
+          UL64(0xD5E88A8BB6F8210E), UL64(0x070EF12DEC9FD9EA),
+          UL64(0x4D8495053BCC876A), UL64(0x12A75338A7404CE3),
+          UL64(0xD22B49E1B8A1DB5E), UL64(0xEC1F205114BFA5AD) },
+        { UL64(0xADBAEB79B6828F36), UL64(0x9D7A025801BD5B9E),
+          UL64(0xEDA01E0D1E844B0C), UL64(0x4B625175887EDFC9),
+          UL64(0x14109FDD9669B621), UL64(0x88A2CA56F6F87B98),
+          UL64(0xFE2EB788170DF6BC), UL64(0x0CEA06F4FFA473F9) },
+        { UL64(0x43ED81B5C4E83D33), UL64(0xD9F358795EFD488B),
+          UL64(0x164A620F9DEB4D0F), UL64(0xC6927BDBAC6A7394),
+          UL64(0x45C28DF79F9E0F03), UL64(0x2868661EFCD7E1A9),
+          UL64(0x7CF4E8D0FFA348F1), UL64(0x6BD4C284398538E0) },
+        { UL64(0x2618A091289A8619), UL64(0xEF796E606671B173),
+          UL64(0x664E46E59090C632), UL64(0xA38062D41E66F8FB),
+          UL64(0x6C744A200573274E), UL64(0xD07B67E4A9271394),
+          UL64(0x391223B26BDC0E20), UL64(0xBE2D93F1EB0A05A7) },
+        { UL64(0xF23E2E533F36D141), UL64(0xE84BB3D44DFCA442),
+          UL64(0xB804A48D6B7C023A), UL64(0x1E16A8FA76431C3B),
+          UL64(0x1B5452ADDDD472E0), UL64(0x7D405EE70D1EE127),
+          UL64(0x50FC6F1DFFA27599), UL64(0x351AC53CBF391B35) },
+        { UL64(0x7EFA14B84444896B), UL64(0x64974D2FF94027FB),
+          UL64(0xEFDCD0E8DE84487D), UL64(0x8C45B2602B48989B),
+          UL64(0xA8FCBBC2D8463487), UL64(0xD1B2B3F73FBC476C),
+          UL64(0x21D005B7C8F443C0), UL64(0x518F2E6740C0139C) },
+        { UL64(0x56036E8C06D75FC1), UL64(0x2DCF7BB73249A89F),
+          UL64(0x81DD1D3DE245E7DD), UL64(0xF578DC4BEBD6E2A7),
+          UL64(0x4C028903DF2CE7A0), UL64(0xAEE362889C39AFAC),
+          UL64(0xDC847C31146404AB), UL64(0x6304C0D8A4E97818) },
+        { UL64(0xAE51DCA2A91F6791), UL64(0x2ABE41909BAA9EFC),
+          UL64(0xD9D2E2F4559C7AC1), UL64(0xE82F4B51FC9F773A),
+          UL64(0xA77130274073E81C), UL64(0xC0276FACFBB596FC),
+          UL64(0x1D819FC9A684F70C), UL64(0x29B47FDDC9F7B1E0) },
+        { UL64(0x358DE103459B1940), UL64(0xEC881C595B013E93),
+          UL64(0x51574C9349532AD3), UL64(0x2DB1D445B37B46DE),
+          UL64(0xC6445B87DF239FD8), UL64(0xC718AF75151D24EE),
+          UL64(0xAEA1C4A4F43C6259), UL64(0x40C0E5D770BE02F7) },
+        { UL64(0x6A4590F4721B33F2), UL64(0x2124F1FBFEDF04EA),
+          UL64(0xF8E53CDE9745EFE7), UL64(0xE7E1043265F046D9),
+          UL64(0xC3FCA28EE4D0C7E6), UL64(0x847E339A87253B1B),
+          UL64(0x9B5953483743E643), UL64(0xCB6A0A0B4FD12FC5) },
+        { UL64(0xFB6836C327D02DCC), UL64(0x5AD009827A68BCC2),
+          UL64(0x1B24B44C005E912D), UL64(0xCC83D20F811FDCFE),
+          UL64(0x36527EC1666FBA0C), UL64(0x6994819714754635),
+          UL64(0xFCDCB1A8556DA9C2), UL64(0xA593426781A732B2) },
+        { UL64(0xEC1214EDA714181D), UL64(0x609AC13B6067B341),
+          UL64(0xFF4B4C97A545DF1F), UL64(0xA124050134D2076B),
+          UL64(0x6EFA0C231409CA97), UL64(0x254CC1A820638C43),
+          UL64(0xD4E363AFDCFB46CD), UL64(0x62C2ADC303942A27) },
+        { UL64(0xC67B9DF056E46483), UL64(0xA55ABB2063736356),
+          UL64(0xAB93C098C551BC52), UL64(0x382B49F9B15FE64B),
+          UL64(0x9EC221AD4DFF8D47), UL64(0x79CAF615437DF4D6),
+          UL64(0x5F13DC64BB456509), UL64(0xE4C589D9191F0714) },
+        { UL64(0x27B6A8AB3FD40E09), UL64(0xE455842E77313EA9),
+          UL64(0x8B51D1E21F55988B), UL64(0x5716DD73062BBBFC),
+          UL64(0x633C11E54E8BF3DE), UL64(0x9A0E77B61B85BE3B),
+          UL64(0x565107290911CCA6), UL64(0x27E76495EFA6590F) },
+        { UL64(0xE4AC8B33070D3AAB), UL64(0x2643672B9A2CD5E5),
+          UL64(0x52EFF79B1CFC9173), UL64(0x665CA49B90A7C13F),
+          UL64(0x5A8DDA59B3EFB998), UL64(0x8A5B922D052F1341),
+          UL64(0xAE9EBBAB3CF9A530), UL64(0x35986E7BF56DA4D7) },
+        { UL64(0x3A636B5CFF3513CC), UL64(0xBB0CF8BA3198F7DD),
+          UL64(0xB8D4052241F16F86), UL64(0x760575D8DE13A7BF),
+          UL64(0x36F74E169F7AA181), UL64(0x163A3ECFF509ED1C),
+          UL64(0x6AEAD61F3C40A491), UL64(0x158C95FCDFE8FCAA) },
+        { UL64(0xA3991B6E13CDA46F), UL64(0x79482415342FAED0),
+          UL64(0xF3BA5BDE666B5970), UL64(0x1D52E6BCB26AB6DD),
+          UL64(0x768BA1E78608DD3D), UL64(0x4930DB2AEA076586),
+          UL64(0xD9575714E7DC1AFA), UL64(0x1FC7BF7DF7C58817) },
+        { UL64(0x6B47ACCDD9EEE96C), UL64(0x0CA277FBE58CEC37),
+          UL64(0x113FE413E702C42A), UL64(0xDD1764EEC47CBE51),
+          UL64(0x041E7CDE7B3ED739), UL64(0x50CB74595CE9E1C0),
+          UL64(0x355685132925B212), UL64(0x7CFF95C4001B081C) },
+        { UL64(0x63EE4CBD8088B454), UL64(0xDB7F32F79A9E0C8A),
+          UL64(0xB377D4186B2447CB), UL64(0xE3E982AAD370219B),
+          UL64(0x06CCC1E4C2A2A593), UL64(0x72C368650773F24F),
+          UL64(0xA13B4DA795859423), UL64(0x8BBF1D3375040C8F) },
+        { UL64(0x726F0973DA50C991), UL64(0x48AFCD5B822D6EE2),
+          UL64(0xE5FC718B20FD7771), UL64(0xB9E8E77DFD0807A1),
+          UL64(0x7F5E0F4499A7703D), UL64(0x6972930E618E36F3),
+          UL64(0x2B7C77B823807BBE), UL64(0xE5B82405CB27FF50) },
+        { UL64(0xBA8B8BE3BD379062), UL64(0xD64B7A1D2DCE4A92),
+          UL64(0x040A73C5B2952E37), UL64(0x0A9E252ED438AECA),
+          UL64(0xDD43956BC39D3BCB), UL64(0x1A31CA00B32B2D63),
+          UL64(0xD67133B85C417A18), UL64(0xD08E47902EF442C8) },
+        { UL64(0x98CB1AE9255C0980), UL64(0x4BD863812B4A739F),
+          UL64(0x5A5C31E11E4A45A1), UL64(0x1E5D55FE9CB0DB2F),
+          UL64(0x74661B068FF5CC29), UL64(0x026B389F0EB8A4F4),
+          UL64(0x536B21A458848C24), UL64(0x2E5BF8EC81DC72B0) },
+        { UL64(0x03C187D0AD886AAC), UL64(0x5C16878AB771B645),
+          UL64(0xB07DFC6FC74045AB), UL64(0x2C6360BF7800CAED),
+          UL64(0x24295BB5B9C972A3), UL64(0xC9E6F88E7C9A6DBA),
+          UL64(0x90FFBF2492A79AA6), UL64(0xDE29D50A41C26AC2) },
+        { UL64(0x9F0AF483D309CBE6), UL64(0x5B020D8AE0BCED4F),
+          UL64(0x606E986DB38023E3), UL64(0xAD8F2C9D1ABC6933),
+          UL64(0x19292E1DE7400E93), UL64(0xFE3E18A952BE5E4D),
+          UL64(0xE8E9771D2E0680BF), UL64(0x8C5BEC98C54DB063) },
+        { UL64(0x2AF9662A74A55D1F), UL64(0xE3FBF28F046F66D8),
+          UL64(0xA3A72AB4D4DC4794), UL64(0x09779F455C7C2DD8),
+          UL64(0xD893BDAFC3D19D8D), UL64(0xD5A7509457D6A6DF),
+          UL64(0x8CF8FEF9952E6255), UL64(0x3DA67CFBDA9A8AFF) },
+        { UL64(0x4C23F62A2C160DCD), UL64(0x34E6C5E38F90EAEF),
+          UL64(0x35865519A9A65D5A), UL64(0x07C48AAE8FD38A3D),
+          UL64(0xB7E7AEDA50068527), UL64(0x2C09EF231C90936A),
+          UL64(0x31ECFEB6E879324C), UL64(0xA0871F6BFB0EC938) },
+        { UL64(0xB1F0FB68D84D835D), UL64(0xC90CAF39861DC1E6),
+          UL64(0x12E5B0467594F8D7), UL64(0x26897AE265012B92),
+          UL64(0xBCF68A08A4D6755D), UL64(0x403EE41C0991FBDA),
+          UL64(0x733E343E3BBF17E8), UL64(0xD2C7980D679B3D65) },
+        { UL64(0x33056232D2E11305), UL64(0x966BE492F3C07A6F),
+          UL64(0x6A8878FFBB15509D), UL64(0xFF2211010A9B59A4),
+          UL64(0x6C9F564AABE30129), UL64(0xC6F2C940336E64CF),
+          UL64(0x0FE752628B0C8022), UL64(0xBE0267E96AE8DB87) },
+        { UL64(0x22E192F193BC042B), UL64(0xF085B534B237C458),
+          UL64(0xA0D192BD832C4168), UL64(0x7A76E9E3BDF6271D),
+          UL64(0x52A882FAB88911B5), UL64(0xC85345E4B4DB0EB5),
+          UL64(0xA3BE02A681A7C3FF), UL64(0x51889C8CF0EC0469) },
+        { UL64(0x9D031369A5E829E5), UL64(0xCBB4C6FC1607AA41),
+          UL64(0x75AC59A6241D84C1), UL64(0xC043F2BF8829E0EE),
+          UL64(0x82A38F758EA5E185), UL64(0x8BDA40B9D87CBD9F),
+          UL64(0x9E65E75E2D8FC601), UL64(0x3D515F74A35690B3) },
+        { UL64(0x534ACF4FDA79E5AC), UL64(0x68B83B3A8630215F),
+          UL64(0x5C748B2ED085756E), UL64(0xB0317258E5D37CB2),
+          UL64(0x6735841AC5CCC2C4), UL64(0x7D7DC96B3D9D5069),
+          UL64(0xA147E410FD1754BD), UL64(0x65296E94D399DDD5) },
+    },
+    {
+        { UL64(0xD7E0C4CDB30CFB3A), UL64(0x6D09B8C16C9DB4C8),
+          UL64(0x40BA1A4207C8D9DF), UL64(0x6FD495F71C52C66D),
+          UL64(0xFB0E169F275264DA), UL64(0x80C2B746E57D8362),
+          UL64(0xEDD987F749AD7222), UL64(0xFDC229AF4398EC7B) },
+        { UL64(0xB0D1ED8452666A58), UL64(0x4BCB6E00E6A9C3C2),
+          UL64(0x3C57411C26906408), UL64(0xCFC2075513556400),
+          UL64(0xA08B1C505294DBA3), UL64(0xA30BA2868B7DD31E),
+          UL64(0xD70BA90E991ECA74), UL64(0x094E142CE762C2B9) },
+        { UL64(0x88EA439BAC7F13EF), UL64(0x65AA143F8D9A7D14),
+          UL64(0xFFE0CF2D20CB2F1A), UL64(0x847B7BF1381C6AD1),
+          UL64(0x56F5B8148AC80B4D), UL64(0x041B441835CEAFF2),
+          UL64(0xDE9088C0CDA5FCEF), UL64(0xE668519BE083B8CE) },
+        { UL64(0xB81D783E979F3925), UL64(0x1EFD130AAF4C89A7),
+          UL64(0x525C2144FD1BF7FA), UL64(0x4B2969041B265A9E),
+          UL64(0xED8E9634B9DB65B6), UL64(0x35C82E3203599D8A),
+          UL64(0xDAA7A54F403563F3), UL64(0x9DF088AD022C38AB) },
+        { UL64(0x1C695AC1456260EE), UL64(0x4E3ACEDF4D783693),
+          UL64(0xDAFD525911674A8F), UL64(0x21846D406C7B22F9),
+          UL64(0x783D1CFC17891F55), UL64(0x2A173C34D74D0475),
+          UL64(0x3AFDBD7FB699FA20), UL64(0x79248FB6AC829F62) },
+        { UL64(0xE5CFB066BB3FD30A), UL64(0x429169DAEFF0354E),
+          UL64(0x809CF8523524E36C), UL64(0x136F4FB30155BE1D),
+          UL64(0x4826AF011FBBA712), UL64(0x6EF0F0B4506BA1A1),
+          UL64(0xD9928B3177AEA73E), UL64(0xE2BF6AF25EAA244E) },
+        { UL64(0x1828363A1AC81DB2), UL64(0x752A22B348820666),
+          UL64(0xCFC000033D32AB6A), UL64(0x2AD677E1D96A3CB1),
+          UL64(0xA7E3E672C8233011), UL64(0x2C65E87E5E4303B7),
+          UL64(0x1834F71BC6DF04CB), UL64(0x32F8772C3CEDA834) },
+        { UL64(0x8D084F124237B64B), UL64(0x688EBE99E3ECFD07),
+          UL64(0x57B8A70CF6845DD8), UL64(0x808FC59C5DA4A325),
+          UL64(0xA9032B2BA3585862), UL64(0xB66825D5EDF29386),
+          UL64(0xB5A5A8DB431EC29B), UL64(0xBB143A983A1E8DC8) },
+        { UL64(0x5B356A07CFE9D1D9), UL64(0xD4BA683A306F48DD),
+          UL64(0x3B6AE7B52C6437C1), UL64(0xF9C0C1A154B64FD4),
+          UL64(0x90660DBAED5452D0), UL64(0x423F3E952850530F),
+          UL64(0x1432A20647274D81), UL64(0xCCEBF3F87DB00574) },
+        { UL64(0x35EE94CE12AE381B), UL64(0x3A7F176C86CCDA90),
+          UL64(0xC63A657E4606EACA), UL64(0x9AE5A38043CD04DF),
+          UL64(0x9BEC8D15ED251B46), UL64(0x1F5D6D30CACA5E64),
+          UL64(0x347B3B359FF20F07), UL64(0x4D65F034F7E4B286) },
+        { UL64(0xD89F81F606C82996), UL64(0x4F73528815C592FC),
+          UL64(0x8C0C03A1CE49A8C6), UL64(0xE04DFFE0B9F25907),
+          UL64(0x226621504AF7AB4B), UL64(0x9E21FFF6F5A35C4C),
+          UL64(0x071D44845A1E9198), UL64(0x0811955C4109FC11) },
+        { UL64(0x9E93BA24F111661E), UL64(0xEDCED484B105EB04),
+          UL64(0x96DC9BA1F424B578), UL64(0xBF8F66B7E83E9069),
+          UL64(0x872D4DF4D7ED8216), UL64(0xBF07F3778E2CBECF),
+          UL64(0x4281D89998E73754), UL64(0xFEC85FBB8AAB8708) },
+        { UL64(0xD328411D4511395B), UL64(0x3150C079E4CDF8DE),
+          UL64(0x224BE7C45934BCD0), UL64(0x9D9771754358C9AE),
+          UL64(0xDBB1BB412230DB4D), UL64(0x168E84BD0D8E31DC),
+          UL64(0xA61B4F341C115FD2), UL64(0xC775FA155888C28F) },
+        { UL64(0x9A3C0DEEA5BA5B0B), UL64(0xE6A116CE42D05299),
+          UL64(0xAE9775FEE9B02D42), UL64(0x72B05200A1545CB6),
+          UL64(0xBC506F7D31A3B4EA), UL64(0xE58930788BBD9B32),
+          UL64(0xC8BC5F37E4B12A97), UL64(0x6B000C064A73B671) },
+        { UL64(0xF3C6925C17DE5F8A), UL64(0xA6CB4B95F34991D5),
+          UL64(0xA8BF97F07DD50566), UL64(0x2C8D55E50B91A09E),
+          UL64(0x6ADCC2ED3AD7E720), UL64(0x734A23480093EC5A),
+          UL64(0xFA1D8FBE43CB36AF), UL64(0xDC87B81CA4A8A7E4) },
+        { UL64(0x13B5BF22765FA7D0), UL64(0x59805BF01D6A5370),
+          UL64(0x67A5E29D4280DB98), UL64(0x4F53916F776B1CE3),
+          UL64(0x714FF61F33DDF626), UL64(0x4206238EA085D103),
+          UL64(0x1C50D4B7E5809EE3), UL64(0x999F450D85F8EB1D) },
+        { UL64(0x5F3904B1A239F325), UL64(0xD026A6F71A58AD90),
+          UL64(0x43542736D6B824ED), UL64(0x0841A7754A9364B8),
+          UL64(0x7597CB41CFEB1DE9), UL64(0x20252B7ABF580A4F),
+          UL64(0x3772928117C48E20), UL64(0xDADB1C28C6F5A071) },
+        { UL64(0x658A6051E4C79E9B), UL64(0x1394CB73C66A9FEA),
+          UL64(0x27F31ED5C6BE7B23), UL64(0xF4C88F365AA6F8FE),
+          UL64(0x0FB0721F4AAA499E), UL64(0x68B3A7D5E3FB2A6B),
+          UL64(0xA788097D3A92851D), UL64(0x060E7F8AE96F4913) },
+        { UL64(0xF1FA0CE288DBFDC1), UL64(0x3C397480D2F8DD08),
+          UL64(0x0EF10A8B4EDB95F0), UL64(0x4558BC753247E556),
+          UL64(0x765CEF5F0FC04FA4), UL64(0x729F2CE6D66D3D75),
+          UL64(0x6D35275DB433F066), UL64(0x31D95C27364E597E) },
+        { UL64(0x82EEBE731A3A93BC), UL64(0x42BBF465A21ADC1A),
+          UL64(0xC10B6FA4EF030EFD), UL64(0x247AA4C787B097BB),
+          UL64(0x8B8DC632F60C77DA), UL64(0x6FFBC26AC223523E),
+          UL64(0xA4F6FF11344579CF), UL64(0x5825653C980250F6) },
+        { UL64(0x88EAEF9ACC1F398B), UL64(0x85189A25F4217E95),
+          UL64(0x9424F5F5B968FCEF), UL64(0xC05D8AF9D0072228),
+          UL64(0x0B36FA8C49A1B22A), UL64(0xE61C3657F1115FCE),
+          UL64(0x06CDF0C04262433F), UL64(0x9D8AC52D9EC820DC) },
+        { UL64(0xB2DD097EBC1AA2B9), UL64(0x0788939337A0333A),
+          UL64(0x1CF55E7137A0DB38), UL64(0x2648487F792C1613),
+          UL64(0xDAD013363FCEF261), UL64(0x6239C81D0EABF129),
+          UL64(0x8EE761DE9D276BE2), UL64(0x406A7A341EDA6AD3) },
+        { UL64(0x017310ACD5026A07), UL64(0x3526C954E793281C),
+          UL64(0x416B7BC57600AC51), UL64(0x09678952D42B44A7),
+          UL64(0xABDA3FB7B6049FB1), UL64(0x3CB0A659DFADEF7B),
+          UL64(0x587931721B8B0C0D), UL64(0xFE73476E4E9D611B) },
+        { UL64(0x4BF367BA4A493B31), UL64(0x54F20A529BF7F026),
+          UL64(0xB696E0629795914B), UL64(0xCDDAB96D8BF236AC),
+          UL64(0x4FF2C70AED25EA13), UL64(0xFA1D09EB81CBBBE7),
+          UL64(0x88FC8C87468544C5), UL64(0x847A670D696B3317) },
+        { UL64(0x8410AFE245519A59), UL64(0x9A9739AFBC30D774),
+          UL64(0x6633DE03D8F44A88), UL64(0xD56A9BB3505DDB37),
+          UL64(0x66667C0746815E14), UL64(0x2228F8ED884493BB),
+          UL64(0x23CC561A17AB4882), UL64(0x99830759521A1BCE) },
+        { UL64(0xF133421E64BCB626), UL64(0xAEA638C826DEE0B5),
+          UL64(0xD6E7680BB310346C), UL64(0xE06F4097D5D4CED3),
+          UL64(0x099614527512A30B), UL64(0xF3D867FDE589A59A),
+          UL64(0x2E73254F52D0C180), UL64(0x9063D8A3333C74AC) },
+        { UL64(0x12142744E2EE6F7A), UL64(0x63389D106521603F),
+          UL64(0xA1CD82C79E9C813A), UL64(0xC109641C5AE342EB),
+          UL64(0x3C85FB3004BB06E9), UL64(0x1FED441CC212F17F),
+          UL64(0x1656DFAC82F61A53), UL64(0x88EC7A30CED98F5F) },
+        { UL64(0xEDA6C595D314E7BC), UL64(0x2EE7464B467899ED),
+          UL64(0x1CEF423C0A1ED5D3), UL64(0x217E76EA69CC7613),
+          UL64(0x27CCCE1FE7CDA917), UL64(0x12D8016B8A893F16),
+          UL64(0xBCD6DE849FC74F6B), UL64(0xFA5817E2F3144E61) },
+        { UL64(0x0B8939B59BC55ECE), UL64(0xB164B33BCBAA70FF),
+          UL64(0xAF6B010F3F2AB791), UL64(0x98B767BA7B52CB37),
+          UL64(0xBD0DF380FCF86541), UL64(0x5194F35464A1014A),
+          UL64(0x42C1F22E4C35F625), UL64(0x9A70F3E2F7BBF51B) },
+        { UL64(0x1F3541640821EE4C), UL64(0x1583EAB40BC61992),
+          UL64(0x7490CAF61D72879F), UL64(0x998AD9F3F76AE7B2),
+          UL64(0x1E181950A41157F7), UL64(0xA9D7E1E6E8DA3A7E),
+          UL64(0x963784EB8426B95F), UL64(0x0EE4ED6E542E2A10) },
+        { UL64(0xBC4D35B89612FD83), UL64(0xF477CA505C4005E9),
+          UL64(0xB762203DA87EECD1), UL64(0x68AC9B2238082586),
+          UL64(0x6696D659CC783591), UL64(0x254643DDD36352B4),
+          UL64(0xCDE370D99DAD1D69), UL64(0x9D7AF26C62715DFA) },
+        { UL64(0xB79D4CC5AC751E7B), UL64(0x93F96472FD4211BD),
+          UL64(0x8C72D3D2C8DE4FC6), UL64(0x7B69CBF5DF44F064),
+          UL64(0x3DA90CA2F4BF94E1), UL64(0x1A5325F8F12894E2),
+          UL64(0x0A437F6C7917D60B), UL64(0x9BE7048696C9CB5D) },
+    },
+    {
+        { UL64(0x949C9976E1337C26), UL64(0x6FAADEBDD73D68E5),
+          UL64(0x9E158614F1B768D9), UL64(0x22DFA5579CC4F069),
+          UL64(0xCCD6DA17BE93C6D6), UL64(0x24866C61A504F5B9),
+          UL64(0x2121353C8D694DA1), UL64(0x1C6CA5800140B8C6) },
+        { UL64(0xF1604A7DD4B79BB8), UL64(0xAEE806FB52C878C8),
+          UL64(0x34144F118D47B8E8), UL64(0x72EDF52B949F9054),
+          UL64(0xEBFCA84E2127015A), UL64(0x9051D0C09CB7CEF3),
+          UL64(0x86E8FE58296DEEC8), UL64(0x33B2818841010D74) },
+        { UL64(0xBD5660ED9AED9F40), UL64(0x70CA6AD1532A8C99),
+          UL64(0xC4978BFB95C371EA), UL64(0xE5464D0D7003109D),
+          UL64(0x1AF32FDFD9E535EF), UL64(0xABF57EA798C9185B),
+          UL64(0xED7A741712B42488), UL64(0x8E0296A7E97286FA) },
+        { UL64(0x01079383171B445F), UL64(0x9BCF21E38131AD4C),
+          UL64(0x8CDFE205C93987E8), UL64(0xE63F4152C92E8C8F),
+          UL64(0x729462A930ADD43D), UL64(0x62EBB143C980F05A),
+          UL64(0x4F3954E53B06E968), UL64(0xFE1D75AD242CF6B1) },
+        { UL64(0x8B57416E1F017D5E), UL64(0x375333967674E99B),
+          UL64(0x6E6D94C0E8F488A0), UL64(0xB93A787ADC16F95E),
+          UL64(0xC3AC51A2DCC99CCC), UL64(0xC134B4139AA47C1D),
+          UL64(0xF28FCDAFAFDFD8D5), UL64(0x0D57BD8E10B831ED) },
+        { UL64(0x9276FBCCF0BCFC46), UL64(0x3A822ACEB5CFFEE6),
+          UL64(0x328ED2FEC75D915B), UL64(0xA145C113C359476C),
+          UL64(0xF61A81538BE17BCD), UL64(0x01E867C3AA6C3D8F),
+          UL64(0x5634E15D6516C82F), UL64(0xC1437BD26948B9B0) },
+        { UL64(0xD2FCD2006C19D4C7), UL64(0xA0F3C437E1B1E976),
+          UL64(0xF0545FF694F237E8), UL64(0xDD10EC3FC0BF8BB1),
+          UL64(0x4F89696CAC7CD3E1), UL64(0xED3714EC5F24BFE6),
+          UL64(0x363EB1D85FAF7706), UL64(0xFCBD604DC027CC32) },
+        { UL64(0x5F95C6C7AF8685C8), UL64(0xD4C1C8CE2F8F01AA),
+          UL64(0xC44BBE322574692A), UL64(0xB8003478D4A4A068),
+          UL64(0x7C8FC6E52ECA3CDB), UL64(0xEA1DB16BEC04D399),
+          UL64(0xB05BC82E8F2BC5CF), UL64(0x763D517FF44793D2) },
+        { UL64(0x16CE8EDDC355363B), UL64(0x4AF2F70FF8820D6E),
+          UL64(0xCB7ED4D27661A508), UL64(0x41D3444EDD195472),
+          UL64(0x17FEA2B438DA9649), UL64(0x9BF69356AEB4A200),
+          UL64(0xA13B5F916AB19C3D), UL64(0xC0519C14DC9360A6) },
+        { UL64(0xC2571AE92E42E171), UL64(0xCB31AB63ED41CCF9),
+          UL64(0x37F3C576B5C8854F), UL64(0x66E5191BC62392A1),
+          UL64(0x71565A1C6CD5683B), UL64(0x484B0283606FE689),
+          UL64(0xF3A25D6767E2FDA6), UL64(0x87BA21DE8A65C0A4) },
+        { UL64(0xDE74E49CA70684D1), UL64(0x3AE8766133E80C3D),
+          UL64(0x5984A2A916A5C34D), UL64(0x09A83ECCB8298C35),
+          UL64(0x9A19867CAA4CA4C0), UL64(0x02085610B375B8FF),
+          UL64(0xF296328BF70396DC), UL64(0x9C9DDC4CDE6FAE63) },
+        { UL64(0x4451C1B808BD98D0), UL64(0x644B1CD46575F240),
+          UL64(0x6907EB337375D270), UL64(0x56C8BEBDFA2286BD),
+          UL64(0xC713D2ACC4632B46), UL64(0x17DA427AAFD60242),
+          UL64(0x313065B7C95C7546), UL64(0xF8239898BF17A3DE) },
+        { UL64(0x94683D260B083B6E), UL64(0x0A3752EB06F6A54D),
+          UL64(0x48BEDC23752074DD), UL64(0x637622FC3E822593),
+          UL64(0xEA0005136BE55D3B), UL64(0x9F5E12F4324D006D),
+          UL64(0x529486A964FC0270), UL64(0x09BA0D0C923399E6) },
+        { UL64(0x363858473A977080), UL64(0x4CF8E1B80C6A6AB6),
+          UL64(0x919A5C6C0482261E), UL64(0x517A9AD0E5CE4806),
+          UL64(0x2792D40C056AA7AA), UL64(0x4C7C6ADAE56C61B0),
+          UL64(0xF19CB178A4B19E0C), UL64(0x046D5C4FE4BA267F) },
+        { UL64(0xD3E926AB121550B3), UL64(0xE4975E4AC147CE84),
+          UL64(0x7A8BE0F95EFF722A), UL64(0x71E4702C6FD4F2A0),
+          UL64(0x13B92ACF3CB7B280), UL64(0xC588716D28272D73),
+          UL64(0x862C7BF3DAA9FE5C), UL64(0x78C008F2E2A79E42) },
+        { UL64(0xF3B7963F4C830320), UL64(0x842C7AA0903203E3),
+          UL64(0xAF22CA0AE7327AFB), UL64(0x38E13092967609B6),
+          UL64(0x73B8FB62757558F1), UL64(0x3CC3E831F7ECA8C1),
+          UL64(0xE4174474F6331627), UL64(0xA77989CAC3C40234) },
+        { UL64(0xED5832C5F536FA1F), UL64(0xE16F3F55928244A4),
+          UL64(0xF43A2621BF5BE190), UL64(0xF7D672C3CA2B6B2B),
+          UL64(0x64F86245827A5B83), UL64(0xC1A109F500E97F72),
+          UL64(0xC259785CA47327BB), UL64(0xDAF109E97F6A62B6) },
+        { UL64(0x88ABDF1857565120), UL64(0xBF34BC72F25F2BF1),
+          UL64(0x0C216A226283EA40), UL64(0x573D2046072E18E4),
+          UL64(0x11110F6A11BE8136), UL64(0x10F32A84D6E4861B),
+          UL64(0x3EEDDEE2EE297531), UL64(0xB3F37F99D3404269) },
+        { UL64(0xCEA3F5E91CC1D43A), UL64(0x624ACADB6A233AF4),
+          UL64(0xC9DF18A9D0EFE7C2), UL64(0xFE0D0BE879BA79F3),
+          UL64(0xC74C5A56522FF5EA), UL64(0x4AC379F06C7D514E),
+          UL64(0x64921404D70EA29F), UL64(0x443EE5910269F270) },
+        { UL64(0xE5FD17A144A081E0), UL64(0xD797FB7DB70E296A),
+          UL64(0x2B472B30481F719C), UL64(0x0E632A98FE6F8C52),
+          UL64(0x89CCD116C5F0C284), UL64(0xF51088AF2D987C62),
+          UL64(0x2A2BCCDA4C2DE6CF), UL64(0x810F9EFEF679F0F9) },
+        { UL64(0x3874F443A61EA539), UL64(0x90A3A311C206FEDF),
+          UL64(0x962A7B5B0FBD8785), UL64(0xFC37E97058C31C8B),
+          UL64(0xCDEB55385F1A1048), UL64(0x5A2051228CCD6255),
+          UL64(0x9762D4969C4F1B8B), UL64(0x213D8803D52F05DE) },
+        { UL64(0x7C64377BE54C73F6), UL64(0x65BFFE045A4EFBC0),
+          UL64(0xD0D2306336F58541), UL64(0x54D6066F25CDBDF0),
+          UL64(0x685F2D635CF86D5B), UL64(0x8E51E9C1F12EF6E5),
+          UL64(0xA6AF042DCB346D82), UL64(0x379550790073816F) },
+        { UL64(0xC89CD3A713C5F7F4), UL64(0x0D9CB54EAC352EED),
+          UL64(0x462E7AEE33B34788), UL64(0x831AF1437C998D9A),
+          UL64(0xED8802C911E04F87), UL64(0x1CA1A00B1938D969),
+          UL64(0x52805BB47BBB9310), UL64(0xCAA3CDE431C16410) },
+        { UL64(0xB0F394B97FFE4B3E), UL64(0x0B691D21E5FA5D21),
+          UL64(0xB0BD77479DFBBC75), UL64(0xD2830FDAFAF78B00),
+          UL64(0xF78C249C52434F57), UL64(0x4B1F754598096DAB),
+          UL64(0x73BF6F948FF8C0B3), UL64(0x34AEF03D454E134C) },
+        { UL64(0x2EB856D5390BC059), UL64(0xC0EABD5F041312DF),
+          UL64(0x7EEF45DF8636D67B), UL64(0x6909E81FDFEA7FB5),
+          UL64(0x628E8C5331DA7737), UL64(0x1B2F8BE3755B55BC),
+          UL64(0x35BA0512137841D7), UL64(0x59550359317CE57D) },
+        { UL64(0xB251D407F5D16DC9), UL64(0x541FAAAF4C72CC1C),
+          UL64(0xD28170ACE58173CC), UL64(0x1CC057C57B0C1B5A),
+          UL64(0x04B274E621062374), UL64(0xEFACCAA7E2CB8C79),
+          UL64(0xC466C3EC24EA9495), UL64(0xC3516EF367EF7C15) },
+        { UL64(0x34EF003B45575C1C), UL64(0xDEB3E7A049C2FE0C),
+          UL64(0x048EC01DF7149C63), UL64(0x203869B9C79A986C),
+          UL64(0xCF7C40836C1E80EF), UL64(0x210E17D58E294447),
+          UL64(0x2B507D2E1212601C), UL64(0x98EDD3FA5A17E279) },
+        { UL64(0xF8D151F4B7AC7EC5), UL64(0xD6CEB95AE50DA7D5),
+          UL64(0xA1B492B0DC3A0EB8), UL64(0x75157B69B3DD2863),
+          UL64(0xE2C4C74EC5413D62), UL64(0xBE329FF7BC5FC4C7),
+          UL64(0x835A2AEA60FA9DDA), UL64(0xF117F5AD7445CB87) },
+        { UL64(0x9BF42636E91D691D), UL64(0x0BCC32428FC07BE4),
+          UL64(0x5B205CAE69E9AA90), UL64(0x6F69722B399CF75E),
+          UL64(0x3DB059F679424235), UL64(0x6B98B404A2205463),
+          UL64(0x68CAF5E46F60F451), UL64(0xE8F1FC66AD08939E) },
+        { UL64(0x36661BD46346B21F), UL64(0xDE6FB01D3CB69DF0),
+          UL64(0x7D05A0E4A884B40A), UL64(0xD92569D4EF3D4ABF),
+          UL64(0x1C2BD7E1E6B261F8), UL64(0x0503B0E5C74DDBEF),
+          UL64(0x6A361A39E09A4C37), UL64(0x7FD57508E7FF8473) },
+        { UL64(0x1939FD67C776EDF8), UL64(0xD0847C70CB5C848A),
+          UL64(0x4FF553915ADE03D1), UL64(0x8FB54D83CFA9823E),
+          UL64(0xB308146EF10D4E04), UL64(0x14A691B3B6CB2A36),
+          UL64(0x2F419B93C620657F), UL64(0x4DB7AAA2D3E1DA7F) },
+        { UL64(0xAE8317F4B0166F7A), UL64(0xFBD3E3F7CEEC74E6),
+          UL64(0xFDB516ACE0874BFD), UL64(0x3D846019C681F3A3),
+          UL64(0x0B12EE5C7C1620B0), UL64(0xBA68B4DD2B63C501),
+          UL64(0xAC03CD326668C51E), UL64(0x2A6279F74E0BCB5B) },
+    },
+    {
+        { UL64(0xFD8E139F8F5FCDA8), UL64(0xF3E558C4BDEE5BFD),
+          UL64(0xD76CBAF4E33F9F77), UL64(0x3A4C97A471771969),
+          UL64(0xDA27E84BF6DCE6A7), UL64(0xFF373D9613E6C2D1),
+          UL64(0xF115193CD759A6E9), UL64(0x3F9B702563D2262C) },
+        { UL64(0x8C3184911A335CC8), UL64(0x563459BA6A5913E4),
+          UL64(0x1B920D61C7B32919), UL64(0x805AB8B6A02425AD),
+          UL64(0x2AC512DA8D006086), UL64(0x6CA4846ABCF5C0FD),
+          UL64(0xAFEA51D8AC2138D7), UL64(0xCB647545344CD443) },
+        { UL64(0x9F1B2466CDEDCA85), UL64(0x140BB7101A09538C),
+          UL64(0xAC8AE8515E11115D), UL64(0x0D63FF676F03F59E),
+          UL64(0x755E55517D234AFB), UL64(0x61C2DB4E7E208FC1),
+          UL64(0xAA9859CEF28A4B5D), UL64(0xBDD6D4FC34AF030F) },
+        { UL64(0x511053E453544774), UL64(0x834D0ECC3ADBA2BC),
+          UL64(0x4215D7F7BAE371F5), UL64(0xFCFD57BF6C8663BC),
+          UL64(0xDED2383DD6901B1D), UL64(0x3B49FBB4B5587DC3),
+          UL64(0xFD44A08D07625F62), UL64(0x3EE4D65B9DE9B762) },
+        { UL64(0x5A994B6E717815DE), UL64(0xD995C7A0A7E131D1),
+          UL64(0xC8B46DF226C023AA), UL64(0x8CFD094D702AFCED),
+          UL64(0x7BC743CDCED6A886), UL64(0xB7D70EC41FCABE75),
+          UL64(0x2A6C9E47DDAC9390), UL64(0x720694259310AA90) },
+        { UL64(0xD17E80F55464D0EB), UL64(0x89D3E1A767A613A7),
+          UL64(0x77791260C8C97DAD), UL64(0xEC2FF21FE4F0CBE7),
+          UL64(0xED984AC2E9E6BC10), UL64(0xE3C53DE877CBA305),
+          UL64(0x9BBAF9B283624FDC), UL64(0x5E9451CD1485C0EC) },
+        { UL64(0x1F13756DB1761EC8), UL64(0xE53C8B98A4B97E55),
+          UL64(0xB2AEE3F84096CC28), UL64(0x48C361A0920F1A8D),
+          UL64(0xA98B672D8C31190A), UL64(0x7BC1E7D1001855D4),
+          UL64(0x242CFB07BF3F4B2A), UL64(0x9BF44A3F32A28BC4) },
+        { UL64(0x64E5137D0D63D1FA), UL64(0x658FC05202A9D89F),
+          UL64(0x4889487450436309), UL64(0xE9AE30F8D598DA61),
+          UL64(0x2ED710D1818BAF91), UL64(0xE27E9E068B6A0C20),
+          UL64(0x1E28DCFB1C1A6B44), UL64(0x883ACB64D6AC57DC) },
+        { UL64(0x9982E2AC42E176A5), UL64(0x324EBA46E2782B64),
+          UL64(0x3D8CAAAFE18350F5), UL64(0xF3D82AF2F5D674CA),
+          UL64(0xC2090FED56600D1E), UL64(0x4548E0EF5950DE07),
+          UL64(0xB2F0023F765A4FEB), UL64(0xB303103339F16790) },
+        { UL64(0xA692781D61A3C8B3), UL64(0x08BC385432876D0E),
+          UL64(0xBECF05FB28027B03), UL64(0x636C687DA4B1E12F),
+          UL64(0x00E3003D07217C58), UL64(0x613BA9375E01B2A3),
+          UL64(0xA58C8405881DE16E), UL64(0xC653C43014F8F48B) },
+        { UL64(0xBC1C6897D6A0D0F9), UL64(0xD8E0EA0E3B0D7F55),
+          UL64(0xB35BAA92B85B7AAD), UL64(0x2BECD1B7674E48F4),
+          UL64(0xE2D7F78D6D7A9AC2), UL64(0xF5074262F99C95D0),
+          UL64(0x4852470A89F611E9), UL64(0xF7AA911992869DEC) },
+        { UL64(0xED7F2E774E6DAAE2), UL64(0x7B3AE0E39E0A19BC),
+          UL64(0xD3293F8A91AE677E), UL64(0xD363B0CB45C8611F),
+          UL64(0xBE1D1CCF309AE93B), UL64(0xA3F80BE73920CAE1),
+          UL64(0xAAACBA74498EDF01), UL64(0x1E6D2A4AB2F5AC90) },
+        { UL64(0x60C5F03F233550F1), UL64(0xD4D09411925AFD2E),
+          UL64(0xA95B65C3D258E5A6), UL64(0x1A19CFB59F902C6A),
+          UL64(0xB486013AF5AD5C68), UL64(0xA2506776979638F3),
+          UL64(0x1232B4D0A38E0B28), UL64(0xA64784B8D36A7B4F) },
+        { UL64(0x7FCFA19E0266A696), UL64(0x5E1F64FD92C3FB4B),
+          UL64(0x6D954911506D19DF), UL64(0x9F989FE1697A3CA1),
+          UL64(0x7E488D8C2327A87D), UL64(0xA543CE28037DA317),
+          UL64(0xEA071D76F93C5518), UL64(0x585FFD48220A6D3B) },
+        { UL64(0x5655179DE7D70E03), UL64(0x3E780C5C72A84570),
+          UL64(0xC102B4CB1D50029C), UL64(0x3E71BDD5F075E839),
+          UL64(0x6460F4F0B498B822), UL64(0x2682E06C6D4B8DA5),
+          UL64(0x4EAE53C996A740D4), UL64(0xC19D8BEF6389702C) },
+        { UL64(0x8735728DC2C6FF70), UL64(0x79D6122FC5DC2235),
+          UL64(0x23F5D00319E277F9), UL64(0x7EE84E25DDED8CC7),
+          UL64(0x91A8AFB063CD880A), UL64(0x3F3EA7C63574AF60),
+          UL64(0x0CFCDC8402DE7F42), UL64(0x62D0792FB31AA152) },
+        { UL64(0x959A47B2EE3B1655), UL64(0xC799B9DDEC883D5B),
+          UL64(0x2DC09F80B7933804), UL64(0xAE69E8883D2D3DB8),
+          UL64(0xC15D5E2F25E70AF4), UL64(0x875FD9CE05040085),
+          UL64(0x2850E8D06B5A38F2), UL64(0x15227F359ABEB0DA) },
+        { UL64(0x650F1037E0E523F2), UL64(0x4438AB439583013B),
+          UL64(0x034268FBEFC0905E), UL64(0x7B284BA20C06776B),
+          UL64(0x02B949C41B6C1133), UL64(0x7C3B8D47194BEF4F),
+          UL64(0x5FE15B000E7E0535), UL64(0xC326667428B126B4) },
+        { UL64(0xF8B99342E0921144), UL64(0xF14FC6F1B5033E2C),
+          UL64(0x7DFB3760DCDACF54), UL64(0xD25A0A31D88D7BA5),
+          UL64(0x4DED2FCB68F74977), UL64(0xF18847659A764007),
+          UL64(0x879DB169F2DCF4C7), UL64(0x744D75D5D16DF96A) },
+        { UL64(0x40FDF5AABECCEFB5), UL64(0xCF56EDE93621D7C7),
+          UL64(0xB632A9CE52B576C1), UL64(0xD3403AE89A6F6027),
+          UL64(0x660A050DE8785A64), UL64(0x10F3D6479682652E),
+          UL64(0x78B25EDF4FBCBE02), UL64(0xC9710FDEB4F9315D) },
+        { UL64(0x0F88009A1E0235F9), UL64(0x2FED40274820B8A1),
+          UL64(0xBE72B7AC86081140), UL64(0xD4162672601163E3),
+          UL64(0xF71EA3AD750C71EA), UL64(0x02347140AFDC8BE3),
+          UL64(0xA5E66F29C65AA66B), UL64(0xF3C7EC6407398FC8) },
+        { UL64(0x14096763179938A2), UL64(0x4FBA0E711C1CB877),
+          UL64(0xDA6F2A2F7CCF7CCF), UL64(0x91241A4E091BDE65),
+          UL64(0xCC2856C31E71FCD8), UL64(0xC0B87E7C12441CC3),
+          UL64(0x3DD1681EE5F224AA), UL64(0x30AED6F6AD7308EA) },
+        { UL64(0xD4B8B01728B53E22), UL64(0xE394D9480F7B7C71),
+          UL64(0xE21F2368B21CAFDF), UL64(0xC911FAB686CC7833),
+          UL64(0x0F61F6FD39D1CCD7), UL64(0xE216EB8B248D90A9),
+          UL64(0xA5058F44FC22D20D), UL64(0x9126969257C69628) },
+        { UL64(0x8E1B4E438A5807CE), UL64(0xAD283893E4109A7E),
+          UL64(0xC30CC9CBAFD59DDA), UL64(0xF65F36C63D8D8093),
+          UL64(0xDF31469EA60D32B2), UL64(0xEE93DF4B3E8191C8),
+          UL64(0x9C1017C5355BDEB5), UL64(0xD26231858616AA28) },
+        { UL64(0x38ED4F64A448ED10), UL64(0x81EB03A8C4EFB78B),
+          UL64(0xBFD91B5C91323B52), UL64(0xED882B33B6BEFF2E),
+          UL64(0xD0FB45516722D7A1), UL64(0x6F91441B949FE8AB),
+          UL64(0x63A44A993AC181A6), UL64(0xF4A62B5F950B6B74) },
+        { UL64(0x22614446E801A2CF), UL64(0xFA3A20272E478CDF),
+          UL64(0x102A0C9A98C650B3), UL64(0xC50093984873FF70),
+          UL64(0x87EC8606FAA16D01), UL64(0x0FC127949EDD4D8B),
+          UL64(0xE7A97A006F6BD460), UL64(0xF69CD1305EBEFF59) },
+        { UL64(0x6209D18662B5A228), UL64(0xB85D7DAAD4408B26),
+          UL64(0x7E48110F8EB1B300), UL64(0x66783CD20464AAAB),
+          UL64(0x2DF68B250F8BA061), UL64(0x97E0C461B2A08AEB),
+          UL64(0x6F8F6F0EBD640D38), UL64(0x993322E141475DA6) },
+        { UL64(0xD655ADE73245980E), UL64(0xA6F5965781067200),
+          UL64(0xE4FC23BEDB136BE1), UL64(0x9F246CDCAF13D879),
+          UL64(0xC2B93117F961AC0E), UL64(0xC8A741B5EBDB9E1A),
+          UL64(0x82EDE2466C693BD1), UL64(0xFCDE6B4F3DD1701E) },
+        { UL64(0x1F804E00CAA4646F), UL64(0x8643DC8870944924),
+          UL64(0xA37F1CA273F86DE9), UL64(0xA3199F9228889898),
+          UL64(0xC273BA580C1E4ADF), UL64(0x0F0D38AF65BC82F0),
+          UL64(0xD8B28AB5F8A6CD3B), UL64(0xEEA6E08575894D8E) },
+        { UL64(0x4642B9980EC93215), UL64(0xB719170A299D349F),
+          UL64(0xB32C162BBC36B5BA), UL64(0x063573854BD23CA2),
+          UL64(0xFF416292DFF68115), UL64(0xB7A150E34BB5DB99),
+          UL64(0xB97A2028A3C13D55), UL64(0x86F406C1E5424506) },
+        { UL64(0xFAB0C1B9B9CD95CF), UL64(0x3685ABB311A9AE73),
+          UL64(0x02973EAFA996A9A3), UL64(0xFF6F9BAF2934571D),
+          UL64(0xE4AB8121257C40E8), UL64(0x09AD28E4D92D30B1),
+          UL64(0x7C51A03509E4B582), UL64(0x60BB01F8C35B120F) },
+        { UL64(0xB02C83F9DEC31A21), UL64(0x988C8B236AD9D573),
+          UL64(0x53E983AEA57BE365), UL64(0xE968734D646F834E),
+          UL64(0x9137EA8F5DA6309B), UL64(0x10F3A624C1F1CE16),
+          UL64(0x782A9EA2CA440921), UL64(0xDF94739E5B46F1B5) },
+    },
+    {
+        { UL64(0x56F8410EF4F8B16A), UL64(0x97241AFEC47B266A),
+          UL64(0x0A406B8E6D9C87C1), UL64(0x803F3E02CD42AB1B),
+          UL64(0x7F0309A804DBEC69), UL64(0xA83B85F73BBAD05F),
+          UL64(0xC6097273AD8E197F), UL64(0xC097440E5067ADC1) },
+        { UL64(0x3F747FA0B311898C), UL64(0xE2A272E4CD0EAC65),
+          UL64(0x4BBA5851F914D0BC), UL64(0x7A1A9660C4A43EE3),
+          UL64(0xE5A367CEA1C8CDE9), UL64(0x9D958BA97271ABE3),
+          UL64(0xF3FF7EB63D1615CD), UL64(0xA2280DCEF5AE20B0) },
+        { UL64(0x266344A43794F8DC), UL64(0xDCCA923A483C5C36),
+          UL64(0x2D6B6BBF3F9D10A0), UL64(0xB320C5CA81D9BDF3),
+          UL64(0x620E28FF47B50A95), UL64(0x933E3B01CEF03371),
+          UL64(0xF081BF8599100153), UL64(0x183BE9A0C3A8C8D6) },
+        { UL64(0xB6C185C341DCA566), UL64(0x7DE7FEDAD8622AA3),
+          UL64(0x99E84D92901B6DFB), UL64(0x30A02B0E7C4AD288),
+          UL64(0xC7C81DAA2FD3CF36), UL64(0xD1319547DF89E59F),
+          UL64(0xB2BE8184CD496733), UL64(0xD5F449EB93D3412B) },
+        { UL64(0x25470FABE085116B), UL64(0x04A4337587285310),
+          UL64(0x4E39187EE2BFD52F), UL64(0x36166B447D9EBC74),
+          UL64(0x92AD433CFD4B322C), UL64(0x726AA817BA79AB51),
+          UL64(0xF96EACD8C1DB15EB), UL64(0xFAF71E910476BE63) },
+        { UL64(0xD74E9BDAC97E6516), UL64(0x88779360C230F49E),
+          UL64(0xA6EC1DE31E74EA49), UL64(0x581DCEE53FB645A2),
+          UL64(0xBAEF23918F483F14), UL64(0x6D2DDDFCD137D13B),
+          UL64(0x54CDE50ED2743A42), UL64(0x89A34FC5E4D97E67) },
+        { UL64(0x72CFD2E949DEE168), UL64(0x1AE052233E2AF239),
+          UL64(0x009E75BE1D94066A), UL64(0x6CCA31C738ABF413),
+          UL64(0xB50BD61D9BC49908), UL64(0x4A9B4A8CF5E2BC1E),
+          UL64(0xEB6CC5F7946F83AC), UL64(0x27DA93FCEBFFAB28) },
+        { UL64(0xC492EC644CD8F64C), UL64(0x58A2D790279D7B51),
+          UL64(0x0CED1FC51FC75256), UL64(0x3E658AED8F433017),
+          UL64(0x0B61942E05DA59EB), UL64(0xBA3D60A30DDC3722),
+          UL64(0x7C311CD1742E7F87), UL64(0x6473FFEEF6B01B6E) },
+        { UL64(0x3CE519EF76257C51), UL64(0x6F5818D318D477E7),
+          UL64(0xAB022E037963EDC0), UL64(0xF0403A898BD1F5F3),
+          UL64(0xE43B8DA0496033CA), UL64(0x0994E10EA1CFDD72),
+          UL64(0xB1EC6D20BA73C0E2), UL64(0x0329C9ECB6BCFAD1) },
+        { UL64(0xF1FF42A12C84BD9D), UL64(0x751F3EC4390C674A),
+          UL64(0x27BB36F701E5E0CA), UL64(0x65DFFF515CAF6692),
+          UL64(0x5DF579C4CD7BBD3F), UL64(0xEF8FB29785591205),
+          UL64(0x1DED7203E47AC732), UL64(0xA93DC45CCD1C331A) },
+        { UL64(0xBDEC338E3318D2D4), UL64(0x733DD7BBBE8DE963),
+          UL64(0x61BCC3BAA2C47EBD), UL64(0xA821AD1935EFCBDE),
+          UL64(0x91AC668C024CDD5C), UL64(0x7BA558E4C1CDFA49),
+          UL64(0x491D4CE0908FB4DA), UL64(0x7BA869F9F685BDE8) },
+        { UL64(0x7B2A0BCB81F41C78), UL64(0x5C522C851FD240E1),
+          UL64(0xCE512E68DF5CE3F6), UL64(0xA7D4B952B6D5EE13),
+          UL64(0x8CDC0A8B31AD7EAF), UL64(0x165E86751B915E20),
+          UL64(0x8E8C269B5D6477F4), UL64(0xD28D5ADE44421B91) },
+        { UL64(0xED1B5EC279F464BA), UL64(0x2D65E42C47D72E26),
+          UL64(0x8198E5749E67F926), UL64(0x4106673834747E44),
+          UL64(0x4637ACC1E37E5447), UL64(0x02CBC9ECF3E15822),
+          UL64(0x58A8E98E805AA83C), UL64(0x73FACD6E5595E800) },
+        { UL64(0x197CFDB332A92318), UL64(0x9EBEA84125AC87B6),
+          UL64(0x4CD805F7A3510C7A), UL64(0x24DF999AE06E428E),
+          UL64(0xD54DD5DC4D71459C), UL64(0x1484324F20B8A03C),
+          UL64(0x7924F2D93174B927), UL64(0x42B8ACBFF93ADE50) },
+        { UL64(0x468FF80338330507), UL64(0x06F34DDF4037A53E),
+          UL64(0x70CD1A408D6993A4), UL64(0xF85A159743E5C022),
+          UL64(0x396FC9C2C125A67D), UL64(0x03B7BEBF1064BFCB),
+          UL64(0x7C444592A9806DCB), UL64(0x1B02614B4487CD54) },
+        { UL64(0x8303604F692AC542), UL64(0xF079FFE1227B91D3),
+          UL64(0x19F63E6315AAF9BD), UL64(0xF99EE565F1F344FB),
+          UL64(0x8A1D661FD6219199), UL64(0x8C883BC6D48CE41C),
+          UL64(0x1065118F3C74D904), UL64(0x713889EE0FAF8B1B) },
+        { UL64(0xB47B60F70DE21BB6), UL64(0x64ACAE4FDCD836CA),
+          UL64(0x3375EA6DC744CE63), UL64(0xB764265FB047955B),
+          UL64(0xC68A5D4C9841C2C3), UL64(0x60E98FD7CF454F60),
+          UL64(0xC701FBE2756AEA0C), UL64(0x09C8885EAAB21C79) },
+        { UL64(0xCA1359EF91D1BDCF), UL64(0x6A082157F3592586),
+          UL64(0xD9AEA5943951951C), UL64(0x57ABEF24A2B7E706),
+          UL64(0x3FA5721E2E2EB1A2), UL64(0x3C68EEAC516ACE98),
+          UL64(0xFFA79D47C28782DF), UL64(0xBDD69F634E16577B) },
+        { UL64(0x45BB810869D2D46C), UL64(0xE47C8B3968C8365A),
+          UL64(0xF3B87663267551BD), UL64(0x1590768F5B67547A),
+          UL64(0x371C1DB2FB2ED3FF), UL64(0xE316691917A59440),
+          UL64(0x03C0D178DF242C14), UL64(0x40C93FCEED862AC1) },
+        { UL64(0x402B7960C5BB84AF), UL64(0xCF29C7DCBCC8A639),
+          UL64(0xFAF19DFF478F7C6D), UL64(0x71306AE43337BD22),
+          UL64(0xEF7C5505BF599B7A), UL64(0xE09E159E9C4691A8),
+          UL64(0xD403E81874CEB119), UL64(0x5325E7025211A98D) },
+        { UL64(0x1286DA692BC982D6), UL64(0x5F6D80F27BDAE7E3),
+          UL64(0x3D9C5647A6F064FB), UL64(0xFDC8E6A1D74C1540),
+          UL64(0x97DA48C6D68B135A), UL64(0xC2097979D66DBFFF),
+          UL64(0x0296ADB9EA20531D), UL64(0xA333730D4AB2C8F0) },
+        { UL64(0xAF97122B7A251933), UL64(0x36C7349CC1233345),
+          UL64(0x5687DE8873F400B0), UL64(0x922847A3707595AF),
+          UL64(0xB7E018587FF6DEC1), UL64(0x6E283ECE2FC191CB),
+          UL64(0x78C2EF8B1C20DC56), UL64(0x51E6535E452ED2DC) },
+        { UL64(0x0EB3565429847FED), UL64(0xFDC142860A673DD0),
+          UL64(0x721B36278B62DD0B), UL64(0x105A293E711A5771),
+          UL64(0xDF001CCE7F761927), UL64(0xF7B681B011D04C7D),
+          UL64(0x16DFF792A3AC1996), UL64(0x580C120B0FC4AE30) },
+        { UL64(0xC035F697960EB8C7), UL64(0xF1599F2CE2DE04D3),
+          UL64(0x892450F8D2AD9228), UL64(0x7D48129BB829C1AB),
+          UL64(0x24D785E13A50AFC9), UL64(0x2745BA2763A96EE0),
+          UL64(0x956534013BFB6D7B), UL64(0x536202671BAD2A42) },
+        { UL64(0x31EA3D4F7EE8D0BC), UL64(0x3832F22A0F42C3DC),
+          UL64(0xC661061A1A87A2F4), UL64(0x0978C9F64B45576B),
+          UL64(0xB7ABAC3C6DFB5FD2), UL64(0x27F36A00B7E01B90),
+          UL64(0x68F733CDE9429E36), UL64(0x953A4681DCBFE8CB) },
+        { UL64(0xE396FF244103C2E3), UL64(0x4133561C1B06ADE7),
+          UL64(0xE120B9AC65D0A734), UL64(0x576F6F07927919D9),
+          UL64(0xA0CFC846691F955A), UL64(0x3D2E2BC0A6449D65),
+          UL64(0x7BA541B89767ED9B), UL64(0xD1B21B04DC9215C7) },
+        { UL64(0xBFB7C41067FE1EAF), UL64(0xA2073C6A6929A785),
+          UL64(0x6F2536F4A75FDB79), UL64(0x859AD26D809BCA69),
+          UL64(0x06F2C0693B197E7B), UL64(0x656AD9F48EC0A573),
+          UL64(0xE7C7901F9A4D0262), UL64(0xBEC29443B938602B) },
+        { UL64(0xD00397FC0F0073A4), UL64(0x5B668FA46F8D675F),
+          UL64(0x14374AC91522108C), UL64(0x92EFA7D10283E42E),
+          UL64(0x673E6DF90B6D024A), UL64(0x05F914D457581F26),
+          UL64(0xF5C8516267DF8C12), UL64(0x1197F1B4E06C2462) },
+        { UL64(0x6E2D1CB3DD9C90C1), UL64(0x28F82D5A7990579E),
+          UL64(0x90E189CD06226195), UL64(0xBD2939DF19B0DC74),
+          UL64(0x18B18505C0917177), UL64(0xEED5470D3117D9C4),
+          UL64(0x39EF92EB6C893CA0), UL64(0x4533EF8244A41940) },
+        { UL64(0x62AC853C2D2D7595), UL64(0x4883DAB7598FAD54),
+          UL64(0xBBF7F5D16D32D7A4), UL64(0x95FB4F2DFD1DD881),
+          UL64(0xE239AEF2545DC580), UL64(0x4609A70A4D1E39B9),
+          UL64(0x61D3B33E338EBBB2), UL64(0x06051DC215BD5461) },
+        { UL64(0xCAEE9DEC34943DDA), UL64(0x8E50E98E8B4B6782),
+          UL64(0x24358EA591EA3A1F), UL64(0x71C4C827A9E1C194),
+          UL64(0xA38BAA5D09BB7A94), UL64(0xFB4AB4C057B58F9C),
+          UL64(0x4A01065E24E0EE19), UL64(0xB9CF805107B877BF) },
+        { UL64(0x972B3F8F81A1B3BE), UL64(0x4F3CE145CE2764A0),
+          UL64(0xE2D0F1CC28C4F5F7), UL64(0xDEEE0C0DC7F3985B),
+          UL64(0x7DF4ADC0D39E25C3), UL64(0x40619820C467A080),
+          UL64(0x440EBC9361CF5A58), UL64(0x527729A6422AD600) },
+    },
+    {
+        { UL64(0xEFB26A753F73F449), UL64(0x1D1C94F88D44FC79),
+          UL64(0x49F0FBC53BC0DC4D), UL64(0xB747EA0B3698A0D0),
+          UL64(0x5218C3FE228D291E), UL64(0x35B804B543C129D6),
+          UL64(0xFAC859B8D1ACC516), UL64(0x6C10697D95D6E668) },
+        { UL64(0x6E30251ACB452FDB), UL64(0x31EE696550F30650),
+          UL64(0xB0B3E508933548D9), UL64(0xB8949A4FF4B0EF5B),
+          UL64(0x208B83263C88F3BD), UL64(0xAB147C30DB1D9989),
+          UL64(0xED6515FD44D4DF03), UL64(0x17A12F75E72EB0C5) },
+        { UL64(0x7A6CBBE028E3FE89), UL64(0xE7E1FEE4C5AAC0EB),
+          UL64(0x7F47EDA5697E5140), UL64(0x4F450137B454921F),
+          UL64(0xDB625F8495CD8185), UL64(0x74BE0BA1CDB2E583),
+          UL64(0xAEE4FD7CDD5E6DE4), UL64(0x4251437DE8101739) },
+        { UL64(0x25914F7881FDAD90), UL64(0xCF638F560D2CF6AB),
+          UL64(0xB90BC03FCC054DE5), UL64(0x932811A718B06350),
+          UL64(0x2F00B3309BBD11FF), UL64(0x76108A6FB4044974),
+          UL64(0x801BB9E0A851D266), UL64(0x0DD099BEBF8990C1) },
+        { UL64(0x115EB20A517D7061), UL64(0x77FE34336C2DF683),
+          UL64(0x6870DDC7CDC6FC67), UL64(0xB16105880B87DE83),
+          UL64(0x343584CAD9C4DDBE), UL64(0xB3164F1C3D754BE2),
+          UL64(0x0731ED3AC1E6C894), UL64(0x26327DEC4F6B904C) },
+        { UL64(0x29267BAEC61C3855), UL64(0xEBFF429D58C1FD3B),
+          UL64(0x22D886C08C0B93B8), UL64(0xCA5E00B22DDB8953),
+          UL64(0xCF330117C3FED8B7), UL64(0xD49AC6FA819C01F6),
+          UL64(0x6DDAA6BD3C0FBD54), UL64(0x917430688049A2CF) },
+        { UL64(0x0A6A063C7672765A), UL64(0x37A3CE640547B9BF),
+          UL64(0x42C099C898B1A633), UL64(0xB5AB800D05EE6961),
+          UL64(0xF1963F5911A5ACD6), UL64(0xBAEE615746201063),
+          UL64(0x36D9A649A596210A), UL64(0xAED043631BA7138C) },
+        { UL64(0x14C6DD8A58D6CD46), UL64(0x9CB633B58E6634D2),
+          UL64(0xC1305047F81BC328), UL64(0x12EDE0E226A177E5),
+          UL64(0x332CCA62065A6F4F), UL64(0xC3A47ECD67BE487B),
+          UL64(0x741EB1870F47ED1C), UL64(0x99E66E58E7598B14) },
+        { UL64(0x36822876F51FE76E), UL64(0x8A6811CC11D62589),
+          UL64(0xC3FC7E6546225718), UL64(0xB7DF2C9FC82FDBCD),
+          UL64(0x3B1D4E52DD7B205B), UL64(0xB695947847A2E414),
+          UL64(0x05E4D793EFA91148), UL64(0xB47ED446FD2E9675) },
+        { UL64(0x8F0ED0E2EBF3232F), UL64(0xFFF80F9EC52A2EDD),
+          UL64(0xAD9AB43375B55FDB), UL64(0x73CA7820E42E0C11),
+          UL64(0x6DACE0A0E6251B46), UL64(0x89BC6B5C4C0D932D),
+          UL64(0x3438CD77095DA19A), UL64(0x2F24A9398D48BDFB) },
+        { UL64(0x1D5DC4515541B892), UL64(0xB186EE41FC9D9E54),
+          UL64(0x9D9F345ED5BF610D), UL64(0x3E7BA65DF6ACCA9F),
+          UL64(0x9DDA787AA8369486), UL64(0x09F9DAB78EB5BA53),
+          UL64(0x5AFB2033D6481BC3), UL64(0x76F4CE30AFA62104) },
+        { UL64(0xEBD6A6777B0AC93D), UL64(0xA6E37B0D78F5E0D7),
+          UL64(0x2516C09676F5492B), UL64(0x1E4BF8889AC05F3A),
+          UL64(0xCDB42CE04DF0BA2B), UL64(0x935D5CFD5062341B),
+          UL64(0x8A30333382ACAC20), UL64(0x429438C45198B00E) },
+        { UL64(0x3F99183C5A1F8E24), UL64(0xFDB118FA9DD255F0),
+          UL64(0xB9B18B90C27F62A6), UL64(0xE8F732F7396EC191),
+          UL64(0x524A2D910BE786AB), UL64(0x5D32ADEF0AC5A0F5),
+          UL64(0x9B53D4D69725F694), UL64(0x032A76C60510BA89) },
+        { UL64(0xA49B5D595758B11C), UL64(0x0B852893C8654F40),
+          UL64(0xB63EF6F452379447), UL64(0xD4957D29105E690C),
+          UL64(0x7D484363646559B0), UL64(0xF4A8273C49788A8E),
+          UL64(0xEE406CB834CE54A9), UL64(0x1E1C260FF86FDA9B) },
+        { UL64(0x9DBD79740E954750), UL64(0x0121DE8864F9D2C6),
+          UL64(0x2E597B42D985232E), UL64(0x55B6C3C553451777),
+          UL64(0xBB53E547519CB9FB), UL64(0xF134019F8428600D),
+          UL64(0x5A473176E081791A), UL64(0x2F3E226335FB0C08) },
+        { UL64(0xFB2838BE67E573E0), UL64(0x05891DB94084C44B),
+          UL64(0x9131137396C1C2C5), UL64(0x6AEBFA3FD958444B),
+          UL64(0xAC9CDCE9E56E55C1), UL64(0x7148CED32CAA46D0),
+          UL64(0x2E10C7EFB61FE8EB), UL64(0x9FD835DAFF97CF4D) },
+        { UL64(0x9BEDA18D431D99DD), UL64(0xF7690B3DF3D5CCE1),
+          UL64(0x97FB656DB7326EC9), UL64(0xC1B271448C95739C),
+          UL64(0x65ECEA899C21E298), UL64(0xD0E5729137355734),
+          UL64(0x80BD7C2B2165EB3D), UL64(0xDF1E16E7DCC0F1C0) },
+        { UL64(0x97E58FAD0C07C832), UL64(0x73EE50A441C3439B),
+          UL64(0x230643A48E1F0E20), UL64(0x533C7F8BCEEBC6A3),
+          UL64(0x4DA647B37163E1B5), UL64(0x1A650D4C410B26FA),
+          UL64(0x0DA53A64DDE8FDFB), UL64(0x0CE786DF88D80C73) },
+        { UL64(0x19CF9227238F0ACA), UL64(0x6386ADD4ABAC4CFD),
+          UL64(0x17B6C4A05E5CDE7F), UL64(0x172B5758C9AA5607),
+          UL64(0x0FA265C55F01E78C), UL64(0x1FB2FDFBDC124D1E),
+          UL64(0xCF238D3C9BF223F8), UL64(0x3C5C2C8D0394BB6B) },
+        { UL64(0x6C626F56C1770616), UL64(0x5351909E09DA9A2D),
+          UL64(0xE58E6825A3730E45), UL64(0x9D8C8BC003EF0A79),
+          UL64(0x543F78B6056BECFD), UL64(0x33F13253A090B36D),
+          UL64(0x82AD4997794432F9), UL64(0x1386493C4721F502) },
+        { UL64(0xDCC413F1D49ED714), UL64(0x18D3D6276AC2B4D8),
+          UL64(0x0F157A455347BCF8), UL64(0x4A13F4122694C944),
+          UL64(0xE3ABBF7C397700DD), UL64(0x72A88A916C4EEF39),
+          UL64(0xB149F8DB4606479C), UL64(0xFF44B1AB54C2D3B3) },
+        { UL64(0x8875AC364B833D09), UL64(0xCAC97712F0ED5C9B),
+          UL64(0x7AF55D8F0281520D), UL64(0x06F7473B46936237),
+          UL64(0x8A5BCA51FE6F84D6), UL64(0x764B6F4B84274FA7),
+          UL64(0xFA3091DCB964C01D), UL64(0x6D1F26F60A3AB846) },
+        { UL64(0x0D0BF55F8AC0CFF0), UL64(0xD9598882C150EB54),
+          UL64(0x22A4A72C51C293D0), UL64(0xF86C57F6643C198A),
+          UL64(0x97AB91B020395710), UL64(0x9AE1716C1970DBC0),
+          UL64(0x5B7A2BA2CCE53DF8), UL64(0xB2799A99FC85D64C) },
+        { UL64(0x3794EEFA5ABEA82A), UL64(0x8DC611B993FE62D4),
+          UL64(0x69F1AF37281EF606), UL64(0x6AF546C839839E69),
+          UL64(0x625578C7C977EC23), UL64(0xA8DE294CBD5C0576),
+          UL64(0xE2DDAF0F7CD1A4C0), UL64(0x8243FC704F95F4D4) },
+        { UL64(0x94C5ABDA50E71812), UL64(0x0294743503BB6A7C),
+          UL64(0x02A153AB798FBF14), UL64(0xF8EF26C87A2F284E),
+          UL64(0x863C925D05F99EDC), UL64(0x976D81E6409B35DD),
+          UL64(0xEF3A5A99DCE99170), UL64(0xAABC80EC53131DE6) },
+        { UL64(0x19417C64C940B335), UL64(0x51454EF5AF6E97E9),
+          UL64(0x763C9BACED16309C), UL64(0xE26D174D81464804),
+          UL64(0xA05A428635197497), UL64(0xA410FA71ADEDB109),
+          UL64(0x7219CAB7DA95F76E), UL64(0x74C323E7BE88D11F) },
+        { UL64(0xE1BB91D6B2DB103C), UL64(0xBE593DB192E2C2E3),
+          UL64(0x53F949CAB45E25C1), UL64(0x6A39E6160A6E2F23),
+          UL64(0x0213E26E1357D70A), UL64(0x73741C1A8E623E9C),
+          UL64(0x54DFA9BA8D9399B2), UL64(0x86310C400C598C32) },
+        { UL64(0xE566F400B008733A), UL64(0xCBA0697D512E1F57),
+          UL64(0x9537C2B240509CD0), UL64(0x5F989C6957353D8C),
+          UL64(0x7DBEC9724C3C2B2F), UL64(0x90E02FA8FF031FA8),
+          UL64(0xF4D15C53CFD5D11F), UL64(0xB3404FAE48314DFC) },
+        { UL64(0xB6F0BBA3B4CA5FEF), UL64(0x4919FCE20FD19008),
+          UL64(0x18B4D18D1BD12ADC), UL64(0xB22F3A88C81C8E9C),
+          UL64(0x86F5B12CCC7C2949), UL64(0xA2F61AD805DE987F),
+          UL64(0x69742172ED727970), UL64(0x3E9F2C8ED7434EC7) },
+        { UL64(0xD1490EF8212C52B4), UL64(0x5B2FFDEA00B75A7B),
+          UL64(0xF2C7B23EBF958BA1), UL64(0x43B42039696CBAAA),
+          UL64(0x1F5BDE9402BE3496), UL64(0x3ABE9D6B39EFA5C4),
+          UL64(0x2A207FDE47077E82), UL64(0x3BC374FC65862928) },
+        { UL64(0x35D40E1D540604C4), UL64(0x16A4B33A3A486FED),
+          UL64(0x9170496CEE43A4A1), UL64(0x174ADBE1AD948AAF),
+          UL64(0x8A47A30A5451DF99), UL64(0x7CCABDD19E1791A1),
+          UL64(0x7112B53AECFCF12A), UL64(0x561EB395FAB5C6D2) },
+        { UL64(0xA36DA109081E9387), UL64(0xFB9780D78C935828),
+          UL64(0xD5940332E540B015), UL64(0xC9D7B51BE0F466FA),
+          UL64(0xFAADCD41D6D9F671), UL64(0xBA6C1E28B1A2AC17),
+          UL64(0x066A7833ED201E5F), UL64(0x19D99719F90F462B) },
+    },
+    {
+        { UL64(0xF431F462060B5F61), UL64(0xA56F46B47BD057C2),
+          UL64(0x348DCA6C47E1BF65), UL64(0x9A38783E41BCF1FF),
+          UL64(0x7A5D33A9DA710718), UL64(0x5A7799872E0AEAF6),
+          UL64(0xCA87314D2D29D187), UL64(0xFA0EDC3EC687D733) },
+        { UL64(0x1C894849CB198AC7), UL64(0xA884A93D0F264665),
+          UL64(0x2DA964EF9B200678), UL64(0x3C351B87009834E6),
+          UL64(0xAFB2EF9FE2C4B44B), UL64(0x580F6C473326790C),
+          UL64(0xB84805210B02264A), UL64(0x8BA6F9E242A194E2) },
+        { UL64(0x499B6AB65EB03C0E), UL64(0xF19B795472BC3FDE),
+          UL64(0xA86B5B9C6E3A80D2), UL64(0xE43775086D42819F),
+          UL64(0xC1663650BB3EE8A3), UL64(0x75EB14FCB132075F),
+          UL64(0xA8CCC9067AD834F6), UL64(0xEA6A2474E6E92FFD) },
+        { UL64(0x39D934ABD3C095F1), UL64(0x04B261BEE4B76D71),
+          UL64(0x1D2E6970E73E6984), UL64(0x879FB23B5E5FCB11),
+          UL64(0x11506C72DFD75490), UL64(0x3A97D08561BCF1C1),
+          UL64(0x43201D82BF5E7007), UL64(0x7F0AC52F798232A7) },
+        { UL64(0xCB4D20EE4B049136), UL64(0x8B63BF12356A4613),
+          UL64(0x1221AEF670E08128), UL64(0xE62D8C514ACB6B16),
+          UL64(0x71F64A67379E7896), UL64(0xB25237A2CAFD7FA5),
+          UL64(0xF077BD983841BA6A), UL64(0xC4AC02443CD16E7E) },
+        { UL64(0xB25101FB319D7682), UL64(0xB02931290A982FEE),
+          UL64(0x51C1C9B90261B344), UL64(0x0E008C5BBFD371FA),
+          UL64(0xD866DD1C0278CA33), UL64(0x666F76A6E5AA53B1),
+          UL64(0xE5CFB7796013A2CF), UL64(0x1D3A1AADA3521836) },
+        { UL64(0x3C5604FF50F75F9C), UL64(0x1D8EDDF37E752B22),
+          UL64(0x0EF074DD3C9A1118), UL64(0xD0FFC172CCB86D7B),
+          UL64(0xABD1ECE3037D90F2), UL64(0xE3F307D66055856C),
+          UL64(0x422F93287E4C6DAF), UL64(0x902AAC66334879A0) },
+        { UL64(0x76B4131A567193EC), UL64(0xAF3C305AE5F6E70B),
+          UL64(0x9587BD39031EEBDD), UL64(0x5709DEF871BBE831),
+          UL64(0x570599830EB2B669), UL64(0x4D80CE1B875B7029),
+          UL64(0x838A7DA80364AC16), UL64(0x2F431D23BE1C83AB) },
+        { UL64(0x8E52874CB940C71E), UL64(0x211935A9DB5F4B3A),
+          UL64(0x94350492301B1DC3), UL64(0x33D2646D29958620),
+          UL64(0x16B0D64BEF911404), UL64(0x9D1F25EA9A3C5EF4),
+          UL64(0x20F200EB4A352C78), UL64(0x43929F2C4BD0B428) },
+        { UL64(0xE781276638235D4E), UL64(0x1C62BD67496E3298),
+          UL64(0x8378660C3F175BC8), UL64(0x4D04E18917AFDD4D),
+          UL64(0x32A8160185A8068C), UL64(0xDB58E4E192B29A85),
+          UL64(0xE8A65B86C70D8A3B), UL64(0x5F0E6F4E98A0403B) },
+        { UL64(0xD44636E6E82C9F9E), UL64(0x711DB87CC33A1043),
+          UL64(0x6F431263AA8AEC05), UL64(0x43FF120D2744A4AA),
+          UL64(0xD3BD892FAE77779B), UL64(0xF0FE0CC98CDC9F82),
+          UL64(0xCA5F7FE6F1C5B1BC), UL64(0xCC63A68244929A72) },
+        { UL64(0x2C2492B73F894AE0), UL64(0xF59DF3E5B75F18CE),
+          UL64(0x7CB740D28F53CAD0), UL64(0x3EB585FBC4F01294),
+          UL64(0x17DA0C8632C7F717), UL64(0xEB8C795BAF943F4C),
+          UL64(0x4EE23FB5F67C51D2), UL64(0xEF18757568889949) },
+        { UL64(0x2834DA3EB38DFF6F), UL64(0xBE012C52EA636BE8),
+          UL64(0x292D238C61DD37F8), UL64(0x0E54523F8F8142DB),
+          UL64(0xE31EB436036A05D8), UL64(0x83E3CDFF1E93C0FF),
+          UL64(0x3FD2FE0F50821DDF), UL64(0xC8E19B0DFF9EB33B) },
+        { UL64(0x3EA011A4E822F0D0), UL64(0xBC647AD15A8704F8),
+          UL64(0xBB315B3550C6820F), UL64(0x863DEC3DB7E76BEC),
+          UL64(0x01FF5D3AF017BFC7), UL64(0x20054439976B8229),
+          UL64(0x067FCA370BBD0D3B), UL64(0xF63DDE647F5E3D0F) },
+        { UL64(0x147D90525E9CA895), UL64(0x2F4DD31E972072DF),
+          UL64(0xA16FDA8EE6C6755C), UL64(0xC66826FFCF196558),
+          UL64(0x1F1A76A30CF43895), UL64(0xA9D604E083C3097B),
+          UL64(0xE190830966390E0E), UL64(0xA50BF753B3C85EFF) },
+        { UL64(0x75D9BC15ADF7CCCF), UL64(0x81A3E5D6DFA1E1B0),
+          UL64(0x8C39E444249BC17E), UL64(0xF37DCCB28EA7FD43),
+          UL64(0xDA654873907FBA12), UL64(0x35DAA6DA4A372904),
+          UL64(0x0564CFC66283A6C5), UL64(0xD09FA4F64A9395BF) },
+        { UL64(0x0D64F9A76F568431), UL64(0xF848C27C02F8898C),
+          UL64(0xF418ADE1260B5BD5), UL64(0xC1F3E3236973DEE8),
+          UL64(0x46E9319C26C185DD), UL64(0x6D85B7D8546F0AC4),
+          UL64(0x427965F2247F9D57), UL64(0xB519B636B0035F48) },
+        { UL64(0xB510B3B56AA39DFF), UL64(0x59B43DA29F8E4D8C),
+          UL64(0xA8CE31FD9E4C4B9F), UL64(0x0E20BE26C1303C01),
+          UL64(0x18187182E8EE47C9), UL64(0xD9687CDB7DB98101),
+          UL64(0x7A520E4DA1E14FF6), UL64(0x429808BA8836D572) },
+        { UL64(0x682AC1E5DDA9E5C6), UL64(0x4E0D3C72CAA9FC95),
+          UL64(0x17FAAADE772BEA44), UL64(0x5EF8428CAB0009C8),
+          UL64(0xCC4CE47A460FF016), UL64(0xDA6D12BF725281CB),
+          UL64(0x44C678480223AAD2), UL64(0x6E342AFA36256E28) },
+        { UL64(0x174D46996D16768E), UL64(0x9FC4FF6A628BF217),
+          UL64(0x77705A94154E490D), UL64(0x9D96DD288D2D997A),
+          UL64(0x77E2D9D8CE5D72C4), UL64(0x9D06C5A4C11C714F),
+          UL64(0x02AA513679E4A03E), UL64(0x1386B3C2030FF28B) },
+        { UL64(0xB86186B68BCEC9C2), UL64(0x7CF24DF9680B9F06),
+          UL64(0xC46B45EAC0D29281), UL64(0xFFF42BC507B10E12),
+          UL64(0x12263C404D289427), UL64(0x3D5F1899B4848EC4),
+          UL64(0x11F97010D040800C), UL64(0xB4C5F529300FEB20) },
+        { UL64(0x26A42D69EA40DC3A), UL64(0xDC84AD22AECC018F),
+          UL64(0x25C36C7B3270F04A), UL64(0x46BA6D4750FA72ED),
+          UL64(0x6C37D1C593E58A8E), UL64(0xA2394731120C088C),
+          UL64(0xC3BE4263CB6E86DA), UL64(0x2C417D367126D038) },
+        { UL64(0x9D3D116DB07159D0), UL64(0xAE07A67FC1896210),
+          UL64(0x8FC84D87BB961579), UL64(0x30009E491C1F8DD6),
+          UL64(0x8A8CAF22E3132819), UL64(0xCFFA197CF23AB4FF),
+          UL64(0x58103A44205DD687), UL64(0x57B796C30DED67A2) },
+        { UL64(0xCCA523BB440E2229), UL64(0x324673A273EF4D04),
+          UL64(0xAF3ADF343E11EC39), UL64(0x6136D7F1DC5968D3),
+          UL64(0x7A7B2899B053A927), UL64(0x3EAA2661AE067ECD),
+          UL64(0x8549B9C802779CD9), UL64(0x061D7940C53385EA) },
+        { UL64(0xD7D27A89B3E93CE7), UL64(0xF7B5A8755D3A2C1B),
+          UL64(0xB29E68A0255B218A), UL64(0xB533837E8AF76754),
+          UL64(0xD1B05A73579FAB2E), UL64(0xB41055A1ECD74385),
+          UL64(0xB2369274445E9115), UL64(0x2972A7C4F520274E) },
+        { UL64(0xE07141FCAAA2902B), UL64(0x539AD799E4F69AD3),
+          UL64(0xA6453F94813F9FFD), UL64(0xC58D3C48375BC2F7),
+          UL64(0xB3326FAD5DC64E96), UL64(0x3AAFCAA9B240E354),
+          UL64(0x1D1B0903ACA1E7A9), UL64(0x4CEB97671211B8A0) },
+        { UL64(0x5E942E79C81710A0), UL64(0x557E4A3627CCADD4),
+          UL64(0x72A2BC564BCF6D0C), UL64(0x09EE5F4326D7B80C),
+          UL64(0x6B70DBE9D4292F19), UL64(0x56F74C2663F16B18),
+          UL64(0xC23DB0F735FBB42A), UL64(0xB606BDF66AE10040) },
+        { UL64(0x1EB4DE4687032D58), UL64(0xC54F3D835E2C79E0),
+          UL64(0x07818DF45D04EF23), UL64(0x55FAA9C8673D41B4),
+          UL64(0xCED64F6F89B95355), UL64(0x4860D2EAB7415C84),
+          UL64(0x5FDB9BD2050EBAD3), UL64(0xDB53E0CC6685A5BF) },
+        { UL64(0x9A61D2A08B1EA7B3), UL64(0xD495AB63AE8B1485),
+          UL64(0x38740F8487052F99), UL64(0x178EBE5BB2974EEA),
+          UL64(0x030BBCCA5B36D17F), UL64(0xB5E4CCE3AAF86EEA),
+          UL64(0xB51A022068F8E9E0), UL64(0xA434879609EB3E75) },
+        { UL64(0x919FCA5FABFAE1CA), UL64(0x937AFAAC1A21459B),
+          UL64(0x9E0CA91C1F66A4D2), UL64(0x194CC7F323EC1331),
+          UL64(0xAD25143A8AA11690), UL64(0xBE40AD8D09B59E08),
+          UL64(0x37D60D9BE750860A), UL64(0x6C53B008C6BF434C) },
+        { UL64(0xA661A0D01D3EC517), UL64(0x98744652512321AE),
+          UL64(0x084CA591ECA92598), UL64(0xA9BB9DC91DCB3FEB),
+          UL64(0x14C5435578B4C240), UL64(0x5ED62A3B610CAFDC),
+          UL64(0x07512F371B38846B), UL64(0x571BB70AB0E38161) },
+        { UL64(0x832D7080EB6B242D), UL64(0xD30BD0233B71E246),
+          UL64(0x7027991BBE31139D), UL64(0x68797E91462E4E53),
+          UL64(0x423FE20A6B4E185A), UL64(0x82F2C67E42D9B707),
+          UL64(0x25C817684CF7811B), UL64(0xBD53005E045BB95D) },
+    },
+    {
+        { UL64(0xE5F649BE9D8E68FD), UL64(0xDB0F05331B044320),
+          UL64(0xF6FDE9B3E0C33398), UL64(0x92F4209B66C8CFAE),
+          UL64(0xE9D1AFCC1A739D4B), UL64(0x09AEA75FA28AB8DE),
+          UL64(0x14375FB5EAC6F1D0), UL64(0x6420B560708F7AA5) },
+        { UL64(0x9EAE499C6254DC41), UL64(0x7E2939247A837E7E),
+          UL64(0x74AEC08C090524A7), UL64(0xF82B92198D6F55F2),
+          UL64(0x493C962E1402CEC5), UL64(0x9F17CA17FA2F30E7),
+          UL64(0xBCD783E8E9B879CB), UL64(0xEA3D8C145A6F145F) },
+        { UL64(0xDEDE15E75E0DEE6E), UL64(0x74F24872DC628AA2),
+          UL64(0xD3E9C4FE7861BB93), UL64(0x56D4822A6187B2E0),
+          UL64(0xB66417CFC59826F9), UL64(0xCA2609692408169E),
+          UL64(0xEDF69D06C79EF885), UL64(0x00031F8ADC7D138F) },
+        { UL64(0x103C46E60EBCF726), UL64(0x4482B8316231470E),
+          UL64(0x6F6DFACA487C2109), UL64(0x2E0ACE9762E666EF),
+          UL64(0x3246A9D31F8D1F42), UL64(0x1B1E83F1574944D2),
+          UL64(0x13DFA63AA57F334B), UL64(0x0CF8DAED9F025D81) },
+        { UL64(0x30D78EA800EE11C1), UL64(0xEB053CD4B5E3DD75),
+          UL64(0x9B65B13ED58C43C5), UL64(0xC3AD49BDBD151663),
+          UL64(0x99FD8E41B6427990), UL64(0x12CF15BD707EAE1E),
+          UL64(0x29AD4F1B1AABB71E), UL64(0x5143E74D07545D0E) },
+        { UL64(0x30266336C88BDEE1), UL64(0x25F293065876767C),
+          UL64(0x9C078571C6731996), UL64(0xC88690B2ED552951),
+          UL64(0x274F2C2D852705B4), UL64(0xB0BF8D444E09552D),
+          UL64(0x7628BEEB986575D1), UL64(0x407BE2387F864651) },
+        { UL64(0x0E5E3049A639FC6B), UL64(0xE75C35D986003625),
+          UL64(0x0CF35BD85DCC1646), UL64(0x8BCACED26C26273A),
+          UL64(0xE22ECF1DB5536742), UL64(0x013DD8971A9E068B),
+          UL64(0x17F411CB8A7909C5), UL64(0x5757AC98861DD506) },
+        { UL64(0x85DE1F0D1E935ABB), UL64(0xDEFD10B4154DE37A),
+          UL64(0xB8D9E392369CEBB5), UL64(0x54D5EF9B761324BE),
+          UL64(0x4D6341BA74F17E26), UL64(0xC0A0E3C878C1DDE4),
+          UL64(0xA6D7758187D918FD), UL64(0x6687601502CA3A13) },
+        { UL64(0xC7313E9CF36658F0), UL64(0xC433EF1C71F8057E),
+          UL64(0x853262461B6A835A), UL64(0xC8F053987C86394C),
+          UL64(0xFF398CDFE983C4A1), UL64(0xBF5E816203B7B931),
+          UL64(0x93193C46B7B9045B), UL64(0x1E4EBF5DA4A6E46B) },
+        { UL64(0xF9942A6043A24FE7), UL64(0x29C1191EFFB3492B),
+          UL64(0x9F662449902FDE05), UL64(0xC792A7AC6713C32D),
+          UL64(0x2FD88AD8B737982C), UL64(0x7E3A0319A21E60E3),
+          UL64(0x09B0DE447383591A), UL64(0x6DF141EE8310A456) },
+        { UL64(0xAEC1A039E6D6F471), UL64(0x14B2BA0F1198D12E),
+          UL64(0xEBC1A1603AEEE5AC), UL64(0x401F4836E0B964CE),
+          UL64(0x2EE437964FD03F66), UL64(0x3FDB4E49DD8F3F12),
+          UL64(0x6EF267F629380F18), UL64(0x3E8E96708DA64D16) },
+        { UL64(0xBC19180C207674F1), UL64(0x112E09A733AE8FDB),
+          UL64(0x996675546AAEB71E), UL64(0x79432AF1E101B1C7),
+          UL64(0xD5EB558FDE2DDEC6), UL64(0x81392D1F5357753F),
+          UL64(0xA7A76B973AE1158A), UL64(0x416FBBFF4A899991) },
+        { UL64(0x9E65FDFD0D4A9DCF), UL64(0x7BC29E48944DDF12),
+          UL64(0xBC1A92D93C856866), UL64(0x273C69056E98DFE2),
+          UL64(0x69FCE418CDFAA6B8), UL64(0x606BD8235061C69F),
+          UL64(0x42D495A06AF75E27), UL64(0x8ED3D5056D873A1F) },
+        { UL64(0xAF5528416AB25B6A), UL64(0xC6C0FFC72B1A4523),
+          UL64(0xAB18827B21C99E03), UL64(0x060E86489034691B),
+          UL64(0x5207F90F93C7F398), UL64(0x9F4A96CB82F8D10B),
+          UL64(0xDD71CD793AD0F9E3), UL64(0x84F435D2FC3A54F5) },
+        { UL64(0x4B03C55B8E33787F), UL64(0xEF42F975A6384673),
+          UL64(0xFF7304F75051B9F0), UL64(0x18ACA1DC741C87C2),
+          UL64(0x56F120A72D4BFE80), UL64(0xFD823B3D053E732C),
+          UL64(0x11BCCFE47537CA16), UL64(0xDF6C9C741B5A996B) },
+        { UL64(0xEE7332C7904FC3FA), UL64(0x14A23F45C7E3636A),
+          UL64(0xC38659C3F091D9AA), UL64(0x4A995E5DB12D8540),
+          UL64(0x20A53BECF3A5598A), UL64(0x56534B17B1EAA995),
+          UL64(0x9ED3DCA4BF04E03C), UL64(0x716C563AD8D56268) },
+        { UL64(0x27BA77A41D6178E7), UL64(0xE4C80C4068A1FF8E),
+          UL64(0x750110990A13F63D), UL64(0x7BF33521A61D46F3),
+          UL64(0x0AFF218E10B365BB), UL64(0x810218040FD7EA75),
+          UL64(0x05A3FD8AA4B3A925), UL64(0xB829E75F9B3DB4E6) },
+        { UL64(0x6BDC75A54D53E5FB), UL64(0x04A5DC02D52717E3),
+          UL64(0x86AF502FE9A42EC2), UL64(0x8867E8FB2630E382),
+          UL64(0xBF845C6EBEC9889B), UL64(0x54F491F2CB47C98D),
+          UL64(0xA3091FBA790C2A12), UL64(0xD7F6FD78C20F708B) },
+        { UL64(0xA569AC30ACDE5E17), UL64(0xD0F996D06852B4D7),
+          UL64(0xE51D4BB54609AE54), UL64(0x3FA37D170DAED061),
+          UL64(0x62A8868434B8FB41), UL64(0x99A2ACBD9EFB64F1),
+          UL64(0xB75C1A5E6448E1F2), UL64(0xFA99951A42B5A069) },
+        { UL64(0x6D956E892F3B26E7), UL64(0xF4709860DA875247),
+          UL64(0x3AD151792482DDA3), UL64(0xD64110E3017D82F0),
+          UL64(0x14928D2CFAD414E4), UL64(0x2B155F582ED02B24),
+          UL64(0x481A141BCB821BF1), UL64(0x12E3C7704F81F5DA) },
+        { UL64(0xE49C5DE59FFF8381), UL64(0x110532325BBEC894),
+          UL64(0xA0D051CC454D88C4), UL64(0x4F6DB89C1F8E531B),
+          UL64(0x34FE3FD6CA563A44), UL64(0x7F5C221558DA8AB9),
+          UL64(0x8445016D9474F0A1), UL64(0x17D34D61CB7D8A0A) },
+        { UL64(0x8E9D39101C474019), UL64(0xCAFF2629D52CEEFB),
+          UL64(0xF9CF3E32C1622C2B), UL64(0xD4B95E3CE9071A05),
+          UL64(0xFBBCA61F1594438C), UL64(0x1EB6E6A604AADEDF),
+          UL64(0x853027F468E14940), UL64(0x221D322ADFABDA9C) },
+        { UL64(0xED8EA9F6B7CB179A), UL64(0xDC7B764DB7934DCC),
+          UL64(0xFCB139405E09180D), UL64(0x6629A6BFB47DC2DD),
+          UL64(0xBFC55E4E9F5A915E), UL64(0xB1DB9D376204441E),
+          UL64(0xF82D68CF930C5F53), UL64(0x17D3A142CBB605B1) },
+        { UL64(0xDD5944EA308780F2), UL64(0xDC8DE7613845F5E4),
+          UL64(0x6BEABA7D7624D7A3), UL64(0x1E709AFD304DF11E),
+          UL64(0x9536437602170456), UL64(0xBF204B3AC8F94B64),
+          UL64(0x4E53AF7C5680CA68), UL64(0x0526074AE0C67574) },
+        { UL64(0x95D8CEF8ECD92AF6), UL64(0xE6B9FA7A6CD1745A),
+          UL64(0x3D546D3DA325C3E4), UL64(0x1F57691D9AE93AAE),
+          UL64(0xE891F3FE9D2E1A33), UL64(0xD430093FAC063D35),
+          UL64(0xEDA59B125513A327), UL64(0xDC2134F35536F18F) },
+        { UL64(0xAA51FE2C5C210286), UL64(0x3F68AAEE1CAB658C),
+          UL64(0x5A23A00BF9357292), UL64(0x9A626F397EFDABED),
+          UL64(0xFE2B3BF3199D78E3), UL64(0xB7A2AF7771BBC345),
+          UL64(0x3D19827A1E59802C), UL64(0x823BBC15B487A51C) },
+        { UL64(0x856139F299D0A422), UL64(0x9AC3DF65F456C6FB),
+          UL64(0xADDF65C6701F8BD6), UL64(0x149F321E3758DF87),
+          UL64(0xB1ECF714721B7EBA), UL64(0xE17DF09831A3312A),
+          UL64(0xDB2FD6ECD5C4D581), UL64(0xFD02996F8FCEA1B3) },
+        { UL64(0xE29FA63E7882F14F), UL64(0xC9F6DC3507C6CADC),
+          UL64(0x46F22D6FB882BED0), UL64(0x1A45755BD118E52C),
+          UL64(0x9F2C7C277C4608CF), UL64(0x7CCBDF32568012C2),
+          UL64(0xFCB0AEDD61729B0E), UL64(0x7CA2CA9EF7D75DBF) },
+        { UL64(0xF58FECB16F640F62), UL64(0xE274B92B39F51946),
+          UL64(0x7F4DFC046288AF44), UL64(0x0A91F32AEAC329E5),
+          UL64(0x43AD274BD6AABA31), UL64(0x719A16400F6884F9),
+          UL64(0x685D29F6DAF91E20), UL64(0x5EC1CC3327E49D52) },
+        { UL64(0x38F4DE963B54A059), UL64(0x0E0015E5EFBCFDB3),
+          UL64(0x177D23D94DBB8DA6), UL64(0x98724AA297A617AD),
+          UL64(0x30F0885BFDB6558E), UL64(0xF9F7A28AC7899A96),
+          UL64(0xD2AE8AC8872DC112), UL64(0xFA0642CA73C3C459) },
+        { UL64(0x15296981E7DFC8D6), UL64(0x67CD44501FB5B94A),
+          UL64(0x0EC71CF10EDDFD37), UL64(0xC7E5EEB39A8EDDC7),
+          UL64(0x02AC8E3D81D95028), UL64(0x0088F17270B0E35D),
+          UL64(0xEC041FABE1881FE3), UL64(0x62CF71B8D99E7FAA) },
+        { UL64(0x5043DEA7E0F222C2), UL64(0x309D42AC72E65142),
+          UL64(0x94FE9DDD9216CD30), UL64(0xD6539C7D0F87FEEC),
+          UL64(0x03C5A57C432AC7D7), UL64(0x72692CF0327FDA10),
+          UL64(0xEC28C85F280698DE), UL64(0x2331FB467EC283B1) },
+    },
+    {
+        { UL64(0xA0158EEAE457A477), UL64(0xD19857DBEE6DDC05),
+          UL64(0xB326522418C41671), UL64(0x3FFDFC7E3C2C0D58),
+          UL64(0x3A3A525426EE7CDA), UL64(0x341B0869DF02C3A8),
+          UL64(0xA023BF42723BBFC8), UL64(0x3D15002A14452691) },
+        { UL64(0x5EF7324C85EDFA30), UL64(0x2597655487D4F3DA),
+          UL64(0x352F5BC0DCB50C86), UL64(0x8F6927B04832A96C),
+          UL64(0xD08EE1BA55F2F94C), UL64(0x6A996F99344B45FA),
+          UL64(0xE133CB8DA8AA455D), UL64(0x5D0721EC758DC1F7) },
+        { UL64(0xF3CAE7E9262A3539), UL64(0x78A49D1D6670D59E),
+          UL64(0x37DE0F63C1C5E1B9), UL64(0x3072C30C69CB7C1C),
+          UL64(0x1D278A5277C850E6), UL64(0x84F15F8F1F6A3DE6),
+          UL64(0x46A8BB45592CA7AD), UL64(0x1912E3EEE4D424B8) },
+        { UL64(0x6BA7A92079E5FB67), UL64(0xE1331FEB70AA725E),
+          UL64(0x5080CCF57DF5D837), UL64(0xE4CAE01D7FF72E21),
+          UL64(0xD9243EE60412A77D), UL64(0x06FF7CACDF449025),
+          UL64(0xBE75F7CD23EF5A31), UL64(0xBC9578220DDEF7A8) },
+        { UL64(0xDC988086365E668B), UL64(0xADA8DCDAAABDA5FB),
+          UL64(0xBC146B4C255F1FBE), UL64(0x9CFCDE29CF34CFC3),
+          UL64(0xACBB453E7E85D1E4), UL64(0x9CA09679F92358B5),
+          UL64(0x15FC2D96240823FF), UL64(0x8D65ADF70C11D11E) },
+        { UL64(0x8CF7230CB0CE1C55), UL64(0x5B534D050BBFB607),
+          UL64(0xEE1EF1130E16363B), UL64(0x27E0AA7AB4999E82),
+          UL64(0xCE1DAC2D79362C41), UL64(0x67920C9091BB6CB0),
+          UL64(0x1E648D632223DF24), UL64(0x0F7D9EEFE32E8F28) },
+        { UL64(0x775557F10296F4FD), UL64(0x1DCA76A3EA51B436),
+          UL64(0xF3E98F60FB950805), UL64(0x31FF32EA831CF7F1),
+          UL64(0x643E7BF18D2C714B), UL64(0x64B5C3392E9D2ACA),
+          UL64(0xA9FD9CCC6ADC2D23), UL64(0xFC2397ECCC721B9B) },
+        { UL64(0x6943F39AFA833834), UL64(0x22951722A6328562),
+          UL64(0x81D63DD54170FC10), UL64(0x9F5FA58FAECC2E6D),
+          UL64(0xB66C8725E77D9A3B), UL64(0x11235CEA6384EBE0),
+          UL64(0x06A8C1185845E24A), UL64(0x0137B286EBD093B1) },
+        { UL64(0xF031182DB48EC57D), UL64(0x515D32F804B233B9),
+          UL64(0x06BBB1D4093AAD26), UL64(0x88A142FE0D83D1EC),
+          UL64(0x3B95C099245C73F8), UL64(0xB126D4AF52EDCD32),
+          UL64(0xF8022C1E8FCB52E6), UL64(0x5A51AC4C0106D339) },
+        { UL64(0xC589E1CE44ACE150), UL64(0xE0F8D3D94381E97C),
+          UL64(0x59E99B1162C5A4B8), UL64(0x90D262F7FD0EC9F9),
+          UL64(0xFBC854C9283E13C9), UL64(0x2D04FDE7AEDC7085),
+          UL64(0x057D776547DCBECB), UL64(0x8DBDF5919A76FA5F) },
+        { UL64(0xB7F70A1A7C64A054), UL64(0x0DC1C0DF9DB43E79),
+          UL64(0x6D0A4AE251FE63D6), UL64(0xE0D5E3327F0C8ABF),
+          UL64(0xFF5500362B7ECEE8), UL64(0x3EA0E6F75D055008),
+          UL64(0x30DEB62FF24AC84F), UL64(0x936969FD5D7116B7) },
+        { UL64(0xD01506950DE1E578), UL64(0x2E1463E7E9F72BC6),
+          UL64(0xFFA684411B39ECA5), UL64(0x673C85307C037F2F),
+          UL64(0xD0D6A600747F91DA), UL64(0xB08D43E1C9CB78E9),
+          UL64(0x0FC0C64427B5CEF5), UL64(0x5C1D160AA60A2FD6) },
+        { UL64(0x02DA76122617CF7F), UL64(0xD6E25D4EEEE35260),
+          UL64(0xB2FA5B0AFD3533E9), UL64(0xE76BB7B0B9126F88),
+          UL64(0x692E6A9988856866), UL64(0x3FDF394F49DB65CA),
+          UL64(0x2529699122D8D606), UL64(0xE815BFBF3DD7C4CF) },
+        { UL64(0xF98CAE5328C8E13B), UL64(0x375F10C4B2EDDCD1),
+          UL64(0xD4EB8B7F5CCE06AD), UL64(0xB4669F4580A2E1EF),
+          UL64(0xD593F9D05BBD8699), UL64(0x5528A4C9E7976D13),
+          UL64(0x3923E0951C7E28D3), UL64(0xB92937903F6BB577) },
+        { UL64(0x69C984ED4D844E7F), UL64(0xD354B2174A2E8A82),
+          UL64(0x25BD4ADDFB2C4136), UL64(0xF72DF4DE144B26E1),
+          UL64(0xD0AA9DB0E6101AFD), UL64(0x4445EFAAE49BD1B8),
+          UL64(0x5DC54EEE331593B2), UL64(0xFA35E3B9094BF10B) },
+        { UL64(0xDB567D6AC42BD6D2), UL64(0x6DF86468BB1F96AE),
+          UL64(0x0EFE5B1A4843B28E), UL64(0x961BBB056379B240),
+          UL64(0xB6CAF5F070A6A26B), UL64(0x70686C0D328E6E39),
+          UL64(0x80DA06CF895FC8D3), UL64(0x804D8810B363FDC9) },
+        { UL64(0x660A0F893EA089C3), UL64(0xA25823AAC9009B09),
+          UL64(0xB2262D7BA681F5E5), UL64(0x4FC30C8C3413863A),
+          UL64(0x691544B7C32059F7), UL64(0xF65CF276B21C6134),
+          UL64(0xE3A96B2A5104DABA), UL64(0xBB08D109A43EE42F) },
+        { UL64(0xBE22877B207F1670), UL64(0x9B0DD1884E615291),
+          UL64(0x625AE8DC97A3C2BF), UL64(0x08584EF7439B86E8),
+          UL64(0xDE7190A5DCD898FF), UL64(0x26286C402058EE3D),
+          UL64(0x3DB0B2175F87B1C1), UL64(0xCC334771102A6DB5) },
+        { UL64(0x85A52D69F9916861), UL64(0x595469A4DA4FA813),
+          UL64(0x1DD7786E3338502F), UL64(0x34B8EF2853963AC5),
+          UL64(0xC0F019F81A891B25), UL64(0xB619970C4F4BD775),
+          UL64(0x8C2A5AF3BE19F681), UL64(0x9463DB0498EC1728) },
+        { UL64(0xD99DE9542F770FB1), UL64(0x97C1C6204CD7535E),
+          UL64(0xD3B6C4483F09CEFC), UL64(0xD725AF155A63B4F8),
+          UL64(0x0C95D24FC01E20EC), UL64(0xDFD374949AE7121F),
+          UL64(0x7D6DDB72EC77B7EC), UL64(0xFE079D3B0353A4AE) },
+        { UL64(0xEB62C27801F39EAB), UL64(0x27DE39340AB3A4AA),
+          UL64(0xFBD17520A982CA8D), UL64(0x58817EC2E4BDC6ED),
+          UL64(0x312D78DE31C6AC13), UL64(0x9483BF7609202EA6),
+          UL64(0xF64AB8B622C6D8E1), UL64(0xDDDF589CE580DE74) },
+        { UL64(0x3066E70A2E6AC8D2), UL64(0x9C6B5A43106E5C05),
+          UL64(0x52D3C6F5EDE59B8C), UL64(0x30D6A5C3FCCEC9AE),
+          UL64(0xEDEC7C224FC0A9EF), UL64(0x190FF08395C16CED),
+          UL64(0xBE12EC8F94DE0FDE), UL64(0x0D131AB8852D3433) },
+        { UL64(0xE0FA3336EE98A92A), UL64(0x7D80EEEF66A4D745),
+          UL64(0xB612531BBA0119D3), UL64(0x86E770C1B351FE15),
+          UL64(0xAFBAD6F882D5A397), UL64(0x1E5F1CB80DBF0110),
+          UL64(0x25138AC09F79063D), UL64(0x089ED22F2746A156) },
+        { UL64(0x42ACE07E85701291), UL64(0x94793ED9194061A8),
+          UL64(0x30E83ED6D7F4A485), UL64(0x9EEC7269F9EEFF4D),
+          UL64(0x90ACBA590C9D8005), UL64(0x5FECA4581E79B9D1),
+          UL64(0x8FBE54271D506A1E), UL64(0xA32B2C8E2439CFA7) },
+        { UL64(0x198D1B5D7D8B8DDE), UL64(0xF32C11078DAB37FB),
+          UL64(0xF15FCB6D42B93874), UL64(0x91DDB74F41F94F84),
+          UL64(0x6A64540A271524B2), UL64(0x950A0C12758B5A64),
+          UL64(0xF9F237933DCE9580), UL64(0xC8EDD0AB2CF8CE32) },
+        { UL64(0x1671C17373DD0B4E), UL64(0x37A2821444A054C6),
+          UL64(0x81760A1B4E8B53F1), UL64(0xA6C04224F9F93B9E),
+          UL64(0x18784B34CF671E3C), UL64(0x81BBECD2CDA9B994),
+          UL64(0x38831979B2AB3848), UL64(0xEF54FEB7F2E03C2D) },
+        { UL64(0xEFC6357EAE1046B7), UL64(0xE6704929612932E4),
+          UL64(0xA20305D4B1355B17), UL64(0x88A9136A58B4A156),
+          UL64(0xBC379985B4D275EC), UL64(0x718B91316EAF338B),
+          UL64(0x61229A7AD152A509), UL64(0x1109F7C445157AE9) },
+        { UL64(0xCF197CA7FB8088FA), UL64(0x014272474DDC96C5),
+          UL64(0xA2D2550A30777176), UL64(0x534698984D0CF71D),
+          UL64(0x6CE937B83A2AAAC6), UL64(0xE9F91DC35AF38D9B),
+          UL64(0x2598AD83C8BF2899), UL64(0x8E706AC9B5536C16) },
+        { UL64(0x2BDE42140DF85C2C), UL64(0x4FB839F4058A7A63),
+          UL64(0x7C10572A47F51231), UL64(0x878826231989824E),
+          UL64(0xA8293D2016E1564A), UL64(0xCB11C0F818C04576),
+          UL64(0x83B91E7D9740C631), UL64(0xBDCB23D0CBFFCEA0) },
+        { UL64(0x40DC7495F688DC98), UL64(0x26490CD7124C4AFC),
+          UL64(0xE651EC841F18775C), UL64(0x393EA6C3B4FDAF4A),
+          UL64(0x1E1F33437F338E0D), UL64(0x39FB832B6053E7B5),
+          UL64(0x46E702DA619E14D5), UL64(0x859CACD1CDEEF6E0) },
+        { UL64(0x64BDFD2A9094BFC8), UL64(0x8558ACC60FC54D1E),
+          UL64(0x3992848FAF27721E), UL64(0x7A8FCBDAA14CD009),
+          UL64(0x6DE6120900A4B9C2), UL64(0xBD192B1B20CF8F28),
+          UL64(0x2356B90168D9BE83), UL64(0xCE1E7A944A49A48A) },
+        { UL64(0x63B99CE74462007D), UL64(0xB8AB48A54CB5F5B7),
+          UL64(0x9EC673D2F55EDDE7), UL64(0xD1567F748CFAEFDA),
+          UL64(0x46381B6B0887BCEC), UL64(0x694497CEE178F3C2),
+          UL64(0x5E6525E31E6266CB), UL64(0x5931DE26697D6413) },
+    },
+    {
+        { UL64(0x142B55021A93507A), UL64(0xB4CD11878D3C06CF),
+          UL64(0xDF70E76A91EC3F40), UL64(0x484E81AD4E7553C2),
+          UL64(0x830F87B5272E9D6E), UL64(0xEA1C93E5C6FF514A),
+          UL64(0x67CC2ADCC4192A8E), UL64(0xC77E27E242F4535A) },
+        { UL64(0x8CDA9CF2D0C05199), UL64(0x502FBC22FAE78454),
+          UL64(0xC0BDA9DFF572A182), UL64(0x5F9B71B86158B372),
+          UL64(0xE0F33A592B82DD07), UL64(0x763027359523032E),
+          UL64(0x7FE1A721C4505A32), UL64(0x7B6E3E82F796409F) },
+        { UL64(0xB4C66356EA37BA9E), UL64(0x1ADC84150AFFF55D),
+          UL64(0xF0080EF9596CC862), UL64(0x756C85B86D647AB6),
+          UL64(0xC9DB94AA1DB9C215), UL64(0x2DD36DB12013B1A5),
+          UL64(0xDE6AC61C4286C903), UL64(0x3FD32F88C76CF884) },
+        { UL64(0xE3417BC035D0B34A), UL64(0x440B386B8327C0A7),
+          UL64(0x8FB7262DAC0362D1), UL64(0x2C41114CE0CDF943),
+          UL64(0x2BA5CEF1AD95A0B1), UL64(0xC09B37A867D54362),
+          UL64(0x26D6CDD201E486C9), UL64(0x20477ABF42FF9297) },
+        { UL64(0x31CA82EC11E9468D), UL64(0xCF5D0EB61CA05FA0),
+          UL64(0x49BAA305AA962E73), UL64(0xAD2B61B94015E456),
+          UL64(0x6D2B8E5F6C213835), UL64(0x0EF11C2B48F74763),
+          UL64(0xA8CD7B5EC18BA768), UL64(0x73C84DEF157ECCEC) },
+        { UL64(0x13546AF651581E7D), UL64(0x0CE20B8739C7DB2E),
+          UL64(0xFAB1E2EDD9127C46), UL64(0xBA9A1DC46F35E6A8),
+          UL64(0x1B69666F80690E7B), UL64(0xD6530E3D648890A0),
+          UL64(0x37BD4CB199C23E00), UL64(0xE7274E2CB7BA7A00) },
+        { UL64(0x9FAC50B66757243A), UL64(0x8F41796123F32472),
+          UL64(0xEB367A56B372CBF4), UL64(0xBE37E15CB7799203),
+          UL64(0x1B521FDFDC4033DD), UL64(0x21F410EDAE8D8D7F),
+          UL64(0xBE6AF24EBDDC7547), UL64(0x9965AE846E18A74D) },
+        { UL64(0xA004DCB3292A9287), UL64(0xDDC15CF677B092C7),
+          UL64(0x083A8464806C0605), UL64(0x4A68DF703DB997B0),
+          UL64(0x9C134E4505BF7DD0), UL64(0xA4E63D398CCF7F8C),
+          UL64(0xA6E6517F41B5F8AF), UL64(0xAA8B9342AD7BC1CC) },
+        { UL64(0x6AA9B0CD16895AC1), UL64(0xADDCD353F28E4C37),
+          UL64(0xFF473ABD6F90AE0A), UL64(0x76482409318A148E),
+          UL64(0xC5EB5ECCCA192721), UL64(0x58542527FBD222AE),
+          UL64(0x594852A981B50D94), UL64(0xA01F4E03E26A8CBA) },
+        { UL64(0xE11DC5F5C2E0F94A), UL64(0x1FB6FA4E71986CC7),
+          UL64(0x0FFC1996A5B38D02), UL64(0x0E06268E9385403F),
+          UL64(0x93D11F09D01A6195), UL64(0x05EB96405D466517),
+          UL64(0x63A885CC77ED5ADF), UL64(0xD507DC2535A0EA72) },
+        { UL64(0x68E7AD81A94FC338), UL64(0x316C704B5A224D9D),
+          UL64(0xE34FA9384F26595F), UL64(0x86171FE998961836),
+          UL64(0x98991BC43927496C), UL64(0xCE6FDB5AC68761D7),
+          UL64(0x0A24FEFCB29E96D6), UL64(0xC72DFFA6E5AC66A3) },
+        { UL64(0x126F35B51E706AD9), UL64(0xB99CEBB4C3A9EBDF),
+          UL64(0xA75389AFBF608D90), UL64(0x76113C4FC6C89858),
+          UL64(0x80DE8EB097E2B5AA), UL64(0x7E1022CC63B91304),
+          UL64(0x3BDAB6056CCC066C), UL64(0x33CBB144B2EDF900) },
+        { UL64(0xB483143A8AE08A5B), UL64(0x4E278FA1E60B2BA6),
+          UL64(0x24B31C25317842FB), UL64(0xD4E4CF7C90CD3808),
+          UL64(0x5CDF4D86695EF878), UL64(0x362AAB50599A3AE8),
+          UL64(0x22E00076B35844FC), UL64(0xA6876EB1C8E71A04) },
+        { UL64(0x73344BFFCE720DD9), UL64(0x62A616C0FE3BE6A1),
+          UL64(0x304117BC41EC162A), UL64(0x79BEB1F63E13670D),
+          UL64(0xCCAA3FC568903A6D), UL64(0x999B57ACF531FEAF),
+          UL64(0xAB6395D7DF173055), UL64(0x7B7F1D97FC72F80F) },
+        { UL64(0x489A91D9A6284AE6), UL64(0x47E6D43169AD866B),
+          UL64(0x93E5E53339177F97), UL64(0x235D2C8A2C59EB80),
+          UL64(0xEDDE697794E9C546), UL64(0xF94275BCD5934383),
+          UL64(0xAC2F71BFEC824653), UL64(0x1452096717D03D8A) },
+        { UL64(0xC41764717AF715D2), UL64(0xE2F7F594D0134A96),
+          UL64(0x2C1873EFA41EC956), UL64(0xE4E7B4F677821304),
+          UL64(0xE5C8FF9788D5374A), UL64(0x2B915E6380823D5B),
+          UL64(0xEA6BC755B2EE8FE2), UL64(0x6657624CE7112651) },
+        { UL64(0xFD30B3AC8ACB4915), UL64(0x8C2218BFE1004B60),
+          UL64(0x80A64CFE4DC25DCC), UL64(0x0506F26E95D0B9DA),
+          UL64(0xABAA94FD41C3EF37), UL64(0x2366D29D89BCEF26),
+          UL64(0x6BD0E78F4BE4EA63), UL64(0x0686F35F2E21331F) },
+        { UL64(0xCB0FC7F30590D9CE), UL64(0xC022C3D9EA0AD53B),
+          UL64(0xA9C429B384BA2933), UL64(0xFCE652369DB892CF),
+          UL64(0x487028621F518D52), UL64(0x25DF7D1E10383132),
+          UL64(0x3F170EBDAA36795B), UL64(0xA931884F34957E47) },
+        { UL64(0xDC39FBEA5833F14A), UL64(0xB010A3C188D50F33),
+          UL64(0xCD6145BC76F5752C), UL64(0x113B25217E12DE77),
+          UL64(0x62417866041839A5), UL64(0x95CA58CB0EF309D7),
+          UL64(0x6D02CC9DA2D02249), UL64(0x8745B54BB8FD3ABB) },
+        { UL64(0x157AF101DACE5ACA), UL64(0xC4FDBCF211A6A267),
+          UL64(0xDADDF340C49C8609), UL64(0x97E49F52E9604A65),
+          UL64(0x9BE8E790937E2AD5), UL64(0x846E2508326E17F1),
+          UL64(0x3F38007A0BBBC0DC), UL64(0xCF03603FB11E16D6) },
+        { UL64(0x0589150A4ED3BCFE), UL64(0xF462B65C6CD80CB9),
+          UL64(0x3412ADA829531C5D), UL64(0x90E969E72F14A675),
+          UL64(0x486C8906C7B95B4C), UL64(0x5A67A94CBCB4780C),
+          UL64(0xDE611513D22DF985), UL64(0xBAB4869A481BE00C) },
+        { UL64(0x2FEAA4C5B8D98F1F), UL64(0x7C09029C41050250),
+          UL64(0xD4FA42771B56132F), UL64(0xECB257F1DA1235E5),
+          UL64(0x617E21586A46AEAF), UL64(0x65EFF300D4653EAE),
+          UL64(0xF67A13AD03562A01), UL64(0x957FFA8770C77027) },
+        { UL64(0x89F2C49046C11C2F), UL64(0xBDBC06D6D7D50818),
+          UL64(0x13DFC16082BE51E2), UL64(0x710B3AF6C1719895),
+          UL64(0x0BD5464361DD8475), UL64(0xA18A8ED34544E029),
+          UL64(0xE11AD2CFDC3FBB7D), UL64(0xB177D79B79E8788A) },
+        { UL64(0xD6F800E07442F1D5), UL64(0x475607D166E0E3AB),
+          UL64(0x82807F16B7C64047), UL64(0x8858E1E3A749883D),
+          UL64(0x5859120B8231EE10), UL64(0x1B80E7EB638A1ECE),
+          UL64(0xCB72525AC6AA73A4), UL64(0xA7CDEA3D844423AC) },
+        { UL64(0x863A8DB06B80ED3E), UL64(0x19A747E375D3FA13),
+          UL64(0x5A35CF2E69C8F701), UL64(0x769F0413F8E5BBE9),
+          UL64(0x3B6D36C01D64E56A), UL64(0xB9D92B32456A9896),
+          UL64(0x0D47CE70CF8E9CDA), UL64(0x19E3355E6C019864) },
+        { UL64(0x7F101AAC025123ED), UL64(0xF16E93EF93AD0606),
+          UL64(0x89FE894846CF85D1), UL64(0xE31D0CCBF78E910E),
+          UL64(0xBCABAB1CD561F678), UL64(0x7331E5C887C92833),
+          UL64(0x6338AD260E72F68D), UL64(0x800C053E35DB05C3) },
+        { UL64(0x81E2EB76A1B06B08), UL64(0x81AE55788D7E82C9),
+          UL64(0x03EC3E3848F78A96), UL64(0x1BB4F75381A39B01),
+          UL64(0x424EB01CEBEE8A26), UL64(0x1311F7F5D4AE8F2C),
+          UL64(0x153AB076AF8C01F1), UL64(0x2EC94C835E02C177) },
+        { UL64(0x5ED0C007F8AE7C38), UL64(0x6DB07A5C3D740192),
+          UL64(0xBE5E9C2A5FE36DB3), UL64(0xD5B9D57A76E95046),
+          UL64(0x54AC32E78EBA20F2), UL64(0xEF11CA8F71B9A352),
+          UL64(0x305E373EFF98A658), UL64(0xFFE5A100823EB667) },
+        { UL64(0x46B7C800DC8CEECF), UL64(0xD6E49C2D815994A5),
+          UL64(0x6B7814FCBB6256EA), UL64(0x7E8F51FC4A6E1022),
+          UL64(0xF9805383CADE2038), UL64(0x9F762F317454FBEA),
+          UL64(0x5ABA0C2965388068), UL64(0xA27561FA721CB251) },
+        { UL64(0x5C144938945E32CF), UL64(0x9E997E755A8291A6),
+          UL64(0x0570E846FC6E07D6), UL64(0xE26813641E74447D),
+          UL64(0xBF1710CE721FF2E2), UL64(0xEA450819F814E83D),
+          UL64(0x27F0A70BED697AD2), UL64(0x90369899086B3F36) },
+        { UL64(0xE9FF40FCDB46CFDB), UL64(0x1B5267155E7E94C4),
+          UL64(0xB8986BC59700B3BF), UL64(0xC98CAF590C8C3128),
+          UL64(0xD1FB015D301BBBEB), UL64(0x18E64F28BA2FD1A9),
+          UL64(0x9212787EC0365B70), UL64(0xC64B51D098386C04) },
+        { UL64(0x57477B11E51732D2), UL64(0xDFD6EB282538FC0E),
+          UL64(0x5C43B0CC3B39EEC5), UL64(0x6AF12778CB36CC57),
+          UL64(0x70B0852D06C425AE), UL64(0x6DF92F8C5C221B9B),
+          UL64(0x6C8D4F9ECE826D9C), UL64(0xF59ABA7BB49359C3) },
+    },
+    {
+        { UL64(0xC37E2C2E421D3AA4), UL64(0xF926407CE84FA840),
+          UL64(0x18ABC03D1454E41C), UL64(0x26605ECD3F7AF644),
+          UL64(0x242341A6D6A5EABF), UL64(0x1EDB84F4216B668E),
+          UL64(0xD836EDB804010102), UL64(0x5B337CE7945E1D8C) },
+        { UL64(0x4C076B86D23DDC82), UL64(0x03FD344C7E0143F0),
+          UL64(0xA95362FF317AF2C5), UL64(0x0ADD3DB7E18B7A4F),
+          UL64(0x9C673E3F8260E01B), UL64(0xFBEB49E554A1CC91),
+          UL64(0x91351BF292F2E433), UL64(0xC755E7EC851141EB) },
+        { UL64(0x349AE368DA9F3804), UL64(0x470F07FEA164349C),
+          UL64(0xD52F4CC98562BAA5), UL64(0xC74A9E862B290DF3),
+          UL64(0xD3A1AA3543471A24), UL64(0x239446BEB8194511),
+          UL64(0xBEC2DD0081DCD44D), UL64(0xCA3D7F0FC42AC82D) },
+        { UL64(0x2BF5DB47F23206D5), UL64(0x2F6D34201D260152),
+          UL64(0x17B876533F8FF89A), UL64(0x5157C30C378FA458),
+          UL64(0x7517C5C52D4FB936), UL64(0xEF22F7ACE6518CDC),
+          UL64(0xDEB483E6BF847A64), UL64(0xF508455892E0FA89) },
+        { UL64(0xB418C2A69B583160), UL64(0xBE74FCD4B4E59194),
+          UL64(0xF178EEAA3C83E3FF), UL64(0xE051F895E296F29B),
+          UL64(0xD023523806CEB84A), UL64(0x5ACE48CEE111FE6B),
+          UL64(0x40E43A491C045545), UL64(0xF3FA86DDDD522146) },
+        { UL64(0x959616FA908EC5B5), UL64(0x882D661DA01AB12D),
+          UL64(0xC49F60824382AE8A), UL64(0x5CDF92EB5D133F5E),
+          UL64(0x98CECC425EF6C9C1), UL64(0xB52D6682664D84EE),
+          UL64(0x9E285ED86F25B8C4), UL64(0xEB80CDC748DEBE88) },
+        { UL64(0x2D9794C1EC222BA0), UL64(0xC3DFF42F523E5D48),
+          UL64(0x4A7CD5700FE4846B), UL64(0xEFC5B113FF135174),
+          UL64(0x2630B25BC6B05E85), UL64(0x0A6D3029654CD077),
+          UL64(0xB4F1F54F32D8B89D), UL64(0xDE3BAFF21627FC27) },
+        { UL64(0xAB9659D8DF7304D4), UL64(0xB71BCF1BFF210E8E),
+          UL64(0xA9A2438BD73FBD60), UL64(0x4595CD1F5D11B4DE),
+          UL64(0x9C0D329A4835859D), UL64(0x4A0F0D2D7DBB6E56),
+          UL64(0xC6038E5EDF928A4E), UL64(0xC94296218F5AD154) },
+        { UL64(0xB883B83BA4A2DF3E), UL64(0x045B7CC244E5A363),
+          UL64(0xA42BD7734E0D96DE), UL64(0xB92575478D93C165),
+          UL64(0xE8F9012673C8138E), UL64(0x5A8EE74D607D84BF),
+          UL64(0x1BECBB5049EA4363), UL64(0x1D4B61145ADA3286) },
+        { UL64(0xEBB678B5AA093B15), UL64(0x0EACDF44D3E2B40C),
+          UL64(0xBC4223C42089199F), UL64(0x0E252BB4490A06A4),
+          UL64(0x1E6479B5CC2C5DF7), UL64(0x8B6922D2BA94328A),
+          UL64(0x4278CCE7218B948C), UL64(0x947E995CE6064F39) },
+        { UL64(0xCDF32D65F1D96994), UL64(0x8BB3D8F3B75B2B18),
+          UL64(0x5A95D2A3CB307798), UL64(0xDF8629CCCB15A8B5),
+          UL64(0x375BDCBE548C4926), UL64(0x94AD58C63C25B3A6),
+          UL64(0xE94E0D528FAC4888), UL64(0x9CBE774669BA5BE3) },
+        { UL64(0x08A33840A70C6EC4), UL64(0x9E8819F7E0311195),
+          UL64(0xED209D96708AB202), UL64(0x10D7C4E7CE943A27),
+          UL64(0x372FB317A29B49A1), UL64(0x57A67FB346627D1F),
+          UL64(0xF912561E7CDF39EC), UL64(0xFA3CE6F26F7C8F17) },
+        { UL64(0x04C16DE7782FEDC1), UL64(0xFEE2C11A093AE7C4),
+          UL64(0x357A7D853DDE90B1), UL64(0x68136AF2CE6923DC),
+          UL64(0x0AAA9B448E864536), UL64(0x16B53452FEAA1C2F),
+          UL64(0xE8F494D15946D955), UL64(0xB53116513B1569E3) },
+        { UL64(0xDDEBFD7DBE51E3E7), UL64(0x0B25FC407F026831),
+          UL64(0x4F3BAD3BACE45FD1), UL64(0x8CB332BA706809A7),
+          UL64(0x40E160B1D6B93FCA), UL64(0x85368EDF8B28BDED),
+          UL64(0x266F0A8C90B4C2FD), UL64(0xAAD987F6FFAAD24F) },
+        { UL64(0x9F310D424E1B623B), UL64(0xF045749B816266A5),
+          UL64(0x944FD751A0DB7827), UL64(0x80120DA6681D7259),
+          UL64(0x00CDD20D31A9C588), UL64(0x7BF2ABD397AE4BF1),
+          UL64(0xF75A22906B08C06A), UL64(0x0FA3E5844A12DC8B) },
+        { UL64(0x91213462F23F2D92), UL64(0x6CAB71BD60B94078),
+          UL64(0x6BDD0A63176CDE20), UL64(0x54C9B20CEE4D54BC),
+          UL64(0x3CD2D8AA9F2AC02F), UL64(0x03F8E617206EEDB0),
+          UL64(0xC7F68E1693086434), UL64(0x831469C592DD3DB9) },
+        { UL64(0xF35E2CFE69BA2241), UL64(0x95446CE08CF4D5BD),
+          UL64(0xDCBA1BCDB8DB4F92), UL64(0x9679AE8E5970D958),
+          UL64(0x959CB44540D5B94B), UL64(0xAD56781433A31FD2),
+          UL64(0xC7D4C3D11B002BC1), UL64(0x59A281CC8AC853E3) },
+        { UL64(0xFD75AEC0DD28B1CD), UL64(0xC71202057A374DC2),
+          UL64(0xAB6A2BE408F0622F), UL64(0xCB4AD0A112268B58),
+          UL64(0x34F8ED7CF5193A94), UL64(0xBACD167E1C459C2B),
+          UL64(0x24CC625457BCE274), UL64(0xF47164A82D4060EC) },
+        { UL64(0x0F5D6E5AE2AC751B), UL64(0xC609B3F3D44D4569),
+          UL64(0x38C4AC800B964C33), UL64(0xDEF9451BC143C505),
+          UL64(0x981F9295394D7586), UL64(0x4C0D1E9BD058A6D1),
+          UL64(0x76A4CF1C07E8803D), UL64(0x2B5F76334DDD01D6) },
+        { UL64(0xFE7D7465653F3C5F), UL64(0x283DD45EF040FEB1),
+          UL64(0x91FE599BF3B7EDFE), UL64(0x5FF039AD80379311),
+          UL64(0xBF76995B4E96FA49), UL64(0x2640B6B2A3E25094),
+          UL64(0x8B096341C1C83F74), UL64(0xD2BEC884FA560AC3) },
+        { UL64(0x096B576BB9F31405), UL64(0x40FC228762B02B5E),
+          UL64(0x42B2BDBBE62F6118), UL64(0x628D80F77303491A),
+          UL64(0x897ED8FD8F33BE96), UL64(0x4D5669CA48498D0A),
+          UL64(0xF74C401AE99C9DEF), UL64(0x7938EB5B6544B85A) },
+        { UL64(0x430BD312E7F21288), UL64(0x7381A7258794E333),
+          UL64(0x945D2F8BB253D2FC), UL64(0x79593585BEA3FF9E),
+          UL64(0xB0C3F67F8DAF6006), UL64(0x7848D08519A6D877),
+          UL64(0x6E38701B62211B4F), UL64(0xAF07F06E0506396D) },
+        { UL64(0xE59AC88D91FAB8FF), UL64(0x2F5E1C0E3F7C96ED),
+          UL64(0xFFF28A16B4085079), UL64(0x8D765F9E94E0C09F),
+          UL64(0xD2A53ECEA00337BE), UL64(0x98215DBD4AFAD088),
+          UL64(0xA32B6FA9A9238920), UL64(0xE165801564D9ED2A) },
+        { UL64(0x8521DF248F981354), UL64(0x587E23EC3588A259),
+          UL64(0xCBEDF281D7A0992C), UL64(0x06930A5538961407),
+          UL64(0x09320DEBBE5BBE21), UL64(0xA7FFA5B52491817F),
+          UL64(0xE6C8B4D909065160), UL64(0xAC4F3992FFF6D2A9) },
+        { UL64(0x5C5DC8F5567B9C76), UL64(0xAAE0CCBE96D19AC6),
+          UL64(0xD471F8A8CF26A25F), UL64(0x1DF9704A37365208),
+          UL64(0xABBC541BA145DA05), UL64(0x9D43323DF5B7D8AF),
+          UL64(0xA3AFB092F1E253DD), UL64(0xC4A7EB79DBCB36CF) },
+        { UL64(0x2E4D6F15A3AA9123), UL64(0x33FF9C8C384DD342),
+          UL64(0xB01686178F2D1B0C), UL64(0x66AED87DBD6D0562),
+          UL64(0x403176AC4EA466E8), UL64(0x154D8F0C1E10BE7B),
+          UL64(0x5F75F77658D1A44B), UL64(0xC9B2981033A53905) },
+        { UL64(0x56BD73F5A47FB101), UL64(0x36258684FBBF59FB),
+          UL64(0x43C8DD38864C842B), UL64(0xF1466592F54E8703),
+          UL64(0x1137C392D10678C5), UL64(0x86A882DEF0D5918A),
+          UL64(0x8EE1D24D2D1033D0), UL64(0x649CE162E376E926) },
+        { UL64(0x2E4EB2A3CC53DA66), UL64(0x04708A71F17A9B4E),
+          UL64(0xDBFDC7B20DE05B2C), UL64(0x4CDC9AEE4907A201),
+          UL64(0xE5CC8DFC6C475566), UL64(0x2B83CBFB47BE1691),
+          UL64(0x695833A74C05C3FD), UL64(0xEE938A7243B0DEB0) },
+        { UL64(0x078625773F428F0F), UL64(0x9B63DBA94C3DED1F),
+          UL64(0x852AAE44356751BD), UL64(0xE2EC49113B2F1C80),
+          UL64(0xEDB0F35473C420FB), UL64(0xD663CCAB0BC255C3),
+          UL64(0x1C3E015DCFAE46A9), UL64(0x985589991F187D84) },
+        { UL64(0x2CD34F1EB78B3D1A), UL64(0x1713FAC65FF84C0E),
+          UL64(0xDEE9FAC9C29CEC60), UL64(0x53917BFDB27AA552),
+          UL64(0x896F534DEE64129F), UL64(0x76A523F2DBEB1EE0),
+          UL64(0xE1C13309D2591127), UL64(0x876F1D57AD4CF66C) },
+        { UL64(0xC632C789B576A3A9), UL64(0xCFC021F2690DD7C8),
+          UL64(0xCF55EA32EB84AD6D), UL64(0x6170B72B72059566),
+          UL64(0xFBA05610CFA5F228), UL64(0xC1B3DD15894CBF1A),
+          UL64(0xC6C524F0314FF436), UL64(0xB27E0C6107A1FFDD) },
+        { UL64(0x7AA7A1583AE9C1BD), UL64(0xE0AF6D98E37CE240),
+          UL64(0xE54342D928AB38B4), UL64(0xE8B750070A1C98CA),
+          UL64(0xEFCE86AFE02358F2), UL64(0x31B8B856EA921228),
+          UL64(0x052A19120A1C67FC), UL64(0xB4069EA4E3AEAD59) },
+    },
+    {
+        { UL64(0x9F51439E558DF019), UL64(0x230DA4BAAC712B27),
+          UL64(0x518919E355185A24), UL64(0x4DCEFCDD84B78F50),
+          UL64(0xA7D90FB2A47D4C5A), UL64(0x55AC9ABFB30E009E),
+          UL64(0xFD2FC35974EED273), UL64(0xB72D824CDBEA8FAF) },
+        { UL64(0x549DB2B5EF7D9289), UL64(0x2480D4A8197F015A),
+          UL64(0x61D5590BC40493B6), UL64(0x3A55B52E6F780331),
+          UL64(0x40EB8115309EADB0), UL64(0xDEA7DE5A92E5C625),
+          UL64(0x64D631F0CC6A3D5A), UL64(0x9D5E9D7C93E8DD61) },
+        { UL64(0x1B7A588D04C82BDD), UL64(0x68005534F8319DFD),
+          UL64(0xDE8A55B5D8EB9580), UL64(0x5EA886DA8D5BCA81),
+          UL64(0xE8530A01252A0B4D), UL64(0x1BFFB4FE35EAA0A1),
+          UL64(0x2AD828B1D8E99563), UL64(0x7DE96EF595F9CD87) },
+        { UL64(0x196860411E84E0E5), UL64(0xA5DB84D3AEA34C93),
+          UL64(0xF9D5BB197073A732), UL64(0xB8D2FE566BCFD7C0),
+          UL64(0x45775F36F3EB82FA), UL64(0x8CB20CCCFDFF8B58),
+          UL64(0x1659B65F8374C110), UL64(0xB8B4A422330C789A) },
+        { UL64(0x745741E57EA973DC), UL64(0x5C00CA7020888F2E),
+          UL64(0x7CDCE3CF45FD9CF1), UL64(0x8A741EF15507F872),
+          UL64(0x47C51C2F196B4CEC), UL64(0x70D08E43C97EA618),
+          UL64(0x930DA15C15B18A2B), UL64(0x33B6C6782F610514) },
+        { UL64(0xC925FF87AEDBAE9F), UL64(0x7DAF0EB936880A54),
+          UL64(0x9284DDF59C4D0E71), UL64(0x1581CF93316F8CF5),
+          UL64(0x3EECA8873AC1F452), UL64(0xB417FCE9FB6AEFFE),
+          UL64(0xA5918046EEFB8DC3), UL64(0x73D318AC02209400) },
+        { UL64(0x6BA535DA9A85788B), UL64(0xD21F03AEBD0626D4),
+          UL64(0x099F8C47E873DC64), UL64(0xCDA8564D018EC97E),
+          UL64(0x3E8D7A5CDE92C68C), UL64(0x78E035A173323CC4),
+          UL64(0x3EF26275F880FF7C), UL64(0xA4EE3DFF273EEDAA) },
+        { UL64(0xC4F4CDA3AF2EBC2F), UL64(0xA0AF843DCB4EFE24),
+          UL64(0x53B857C19CCD10B1), UL64(0xDDC9D1EB914D3E04),
+          UL64(0x7BDEC8BB62771DEB), UL64(0x829277AA91C5AA81),
+          UL64(0x7AF18DD6832391AE), UL64(0x1740F316C71A84CA) },
+        { UL64(0xBA9E5C88A56D73ED), UL64(0x6C24F7712CA054D3),
+          UL64(0x4A37C235083BEAE1), UL64(0x04A883B26483E9FD),
+          UL64(0x0C63F3AEE27C2C5D), UL64(0x0E1DA88DAE4671F1),
+          UL64(0xA577E8E25995E1DB), UL64(0xBFC4B1B16ED6066A) },
+        { UL64(0xDD4A12D8E12B31F8), UL64(0x577E29BC177736E6),
+          UL64(0x2353722BA88935E8), UL64(0xCA1D3729015F286D),
+          UL64(0x86C7B6A239A3E035), UL64(0x6E5250BFD3B03A9F),
+          UL64(0x79D98930FD0D536E), UL64(0x8C4CBBABFA0C3832) },
+        { UL64(0x169B38C9A43B2339), UL64(0x884308D91732BFAB),
+          UL64(0xE4B593A28FF202DD), UL64(0xAF51D11F1E65376C),
+          UL64(0x6EC648DE741525FF), UL64(0xF93CBD369FF4C628),
+          UL64(0xC76DF9EFB1129C79), UL64(0x31A5F2E2B7A67294) },
+        { UL64(0x2D500910CAB91F1E), UL64(0xBEDD9E444D1CD216),
+          UL64(0xD634B74FEDD02252), UL64(0xBD60F8E11258617A),
+          UL64(0xD8C7537B9E05614A), UL64(0xFD26C766E7AF5FC5),
+          UL64(0x0660B581582BD926), UL64(0x87019244ACF07FC8) },
+        { UL64(0x2C3B7322BADCFE8E), UL64(0x6E0616FAC5E25A04),
+          UL64(0x0A3C12753DA6E4A2), UL64(0xE46C957E077BCA01),
+          UL64(0xB46CA4E3DA4BE64B), UL64(0xA59BDA668E75EE78),
+          UL64(0x41835184A4DE98F2), UL64(0x6EFB1F924ED6A568) },
+        { UL64(0xAFA26CCFAF64ECB6), UL64(0xE6054F974BD72775),
+          UL64(0xBBCBAB5B140F695A), UL64(0xBC71B4A4E348EFDE),
+          UL64(0xFC2E52BECC96D963), UL64(0x150ABF5F5E5D9018),
+          UL64(0xBD182FA604568771), UL64(0x35B4C06170339F83) },
+        { UL64(0x4741B9B311370605), UL64(0x47FA72F75D09B355),
+          UL64(0x391A71AC7A144C6A), UL64(0x0808C0F498B6E3CA),
+          UL64(0x7EAED9EF7FE53900), UL64(0xF157A2A5E5A830BA),
+          UL64(0xD13EC09127974AFC), UL64(0x78D710A70B87997D) },
+        { UL64(0x8928E99AEEAF8C49), UL64(0xEE7AA73D6E24D728),
+          UL64(0x4C5007C2E72B156C), UL64(0x5FCF57C5ED408A1D),
+          UL64(0x9F719E39B6057604), UL64(0x7D343C01C2868BBF),
+          UL64(0x2CCA254B7E103E2D), UL64(0xE6EB38A9F131BEA2) },
+        { UL64(0x27E1D3ECCD201911), UL64(0xB1119A70AD72C0EB),
+          UL64(0xF8B3E3AF6AB57FFB), UL64(0x23C1685B5B92C42B),
+          UL64(0x2C27B7B9D08D7AAF), UL64(0x0F660DC3189A591C),
+          UL64(0x7BCAA102ADC843CA), UL64(0xDED38BB41AB27652) },
+        { UL64(0xC624A04E5F40FF52), UL64(0x3611D7CFFCD2914A),
+          UL64(0xB7E8B42B1FD3BFD6), UL64(0x6CDE40FDFA85063A),
+          UL64(0x7811C449178B7E5B), UL64(0x4CB609312972CC13),
+          UL64(0xF579125E33B46135), UL64(0xCA102EF788A4E56E) },
+        { UL64(0x96BD677F5DEF0B84), UL64(0xE96FA87B97DE99B9),
+          UL64(0x5DD3FEC14EBE1553), UL64(0x315743E67E4275CD),
+          UL64(0x81F13125B1B48323), UL64(0xC4AFB1DD4D498E75),
+          UL64(0x84568E7D3F15DAD9), UL64(0xD8E3A61BA3AE73B8) },
+        { UL64(0x0BA4E3520A981B0D), UL64(0x1C354CB3BD1A41A4),
+          UL64(0x1AABAA3ADF9FAB9C), UL64(0x0701A7D153C418D5),
+          UL64(0xDD1A7CEFDCF2B921), UL64(0x6CEEF0B3BCF48061),
+          UL64(0x1083B598DE25CCE6), UL64(0x890A54C7E90A5E34) },
+        { UL64(0xA62BB4421C02CAF4), UL64(0x6A74481DDB627B5A),
+          UL64(0x1D5625F62C6BF52D), UL64(0x1FC5FD4C73B246A0),
+          UL64(0x3F6DFC621731813D), UL64(0x8322DF79E58854BE),
+          UL64(0xE51438B2FA8B2EE4), UL64(0xBE7378482D4ACDA0) },
+        { UL64(0xC535956640AC1807), UL64(0xD4C1E56684DA0B1E),
+          UL64(0xC4B33F97E0B82421), UL64(0xD0BD23177B41BE00),
+          UL64(0x53A4B42E147B72E1), UL64(0xF8D39F5FF777104C),
+          UL64(0x36E64E64D3FB530D), UL64(0xA7A6BA6756074FDD) },
+        { UL64(0x1B658FE31ECA7C71), UL64(0x20945214E4ADDAB8),
+          UL64(0x7D4E5D3F11F9C299), UL64(0xD7F62AE72F845004),
+          UL64(0x417E6D6AE22A1E92), UL64(0x1AB67F85CA4C7141),
+          UL64(0x44B2D9C0279AB5ED), UL64(0x2D0BF0B8FA57CE11) },
+        { UL64(0x405718DB4F6D01B1), UL64(0xE73C6BC28F11E8A0),
+          UL64(0xAC11BB8CA0591A3B), UL64(0x12D09A5A0ACC4531),
+          UL64(0xCBF174EEE7DE13F4), UL64(0x177E2BE6044FD682),
+          UL64(0x65F574CB1C48AF70), UL64(0xCE5966929961CB7C) },
+        { UL64(0x64836BFC10F6BAE9), UL64(0x6BD5616E0A087608),
+          UL64(0xCFD5C4632F0B7807), UL64(0x0568271261A08578),
+          UL64(0x30303777630F2CCD), UL64(0x9EFDA732C2E2AB40),
+          UL64(0xCA95B1C56B0F9592), UL64(0xF78FB23ED0F2F2D8) },
+        { UL64(0x989FE84EBC6FAB9F), UL64(0xE70CE6B1C80F6474),
+          UL64(0xBE9FF3053B02A1BC), UL64(0x12EF486699C0AFD3),
+          UL64(0x22D957F9E3411A26), UL64(0x0B41D8817B485B98),
+          UL64(0x820E56D04AE20119), UL64(0x81E3D01F328528E0) },
+        { UL64(0xD47DD477BE827C8A), UL64(0xEE4A69E7EC10E44D),
+          UL64(0xAF236038130ED77C), UL64(0xF2045CCE804C65F0),
+          UL64(0xFB8719032A4B70DB), UL64(0xFF36B3CCB33C9FF5),
+          UL64(0x4C37F2E61FD2783D), UL64(0xE5117EDE910071D6) },
+        { UL64(0xC59EED6C048752A1), UL64(0x41F2702EA01341B4),
+          UL64(0x6E35903B9DC6B092), UL64(0x4291ABA81F5B5B23),
+          UL64(0x8173AA70A653D61D), UL64(0xD1B648D44F2EB51E),
+          UL64(0x31B7CE065AB93F8F), UL64(0xA55408EE99E2F4FE) },
+        { UL64(0x1BC4FA8BDADC4404), UL64(0x0EDB9534DAA12EE3),
+          UL64(0x084481B6A5F7289C), UL64(0x7F42461D9D8FB3D2),
+          UL64(0xF93F1D3212293C70), UL64(0xC14706596BB73EA3),
+          UL64(0xF80834AFDE339CAD), UL64(0x99DCFC0081F22953) },
+        { UL64(0x1FA4ED0985E34160), UL64(0xA26D7DC37A03CDE2),
+          UL64(0x1DAC0848FA84DF2D), UL64(0x5E9A28D61B697108),
+          UL64(0xA88004D914EA0EA1), UL64(0xA8D154283FFE5520),
+          UL64(0x4F422DAE639B139C), UL64(0xEEDCCC0DD4B5A861) },
+        { UL64(0x541D1636D7748ECD), UL64(0x385AABF07B865C2E),
+          UL64(0xD2C2F9ECE1DCE431), UL64(0xFF1603258B95E052),
+          UL64(0x0CDE4C3F7A33077A), UL64(0x675BDD5612E41F97),
+          UL64(0xC35181AE71F5A6F1), UL64(0xD55600C8AE753EF8) },
+        { UL64(0xB33E624F8BE762B4), UL64(0x2A9EE4D1058E3413),
+          UL64(0x968E636967D805FA), UL64(0x9848949B7DB8BFD7),
+          UL64(0x5308D7E5D23A8417), UL64(0x892F3B1DF3E29DA5),
+          UL64(0xC95C139E3DEE471F), UL64(0x8631594DD757E089) },
+    },
+    {
+        { UL64(0x1083E2EA1F095615), UL64(0x0A28AD7714E68C33),
+          UL64(0x6BFC02523D8818BE), UL64(0xB585113AF35850CD),
+          UL64(0x7D935F0B30DF8AA1), UL64(0xADDDA07C4AB7E3AC),
+          UL64(0x92C34299552F00CB), UL64(0xC33ED1DE2909DF6C) },
+        { UL64(0x2DC40D483E07113C), UL64(0x6E4A5D397D8B63AE),
+          UL64(0x5582A94B79684C2B), UL64(0x932B33D4622DA26C),
+          UL64(0xF534F6510DBBF08D), UL64(0x211D07C964C23A52),
+          UL64(0x0EEECE0FEE5BDC9B), UL64(0xDF178168F7015558) },
+        { UL64(0xABE7905A83CDD60E), UL64(0x50602FB5A1170184),
+          UL64(0x689886CDB023642A), UL64(0xD568D090A6E1FB00),
+          UL64(0x5B1922C70259217F), UL64(0x93831CD9C43141E4),
+          UL64(0xDFCA35870C95F86E), UL64(0xDEC2057A568AE828) },
+        { UL64(0x568F8925913CC16D), UL64(0x18BC5B6DE1A26F5A),
+          UL64(0xDFA413BEF5F499AE), UL64(0xF8835DECC3F0AE84),
+          UL64(0xB6E60BD865A40AB0), UL64(0x65596439194B377E),
+          UL64(0xBCD8562592084A69), UL64(0x5CE433B94F23EDE0) },
+        { UL64(0x860D523D42E06189), UL64(0xBF0779414E3AFF13),
+          UL64(0x0B616DCAC1B20650), UL64(0xE66DD6D12131300D),
+          UL64(0xD4A0FD67FF99ABDE), UL64(0xC9903550C7AAC50D),
+          UL64(0x022ECF8B7C46B2D7), UL64(0x3333B1E83ABF92AF) },
+        { UL64(0xC0DA65E784D6365D), UL64(0xBCB7443F8F759FB8),
+          UL64(0x35C712B17AE81930), UL64(0x80428DFF4C6E08AB),
+          UL64(0xF19DAFEFA4FAF843), UL64(0xCED8538DFFA9855F),
+          UL64(0x20AC409CBE3AC7CE), UL64(0x358C1FB6882DA71E) },
+        { UL64(0xEFECDEF7BE42A582), UL64(0xD3FC608065046BE6),
+          UL64(0xC9AF13C809E8DBA9), UL64(0x1E6C9847641491FF),
+          UL64(0x3B574925D30C31F7), UL64(0xB7EB72BAAC2A2122),
+          UL64(0x776A0DACEF0859E7), UL64(0x06FEC31421900942) },
+        { UL64(0x324794B07E50122B), UL64(0xDD744F8B4AF07CA5),
+          UL64(0x30A12F08D63FC97B), UL64(0x39650F1A76626D9D),
+          UL64(0x101B47F71FA38477), UL64(0x3D815F19D4DC124F),
+          UL64(0x1569AE95B26EB58A), UL64(0xC3CDE18895FB1887) },
+        { UL64(0x7EC62FBBF4737F21), UL64(0xD8DBA5AB6209F5AC),
+          UL64(0x24B5D7A9A5F9ADBE), UL64(0x707D28F7A61DC768),
+          UL64(0x7711460BCAA999EA), UL64(0xBA7B174D1C92E4CC),
+          UL64(0x3C4BAB6618D4BF2D), UL64(0xB8F0C980EB8BD279) },
+        { UL64(0x9D658932790691BF), UL64(0xED61058906B736AE),
+          UL64(0x712C2F04C0D63B6E), UL64(0x5CF06FD5C63D488F),
+          UL64(0x97363FACD9588E41), UL64(0x1F9BF7622B93257E),
+          UL64(0xA9D1FFC4667ACACE), UL64(0x1CF4A1AA0A061ECF) },
+        { UL64(0x28D675B2C0519A23), UL64(0x9EBF94FE4F6952E3),
+          UL64(0xF28BB767A2294A8A), UL64(0x85512B4DFE0AF3F5),
+          UL64(0x18958BA899B16A0D), UL64(0x95C2430CBA7548A7),
+          UL64(0xB30D1B10A16BE615), UL64(0xE3EBBB9785BFB74C) },
+        { UL64(0x07B53F5EB2E63645), UL64(0xBE57E54784C84232),
+          UL64(0xD779C2167214D5CF), UL64(0x617969CD029A3ACA),
+          UL64(0xD17668CD8A7017A0), UL64(0x77B4D19ABE9B7EE8),
+          UL64(0x58FD0E939C161776), UL64(0xA8C4F4EFD5968A72) },
+        { UL64(0x81EEB865D2FDCA23), UL64(0x5A15EE08CC8EF895),
+          UL64(0x768FA10A01905614), UL64(0xEFF5B8EF880EE19B),
+          UL64(0xF0C0CABBCB1C8A0E), UL64(0x2E1EE9CDB8C838F9),
+          UL64(0x0587D8B88A4A14C0), UL64(0xF6F278962FF698E5) },
+        { UL64(0x519D34B3BF44DA80), UL64(0x283834F95AB32E66),
+          UL64(0x6E6087976278A000), UL64(0x1E62960E627312F6),
+          UL64(0x9B87B27BE6901C55), UL64(0x80E7853824FDBC1F),
+          UL64(0xBBBC09512FACC27D), UL64(0x06394239AC143B5A) },
+        { UL64(0x9C4B646E9E2FCE99), UL64(0x68A210811E80857F),
+          UL64(0x06D54E443643B52A), UL64(0xDE8D6D630D8EB843),
+          UL64(0x7032156342146A0A), UL64(0x8BA826F25EAA3622),
+          UL64(0x227A58BD86138787), UL64(0x43B6C03C10281D37) },
+        { UL64(0x02B37A952F41DEFF), UL64(0x0E44A59AE63B89B7),
+          UL64(0x673257DC143FF951), UL64(0x19C02205D752BAF4),
+          UL64(0x46C23069C4B7D692), UL64(0x2E6392C3FD1502AC),
+          UL64(0x6057B1A21B220846), UL64(0xE51FF9460C1B5B63) },
+        { UL64(0x7ACA2632F02FC0F0), UL64(0xB92B337DC7F01C86),
+          UL64(0x624BC4BF5AFBDC7D), UL64(0x812B07BC4DE21A5E),
+          UL64(0x29D137240B2090CC), UL64(0x0403C5095A1B2132),
+          UL64(0x1DCA34D50E35E015), UL64(0xF085ED7D3BBBB66F) },
+        { UL64(0xBEC866862EAE5735), UL64(0x580501F2F9B6F03E),
+          UL64(0x8BFF2063990E74C2), UL64(0xFADC4E3D9F40C840),
+          UL64(0x0357D3A032EB6F2A), UL64(0xE318B22E0DF1C98A),
+          UL64(0xBB9A2D8D502ADD38), UL64(0x6F7E957A4A84CE6A) },
+        { UL64(0xC27B98F9F781E865), UL64(0x51E1F692994E1345),
+          UL64(0x0807D516E19361EE), UL64(0x13885CEFFB998AEF),
+          UL64(0xD223D5E92F0F8A17), UL64(0x48672010E8D20280),
+          UL64(0x6F02FD60237EAC98), UL64(0xCC51BFAD9ADA7EE7) },
+        { UL64(0x0BE78D673D1F3648), UL64(0xB170AEBF26F82644),
+          UL64(0x9D88B5AF11AAA6F5), UL64(0x57444EB240930EB2),
+          UL64(0xD0964A764AD92906), UL64(0x4CA05DE3BFF87E5F),
+          UL64(0x1141A6C80B869084), UL64(0x3183FCA34ADA948D) },
+        { UL64(0x2756BCDD1E09701D), UL64(0x94E31DB990D45C80),
+          UL64(0xB9E856A98566E584), UL64(0x4F87D9DEAB10E3F3),
+          UL64(0x166ECB373DED9CB2), UL64(0xFD14C7073F653D3E),
+          UL64(0x105D049B92AEC425), UL64(0x7F657E4909A42E11) },
+        { UL64(0xC380A39BA5D609A1), UL64(0x6C711E7724C10ECB),
+          UL64(0xE8D53CC6B922D070), UL64(0xEAC37B810AB57D84),
+          UL64(0xE260C978A770CAA7), UL64(0xDBF26129AA71F4B5),
+          UL64(0xE2EED9B6489A8E30), UL64(0x488FD27FEB3F75FE) },
+        { UL64(0xEA6490076A159594), UL64(0x3E424D6B1F97CE52),
+          UL64(0xAC6DF30A185E8CCB), UL64(0xAD56EC80517747BF),
+          UL64(0xF0935CCF4391FE93), UL64(0x866B260F03811D40),
+          UL64(0x792047B99F7B9ABE), UL64(0xB1600BC88EE42D84) },
+        { UL64(0xDD5845927CA37123), UL64(0x903F1311088BBDD5),
+          UL64(0xDCDECF65A2C2272E), UL64(0x9E356E26D61F6FE0),
+          UL64(0xEEAD9F9D54480DC0), UL64(0x91CAA1401446BE5A),
+          UL64(0x9C66CC8DC4C075D1), UL64(0x5E529A62BC85C9B8) },
+        { UL64(0x2D97B3DB7768A85F), UL64(0x2B78F6334287E038),
+          UL64(0x86C947676F892BB1), UL64(0x920BFB1AC0A9C200),
+          UL64(0x4292F6EC332041B2), UL64(0xA30BB937C9989D54),
+          UL64(0x39F941EBC6D5879E), UL64(0x76A450FCDFDBB187) },
+        { UL64(0x5FB793C39C29A890), UL64(0xB0A03BFD87A811B1),
+          UL64(0xB0249E4912F128D3), UL64(0x107B3A135AED3EDE),
+          UL64(0x98E199562034D932), UL64(0xD8CEC7710DC7D71C),
+          UL64(0xE7563713B231E0B2), UL64(0x6284D285AC968C02) },
+        { UL64(0x31256089EE430DB6), UL64(0xAECE9BD8F6836F56),
+          UL64(0x484CFC4BFB85A046), UL64(0xEE1E3E2C1599B2B9),
+          UL64(0x7E3C38903D122EAF), UL64(0xAA940CE0C770556C),
+          UL64(0x4802D6631B08FAE8), UL64(0xB08A85807F69F8BA) },
+        { UL64(0x70ED0A0405411EAE), UL64(0x60DEB08F16494C66),
+          UL64(0x8CF20FC6133797BB), UL64(0x3E30F4F50C6BC310),
+          UL64(0x1A677C29749C46C7), UL64(0xFE1D93F4F11E981C),
+          UL64(0x937303D82E3E688B), UL64(0x01AEF5A7A6AA9E85) },
+        { UL64(0x4902F495B959B920), UL64(0x13B0FDBDFCA2D885),
+          UL64(0x41CBD9E7B6A2F0FA), UL64(0xF9BDF11056430B87),
+          UL64(0xD705A223954D19B9), UL64(0x74D0FC5C972A4FDE),
+          UL64(0xCBCBFED6912977EA), UL64(0x870611FDCC59A5AF) },
+        { UL64(0xBA7219ABBB302F57), UL64(0x28CE0059FAB32730),
+          UL64(0xFD26DCA0A8F54322), UL64(0x69A90D6BB26BBDCF),
+          UL64(0xE95DD3BC8949638B), UL64(0x76E1A4F1922B6A2D),
+          UL64(0x99F73CB1D5872CFD), UL64(0x752B149ADB32A3CE) },
+        { UL64(0xF4F19BD04089236A), UL64(0x3B206C12313D0E0B),
+          UL64(0x73E70DF303FEAEB2), UL64(0x09DBA0EB9BD1EFE0),
+          UL64(0x4C7FD532FC4E5305), UL64(0xD792FFEDE93D787A),
+          UL64(0xC72DC4E2E4245010), UL64(0xE7E0D47D0466BBBD) },
+        { UL64(0x6E85CB51566C5C43), UL64(0xCFF9C9193597F046),
+          UL64(0x9354E90C4994D94A), UL64(0xE0A393322147927D),
+          UL64(0x8427FAC10DC1EB2B), UL64(0x88CFD8C22FF319FA),
+          UL64(0xE2D4E68401965274), UL64(0xFA2E067D67AAA746) },
+    },
+    {
+        { UL64(0xB6D92A7F3E5F9F11), UL64(0x9AFE153AD6CB3B8E),
+          UL64(0x4D1A6DD7DDF800BD), UL64(0xF6C13CC0CAF17E19),
+          UL64(0x15F6C58E325FC3EE), UL64(0x71095400A31DC3B2),
+          UL64(0x168E7C07AFA3D3E7), UL64(0x3F8417A194C7AE2D) },
+        { UL64(0x2842589B319540C3), UL64(0x18490F59A283D6F8),
+          UL64(0xA2731F84DAAE9FCB), UL64(0x3DB6D960C3683BA0),
+          UL64(0xC85C63BB14611069), UL64(0xB19436AF0788BF05),
+          UL64(0x905459DF347460D2), UL64(0x73F6E094E11A7DB1) },
+        { UL64(0x7B85BB91C31B9C38), UL64(0x0C5AA90B48EF57B5),
+          UL64(0xDEDEB169AF3BAB6F), UL64(0xE610AD732D373685),
+          UL64(0xF13870DF02BA8E15), UL64(0x0337EDB68CA7F771),
+          UL64(0xE4ACF747B62C036C), UL64(0xD921D576B6B94E81) },
+        { UL64(0xF306A3C8EE3C76CB), UL64(0x3CF11623D32A1F6E),
+          UL64(0xE6D5AB646863E956), UL64(0x3B8A4CBE5C005C26),
+          UL64(0xDCD529A59CE6BB27), UL64(0xC4AFAA5204D4B16F),
+          UL64(0xB0624A267923798D), UL64(0x85E56DF66B307FAB) },
+        { UL64(0x3A3E5334859DD614), UL64(0x9C475B5B18D0C8EE),
+          UL64(0x63080D1F07CD51D5), UL64(0xC9C0D0A6B88B4326),
+          UL64(0x1AC98691C234296F), UL64(0x2A0A83A494887FB6),
+          UL64(0x565114270CEA9CF2), UL64(0x5230A6E8A24802F5) },
+        { UL64(0xAD0FC73DBCE913AF), UL64(0x909E587B458A07CB),
+          UL64(0x1300DA84D4F00C8A), UL64(0x425CD048B54466AC),
+          UL64(0xB59CB9BE90E9D8BF), UL64(0x991616DB3E431B0E),
+          UL64(0xD3AA117A531AECFF), UL64(0x91AF92D359F4DC3B) },
+        { UL64(0x7A3EE20720445C36), UL64(0x71D1AC8259877174),
+          UL64(0x0FC539F7949F73E9), UL64(0xD05CF3D7982E3081),
+          UL64(0x8758E20B7B1C7129), UL64(0xFFADCC20569E61F2),
+          UL64(0xB05D3A2F59544C2D), UL64(0xBE16F5C19FFF5E53) },
+        { UL64(0xB2330FEF4E4CA463), UL64(0xBCEF72873566CC63),
+          UL64(0xD161D2CACF780900), UL64(0x135DC5395B54827D),
+          UL64(0x638F052E27BF1BC6), UL64(0x10A224F007DFA06C),
+          UL64(0xE973586D6D3321DA), UL64(0x8B0C573826152C8F) },
+        { UL64(0x7043178BB9556098), UL64(0x4090A1DF801C3886),
+          UL64(0x759800FF9B67B912), UL64(0x3E5C0304232620C8),
+          UL64(0x4B9D3C4B70DCEECA), UL64(0xBB2D3C15181F648E),
+          UL64(0xF981D8376E33345C), UL64(0xB626289B0CF2297A) },
+        { UL64(0x9DC74CBD32BE5E0F), UL64(0x7475BCB717A01375),
+          UL64(0x438477C950D872B1), UL64(0xCEC67879FFE1D63D),
+          UL64(0x9B006014D8578C70), UL64(0xC9AD99A878BB6B8B),
+          UL64(0x6799008E11FB3806), UL64(0xCFE81435CD44CAB3) },
+        { UL64(0x113FFEC19EF2D2E4), UL64(0x1BF6767ED5A0EA7F),
+          UL64(0x57FFF75E03714C0A), UL64(0xA23C422E0A23E9EE),
+          UL64(0xDD5F6B2D540F83AF), UL64(0xC2C2C27E55EA46A7),
+          UL64(0xEB6B4246672A1208), UL64(0xD13599F7AE634F7A) },
+        { UL64(0x896895959884AAF7), UL64(0xB1959BE307B348A6),
+          UL64(0x96250E573C147C87), UL64(0xAE0EFB3ADD0C61F8),
+          UL64(0xED00745ECA8C325E), UL64(0x3C911696ECFF3F70),
+          UL64(0x73ACBC65319AD41D), UL64(0x7B01A020F0B1C7EF) },
+        { UL64(0xAF89790D9D79046E), UL64(0x4D650F2D6CEE0976),
+          UL64(0xA3935D9A43071ECA), UL64(0x66FCD2C9283B0BFE),
+          UL64(0x0E665EB5696605F1), UL64(0xE77E5D07A54CD38D),
+          UL64(0x90EE050A43D950CF), UL64(0x86DDEBDAD32E69B5) },
+        { UL64(0xD2EDB89B3A8631E8), UL64(0x8DE855DE7A213746),
+          UL64(0xB2056CB7B00C5F11), UL64(0xDEAEFBD02C9B85E4),
+          UL64(0x03F39A8DD150892D), UL64(0x37B84686218B7985),
+          UL64(0x36296DD8B7375F1A), UL64(0x472CD4B1B78E898E) },
+        { UL64(0xEB45AE53308FBD93), UL64(0x46CD5A2E02C36FDA),
+          UL64(0x6A3D4E90BAA48385), UL64(0xDD55E62E9DBE9960),
+          UL64(0xA1406AA02A81EDE7), UL64(0x6860DD14F9274EA7),
+          UL64(0xCFDCB0C280414F86), UL64(0xFF410B1022F94327) },
+        { UL64(0x9910BA6B23A5D896), UL64(0x1FE19E357FE4364E),
+          UL64(0x6E1DA8C39A33C677), UL64(0x15B4488B29FD9FD0),
+          UL64(0x1F4392541A1F22BF), UL64(0x920A8A70AB8163E8),
+          UL64(0x3FD1B24907E5658E), UL64(0xF2C4F79CB6EC839B) },
+        { UL64(0x17D55DE3B44A3F84), UL64(0xACB2F34417C6C690),
+          UL64(0x3208816810232390), UL64(0xF2E8A61F6C733BF7),
+          UL64(0xA774AAB69C2D7652), UL64(0xFB5307E3ED95C5BC),
+          UL64(0xA05C73C24981F110), UL64(0x1BAAE31CA39458C9) },
+        { UL64(0xCE1DB2BBC55D2D8B), UL64(0x41D58BB7F4F6CA56),
+          UL64(0x7650B6808F877614), UL64(0x905E16BAF4C349ED),
+          UL64(0xED415140F661ACAC), UL64(0x3B8784F0CB2270AF),
+          UL64(0x3BC280AC8A402CBA), UL64(0xD53F71460937921A) },
+        { UL64(0x7F1ED86C78341730), UL64(0x8EF5BEB8B525E248),
+          UL64(0xBBC489FDB74FBF38), UL64(0x38A92A0E91A0B382),
+          UL64(0x7A77BA3F22433CCF), UL64(0xDE8362D6A29F05A9),
+          UL64(0x7F6A30EA61189AFC), UL64(0x693B550559EF114F) },
+        { UL64(0x262143B5224C08DC), UL64(0x2BBB09B481B50C91),
+          UL64(0xC16ED709ACA8C84F), UL64(0xA6210D9DB2850CA8),
+          UL64(0x6D8DF67A09CB54D6), UL64(0x91EEF6E0500919A4),
+          UL64(0x90F613810F132857), UL64(0x9ACEDE47F8D5028B) },
+        { UL64(0x071A2FA8CED806B8), UL64(0x222E6134697F1478),
+          UL64(0xDC16FD5DABFCDBBF), UL64(0x44912EBF121B53B8),
+          UL64(0xAC9436742496C27C), UL64(0x8EA3176C1FFC26B0),
+          UL64(0xB6E224AC13DEBF2C), UL64(0x524CC235F372A832) },
+        { UL64(0x7E98367D3567962F), UL64(0x379ED61F8188BFFB),
+          UL64(0x73BBA348FAF130A1), UL64(0x6C1F75E1904ED734),
+          UL64(0x189566423B4A79FC), UL64(0xF20BC83D54EF4493),
+          UL64(0x836D425D9111ECA1), UL64(0xE5B5C318009A8DCF) },
+        { UL64(0x2771A5BDDA85D534), UL64(0x53E78C1FFF980EEA),
+          UL64(0xADF1CF84900385E7), UL64(0x7D3B14F6C9387B62),
+          UL64(0x170E74B0CB8F2BD2), UL64(0x2D50B486827FA993),
+          UL64(0xCDBE8C9AF6F32BAB), UL64(0x55E906B0C3B93AB8) },
+        { UL64(0x84CEA0691416A6A5), UL64(0x8F860C7943EF881C),
+          UL64(0x41311F8A38038A5D), UL64(0xE78C2EC0FC612067),
+          UL64(0x494D2E815AD73581), UL64(0xB4CC9E0059604097),
+          UL64(0xFF558AECF3612CBA), UL64(0x35BEEF7A9E36C39E) },
+        { UL64(0x324EC0CC36BA06EE), UL64(0xFACE31153DD2CC0C),
+          UL64(0xB364F3BEF333E91F), UL64(0xEF8AFF7328E832B0),
+          UL64(0x1E9BAD042D05841B), UL64(0x42F0E3DF356A21E2),
+          UL64(0xA3270BCB4ADD627E), UL64(0xB09A8158D322E711) },
+        { UL64(0x323F8ECD66926E04), UL64(0x0001E38F8110C1BA),
+          UL64(0x8DBCAC12FC6A7F07), UL64(0xD65E1D580CEC0827),
+          UL64(0xD2CD4141BE76CA2D), UL64(0x7895CF5CE892F33A),
+          UL64(0x956D230D367139D2), UL64(0xA91ABD3ED012C4C1) },
+        { UL64(0x28FF779D6295D426), UL64(0x0C4F6AC73FA3AD7B),
+          UL64(0xEC44D0548B8E2604), UL64(0x9B32A66D8B0050E1),
+          UL64(0x1F943366F0476CE2), UL64(0x7554D953A602C7B4),
+          UL64(0xBE35ACA6524F2809), UL64(0xB6881229FD4EDBEA) },
+        { UL64(0x45E21446DE673629), UL64(0x57F7AA1E703C2D21),
+          UL64(0xA0E99B7F98C868C7), UL64(0x4E42F66D8B641676),
+          UL64(0x602884DC91077896), UL64(0xA0D690CFC2C9885B),
+          UL64(0xFEB4DA333B9A5187), UL64(0x5F789598153C87EE) },
+        { UL64(0xB782DCE715F09690), UL64(0x508B9B122DFC0FC9),
+          UL64(0x9015AB4B65D89FC6), UL64(0x5E79DAB7D6D5BB0F),
+          UL64(0x64F021F06C775AA2), UL64(0xDF09D8CC37C7ECA1),
+          UL64(0x9A761367EF2FA506), UL64(0xED4CA4765B81EEC6) },
+        { UL64(0x3B83711967B0867C), UL64(0x8D5E0D089D364520),
+          UL64(0x52DCCC1ED930F0E3), UL64(0xEFBBCEC7BF20BBAF),
+          UL64(0x99CFFCAB0263AD10), UL64(0xD8199E6DFCD18F8A),
+          UL64(0x64E2773FE9F10617), UL64(0x0079E8E108704848) },
+        { UL64(0xBB9CCE4D5C2F342B), UL64(0xBF80907AB52D7AAE),
+          UL64(0x97F3D3CD2161BCD0), UL64(0xB25B08340962744D),
+          UL64(0xC5B18EA56C3A1DDA), UL64(0xFE4EC7EB06C92317),
+          UL64(0xB787B890AD1C4AFE), UL64(0xDCCD9A920EDE801A) },
+        { UL64(0x8B5C619C76497EE8), UL64(0x5D2B0AC6C717370E),
+          UL64(0x98204CB64FCF68E1), UL64(0x0BDEC21162BC6792),
+          UL64(0x6973CCEFA63B1011), UL64(0xF9E3FA97E0DE1AC5),
+          UL64(0x5EFB693E3D0E0C8B), UL64(0x037248E9D2D4FCB4) },
+    },
+    {
+        { UL64(0x80802DC91EC34F9E), UL64(0xD8772D3533810603),
+          UL64(0x3F06D66C530CB4F3), UL64(0x7BE5ED0DC475C129),
+          UL64(0xCB9E3C1931E82B10), UL64(0xC63D2857C9FF6B4C),
+          UL64(0xB92118C692A1B45E), UL64(0x0AEC44147285BBCA) },
+        { UL64(0xFC189AE71E29A3EF), UL64(0xCBE906F04C93302E),
+          UL64(0xD0107914CEAAE10E), UL64(0xB7A23F34B68E19F8),
+          UL64(0xE9D875C2EFD2119D), UL64(0x03198C6EFCADC9C8),
+          UL64(0x65591BF64DA17113), UL64(0x3CF0BBF83D443038) },
+        { UL64(0xAE485BB72B724759), UL64(0x945353E1B2D4C63A),
+          UL64(0x82159D07DE7D6F2C), UL64(0x389CAEF34EC5B109),
+          UL64(0x4A8EBB53DB65EF14), UL64(0x2DC2CB7EDD99DE43),
+          UL64(0x816FA3ED83F2405F), UL64(0x73429BB9C14208A3) },
+        { UL64(0xB618D590B01E6E27), UL64(0x047E2CCDE180B2DC),
+          UL64(0xD1B299B504AEA4A9), UL64(0x412C9E1E9FA403A4),
+          UL64(0x88D28A3679407552), UL64(0x49C50136F332B8E3),
+          UL64(0x3A1B6FCCE668DE19), UL64(0x178851BC75122B97) },
+        { UL64(0xB1E13752FB85FA4C), UL64(0xD61257CE383C8CE9),
+          UL64(0xD43DA670D2F74DAE), UL64(0xA35AA23FBF846BBB),
+          UL64(0x5E74235D4421FC83), UL64(0xF6DF8EE0C363473B),
+          UL64(0x34D7F52A3C4AA158), UL64(0x50D05AAB9BC6D22E) },
+        { UL64(0x8C56E735A64785F4), UL64(0xBC56637B5F29CD07),
+          UL64(0x53B2BB803EE35067), UL64(0x50235A0FDC919270),
+          UL64(0x191AB6D8F2C4AA65), UL64(0xC34758318396023B),
+          UL64(0x80400BA5F0F805BA), UL64(0x8881065B5EC0F80F) },
+        { UL64(0xC370E522CC1B5E83), UL64(0xDE2D4AD1860B8BFB),
+          UL64(0xAD364DF067B256DF), UL64(0x8F12502EE0138997),
+          UL64(0x503FA0DC7783920A), UL64(0xE80014ADC0BC866A),
+          UL64(0x3F89B744D3064BA6), UL64(0x03511DCDCBA5DBA5) },
+        { UL64(0x197DD46D95A7B1A2), UL64(0x9C4E7AD63C6341FB),
+          UL64(0x426ECA29484C2ECE), UL64(0x9211E489DE7F4F8A),
+          UL64(0x14997F6EC78EF1F4), UL64(0x2B2C091006574586),
+          UL64(0x17286A6E1C3EEDE8), UL64(0x25F92E470F60E018) },
+        { UL64(0x805C564631890A36), UL64(0x703EF60057FEEA5B),
+          UL64(0x389F747CAF3C3030), UL64(0xE0E5DAEB54DD3739),
+          UL64(0xFE24A4C3C9C9F155), UL64(0x7E4BF176B5393962),
+          UL64(0x37183DE2AF20BF29), UL64(0x4A1BD7B5F95A8C3B) },
+        { UL64(0xA83B969946191D3D), UL64(0x281FC8DD7B87F257),
+          UL64(0xB18E2C1354107588), UL64(0x6372DEF79B2BAFE8),
+          UL64(0xDAF4BB480D8972CA), UL64(0x3F2DD4B756167A3F),
+          UL64(0x1EACE32D84310CF4), UL64(0xE3BCEFAFE42700AA) },
+        { UL64(0x5FE5691ED785E73D), UL64(0xA5DB5AB62EA60467),
+          UL64(0x02E23D41DFC6514A), UL64(0x35E8048EE03C3665),
+          UL64(0x3F8B118F1ADAA0F8), UL64(0x28EC3B4584CE1A5A),
+          UL64(0xE8CACC6E2C6646B8), UL64(0x1343D185DBD0E40F) },
+        { UL64(0xE5D7F844CAAA358C), UL64(0x1A1DB7E49924182A),
+          UL64(0xD64CD42D9C875D9A), UL64(0xB37B515F042EEEC8),
+          UL64(0x4D4DD4097B165FBE), UL64(0xFC322ED9E206EFF3),
+          UL64(0x7DEE410259B7E17E), UL64(0x55A481C08236CA00) },
+        { UL64(0x8C885312C23FC975), UL64(0x1571580605D6297B),
+          UL64(0xA078868EF78EDD39), UL64(0x956B31E003C45E52),
+          UL64(0x470275D5FF7B33A6), UL64(0xC8D5DC3A0C7E673F),
+          UL64(0x419227B47E2F2598), UL64(0x8B37B6344C14A975) },
+        { UL64(0xD0667ED68B11888C), UL64(0x5E0E8C3E803E25DC),
+          UL64(0x34E5D0DCB987A24A), UL64(0x9F40AC3BAE920323),
+          UL64(0x5463DE9534E0F63A), UL64(0xA128BF926B6328F9),
+          UL64(0x491CCD7CDA64F1B7), UL64(0x7EF1EC27C47BDE35) },
+        { UL64(0xA857240FA36A2737), UL64(0x35DC136663621BC1),
+          UL64(0x7A3A6453D4FB6897), UL64(0x80F1A439C929319D),
+          UL64(0xFC18274BF8CB0BA0), UL64(0xB0B537668078C5EB),
+          UL64(0xFB0D49241E01D0EF), UL64(0x50D7C67D372AB09C) },
+        { UL64(0xB4E370AF3AEAC968), UL64(0xE4F7FEE9C4B63266),
+          UL64(0xB4ACD4C2E3AC5664), UL64(0xF8910BD2CEB38CBF),
+          UL64(0x1C3AE50CC9C0726E), UL64(0x15309569D97B40BF),
+          UL64(0x70884B7FFD5A5A1B), UL64(0x3890896AEF8314CD) },
+        { UL64(0x58E1515CA5618C93), UL64(0xE665432B77D942D1),
+          UL64(0xB32181BFB6F767A8), UL64(0x753794E83A604110),
+          UL64(0x09AFEB7CE8C0DBCC), UL64(0x31E02613598673A3),
+          UL64(0x5D98E5577D46DB00), UL64(0xFC21FB8C9D985B28) },
+        { UL64(0xC9040116B0843E0B), UL64(0x53B1B3A869B04531),
+          UL64(0xDD1649F085D7D830), UL64(0xBB3BCC87CB7427E8),
+          UL64(0x77261100C93DCE83), UL64(0x7E79DA61A1922A2A),
+          UL64(0x587A2B02F3149CE8), UL64(0x147E1384DE92EC83) },
+        { UL64(0x484C83D3AF077F30), UL64(0xEA78F8440658B53A),
+          UL64(0x912076C2027AEC53), UL64(0xF34714E393C8177D),
+          UL64(0x37EF5D15C2376C84), UL64(0x8315B6593D1AA783),
+          UL64(0x3A75C484EF852A90), UL64(0x0BA0C58A16086BD4) },
+        { UL64(0x29688D7A529A6D48), UL64(0x9C7F250DC2F19203),
+          UL64(0x123042FB682E2DF9), UL64(0x2B7587E7AD8121BC),
+          UL64(0x30FC0233E0182A65), UL64(0xB82ECF87E3E1128A),
+          UL64(0x7168286193FB098F), UL64(0x043E21AE85E9E6A7) },
+        { UL64(0xAB5B49D666C834EA), UL64(0x3BE43E1847414287),
+          UL64(0xF40FB859219A2A47), UL64(0x0E6559E9CC58DF3C),
+          UL64(0xFE1DFE8E0C6615B4), UL64(0x14ABC8FD56459D70),
+          UL64(0x7BE0FA8E05DE0386), UL64(0x8E63EF68E9035C7C) },
+        { UL64(0x116401B453B31E91), UL64(0x0CBA7AD44436B4D8),
+          UL64(0x9151F9A0107AFD66), UL64(0xAFACA8D01F0EE4C4),
+          UL64(0x75FE5C1D9EE9761C), UL64(0x3497A16BF0C0588F),
+          UL64(0x3EE2BEBD0304804C), UL64(0xA8FB9A60C2C990B9) },
+        { UL64(0xD14D32FE39251114), UL64(0x36BF25BCCAC73366),
+          UL64(0xC9562C66DBA7495C), UL64(0x324D301B46AD348B),
+          UL64(0x9F46620CD670407E), UL64(0x0EA8D4F1E3733A01),
+          UL64(0xD396D532B0C324E0), UL64(0x5B211A0E03C317CD) },
+        { UL64(0x090D7D205FFE7B37), UL64(0x3B7F3EFB1747D2DA),
+          UL64(0xA2CB525FB54FC519), UL64(0x6E220932F66A971E),
+          UL64(0xDDC160DFB486D440), UL64(0x7FCFEC463FE13465),
+          UL64(0x83DA7E4E76E4C151), UL64(0xD6FA48A1D8D302B5) },
+        { UL64(0xC6304F265872CD88), UL64(0x806C1D3C278B90A1),
+          UL64(0x3553E725CAF0BC1C), UL64(0xFF59E603BB9D8D5C),
+          UL64(0xA4550F327A0B85DD), UL64(0xDEC5720A93ECC217),
+          UL64(0x0B88B74169D62213), UL64(0x7212F2455B365955) },
+        { UL64(0x20764111B5CAE787), UL64(0x13CB7F581DFD3124),
+          UL64(0x2DCA77DA1175AEFB), UL64(0xEB75466BFFAAE775),
+          UL64(0x74D76F3BDB6CFF32), UL64(0x7440F37A61FCDA9A),
+          UL64(0x1BB3AC92B525028B), UL64(0x20FBF8F7A1975F29) },
+        { UL64(0x982692E1DF83097F), UL64(0x28738F6C554B0800),
+          UL64(0xDC703717A2CE2F2F), UL64(0x7913B93C40814194),
+          UL64(0x049245931FE89636), UL64(0x7B98443FF78834A6),
+          UL64(0x11C6AB015114A5A1), UL64(0x60DEB383FFBA5F4C) },
+        { UL64(0x4CAA54C601A982E6), UL64(0x1DD35E113491CD26),
+          UL64(0x973C315F7CBD6B05), UL64(0xCAB0077552494724),
+          UL64(0x04659B1F6565E15A), UL64(0xBF30F5298C8FB026),
+          UL64(0xFC21641BA8A0DE37), UL64(0xE9C7A366FA5E5114) },
+        { UL64(0xDB849CA552F03AD8), UL64(0xC7E8DBE9024E35C0),
+          UL64(0xA1A2BBACCFC3C789), UL64(0xBF733E7D9C26F262),
+          UL64(0x882FFBF5B8444823), UL64(0xB7224E886BF8483B),
+          UL64(0x53023B8B65BEF640), UL64(0xAABFEC91D4D5F8CD) },
+        { UL64(0xA40E1510079EA1BD), UL64(0x1AD9ADDCD05D5D26),
+          UL64(0xDB3F2EAB13E68D4F), UL64(0x1CFF1AE2640F803F),
+          UL64(0xE0E7B749D4CEE117), UL64(0x8E9F275B4036D909),
+          UL64(0xCE34E31D8F4D4C38), UL64(0x22B37F69D75130FC) },
+        { UL64(0x83E0F1FDB4014604), UL64(0xA8CE991989415078),
+          UL64(0x82375B7541792EFE), UL64(0x4F59BF5C97D4515B),
+          UL64(0xAC4F324F923A277D), UL64(0xD9BC9B7D650F3406),
+          UL64(0xC6FA87D18A39BC51), UL64(0x825885305CCC108F) },
+        { UL64(0x5CED3C9F82E4C634), UL64(0x8EFB83143A4464F8),
+          UL64(0xE706381B7A1DCA25), UL64(0x6CD15A3C5A2A412B),
+          UL64(0x9347A8FDBFCD8FB5), UL64(0x31DB2EEF6E54CD22),
+          UL64(0xC4AEB11EF8D8932F), UL64(0x11E7C1ED344411AF) },
+    },
+};
+
+#if defined(MBEDTLS_HAVE_X86_64)
+#define P256_CPU_CHECKED        1
+#define P256_CPU_ADX            2
+
+/*
+ * Features found by p256_check_cpu(): 0 before the first check, then
+ * P256_CPU_CHECKED, plus P256_CPU_ADX if MULX and ADX are available.
+ *
+ * Threads may run the first check concurrently without locking. This race
+ * is benign, as in mbedtls_aesni_has_support(): this code is only built for
+ * x86-64, where an aligned int is loaded and stored in a single access, all
+ * threads store the same value, and a thread only reads p256_cpu after its
+ * own call to p256_check_cpu(), so it never sees 0 there.
+ */
+static int p256_cpu = 0;
+
+/*
+ * Detect BMI2 (MULX) and ADX, CPUID.(EAX=07H,ECX=0):EBX bits 8 and 19
+ */
+static void p256_check_cpu( void )
+{
+    if( p256_cpu == 0 )
+    {
+        unsigned int max_leaf, ebx7 = 0;
+
+        asm( "xorl  %%ecx, %%ecx \n\t"
+             "xorl  %%eax, %%eax \n\t"
+             "cpuid              \n\t"
+             : "=a" (max_leaf)
+             :
+             : "ebx", "ecx", "edx" );
+
+        if( max_leaf >= 7 )
+        {
+            asm( "movl  $7, %%eax   \n\t"
+                 "xorl  %%ecx, %%ecx \n\t"
+                 "cpuid             \n\t"
+                 : "=b" (ebx7)
+                 :
+                 : "eax", "ecx", "edx" );
+        }
+
+        p256_cpu = P256_CPU_CHECKED |
+                   ( ( ebx7 & 0x00080100u ) == 0x00080100u ? P256_CPU_ADX : 0 );
+    }
+}
+#else
+#define p256_check_cpu()
+#endif /* MBEDTLS_HAVE_X86_64 */
+
+/*
+ * Return the low word of a * b + c + *carry, and the high word in *carry
+ */
+static inline uint64_t p256_mac( uint64_t a, uint64_t b, uint64_t c,
+                                 uint64_t *carry )
+{
+#if defined(MBEDTLS_HAVE_INT64) && defined(MBEDTLS_HAVE_UDBL)
+    mbedtls_t_udbl t = (mbedtls_t_udbl) a * b + c + *carry;
+
+    *carry = (uint64_t)( t >> 64 );
+    return( (uint64_t) t );
+#else
+    uint64_t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = ( p00 >> 32 ) + ( p01 & 0xFFFFFFFF ) + ( p10 & 0xFFFFFFFF );
+    uint64_t lo = ( mid << 32 ) | ( p00 & 0xFFFFFFFF );
+    uint64_t hi = p11 + ( p01 >> 32 ) + ( p10 >> 32 ) + ( mid >> 32 );
+
+    lo += c;
+    hi += ( lo < c );
+    lo += *carry;
+    hi += ( lo < *carry );
+    *carry = hi;
+    return( lo );
+#endif
+}
+
+/*
+ * Return a + b + *carry, and the carry out in *carry
+ */
+static inline uint64_t p256_adc( uint64_t a, uint64_t b, uint64_t *carry )
+{
+    uint64_t s = a + b + *carry;
+
+    *carry = ( ( a & b ) | ( ( a | b ) & ~s ) ) >> 63;
+    return( s );
+}
+
+/*
+ * Return a - b - *borrow, and the borrow out in *borrow
+ */
+static inline uint64_t p256_sbb( uint64_t a, uint64_t b, uint64_t *borrow )
+{
+    uint64_t d = a - b - *borrow;
+
+    *borrow = ( ( ~a & b ) | ( ~( a ^ b ) & d ) ) >> 63;
+    return( d );
+}
+
+/*
+ * r = (t, hi) mod p, for (t, hi) < 2p
+ */
+static void p256_reduce_once( p256_fe r, const uint64_t t[4], uint64_t hi )
+{
+    uint64_t s[4], b = 0, keep;
+    int i;
+
+    for( i = 0; i < 4; i++ )
+        s[i] = p256_sbb( t[i], p256_p[i], &b );
+
+    /* keep t if (t, hi) < p, that is if hi - b borrows */
+    keep = 0 - ( ( hi ^ 1 ) & b );
+    for( i = 0; i < 4; i++ )
+        r[i] = ( t[i] & keep ) | ( s[i] & ~keep );
+}
+
+#if defined(MBEDTLS_HAVE_X86_64)
+/*
+ * One step of the Montgomery multiplication with MULX/ADX [GK15]:
+ * (A0..A5) += a * b[i], in two interleaved carry chains, then
+ * (A0..A5) = ( (A0..A5) + A0 * p ) / 2^64, which thanks to the form of p
+ * is (A1..A5) + ( A0 << 32 ) + ( A0 >> 32 ) * 2^64 + A0 * p[3] * 2^128.
+ * The accumulator then is A1..A5, with A0 free for the next step.
+ */
+#define P256_MULX_STEP( i, A0, A1, A2, A3, A4, A5 )                  \
+    "xorl   %k[" #A5 "], %k[" #A5 "]              \n\t"             \
+    "movq   8*" #i "(%[b]), %%rdx                 \n\t"             \
+    "mulx   0(%[a]), %[lo], %[hi]                 \n\t"             \
+    "adcx   %[lo], %[" #A0 "]                     \n\t"             \
+    "adox   %[hi], %[" #A1 "]                     \n\t"             \
+    "mulx   8(%[a]), %[lo], %[hi]                 \n\t"             \
+    "adcx   %[lo], %[" #A1 "]                     \n\t"             \
+    "adox   %[hi], %[" #A2 "]                     \n\t"             \
+    "mulx   16(%[a]), %[lo], %[hi]                \n\t"             \
+    "adcx   %[lo], %[" #A2 "]                     \n\t"             \
+    "adox   %[hi], %[" #A3 "]                     \n\t"             \
+    "mulx   24(%[a]), %[lo], %[hi]                \n\t"             \
+    "adcx   %[lo], %[" #A3 "]                     \n\t"             \
+    "adox   %[hi], %[" #A4 "]                     \n\t"             \
+    "movl   $0, %k[lo]                            \n\t"             \
+    "adcx   %[lo], %[" #A4 "]                     \n\t"             \
+    "adox   %[lo], %[" #A5 "]                     \n\t"             \
+    "adcx   %[lo], %[" #A5 "]                     \n\t"             \
+                                                                    \
+    "movq   %[" #A0 "], %%rdx                     \n\t"             \
+    "movq   %[" #A0 "], %[lo]                     \n\t"             \
+    "movq   %[" #A0 "], %[hi]                     \n\t"             \
+    "shlq   $32, %[lo]                            \n\t"             \
+    "shrq   $32, %[hi]                            \n\t"             \
+    "addq   %[lo], %[" #A1 "]                     \n\t"             \
+    "adcq   %[hi], %[" #A2 "]                     \n\t"             \
+    "adcq   $0, %[" #A3 "]                        \n\t"             \
+    "adcq   $0, %[" #A4 "]                        \n\t"             \
+    "adcq   $0, %[" #A5 "]                        \n\t"             \
+    "mulx   %[p3], %[lo], %[hi]                   \n\t"             \
+    "addq   %[lo], %[" #A3 "]                     \n\t"             \
+    "adcq   %[hi], %[" #A4 "]                     \n\t"             \
+    "adcq   $0, %[" #A5 "]                        \n\t"
+
+static void p256_mul_mont_adx( p256_fe r, const p256_fe a, const p256_fe b )
+{
+    uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0, lo, hi, t[4];
+
+    asm( P256_MULX_STEP( 0, t0, t1, t2, t3, t4, t5 )
+         P256_MULX_STEP( 1, t1, t2, t3, t4, t5, t0 )
+         P256_MULX_STEP( 2, t2, t3, t4, t5, t0, t1 )
+         P256_MULX_STEP( 3, t3, t4, t5, t0, t1, t2 )
+         : [t0] "+r" (t0), [t1] "+r" (t1), [t2] "+r" (t2),
+           [t3] "+r" (t3), [t4] "+r" (t4), [t5] "+r" (t5),
+           [lo] "=&r" (lo), [hi] "=&r" (hi)
+         : [a] "r" (a), [b] "r" (b), [p3] "m" (p256_p[3])
+         : "rdx", "cc", "memory" );
+
+    t[0] = t4;
+    t[1] = t5;
+    t[2] = t0;
+    t[3] = t1;
+    p256_reduce_once( r, t, t2 );
+}
+#endif /* MBEDTLS_HAVE_X86_64 */
+
+/*
+ * r = a * b / 2^256 mod p, word by word Montgomery multiplication
+ * (-p^-1 mod 2^64 is 1, so the multiple of p to add is the low word)
+ */
+static void p256_mul( p256_fe r, const p256_fe a, const p256_fe b )
+{
+    uint64_t t[6] = { 0, 0, 0, 0, 0, 0 }, c, m;
+    int i, j;
+
+#if defined(MBEDTLS_HAVE_X86_64)
+    if( p256_cpu & P256_CPU_ADX )
+    {
+        p256_mul_mont_adx( r, a, b );
+        return;
+    }
+#endif
+
+    for( i = 0; i < 4; i++ )
+    {
+        c = 0;
+        for( j = 0; j < 4; j++ )
+            t[j] = p256_mac( a[j], b[i], t[j], &c );
+        t[4] += c;
+        t[5] = ( t[4] < c );
+
+        m = t[0];
+        c = 0;
+        (void) p256_mac( m, p256_p[0], t[0], &c );
+        for( j = 1; j < 4; j++ )
+            t[j - 1] = p256_mac( m, p256_p[j], t[j], &c );
+        t[3] = t[4] + c;
+        t[4] = t[5] + ( t[3] < c );
+    }
+
+    p256_reduce_once( r, t, t[4] );
+}
+
+static void p256_sqr( p256_fe r, const p256_fe a )
+{
+    p256_mul( r, a, a );
+}
+
+static void p256_add( p256_fe r, const p256_fe a, const p256_fe b )
+{
+    uint64_t t[4], c = 0;
+    int i;
+
+    for( i = 0; i < 4; i++ )
+        t[i] = p256_adc( a[i], b[i], &c );
+    p256_reduce_once( r, t, c );
+}
+
+static void p256_sub( p256_fe r, const p256_fe a, const p256_fe b )
+{
+    uint64_t t[4], mask, b_ = 0, c = 0;
+    int i;
+
+    for( i = 0; i < 4; i++ )
+        t[i] = p256_sbb( a[i], b[i], &b_ );
+    mask = 0 - b_;
+    for( i = 0; i < 4; i++ )
+        r[i] = p256_adc( t[i], p256_p[i] & mask, &c );
+}
+
+/*
+ * All ones if a == 0, 0 otherwise
+ */
+static uint64_t p256_is_zero( const p256_fe a )
+{
+    uint64_t t = a[0] | a[1] | a[2] | a[3];
+
+    return( 0 - ( ( ( t | ( 0 - t ) ) >> 63 ) ^ 1 ) );
+}
+
+/*
+ * r = mask ? a : b, mask being 0 or all ones
+ */
+static void p256_select( p256_fe r, uint64_t mask,
+                         const p256_fe a, const p256_fe b )
+{
+    int i;
+
+    for( i = 0; i < 4; i++ )
+        r[i] = ( a[i] & mask ) | ( b[i] & ~mask );
+}
+
+static void p256_sqr_n( p256_fe r, const p256_fe a, int n )
+{
+    p256_sqr( r, a );
+    while( --n > 0 )
+        p256_sqr( r, r );
+}
+
+/*
+ * r = a^(p-2) = a^-1 mod p (0 if a == 0), with the exponent
+ * ffffffff 00000001 00000000 00000000 00000000 ffffffff ffffffff fffffffd
+ * built from runs of ones: x_k = a^(2^k - 1)
+ */
+static void p256_inv( p256_fe r, const p256_fe a )
+{
+    p256_fe x2, x3, x6, x12, x15, x30, x32, t;
+
+    p256_sqr( t, a );
+    p256_mul( x2, t, a );
+    p256_sqr( t, x2 );
+    p256_mul( x3, t, a );
+    p256_sqr_n( t, x3, 3 );
+    p256_mul( x6, t, x3 );
+    p256_sqr_n( t, x6, 6 );
+    p256_mul( x12, t, x6 );
+    p256_sqr_n( t, x12, 3 );
+    p256_mul( x15, t, x3 );
+    p256_sqr_n( t, x15, 15 );
+    p256_mul( x30, t, x15 );
+    p256_sqr_n( t, x30, 2 );
+    p256_mul( x32, t, x2 );
+
+    p256_sqr_n( t, x32, 32 );
+    p256_mul( t, t, a );
+    p256_sqr_n( t, t, 96 + 32 );
+    p256_mul( t, t, x32 );
+    p256_sqr_n( t, t, 32 );
+    p256_mul( t, t, x32 );
+    p256_sqr_n( t, t, 30 );
+    p256_mul( t, t, x30 );
+    p256_sqr_n( t, t, 2 );
+    p256_mul( r, t, a );
+}
+
+/*
+ * Conversions between big-endian bytes and field elements or scalars
+ */
+static void p256_from_bytes( uint64_t r[4], const unsigned char buf[32] )
+{
+    int i, j;
+
+    for( i = 0; i < 4; i++ )
+    {
+        r[i] = 0;
+        for( j = 0; j < 8; j++ )
+            r[i] |= (uint64_t) buf[31 - 8 * i - j] << ( 8 * j );
+    }
+}
+
+static void p256_to_bytes( unsigned char buf[32], const uint64_t a[4] )
+{
+    int i, j;
+
+    for( i = 0; i < 4; i++ )
+        for( j = 0; j < 8; j++ )
+            buf[31 - 8 * i - j] = (unsigned char)( a[i] >> ( 8 * j ) );
+}
+
+/*
+ * Read a coordinate (< p) into Montgomery form
+ */
+static int p256_from_mpi( p256_fe r, const mbedtls_mpi *X )
+{
+    int ret;
+    unsigned char buf[32];
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( X, buf, sizeof( buf ) ) );
+    p256_from_bytes( r, buf );
+    p256_mul( r, r, p256_rr );
+
+cleanup:
+    return( ret );
+}
+
+static int p256_to_mpi( mbedtls_mpi *X, const p256_fe a )
+{
+    unsigned char buf[32];
+    p256_fe t;
+    static const p256_fe one = { 1, 0, 0, 0 };
+
+    p256_mul( t, a, one );
+    p256_to_bytes( buf, t );
+
+    return( mbedtls_mpi_read_binary( X, buf, sizeof( buf ) ) );
+}
+
+/*
+ * Read the scalar (< n) as little-endian bytes, with room for the windows
+ * that go past the top bit
+ */
+static int p256_scalar( unsigned char k[34], const mbedtls_mpi *m )
+{
+    int ret;
+    unsigned char buf[32];
+    size_t i;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( m, buf, sizeof( buf ) ) );
+    for( i = 0; i < 32; i++ )
+        k[i] = buf[31 - i];
+    k[32] = k[33] = 0;
+
+cleanup:
+    mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    return( ret );
+}
+
+/*
+ * Signed digit of the window of w + 1 bits of k starting at bit start
+ * (which may be -1): returns 2 * |d| + ( d < 0 ), |d| <= 2^(w-1)
+ */
+static unsigned int p256_digit( const unsigned char k[34], int start,
+                                unsigned int w )
+{
+    unsigned int in, s, d;
+
+    if( start < 0 )
+        in = ( (unsigned int) k[0] << 1 ) & ( ( 2u << w ) - 1 );
+    else
+        in = ( ( k[start / 8] | ( (unsigned int) k[start / 8 + 1] << 8 ) )
+               >> ( start % 8 ) ) & ( ( 2u << w ) - 1 );
+
+    s = ~( ( in >> w ) - 1 );
+    d = ( 2u << w ) - in - 1;
+    d = ( d & s ) | ( in & ~s );
+    d = ( d >> 1 ) + ( d & 1 );
+
+    return( ( d << 1 ) + ( s & 1 ) );
+}
+
+/*
+ * All ones if a == b, 0 otherwise
+ */
+static uint64_t p256_eq_mask( unsigned int a, unsigned int b )
+{
+    uint64_t t = a ^ b;
+
+    return( 0 - ( ( t - 1 ) >> 63 ) );
+}
+
+/*
+ * Point doubling R = 2 P, "dbl-2001-b" [EFD]; 2 * infinity = infinity
+ */
+static void p256_double( p256_jac *R, const p256_jac *P )
+{
+    p256_fe delta, gamma, beta, alpha, t1, t2;
+
+    p256_sqr( delta, P->Z );
+    p256_sqr( gamma, P->Y );
+    p256_mul( beta, P->X, gamma );
+    p256_sub( t1, P->X, delta );
+    p256_add( t2, P->X, delta );
+    p256_mul( alpha, t1, t2 );
+    p256_add( t1, alpha, alpha );
+    p256_add( alpha, alpha, t1 );
+
+    p256_add( t1, P->Y, P->Z );
+    p256_sqr( t1, t1 );
+    p256_sub( t1, t1, gamma );
+    p256_sub( R->Z, t1, delta );
+
+    p256_add( beta, beta, beta );
+    p256_add( beta, beta, beta );               /* 4 beta */
+    p256_sqr( t1, alpha );
+    p256_add( t2, beta, beta );
+    p256_sub( R->X, t1, t2 );
+
+    p256_sub( t1, beta, R->X );
+    p256_mul( t1, alpha, t1 );
+    p256_sqr( gamma, gamma );
+    p256_add( gamma, gamma, gamma );
+    p256_add( gamma, gamma, gamma );
+    p256_add( gamma, gamma, gamma );            /* 8 gamma^2 */
+    p256_sub( R->Y, t1, gamma );
+}
+
+/*
+ * Point addition R = P + Q, "add-2007-bl" [EFD], either may be infinity.
+ * The formula gives infinity for P == Q: if dbl is set, 2 P is computed as
+ * well and selected in that case. Callers only clear dbl where P == Q
+ * cannot happen whatever the scalar, so dbl never depends on secret data.
+ */
+static void p256_add_jac( p256_jac *R, const p256_jac *P, const p256_jac *Q,
+                          int dbl )
+{
+    p256_fe z1z1, z2z2, u1, u2, s1, s2, h, i, j, r, v, t;
+    p256_jac S, D;
+    uint64_t p_inf, q_inf, eq;
+
+    p_inf = p256_is_zero( P->Z );
+    q_inf = p256_is_zero( Q->Z );
+
+    p256_sqr( z1z1, P->Z );
+    p256_sqr( z2z2, Q->Z );
+    p256_mul( u1, P->X, z2z2 );
+    p256_mul( u2, Q->X, z1z1 );
+    p256_mul( s1, P->Y, Q->Z );
+    p256_mul( s1, s1, z2z2 );
+    p256_mul( s2, Q->Y, P->Z );
+    p256_mul( s2, s2, z1z1 );
+    p256_sub( h, u2, u1 );
+    p256_sub( r, s2, s1 );
+
+    eq = p256_is_zero( h ) & p256_is_zero( r ) & ~p_inf & ~q_inf;
+    if( dbl )
+        p256_double( &D, P );
+
+    p256_add( r, r, r );
+    p256_add( i, h, h );
+    p256_sqr( i, i );
+    p256_mul( j, h, i );
+    p256_mul( v, u1, i );
+
+    p256_sqr( S.X, r );
+    p256_sub( S.X, S.X, j );
+    p256_sub( S.X, S.X, v );
+    p256_sub( S.X, S.X, v );
+
+    p256_sub( t, v, S.X );
+    p256_mul( S.Y, r, t );
+    p256_mul( t, s1, j );
+    p256_add( t, t, t );
+    p256_sub( S.Y, S.Y, t );
+
+    p256_add( t, P->Z, Q->Z );
+    p256_sqr( t, t );
+    p256_sub( t, t, z1z1 );
+    p256_sub( t, t, z2z2 );
+    p256_mul( S.Z, t, h );
+
+    p256_select( S.X, p_inf, Q->X, S.X );
+    p256_select( S.Y, p_inf, Q->Y, S.Y );
+    p256_select( S.Z, p_inf, Q->Z, S.Z );
+    p256_select( R->X, q_inf, P->X, S.X );
+    p256_select( R->Y, q_inf, P->Y, S.Y );
+    p256_select( R->Z, q_inf, P->Z, S.Z );
+    if( dbl )
+    {
+        p256_select( R->X, eq, D.X, R->X );
+        p256_select( R->Y, eq, D.Y, R->Y );
+        p256_select( R->Z, eq, D.Z, R->Z );
+    }
+}
+
+/*
+ * Mixed addition R = P + Q with Q affine, "madd-2007-bl" [EFD]. P may be
+ * infinity, and Q is ignored (taken as infinity) if q_inf is all ones.
+ * P == Q is handled as in p256_add_jac() if dbl is set.
+ */
+static void p256_add_aff( p256_jac *R, const p256_jac *P,
+                          const p256_aff *Q, uint64_t q_inf, int dbl )
+{
+    p256_fe z1z1, u2, s2, h, hh, i, j, r, v, t;
+    p256_jac S, D;
+    uint64_t p_inf, eq;
+
+    p_inf = p256_is_zero( P->Z );
+
+    p256_sqr( z1z1, P->Z );
+    p256_mul( u2, Q->X, z1z1 );
+    p256_mul( s2, Q->Y, P->Z );
+    p256_mul( s2, s2, z1z1 );
+    p256_sub( h, u2, P->X );
+    p256_sub( r, s2, P->Y );
+
+    eq = p256_is_zero( h ) & p256_is_zero( r ) & ~p_inf & ~q_inf;
+    if( dbl )
+        p256_double( &D, P );
+
+    p256_add( r, r, r );
+    p256_sqr( hh, h );
+    p256_add( i, hh, hh );
+    p256_add( i, i, i );
+    p256_mul( j, h, i );
+    p256_mul( v, P->X, i );
+
+    p256_sqr( S.X, r );
+    p256_sub( S.X, S.X, j );
+    p256_sub( S.X, S.X, v );
+    p256_sub( S.X, S.X, v );
+
+    p256_sub( t, v, S.X );
+    p256_mul( S.Y, r, t );
+    p256_mul( t, P->Y, j );
+    p256_add( t, t, t );
+    p256_sub( S.Y, S.Y, t );
+
+    p256_add( t, P->Z, h );
+    p256_sqr( t, t );
+    p256_sub( t, t, z1z1 );
+    p256_sub( S.Z, t, hh );
+
+    p256_select( S.X, p_inf, Q->X, S.X );
+    p256_select( S.Y, p_inf, Q->Y, S.Y );
+    p256_select( S.Z, p_inf, p256_one, S.Z );
+    p256_select( R->X, q_inf, P->X, S.X );
+    p256_select( R->Y, q_inf, P->Y, S.Y );
+    p256_select( R->Z, q_inf, P->Z, S.Z );
+    if( dbl )
+    {
+        p256_select( R->X, eq, D.X, R->X );
+        p256_select( R->Y, eq, D.Y, R->Y );
+        p256_select( R->Z, eq, D.Z, R->Z );
+    }
+}
+
+/*
+ * Negate Y if the low bit of the digit is set
+ */
+static void p256_cond_neg( p256_fe Y, unsigned int digit )
+{
+    p256_fe t;
+
+    p256_sub( t, p256_zero, Y );
+    p256_select( Y, 0 - (uint64_t)( digit & 1 ), t, Y );
+}
+
+/*
+ * R = digit * P from T[i] = ( i + 1 ) P, reading all of T;
+ * infinity for digit 0
+ */
+static void p256_select_jac( p256_jac *R, const p256_jac T[P256_POINTS],
+                             unsigned int digit )
+{
+    unsigned int i, d = digit >> 1;
+    uint64_t mask;
+    int k;
+
+    memset( R, 0, sizeof( *R ) );
+    for( i = 0; i < P256_POINTS; i++ )
+    {
+        mask = p256_eq_mask( i + 1, d );
+        for( k = 0; k < 4; k++ )
+        {
+            R->X[k] |= T[i].X[k] & mask;
+            R->Y[k] |= T[i].Y[k] & mask;
+            R->Z[k] |= T[i].Z[k] & mask;
+        }
+    }
+    p256_cond_neg( R->Y, digit );
+}
+
+/*
+ * R = digit * 2^(P256_BASE_W * j) * G from the base table, reading the
+ * whole row j; returns all ones for digit 0 (R is then undefined)
+ */
+static uint64_t p256_select_base( p256_aff *R, int j, unsigned int digit )
+{
+    unsigned int i, d = digit >> 1;
+    uint64_t mask;
+    int k;
+
+    memset( R, 0, sizeof( *R ) );
+    for( i = 0; i < P256_BASE_POINTS; i++ )
+    {
+        mask = p256_eq_mask( i + 1, d );
+        for( k = 0; k < 4; k++ )
+        {
+            R->X[k] |= p256_base_table[j][i][k] & mask;
+            R->Y[k] |= p256_base_table[j][i][k + 4] & mask;
+        }
+    }
+    p256_cond_neg( R->Y, digit );
+
+    return( p256_eq_mask( d, 0 ) );
+}
+
+/*
+ * Randomize the Jacobian coordinates of P: (l^2 X, l^3 Y, l Z), [2]
+ * in ecp.c
+ */
+static int p256_randomize( p256_jac *P,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng )
+{
+    int ret, count = 0;
+    unsigned char buf[32];
+    p256_fe l, ll, t;
+    uint64_t b;
+    int i;
+
+    do
+    {
+        if( ++count > 10 )
+            return( MBEDTLS_ERR_ECP_RANDOM_FAILED );
+
+        if( ( ret = f_rng( p_rng, buf, sizeof( buf ) ) ) != 0 )
+            return( ret );
+        p256_from_bytes( l, buf );
+
+        /* accept 1 < l < p */
+        b = 0;
+        for( i = 0; i < 4; i++ )
+            (void) p256_sbb( l[i], p256_p[i], &b );
+    }
+    while( b == 0 || ( l[0] <= 1 && ( l[1] | l[2] | l[3] ) == 0 ) );
+
+    p256_mul( l, l, p256_rr );
+    p256_sqr( ll, l );
+    p256_mul( P->X, P->X, ll );
+    p256_mul( t, ll, l );
+    p256_mul( P->Y, P->Y, t );
+    p256_mul( P->Z, P->Z, l );
+
+    mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    mbedtls_platform_zeroize( l, sizeof( l ) );
+    return( 0 );
+}
+
+/*
+ * R = k * P, fixed window of P256_W bits with signed digits
+ */
+static void p256_mul_var( p256_jac *R, const unsigned char k[34],
+                          const p256_jac *P )
+{
+    p256_jac T[P256_POINTS], A;
+    int i, j;
+
+    /* i P != P for 2 <= i <= P256_POINTS, as the order of P is n */
+    T[0] = *P;
+    p256_double( &T[1], P );
+    for( i = 2; i < P256_POINTS; i++ )
+        p256_add_jac( &T[i], &T[i - 1], P, 0 );
+
+    p256_select_jac( R, T, p256_digit( k, P256_W * ( P256_WINDOWS - 1 ) - 1,
+                                       P256_W ) );
+    for( j = P256_WINDOWS - 2; j >= 0; j-- )
+    {
+        for( i = 0; i < P256_W; i++ )
+            p256_double( R, R );
+        p256_select_jac( &A, T, p256_digit( k, P256_W * j - 1, P256_W ) );
+        /*
+         * R = 2^W m P and A = d P with |d| <= 2^(W-1), and for j > 0,
+         * |2^W m| <= k / 2^(W j) + 2 < n: R == A would need 2^W m == d,
+         * so only the last addition may add equal points.
+         */
+        p256_add_jac( R, R, &A, j == 0 );
+    }
+
+    mbedtls_platform_zeroize( T, sizeof( T ) );
+    mbedtls_platform_zeroize( &A, sizeof( A ) );
+}
+
+/*
+ * R = k * G from the base table, one mixed addition per window
+ */
+static int p256_mul_base( p256_jac *R, const unsigned char k[34],
+                          int (*f_rng)(void *, unsigned char *, size_t),
+                          void *p_rng )
+{
+    int ret = 0, j;
+    p256_aff A;
+    uint64_t a_inf;
+
+    a_inf = p256_select_base( &A, 0, p256_digit( k, -1, P256_BASE_W ) );
+    memcpy( R->X, A.X, sizeof( p256_fe ) );
+    memcpy( R->Y, A.Y, sizeof( p256_fe ) );
+    p256_select( R->Z, a_inf, p256_zero, p256_one );
+
+    if( f_rng != NULL )
+        MBEDTLS_MPI_CHK( p256_randomize( R, f_rng, p_rng ) );
+
+    for( j = 1; j < P256_BASE_WINDOWS; j++ )
+    {
+        a_inf = p256_select_base( &A, j,
+                        p256_digit( k, P256_BASE_W * j - 1, P256_BASE_W ) );
+        /*
+         * R = c G with |c| < 2^(W j - 1) and A = d 2^(W j) G with
+         * 1 <= |d| <= 2^(W-1): c - d 2^(W j) is non-zero and below n in
+         * absolute value unless W j + W >= 256, so only the last addition
+         * may add equal points.
+         */
+        p256_add_aff( R, R, &A, a_inf,
+                      P256_BASE_W * ( j + 1 ) >= 256 );
+    }
+
+cleanup:
+    mbedtls_platform_zeroize( &A, sizeof( A ) );
+    return( ret );
+}
+
+/*
+ * R = k * P, using the base table if P is the generator
+ */
+static int p256_mul_any( const mbedtls_ecp_group *grp, p256_jac *R,
+                         const unsigned char k[34], const mbedtls_ecp_point *P,
+                         int (*f_rng)(void *, unsigned char *, size_t),
+                         void *p_rng )
+{
+    int ret;
+    p256_jac Q;
+
+    if( mbedtls_mpi_cmp_mpi( &P->Y, &grp->G.Y ) == 0 &&
+        mbedtls_mpi_cmp_mpi( &P->X, &grp->G.X ) == 0 )
+        return( p256_mul_base( R, k, f_rng, p_rng ) );
+
+    MBEDTLS_MPI_CHK( p256_from_mpi( Q.X, &P->X ) );
+    MBEDTLS_MPI_CHK( p256_from_mpi( Q.Y, &P->Y ) );
+    memcpy( Q.Z, p256_one, sizeof( p256_fe ) );
+
+    if( f_rng != NULL )
+        MBEDTLS_MPI_CHK( p256_randomize( &Q, f_rng, p_rng ) );
+
+    p256_mul_var( R, k, &Q );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Write the affine coordinates of P into R
+ */
+static int p256_normalize( mbedtls_ecp_point *R, const p256_jac *P )
+{
+    int ret;
+    p256_fe zi, zzi, t;
+
+    if( p256_is_zero( P->Z ) != 0 )
+        return( mbedtls_ecp_set_zero( R ) );
+
+    p256_inv( zi, P->Z );
+    p256_sqr( zzi, zi );
+    p256_mul( t, P->X, zzi );
+    MBEDTLS_MPI_CHK( p256_to_mpi( &R->X, t ) );
+    p256_mul( zzi, zzi, zi );
+    p256_mul( t, P->Y, zzi );
+    MBEDTLS_MPI_CHK( p256_to_mpi( &R->Y, t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
+
+cleanup:
+    return( ret );
+}
+
+int mbedtls_ecp_p256_mul( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                          const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                          int (*f_rng)(void *, unsigned char *, size_t),
+                          void *p_rng )
+{
+    int ret;
+    unsigned char k[34];
+    p256_jac S;
+
+    p256_check_cpu();
+
+    MBEDTLS_MPI_CHK( p256_scalar( k, m ) );
+    MBEDTLS_MPI_CHK( p256_mul_any( grp, &S, k, P, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( p256_normalize( R, &S ) );
+
+cleanup:
+    mbedtls_platform_zeroize( k, sizeof( k ) );
+    mbedtls_platform_zeroize( &S, sizeof( S ) );
+    return( ret );
+}
+
+int mbedtls_ecp_p256_muladd( const mbedtls_ecp_group *grp,
+                             mbedtls_ecp_point *R,
+                             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                             const mbedtls_mpi *n, const mbedtls_ecp_point *Q )
+{
+    int ret;
+    unsigned char k[34];
+    p256_jac S, T;
+
+    p256_check_cpu();
+
+    MBEDTLS_MPI_CHK( p256_scalar( k, m ) );
+    MBEDTLS_MPI_CHK( p256_mul_any( grp, &S, k, P, NULL, NULL ) );
+    MBEDTLS_MPI_CHK( p256_scalar( k, n ) );
+    MBEDTLS_MPI_CHK( p256_mul_any( grp, &T, k, Q, NULL, NULL ) );
+    p256_add_jac( &S, &S, &T, 1 );
+    MBEDTLS_MPI_CHK( p256_normalize( R, &S ) );
+
+cleanup:
+    return( ret );
+}
+
+#endif /* MBEDTLS_ECP_P256_C */
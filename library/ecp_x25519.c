@@ -0,0 +1,572 @@
+/*
+ *  Fixed-width arithmetic for Curve25519
+ *
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+/*
+ * References:
+ *
+ * RFC 7748 for the Montgomery ladder of X25519
+ * [Curve25519] http://cr.yp.to/ecdh/curve25519-20060209.pdf
+ *
+ * Field elements are five limbs of 51 bits, least significant first, on the
+ * stack. Limbs may grow a few bits past 51 between operations; they are
+ * only fully reduced when written out.
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_X25519_C)
+
+#include "mbedtls/ecp_x25519.h"
+#include "mbedtls/platform_util.h"
+
+#include <string.h>
+
+#if defined(_MSC_VER) || defined(__WATCOMC__)
+  #define UL64(x) x##ui64
+#else
+  #define UL64(x) x##ULL
+#endif
+
+#if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
+    !defined(inline) && !defined(__cplusplus)
+#define inline __inline
+#endif
+
+#define X25519_MASK51   ( ( UL64(1) << 51 ) - 1 )
+
+typedef uint64_t x25519_fe[5];
+
+/*
+ * 128-bit accumulators for the products of limbs
+ */
+#if defined(MBEDTLS_HAVE_INT64) && defined(MBEDTLS_HAVE_UDBL)
+typedef mbedtls_t_udbl x25519_u128;
+
+static inline x25519_u128 x25519_mul64( uint64_t a, uint64_t b )
+{
+    return( (x25519_u128) a * b );
+}
+
+static inline x25519_u128 x25519_add128( x25519_u128 a, x25519_u128 b )
+{
+    return( a + b );
+}
+
+static inline uint64_t x25519_lo51( x25519_u128 a )
+{
+    return( (uint64_t) a & X25519_MASK51 );
+}
+
+static inline x25519_u128 x25519_shr51( x25519_u128 a )
+{
+    return( a >> 51 );
+}
+
+static inline x25519_u128 x25519_from64( uint64_t a )
+{
+    return( a );
+}
+
+static inline uint64_t x25519_to64( x25519_u128 a )
+{
+    return( (uint64_t) a );
+}
+#else
+typedef struct
+{
+    uint64_t lo, hi;
+}
+x25519_u128;
+
+static inline x25519_u128 x25519_mul64( uint64_t a, uint64_t b )
+{
+    x25519_u128 r;
+    uint64_t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = ( p00 >> 32 ) + ( p01 & 0xFFFFFFFF ) + ( p10 & 0xFFFFFFFF );
+
+    r.lo = ( mid << 32 ) | ( p00 & 0xFFFFFFFF );
+    r.hi = p11 + ( p01 >> 32 ) + ( p10 >> 32 ) + ( mid >> 32 );
+    return( r );
+}
+
+static inline x25519_u128 x25519_add128( x25519_u128 a, x25519_u128 b )
+{
+    x25519_u128 r;
+
+    r.lo = a.lo + b.lo;
+    r.hi = a.hi + b.hi + ( r.lo < a.lo );
+    return( r );
+}
+
+static inline uint64_t x25519_lo51( x25519_u128 a )
+{
+    return( a.lo & X25519_MASK51 );
+}
+
+static inline x25519_u128 x25519_shr51( x25519_u128 a )
+{
+    x25519_u128 r;
+
+    r.lo = ( a.lo >> 51 ) | ( a.hi << 13 );
+    r.hi = a.hi >> 51;
+    return( r );
+}
+
+static inline x25519_u128 x25519_from64( uint64_t a )
+{
+    x25519_u128 r;
+
+    r.lo = a;
+    r.hi = 0;
+    return( r );
+}
+
+static inline uint64_t x25519_to64( x25519_u128 a )
+{
+    return( a.lo );
+}
+#endif /* MBEDTLS_HAVE_INT64 && MBEDTLS_HAVE_UDBL */
+
+/*
+ * Propagate the carries so that every limb is below 2^51 + 2^13
+ */
+static void x25519_carry( x25519_fe r )
+{
+    uint64_t c;
+    int i;
+
+    for( i = 0; i < 4; i++ )
+    {
+        c = r[i] >> 51;
+        r[i] &= X25519_MASK51;
+        r[i + 1] += c;
+    }
+    c = r[4] >> 51;
+    r[4] &= X25519_MASK51;
+    r[0] += 19 * c;
+}
+
+static void x25519_add( x25519_fe r, const x25519_fe a, const x25519_fe b )
+{
+    int i;
+
+    for( i = 0; i < 5; i++ )
+        r[i] = a[i] + b[i];
+    x25519_carry( r );
+}
+
+/*
+ * r = a - b, computed as a + 4p - b so that no limb goes negative
+ */
+static void x25519_sub( x25519_fe r, const x25519_fe a, const x25519_fe b )
+{
+    r[0] = a[0] + UL64(0x1FFFFFFFFFFFB4) - b[0];
+    r[1] = a[1] + UL64(0x1FFFFFFFFFFFFC) - b[1];
+    r[2] = a[2] + UL64(0x1FFFFFFFFFFFFC) - b[2];
+    r[3] = a[3] + UL64(0x1FFFFFFFFFFFFC) - b[3];
+    r[4] = a[4] + UL64(0x1FFFFFFFFFFFFC) - b[4];
+    x25519_carry( r );
+}
+
+/*
+ * Reduce the five 128-bit column sums of a product into r
+ */
+static void x25519_reduce( x25519_fe r, x25519_u128 t[5] )
+{
+    uint64_t c;
+    int i;
+
+    for( i = 0; i < 4; i++ )
+    {
+        r[i] = x25519_lo51( t[i] );
+        t[i + 1] = x25519_add128( t[i + 1], x25519_shr51( t[i] ) );
+    }
+    r[4] = x25519_lo51( t[4] );
+    c = x25519_to64( x25519_shr51( t[4] ) );
+
+    r[0] += 19 * c;
+    r[1] += r[0] >> 51;
+    r[0] &= X25519_MASK51;
+}
+
+static void x25519_mul( x25519_fe r, const x25519_fe a, const x25519_fe b )
+{
+    x25519_u128 t[5];
+    uint64_t b1 = 19 * b[1], b2 = 19 * b[2], b3 = 19 * b[3], b4 = 19 * b[4];
+
+#define X25519_MAC( acc, x, y ) acc = x25519_add128( acc, x25519_mul64( x, y ) )
+    t[0] = x25519_mul64( a[0], b[0] );
+    X25519_MAC( t[0], a[1], b4 );
+    X25519_MAC( t[0], a[2], b3 );
+    X25519_MAC( t[0], a[3], b2 );
+    X25519_MAC( t[0], a[4], b1 );
+
+    t[1] = x25519_mul64( a[0], b[1] );
+    X25519_MAC( t[1], a[1], b[0] );
+    X25519_MAC( t[1], a[2], b4 );
+    X25519_MAC( t[1], a[3], b3 );
+    X25519_MAC( t[1], a[4], b2 );
+
+    t[2] = x25519_mul64( a[0], b[2] );
+    X25519_MAC( t[2], a[1], b[1] );
+    X25519_MAC( t[2], a[2], b[0] );
+    X25519_MAC( t[2], a[3], b4 );
+    X25519_MAC( t[2], a[4], b3 );
+
+    t[3] = x25519_mul64( a[0], b[3] );
+    X25519_MAC( t[3], a[1], b[2] );
+    X25519_MAC( t[3], a[2], b[1] );
+    X25519_MAC( t[3], a[3], b[0] );
+    X25519_MAC( t[3], a[4], b4 );
+
+    t[4] = x25519_mul64( a[0], b[4] );
+    X25519_MAC( t[4], a[1], b[3] );
+    X25519_MAC( t[4], a[2], b[2] );
+    X25519_MAC( t[4], a[3], b[1] );
+    X25519_MAC( t[4], a[4], b[0] );
+
+    x25519_reduce( r, t );
+}
+
+/*
+ * Squaring, with the symmetric products counted once
+ */
+static void x25519_sqr( x25519_fe r, const x25519_fe a )
+{
+    x25519_u128 t[5];
+    uint64_t a0_2 = 2 * a[0], a1_2 = 2 * a[1];
+    uint64_t a3_19 = 19 * a[3], a4_19 = 19 * a[4];
+
+    t[0] = x25519_mul64( a[0], a[0] );
+    X25519_MAC( t[0], a1_2, a4_19 );
+    X25519_MAC( t[0], 2 * a[2], a3_19 );
+
+    t[1] = x25519_mul64( a0_2, a[1] );
+    X25519_MAC( t[1], 2 * a[2], a4_19 );
+    X25519_MAC( t[1], a[3], a3_19 );
+
+    t[2] = x25519_mul64( a0_2, a[2] );
+    X25519_MAC( t[2], a[1], a[1] );
+    X25519_MAC( t[2], 2 * a[3], a4_19 );
+
+    t[3] = x25519_mul64( a0_2, a[3] );
+    X25519_MAC( t[3], a1_2, a[2] );
+    X25519_MAC( t[3], a[4], a4_19 );
+
+    t[4] = x25519_mul64( a0_2, a[4] );
+    X25519_MAC( t[4], a1_2, a[3] );
+    X25519_MAC( t[4], a[2], a[2] );
+#undef X25519_MAC
+
+    x25519_reduce( r, t );
+}
+
+static void x25519_sqr_n( x25519_fe r, const x25519_fe a, int n )
+{
+    x25519_sqr( r, a );
+    while( --n > 0 )
+        x25519_sqr( r, r );
+}
+
+/*
+ * r = a * 121665, (A - 2) / 4 for Curve25519
+ */
+static void x25519_mul_a24( x25519_fe r, const x25519_fe a )
+{
+    x25519_u128 t[5];
+    int i;
+
+    for( i = 0; i < 5; i++ )
+        t[i] = x25519_mul64( a[i], 121665 );
+    x25519_reduce( r, t );
+}
+
+/*
+ * r = a^(p-2) = a^-1 (0 if a == 0), p - 2 = 2^255 - 21
+ */
+static void x25519_inv( x25519_fe r, const x25519_fe a )
+{
+    x25519_fe z2, z9, z11, z2_5_0, z2_10_0, z2_20_0, z2_50_0, z2_100_0, t;
+
+    x25519_sqr( z2, a );
+    x25519_sqr_n( t, z2, 2 );
+    x25519_mul( z9, t, a );
+    x25519_mul( z11, z9, z2 );
+    x25519_sqr( t, z11 );
+    x25519_mul( z2_5_0, t, z9 );
+    x25519_sqr_n( t, z2_5_0, 5 );
+    x25519_mul( z2_10_0, t, z2_5_0 );
+    x25519_sqr_n( t, z2_10_0, 10 );
+    x25519_mul( z2_20_0, t, z2_10_0 );
+    x25519_sqr_n( t, z2_20_0, 20 );
+    x25519_mul( t, t, z2_20_0 );
+    x25519_sqr_n( t, t, 10 );
+    x25519_mul( z2_50_0, t, z2_10_0 );
+    x25519_sqr_n( t, z2_50_0, 50 );
+    x25519_mul( z2_100_0, t, z2_50_0 );
+    x25519_sqr_n( t, z2_100_0, 100 );
+    x25519_mul( t, t, z2_100_0 );
+    x25519_sqr_n( t, t, 50 );
+    x25519_mul( t, t, z2_50_0 );
+    x25519_sqr_n( t, t, 5 );
+    x25519_mul( r, t, z11 );
+}
+
+/*
+ * Swap a and b if swap is 1, in constant time
+ */
+static void x25519_cswap( x25519_fe a, x25519_fe b, uint64_t swap )
+{
+    uint64_t mask = 0 - swap, t;
+    int i;
+
+    for( i = 0; i < 5; i++ )
+    {
+        t = mask & ( a[i] ^ b[i] );
+        a[i] ^= t;
+        b[i] ^= t;
+    }
+}
+
+/*
+ * Read 32 little-endian bytes, bit 255 included (2^255 = 19 mod p)
+ */
+static void x25519_from_bytes( x25519_fe r, const unsigned char buf[32] )
+{
+    uint64_t w[4];
+    int i, j;
+
+    for( i = 0; i < 4; i++ )
+    {
+        w[i] = 0;
+        for( j = 0; j < 8; j++ )
+            w[i] |= (uint64_t) buf[8 * i + j] << ( 8 * j );
+    }
+
+    r[0] = w[0] & X25519_MASK51;
+    r[1] = ( ( w[0] >> 51 ) | ( w[1] << 13 ) ) & X25519_MASK51;
+    r[2] = ( ( w[1] >> 38 ) | ( w[2] << 26 ) ) & X25519_MASK51;
+    r[3] = ( ( w[2] >> 25 ) | ( w[3] << 39 ) ) & X25519_MASK51;
+    r[4] = ( w[3] >> 12 ) & X25519_MASK51;
+    r[0] += 19 * ( w[3] >> 63 );
+}
+
+/*
+ * Write the fully reduced value of a as 32 little-endian bytes
+ */
+static void x25519_to_bytes( unsigned char buf[32], const x25519_fe a )
+{
+    x25519_fe t;
+    uint64_t q, w[4];
+    int i, j;
+
+    memcpy( t, a, sizeof( t ) );
+    x25519_carry( t );
+    x25519_carry( t );
+
+    /* q = 1 if t >= p, that is if t + 19 >= 2^255 */
+    q = ( t[0] + 19 ) >> 51;
+    q = ( t[1] + q ) >> 51;
+    q = ( t[2] + q ) >> 51;
+    q = ( t[3] + q ) >> 51;
+    q = ( t[4] + q ) >> 51;
+
+    t[0] += 19 * q;
+    for( i = 0; i < 4; i++ )
+    {
+        t[i + 1] += t[i] >> 51;
+        t[i] &= X25519_MASK51;
+    }
+    t[4] &= X25519_MASK51;
+
+    w[0] = t[0] | ( t[1] << 51 );
+    w[1] = ( t[1] >> 13 ) | ( t[2] << 38 );
+    w[2] = ( t[2] >> 26 ) | ( t[3] << 25 );
+    w[3] = ( t[3] >> 39 ) | ( t[4] << 12 );
+
+    for( i = 0; i < 4; i++ )
+        for( j = 0; j < 8; j++ )
+            buf[8 * i + j] = (unsigned char)( w[i] >> ( 8 * j ) );
+}
+
+/*
+ * Little-endian bytes of an mpi of at most 32 bytes
+ */
+static int x25519_mpi_to_bytes( unsigned char buf[32], const mbedtls_mpi *X )
+{
+    int ret;
+    unsigned char be[32];
+    size_t i;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( X, be, sizeof( be ) ) );
+    for( i = 0; i < 32; i++ )
+        buf[i] = be[31 - i];
+
+cleanup:
+    mbedtls_platform_zeroize( be, sizeof( be ) );
+    return( ret );
+}
+
+static int x25519_bytes_to_mpi( mbedtls_mpi *X, const unsigned char buf[32] )
+{
+    unsigned char be[32];
+    size_t i;
+
+    for( i = 0; i < 32; i++ )
+        be[i] = buf[31 - i];
+
+    return( mbedtls_mpi_read_binary( X, be, sizeof( be ) ) );
+}
+
+/*
+ * Random l with 1 < l < p, as in ecp_randomize_mxz()
+ */
+static int x25519_random( x25519_fe l,
+                          int (*f_rng)(void *, unsigned char *, size_t),
+                          void *p_rng )
+{
+    int ret, count = 0;
+    unsigned char buf[32];
+    int i, small, large;
+
+    do
+    {
+        if( ++count > 10 )
+            return( MBEDTLS_ERR_ECP_RANDOM_FAILED );
+
+        if( ( ret = f_rng( p_rng, buf, sizeof( buf ) ) ) != 0 )
+            return( ret );
+        buf[31] &= 0x7F;
+
+        /* reject l <= 1 and l >= p = 2^255 - 19 (all ones but the last) */
+        small = buf[0] <= 1;
+        large = buf[0] >= 0xED && buf[31] == 0x7F;
+        for( i = 1; i < 31; i++ )
+        {
+            small &= buf[i] == 0x00;
+            large &= buf[i] == 0xFF;
+        }
+        small &= buf[31] == 0x00;
+    }
+    while( small || large );
+
+    x25519_from_bytes( l, buf );
+    mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    return( 0 );
+}
+
+int mbedtls_ecp_x25519_mul( mbedtls_ecp_point *R, const mbedtls_mpi *m,
+                            const mbedtls_ecp_point *P,
+                            int (*f_rng)(void *, unsigned char *, size_t),
+                            void *p_rng )
+{
+    int ret;
+    unsigned char k[32], buf[32];
+    x25519_fe x1, x2, z2, x3, z3, a, aa, b, bb, e, c, d, da, cb;
+    uint64_t bit, swap = 0;
+    int i;
+
+    MBEDTLS_MPI_CHK( x25519_mpi_to_bytes( k, m ) );
+    MBEDTLS_MPI_CHK( x25519_mpi_to_bytes( buf, &P->X ) );
+    x25519_from_bytes( x1, buf );
+
+    /* R = infinity (1 : 0), RP = P (x1 : 1), randomized if possible */
+    memset( x2, 0, sizeof( x2 ) );
+    memset( z2, 0, sizeof( z2 ) );
+    memset( z3, 0, sizeof( z3 ) );
+    x2[0] = 1;
+    z3[0] = 1;
+    memcpy( x3, x1, sizeof( x3 ) );
+
+    if( f_rng != NULL )
+    {
+        MBEDTLS_MPI_CHK( x25519_random( z3, f_rng, p_rng ) );
+        x25519_mul( x3, x1, z3 );
+    }
+
+    /* The key has bit 254 set and bit 255 clear, see RFC 7748 */
+    for( i = 254; i >= 0; i-- )
+    {
+        bit = ( k[i / 8] >> ( i % 8 ) ) & 1;
+        swap ^= bit;
+        x25519_cswap( x2, x3, swap );
+        x25519_cswap( z2, z3, swap );
+        swap = bit;
+
+        x25519_add( a, x2, z2 );
+        x25519_sqr( aa, a );
+        x25519_sub( b, x2, z2 );
+        x25519_sqr( bb, b );
+        x25519_sub( e, aa, bb );
+        x25519_add( c, x3, z3 );
+        x25519_sub( d, x3, z3 );
+        x25519_mul( da, d, a );
+        x25519_mul( cb, c, b );
+
+        x25519_add( x3, da, cb );
+        x25519_sqr( x3, x3 );
+        x25519_sub( z3, da, cb );
+        x25519_sqr( z3, z3 );
+        x25519_mul( z3, z3, x1 );
+
+        x25519_mul( x2, aa, bb );
+        x25519_mul_a24( z2, e );
+        x25519_add( z2, z2, aa );
+        x25519_mul( z2, z2, e );
+    }
+    x25519_cswap( x2, x3, swap );
+    x25519_cswap( z2, z3, swap );
+
+    /* As the generic code, fail on the point at infinity */
+    x25519_to_bytes( buf, z2 );
+    for( i = 0, bit = 0; i < 32; i++ )
+        bit |= buf[i];
+    if( bit == 0 )
+    {
+        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
+        goto cleanup;
+    }
+
+    x25519_inv( z2, z2 );
+    x25519_mul( x2, x2, z2 );
+    x25519_to_bytes( buf, x2 );
+
+    MBEDTLS_MPI_CHK( x25519_bytes_to_mpi( &R->X, buf ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
+    mbedtls_mpi_free( &R->Y );
+
+cleanup:
+    mbedtls_platform_zeroize( k, sizeof( k ) );
+    mbedtls_platform_zeroize( x2, sizeof( x2 ) );
+    mbedtls_platform_zeroize( z2, sizeof( z2 ) );
+    mbedtls_platform_zeroize( x3, sizeof( x3 ) );
+    mbedtls_platform_zeroize( z3, sizeof( z3 ) );
+
+    return( ret );
+}
+
+#endif /* MBEDTLS_ECP_X25519_C */
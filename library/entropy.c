@@ -39,6 +39,10 @@
 
 #include <string.h>
 
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+#include <stdint.h>
+#endif
+
 #if defined(MBEDTLS_FS_IO)
 #include <stdio.h>
 #endif
@@ -62,8 +66,84 @@
 
 #define ENTROPY_MAX_LOOP    256     /**< Maximum amount to loop before error */
 
+#if defined(MBEDTLS_ENTROPY_SHARDS) && defined(MBEDTLS_THREADING_PTHREAD)
+/* States of the background gathering thread */
+#define ENTROPY_GATHER_IDLE     0
+#define ENTROPY_GATHER_RUNNING  1
+#define ENTROPY_GATHER_STOPPING 2
+#endif
+
+#if defined(MBEDTLS_ENTROPY_SHA512_ACCUMULATOR)
+typedef mbedtls_sha512_context entropy_accumulator;
+#else
+typedef mbedtls_sha256_context entropy_accumulator;
+#endif
+
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+static void entropy_shard_init( mbedtls_entropy_shard *shard )
+{
+    memset( shard, 0, sizeof( mbedtls_entropy_shard ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_init( &shard->mutex );
+#endif
+#if defined(MBEDTLS_ENTROPY_SHA512_ACCUMULATOR)
+    mbedtls_sha512_init( &shard->accumulator );
+#else
+    mbedtls_sha256_init( &shard->accumulator );
+#endif
+}
+
+static void entropy_shard_free( mbedtls_entropy_shard *shard )
+{
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &shard->mutex );
+#endif
+#if defined(MBEDTLS_ENTROPY_SHA512_ACCUMULATOR)
+    mbedtls_sha512_free( &shard->accumulator );
+#else
+    mbedtls_sha256_free( &shard->accumulator );
+#endif
+    mbedtls_platform_zeroize( shard, sizeof( mbedtls_entropy_shard ) );
+}
+
+/*
+ * Pick the shard of the calling thread. With pthreads, this is a hash of
+ * the thread ID, so a given thread always uses the same shard. Otherwise
+ * there is no portable thread ID, and the address of the stack is used:
+ * threads have distinct stacks, so they tend to use different shards, but
+ * a thread may change shards as its stack grows. Either is fine, since any
+ * shard can serve any thread; this only spreads the lock contention.
+ */
+static mbedtls_entropy_shard *entropy_shard( mbedtls_entropy_context *ctx )
+{
+    uint32_t h = 0;
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    pthread_t self = pthread_self();
+    const unsigned char *p = (const unsigned char *) &self;
+    size_t i;
+
+    for( i = 0; i < sizeof( self ); i++ )
+        h = ( h ^ p[i] ) * 0x01000193;
+#else
+    unsigned char anchor;
+
+    h = (uint32_t) ( (uintptr_t) &anchor >> 16 );
+#endif
+
+    h *= 0x9E3779B1;
+    h ^= h >> 16;
+
+    return( &ctx->shard[h % MBEDTLS_ENTROPY_SHARDS] );
+}
+#endif /* MBEDTLS_ENTROPY_SHARDS */
+
 void mbedtls_entropy_init( mbedtls_entropy_context *ctx )
 {
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+    int i;
+#endif
+
     ctx->source_count = 0;
     memset( ctx->source, 0, sizeof( ctx->source ) );
 
@@ -79,6 +159,15 @@ void mbedtls_entropy_init( mbedtls_entropy_context *ctx )
 #endif
 #if defined(MBEDTLS_HAVEGE_C)
     mbedtls_havege_init( &ctx->havege_data );
+#endif
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+    for( i = 0; i < MBEDTLS_ENTROPY_SHARDS; i++ )
+        entropy_shard_init( &ctx->shard[i] );
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    pthread_mutex_init( &ctx->gather_mutex, NULL );
+    pthread_cond_init( &ctx->gather_cond, NULL );
+    ctx->gather_state = ENTROPY_GATHER_IDLE;
+#endif
 #endif
 
     /* Reminder: Update ENTROPY_HAVE_STRONG in the test files
@@ -121,6 +210,17 @@ void mbedtls_entropy_init( mbedtls_entropy_context *ctx )
 
 void mbedtls_entropy_free( mbedtls_entropy_context *ctx )
 {
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+    int i;
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    mbedtls_entropy_gather_thread_stop( ctx );
+    pthread_cond_destroy( &ctx->gather_cond );
+    pthread_mutex_destroy( &ctx->gather_mutex );
+#endif
+    for( i = 0; i < MBEDTLS_ENTROPY_SHARDS; i++ )
+        entropy_shard_free( &ctx->shard[i] );
+#endif
 #if defined(MBEDTLS_HAVEGE_C)
     mbedtls_havege_free( &ctx->havege_data );
 #endif
@@ -177,8 +277,9 @@ exit:
 /*
  * Entropy accumulator update
  */
-static int entropy_update( mbedtls_entropy_context *ctx, unsigned char source_id,
-                           const unsigned char *data, size_t len )
+static int entropy_accumulate( int *started, entropy_accumulator *accumulator,
+                               unsigned char source_id,
+                               const unsigned char *data, size_t len )
 {
     unsigned char header[2];
     unsigned char tmp[MBEDTLS_ENTROPY_BLOCK_SIZE];
@@ -208,23 +309,23 @@ static int entropy_update( mbedtls_entropy_context *ctx, unsigned char source_id
      * gather entropy eventually execute this code.
      */
 #if defined(MBEDTLS_ENTROPY_SHA512_ACCUMULATOR)
-    if( ctx->accumulator_started == 0 &&
-        ( ret = mbedtls_sha512_starts_ret( &ctx->accumulator, 0 ) ) != 0 )
+    if( *started == 0 &&
+        ( ret = mbedtls_sha512_starts_ret( accumulator, 0 ) ) != 0 )
         goto cleanup;
     else
-        ctx->accumulator_started = 1;
-    if( ( ret = mbedtls_sha512_update_ret( &ctx->accumulator, header, 2 ) ) != 0 )
+        *started = 1;
+    if( ( ret = mbedtls_sha512_update_ret( accumulator, header, 2 ) ) != 0 )
         goto cleanup;
-    ret = mbedtls_sha512_update_ret( &ctx->accumulator, p, use_len );
+    ret = mbedtls_sha512_update_ret( accumulator, p, use_len );
 #else
-    if( ctx->accumulator_started == 0 &&
-        ( ret = mbedtls_sha256_starts_ret( &ctx->accumulator, 0 ) ) != 0 )
+    if( *started == 0 &&
+        ( ret = mbedtls_sha256_starts_ret( accumulator, 0 ) ) != 0 )
         goto cleanup;
     else
-        ctx->accumulator_started = 1;
-    if( ( ret = mbedtls_sha256_update_ret( &ctx->accumulator, header, 2 ) ) != 0 )
+        *started = 1;
+    if( ( ret = mbedtls_sha256_update_ret( accumulator, header, 2 ) ) != 0 )
         goto cleanup;
-    ret = mbedtls_sha256_update_ret( &ctx->accumulator, p, use_len );
+    ret = mbedtls_sha256_update_ret( accumulator, p, use_len );
 #endif
 
 cleanup:
@@ -233,11 +334,47 @@ cleanup:
     return( ret );
 }
 
+#if !defined(MBEDTLS_ENTROPY_SHARDS)
+static int entropy_update( mbedtls_entropy_context *ctx, unsigned char source_id,
+                           const unsigned char *data, size_t len )
+{
+    return( entropy_accumulate( &ctx->accumulator_started, &ctx->accumulator,
+                                source_id, data, len ) );
+}
+#endif
+
 int mbedtls_entropy_update_manual( mbedtls_entropy_context *ctx,
                            const unsigned char *data, size_t len )
 {
     int ret;
 
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+    int i;
+
+    for( i = 0; i < MBEDTLS_ENTROPY_SHARDS; i++ )
+    {
+        mbedtls_entropy_shard *shard = &ctx->shard[i];
+
+#if defined(MBEDTLS_THREADING_C)
+        if( ( ret = mbedtls_mutex_lock( &shard->mutex ) ) != 0 )
+            return( ret );
+#endif
+
+        ret = entropy_accumulate( &shard->accumulator_started,
+                                  &shard->accumulator,
+                                  MBEDTLS_ENTROPY_SOURCE_MANUAL, data, len );
+
+#if defined(MBEDTLS_THREADING_C)
+        if( mbedtls_mutex_unlock( &shard->mutex ) != 0 )
+            return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+#endif
+
+        if( ret != 0 )
+            return( ret );
+    }
+
+    return( 0 );
+#else /* MBEDTLS_ENTROPY_SHARDS */
 #if defined(MBEDTLS_THREADING_C)
     if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
         return( ret );
@@ -251,12 +388,54 @@ int mbedtls_entropy_update_manual( mbedtls_entropy_context *ctx,
 #endif
 
     return( ret );
+#endif /* MBEDTLS_ENTROPY_SHARDS */
 }
 
+#if defined(MBEDTLS_ENTROPY_SHARDS) && defined(MBEDTLS_THREADING_C) && \
+    defined(MBEDTLS_ENTROPY_NV_SEED)
+#define ENTROPY_LOCK_NV_SEED
+#endif
+
 /*
- * Run through the different sources to add entropy to our accumulator
+ * Poll source i. Shards poll the sources concurrently, so the NV seed,
+ * which is shared and not thread-safe, is polled under ctx->mutex; shard
+ * locks are always taken before ctx->mutex.
  */
-static int entropy_gather_internal( mbedtls_entropy_context *ctx )
+static int entropy_poll( mbedtls_entropy_context *ctx, int i,
+                         unsigned char *buf, size_t *olen )
+{
+    int ret;
+
+#if defined(ENTROPY_LOCK_NV_SEED)
+    if( ctx->source[i].f_source == mbedtls_nv_seed_poll )
+    {
+        if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
+            return( ret );
+
+        ret = mbedtls_nv_seed_poll( ctx->source[i].p_source,
+                                    buf, MBEDTLS_ENTROPY_MAX_GATHER, olen );
+
+        if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
+            return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+        return( ret );
+    }
+#endif
+
+    ret = ctx->source[i].f_source( ctx->source[i].p_source,
+                                   buf, MBEDTLS_ENTROPY_MAX_GATHER, olen );
+
+    return( ret );
+}
+
+/*
+ * Run through the different sources to add entropy to an accumulator.
+ * The amount received from each source is added to size[] if given,
+ * or to the source state otherwise.
+ */
+static int entropy_gather_into( mbedtls_entropy_context *ctx, int *started,
+                                entropy_accumulator *accumulator,
+                                size_t *size )
 {
     int ret, i, have_one_strong = 0;
     unsigned char buf[MBEDTLS_ENTROPY_MAX_GATHER];
@@ -274,8 +453,7 @@ static int entropy_gather_internal( mbedtls_entropy_context *ctx )
             have_one_strong = 1;
 
         olen = 0;
-        if( ( ret = ctx->source[i].f_source( ctx->source[i].p_source,
-                        buf, MBEDTLS_ENTROPY_MAX_GATHER, &olen ) ) != 0 )
+        if( ( ret = entropy_poll( ctx, i, buf, &olen ) ) != 0 )
         {
             goto cleanup;
         }
@@ -285,10 +463,15 @@ static int entropy_gather_internal( mbedtls_entropy_context *ctx )
          */
         if( olen > 0 )
         {
-            if( ( ret = entropy_update( ctx, (unsigned char) i,
-                                        buf, olen ) ) != 0 )
+            if( ( ret = entropy_accumulate( started, accumulator,
+                                            (unsigned char) i,
+                                            buf, olen ) ) != 0 )
                 return( ret );
-            ctx->source[i].size += olen;
+
+            if( size != NULL )
+                size[i] += olen;
+            else
+                ctx->source[i].size += olen;
         }
     }
 
@@ -301,12 +484,67 @@ cleanup:
     return( ret );
 }
 
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+static int entropy_gather_shard( mbedtls_entropy_context *ctx,
+                                 mbedtls_entropy_shard *shard )
+{
+    int ret;
+
+    ret = entropy_gather_into( ctx, &shard->accumulator_started,
+                               &shard->accumulator, shard->size );
+    if( ret == 0 )
+        shard->gathered = 1;
+
+    return( ret );
+}
+
+/*
+ * Check whether a shard has been polled, and has received the threshold
+ * amount from every source, since it last released entropy
+ */
+static int entropy_shard_ready( const mbedtls_entropy_context *ctx,
+                                const mbedtls_entropy_shard *shard )
+{
+    int i;
+
+    if( shard->gathered == 0 )
+        return( 0 );
+
+    for( i = 0; i < ctx->source_count; i++ )
+        if( shard->size[i] < ctx->source[i].threshold )
+            return( 0 );
+
+    return( 1 );
+}
+#else /* MBEDTLS_ENTROPY_SHARDS */
+static int entropy_gather_internal( mbedtls_entropy_context *ctx )
+{
+    return( entropy_gather_into( ctx, &ctx->accumulator_started,
+                                 &ctx->accumulator, NULL ) );
+}
+#endif /* MBEDTLS_ENTROPY_SHARDS */
+
 /*
  * Thread-safe wrapper for entropy_gather_internal()
  */
 int mbedtls_entropy_gather( mbedtls_entropy_context *ctx )
 {
     int ret;
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+    mbedtls_entropy_shard *shard = entropy_shard( ctx );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ( ret = mbedtls_mutex_lock( &shard->mutex ) ) != 0 )
+        return( ret );
+#endif
+
+    ret = entropy_gather_shard( ctx, shard );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &shard->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+#endif
+#else /* MBEDTLS_ENTROPY_SHARDS */
 
 #if defined(MBEDTLS_THREADING_C)
     if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
@@ -319,15 +557,139 @@ int mbedtls_entropy_gather( mbedtls_entropy_context *ctx )
     if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
         return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
 #endif
+#endif /* MBEDTLS_ENTROPY_SHARDS */
+
+    return( ret );
+}
+
+/*
+ * Finish the accumulator into buf, restart it with that value so that the
+ * existing entropy is recycled, and hash buf once more for output
+ */
+static int entropy_release( entropy_accumulator *accumulator,
+                            unsigned char *buf )
+{
+    int ret;
+
+#if defined(MBEDTLS_ENTROPY_SHA512_ACCUMULATOR)
+    /*
+     * Note that at this stage it is assumed that the accumulator was started
+     * in a previous call to entropy_update(). If this is not guaranteed, the
+     * code below will fail.
+     */
+    if( ( ret = mbedtls_sha512_finish_ret( accumulator, buf ) ) != 0 )
+        return( ret );
+
+    /*
+     * Reset accumulator and recycle existing entropy
+     */
+    mbedtls_sha512_free( accumulator );
+    mbedtls_sha512_init( accumulator );
+    if( ( ret = mbedtls_sha512_starts_ret( accumulator, 0 ) ) != 0 )
+        return( ret );
+    if( ( ret = mbedtls_sha512_update_ret( accumulator, buf,
+                                           MBEDTLS_ENTROPY_BLOCK_SIZE ) ) != 0 )
+        return( ret );
+
+    /*
+     * Perform second SHA-512 on entropy
+     */
+    if( ( ret = mbedtls_sha512_ret( buf, MBEDTLS_ENTROPY_BLOCK_SIZE,
+                                    buf, 0 ) ) != 0 )
+        return( ret );
+#else /* MBEDTLS_ENTROPY_SHA512_ACCUMULATOR */
+    if( ( ret = mbedtls_sha256_finish_ret( accumulator, buf ) ) != 0 )
+        return( ret );
+
+    /*
+     * Reset accumulator and recycle existing entropy
+     */
+    mbedtls_sha256_free( accumulator );
+    mbedtls_sha256_init( accumulator );
+    if( ( ret = mbedtls_sha256_starts_ret( accumulator, 0 ) ) != 0 )
+        return( ret );
+    if( ( ret = mbedtls_sha256_update_ret( accumulator, buf,
+                                           MBEDTLS_ENTROPY_BLOCK_SIZE ) ) != 0 )
+        return( ret );
+
+    /*
+     * Perform second SHA-256 on entropy
+     */
+    if( ( ret = mbedtls_sha256_ret( buf, MBEDTLS_ENTROPY_BLOCK_SIZE,
+                                    buf, 0 ) ) != 0 )
+        return( ret );
+#endif /* MBEDTLS_ENTROPY_SHA512_ACCUMULATOR */
+
+    return( 0 );
+}
+
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+/*
+ * Release entropy from the calling thread's shard, with the same polling
+ * as the unsharded accumulator
+ */
+static int entropy_func_shard( mbedtls_entropy_context *ctx,
+                               unsigned char *output, size_t len )
+{
+    int ret, count = 0, i;
+    mbedtls_entropy_shard *shard = entropy_shard( ctx );
+    unsigned char buf[MBEDTLS_ENTROPY_BLOCK_SIZE];
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ( ret = mbedtls_mutex_lock( &shard->mutex ) ) != 0 )
+        return( ret );
+#endif
+
+    /*
+     * Always gather extra entropy before a call
+     */
+    do
+    {
+        if( count++ > ENTROPY_MAX_LOOP )
+        {
+            ret = MBEDTLS_ERR_ENTROPY_SOURCE_FAILED;
+            goto exit;
+        }
+
+        if( ( ret = entropy_gather_shard( ctx, shard ) ) != 0 )
+            goto exit;
+    }
+    while( ! entropy_shard_ready( ctx, shard ) );
+
+    memset( buf, 0, MBEDTLS_ENTROPY_BLOCK_SIZE );
+
+    if( ( ret = entropy_release( &shard->accumulator, buf ) ) != 0 )
+        goto exit;
+
+    for( i = 0; i < ctx->source_count; i++ )
+        shard->size[i] = 0;
+    shard->gathered = 0;
+
+    memcpy( output, buf, len );
+
+exit:
+    mbedtls_platform_zeroize( buf, sizeof( buf ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &shard->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+#endif
 
     return( ret );
 }
+#endif /* MBEDTLS_ENTROPY_SHARDS */
 
 int mbedtls_entropy_func( void *data, unsigned char *output, size_t len )
 {
-    int ret, count = 0, i, done;
+    int ret;
     mbedtls_entropy_context *ctx = (mbedtls_entropy_context *) data;
+#if !defined(MBEDTLS_ENTROPY_SHARDS)
+    int count = 0, i, done;
     unsigned char buf[MBEDTLS_ENTROPY_BLOCK_SIZE];
+#endif
+#if defined(ENTROPY_LOCK_NV_SEED)
+    int first_run;
+#endif
 
     if( len > MBEDTLS_ENTROPY_BLOCK_SIZE )
         return( MBEDTLS_ERR_ENTROPY_SOURCE_FAILED );
@@ -336,6 +698,23 @@ int mbedtls_entropy_func( void *data, unsigned char *output, size_t len )
     /* Update the NV entropy seed before generating any entropy for outside
      * use.
      */
+#if defined(ENTROPY_LOCK_NV_SEED)
+    /* Only the first caller updates it; the others do not wait for it */
+    if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
+        return( ret );
+
+    first_run = ( ctx->initial_entropy_run == 0 );
+    ctx->initial_entropy_run = 1;
+
+    if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+    if( first_run )
+    {
+        if( ( ret = mbedtls_entropy_update_nv_seed( ctx ) ) != 0 )
+            return( ret );
+    }
+#else
     if( ctx->initial_entropy_run == 0 )
     {
         ctx->initial_entropy_run = 1;
@@ -343,6 +722,13 @@ int mbedtls_entropy_func( void *data, unsigned char *output, size_t len )
             return( ret );
     }
 #endif
+#endif
+
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+    ret = entropy_func_shard( ctx, output, len );
+
+    return( ret );
+#else /* MBEDTLS_ENTROPY_SHARDS */
 
 #if defined(MBEDTLS_THREADING_C)
     if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
@@ -372,54 +758,8 @@ int mbedtls_entropy_func( void *data, unsigned char *output, size_t len )
 
     memset( buf, 0, MBEDTLS_ENTROPY_BLOCK_SIZE );
 
-#if defined(MBEDTLS_ENTROPY_SHA512_ACCUMULATOR)
-    /*
-     * Note that at this stage it is assumed that the accumulator was started
-     * in a previous call to entropy_update(). If this is not guaranteed, the
-     * code below will fail.
-     */
-    if( ( ret = mbedtls_sha512_finish_ret( &ctx->accumulator, buf ) ) != 0 )
-        goto exit;
-
-    /*
-     * Reset accumulator and counters and recycle existing entropy
-     */
-    mbedtls_sha512_free( &ctx->accumulator );
-    mbedtls_sha512_init( &ctx->accumulator );
-    if( ( ret = mbedtls_sha512_starts_ret( &ctx->accumulator, 0 ) ) != 0 )
-        goto exit;
-    if( ( ret = mbedtls_sha512_update_ret( &ctx->accumulator, buf,
-                                           MBEDTLS_ENTROPY_BLOCK_SIZE ) ) != 0 )
-        goto exit;
-
-    /*
-     * Perform second SHA-512 on entropy
-     */
-    if( ( ret = mbedtls_sha512_ret( buf, MBEDTLS_ENTROPY_BLOCK_SIZE,
-                                    buf, 0 ) ) != 0 )
-        goto exit;
-#else /* MBEDTLS_ENTROPY_SHA512_ACCUMULATOR */
-    if( ( ret = mbedtls_sha256_finish_ret( &ctx->accumulator, buf ) ) != 0 )
-        goto exit;
-
-    /*
-     * Reset accumulator and counters and recycle existing entropy
-     */
-    mbedtls_sha256_free( &ctx->accumulator );
-    mbedtls_sha256_init( &ctx->accumulator );
-    if( ( ret = mbedtls_sha256_starts_ret( &ctx->accumulator, 0 ) ) != 0 )
-        goto exit;
-    if( ( ret = mbedtls_sha256_update_ret( &ctx->accumulator, buf,
-                                           MBEDTLS_ENTROPY_BLOCK_SIZE ) ) != 0 )
-        goto exit;
-
-    /*
-     * Perform second SHA-256 on entropy
-     */
-    if( ( ret = mbedtls_sha256_ret( buf, MBEDTLS_ENTROPY_BLOCK_SIZE,
-                                    buf, 0 ) ) != 0 )
+    if( ( ret = entropy_release( &ctx->accumulator, buf ) ) != 0 )
         goto exit;
-#endif /* MBEDTLS_ENTROPY_SHA512_ACCUMULATOR */
 
     for( i = 0; i < ctx->source_count; i++ )
         ctx->source[i].size = 0;
@@ -437,7 +777,111 @@ exit:
 #endif
 
     return( ret );
+#endif /* MBEDTLS_ENTROPY_SHARDS */
+}
+
+#if defined(MBEDTLS_ENTROPY_SHARDS) && defined(MBEDTLS_THREADING_PTHREAD)
+/*
+ * Background gathering: top up every shard that is not ready, then wait
+ * for the interval to elapse or for the thread to be stopped
+ */
+static void entropy_gather_thread( void *data )
+{
+    mbedtls_entropy_context *ctx = (mbedtls_entropy_context *) data;
+    mbedtls_entropy_shard *shard;
+    int i, count;
+
+    pthread_mutex_lock( &ctx->gather_mutex );
+
+    while( ctx->gather_state == ENTROPY_GATHER_RUNNING )
+    {
+        pthread_mutex_unlock( &ctx->gather_mutex );
+
+        for( i = 0; i < MBEDTLS_ENTROPY_SHARDS; i++ )
+        {
+            shard = &ctx->shard[i];
+
+            if( mbedtls_mutex_lock( &shard->mutex ) != 0 )
+                continue;
+
+            /* Failures are left for mbedtls_entropy_func() to report */
+            for( count = 0; count < ENTROPY_MAX_LOOP &&
+                            ! entropy_shard_ready( ctx, shard ); count++ )
+            {
+                if( entropy_gather_shard( ctx, shard ) != 0 )
+                    break;
+            }
+
+            mbedtls_mutex_unlock( &shard->mutex );
+        }
+
+        pthread_mutex_lock( &ctx->gather_mutex );
+
+        /* An early wakeup only brings the next round forward */
+        if( ctx->gather_state == ENTROPY_GATHER_RUNNING )
+            mbedtls_threading_cond_timedwait( &ctx->gather_cond,
+                                              &ctx->gather_mutex,
+                                              ctx->gather_interval );
+    }
+
+    pthread_mutex_unlock( &ctx->gather_mutex );
+}
+
+int mbedtls_entropy_gather_thread_start( mbedtls_entropy_context *ctx,
+                                         unsigned int interval_ms )
+{
+    int ret = 0;
+
+    pthread_mutex_lock( &ctx->gather_mutex );
+
+    if( ctx->gather_state != ENTROPY_GATHER_IDLE )
+    {
+        ret = MBEDTLS_ERR_THREADING_BAD_INPUT_DATA;
+        goto exit;
+    }
+
+    ctx->gather_interval = interval_ms;
+    ctx->gather_state = ENTROPY_GATHER_RUNNING;
+
+    if( mbedtls_threading_thread_create( &ctx->gather_thread,
+                                         entropy_gather_thread, ctx ) != 0 )
+    {
+        ctx->gather_state = ENTROPY_GATHER_IDLE;
+        ret = MBEDTLS_ERR_ENTROPY_SOURCE_FAILED;
+    }
+
+exit:
+    pthread_mutex_unlock( &ctx->gather_mutex );
+
+    return( ret );
+}
+
+void mbedtls_entropy_gather_thread_stop( mbedtls_entropy_context *ctx )
+{
+    pthread_mutex_lock( &ctx->gather_mutex );
+
+    if( ctx->gather_state == ENTROPY_GATHER_RUNNING )
+    {
+        ctx->gather_state = ENTROPY_GATHER_STOPPING;
+        pthread_cond_broadcast( &ctx->gather_cond );
+        pthread_mutex_unlock( &ctx->gather_mutex );
+
+        mbedtls_threading_thread_join( &ctx->gather_thread );
+
+        pthread_mutex_lock( &ctx->gather_mutex );
+        ctx->gather_state = ENTROPY_GATHER_IDLE;
+        pthread_cond_broadcast( &ctx->gather_cond );
+    }
+    else
+    {
+        /* Another caller is stopping the thread: wait until it is done */
+        while( ctx->gather_state == ENTROPY_GATHER_STOPPING )
+            pthread_cond_wait( &ctx->gather_cond, &ctx->gather_mutex );
+    }
+
+    pthread_mutex_unlock( &ctx->gather_mutex );
 }
+#endif /* MBEDTLS_ENTROPY_SHARDS && MBEDTLS_THREADING_PTHREAD */
 
 #if defined(MBEDTLS_ENTROPY_NV_SEED)
 int mbedtls_entropy_update_nv_seed( mbedtls_entropy_context *ctx )
@@ -449,8 +893,22 @@ int mbedtls_entropy_update_nv_seed( mbedtls_entropy_context *ctx )
     if( ( ret = mbedtls_entropy_func( ctx, buf, MBEDTLS_ENTROPY_BLOCK_SIZE ) ) != 0 )
         return( ret );
 
+#if defined(ENTROPY_LOCK_NV_SEED)
+    /* Not while a shard polls the seed */
+    if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
+        return( ret );
+
+    ret = mbedtls_nv_seed_write( buf, MBEDTLS_ENTROPY_BLOCK_SIZE );
+
+    if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+
+    if( ret < 0 )
+        return( MBEDTLS_ERR_ENTROPY_FILE_IO_ERROR );
+#else
     if( mbedtls_nv_seed_write( buf, MBEDTLS_ENTROPY_BLOCK_SIZE ) < 0 )
         return( MBEDTLS_ERR_ENTROPY_FILE_IO_ERROR );
+#endif
 
     /* Manually update the remaining stream with a separator value to diverge */
     memset( buf, 0, MBEDTLS_ENTROPY_BLOCK_SIZE );
@@ -874,6 +874,8 @@ void mbedtls_strerror( int ret, char *buf, size_t buflen )
         mbedtls_snprintf( buf, buflen, "THREADING - Bad input parameters to function" );
     if( use_ret == -(MBEDTLS_ERR_THREADING_MUTEX_ERROR) )
         mbedtls_snprintf( buf, buflen, "THREADING - Locking / unlocking / free failed with error code" );
+    if( use_ret == -(MBEDTLS_ERR_THREADING_THREAD_ERROR) )
+        mbedtls_snprintf( buf, buflen, "THREADING - A thread could not be started" );
 #endif /* MBEDTLS_THREADING_C */
 
 #if defined(MBEDTLS_XTEA_C)
@@ -46,9 +46,30 @@
 #include "mbedtls/aesni.h"
 #endif
 
-#if defined(MBEDTLS_SELF_TEST) && defined(MBEDTLS_AES_C)
+#if defined(MBEDTLS_AES_BITSLICE)
 #include "mbedtls/aes.h"
+#endif
+
+#if defined(MBEDTLS_CAMELLIA_C)
+#include "mbedtls/camellia.h"
+#endif
+
+#if defined(MBEDTLS_ARIA_C)
+#include "mbedtls/aria.h"
+#endif
+
+#include "mbedtls/cipher_internal.h"
+
+#if defined(MBEDTLS_PLATFORM_C)
 #include "mbedtls/platform.h"
+#else
+#include <stdlib.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free       free
+#endif /* MBEDTLS_PLATFORM_C */
+
+#if defined(MBEDTLS_SELF_TEST) && defined(MBEDTLS_AES_C)
+#include "mbedtls/aes.h"
 #if !defined(MBEDTLS_PLATFORM_C)
 #include <stdio.h>
 #define mbedtls_printf printf
@@ -57,6 +78,12 @@
 
 #if !defined(MBEDTLS_GCM_ALT)
 
+#if defined(_MSC_VER) || defined(__WATCOMC__)
+  #define UL64(x) x##ui64
+#else
+  #define UL64(x) x##ULL
+#endif
+
 /*
  * 32-bit integer manipulation macros (big endian)
  */
@@ -88,6 +115,27 @@ void mbedtls_gcm_init( mbedtls_gcm_context *ctx )
     memset( ctx, 0, sizeof( mbedtls_gcm_context ) );
 }
 
+/*
+ * The GHASH implementation to use for ctx: MBEDTLS_GCM_GHASH_AUTO stands for
+ * CLMUL here.
+ */
+static int gcm_ghash_mode( const mbedtls_gcm_context *ctx )
+{
+    if( ctx->ghash_mode != MBEDTLS_GCM_GHASH_AUTO )
+        return( ctx->ghash_mode );
+
+#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_CLMUL ) )
+        return( MBEDTLS_GCM_GHASH_AUTO );
+#endif
+
+#if MBEDTLS_GCM_TABLE_BITS == 8
+    return( MBEDTLS_GCM_GHASH_TABLE8 );
+#else
+    return( MBEDTLS_GCM_GHASH_TABLE4 );
+#endif
+}
+
 /*
  * Precompute small multiples of H, that is set
  *      HH[i] || HL[i] = H times i,
@@ -95,37 +143,68 @@ void mbedtls_gcm_init( mbedtls_gcm_context *ctx )
  * correspond to low powers of P. The result is stored in the same way, that
  * is the high-order bit of HH corresponds to P^0 and the low-order bit of HL
  * corresponds to P^127.
+ *
+ * With 8-bit tables, HT8[2 * i] || HT8[2 * i + 1] = H times i likewise, for
+ * 0 <= i < 256. CLMUL and the constant-time method only need H itself,
+ * which is always kept in HH[8] || HL[8].
  */
-static int gcm_gen_table( mbedtls_gcm_context *ctx )
+static int gcm_gen_mode_table( mbedtls_gcm_context *ctx )
 {
-    int ret, i, j;
-    uint64_t hi, lo;
+    int i, j, mode = gcm_ghash_mode( ctx );
     uint64_t vl, vh;
-    unsigned char h[16];
-    size_t olen = 0;
 
-    memset( h, 0, 16 );
-    if( ( ret = mbedtls_cipher_update( &ctx->cipher_ctx, h, 16, h, &olen ) ) != 0 )
-        return( ret );
+    if( mode != MBEDTLS_GCM_GHASH_TABLE8 && ctx->HT8 != NULL )
+    {
+        mbedtls_platform_zeroize( ctx->HT8, 512 * sizeof( uint64_t ) );
+        mbedtls_free( ctx->HT8 );
+        ctx->HT8 = NULL;
+    }
 
-    /* pack h as two 64-bits ints, big-endian */
-    GET_UINT32_BE( hi, h,  0  );
-    GET_UINT32_BE( lo, h,  4  );
-    vh = (uint64_t) hi << 32 | lo;
+    vh = ctx->HH[8];
+    vl = ctx->HL[8];
 
-    GET_UINT32_BE( hi, h,  8  );
-    GET_UINT32_BE( lo, h,  12 );
-    vl = (uint64_t) hi << 32 | lo;
+    if( mode == MBEDTLS_GCM_GHASH_TABLE8 )
+    {
+        uint64_t *T;
+
+        if( ctx->HT8 == NULL )
+        {
+            ctx->HT8 = mbedtls_calloc( 512, sizeof( uint64_t ) );
+            if( ctx->HT8 == NULL )
+                return( MBEDTLS_ERR_CIPHER_ALLOC_FAILED );
+        }
+        T = ctx->HT8;
 
-    /* 8 = 1000 corresponds to 1 in GF(2^128) */
-    ctx->HL[8] = vl;
-    ctx->HH[8] = vh;
+        /* 128 = 10000000 corresponds to 1 in GF(2^128) */
+        T[0] = 0;
+        T[1] = 0;
+        T[256] = vh;
+        T[257] = vl;
+
+        for( i = 64; i > 0; i >>= 1 )
+        {
+            uint32_t R = ( vl & 1 ) * 0xe1000000U;
+            vl  = ( vh << 63 ) | ( vl >> 1 );
+            vh  = ( vh >> 1 ) ^ ( (uint64_t) R << 32);
+
+            T[2 * i] = vh;
+            T[2 * i + 1] = vl;
+        }
+
+        for( i = 2; i <= 128; i *= 2 )
+        {
+            for( j = 1; j < i; j++ )
+            {
+                T[2 * ( i + j )]     = T[2 * i]     ^ T[2 * j];
+                T[2 * ( i + j ) + 1] = T[2 * i + 1] ^ T[2 * j + 1];
+            }
+        }
 
-#if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
-    /* With CLMUL support, we need only h, not the rest of the table */
-    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_CLMUL ) )
         return( 0 );
-#endif
+    }
+
+    if( mode != MBEDTLS_GCM_GHASH_TABLE4 )
+        return( 0 );
 
     /* 0 corresponds to 0 in GF(2^128) */
     ctx->HH[0] = 0;
@@ -156,6 +235,29 @@ static int gcm_gen_table( mbedtls_gcm_context *ctx )
     return( 0 );
 }
 
+static int gcm_gen_table( mbedtls_gcm_context *ctx )
+{
+    int ret;
+    uint64_t hi, lo;
+    unsigned char h[16];
+    size_t olen = 0;
+
+    memset( h, 0, 16 );
+    if( ( ret = mbedtls_cipher_update( &ctx->cipher_ctx, h, 16, h, &olen ) ) != 0 )
+        return( ret );
+
+    /* pack h as two 64-bits ints, big-endian */
+    GET_UINT32_BE( hi, h,  0  );
+    GET_UINT32_BE( lo, h,  4  );
+    ctx->HH[8] = (uint64_t) hi << 32 | lo;
+
+    GET_UINT32_BE( hi, h,  8  );
+    GET_UINT32_BE( lo, h,  12 );
+    ctx->HL[8] = (uint64_t) hi << 32 | lo;
+
+    return( gcm_gen_mode_table( ctx ) );
+}
+
 int mbedtls_gcm_setkey( mbedtls_gcm_context *ctx,
                         mbedtls_cipher_id_t cipher,
                         const unsigned char *key,
@@ -188,6 +290,20 @@ int mbedtls_gcm_setkey( mbedtls_gcm_context *ctx,
     return( 0 );
 }
 
+int mbedtls_gcm_set_ghash_mode( mbedtls_gcm_context *ctx, int mode )
+{
+    if( mode < MBEDTLS_GCM_GHASH_AUTO || mode > MBEDTLS_GCM_GHASH_CT )
+        return( MBEDTLS_ERR_GCM_BAD_INPUT );
+
+    ctx->ghash_mode = mode;
+
+    /* Before mbedtls_gcm_setkey(), the tables are built along with H */
+    if( ctx->cipher_ctx.cipher_info == NULL )
+        return( 0 );
+
+    return( gcm_gen_mode_table( ctx ) );
+}
+
 /*
  * Shoup's method for multiplication use this table with
  *      last4[x] = x times P^128
@@ -201,6 +317,198 @@ static const uint64_t last4[16] =
     0x9180, 0x8da0, 0xa9c0, 0xb5e0
 };
 
+/*
+ * Same as last4 for the 8-bit tables:
+ *      last8[x] = x times P^128
+ */
+static const uint16_t last8[256] =
+{
+    0x0000, 0x01c2, 0x0384, 0x0246, 0x0708, 0x06ca, 0x048c, 0x054e,
+    0x0e10, 0x0fd2, 0x0d94, 0x0c56, 0x0918, 0x08da, 0x0a9c, 0x0b5e,
+    0x1c20, 0x1de2, 0x1fa4, 0x1e66, 0x1b28, 0x1aea, 0x18ac, 0x196e,
+    0x1230, 0x13f2, 0x11b4, 0x1076, 0x1538, 0x14fa, 0x16bc, 0x177e,
+    0x3840, 0x3982, 0x3bc4, 0x3a06, 0x3f48, 0x3e8a, 0x3ccc, 0x3d0e,
+    0x3650, 0x3792, 0x35d4, 0x3416, 0x3158, 0x309a, 0x32dc, 0x331e,
+    0x2460, 0x25a2, 0x27e4, 0x2626, 0x2368, 0x22aa, 0x20ec, 0x212e,
+    0x2a70, 0x2bb2, 0x29f4, 0x2836, 0x2d78, 0x2cba, 0x2efc, 0x2f3e,
+    0x7080, 0x7142, 0x7304, 0x72c6, 0x7788, 0x764a, 0x740c, 0x75ce,
+    0x7e90, 0x7f52, 0x7d14, 0x7cd6, 0x7998, 0x785a, 0x7a1c, 0x7bde,
+    0x6ca0, 0x6d62, 0x6f24, 0x6ee6, 0x6ba8, 0x6a6a, 0x682c, 0x69ee,
+    0x62b0, 0x6372, 0x6134, 0x60f6, 0x65b8, 0x647a, 0x663c, 0x67fe,
+    0x48c0, 0x4902, 0x4b44, 0x4a86, 0x4fc8, 0x4e0a, 0x4c4c, 0x4d8e,
+    0x46d0, 0x4712, 0x4554, 0x4496, 0x41d8, 0x401a, 0x425c, 0x439e,
+    0x54e0, 0x5522, 0x5764, 0x56a6, 0x53e8, 0x522a, 0x506c, 0x51ae,
+    0x5af0, 0x5b32, 0x5974, 0x58b6, 0x5df8, 0x5c3a, 0x5e7c, 0x5fbe,
+    0xe100, 0xe0c2, 0xe284, 0xe346, 0xe608, 0xe7ca, 0xe58c, 0xe44e,
+    0xef10, 0xeed2, 0xec94, 0xed56, 0xe818, 0xe9da, 0xeb9c, 0xea5e,
+    0xfd20, 0xfce2, 0xfea4, 0xff66, 0xfa28, 0xfbea, 0xf9ac, 0xf86e,
+    0xf330, 0xf2f2, 0xf0b4, 0xf176, 0xf438, 0xf5fa, 0xf7bc, 0xf67e,
+    0xd940, 0xd882, 0xdac4, 0xdb06, 0xde48, 0xdf8a, 0xddcc, 0xdc0e,
+    0xd750, 0xd692, 0xd4d4, 0xd516, 0xd058, 0xd19a, 0xd3dc, 0xd21e,
+    0xc560, 0xc4a2, 0xc6e4, 0xc726, 0xc268, 0xc3aa, 0xc1ec, 0xc02e,
+    0xcb70, 0xcab2, 0xc8f4, 0xc936, 0xcc78, 0xcdba, 0xcffc, 0xce3e,
+    0x9180, 0x9042, 0x9204, 0x93c6, 0x9688, 0x974a, 0x950c, 0x94ce,
+    0x9f90, 0x9e52, 0x9c14, 0x9dd6, 0x9898, 0x995a, 0x9b1c, 0x9ade,
+    0x8da0, 0x8c62, 0x8e24, 0x8fe6, 0x8aa8, 0x8b6a, 0x892c, 0x88ee,
+    0x83b0, 0x8272, 0x8034, 0x81f6, 0x84b8, 0x857a, 0x873c, 0x86fe,
+    0xa9c0, 0xa802, 0xaa44, 0xab86, 0xaec8, 0xaf0a, 0xad4c, 0xac8e,
+    0xa7d0, 0xa612, 0xa454, 0xa596, 0xa0d8, 0xa11a, 0xa35c, 0xa29e,
+    0xb5e0, 0xb422, 0xb664, 0xb7a6, 0xb2e8, 0xb32a, 0xb16c, 0xb0ae,
+    0xbbf0, 0xba32, 0xb874, 0xb9b6, 0xbcf8, 0xbd3a, 0xbf7c, 0xbebe
+};
+
+/*
+ * Sets output to x times H using the 8-bit tables, one byte at a time.
+ */
+static void gcm_mult8( const mbedtls_gcm_context *ctx,
+                       const unsigned char x[16], unsigned char output[16] )
+{
+    int i;
+    unsigned char rem;
+    const uint64_t *T = ctx->HT8;
+    uint64_t zh, zl;
+
+    zh = T[2 * x[15]];
+    zl = T[2 * x[15] + 1];
+
+    for( i = 14; i >= 0; i-- )
+    {
+        rem = (unsigned char) zl;
+        zl = ( zh << 56 ) | ( zl >> 8 );
+        zh = ( zh >> 8 );
+        zh ^= (uint64_t) last8[rem] << 48;
+        zh ^= T[2 * x[i]];
+        zl ^= T[2 * x[i] + 1];
+    }
+
+    PUT_UINT32_BE( zh >> 32, output, 0 );
+    PUT_UINT32_BE( zh, output, 4 );
+    PUT_UINT32_BE( zl >> 32, output, 8 );
+    PUT_UINT32_BE( zl, output, 12 );
+}
+
+/*
+ * Constant-time GHASH multiplication [BEARSSL-CT].
+ *
+ * bmul64() returns the low 64 bits of the carry-less product of x and y
+ * using integer multiplications: spreading each operand over four masks
+ * leaves three zero bits between data bits, enough room for the carries of
+ * up to 16 partial products to stay out of the bits that are kept. The high
+ * 64 bits are the low bits of the product of the bit-reversed operands,
+ * reversed. A 128-bit product takes three of each (Karatsuba).
+ *
+ * [BEARSSL-CT] T. Pornin, "Constant-Time Mul", https://bearssl.org/ctmul.html
+ */
+static uint64_t gcm_bmul64( uint64_t x, uint64_t y )
+{
+    uint64_t x0, x1, x2, x3;
+    uint64_t y0, y1, y2, y3;
+    uint64_t z0, z1, z2, z3;
+
+    x0 = x & UL64( 0x1111111111111111 );
+    x1 = x & UL64( 0x2222222222222222 );
+    x2 = x & UL64( 0x4444444444444444 );
+    x3 = x & UL64( 0x8888888888888888 );
+    y0 = y & UL64( 0x1111111111111111 );
+    y1 = y & UL64( 0x2222222222222222 );
+    y2 = y & UL64( 0x4444444444444444 );
+    y3 = y & UL64( 0x8888888888888888 );
+
+    z0 = ( x0 * y0 ) ^ ( x1 * y3 ) ^ ( x2 * y2 ) ^ ( x3 * y1 );
+    z1 = ( x0 * y1 ) ^ ( x1 * y0 ) ^ ( x2 * y3 ) ^ ( x3 * y2 );
+    z2 = ( x0 * y2 ) ^ ( x1 * y1 ) ^ ( x2 * y0 ) ^ ( x3 * y3 );
+    z3 = ( x0 * y3 ) ^ ( x1 * y2 ) ^ ( x2 * y1 ) ^ ( x3 * y0 );
+
+    z0 &= UL64( 0x1111111111111111 );
+    z1 &= UL64( 0x2222222222222222 );
+    z2 &= UL64( 0x4444444444444444 );
+    z3 &= UL64( 0x8888888888888888 );
+
+    return( z0 | z1 | z2 | z3 );
+}
+
+static uint64_t gcm_rev64( uint64_t x )
+{
+#define RMS( m, s )                                                 \
+    x = ( ( x & UL64( m ) ) << (s) ) | ( ( x >> (s) ) & UL64( m ) )
+
+    RMS( 0x5555555555555555,  1 );
+    RMS( 0x3333333333333333,  2 );
+    RMS( 0x0F0F0F0F0F0F0F0F,  4 );
+    RMS( 0x00FF00FF00FF00FF,  8 );
+    RMS( 0x0000FFFF0000FFFF, 16 );
+
+#undef RMS
+
+    return( ( x << 32 ) | ( x >> 32 ) );
+}
+
+/*
+ * Sets output to x times H without tables. In the bit-reflected
+ * representation of [MGV], a carry-less product is shifted left by one bit
+ * and then reduced modulo P.
+ */
+static void gcm_mult_ct( const mbedtls_gcm_context *ctx,
+                         const unsigned char x[16], unsigned char output[16] )
+{
+    uint32_t hi, lo;
+    uint64_t h0, h1, h2, h0r, h1r, h2r;
+    uint64_t y0, y1, y2, y0r, y1r, y2r;
+    uint64_t z0, z1, z2, z0h, z1h, z2h;
+    uint64_t v0, v1, v2, v3;
+
+    h1 = ctx->HH[8];
+    h0 = ctx->HL[8];
+    h0r = gcm_rev64( h0 );
+    h1r = gcm_rev64( h1 );
+    h2 = h0 ^ h1;
+    h2r = h0r ^ h1r;
+
+    GET_UINT32_BE( hi, x, 0 );
+    GET_UINT32_BE( lo, x, 4 );
+    y1 = (uint64_t) hi << 32 | lo;
+    GET_UINT32_BE( hi, x, 8 );
+    GET_UINT32_BE( lo, x, 12 );
+    y0 = (uint64_t) hi << 32 | lo;
+
+    y0r = gcm_rev64( y0 );
+    y1r = gcm_rev64( y1 );
+    y2 = y0 ^ y1;
+    y2r = y0r ^ y1r;
+
+    z0 = gcm_bmul64( y0, h0 );
+    z1 = gcm_bmul64( y1, h1 );
+    z2 = gcm_bmul64( y2, h2 );
+    z0h = gcm_bmul64( y0r, h0r );
+    z1h = gcm_bmul64( y1r, h1r );
+    z2h = gcm_bmul64( y2r, h2r );
+    z2 ^= z0 ^ z1;
+    z2h ^= z0h ^ z1h;
+    z0h = gcm_rev64( z0h ) >> 1;
+    z1h = gcm_rev64( z1h ) >> 1;
+    z2h = gcm_rev64( z2h ) >> 1;
+
+    v0 = z0;
+    v1 = z0h ^ z2;
+    v2 = z1 ^ z2h;
+    v3 = z1h;
+
+    v3 = ( v3 << 1 ) | ( v2 >> 63 );
+    v2 = ( v2 << 1 ) | ( v1 >> 63 );
+    v1 = ( v1 << 1 ) | ( v0 >> 63 );
+    v0 = ( v0 << 1 );
+
+    v2 ^= v0 ^ ( v0 >> 1 ) ^ ( v0 >> 2 ) ^ ( v0 >> 7 );
+    v1 ^= ( v0 << 63 ) ^ ( v0 << 62 ) ^ ( v0 << 57 );
+    v3 ^= v1 ^ ( v1 >> 1 ) ^ ( v1 >> 2 ) ^ ( v1 >> 7 );
+    v2 ^= ( v1 << 63 ) ^ ( v1 << 62 ) ^ ( v1 << 57 );
+
+    PUT_UINT32_BE( v3 >> 32, output, 0 );
+    PUT_UINT32_BE( v3, output, 4 );
+    PUT_UINT32_BE( v2 >> 32, output, 8 );
+    PUT_UINT32_BE( v2, output, 12 );
+}
+
 /*
  * Sets output to x times H using the precomputed tables.
  * x and output are seen as elements of GF(2^128) as in [MGV].
@@ -213,7 +521,8 @@ static void gcm_mult( mbedtls_gcm_context *ctx, const unsigned char x[16],
     uint64_t zh, zl;
 
 #if defined(MBEDTLS_AESNI_C) && defined(MBEDTLS_HAVE_X86_64)
-    if( mbedtls_aesni_has_support( MBEDTLS_AESNI_CLMUL ) ) {
+    if( ctx->ghash_mode == MBEDTLS_GCM_GHASH_AUTO &&
+        mbedtls_aesni_has_support( MBEDTLS_AESNI_CLMUL ) ) {
         unsigned char h[16];
 
         PUT_UINT32_BE( ctx->HH[8] >> 32, h,  0 );
@@ -226,6 +535,18 @@ static void gcm_mult( mbedtls_gcm_context *ctx, const unsigned char x[16],
     }
 #endif /* MBEDTLS_AESNI_C && MBEDTLS_HAVE_X86_64 */
 
+    if( ctx->HT8 != NULL )
+    {
+        gcm_mult8( ctx, x, output );
+        return;
+    }
+
+    if( ctx->ghash_mode == MBEDTLS_GCM_GHASH_CT )
+    {
+        gcm_mult_ct( ctx, x, output );
+        return;
+    }
+
     lo = x[15] & 0xf;
 
     zh = ctx->HH[lo];
@@ -344,6 +665,64 @@ int mbedtls_gcm_starts( mbedtls_gcm_context *ctx,
     return( 0 );
 }
 
+#if defined(MBEDTLS_AES_BITSLICE) || defined(MBEDTLS_CAMELLIA_C) || \
+    defined(MBEDTLS_ARIA_C)
+/*
+ * With block ciphers that have a multi-block function, counter blocks are
+ * encrypted several at a time so that the bitsliced AES and the byte-sliced
+ * Camellia and ARIA implementations can process them in parallel (and, for
+ * bitsliced AES, convert the key schedule only once per batch)
+ */
+#define GCM_BULK_BLOCKS  32
+
+static int gcm_has_bulk( const mbedtls_gcm_context *ctx )
+{
+    switch( ctx->cipher_ctx.cipher_info->base->cipher )
+    {
+#if defined(MBEDTLS_AES_BITSLICE)
+        case MBEDTLS_CIPHER_ID_AES:
+#endif
+#if defined(MBEDTLS_CAMELLIA_C)
+        case MBEDTLS_CIPHER_ID_CAMELLIA:
+#endif
+#if defined(MBEDTLS_ARIA_C)
+        case MBEDTLS_CIPHER_ID_ARIA:
+#endif
+            return( 1 );
+
+        default:
+            return( 0 );
+    }
+}
+
+static int gcm_encrypt_blocks( mbedtls_gcm_context *ctx, size_t nblocks,
+                               unsigned char *buf )
+{
+    void *cipher_ctx = ctx->cipher_ctx.cipher_ctx;
+
+    switch( ctx->cipher_ctx.cipher_info->base->cipher )
+    {
+#if defined(MBEDTLS_AES_BITSLICE)
+        case MBEDTLS_CIPHER_ID_AES:
+            return( mbedtls_aes_encrypt_blocks( cipher_ctx, nblocks,
+                                                buf, buf ) );
+#endif
+#if defined(MBEDTLS_CAMELLIA_C)
+        case MBEDTLS_CIPHER_ID_CAMELLIA:
+            return( mbedtls_camellia_crypt_blocks( cipher_ctx, nblocks,
+                                                   buf, buf ) );
+#endif
+#if defined(MBEDTLS_ARIA_C)
+        case MBEDTLS_CIPHER_ID_ARIA:
+            return( mbedtls_aria_crypt_blocks( cipher_ctx, nblocks,
+                                               buf, buf ) );
+#endif
+        default:
+            return( MBEDTLS_ERR_GCM_BAD_INPUT );
+    }
+}
+#endif /* MBEDTLS_AES_BITSLICE || MBEDTLS_CAMELLIA_C || MBEDTLS_ARIA_C */
+
 int mbedtls_gcm_update( mbedtls_gcm_context *ctx,
                 size_t length,
                 const unsigned char *input,
@@ -370,6 +749,57 @@ int mbedtls_gcm_update( mbedtls_gcm_context *ctx,
     ctx->len += length;
 
     p = input;
+
+#if defined(GCM_BULK_BLOCKS)
+    if( length >= 32 && gcm_has_bulk( ctx ) )
+    {
+        unsigned char ectrs[GCM_BULK_BLOCKS * 16];
+        size_t j, nb;
+
+        ret = 0;
+        while( length >= 16 )
+        {
+            nb = length / 16 < GCM_BULK_BLOCKS ? length / 16 : GCM_BULK_BLOCKS;
+
+            for( j = 0; j < nb; j++ )
+            {
+                for( i = 16; i > 12; i-- )
+                    if( ++ctx->y[i - 1] != 0 )
+                        break;
+
+                memcpy( ectrs + 16 * j, ctx->y, 16 );
+            }
+
+            if( ( ret = gcm_encrypt_blocks( ctx, nb, ectrs ) ) != 0 )
+                break;
+
+            for( j = 0; j < nb; j++ )
+            {
+                for( i = 0; i < 16; i++ )
+                {
+                    if( ctx->mode == MBEDTLS_GCM_DECRYPT )
+                        ctx->buf[i] ^= p[i];
+                    out_p[i] = ectrs[16 * j + i] ^ p[i];
+                    if( ctx->mode == MBEDTLS_GCM_ENCRYPT )
+                        ctx->buf[i] ^= out_p[i];
+                }
+
+                gcm_mult( ctx, ctx->buf, ctx->buf );
+
+                p += 16;
+                out_p += 16;
+            }
+
+            length -= 16 * nb;
+        }
+
+        mbedtls_platform_zeroize( ectrs, sizeof( ectrs ) );
+
+        if( ret != 0 )
+            return( ret );
+    }
+#endif /* GCM_BULK_BLOCKS */
+
     while( length > 0 )
     {
         use_len = ( length < 16 ) ? length : 16;
@@ -503,6 +933,11 @@ int mbedtls_gcm_auth_decrypt( mbedtls_gcm_context *ctx,
 void mbedtls_gcm_free( mbedtls_gcm_context *ctx )
 {
     mbedtls_cipher_free( &ctx->cipher_ctx );
+    if( ctx->HT8 != NULL )
+    {
+        mbedtls_platform_zeroize( ctx->HT8, 512 * sizeof( uint64_t ) );
+        mbedtls_free( ctx->HT8 );
+    }
     mbedtls_platform_zeroize( ctx, sizeof( mbedtls_gcm_context ) );
 }
 
@@ -66,7 +66,7 @@ void mbedtls_hmac_drbg_init( mbedtls_hmac_drbg_context *ctx )
 /*
  * HMAC_DRBG update, using optional additional data (10.1.2.2)
  */
-void mbedtls_hmac_drbg_update( mbedtls_hmac_drbg_context *ctx,
+static void hmac_drbg_update_internal( mbedtls_hmac_drbg_context *ctx,
                        const unsigned char *additional, size_t add_len )
 {
     size_t md_len = mbedtls_md_get_size( ctx->md_ctx.md_info );
@@ -91,6 +91,15 @@ void mbedtls_hmac_drbg_update( mbedtls_hmac_drbg_context *ctx,
     }
 }
 
+void mbedtls_hmac_drbg_update( mbedtls_hmac_drbg_context *ctx,
+                       const unsigned char *additional, size_t add_len )
+{
+    /* Output buffered before the update must not be handed out after it */
+    mbedtls_drbg_prefetch_discard( &ctx->prefetch );
+
+    hmac_drbg_update_internal( ctx, additional, add_len );
+}
+
 /*
  * Simplified HMAC_DRBG initialisation (for use with deterministic ECDSA)
  */
@@ -111,7 +120,7 @@ int mbedtls_hmac_drbg_seed_buf( mbedtls_hmac_drbg_context *ctx,
     mbedtls_md_hmac_starts( &ctx->md_ctx, ctx->V, mbedtls_md_get_size( md_info ) );
     memset( ctx->V, 0x01, mbedtls_md_get_size( md_info ) );
 
-    mbedtls_hmac_drbg_update( ctx, data, data_len );
+    hmac_drbg_update_internal( ctx, data, data_len );
 
     return( 0 );
 }
@@ -134,6 +143,9 @@ int mbedtls_hmac_drbg_reseed( mbedtls_hmac_drbg_context *ctx,
 
     memset( seed, 0, MBEDTLS_HMAC_DRBG_MAX_SEED_INPUT );
 
+    /* Output buffered before the reseed must not be handed out after it */
+    mbedtls_drbg_prefetch_discard( &ctx->prefetch );
+
     /* IV. Gather entropy_len bytes of entropy for the seed */
     if( ctx->f_entropy( ctx->p_entropy, seed, ctx->entropy_len ) != 0 )
         return( MBEDTLS_ERR_HMAC_DRBG_ENTROPY_SOURCE_FAILED );
@@ -148,7 +160,7 @@ int mbedtls_hmac_drbg_reseed( mbedtls_hmac_drbg_context *ctx,
     }
 
     /* 2. Update state */
-    mbedtls_hmac_drbg_update( ctx, seed, seedlen );
+    hmac_drbg_update_internal( ctx, seed, seedlen );
 
     /* 3. Reset reseed_counter */
     ctx->reseed_counter = 1;
@@ -238,6 +250,13 @@ void mbedtls_hmac_drbg_set_reseed_interval( mbedtls_hmac_drbg_context *ctx, int
     ctx->reseed_interval = interval;
 }
 
+void mbedtls_hmac_drbg_set_prefetch( mbedtls_hmac_drbg_context *ctx,
+                                     unsigned char *buf, size_t len,
+                                     size_t watermark )
+{
+    mbedtls_drbg_prefetch_set( &ctx->prefetch, buf, len, watermark );
+}
+
 /*
  * HMAC_DRBG random function with optional additional data:
  * 10.1.2.5 (arabic) + 9.3 (Roman)
@@ -273,7 +292,7 @@ int mbedtls_hmac_drbg_random_with_add( void *p_rng,
 
     /* 2. Use additional data if any */
     if( additional != NULL && add_len != 0 )
-        mbedtls_hmac_drbg_update( ctx, additional, add_len );
+        hmac_drbg_update_internal( ctx, additional, add_len );
 
     /* 3, 4, 5. Generate bytes */
     while( left != 0 )
@@ -290,7 +309,7 @@ int mbedtls_hmac_drbg_random_with_add( void *p_rng,
     }
 
     /* 6. Update */
-    mbedtls_hmac_drbg_update( ctx, additional, add_len );
+    hmac_drbg_update_internal( ctx, additional, add_len );
 
     /* 7. Update reseed counter */
     ctx->reseed_counter++;
@@ -299,6 +318,13 @@ int mbedtls_hmac_drbg_random_with_add( void *p_rng,
     return( 0 );
 }
 
+static int hmac_drbg_generate( void *p_rng, unsigned char *output,
+                               size_t out_len )
+{
+    return( mbedtls_hmac_drbg_random_with_add( p_rng, output, out_len,
+                                               NULL, 0 ) );
+}
+
 /*
  * HMAC_DRBG random function
  */
@@ -312,7 +338,14 @@ int mbedtls_hmac_drbg_random( void *p_rng, unsigned char *output, size_t out_len
         return( ret );
 #endif
 
-    ret = mbedtls_hmac_drbg_random_with_add( ctx, output, out_len, NULL, 0 );
+    if( ctx->prefetch.buf != NULL && out_len <= ctx->prefetch.len &&
+        ctx->prediction_resistance == MBEDTLS_HMAC_DRBG_PR_OFF )
+        ret = mbedtls_drbg_prefetch_random( &ctx->prefetch, hmac_drbg_generate,
+                                            ctx, MBEDTLS_HMAC_DRBG_MAX_REQUEST,
+                                            output, out_len );
+    else
+        ret = mbedtls_hmac_drbg_random_with_add( ctx, output, out_len,
+                                                 NULL, 0 );
 
 #if defined(MBEDTLS_THREADING_C)
     if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
@@ -333,6 +366,7 @@ void mbedtls_hmac_drbg_free( mbedtls_hmac_drbg_context *ctx )
 #if defined(MBEDTLS_THREADING_C)
     mbedtls_mutex_free( &ctx->mutex );
 #endif
+    mbedtls_drbg_prefetch_free( &ctx->prefetch );
     mbedtls_md_free( &ctx->md_ctx );
     mbedtls_platform_zeroize( ctx, sizeof( mbedtls_hmac_drbg_context ) );
 }
@@ -49,6 +49,15 @@
 #include <stdio.h>
 #endif
 
+/* Contexts handed to a finish_multi_func at a time */
+#define MD_MULTI_CHUNK      8
+
+#if defined(MBEDTLS_SHA512_C)
+#define MD_MAX_BLOCK_SIZE   128
+#else
+#define MD_MAX_BLOCK_SIZE   64
+#endif
+
 /*
  * Reminder: update profiles in x509_crt.c when adding a new hash!
  */
@@ -266,6 +275,81 @@ int mbedtls_md_finish( mbedtls_md_context_t *ctx, unsigned char *output )
     return( ctx->md_info->finish_func( ctx->md_ctx, output ) );
 }
 
+/*
+ * Check that all contexts are set up for the same digest, and return it
+ */
+static const mbedtls_md_info_t *md_multi_info( mbedtls_md_context_t * const ctx[],
+                                               size_t count )
+{
+    const mbedtls_md_info_t *md_info;
+    size_t i;
+
+    if( ctx == NULL || ctx[0] == NULL || ctx[0]->md_info == NULL )
+        return( NULL );
+
+    md_info = ctx[0]->md_info;
+
+    for( i = 1; i < count; i++ )
+    {
+        if( ctx[i] == NULL || ctx[i]->md_info != md_info )
+            return( NULL );
+    }
+
+    return( md_info );
+}
+
+int mbedtls_md_finish_multi( mbedtls_md_context_t * const ctx[],
+                             const unsigned char * const input[],
+                             const size_t ilen[],
+                             unsigned char * const output[],
+                             size_t count )
+{
+    int ret;
+    const mbedtls_md_info_t *md_info;
+    void *md_ctx[MD_MULTI_CHUNK];
+    size_t i, n;
+
+    if( count == 0 )
+        return( 0 );
+
+    if( ( md_info = md_multi_info( ctx, count ) ) == NULL )
+        return( MBEDTLS_ERR_MD_BAD_INPUT_DATA );
+
+    if( md_info->finish_multi_func == NULL )
+    {
+        for( i = 0; i < count; i++ )
+        {
+            if( ( ret = md_info->update_func( ctx[i]->md_ctx, input[i],
+                                              ilen[i] ) ) != 0 )
+                return( ret );
+            if( ( ret = md_info->finish_func( ctx[i]->md_ctx,
+                                              output[i] ) ) != 0 )
+                return( ret );
+        }
+
+        return( 0 );
+    }
+
+    for( ; count > 0; count -= n )
+    {
+        n = count < MD_MULTI_CHUNK ? count : MD_MULTI_CHUNK;
+
+        for( i = 0; i < n; i++ )
+            md_ctx[i] = ctx[i]->md_ctx;
+
+        if( ( ret = md_info->finish_multi_func( md_ctx, input, ilen,
+                                                output, n ) ) != 0 )
+            return( ret );
+
+        ctx += n;
+        input += n;
+        ilen += n;
+        output += n;
+    }
+
+    return( 0 );
+}
+
 int mbedtls_md( const mbedtls_md_info_t *md_info, const unsigned char *input, size_t ilen,
             unsigned char *output )
 {
@@ -275,6 +359,31 @@ int mbedtls_md( const mbedtls_md_info_t *md_info, const unsigned char *input, si
     return( md_info->digest_func( input, ilen, output ) );
 }
 
+int mbedtls_md_multi( const mbedtls_md_info_t *md_info,
+                      const unsigned char * const input[],
+                      const size_t ilen[],
+                      unsigned char * const output[],
+                      size_t count )
+{
+    int ret;
+    size_t i;
+
+    if( md_info == NULL )
+        return( MBEDTLS_ERR_MD_BAD_INPUT_DATA );
+
+    if( md_info->digest_multi_func != NULL )
+        return( md_info->digest_multi_func( input, ilen, output, count ) );
+
+    for( i = 0; i < count; i++ )
+    {
+        if( ( ret = md_info->digest_func( input[i], ilen[i],
+                                          output[i] ) ) != 0 )
+            return( ret );
+    }
+
+    return( 0 );
+}
+
 #if defined(MBEDTLS_FS_IO)
 int mbedtls_md_file( const mbedtls_md_info_t *md_info, const char *path, unsigned char *output )
 {
@@ -395,6 +504,96 @@ int mbedtls_md_hmac_finish( mbedtls_md_context_t *ctx, unsigned char *output )
     return( ctx->md_info->finish_func( ctx->md_ctx, output ) );
 }
 
+/*
+ * Both the inner and the outer hashes go through finish_multi_func: the
+ * outer hash of each context is fed opad || inner digest in one piece.
+ */
+int mbedtls_md_hmac_finish_multi( mbedtls_md_context_t * const ctx[],
+                                  const unsigned char * const input[],
+                                  const size_t ilen[],
+                                  unsigned char * const output[],
+                                  size_t count )
+{
+    int ret = 0;
+    const mbedtls_md_info_t *md_info;
+    unsigned char inner[MD_MULTI_CHUNK][MBEDTLS_MD_MAX_SIZE];
+    unsigned char outer[MD_MULTI_CHUNK][MD_MAX_BLOCK_SIZE + MBEDTLS_MD_MAX_SIZE];
+    unsigned char *inner_p[MD_MULTI_CHUNK];
+    const unsigned char *outer_p[MD_MULTI_CHUNK];
+    size_t outer_len[MD_MULTI_CHUNK];
+    size_t i, n, block_size, size;
+
+    if( count == 0 )
+        return( 0 );
+
+    if( ( md_info = md_multi_info( ctx, count ) ) == NULL )
+        return( MBEDTLS_ERR_MD_BAD_INPUT_DATA );
+
+    for( i = 0; i < count; i++ )
+    {
+        if( ctx[i]->hmac_ctx == NULL )
+            return( MBEDTLS_ERR_MD_BAD_INPUT_DATA );
+    }
+
+    if( md_info->finish_multi_func == NULL )
+    {
+        for( i = 0; i < count; i++ )
+        {
+            if( ( ret = mbedtls_md_hmac_update( ctx[i], input[i],
+                                                ilen[i] ) ) != 0 )
+                return( ret );
+            if( ( ret = mbedtls_md_hmac_finish( ctx[i], output[i] ) ) != 0 )
+                return( ret );
+        }
+
+        return( 0 );
+    }
+
+    block_size = md_info->block_size;
+    size = md_info->size;
+
+    for( i = 0; i < MD_MULTI_CHUNK; i++ )
+    {
+        inner_p[i] = inner[i];
+        outer_p[i] = outer[i];
+        outer_len[i] = block_size + size;
+    }
+
+    for( ; count > 0; count -= n )
+    {
+        n = count < MD_MULTI_CHUNK ? count : MD_MULTI_CHUNK;
+
+        if( ( ret = mbedtls_md_finish_multi( ctx, input, ilen,
+                                             inner_p, n ) ) != 0 )
+            goto cleanup;
+
+        for( i = 0; i < n; i++ )
+        {
+            memcpy( outer[i], (unsigned char *) ctx[i]->hmac_ctx + block_size,
+                    block_size );
+            memcpy( outer[i] + block_size, inner[i], size );
+
+            if( ( ret = md_info->starts_func( ctx[i]->md_ctx ) ) != 0 )
+                goto cleanup;
+        }
+
+        if( ( ret = mbedtls_md_finish_multi( ctx, outer_p, outer_len,
+                                             output, n ) ) != 0 )
+            goto cleanup;
+
+        ctx += n;
+        input += n;
+        ilen += n;
+        output += n;
+    }
+
+cleanup:
+    mbedtls_platform_zeroize( inner, sizeof( inner ) );
+    mbedtls_platform_zeroize( outer, sizeof( outer ) );
+
+    return( ret );
+}
+
 int mbedtls_md_hmac_reset( mbedtls_md_context_t *ctx )
 {
     int ret;
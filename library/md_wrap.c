@@ -129,6 +129,8 @@ const mbedtls_md_info_t mbedtls_md2_info = {
     md2_ctx_free,
     md2_clone_wrap,
     md2_process_wrap,
+    NULL,
+    NULL,
 };
 
 #endif /* MBEDTLS_MD2_C */
@@ -191,6 +193,8 @@ const mbedtls_md_info_t mbedtls_md4_info = {
     md4_ctx_free,
     md4_clone_wrap,
     md4_process_wrap,
+    NULL,
+    NULL,
 };
 
 #endif /* MBEDTLS_MD4_C */
@@ -253,6 +257,8 @@ const mbedtls_md_info_t mbedtls_md5_info = {
     md5_ctx_free,
     md5_clone_wrap,
     md5_process_wrap,
+    NULL,
+    NULL,
 };
 
 #endif /* MBEDTLS_MD5_C */
@@ -318,6 +324,8 @@ const mbedtls_md_info_t mbedtls_ripemd160_info = {
     ripemd160_ctx_free,
     ripemd160_clone_wrap,
     ripemd160_process_wrap,
+    NULL,
+    NULL,
 };
 
 #endif /* MBEDTLS_RIPEMD160_C */
@@ -369,6 +377,16 @@ static int sha1_process_wrap( void *ctx, const unsigned char *data )
                                            data ) );
 }
 
+static int sha1_finish_multi_wrap( void * const ctx[],
+                                   const unsigned char * const input[],
+                                   const size_t ilen[],
+                                   unsigned char * const output[],
+                                   size_t count )
+{
+    return( mbedtls_sha1_finish_multi( (mbedtls_sha1_context * const *) ctx,
+                                       input, ilen, output, count ) );
+}
+
 const mbedtls_md_info_t mbedtls_sha1_info = {
     MBEDTLS_MD_SHA1,
     "SHA1",
@@ -382,6 +400,8 @@ const mbedtls_md_info_t mbedtls_sha1_info = {
     sha1_ctx_free,
     sha1_clone_wrap,
     sha1_process_wrap,
+    sha1_finish_multi_wrap,
+    mbedtls_sha1_ret_multi,
 };
 
 #endif /* MBEDTLS_SHA1_C */
@@ -443,6 +463,24 @@ static int sha224_process_wrap( void *ctx, const unsigned char *data )
                                              data ) );
 }
 
+static int sha224_finish_multi_wrap( void * const ctx[],
+                                     const unsigned char * const input[],
+                                     const size_t ilen[],
+                                     unsigned char * const output[],
+                                     size_t count )
+{
+    return( mbedtls_sha256_finish_multi( (mbedtls_sha256_context * const *) ctx,
+                                         input, ilen, output, count ) );
+}
+
+static int sha224_multi_wrap( const unsigned char * const input[],
+                              const size_t ilen[],
+                              unsigned char * const output[],
+                              size_t count )
+{
+    return( mbedtls_sha256_ret_multi( input, ilen, output, count, 1 ) );
+}
+
 const mbedtls_md_info_t mbedtls_sha224_info = {
     MBEDTLS_MD_SHA224,
     "SHA224",
@@ -456,6 +494,8 @@ const mbedtls_md_info_t mbedtls_sha224_info = {
     sha224_ctx_free,
     sha224_clone_wrap,
     sha224_process_wrap,
+    sha224_finish_multi_wrap,
+    sha224_multi_wrap,
 };
 
 static int sha256_starts_wrap( void *ctx )
@@ -469,6 +509,14 @@ static int sha256_wrap( const unsigned char *input, size_t ilen,
     return( mbedtls_sha256_ret( input, ilen, output, 0 ) );
 }
 
+static int sha256_multi_wrap( const unsigned char * const input[],
+                              const size_t ilen[],
+                              unsigned char * const output[],
+                              size_t count )
+{
+    return( mbedtls_sha256_ret_multi( input, ilen, output, count, 0 ) );
+}
+
 const mbedtls_md_info_t mbedtls_sha256_info = {
     MBEDTLS_MD_SHA256,
     "SHA256",
@@ -482,6 +530,8 @@ const mbedtls_md_info_t mbedtls_sha256_info = {
     sha224_ctx_free,
     sha224_clone_wrap,
     sha224_process_wrap,
+    sha224_finish_multi_wrap,
+    sha256_multi_wrap,
 };
 
 #endif /* MBEDTLS_SHA256_C */
@@ -553,6 +603,8 @@ const mbedtls_md_info_t mbedtls_sha384_info = {
     sha384_ctx_free,
     sha384_clone_wrap,
     sha384_process_wrap,
+    NULL,
+    NULL,
 };
 
 static int sha512_starts_wrap( void *ctx )
@@ -579,6 +631,8 @@ const mbedtls_md_info_t mbedtls_sha512_info = {
     sha384_ctx_free,
     sha384_clone_wrap,
     sha384_process_wrap,
+    NULL,
+    NULL,
 };
 
 #endif /* MBEDTLS_SHA512_C */
@@ -39,6 +39,15 @@
 
 #include "mbedtls/nist_kw.h"
 #include "mbedtls/platform_util.h"
+#include "mbedtls/cipher_internal.h"
+
+#if defined(MBEDTLS_AES_C)
+#include "mbedtls/aes.h"
+#endif
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include "mbedtls/threading.h"
+#endif
 
 #include <stdint.h>
 #include <string.h>
@@ -179,28 +188,16 @@ static void calc_a_xor_t( unsigned char A[KW_SEMIBLOCK_LENGTH], uint64_t t )
 }
 
 /*
- * KW-AE as defined in SP 800-38F section 6.2
- * KWP-AE as defined in SP 800-38F section 6.3
+ * Check the lengths of a wrap and generate the string to work on in output:
+ * the ICV followed by the plaintext, with the length and padding for KWP.
  */
-int mbedtls_nist_kw_wrap( mbedtls_nist_kw_context *ctx,
-                          mbedtls_nist_kw_mode_t mode,
-                          const unsigned char *input, size_t in_len,
-                          unsigned char *output, size_t *out_len, size_t out_size )
+static int kw_wrap_format( mbedtls_nist_kw_mode_t mode,
+                           const unsigned char *input, size_t in_len,
+                           unsigned char *output, size_t out_size,
+                           size_t *semiblocks )
 {
-    int ret = 0;
-    size_t semiblocks = 0;
-    size_t s;
-    size_t olen, padlen = 0;
-    uint64_t t = 0;
-    unsigned char outbuff[KW_SEMIBLOCK_LENGTH * 2];
-    unsigned char inbuff[KW_SEMIBLOCK_LENGTH * 2];
-    unsigned char *R2 = output + KW_SEMIBLOCK_LENGTH;
-    unsigned char *A = output;
+    size_t padlen = 0;
 
-    *out_len = 0;
-    /*
-     * Generate the String to work on
-     */
     if( mode == MBEDTLS_KW_MODE_KW )
     {
         if( out_size < in_len + KW_SEMIBLOCK_LENGTH )
@@ -256,7 +253,37 @@ int mbedtls_nist_kw_wrap( mbedtls_nist_kw_context *ctx,
         memcpy( output + KW_SEMIBLOCK_LENGTH, input, in_len );
         memset( output + KW_SEMIBLOCK_LENGTH + in_len, 0, padlen );
     }
-    semiblocks = ( ( in_len + padlen ) / KW_SEMIBLOCK_LENGTH ) + 1;
+    *semiblocks = ( ( in_len + padlen ) / KW_SEMIBLOCK_LENGTH ) + 1;
+
+    return( 0 );
+}
+
+/*
+ * KW-AE as defined in SP 800-38F section 6.2
+ * KWP-AE as defined in SP 800-38F section 6.3
+ */
+int mbedtls_nist_kw_wrap( mbedtls_nist_kw_context *ctx,
+                          mbedtls_nist_kw_mode_t mode,
+                          const unsigned char *input, size_t in_len,
+                          unsigned char *output, size_t *out_len, size_t out_size )
+{
+    int ret = 0;
+    size_t semiblocks = 0;
+    size_t s;
+    size_t olen;
+    uint64_t t = 0;
+    unsigned char outbuff[KW_SEMIBLOCK_LENGTH * 2];
+    unsigned char inbuff[KW_SEMIBLOCK_LENGTH * 2];
+    unsigned char *R2 = output + KW_SEMIBLOCK_LENGTH;
+    unsigned char *A = output;
+
+    *out_len = 0;
+    /*
+     * Generate the String to work on
+     */
+    ret = kw_wrap_format( mode, input, in_len, output, out_size, &semiblocks );
+    if( ret != 0 )
+        return( ret );
 
     s = 6 * ( semiblocks - 1 );
 
@@ -381,20 +408,11 @@ cleanup:
 }
 
 /*
- * KW-AD as defined in SP 800-38F section 6.2
- * KWP-AD as defined in SP 800-38F section 6.3
+ * Check the lengths of an unwrap
  */
-int mbedtls_nist_kw_unwrap( mbedtls_nist_kw_context *ctx,
-                            mbedtls_nist_kw_mode_t mode,
-                            const unsigned char *input, size_t in_len,
-                            unsigned char *output, size_t *out_len, size_t out_size )
+static int kw_unwrap_check( mbedtls_nist_kw_mode_t mode,
+                            size_t in_len, size_t out_size )
 {
-    int ret = 0;
-    size_t i, olen;
-    unsigned char A[KW_SEMIBLOCK_LENGTH];
-    unsigned char diff, bad_padding = 0;
-
-    *out_len = 0;
     if( out_size < in_len - KW_SEMIBLOCK_LENGTH )
     {
         return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
@@ -414,26 +432,9 @@ int mbedtls_nist_kw_unwrap( mbedtls_nist_kw_context *ctx,
         {
             return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
         }
-
-        ret = unwrap( ctx, input, in_len / KW_SEMIBLOCK_LENGTH,
-                      A, output, out_len );
-        if( ret != 0 )
-            goto cleanup;
-
-        /* Check ICV in "constant-time" */
-        diff = mbedtls_nist_kw_safer_memcmp( NIST_KW_ICV1, A, KW_SEMIBLOCK_LENGTH );
-
-        if( diff != 0 )
-        {
-            ret = MBEDTLS_ERR_CIPHER_AUTH_FAILED;
-            goto cleanup;
-        }
-
     }
     else if( mode == MBEDTLS_KW_MODE_KWP )
     {
-        size_t padlen = 0;
-        uint32_t Plen;
         /*
          * According to SP 800-38F Table 1, the ciphertext length for KWP
          * must be between 2 to 2^29 semiblocks inclusive.
@@ -446,28 +447,42 @@ int mbedtls_nist_kw_unwrap( mbedtls_nist_kw_context *ctx,
         {
             return(  MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
         }
+    }
+    else
+    {
+        return( MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE );
+    }
 
-        if( in_len == KW_SEMIBLOCK_LENGTH * 2 )
-        {
-            unsigned char outbuff[KW_SEMIBLOCK_LENGTH * 2];
-            ret = mbedtls_cipher_update( &ctx->cipher_ctx,
-                                         input, 16, outbuff, &olen );
-            if( ret != 0 )
-                goto cleanup;
+    return( 0 );
+}
 
-            memcpy( A, outbuff, KW_SEMIBLOCK_LENGTH );
-            memcpy( output, outbuff + KW_SEMIBLOCK_LENGTH, KW_SEMIBLOCK_LENGTH );
-            mbedtls_platform_zeroize( outbuff, sizeof( outbuff ) );
-            *out_len = KW_SEMIBLOCK_LENGTH;
-        }
-        else
+/*
+ * Check the ICV of an unwrapped string, and for KWP its length and padding.
+ * On success, *out_len is set to the length of the plaintext.
+ */
+static int kw_unwrap_verify( mbedtls_nist_kw_mode_t mode,
+                             const unsigned char A[KW_SEMIBLOCK_LENGTH],
+                             size_t in_len, unsigned char *output,
+                             size_t *out_len )
+{
+    int ret = 0;
+    size_t i;
+    unsigned char diff, bad_padding = 0;
+
+    if( mode == MBEDTLS_KW_MODE_KW )
+    {
+        /* Check ICV in "constant-time" */
+        diff = mbedtls_nist_kw_safer_memcmp( NIST_KW_ICV1, A, KW_SEMIBLOCK_LENGTH );
+
+        if( diff != 0 )
         {
-            /* in_len >=  KW_SEMIBLOCK_LENGTH * 3 */
-            ret = unwrap( ctx, input, in_len / KW_SEMIBLOCK_LENGTH,
-                          A, output, out_len );
-            if( ret != 0 )
-                goto cleanup;
+            ret = MBEDTLS_ERR_CIPHER_AUTH_FAILED;
         }
+    }
+    else
+    {
+        size_t padlen = 0;
+        uint32_t Plen;
 
         /* Check ICV in "constant-time" */
         diff = mbedtls_nist_kw_safer_memcmp( NIST_KW_ICV2, A, KW_SEMIBLOCK_LENGTH / 2 );
@@ -505,19 +520,61 @@ int mbedtls_nist_kw_unwrap( mbedtls_nist_kw_context *ctx,
             ret = MBEDTLS_ERR_CIPHER_AUTH_FAILED;
         }
 
-        if( ret != 0 )
+        if( ret == 0 )
         {
-            goto cleanup;
+            memset( output + Plen, 0, padlen );
+            *out_len = Plen;
         }
-        memset( output + Plen, 0, padlen );
-        *out_len = Plen;
+    }
+
+    mbedtls_platform_zeroize( &bad_padding, sizeof( bad_padding) );
+    mbedtls_platform_zeroize( &diff, sizeof( diff ) );
+    return( ret );
+}
+
+/*
+ * KW-AD as defined in SP 800-38F section 6.2
+ * KWP-AD as defined in SP 800-38F section 6.3
+ */
+int mbedtls_nist_kw_unwrap( mbedtls_nist_kw_context *ctx,
+                            mbedtls_nist_kw_mode_t mode,
+                            const unsigned char *input, size_t in_len,
+                            unsigned char *output, size_t *out_len, size_t out_size )
+{
+    int ret = 0;
+    size_t olen;
+    unsigned char A[KW_SEMIBLOCK_LENGTH];
+
+    *out_len = 0;
+    if( ( ret = kw_unwrap_check( mode, in_len, out_size ) ) != 0 )
+    {
+        return( ret );
+    }
+
+    if( mode == MBEDTLS_KW_MODE_KWP && in_len == KW_SEMIBLOCK_LENGTH * 2 )
+    {
+        unsigned char outbuff[KW_SEMIBLOCK_LENGTH * 2];
+        ret = mbedtls_cipher_update( &ctx->cipher_ctx,
+                                     input, 16, outbuff, &olen );
+        if( ret != 0 )
+            goto cleanup;
+
+        memcpy( A, outbuff, KW_SEMIBLOCK_LENGTH );
+        memcpy( output, outbuff + KW_SEMIBLOCK_LENGTH, KW_SEMIBLOCK_LENGTH );
+        mbedtls_platform_zeroize( outbuff, sizeof( outbuff ) );
+        *out_len = KW_SEMIBLOCK_LENGTH;
     }
     else
     {
-        ret = MBEDTLS_ERR_CIPHER_FEATURE_UNAVAILABLE;
-        goto cleanup;
+        /* in_len >=  KW_SEMIBLOCK_LENGTH * 3 */
+        ret = unwrap( ctx, input, in_len / KW_SEMIBLOCK_LENGTH,
+                      A, output, out_len );
+        if( ret != 0 )
+            goto cleanup;
     }
 
+    ret = kw_unwrap_verify( mode, A, in_len, output, out_len );
+
 cleanup:
     if( ret != 0 )
     {
@@ -525,13 +582,332 @@ cleanup:
         *out_len = 0;
     }
 
-    mbedtls_platform_zeroize( &bad_padding, sizeof( bad_padding) );
-    mbedtls_platform_zeroize( &diff, sizeof( diff ) );
     mbedtls_platform_zeroize( A, sizeof( A ) );
     mbedtls_cipher_finish( &ctx->cipher_ctx, NULL, &olen );
     return( ret );
 }
 
+/* Number of wraps or unwraps processed side by side by the batch functions */
+#define KW_LANES    8
+
+/*
+ * Run the block cipher on n consecutive blocks of buf, in place, in the
+ * direction the context was set up for, several at a time with AES
+ */
+static int kw_crypt_blocks( mbedtls_nist_kw_context *ctx,
+                            unsigned char *buf, size_t n )
+{
+    int ret;
+    size_t i, olen;
+
+#if defined(MBEDTLS_AES_C)
+    int use_aes = ( ctx->cipher_ctx.cipher_info->base->cipher ==
+                    MBEDTLS_CIPHER_ID_AES );
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    use_aes = use_aes && ctx->cipher_ctx.psa_enabled == 0;
+#endif
+    if( use_aes )
+    {
+        if( ctx->cipher_ctx.operation == MBEDTLS_ENCRYPT )
+            return( mbedtls_aes_encrypt_blocks( ctx->cipher_ctx.cipher_ctx,
+                                                n, buf, buf ) );
+        else
+            return( mbedtls_aes_decrypt_blocks( ctx->cipher_ctx.cipher_ctx,
+                                                n, buf, buf ) );
+    }
+#endif /* MBEDTLS_AES_C */
+
+    for( i = 0; i < n; i++, buf += 16 )
+    {
+        if( ( ret = mbedtls_cipher_update( &ctx->cipher_ctx, buf, 16, buf,
+                                           &olen ) ) != 0 )
+            return( ret );
+    }
+
+    return( 0 );
+}
+
+/*
+ * Up to KW_LANES wraps run the W function together: step j of every wrap
+ * that still has one is packed into a buffer and encrypted in one call.
+ * A KWP plaintext of one semiblock takes a single step, without t.
+ */
+int mbedtls_nist_kw_wrap_multi( mbedtls_nist_kw_context *ctx,
+                                mbedtls_nist_kw_mode_t mode,
+                                mbedtls_nist_kw_job *jobs, size_t count )
+{
+    unsigned char buf[KW_LANES * KW_SEMIBLOCK_LENGTH * 2];
+    mbedtls_nist_kw_job *job[KW_LANES];
+    unsigned char *R2[KW_LANES];
+    size_t semiblocks[KW_LANES], steps[KW_LANES];
+    size_t batch, i, lanes, lane, n, j, max_steps;
+    int ret = 0, first_ret = 0;
+
+    if( count > 0 && jobs == NULL )
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+
+    for( ; count > 0; count -= batch, jobs += batch )
+    {
+        batch = count < KW_LANES ? count : KW_LANES;
+        lanes = 0;
+        max_steps = 0;
+
+        for( i = 0; i < batch; i++ )
+        {
+            jobs[i].out_len = 0;
+            jobs[i].ret = kw_wrap_format( mode, jobs[i].input, jobs[i].in_len,
+                                          jobs[i].output, jobs[i].out_size,
+                                          &semiblocks[lanes] );
+            if( jobs[i].ret != 0 )
+                continue;
+
+            job[lanes] = &jobs[i];
+            R2[lanes] = jobs[i].output + KW_SEMIBLOCK_LENGTH;
+            steps[lanes] = semiblocks[lanes] == 2 ?
+                           1 : 6 * ( semiblocks[lanes] - 1 );
+            if( steps[lanes] > max_steps )
+                max_steps = steps[lanes];
+            lanes++;
+        }
+
+        for( j = 0; j < max_steps; j++ )
+        {
+            for( lane = 0, n = 0; lane < lanes; lane++ )
+            {
+                if( j >= steps[lane] )
+                    continue;
+
+                memcpy( buf + n * 16, job[lane]->output, KW_SEMIBLOCK_LENGTH );
+                memcpy( buf + n * 16 + KW_SEMIBLOCK_LENGTH, R2[lane],
+                        KW_SEMIBLOCK_LENGTH );
+                n++;
+            }
+
+            if( ( ret = kw_crypt_blocks( ctx, buf, n ) ) != 0 )
+            {
+                for( lane = 0; lane < lanes; lane++ )
+                {
+                    memset( job[lane]->output, 0,
+                            semiblocks[lane] * KW_SEMIBLOCK_LENGTH );
+                    job[lane]->ret = ret;
+                }
+                goto cleanup;
+            }
+
+            for( lane = 0, n = 0; lane < lanes; lane++ )
+            {
+                if( j >= steps[lane] )
+                    continue;
+
+                memcpy( job[lane]->output, buf + n * 16, KW_SEMIBLOCK_LENGTH );
+                if( semiblocks[lane] > 2 )
+                    calc_a_xor_t( job[lane]->output, j + 1 );
+
+                memcpy( R2[lane], buf + n * 16 + KW_SEMIBLOCK_LENGTH,
+                        KW_SEMIBLOCK_LENGTH );
+                R2[lane] += KW_SEMIBLOCK_LENGTH;
+                if( R2[lane] >= job[lane]->output +
+                                semiblocks[lane] * KW_SEMIBLOCK_LENGTH )
+                    R2[lane] = job[lane]->output + KW_SEMIBLOCK_LENGTH;
+                n++;
+            }
+        }
+
+        for( lane = 0; lane < lanes; lane++ )
+            job[lane]->out_len = semiblocks[lane] * KW_SEMIBLOCK_LENGTH;
+
+        for( i = 0; i < batch && first_ret == 0; i++ )
+            first_ret = jobs[i].ret;
+    }
+
+    ret = first_ret;
+
+cleanup:
+    mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    return( ret );
+}
+
+/*
+ * The unwraps run the W-1 function together in the same way, each with
+ * its own count of steps. A is kept apart from the output, which receives
+ * the rest of the ciphertext.
+ */
+int mbedtls_nist_kw_unwrap_multi( mbedtls_nist_kw_context *ctx,
+                                  mbedtls_nist_kw_mode_t mode,
+                                  mbedtls_nist_kw_job *jobs, size_t count )
+{
+    unsigned char buf[KW_LANES * KW_SEMIBLOCK_LENGTH * 2];
+    unsigned char A[KW_LANES][KW_SEMIBLOCK_LENGTH];
+    mbedtls_nist_kw_job *job[KW_LANES];
+    unsigned char *R[KW_LANES];
+    size_t semiblocks[KW_LANES], steps[KW_LANES];
+    size_t batch, i, lanes, lane, n, j, max_steps;
+    int ret = 0, first_ret = 0;
+
+    if( count > 0 && jobs == NULL )
+        return( MBEDTLS_ERR_CIPHER_BAD_INPUT_DATA );
+
+    for( ; count > 0; count -= batch, jobs += batch )
+    {
+        batch = count < KW_LANES ? count : KW_LANES;
+        lanes = 0;
+        max_steps = 0;
+
+        for( i = 0; i < batch; i++ )
+        {
+            jobs[i].out_len = 0;
+            jobs[i].ret = kw_unwrap_check( mode, jobs[i].in_len,
+                                           jobs[i].out_size );
+            if( jobs[i].ret != 0 )
+                continue;
+
+            job[lanes] = &jobs[i];
+            semiblocks[lanes] = jobs[i].in_len / KW_SEMIBLOCK_LENGTH;
+            memcpy( A[lanes], jobs[i].input, KW_SEMIBLOCK_LENGTH );
+            memmove( jobs[i].output, jobs[i].input + KW_SEMIBLOCK_LENGTH,
+                     jobs[i].in_len - KW_SEMIBLOCK_LENGTH );
+            R[lanes] = jobs[i].output +
+                       ( semiblocks[lanes] - 2 ) * KW_SEMIBLOCK_LENGTH;
+            steps[lanes] = semiblocks[lanes] == 2 ?
+                           1 : 6 * ( semiblocks[lanes] - 1 );
+            if( steps[lanes] > max_steps )
+                max_steps = steps[lanes];
+            lanes++;
+        }
+
+        for( j = 0; j < max_steps; j++ )
+        {
+            for( lane = 0, n = 0; lane < lanes; lane++ )
+            {
+                if( j >= steps[lane] )
+                    continue;
+
+                if( semiblocks[lane] > 2 )
+                    calc_a_xor_t( A[lane], steps[lane] - j );
+
+                memcpy( buf + n * 16, A[lane], KW_SEMIBLOCK_LENGTH );
+                memcpy( buf + n * 16 + KW_SEMIBLOCK_LENGTH, R[lane],
+                        KW_SEMIBLOCK_LENGTH );
+                n++;
+            }
+
+            if( ( ret = kw_crypt_blocks( ctx, buf, n ) ) != 0 )
+            {
+                for( lane = 0; lane < lanes; lane++ )
+                {
+                    memset( job[lane]->output, 0,
+                            job[lane]->in_len - KW_SEMIBLOCK_LENGTH );
+                    job[lane]->ret = ret;
+                }
+                goto cleanup;
+            }
+
+            for( lane = 0, n = 0; lane < lanes; lane++ )
+            {
+                if( j >= steps[lane] )
+                    continue;
+
+                memcpy( A[lane], buf + n * 16, KW_SEMIBLOCK_LENGTH );
+                memcpy( R[lane], buf + n * 16 + KW_SEMIBLOCK_LENGTH,
+                        KW_SEMIBLOCK_LENGTH );
+                if( R[lane] == job[lane]->output )
+                    R[lane] = job[lane]->output +
+                              ( semiblocks[lane] - 2 ) * KW_SEMIBLOCK_LENGTH;
+                else
+                    R[lane] -= KW_SEMIBLOCK_LENGTH;
+                n++;
+            }
+        }
+
+        for( lane = 0; lane < lanes; lane++ )
+        {
+            job[lane]->out_len = ( semiblocks[lane] - 1 ) * KW_SEMIBLOCK_LENGTH;
+            job[lane]->ret = kw_unwrap_verify( mode, A[lane], job[lane]->in_len,
+                                               job[lane]->output,
+                                               &job[lane]->out_len );
+            if( job[lane]->ret != 0 )
+            {
+                memset( job[lane]->output, 0, job[lane]->out_len );
+                job[lane]->out_len = 0;
+            }
+        }
+
+        for( i = 0; i < batch && first_ret == 0; i++ )
+            first_ret = jobs[i].ret;
+    }
+
+    ret = first_ret;
+
+cleanup:
+    mbedtls_platform_zeroize( buf, sizeof( buf ) );
+    mbedtls_platform_zeroize( A, sizeof( A ) );
+    return( ret );
+}
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+typedef struct
+{
+    mbedtls_nist_kw_context *ctx;
+    mbedtls_nist_kw_mode_t mode;
+    mbedtls_nist_kw_job *jobs;
+} nist_kw_share;
+
+static int nist_kw_wrap_share( void *arg, size_t first, size_t n )
+{
+    nist_kw_share *share = (nist_kw_share *) arg;
+
+    return( mbedtls_nist_kw_wrap_multi( share->ctx, share->mode,
+                                        share->jobs + first, n ) );
+}
+
+static int nist_kw_unwrap_share( void *arg, size_t first, size_t n )
+{
+    nist_kw_share *share = (nist_kw_share *) arg;
+
+    return( mbedtls_nist_kw_unwrap_multi( share->ctx, share->mode,
+                                          share->jobs + first, n ) );
+}
+
+static int nist_kw_multi_threads( mbedtls_nist_kw_context *ctx,
+                                  mbedtls_nist_kw_mode_t mode,
+                                  int (*fn)( void *, size_t, size_t ),
+                                  mbedtls_nist_kw_job *jobs, size_t count,
+                                  unsigned int threads )
+{
+    nist_kw_share share;
+
+#if defined(MBEDTLS_USE_PSA_CRYPTO)
+    /* A PSA operation cannot be shared between threads */
+    if( ctx->cipher_ctx.psa_enabled != 0 )
+        threads = 1;
+#endif
+
+    share.ctx = ctx;
+    share.mode = mode;
+    share.jobs = jobs;
+
+    return( mbedtls_threading_split( fn, &share, count, threads ) );
+}
+
+int mbedtls_nist_kw_wrap_multi_threads( mbedtls_nist_kw_context *ctx,
+                                        mbedtls_nist_kw_mode_t mode,
+                                        mbedtls_nist_kw_job *jobs, size_t count,
+                                        unsigned int threads )
+{
+    return( nist_kw_multi_threads( ctx, mode, nist_kw_wrap_share,
+                                   jobs, count, threads ) );
+}
+
+int mbedtls_nist_kw_unwrap_multi_threads( mbedtls_nist_kw_context *ctx,
+                                          mbedtls_nist_kw_mode_t mode,
+                                          mbedtls_nist_kw_job *jobs,
+                                          size_t count, unsigned int threads )
+{
+    return( nist_kw_multi_threads( ctx, mode, nist_kw_unwrap_share,
+                                   jobs, count, threads ) );
+}
+#endif /* MBEDTLS_THREADING_PTHREAD */
+
 #endif /* !MBEDTLS_NIST_KW_ALT */
 
 #if defined(MBEDTLS_SELF_TEST) && defined(MBEDTLS_AES_C)
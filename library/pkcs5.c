@@ -38,6 +38,12 @@
 #if defined(MBEDTLS_PKCS5_C)
 
 #include "mbedtls/pkcs5.h"
+#include "mbedtls/md_internal.h"
+#include "mbedtls/platform_util.h"
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include "mbedtls/threading.h"
+#endif
 
 #if defined(MBEDTLS_ASN1_PARSE_C)
 #include "mbedtls/asn1.h"
@@ -232,78 +238,279 @@ exit:
 }
 #endif /* MBEDTLS_ASN1_PARSE_C */
 
+/*
+ * Number of output blocks T_i computed side by side, so that
+ * mbedtls_md_finish_multi() can hash them in parallel
+ */
+#define PKCS5_PBKDF2_LANES  8
+
 int mbedtls_pkcs5_pbkdf2_hmac( mbedtls_md_context_t *ctx, const unsigned char *password,
                        size_t plen, const unsigned char *salt, size_t slen,
                        unsigned int iteration_count,
                        uint32_t key_length, unsigned char *output )
 {
-    int ret, j;
-    unsigned int i;
-    unsigned char md1[MBEDTLS_MD_MAX_SIZE];
-    unsigned char work[MBEDTLS_MD_MAX_SIZE];
-    unsigned char md_size = mbedtls_md_get_size( ctx->md_info );
-    size_t use_len;
-    unsigned char *out_p = output;
-    unsigned char counter[4];
+    return( mbedtls_pkcs5_pbkdf2_hmac_part( ctx, password, plen, salt, slen,
+                                            iteration_count, 0,
+                                            key_length, output ) );
+}
 
-    memset( counter, 0, 4 );
-    counter[3] = 1;
+int mbedtls_pkcs5_pbkdf2_hmac_part( mbedtls_md_context_t *ctx,
+                                    const unsigned char *password,
+                                    size_t plen,
+                                    const unsigned char *salt, size_t slen,
+                                    unsigned int iteration_count,
+                                    uint32_t first_block,
+                                    uint32_t key_length,
+                                    unsigned char *output )
+{
+    int ret = 0;
+    unsigned int i;
+    size_t j, l, n, nlanes, nblocks;
+    const mbedtls_md_info_t *md_info;
+    mbedtls_md_context_t octx;
+    mbedtls_md_context_t lanes[PKCS5_PBKDF2_LANES];
+    mbedtls_md_context_t *plane[PKCS5_PBKDF2_LANES];
+    unsigned char work[PKCS5_PBKDF2_LANES][MBEDTLS_MD_MAX_SIZE];
+    unsigned char md1[PKCS5_PBKDF2_LANES][MBEDTLS_MD_MAX_SIZE];
+    unsigned char inner[PKCS5_PBKDF2_LANES][MBEDTLS_MD_MAX_SIZE];
+    unsigned char counter[PKCS5_PBKDF2_LANES][4];
+    const unsigned char *in[PKCS5_PBKDF2_LANES];
+    unsigned char *out[PKCS5_PBKDF2_LANES];
+    size_t len[PKCS5_PBKDF2_LANES];
+    unsigned char md_size;
+    uint32_t block;
+
+    if( ctx == NULL || ctx->md_info == NULL || ctx->hmac_ctx == NULL )
+        return( MBEDTLS_ERR_PKCS5_BAD_INPUT_DATA );
 
 #if UINT_MAX > 0xFFFFFFFF
     if( iteration_count > 0xFFFFFFFF )
         return( MBEDTLS_ERR_PKCS5_BAD_INPUT_DATA );
 #endif
 
+    md_info = ctx->md_info;
+    md_size = mbedtls_md_get_size( md_info );
+    nblocks = key_length / md_size + ( key_length % md_size != 0 );
+
+    /* Block indices are 32-bit and start at 1 */
+    if( nblocks > 0xFFFFFFFF - (size_t) first_block )
+        return( MBEDTLS_ERR_PKCS5_BAD_INPUT_DATA );
+
+    if( key_length == 0 )
+        return( 0 );
+
+    nlanes = nblocks < PKCS5_PBKDF2_LANES ? nblocks : PKCS5_PBKDF2_LANES;
+
+    mbedtls_md_init( &octx );
+    for( l = 0; l < PKCS5_PBKDF2_LANES; l++ )
+    {
+        mbedtls_md_init( &lanes[l] );
+        plane[l] = &lanes[l];
+    }
+
+    /*
+     * The key is the same for every HMAC invocation: ctx keeps the state
+     * after absorbing K ^ ipad and octx the one after K ^ opad. Each HMAC
+     * then costs two clones and two final digests.
+     */
+    if( ( ret = mbedtls_md_hmac_starts( ctx, password, plen ) ) != 0 ||
+        ( ret = mbedtls_md_setup( &octx, md_info, 0 ) ) != 0 ||
+        ( ret = mbedtls_md_starts( &octx ) ) != 0 ||
+        ( ret = mbedtls_md_update( &octx, (unsigned char *) ctx->hmac_ctx +
+                                   md_info->block_size,
+                                   md_info->block_size ) ) != 0 )
+        goto exit;
+
+    for( l = 0; l < nlanes; l++ )
+    {
+        if( ( ret = mbedtls_md_setup( &lanes[l], md_info, 0 ) ) != 0 )
+            goto exit;
+    }
+
+    block = first_block;
+
     while( key_length )
     {
+        n = key_length / md_size + ( key_length % md_size != 0 );
+        if( n > nlanes )
+            n = nlanes;
+
         // U1 ends up in work
         //
-        if( ( ret = mbedtls_md_hmac_starts( ctx, password, plen ) ) != 0 )
-            return( ret );
+        for( l = 0; l < n; l++ )
+        {
+            block++;
+            counter[l][0] = (unsigned char)( block >> 24 );
+            counter[l][1] = (unsigned char)( block >> 16 );
+            counter[l][2] = (unsigned char)( block >>  8 );
+            counter[l][3] = (unsigned char)( block       );
+
+            if( ( ret = mbedtls_md_clone( &lanes[l], ctx ) ) != 0 ||
+                ( ret = mbedtls_md_update( &lanes[l], salt, slen ) ) != 0 )
+                goto exit;
+
+            in[l] = counter[l];
+            len[l] = 4;
+            out[l] = inner[l];
+        }
 
-        if( ( ret = mbedtls_md_hmac_update( ctx, salt, slen ) ) != 0 )
-            return( ret );
+        if( ( ret = mbedtls_md_finish_multi( plane, in, len, out, n ) ) != 0 )
+            goto exit;
 
-        if( ( ret = mbedtls_md_hmac_update( ctx, counter, 4 ) ) != 0 )
-            return( ret );
+        for( l = 0; l < n; l++ )
+        {
+            if( ( ret = mbedtls_md_clone( &lanes[l], &octx ) ) != 0 )
+                goto exit;
 
-        if( ( ret = mbedtls_md_hmac_finish( ctx, work ) ) != 0 )
-            return( ret );
+            in[l] = inner[l];
+            len[l] = md_size;
+            out[l] = work[l];
+        }
+
+        if( ( ret = mbedtls_md_finish_multi( plane, in, len, out, n ) ) != 0 )
+            goto exit;
 
-        memcpy( md1, work, md_size );
+        for( l = 0; l < n; l++ )
+            memcpy( md1[l], work[l], md_size );
 
         for( i = 1; i < iteration_count; i++ )
         {
             // U2 ends up in md1
             //
-            if( ( ret = mbedtls_md_hmac_starts( ctx, password, plen ) ) != 0 )
-                return( ret );
+            for( l = 0; l < n; l++ )
+            {
+                if( ( ret = mbedtls_md_clone( &lanes[l], ctx ) ) != 0 )
+                    goto exit;
+
+                in[l] = md1[l];
+                out[l] = inner[l];
+            }
 
-            if( ( ret = mbedtls_md_hmac_update( ctx, md1, md_size ) ) != 0 )
-                return( ret );
+            if( ( ret = mbedtls_md_finish_multi( plane, in, len, out,
+                                                 n ) ) != 0 )
+                goto exit;
 
-            if( ( ret = mbedtls_md_hmac_finish( ctx, md1 ) ) != 0 )
-                return( ret );
+            for( l = 0; l < n; l++ )
+            {
+                if( ( ret = mbedtls_md_clone( &lanes[l], &octx ) ) != 0 )
+                    goto exit;
+
+                in[l] = inner[l];
+                out[l] = md1[l];
+            }
+
+            if( ( ret = mbedtls_md_finish_multi( plane, in, len, out,
+                                                 n ) ) != 0 )
+                goto exit;
 
             // U1 xor U2
             //
-            for( j = 0; j < md_size; j++ )
-                work[j] ^= md1[j];
+            for( l = 0; l < n; l++ )
+                for( j = 0; j < md_size; j++ )
+                    work[l][j] ^= md1[l][j];
         }
 
-        use_len = ( key_length < md_size ) ? key_length : md_size;
-        memcpy( out_p, work, use_len );
-
-        key_length -= (uint32_t) use_len;
-        out_p += use_len;
+        for( l = 0; l < n; l++ )
+        {
+            j = ( key_length < md_size ) ? key_length : md_size;
+            memcpy( output, work[l], j );
 
-        for( i = 4; i > 0; i-- )
-            if( ++counter[i - 1] != 0 )
-                break;
+            key_length -= (uint32_t) j;
+            output += j;
+        }
     }
 
-    return( 0 );
+exit:
+    mbedtls_md_free( &octx );
+    for( l = 0; l < PKCS5_PBKDF2_LANES; l++ )
+        mbedtls_md_free( &lanes[l] );
+
+    mbedtls_platform_zeroize( work, sizeof( work ) );
+    mbedtls_platform_zeroize( md1, sizeof( md1 ) );
+    mbedtls_platform_zeroize( inner, sizeof( inner ) );
+
+    return( ret );
+}
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+typedef struct
+{
+    const mbedtls_md_info_t *md_info;
+    const unsigned char *password;
+    size_t plen;
+    const unsigned char *salt;
+    size_t slen;
+    unsigned int iteration_count;
+    uint32_t key_length;
+    unsigned char *output;
+} pkcs5_pbkdf2_share;
+
+/*
+ * Derive groups first to first + n - 1 of PKCS5_PBKDF2_LANES blocks
+ */
+static int pkcs5_pbkdf2_share_run( void *arg, size_t first, size_t n )
+{
+    int ret;
+    pkcs5_pbkdf2_share *share = (pkcs5_pbkdf2_share *) arg;
+    mbedtls_md_context_t ctx;
+    size_t group = (size_t) PKCS5_PBKDF2_LANES *
+                   mbedtls_md_get_size( share->md_info );
+    size_t start = first * group;
+    size_t len = n * group;
+
+    if( len > share->key_length - start )
+        len = share->key_length - start;
+
+    mbedtls_md_init( &ctx );
+
+    if( ( ret = mbedtls_md_setup( &ctx, share->md_info, 1 ) ) != 0 )
+        goto exit;
+
+    ret = mbedtls_pkcs5_pbkdf2_hmac_part( &ctx, share->password, share->plen,
+                                          share->salt, share->slen,
+                                          share->iteration_count,
+                                          (uint32_t)( first *
+                                                      PKCS5_PBKDF2_LANES ),
+                                          (uint32_t) len,
+                                          share->output + start );
+
+exit:
+    mbedtls_md_free( &ctx );
+
+    return( ret );
+}
+
+int mbedtls_pkcs5_pbkdf2_hmac_threads( const mbedtls_md_info_t *md_info,
+                                       const unsigned char *password,
+                                       size_t plen,
+                                       const unsigned char *salt, size_t slen,
+                                       unsigned int iteration_count,
+                                       uint32_t key_length,
+                                       unsigned char *output,
+                                       unsigned int threads )
+{
+    pkcs5_pbkdf2_share share;
+    size_t group;
+
+    if( md_info == NULL )
+        return( MBEDTLS_ERR_PKCS5_BAD_INPUT_DATA );
+
+    share.md_info = md_info;
+    share.password = password;
+    share.plen = plen;
+    share.salt = salt;
+    share.slen = slen;
+    share.iteration_count = iteration_count;
+    share.key_length = key_length;
+    share.output = output;
+
+    group = (size_t) PKCS5_PBKDF2_LANES * mbedtls_md_get_size( md_info );
+
+    return( mbedtls_threading_split( pkcs5_pbkdf2_share_run, &share,
+                                     ( key_length + group - 1 ) / group,
+                                     threads ) );
 }
+#endif /* MBEDTLS_THREADING_PTHREAD */
 
 #if defined(MBEDTLS_SELF_TEST)
 
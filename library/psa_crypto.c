@@ -70,6 +70,7 @@
 #include "mbedtls/ctr_drbg.h"
 #include "mbedtls/des.h"
 #include "mbedtls/ecdh.h"
+#include "mbedtls/ecdsa.h"
 #include "mbedtls/ecp.h"
 #include "mbedtls/entropy.h"
 #include "mbedtls/entropy_poll.h"
@@ -130,6 +131,10 @@ typedef struct
     void (* entropy_free )( mbedtls_entropy_context *ctx );
     mbedtls_entropy_context entropy;
     mbedtls_ctr_drbg_context ctr_drbg;
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+    /* Indexed by mbedtls_ecp_group_id */
+    mbedtls_ecdsa_nonce_pool *ecdsa_nonce_pool[MBEDTLS_ECP_DP_CURVE448 + 1];
+#endif
     unsigned initialized : 1;
     unsigned rng_state : 2;
 } psa_global_data_t;
@@ -608,6 +613,18 @@ exit:
 }
 #endif /* defined(MBEDTLS_ECP_C) */
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE) && MBEDTLS_ECP_PRECOMP_PSA_SIZE > 0
+/* Precompute multiples of the public key of an elliptic curve key that
+ * may verify signatures. This is only a speed-up for later verifications,
+ * which still work without it, so errors are ignored. */
+static void psa_ecp_precompute( psa_key_slot_t *slot )
+{
+    if( ( slot->policy.usage & PSA_KEY_USAGE_VERIFY ) != 0 )
+        (void) mbedtls_ecp_keypair_precompute( slot->data.ecp,
+                                               MBEDTLS_ECP_PRECOMP_PSA_SIZE );
+}
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE && MBEDTLS_ECP_PRECOMP_PSA_SIZE > 0 */
+
 /** Import key data into a slot. `slot->type` must have been set
  * previously. This function assumes that the slot does not contain
  * any key material yet. On failure, the slot content is unchanged. */
@@ -689,6 +706,12 @@ psa_status_t psa_import_key_into_slot( psa_key_slot_t *slot,
     {
         return( PSA_ERROR_NOT_SUPPORTED );
     }
+
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE) && MBEDTLS_ECP_PRECOMP_PSA_SIZE > 0
+    if( PSA_KEY_TYPE_IS_ECC( slot->type ) )
+        psa_ecp_precompute( slot );
+#endif
+
     return( PSA_SUCCESS );
 }
 
@@ -2262,10 +2285,18 @@ static psa_status_t psa_ecdsa_sign( mbedtls_ecp_keypair *ecp,
 #endif /* MBEDTLS_ECDSA_DETERMINISTIC */
     {
         (void) alg;
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+        MBEDTLS_MPI_CHK( mbedtls_ecdsa_sign_pool( &ecp->grp, &r, &s, &ecp->d,
+                             hash, hash_length,
+                             global_data.ecdsa_nonce_pool[ecp->grp.id],
+                             mbedtls_ctr_drbg_random,
+                             &global_data.ctr_drbg ) );
+#else
         MBEDTLS_MPI_CHK( mbedtls_ecdsa_sign( &ecp->grp, &r, &s, &ecp->d,
                                              hash, hash_length,
                                              mbedtls_ctr_drbg_random,
                                              &global_data.ctr_drbg ) );
+#endif
     }
 
     MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( &r,
@@ -2305,8 +2336,12 @@ static psa_status_t psa_ecdsa_verify( mbedtls_ecp_keypair *ecp,
                                               signature + curve_bytes,
                                               curve_bytes ) );
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+    ret = mbedtls_ecdsa_verify_precomp( ecp, hash, hash_length, &r, &s );
+#else
     ret = mbedtls_ecdsa_verify( &ecp->grp, hash, hash_length,
                                 &ecp->Q, &r, &s );
+#endif
 
 cleanup:
     mbedtls_mpi_free( &r );
@@ -4330,6 +4365,9 @@ psa_status_t psa_generate_key( psa_key_handle_t handle,
             return( mbedtls_to_psa_error( ret ) );
         }
         slot->data.ecp = ecp;
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE) && MBEDTLS_ECP_PRECOMP_PSA_SIZE > 0
+        psa_ecp_precompute( slot );
+#endif
     }
     else
 #endif /* MBEDTLS_ECP_C */
@@ -4364,6 +4402,23 @@ psa_status_t mbedtls_psa_crypto_configure_entropy_sources(
     return( PSA_SUCCESS );
 }
 
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+psa_status_t mbedtls_psa_ecdsa_set_nonce_pool( psa_ecc_curve_t curve,
+                                               mbedtls_ecdsa_nonce_pool *pool )
+{
+    mbedtls_ecp_group_id grp_id = mbedtls_ecc_group_of_psa( curve );
+
+    if( grp_id == MBEDTLS_ECP_DP_NONE ||
+        (size_t) grp_id >= ARRAY_LENGTH( global_data.ecdsa_nonce_pool ) )
+        return( PSA_ERROR_NOT_SUPPORTED );
+    if( pool != NULL && pool->grp_id != grp_id )
+        return( PSA_ERROR_INVALID_ARGUMENT );
+
+    global_data.ecdsa_nonce_pool[grp_id] = pool;
+    return( PSA_SUCCESS );
+}
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
+
 void mbedtls_psa_crypto_free( void )
 {
     psa_wipe_all_key_slots( );
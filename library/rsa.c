@@ -477,6 +477,17 @@ void mbedtls_rsa_set_padding( mbedtls_rsa_context *ctx, int padding, int hash_id
     ctx->hash_id = hash_id;
 }
 
+#if defined(MBEDTLS_RSA_CRT_POOL)
+/*
+ * Set the CRT worker pool of an existing RSA context
+ */
+void mbedtls_rsa_set_crt_pool( mbedtls_rsa_context *ctx,
+                               mbedtls_rsa_crt_pool *pool )
+{
+    ctx->crt_pool = pool;
+}
+#endif
+
 /*
  * Get length in bytes of RSA modulus
  */
@@ -733,7 +744,8 @@ cleanup:
  *  Berlin Heidelberg, 1996. p. 104-113.
  */
 static int rsa_prepare_blinding( mbedtls_rsa_context *ctx,
-                 int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+                 int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                 mbedtls_mpi_arena *arena )
 {
     int ret, count = 0;
 
@@ -741,9 +753,11 @@ static int rsa_prepare_blinding( mbedtls_rsa_context *ctx,
     {
         /* We already have blinding values, just update them by squaring */
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->Vi, &ctx->Vi, &ctx->Vi ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->Vi, &ctx->Vi, &ctx->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &ctx->Vi, &ctx->Vi, &ctx->N,
+                                                    arena ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->Vf, &ctx->Vf, &ctx->Vf ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->Vf, &ctx->Vf, &ctx->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &ctx->Vf, &ctx->Vf, &ctx->N,
+                                                    arena ) );
 
         goto cleanup;
     }
@@ -759,12 +773,286 @@ static int rsa_prepare_blinding( mbedtls_rsa_context *ctx,
 
     /* Blinding value: Vi =  Vf^(-e) mod N */
     MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &ctx->Vi, &ctx->Vf, &ctx->N ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->Vi, &ctx->Vi, &ctx->E, &ctx->N, &ctx->RN ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_arena( &ctx->Vi, &ctx->Vi, &ctx->E,
+                                                &ctx->N, &ctx->RN, arena ) );
+
+
+cleanup:
+    return( ret );
+}
+
+#if defined(MBEDTLS_RSA_CRT_POOL)
+#define RSA_CRT_JOB_QUEUED      0
+#define RSA_CRT_JOB_RUNNING     1
+#define RSA_CRT_JOB_DONE        2
+
+/*
+ * One exponentiation X = A^E mod N handed to a worker. Jobs live on the
+ * stack of the private key operation that queues them, which doesn't
+ * return before the job is done.
+ */
+struct mbedtls_rsa_crt_job
+{
+    mbedtls_mpi *X;
+    const mbedtls_mpi *A;
+    const mbedtls_mpi *E;
+    const mbedtls_mpi *N;
+    mbedtls_mpi *RR;
+    mbedtls_mpi_arena *arena;
+    int ret;
+    int state;
+    struct mbedtls_rsa_crt_job *next;
+};
+
+static void rsa_crt_job_run( struct mbedtls_rsa_crt_job *job )
+{
+    job->ret = mbedtls_mpi_exp_mod_arena( job->X, job->A, job->E, job->N,
+                                          job->RR, job->arena );
+}
+
+/*
+ * Worker: run queued jobs in order until the pool is stopped
+ */
+static void rsa_crt_pool_worker( void *data )
+{
+    mbedtls_rsa_crt_pool *pool = (mbedtls_rsa_crt_pool *) data;
+    struct mbedtls_rsa_crt_job *job;
+
+    pthread_mutex_lock( &pool->mutex );
+
+    while( pool->running )
+    {
+        if( ( job = pool->head ) == NULL )
+        {
+            pthread_cond_wait( &pool->work_cond, &pool->mutex );
+            continue;
+        }
+
+        pool->head = job->next;
+        if( pool->head == NULL )
+            pool->tail = NULL;
+        job->state = RSA_CRT_JOB_RUNNING;
+        pool->jobs++;
+        pthread_mutex_unlock( &pool->mutex );
+
+        rsa_crt_job_run( job );
+
+        pthread_mutex_lock( &pool->mutex );
+        job->state = RSA_CRT_JOB_DONE;
+        pthread_cond_broadcast( &pool->done_cond );
+    }
+
+    pthread_mutex_unlock( &pool->mutex );
+}
+
+void mbedtls_rsa_crt_pool_init( mbedtls_rsa_crt_pool *pool )
+{
+    memset( pool, 0, sizeof( mbedtls_rsa_crt_pool ) );
+
+    pthread_mutex_init( &pool->mutex, NULL );
+    pthread_cond_init( &pool->work_cond, NULL );
+    pthread_cond_init( &pool->done_cond, NULL );
+}
+
+int mbedtls_rsa_crt_pool_start( mbedtls_rsa_crt_pool *pool,
+                                unsigned int workers )
+{
+    int ret = 0;
+    unsigned int t;
+
+    if( workers == 0 || workers > MBEDTLS_RSA_CRT_POOL_MAX_WORKERS )
+        return( MBEDTLS_ERR_THREADING_BAD_INPUT_DATA );
+
+    pthread_mutex_lock( &pool->mutex );
+
+    if( pool->running || pool->count != 0 )
+        ret = MBEDTLS_ERR_THREADING_BAD_INPUT_DATA;
+    else
+    {
+        pool->running = 1;
+
+        /* The workers wait for the mutex until all are started */
+        for( t = 0; t < workers; t++ )
+        {
+            if( mbedtls_threading_thread_create( &pool->workers[t],
+                                        rsa_crt_pool_worker, pool ) != 0 )
+                break;
+        }
+
+        pool->count = t;
+        if( t == 0 )
+        {
+            pool->running = 0;
+            ret = MBEDTLS_ERR_THREADING_THREAD_ERROR;
+        }
+    }
+
+    pthread_mutex_unlock( &pool->mutex );
+
+    return( ret );
+}
+
+void mbedtls_rsa_crt_pool_stop( mbedtls_rsa_crt_pool *pool )
+{
+    unsigned int t, count;
+
+    pthread_mutex_lock( &pool->mutex );
+
+    if( ! pool->running )
+    {
+        pthread_mutex_unlock( &pool->mutex );
+        return;
+    }
+
+    pool->running = 0;
+    count = pool->count;
+    pthread_cond_broadcast( &pool->work_cond );
+    pthread_mutex_unlock( &pool->mutex );
+
+    for( t = 0; t < count; t++ )
+        mbedtls_threading_thread_join( &pool->workers[t] );
+
+    pthread_mutex_lock( &pool->mutex );
+    pool->count = 0;
+    pthread_mutex_unlock( &pool->mutex );
+}
+
+void mbedtls_rsa_crt_pool_free( mbedtls_rsa_crt_pool *pool )
+{
+    if( pool == NULL )
+        return;
+
+    mbedtls_rsa_crt_pool_stop( pool );
+
+    pthread_cond_destroy( &pool->done_cond );
+    pthread_cond_destroy( &pool->work_cond );
+    pthread_mutex_destroy( &pool->mutex );
+
+    mbedtls_platform_zeroize( pool, sizeof( mbedtls_rsa_crt_pool ) );
+}
+
+/*
+ * Queue a job if the pool has running workers, returning 1 if it did
+ */
+static int rsa_crt_pool_submit( mbedtls_rsa_crt_pool *pool,
+                                struct mbedtls_rsa_crt_job *job )
+{
+    int queued;
+
+    job->state = RSA_CRT_JOB_QUEUED;
+    job->next = NULL;
+
+    pthread_mutex_lock( &pool->mutex );
+
+    if( ( queued = pool->running ) != 0 )
+    {
+        if( pool->tail != NULL )
+            pool->tail->next = job;
+        else
+            pool->head = job;
+        pool->tail = job;
+
+        pthread_cond_signal( &pool->work_cond );
+    }
+
+    pthread_mutex_unlock( &pool->mutex );
+
+    return( queued );
+}
+
+/*
+ * Wait until a queued job is done. A job that no worker has picked up yet
+ * is taken back from the queue and run by the calling thread, rather than
+ * waiting for a busy worker.
+ */
+static void rsa_crt_pool_wait( mbedtls_rsa_crt_pool *pool,
+                               struct mbedtls_rsa_crt_job *job )
+{
+    struct mbedtls_rsa_crt_job **p, *prev = NULL;
+    int run = 0;
+
+    pthread_mutex_lock( &pool->mutex );
+
+    if( job->state == RSA_CRT_JOB_QUEUED )
+    {
+        for( p = &pool->head; *p != job; p = &(*p)->next )
+            prev = *p;
 
+        *p = job->next;
+        if( pool->tail == job )
+            pool->tail = prev;
+
+        pool->reclaimed++;
+        run = 1;
+    }
+    else
+    {
+        while( job->state != RSA_CRT_JOB_DONE )
+            pthread_cond_wait( &pool->done_cond, &pool->mutex );
+    }
+
+    pthread_mutex_unlock( &pool->mutex );
+
+    if( run )
+        rsa_crt_job_run( job );
+}
+#endif /* MBEDTLS_RSA_CRT_POOL */
+
+#if !defined(MBEDTLS_RSA_NO_CRT)
+/*
+ * TP = T^DP mod P and TQ = T^DQ mod Q, concurrently if the context has a
+ * worker pool. Each exponentiation has its own arena.
+ */
+static int rsa_crt_exp_mod( mbedtls_rsa_context *ctx,
+                            mbedtls_mpi *TP, mbedtls_mpi *TQ,
+                            const mbedtls_mpi *T,
+                            const mbedtls_mpi *DP, const mbedtls_mpi *DQ,
+                            mbedtls_mpi_arena *arena )
+{
+    int ret;
+
+#if defined(MBEDTLS_RSA_CRT_POOL)
+    if( ctx->crt_pool != NULL )
+    {
+        struct mbedtls_rsa_crt_job job;
+        mbedtls_mpi_arena arena_q;
+        int queued;
+
+        mbedtls_mpi_arena_init( &arena_q );
+
+        job.X = TQ;
+        job.A = T;
+        job.E = DQ;
+        job.N = &ctx->Q;
+        job.RR = &ctx->RQ;
+        job.arena = &arena_q;
+        job.ret = 0;
+
+        queued = rsa_crt_pool_submit( ctx->crt_pool, &job );
+
+        /* Always wait for the job, which uses T and TQ */
+        ret = mbedtls_mpi_exp_mod_arena( TP, T, DP, &ctx->P, &ctx->RP, arena );
+
+        if( queued )
+            rsa_crt_pool_wait( ctx->crt_pool, &job );
+        else
+            rsa_crt_job_run( &job );
+
+        mbedtls_mpi_arena_free( &arena_q );
+
+        return( ret != 0 ? ret : job.ret );
+    }
+#endif /* MBEDTLS_RSA_CRT_POOL */
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_arena( TP, T, DP, &ctx->P, &ctx->RP,
+                                                arena ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_arena( TQ, T, DQ, &ctx->Q, &ctx->RQ,
+                                                arena ) );
 
 cleanup:
     return( ret );
 }
+#endif /* !MBEDTLS_RSA_NO_CRT */
 
 /*
  * Exponent blinding supposed to prevent side-channel attacks using multiple
@@ -831,6 +1119,9 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
      * checked result; should be the same in the end. */
     mbedtls_mpi I, C;
 
+    /* Scratch space shared by the modular reductions and exponentiations */
+    mbedtls_mpi_arena arena;
+
     if( rsa_check_context( ctx, 1             /* private key checks */,
                                 f_rng != NULL /* blinding y/n       */ ) != 0 )
     {
@@ -866,6 +1157,8 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
     mbedtls_mpi_init( &I );
     mbedtls_mpi_init( &C );
 
+    mbedtls_mpi_arena_init( &arena );
+
     /* End of MPI initialization */
 
     MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &T, input, ctx->len ) );
@@ -883,9 +1176,9 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
          * Blinding
          * T = T * Vi mod N
          */
-        MBEDTLS_MPI_CHK( rsa_prepare_blinding( ctx, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( rsa_prepare_blinding( ctx, f_rng, p_rng, &arena ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, &T, &ctx->Vi ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &T, &ctx->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &T, &T, &ctx->N, &arena ) );
 
         /*
          * Exponent blinding
@@ -930,7 +1223,8 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
     }
 
 #if defined(MBEDTLS_RSA_NO_CRT)
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &T, &T, D, &ctx->N, &ctx->RN ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_arena( &T, &T, D, &ctx->N, &ctx->RN,
+                                                &arena ) );
 #else
     /*
      * Faster decryption using the CRT
@@ -939,15 +1233,14 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
      * TQ = input ^ dQ mod Q
      */
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &TP, &T, DP, &ctx->P, &ctx->RP ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &TQ, &T, DQ, &ctx->Q, &ctx->RQ ) );
+    MBEDTLS_MPI_CHK( rsa_crt_exp_mod( ctx, &TP, &TQ, &T, DP, DQ, &arena ) );
 
     /*
      * T = (TP - TQ) * (Q^-1 mod P) mod P
      */
     MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T, &TP, &TQ ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &TP, &T, &ctx->QP ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &TP, &ctx->P ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &T, &TP, &ctx->P, &arena ) );
 
     /*
      * T = TQ + T * Q
@@ -963,12 +1256,12 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
          * T = T * Vf mod N
          */
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, &T, &ctx->Vf ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &T, &ctx->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi_arena( &T, &T, &ctx->N, &arena ) );
     }
 
     /* Verify the result to prevent glitching attacks. */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &C, &T, &ctx->E,
-                                          &ctx->N, &ctx->RN ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod_arena( &C, &T, &ctx->E,
+                                                &ctx->N, &ctx->RN, &arena ) );
     if( mbedtls_mpi_cmp_mpi( &C, &I ) != 0 )
     {
         ret = MBEDTLS_ERR_RSA_VERIFY_FAILED;
@@ -1007,6 +1300,8 @@ cleanup:
     mbedtls_mpi_free( &C );
     mbedtls_mpi_free( &I );
 
+    mbedtls_mpi_arena_free( &arena );
+
     if( ret != 0 )
         return( MBEDTLS_ERR_RSA_PRIVATE_FAILED + ret );
 
@@ -2181,6 +2476,10 @@ int mbedtls_rsa_copy( mbedtls_rsa_context *dst, const mbedtls_rsa_context *src )
     dst->padding = src->padding;
     dst->hash_id = src->hash_id;
 
+#if defined(MBEDTLS_RSA_CRT_POOL)
+    dst->crt_pool = src->crt_pool;
+#endif
+
 cleanup:
     if( ret != 0 )
         mbedtls_rsa_free( dst );
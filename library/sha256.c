@@ -35,6 +35,10 @@
 #include "mbedtls/sha256.h"
 #include "mbedtls/platform_util.h"
 
+#if defined(MBEDTLS_SHANI_C)
+#include "mbedtls/shani.h"
+#endif
+
 #include <string.h>
 
 #if defined(MBEDTLS_SELF_TEST)
@@ -51,6 +55,13 @@
 
 #if !defined(MBEDTLS_SHA256_ALT)
 
+#if defined(MBEDTLS_SHANI_C) && defined(MBEDTLS_HAVE_X86_64) && \
+    !defined(MBEDTLS_SHA256_PROCESS_ALT)
+#define SHA256_MULTI_LANES
+/* Below this many messages in flight, hashing them one by one is faster */
+#define SHA256_MULTI_MIN_LANES  3
+#endif
+
 /*
  * 32-bit integer manipulation macros (big endian)
  */
@@ -192,6 +203,14 @@ int mbedtls_internal_sha256_process( mbedtls_sha256_context *ctx,
     uint32_t A[8];
     unsigned int i;
 
+#if defined(MBEDTLS_SHANI_C) && defined(MBEDTLS_HAVE_X86_64)
+    if( mbedtls_shani_has_support( MBEDTLS_SHANI_SHA ) )
+    {
+        mbedtls_shani_sha256_process( ctx->state, data, 1 );
+        return( 0 );
+    }
+#endif
+
     for( i = 0; i < 8; i++ )
         A[i] = ctx->state[i];
 
@@ -287,6 +306,17 @@ int mbedtls_sha256_update_ret( mbedtls_sha256_context *ctx,
         left = 0;
     }
 
+#if defined(MBEDTLS_SHANI_C) && defined(MBEDTLS_HAVE_X86_64) && \
+    !defined(MBEDTLS_SHA256_PROCESS_ALT)
+    if( ilen >= 64 && mbedtls_shani_has_support( MBEDTLS_SHANI_SHA ) )
+    {
+        /* Keep the state in registers across consecutive blocks */
+        mbedtls_shani_sha256_process( ctx->state, input, ilen / 64 );
+        input += ilen & ~( (size_t) 63 );
+        ilen  &= 63;
+    }
+#endif
+
     while( ilen >= 64 )
     {
         if( ( ret = mbedtls_internal_sha256_process( ctx, input ) ) != 0 )
@@ -382,6 +412,58 @@ void mbedtls_sha256_finish( mbedtls_sha256_context *ctx,
 }
 #endif
 
+#if defined(SHA256_MULTI_LANES)
+static int sha256_process_lane( void *ctx, const unsigned char data[64] )
+{
+    return( mbedtls_internal_sha256_process( ctx, data ) );
+}
+
+static const mbedtls_shani_lanes_info sha256_lanes_info =
+{
+    8,
+    offsetof( mbedtls_sha256_context, total ),
+    offsetof( mbedtls_sha256_context, state ),
+    offsetof( mbedtls_sha256_context, buffer ),
+    SHA256_MULTI_MIN_LANES,
+    sha256_process_lane,
+    mbedtls_shani_sha256_process_x8
+};
+
+/*
+ * Finish the messages over the multi-buffer lanes, then write the digests
+ */
+static int sha256_finish_lanes( mbedtls_sha256_context * const ctx[],
+                                const unsigned char * const input[],
+                                const size_t ilen[],
+                                unsigned char * const output[],
+                                size_t count )
+{
+    int ret;
+    size_t i;
+
+    if( ( ret = mbedtls_shani_finish_lanes( &sha256_lanes_info,
+                                            (void * const *) ctx,
+                                            input, ilen, count ) ) != 0 )
+        return( ret );
+
+    for( i = 0; i < count; i++ )
+    {
+        PUT_UINT32_BE( ctx[i]->state[0], output[i],  0 );
+        PUT_UINT32_BE( ctx[i]->state[1], output[i],  4 );
+        PUT_UINT32_BE( ctx[i]->state[2], output[i],  8 );
+        PUT_UINT32_BE( ctx[i]->state[3], output[i], 12 );
+        PUT_UINT32_BE( ctx[i]->state[4], output[i], 16 );
+        PUT_UINT32_BE( ctx[i]->state[5], output[i], 20 );
+        PUT_UINT32_BE( ctx[i]->state[6], output[i], 24 );
+
+        if( ctx[i]->is224 == 0 )
+            PUT_UINT32_BE( ctx[i]->state[7], output[i], 28 );
+    }
+
+    return( 0 );
+}
+#endif /* SHA256_MULTI_LANES */
+
 #endif /* !MBEDTLS_SHA256_ALT */
 
 /*
@@ -422,6 +504,88 @@ void mbedtls_sha256( const unsigned char *input,
 }
 #endif
 
+/*
+ * Finish several SHA-256 computations at once
+ */
+int mbedtls_sha256_finish_multi( mbedtls_sha256_context * const ctx[],
+                                 const unsigned char * const input[],
+                                 const size_t ilen[],
+                                 unsigned char * const output[],
+                                 size_t count )
+{
+    int ret;
+    size_t i;
+
+#if defined(SHA256_MULTI_LANES)
+    if( count >= SHA256_MULTI_MIN_LANES && mbedtls_shani_use_lanes() )
+    {
+        return( sha256_finish_lanes( ctx, input, ilen, output, count ) );
+    }
+#endif
+
+    for( i = 0; i < count; i++ )
+    {
+        if( ( ret = mbedtls_sha256_update_ret( ctx[i], input[i],
+                                               ilen[i] ) ) != 0 )
+            return( ret );
+
+        if( ( ret = mbedtls_sha256_finish_ret( ctx[i], output[i] ) ) != 0 )
+            return( ret );
+    }
+
+    return( 0 );
+}
+
+/* Number of messages handed to mbedtls_sha256_finish_multi() at a time */
+#define SHA256_MULTI_BATCH  16
+
+/*
+ * output[i] = SHA-256( input[i] ) for several independent buffers
+ */
+int mbedtls_sha256_ret_multi( const unsigned char * const input[],
+                              const size_t ilen[],
+                              unsigned char * const output[],
+                              size_t count,
+                              int is224 )
+{
+    int ret = 0;
+    mbedtls_sha256_context ctx[SHA256_MULTI_BATCH];
+    mbedtls_sha256_context *pctx[SHA256_MULTI_BATCH];
+    size_t i, n;
+
+    for( i = 0; i < SHA256_MULTI_BATCH; i++ )
+    {
+        mbedtls_sha256_init( &ctx[i] );
+        pctx[i] = &ctx[i];
+    }
+
+    while( count > 0 )
+    {
+        n = count < SHA256_MULTI_BATCH ? count : SHA256_MULTI_BATCH;
+
+        for( i = 0; i < n; i++ )
+        {
+            if( ( ret = mbedtls_sha256_starts_ret( &ctx[i], is224 ) ) != 0 )
+                goto exit;
+        }
+
+        if( ( ret = mbedtls_sha256_finish_multi( pctx, input, ilen,
+                                                 output, n ) ) != 0 )
+            goto exit;
+
+        input  += n;
+        ilen   += n;
+        output += n;
+        count  -= n;
+    }
+
+exit:
+    for( i = 0; i < SHA256_MULTI_BATCH; i++ )
+        mbedtls_sha256_free( &ctx[i] );
+
+    return( ret );
+}
+
 #if defined(MBEDTLS_SELF_TEST)
 /*
  * FIPS-180-2 test vectors
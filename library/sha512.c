@@ -35,6 +35,10 @@
 #include "mbedtls/sha512.h"
 #include "mbedtls/platform_util.h"
 
+#if defined(MBEDTLS_SHANI_C)
+#include "mbedtls/shani.h"
+#endif
+
 #if defined(_MSC_VER) || defined(__WATCOMC__)
   #define UL64(x) x##ui64
 #else
@@ -57,6 +61,17 @@
 
 #if !defined(MBEDTLS_SHA512_ALT)
 
+#if defined(MBEDTLS_SHANI_C) && defined(MBEDTLS_HAVE_X86_64) && \
+    !defined(MBEDTLS_SHA512_PROCESS_ALT)
+#define SHA512_AVX2
+
+static int sha512_has_avx2( void )
+{
+    return( mbedtls_shani_has_support( MBEDTLS_SHANI_AVX2 ) &&
+            mbedtls_shani_has_support( MBEDTLS_SHANI_BMI2 ) );
+}
+#endif
+
 /*
  * 64-bit integer manipulation macros (big endian)
  */
@@ -228,6 +243,14 @@ int mbedtls_internal_sha512_process( mbedtls_sha512_context *ctx,
     d += temp1; h = temp1 + temp2;              \
 }
 
+#if defined(SHA512_AVX2)
+    if( sha512_has_avx2() )
+    {
+        mbedtls_shani_sha512_process( ctx->state, data, 1 );
+        return( 0 );
+    }
+#endif
+
     for( i = 0; i < 16; i++ )
     {
         GET_UINT64_BE( W[i], data, i << 3 );
@@ -317,6 +340,15 @@ int mbedtls_sha512_update_ret( mbedtls_sha512_context *ctx,
         left = 0;
     }
 
+#if defined(SHA512_AVX2)
+    if( ilen >= 128 && sha512_has_avx2() )
+    {
+        mbedtls_shani_sha512_process( ctx->state, input, ilen / 128 );
+        input += ilen & ~( (size_t) 127 );
+        ilen  &= 127;
+    }
+#endif
+
     while( ilen >= 128 )
     {
         if( ( ret = mbedtls_internal_sha512_process( ctx, input ) ) != 0 )
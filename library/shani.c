@@ -0,0 +1,930 @@
+/*
+ *  SHA-NI and SIMD support functions for SHA-1, SHA-256 and SHA-512
+ *
+ *  Copyright (C) 2006-2019, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+/*
+ * [SHA-WP] https://software.intel.com/en-us/articles/intel-sha-extensions
+ * [MB-WP]  Guilford, Gulley, Gopal, Feghali, Wolrich: "Fast Multi-buffer
+ *          SHA-256 and SHA-1 Implementations", Intel white paper, 2012
+ * [512-WP] Gulley, Gopal, Guilford, Feghali, Wolrich: "Fast SHA512
+ *          Implementations on Intel Architecture Processors", Intel white
+ *          paper, 2012
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_SHANI_C)
+
+#if defined(__has_feature)
+#if __has_feature(memory_sanitizer)
+#warning "MBEDTLS_SHANI_C is known to cause spurious error reports with some memory sanitizers as they do not understand the assembly code."
+#endif
+#endif
+
+#include "mbedtls/shani.h"
+#include "mbedtls/platform_util.h"
+
+#include <string.h>
+
+#ifndef asm
+#define asm __asm
+#endif
+
+#if defined(MBEDTLS_HAVE_X86_64)
+
+/*
+ * 32-bit integer manipulation macros (big endian)
+ */
+#ifndef GET_UINT32_BE
+#define GET_UINT32_BE(n,b,i)                            \
+do {                                                    \
+    (n) = ( (uint32_t) (b)[(i)    ] << 24 )             \
+        | ( (uint32_t) (b)[(i) + 1] << 16 )             \
+        | ( (uint32_t) (b)[(i) + 2] <<  8 )             \
+        | ( (uint32_t) (b)[(i) + 3]       );            \
+} while( 0 )
+#endif
+
+#ifndef PUT_UINT32_BE
+#define PUT_UINT32_BE(n,b,i)                            \
+do {                                                    \
+    (b)[(i)    ] = (unsigned char) ( (n) >> 24 );       \
+    (b)[(i) + 1] = (unsigned char) ( (n) >> 16 );       \
+    (b)[(i) + 2] = (unsigned char) ( (n) >>  8 );       \
+    (b)[(i) + 3] = (unsigned char) ( (n)       );       \
+} while( 0 )
+#endif
+
+/*
+ * SHA-NI / AVX2 support detection routine
+ */
+int mbedtls_shani_has_support( unsigned int what )
+{
+    static int done = 0;
+    static unsigned int c = 0;
+
+    if( ! done )
+    {
+        unsigned int max_leaf, ecx1, ebx7, xcr0 = 0;
+
+        asm( "xorl  %%ecx, %%ecx \n\t"
+             "xorl  %%eax, %%eax \n\t"
+             "cpuid              \n\t"
+             : "=a" (max_leaf)
+             :
+             : "ebx", "ecx", "edx" );
+
+        if( max_leaf >= 7 )
+        {
+            asm( "movl  $1, %%eax   \n\t"
+                 "cpuid             \n\t"
+                 : "=c" (ecx1)
+                 :
+                 : "eax", "ebx", "edx" );
+
+            asm( "movl  $7, %%eax   \n\t"
+                 "xorl  %%ecx, %%ecx \n\t"
+                 "cpuid             \n\t"
+                 : "=b" (ebx7)
+                 :
+                 : "eax", "ecx", "edx" );
+
+            /* AVX2 is only usable if the OS saves the YMM state (OSXSAVE) */
+            if( ( ecx1 & 0x08000000u ) != 0 )
+            {
+                asm( "xorl  %%ecx, %%ecx    \n\t"
+                     ".byte 0x0F,0x01,0xD0  \n\t" // xgetbv
+                     : "=a" (xcr0)
+                     :
+                     : "ecx", "edx" );
+            }
+
+            if( ( ecx1 & 0x10000000u ) == 0 || ( xcr0 & 6 ) != 6 )
+                ebx7 &= ~MBEDTLS_SHANI_AVX2;
+
+            c = ebx7;
+        }
+
+        done = 1;
+    }
+
+    return( ( c & what ) != 0 );
+}
+
+/*
+ * Set by mbedtls_shani_force_lanes(), for the tests
+ */
+static int shani_force_lanes = 0;
+
+void mbedtls_shani_force_lanes( int force )
+{
+    shani_force_lanes = force;
+}
+
+/*
+ * A single SHA-NI stream is faster than the SIMD lanes
+ */
+int mbedtls_shani_use_lanes( void )
+{
+    return( shani_force_lanes ||
+            ! mbedtls_shani_has_support( MBEDTLS_SHANI_SHA ) );
+}
+
+/*
+ * SHA-NI SHA-256 compression function.
+ *
+ * Register usage:
+ *  xmm0        message + round constants (implicit operand of sha256rnds2)
+ *  xmm1, xmm2  state as ABEF, CDGH
+ *  xmm3-xmm6   message schedule, four words each
+ *  xmm7        scratch
+ *  xmm8        byte-swap mask
+ *  xmm9, xmm10 state at the beginning of the block
+ */
+static const uint32_t sha256_k[64] __attribute__((aligned(16))) =
+{
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5,
+    0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3,
+    0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC,
+    0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7,
+    0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13,
+    0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3,
+    0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5,
+    0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208,
+    0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2,
+};
+
+static const unsigned char sha256_bswap_mask[16] __attribute__((aligned(16))) =
+{
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+};
+
+#define M0  "%%xmm3"
+#define M1  "%%xmm4"
+#define M2  "%%xmm5"
+#define M3  "%%xmm6"
+
+/* Load message words 4*g .. 4*g+3 */
+#define SHA256_LOAD( g, m )                                     \
+    "movdqu   16*" #g "(%1), " m "          \n\t"              \
+    "pshufb   %%xmm8, " m "                 \n\t"
+
+/* Rounds 4*g and 4*g+1 */
+#define SHA256_RNDS_LO( g, m )                                  \
+    "movdqa   " m ", %%xmm0                 \n\t"              \
+    "paddd    16*" #g "(%3), %%xmm0         \n\t"              \
+    "sha256rnds2 %%xmm0, %%xmm1, %%xmm2     \n\t"
+
+/* Rounds 4*g+2 and 4*g+3 */
+#define SHA256_RNDS_HI                                          \
+    "pshufd   $0x0E, %%xmm0, %%xmm0         \n\t"              \
+    "sha256rnds2 %%xmm0, %%xmm2, %%xmm1     \n\t"
+
+/* Complete the schedule of next = W[4g+4 .. 4g+7] */
+#define SHA256_MSG2( cur, prev, next )                          \
+    "movdqa   " cur ", %%xmm7               \n\t"              \
+    "palignr  $4, " prev ", %%xmm7          \n\t"              \
+    "paddd    %%xmm7, " next "              \n\t"              \
+    "sha256msg2 " cur ", " next "           \n\t"
+
+/* Start the schedule of prev = W[4g+12 .. 4g+15] */
+#define SHA256_MSG1( cur, prev )                                \
+    "sha256msg1 " cur ", " prev "           \n\t"
+
+#define SHA256_QROUND( g, cur, prev, next )                     \
+    SHA256_RNDS_LO( g, cur )                                    \
+    SHA256_MSG2( cur, prev, next )                              \
+    SHA256_RNDS_HI                                              \
+    SHA256_MSG1( cur, prev )
+
+void mbedtls_shani_sha256_process( uint32_t state[8],
+                                   const unsigned char *data,
+                                   size_t nblocks )
+{
+    if( nblocks == 0 )
+        return;
+
+    asm volatile( "movdqu   (%0), %%xmm7             \n\t" // DCBA
+                  "movdqu   16(%0), %%xmm2           \n\t" // HGFE
+                  "pshufd   $0xB1, %%xmm7, %%xmm7    \n\t" // CDAB
+                  "pshufd   $0x1B, %%xmm2, %%xmm2    \n\t" // EFGH
+                  "movdqa   %%xmm7, %%xmm1           \n\t"
+                  "palignr  $8, %%xmm2, %%xmm1       \n\t" // ABEF
+                  "pblendw  $0xF0, %%xmm7, %%xmm2    \n\t" // CDGH
+                  "movdqa   (%4), %%xmm8             \n\t"
+
+                  "1:                                \n\t"
+                  "movdqa   %%xmm1, %%xmm9           \n\t"
+                  "movdqa   %%xmm2, %%xmm10          \n\t"
+
+                  SHA256_LOAD( 0, M0 )
+                  SHA256_RNDS_LO( 0, M0 )
+                  SHA256_RNDS_HI
+
+                  SHA256_LOAD( 1, M1 )
+                  SHA256_RNDS_LO( 1, M1 )
+                  SHA256_RNDS_HI
+                  SHA256_MSG1( M1, M0 )
+
+                  SHA256_LOAD( 2, M2 )
+                  SHA256_RNDS_LO( 2, M2 )
+                  SHA256_RNDS_HI
+                  SHA256_MSG1( M2, M1 )
+
+                  SHA256_LOAD( 3, M3 )
+                  SHA256_QROUND(  3, M3, M2, M0 )
+                  SHA256_QROUND(  4, M0, M3, M1 )
+                  SHA256_QROUND(  5, M1, M0, M2 )
+                  SHA256_QROUND(  6, M2, M1, M3 )
+                  SHA256_QROUND(  7, M3, M2, M0 )
+                  SHA256_QROUND(  8, M0, M3, M1 )
+                  SHA256_QROUND(  9, M1, M0, M2 )
+                  SHA256_QROUND( 10, M2, M1, M3 )
+                  SHA256_QROUND( 11, M3, M2, M0 )
+                  SHA256_QROUND( 12, M0, M3, M1 )
+
+                  SHA256_RNDS_LO( 13, M1 )
+                  SHA256_MSG2( M1, M0, M2 )
+                  SHA256_RNDS_HI
+
+                  SHA256_RNDS_LO( 14, M2 )
+                  SHA256_MSG2( M2, M1, M3 )
+                  SHA256_RNDS_HI
+
+                  SHA256_RNDS_LO( 15, M3 )
+                  SHA256_RNDS_HI
+
+                  "paddd    %%xmm9, %%xmm1           \n\t"
+                  "paddd    %%xmm10, %%xmm2          \n\t"
+                  "add      $64, %1                  \n\t"
+                  "sub      $1, %2                   \n\t"
+                  "jnz      1b                       \n\t"
+
+                  "pshufd   $0x1B, %%xmm1, %%xmm7    \n\t" // FEBA
+                  "pshufd   $0xB1, %%xmm2, %%xmm2    \n\t" // DCHG
+                  "movdqa   %%xmm7, %%xmm1           \n\t"
+                  "pblendw  $0xF0, %%xmm2, %%xmm1    \n\t" // DCBA
+                  "palignr  $8, %%xmm7, %%xmm2       \n\t" // HGFE
+                  "movdqu   %%xmm1, (%0)             \n\t"
+                  "movdqu   %%xmm2, 16(%0)           \n\t"
+                  : "+r" (state), "+r" (data), "+r" (nblocks)
+                  : "r" (sha256_k), "r" (sha256_bswap_mask)
+                  : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+                    "xmm6", "xmm7", "xmm8", "xmm9", "xmm10" );
+}
+
+/*
+ * SHA-NI SHA-1 compression function.
+ *
+ * Register usage:
+ *  xmm1        state ABCD
+ *  xmm2, xmm7  E, alternately
+ *  xmm3-xmm6   message schedule, four words each
+ *  xmm8        byte-swap mask
+ *  xmm9, xmm10 state at the beginning of the block
+ */
+static const unsigned char sha1_bswap_mask[16] __attribute__((aligned(16))) =
+{
+    15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0
+};
+
+#define E0  "%%xmm2"
+#define E1  "%%xmm7"
+
+#define SHA1_LOAD( g, m )                                       \
+    "movdqu   16*" #g "(%1), " m "          \n\t"              \
+    "pshufb   %%xmm8, " m "                 \n\t"
+
+/* Derive E for rounds 4*g .. 4*g+3 into e_in, save ABCD for the next E */
+#define SHA1_NEXTE( cur, e_in, e_out )                          \
+    "sha1nexte " cur ", " e_in "            \n\t"              \
+    "movdqa   %%xmm1, " e_out "             \n\t"
+
+/* Rounds 4*g .. 4*g+3 */
+#define SHA1_RNDS4( f, e_in )                                   \
+    "sha1rnds4 $" #f ", " e_in ", %%xmm1    \n\t"
+
+#define SHA1_MSG1( cur, prev )                                  \
+    "sha1msg1 " cur ", " prev "             \n\t"
+
+#define SHA1_MSG2( cur, next )                                  \
+    "sha1msg2 " cur ", " next "             \n\t"
+
+#define SHA1_XOR( cur, prev2 )                                  \
+    "pxor     " cur ", " prev2 "            \n\t"
+
+#define SHA1_QROUND( f, cur, prev, prev2, next, e_in, e_out )   \
+    SHA1_NEXTE( cur, e_in, e_out )                            \
+    SHA1_MSG2( cur, next )                                      \
+    SHA1_RNDS4( f, e_in )                                       \
+    SHA1_MSG1( cur, prev )                                      \
+    SHA1_XOR( cur, prev2 )
+
+void mbedtls_shani_sha1_process( uint32_t state[5],
+                                 const unsigned char *data,
+                                 size_t nblocks )
+{
+    if( nblocks == 0 )
+        return;
+
+    asm volatile( "movdqu   (%0), %%xmm1             \n\t"
+                  "pshufd   $0x1B, %%xmm1, %%xmm1    \n\t" // ABCD
+                  "movd     16(%0), %%xmm2           \n\t"
+                  "pslldq   $12, %%xmm2              \n\t" // E in the top word
+                  "movdqa   (%3), %%xmm8             \n\t"
+
+                  "1:                                \n\t"
+                  "movdqa   %%xmm1, %%xmm9           \n\t"
+                  "movdqa   %%xmm2, %%xmm10          \n\t"
+
+                  SHA1_LOAD( 0, M0 )
+                  "paddd    " M0 ", " E0 "           \n\t"
+                  "movdqa   %%xmm1, " E1 "           \n\t"
+                  SHA1_RNDS4( 0, E0 )
+
+                  SHA1_LOAD( 1, M1 )
+                  SHA1_NEXTE( M1, E1, E0 )
+                  SHA1_RNDS4( 0, E1 )
+                  SHA1_MSG1( M1, M0 )
+
+                  SHA1_LOAD( 2, M2 )
+                  SHA1_NEXTE( M2, E0, E1 )
+                  SHA1_RNDS4( 0, E0 )
+                  SHA1_MSG1( M2, M1 )
+                  SHA1_XOR( M2, M0 )
+
+                  SHA1_LOAD( 3, M3 )
+                  SHA1_QROUND( 0, M3, M2, M1, M0, E1, E0 )
+                  SHA1_QROUND( 0, M0, M3, M2, M1, E0, E1 )
+                  SHA1_QROUND( 1, M1, M0, M3, M2, E1, E0 )
+                  SHA1_QROUND( 1, M2, M1, M0, M3, E0, E1 )
+                  SHA1_QROUND( 1, M3, M2, M1, M0, E1, E0 )
+                  SHA1_QROUND( 1, M0, M3, M2, M1, E0, E1 )
+                  SHA1_QROUND( 1, M1, M0, M3, M2, E1, E0 )
+                  SHA1_QROUND( 2, M2, M1, M0, M3, E0, E1 )
+                  SHA1_QROUND( 2, M3, M2, M1, M0, E1, E0 )
+                  SHA1_QROUND( 2, M0, M3, M2, M1, E0, E1 )
+                  SHA1_QROUND( 2, M1, M0, M3, M2, E1, E0 )
+                  SHA1_QROUND( 2, M2, M1, M0, M3, E0, E1 )
+                  SHA1_QROUND( 3, M3, M2, M1, M0, E1, E0 )
+                  SHA1_QROUND( 3, M0, M3, M2, M1, E0, E1 )
+
+                  SHA1_NEXTE( M1, E1, E0 )
+                  SHA1_MSG2( M1, M2 )
+                  SHA1_RNDS4( 3, E1 )
+                  SHA1_XOR( M1, M3 )
+
+                  SHA1_NEXTE( M2, E0, E1 )
+                  SHA1_MSG2( M2, M3 )
+                  SHA1_RNDS4( 3, E0 )
+
+                  SHA1_NEXTE( M3, E1, E0 )
+                  SHA1_RNDS4( 3, E1 )
+
+                  "sha1nexte %%xmm10, " E0 "         \n\t"
+                  "paddd    %%xmm9, %%xmm1           \n\t"
+                  "add      $64, %1                  \n\t"
+                  "sub      $1, %2                   \n\t"
+                  "jnz      1b                       \n\t"
+
+                  "pshufd   $0x1B, %%xmm1, %%xmm1    \n\t"
+                  "movdqu   %%xmm1, (%0)             \n\t"
+                  "psrldq   $12, %%xmm2              \n\t"
+                  "movd     %%xmm2, 16(%0)           \n\t"
+                  : "+r" (state), "+r" (data), "+r" (nblocks)
+                  : "r" (sha1_bswap_mask)
+                  : "memory", "cc", "xmm0", "xmm1", "xmm2", "xmm3", "xmm4", "xmm5",
+                    "xmm6", "xmm7", "xmm8", "xmm9", "xmm10" );
+}
+
+/*
+ * Multi-buffer kernels [MB-WP].
+ *
+ * Each 32-bit word of the state is held in a vector of one word per lane,
+ * so every instruction advances MBEDTLS_SHANI_LANES independent messages by
+ * the same step. The body is written once with GCC vector extensions and
+ * compiled twice: for the baseline x86-64 target, where each 256-bit vector
+ * is split into two SSE2 registers, and for AVX2.
+ */
+typedef uint32_t shani_u32x8 __attribute__((vector_size(32)));
+
+#define VROTL(x,n) ( ( (x) << (n) ) | ( (x) >> ( 32 - (n) ) ) )
+#define VROTR(x,n) ( ( (x) >> (n) ) | ( (x) << ( 32 - (n) ) ) )
+
+static inline __attribute__((always_inline))
+void shani_load_words( shani_u32x8 *w,
+                       const unsigned char *data[MBEDTLS_SHANI_LANES],
+                       size_t offset )
+{
+    uint32_t tmp[MBEDTLS_SHANI_LANES];
+    size_t l;
+
+    for( l = 0; l < MBEDTLS_SHANI_LANES; l++ )
+        GET_UINT32_BE( tmp[l], data[l], offset );
+
+    memcpy( w, tmp, sizeof( tmp ) );
+}
+
+static const uint32_t sha1_k[4] =
+{
+    0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6
+};
+
+static inline __attribute__((always_inline))
+void sha1_x8_body( uint32_t state[5][MBEDTLS_SHANI_LANES],
+                   const unsigned char *data[MBEDTLS_SHANI_LANES] )
+{
+    shani_u32x8 W[16], A, B, C, D, E, S[5], F, temp;
+    unsigned int t;
+
+    memcpy( S, state, sizeof( S ) );
+    A = S[0]; B = S[1]; C = S[2]; D = S[3]; E = S[4];
+
+    for( t = 0; t < 80; t++ )
+    {
+        if( t < 16 )
+            shani_load_words( &W[t], data, 4 * t );
+        else
+        {
+            temp = W[( t - 3 ) & 0x0F] ^ W[( t - 8 ) & 0x0F] ^
+                   W[( t - 14 ) & 0x0F] ^ W[t & 0x0F];
+            W[t & 0x0F] = VROTL( temp, 1 );
+        }
+
+        if( t < 20 )
+            F = D ^ ( B & ( C ^ D ) );
+        else if( t < 40 || t >= 60 )
+            F = B ^ C ^ D;
+        else
+            F = ( B & C ) | ( D & ( B | C ) );
+
+        temp = VROTL( A, 5 ) + F + E + sha1_k[t / 20] + W[t & 0x0F];
+        E = D; D = C; C = VROTL( B, 30 ); B = A; A = temp;
+    }
+
+    S[0] += A; S[1] += B; S[2] += C; S[3] += D; S[4] += E;
+    memcpy( state, S, sizeof( S ) );
+}
+
+static inline __attribute__((always_inline))
+void sha256_x8_body( uint32_t state[8][MBEDTLS_SHANI_LANES],
+                     const unsigned char *data[MBEDTLS_SHANI_LANES] )
+{
+    shani_u32x8 W[16], A[8], S[8], temp1, temp2;
+    unsigned int t, i;
+
+    memcpy( S, state, sizeof( S ) );
+    for( i = 0; i < 8; i++ )
+        A[i] = S[i];
+
+    for( t = 0; t < 64; t++ )
+    {
+        if( t < 16 )
+            shani_load_words( &W[t], data, 4 * t );
+        else
+        {
+            shani_u32x8 w2 = W[( t - 2 ) & 0x0F], w15 = W[( t - 15 ) & 0x0F];
+
+            W[t & 0x0F] += ( VROTR( w2, 17 ) ^ VROTR( w2, 19 ) ^ ( w2 >> 10 ) )
+                         + W[( t - 7 ) & 0x0F]
+                         + ( VROTR( w15, 7 ) ^ VROTR( w15, 18 ) ^ ( w15 >> 3 ) );
+        }
+
+        temp1 = A[7] + ( VROTR( A[4], 6 ) ^ VROTR( A[4], 11 ) ^ VROTR( A[4], 25 ) )
+              + ( A[6] ^ ( A[4] & ( A[5] ^ A[6] ) ) )
+              + sha256_k[t] + W[t & 0x0F];
+        temp2 = ( VROTR( A[0], 2 ) ^ VROTR( A[0], 13 ) ^ VROTR( A[0], 22 ) )
+              + ( ( A[0] & A[1] ) | ( A[2] & ( A[0] | A[1] ) ) );
+
+        A[7] = A[6]; A[6] = A[5]; A[5] = A[4]; A[4] = A[3] + temp1;
+        A[3] = A[2]; A[2] = A[1]; A[1] = A[0]; A[0] = temp1 + temp2;
+    }
+
+    for( i = 0; i < 8; i++ )
+        S[i] += A[i];
+    memcpy( state, S, sizeof( S ) );
+}
+
+static void sha1_x8_sse2( uint32_t state[5][MBEDTLS_SHANI_LANES],
+                          const unsigned char *data[MBEDTLS_SHANI_LANES] )
+{
+    sha1_x8_body( state, data );
+}
+
+static __attribute__((target("avx2")))
+void sha1_x8_avx2( uint32_t state[5][MBEDTLS_SHANI_LANES],
+                   const unsigned char *data[MBEDTLS_SHANI_LANES] )
+{
+    sha1_x8_body( state, data );
+}
+
+static void sha256_x8_sse2( uint32_t state[8][MBEDTLS_SHANI_LANES],
+                            const unsigned char *data[MBEDTLS_SHANI_LANES] )
+{
+    sha256_x8_body( state, data );
+}
+
+static __attribute__((target("avx2")))
+void sha256_x8_avx2( uint32_t state[8][MBEDTLS_SHANI_LANES],
+                     const unsigned char *data[MBEDTLS_SHANI_LANES] )
+{
+    sha256_x8_body( state, data );
+}
+
+void mbedtls_shani_sha1_process_x8( uint32_t state[5][MBEDTLS_SHANI_LANES],
+                    const unsigned char *data[MBEDTLS_SHANI_LANES] )
+{
+    if( mbedtls_shani_has_support( MBEDTLS_SHANI_AVX2 ) )
+        sha1_x8_avx2( state, data );
+    else
+        sha1_x8_sse2( state, data );
+}
+
+void mbedtls_shani_sha256_process_x8( uint32_t state[8][MBEDTLS_SHANI_LANES],
+                    const unsigned char *data[MBEDTLS_SHANI_LANES] )
+{
+    if( mbedtls_shani_has_support( MBEDTLS_SHANI_AVX2 ) )
+        sha256_x8_avx2( state, data );
+    else
+        sha256_x8_sse2( state, data );
+}
+
+/*
+ * SHA-512 with an AVX2 message schedule [512-WP].
+ *
+ * The rounds are inherently serial and stay in general purpose registers
+ * (BMI2 gives non-destructive rotates). The schedule for rounds t+16 .. t+23
+ * is computed in vector registers, four words at a time, while the scalar
+ * units run rounds t .. t+7, and stored with the round constants added.
+ * Of four new words only the first two can use sigma1 of words already
+ * known; the other two take sigma1 of the first two.
+ */
+typedef uint64_t shani_u64x4 __attribute__((vector_size(32)));
+typedef uint64_t shani_u64x2 __attribute__((vector_size(16)));
+typedef unsigned char shani_u8x32 __attribute__((vector_size(32)));
+
+static const uint64_t sha512_k[80] __attribute__((aligned(32))) =
+{
+    0x428A2F98D728AE22ULL,  0x7137449123EF65CDULL,
+    0xB5C0FBCFEC4D3B2FULL,  0xE9B5DBA58189DBBCULL,
+    0x3956C25BF348B538ULL,  0x59F111F1B605D019ULL,
+    0x923F82A4AF194F9BULL,  0xAB1C5ED5DA6D8118ULL,
+    0xD807AA98A3030242ULL,  0x12835B0145706FBEULL,
+    0x243185BE4EE4B28CULL,  0x550C7DC3D5FFB4E2ULL,
+    0x72BE5D74F27B896FULL,  0x80DEB1FE3B1696B1ULL,
+    0x9BDC06A725C71235ULL,  0xC19BF174CF692694ULL,
+    0xE49B69C19EF14AD2ULL,  0xEFBE4786384F25E3ULL,
+    0x0FC19DC68B8CD5B5ULL,  0x240CA1CC77AC9C65ULL,
+    0x2DE92C6F592B0275ULL,  0x4A7484AA6EA6E483ULL,
+    0x5CB0A9DCBD41FBD4ULL,  0x76F988DA831153B5ULL,
+    0x983E5152EE66DFABULL,  0xA831C66D2DB43210ULL,
+    0xB00327C898FB213FULL,  0xBF597FC7BEEF0EE4ULL,
+    0xC6E00BF33DA88FC2ULL,  0xD5A79147930AA725ULL,
+    0x06CA6351E003826FULL,  0x142929670A0E6E70ULL,
+    0x27B70A8546D22FFCULL,  0x2E1B21385C26C926ULL,
+    0x4D2C6DFC5AC42AEDULL,  0x53380D139D95B3DFULL,
+    0x650A73548BAF63DEULL,  0x766A0ABB3C77B2A8ULL,
+    0x81C2C92E47EDAEE6ULL,  0x92722C851482353BULL,
+    0xA2BFE8A14CF10364ULL,  0xA81A664BBC423001ULL,
+    0xC24B8B70D0F89791ULL,  0xC76C51A30654BE30ULL,
+    0xD192E819D6EF5218ULL,  0xD69906245565A910ULL,
+    0xF40E35855771202AULL,  0x106AA07032BBD1B8ULL,
+    0x19A4C116B8D2D0C8ULL,  0x1E376C085141AB53ULL,
+    0x2748774CDF8EEB99ULL,  0x34B0BCB5E19B48A8ULL,
+    0x391C0CB3C5C95A63ULL,  0x4ED8AA4AE3418ACBULL,
+    0x5B9CCA4F7763E373ULL,  0x682E6FF3D6B2B8A3ULL,
+    0x748F82EE5DEFB2FCULL,  0x78A5636F43172F60ULL,
+    0x84C87814A1F0AB72ULL,  0x8CC702081A6439ECULL,
+    0x90BEFFFA23631E28ULL,  0xA4506CEBDE82BDE9ULL,
+    0xBEF9A3F7B2C67915ULL,  0xC67178F2E372532BULL,
+    0xCA273ECEEA26619CULL,  0xD186B8C721C0C207ULL,
+    0xEADA7DD6CDE0EB1EULL,  0xF57D4F7FEE6ED178ULL,
+    0x06F067AA72176FBAULL,  0x0A637DC5A2C898A6ULL,
+    0x113F9804BEF90DAEULL,  0x1B710B35131C471BULL,
+    0x28DB77F523047D84ULL,  0x32CAAB7B40C72493ULL,
+    0x3C9EBE0A15C9BEBCULL,  0x431D67C49C100D4CULL,
+    0x4CC5D4BECB3E42B6ULL,  0x597F299CFC657E2AULL,
+    0x5FCB6FAB3AD6FAECULL,  0x6C44198C4A475817ULL
+};
+
+#define ROTR64(x,n) ( ( (x) >> (n) ) | ( (x) << ( 64 - (n) ) ) )
+
+#define SHA512_S0(x) ( ROTR64(x, 1) ^ ROTR64(x, 8) ^ ( (x) >> 7 ) )
+#define SHA512_S1(x) ( ROTR64(x,19) ^ ROTR64(x,61) ^ ( (x) >> 6 ) )
+#define SHA512_S2(x) ( ROTR64(x,28) ^ ROTR64(x,34) ^ ROTR64(x,39) )
+#define SHA512_S3(x) ( ROTR64(x,14) ^ ROTR64(x,18) ^ ROTR64(x,41) )
+
+#define SHA512_F0(x,y,z) ( ( (x) & (y) ) | ( (z) & ( (x) | (y) ) ) )
+#define SHA512_F1(x,y,z) ( (z) ^ ( (x) & ( (y) ^ (z) ) ) )
+
+#define SHA512_P(a,b,c,d,e,f,g,h,wk)                                  \
+{                                                                       \
+    temp1 = h + SHA512_S3(e) + SHA512_F1(e,f,g) + (wk);                 \
+    temp2 = SHA512_S2(a) + SHA512_F0(a,b,c);                            \
+    d += temp1; h = temp1 + temp2;                                      \
+}
+
+/* W[t .. t+3] from W[t-16 .. t-1]; WK[t .. t+3] = W[t .. t+3] + K */
+static inline __attribute__((always_inline))
+void sha512_schedule4( uint64_t *W, uint64_t *WK, unsigned int t )
+{
+    shani_u64x4 w16, w15, w7, v, k;
+    shani_u64x2 w2, lo, hi;
+
+    memcpy( &w16, W + t - 16, 32 );
+    memcpy( &w15, W + t - 15, 32 );
+    memcpy( &w7,  W + t -  7, 32 );
+    v = w16 + SHA512_S0( w15 ) + w7;
+
+    memcpy( &lo, &v, 16 );
+    memcpy( &hi, (unsigned char *) &v + 16, 16 );
+    memcpy( &w2, W + t - 2, 16 );
+    lo += SHA512_S1( w2 );
+    hi += SHA512_S1( lo );
+    memcpy( W + t, &lo, 16 );
+    memcpy( W + t + 2, &hi, 16 );
+
+    memcpy( &v, W + t, 32 );
+    memcpy( &k, sha512_k + t, 32 );
+    v += k;
+    memcpy( WK + t, &v, 32 );
+}
+
+__attribute__((target("avx2,bmi2")))
+void mbedtls_shani_sha512_process( uint64_t state[8],
+                                   const unsigned char *data,
+                                   size_t nblocks )
+{
+    static const shani_u8x32 bswap64 =
+    {
+         7,  6,  5,  4,  3,  2,  1,  0, 15, 14, 13, 12, 11, 10,  9,  8,
+        23, 22, 21, 20, 19, 18, 17, 16, 31, 30, 29, 28, 27, 26, 25, 24
+    };
+    uint64_t W[80] __attribute__((aligned(32)));
+    uint64_t WK[80] __attribute__((aligned(32)));
+    uint64_t A, B, C, D, E, F, G, H, temp1, temp2;
+    shani_u8x32 b;
+    shani_u64x4 v, k;
+    unsigned int t;
+
+    for( ; nblocks > 0; nblocks--, data += 128 )
+    {
+        for( t = 0; t < 16; t += 4 )
+        {
+            memcpy( &b, data + 8 * t, 32 );
+            b = __builtin_shuffle( b, bswap64 );
+            memcpy( &v, &b, 32 );
+            memcpy( &k, sha512_k + t, 32 );
+            memcpy( W + t, &v, 32 );
+            v += k;
+            memcpy( WK + t, &v, 32 );
+        }
+
+        A = state[0]; B = state[1]; C = state[2]; D = state[3];
+        E = state[4]; F = state[5]; G = state[6]; H = state[7];
+
+        for( t = 0; t < 80; t += 8 )
+        {
+            if( t < 64 )
+            {
+                sha512_schedule4( W, WK, t + 16 );
+                sha512_schedule4( W, WK, t + 20 );
+            }
+
+            SHA512_P( A, B, C, D, E, F, G, H, WK[t    ] );
+            SHA512_P( H, A, B, C, D, E, F, G, WK[t + 1] );
+            SHA512_P( G, H, A, B, C, D, E, F, WK[t + 2] );
+            SHA512_P( F, G, H, A, B, C, D, E, WK[t + 3] );
+            SHA512_P( E, F, G, H, A, B, C, D, WK[t + 4] );
+            SHA512_P( D, E, F, G, H, A, B, C, WK[t + 5] );
+            SHA512_P( C, D, E, F, G, H, A, B, WK[t + 6] );
+            SHA512_P( B, C, D, E, F, G, H, A, WK[t + 7] );
+        }
+
+        state[0] += A; state[1] += B; state[2] += C; state[3] += D;
+        state[4] += E; state[5] += F; state[6] += G; state[7] += H;
+    }
+}
+
+/*
+ * One lane of mbedtls_shani_finish_lanes(). The rest of a message is the
+ * data buffered in its context, the caller's input and the padding; it is
+ * handed out one 64-byte block at a time, reading whole blocks directly from
+ * the caller's buffer.
+ */
+typedef struct
+{
+    void *ctx;                      /*!< context being finished, or NULL  */
+    uint32_t *state;                /*!< chaining state in ctx            */
+    const unsigned char *input;     /*!< next whole block of input        */
+    size_t nblocks;                 /*!< whole blocks left at input       */
+    int has_head;                   /*!< head is the next block           */
+    size_t tail_off;                /*!< offset of the next tail block    */
+    size_t tail_len;                /*!< 64 or 128 bytes of padded tail   */
+    unsigned char head[64];         /*!< buffered data completed by input */
+    unsigned char tail[128];        /*!< last input bytes and padding     */
+}
+shani_lane;
+
+static void shani_lane_load( shani_lane *lane,
+                             const mbedtls_shani_lanes_info *info,
+                             void *ctx,
+                             const unsigned char *input, size_t ilen )
+{
+    uint32_t *total = (uint32_t *)( (unsigned char *) ctx + info->total_off );
+    const unsigned char *buffer = (unsigned char *) ctx + info->buffer_off;
+    size_t left = total[0] & 0x3F;
+    size_t used;
+    uint32_t high, low;
+
+    total[0] += (uint32_t) ilen;
+    total[0] &= 0xFFFFFFFF;
+
+    if( total[0] < (uint32_t) ilen )
+        total[1]++;
+
+    lane->ctx = ctx;
+    lane->state = (uint32_t *)( (unsigned char *) ctx + info->state_off );
+    lane->has_head = 0;
+
+    if( left != 0 && left + ilen >= 64 )
+    {
+        memcpy( lane->head, buffer, left );
+        memcpy( lane->head + left, input, 64 - left );
+        input += 64 - left;
+        ilen  -= 64 - left;
+        left = 0;
+        lane->has_head = 1;
+    }
+
+    lane->input = input;
+    lane->nblocks = ilen / 64;
+    input += ilen & ~( (size_t) 63 );
+    ilen  &= 63;
+
+    memcpy( lane->tail, buffer, left );
+    memcpy( lane->tail + left, input, ilen );
+    used = left + ilen;
+    lane->tail[used++] = 0x80;
+
+    lane->tail_off = 0;
+    lane->tail_len = ( used <= 56 ) ? 64 : 128;
+    memset( lane->tail + used, 0, lane->tail_len - 8 - used );
+
+    high = ( total[0] >> 29 )
+         | ( total[1] <<  3 );
+    low  = ( total[0] <<  3 );
+
+    PUT_UINT32_BE( high, lane->tail, lane->tail_len - 8 );
+    PUT_UINT32_BE( low,  lane->tail, lane->tail_len - 4 );
+}
+
+static const unsigned char *shani_lane_next( shani_lane *lane )
+{
+    const unsigned char *block;
+
+    if( lane->has_head )
+    {
+        lane->has_head = 0;
+        return( lane->head );
+    }
+
+    if( lane->nblocks > 0 )
+    {
+        block = lane->input;
+        lane->input += 64;
+        lane->nblocks--;
+        return( block );
+    }
+
+    if( lane->tail_off < lane->tail_len )
+    {
+        block = lane->tail + lane->tail_off;
+        lane->tail_off += 64;
+        return( block );
+    }
+
+    return( NULL );
+}
+
+/*
+ * Run up to MBEDTLS_SHANI_LANES messages through the multi-buffer kernel,
+ * starting the next message in a lane as soon as the previous one is done.
+ * When too few messages remain to fill the lanes, finish them one by one.
+ */
+int mbedtls_shani_finish_lanes( const mbedtls_shani_lanes_info *info,
+                                void * const ctx[],
+                                const unsigned char * const input[],
+                                const size_t ilen[],
+                                size_t count )
+{
+    static const unsigned char idle[64] = { 0 };
+    shani_lane lanes[MBEDTLS_SHANI_LANES];
+    uint32_t S[8][MBEDTLS_SHANI_LANES];
+    const unsigned char *blocks[MBEDTLS_SHANI_LANES];
+    size_t next = 0, active, l, i;
+    int ret = 0;
+
+    for( l = 0; l < MBEDTLS_SHANI_LANES; l++ )
+        lanes[l].ctx = NULL;
+
+    for( ;; )
+    {
+        active = 0;
+
+        for( l = 0; l < MBEDTLS_SHANI_LANES; l++ )
+        {
+            shani_lane *lane = &lanes[l];
+
+            if( lane->ctx != NULL &&
+                ( blocks[l] = shani_lane_next( lane ) ) == NULL )
+            {
+                for( i = 0; i < info->state_words; i++ )
+                    lane->state[i] = S[i][l];
+
+                lane->ctx = NULL;
+            }
+
+            if( lane->ctx == NULL && next < count )
+            {
+                shani_lane_load( lane, info, ctx[next], input[next],
+                                 ilen[next] );
+                for( i = 0; i < info->state_words; i++ )
+                    S[i][l] = lane->state[i];
+
+                blocks[l] = shani_lane_next( lane );
+                next++;
+            }
+
+            if( lane->ctx == NULL )
+                blocks[l] = idle;
+            else
+                active++;
+        }
+
+        if( active == 0 )
+            break;
+
+        if( next == count && active < info->min_lanes )
+        {
+            for( l = 0; l < MBEDTLS_SHANI_LANES; l++ )
+            {
+                shani_lane *lane = &lanes[l];
+
+                if( lane->ctx == NULL )
+                    continue;
+
+                for( i = 0; i < info->state_words; i++ )
+                    lane->state[i] = S[i][l];
+
+                do
+                {
+                    if( ( ret = info->process( lane->ctx, blocks[l] ) ) != 0 )
+                        goto exit;
+                }
+                while( ( blocks[l] = shani_lane_next( lane ) ) != NULL );
+            }
+            break;
+        }
+
+        info->process_x8( S, blocks );
+    }
+
+exit:
+    mbedtls_platform_zeroize( lanes, sizeof( lanes ) );
+    mbedtls_platform_zeroize( S, sizeof( S ) );
+
+    return( ret );
+}
+
+#endif /* MBEDTLS_HAVE_X86_64 */
+
+#endif /* MBEDTLS_SHANI_C */
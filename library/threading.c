@@ -20,8 +20,9 @@
  */
 
 /*
- * Ensure gmtime_r is available even with -std=c99; must be defined before
- * config.h, which pulls in glibc's features.h. Harmless on other platforms.
+ * Ensure gmtime_r and clock_gettime are available even with -std=c99; must
+ * be defined before config.h, which pulls in glibc's features.h. Harmless on
+ * other platforms.
  */
 #if !defined(_POSIX_C_SOURCE)
 #define _POSIX_C_SOURCE 200112L
@@ -37,6 +38,11 @@
 
 #include "mbedtls/threading.h"
 
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include <errno.h>
+#include <time.h>
+#endif
+
 #if defined(MBEDTLS_HAVE_TIME_DATE) && !defined(MBEDTLS_PLATFORM_GMTIME_R_ALT)
 
 #if !defined(_WIN32) && (defined(unix) || \
@@ -117,6 +123,120 @@ int (*mbedtls_mutex_unlock)( mbedtls_threading_mutex_t * ) = threading_mutex_unl
  */
 #define MUTEX_INIT  = { PTHREAD_MUTEX_INITIALIZER, 1 }
 
+static void *threading_thread_run( void *data )
+{
+    mbedtls_threading_thread_t *thread = (mbedtls_threading_thread_t *) data;
+
+    thread->fn( thread->arg );
+
+    return( NULL );
+}
+
+int mbedtls_threading_thread_create( mbedtls_threading_thread_t *thread,
+                                     void (*fn)( void * ), void *arg )
+{
+    thread->fn = fn;
+    thread->arg = arg;
+
+    if( pthread_create( &thread->thread, NULL,
+                        threading_thread_run, thread ) != 0 )
+        return( MBEDTLS_ERR_THREADING_THREAD_ERROR );
+
+    return( 0 );
+}
+
+void mbedtls_threading_thread_join( mbedtls_threading_thread_t *thread )
+{
+    (void) pthread_join( thread->thread, NULL );
+}
+
+int mbedtls_threading_cond_timedwait( pthread_cond_t *cond,
+                                      pthread_mutex_t *mutex,
+                                      unsigned int ms )
+{
+    struct timespec deadline;
+    int ret;
+
+    if( clock_gettime( CLOCK_REALTIME, &deadline ) != 0 )
+        return( MBEDTLS_ERR_THREADING_THREAD_ERROR );
+
+    deadline.tv_sec += ms / 1000;
+    deadline.tv_nsec += (long) ( ms % 1000 ) * 1000000L;
+    if( deadline.tv_nsec >= 1000000000L )
+    {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+
+    ret = pthread_cond_timedwait( cond, mutex, &deadline );
+    if( ret != 0 && ret != ETIMEDOUT )
+        return( MBEDTLS_ERR_THREADING_THREAD_ERROR );
+
+    return( 0 );
+}
+
+typedef struct
+{
+    int (*fn)( void *, size_t, size_t );
+    void *arg;
+    size_t first;
+    size_t n;
+    int ret;
+} threading_share;
+
+static void threading_share_run( void *data )
+{
+    threading_share *share = (threading_share *) data;
+
+    share->ret = share->fn( share->arg, share->first, share->n );
+}
+
+int mbedtls_threading_split( int (*fn)( void *arg, size_t first, size_t n ),
+                             void *arg, size_t count, unsigned int threads )
+{
+    threading_share shares[MBEDTLS_THREADING_MAX_SPLIT];
+    mbedtls_threading_thread_t tids[MBEDTLS_THREADING_MAX_SPLIT];
+    int started[MBEDTLS_THREADING_MAX_SPLIT];
+    size_t done = 0;
+    unsigned int t;
+    int ret = 0;
+
+    if( threads > MBEDTLS_THREADING_MAX_SPLIT )
+        threads = MBEDTLS_THREADING_MAX_SPLIT;
+    if( threads > count )
+        threads = (unsigned int) count;
+    if( threads <= 1 )
+        return( fn( arg, 0, count ) );
+
+    for( t = 0; t < threads; t++ )
+    {
+        shares[t].fn = fn;
+        shares[t].arg = arg;
+        shares[t].first = done;
+        shares[t].n = ( count - done ) / ( threads - t );
+        shares[t].ret = 0;
+        done += shares[t].n;
+
+        started[t] = t > 0 &&
+                     mbedtls_threading_thread_create( &tids[t],
+                                                      threading_share_run,
+                                                      &shares[t] ) == 0;
+    }
+
+    for( t = 0; t < threads; t++ )
+    {
+        if( started[t] )
+            mbedtls_threading_thread_join( &tids[t] );
+        else
+            threading_share_run( &shares[t] );
+
+        if( ret == 0 )
+            ret = shares[t].ret;
+    }
+
+    return( ret );
+}
+
 #endif /* MBEDTLS_THREADING_PTHREAD */
 
 #if defined(MBEDTLS_THREADING_ALT)
@@ -258,6 +258,9 @@ static const char *features[] = {
 #if defined(MBEDTLS_AES_FEWER_TABLES)
     "MBEDTLS_AES_FEWER_TABLES",
 #endif /* MBEDTLS_AES_FEWER_TABLES */
+#if defined(MBEDTLS_AES_BITSLICE)
+    "MBEDTLS_AES_BITSLICE",
+#endif /* MBEDTLS_AES_BITSLICE */
 #if defined(MBEDTLS_CAMELLIA_SMALL_MEMORY)
     "MBEDTLS_CAMELLIA_SMALL_MEMORY",
 #endif /* MBEDTLS_CAMELLIA_SMALL_MEMORY */
@@ -345,6 +348,9 @@ static const char *features[] = {
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC)
     "MBEDTLS_ECDSA_DETERMINISTIC",
 #endif /* MBEDTLS_ECDSA_DETERMINISTIC */
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+    "MBEDTLS_ECDSA_NONCE_POOL",
+#endif /* MBEDTLS_ECDSA_NONCE_POOL */
 #if defined(MBEDTLS_KEY_EXCHANGE_PSK_ENABLED)
     "MBEDTLS_KEY_EXCHANGE_PSK_ENABLED",
 #endif /* MBEDTLS_KEY_EXCHANGE_PSK_ENABLED */
@@ -399,6 +405,9 @@ static const char *features[] = {
 #if defined(MBEDTLS_ENTROPY_FORCE_SHA256)
     "MBEDTLS_ENTROPY_FORCE_SHA256",
 #endif /* MBEDTLS_ENTROPY_FORCE_SHA256 */
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+    "MBEDTLS_ENTROPY_SHARDS",
+#endif /* MBEDTLS_ENTROPY_SHARDS */
 #if defined(MBEDTLS_ENTROPY_NV_SEED)
     "MBEDTLS_ENTROPY_NV_SEED",
 #endif /* MBEDTLS_ENTROPY_NV_SEED */
@@ -429,6 +438,9 @@ static const char *features[] = {
 #if defined(MBEDTLS_RSA_NO_CRT)
     "MBEDTLS_RSA_NO_CRT",
 #endif /* MBEDTLS_RSA_NO_CRT */
+#if defined(MBEDTLS_RSA_CRT_POOL)
+    "MBEDTLS_RSA_CRT_POOL",
+#endif /* MBEDTLS_RSA_CRT_POOL */
 #if defined(MBEDTLS_SELF_TEST)
     "MBEDTLS_SELF_TEST",
 #endif /* MBEDTLS_SELF_TEST */
@@ -546,6 +558,9 @@ static const char *features[] = {
 #if defined(MBEDTLS_ZLIB_SUPPORT)
     "MBEDTLS_ZLIB_SUPPORT",
 #endif /* MBEDTLS_ZLIB_SUPPORT */
+#if defined(MBEDTLS_ADX_C)
+    "MBEDTLS_ADX_C",
+#endif /* MBEDTLS_ADX_C */
 #if defined(MBEDTLS_AESNI_C)
     "MBEDTLS_AESNI_C",
 #endif /* MBEDTLS_AESNI_C */
@@ -618,6 +633,15 @@ static const char *features[] = {
 #if defined(MBEDTLS_ECP_C)
     "MBEDTLS_ECP_C",
 #endif /* MBEDTLS_ECP_C */
+#if defined(MBEDTLS_ECP_P256_C)
+    "MBEDTLS_ECP_P256_C",
+#endif /* MBEDTLS_ECP_P256_C */
+#if defined(MBEDTLS_ECP_X25519_C)
+    "MBEDTLS_ECP_X25519_C",
+#endif /* MBEDTLS_ECP_X25519_C */
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+    "MBEDTLS_ECP_PRECOMP_CACHE",
+#endif /* MBEDTLS_ECP_PRECOMP_CACHE */
 #if defined(MBEDTLS_ENTROPY_C)
     "MBEDTLS_ENTROPY_C",
 #endif /* MBEDTLS_ENTROPY_C */
@@ -720,6 +744,9 @@ static const char *features[] = {
 #if defined(MBEDTLS_SHA512_C)
     "MBEDTLS_SHA512_C",
 #endif /* MBEDTLS_SHA512_C */
+#if defined(MBEDTLS_SHANI_C)
+    "MBEDTLS_SHANI_C",
+#endif /* MBEDTLS_SHANI_C */
 #if defined(MBEDTLS_SSL_CACHE_C)
     "MBEDTLS_SSL_CACHE_C",
 #endif /* MBEDTLS_SSL_CACHE_C */
@@ -51,6 +51,7 @@ int main( void )
 #include "mbedtls/md4.h"
 #include "mbedtls/md5.h"
 #include "mbedtls/ripemd160.h"
+#include "mbedtls/md.h"
 #include "mbedtls/sha1.h"
 #include "mbedtls/sha256.h"
 #include "mbedtls/sha512.h"
@@ -59,6 +60,7 @@ int main( void )
 #include "mbedtls/des.h"
 #include "mbedtls/aes.h"
 #include "mbedtls/aria.h"
+#include "mbedtls/cipher.h"
 #include "mbedtls/blowfish.h"
 #include "mbedtls/camellia.h"
 #include "mbedtls/chacha20.h"
@@ -66,11 +68,14 @@ int main( void )
 #include "mbedtls/ccm.h"
 #include "mbedtls/chachapoly.h"
 #include "mbedtls/cmac.h"
+#include "mbedtls/nist_kw.h"
 #include "mbedtls/poly1305.h"
 
 #include "mbedtls/havege.h"
+#include "mbedtls/entropy.h"
 #include "mbedtls/ctr_drbg.h"
 #include "mbedtls/hmac_drbg.h"
+#include "mbedtls/pkcs5.h"
 
 #include "mbedtls/rsa.h"
 #include "mbedtls/dhm.h"
@@ -83,6 +88,14 @@ int main( void )
 #include "mbedtls/memory_buffer_alloc.h"
 #endif
 
+#if defined(MBEDTLS_ADX_C)
+#include "mbedtls/adx.h"
+#endif
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+#include <pthread.h>
+#endif
+
 /*
  * For heap usage estimates, we need an estimate of the overhead per allocated
  * block. ptmalloc2/3 (used in gnu libc for instance) uses 2 size_t per block,
@@ -99,13 +112,17 @@ int main( void )
 #define HEADER_FORMAT   "  %-24s :  "
 #define TITLE_LEN       25
 
+/* Many short messages: BUFSIZE split into MULTI_COUNT messages */
+#define MULTI_COUNT     16
+#define MULTI_LEN       ( BUFSIZE / MULTI_COUNT )
+
 #define OPTIONS                                                         \
     "md4, md5, ripemd160, sha1, sha256, sha512,\n"                      \
     "arc4, des3, des, camellia, blowfish, chacha20,\n"                  \
-    "aes_cbc, aes_gcm, aes_ccm, aes_ctx, chachapoly,\n"                 \
-    "aes_cmac, des3_cmac, poly1305\n"                                   \
-    "havege, ctr_drbg, hmac_drbg\n"                                     \
-    "rsa, dhm, ecdsa, ecdh.\n"
+    "aes_cbc, aes_gcm, aes_ccm, aes_ctx, aes_bs, chachapoly,\n"         \
+    "cipher_iov, aes_cmac, des3_cmac, aes_kw, poly1305\n"              \
+    "havege, entropy, ctr_drbg, hmac_drbg, pbkdf2\n"                    \
+    "mpi, rsa, dhm, ecdsa, ecdh.\n"
 
 #if defined(MBEDTLS_ERROR_C)
 #define PRINT_ERROR                                                     \
@@ -198,6 +215,38 @@ do {                                                                    \
     }                                                                   \
 } while( 0 )
 
+/*
+ * Average latency of one operation, for operations that run on several
+ * threads and whose CPU time doesn't reflect their duration
+ */
+#define TIME_LATENCY( TITLE, TYPE, CODE )                               \
+do {                                                                    \
+    unsigned long ii, ms;                                               \
+    int ret;                                                            \
+    struct mbedtls_timing_hr_time timer;                                \
+                                                                        \
+    mbedtls_printf( HEADER_FORMAT, TITLE );                             \
+    fflush( stdout );                                                   \
+    mbedtls_set_alarm( 3 );                                             \
+    (void) mbedtls_timing_get_timer( &timer, 1 );                       \
+                                                                        \
+    ret = 0;                                                            \
+    for( ii = 0; ! mbedtls_timing_alarmed && ! ret ; ii++ )             \
+    {                                                                   \
+        CODE;                                                           \
+    }                                                                   \
+    ms = mbedtls_timing_get_timer( &timer, 0 );                         \
+                                                                        \
+    if( ret != 0 )                                                      \
+    {                                                                   \
+        PRINT_ERROR;                                                    \
+    }                                                                   \
+    else                                                                \
+    {                                                                   \
+        mbedtls_printf( "%6lu us/" TYPE "\n", ms * 1000 / ii );         \
+    }                                                                   \
+} while( 0 )
+
 static int myrand( void *rng_state, unsigned char *output, size_t len )
 {
     size_t use_len;
@@ -227,15 +276,16 @@ static int myrand( void *rng_state, unsigned char *output, size_t len )
 #if defined(MBEDTLS_ECP_C)
 void ecp_clear_precomputed( mbedtls_ecp_group *grp )
 {
-    if( grp->T != NULL )
+    /* T_size == 0 is the static table of the base point: nothing to clear */
+    if( grp->T != NULL && grp->T_size != 0 )
     {
         size_t i;
         for( i = 0; i < grp->T_size; i++ )
             mbedtls_ecp_point_free( &grp->T[i] );
         mbedtls_free( grp->T );
+        grp->T = NULL;
+        grp->T_size = 0;
     }
-    grp->T = NULL;
-    grp->T_size = 0;
 }
 #else
 #define ecp_clear_precomputed( g )
@@ -243,15 +293,685 @@ void ecp_clear_precomputed( mbedtls_ecp_group *grp )
 
 unsigned char buf[BUFSIZE];
 
+#if defined(MBEDTLS_SHA1_C) || defined(MBEDTLS_SHA256_C) || \
+    defined(MBEDTLS_SHA512_C)
+const unsigned char *multi_in[MULTI_COUNT];
+size_t multi_len[MULTI_COUNT];
+unsigned char multi_out[MULTI_COUNT][64];
+unsigned char *multi_outp[MULTI_COUNT];
+
+static void multi_setup( void )
+{
+    int i;
+
+    for( i = 0; i < MULTI_COUNT; i++ )
+    {
+        multi_in[i] = buf + i * MULTI_LEN;
+        multi_len[i] = MULTI_LEN;
+        multi_outp[i] = multi_out[i];
+    }
+}
+#endif
+
+#if defined(MBEDTLS_SHA1_C)
+static int sha1_seq( void )
+{
+    int i, ret = 0;
+
+    for( i = 0; ret == 0 && i < MULTI_COUNT; i++ )
+        ret = mbedtls_sha1_ret( multi_in[i], multi_len[i], multi_outp[i] );
+
+    return( ret );
+}
+#endif
+
+#if defined(MBEDTLS_SHA256_C)
+static int sha256_seq( void )
+{
+    int i, ret = 0;
+
+    for( i = 0; ret == 0 && i < MULTI_COUNT; i++ )
+        ret = mbedtls_sha256_ret( multi_in[i], multi_len[i],
+                                  multi_outp[i], 0 );
+
+    return( ret );
+}
+#endif
+
+#if defined(MBEDTLS_SHA512_C)
+static int sha512_seq( void )
+{
+    int i, ret = 0;
+
+    for( i = 0; ret == 0 && i < MULTI_COUNT; i++ )
+        ret = mbedtls_sha512_ret( multi_in[i], multi_len[i],
+                                  multi_outp[i], 0 );
+
+    return( ret );
+}
+#endif
+
+#if defined(MBEDTLS_PKCS5_C)
+#define PBKDF2_ITERATIONS   1000
+
+/*
+ * Time PBKDF2 with PBKDF2_ITERATIONS iterations; report iterations of
+ * the whole derivation per second
+ */
+static void pbkdf2_bench( const char *title, mbedtls_md_type_t md_type,
+                          uint32_t key_len )
+{
+    unsigned long ii;
+    int ret = 0;
+    unsigned char tmp[200];
+    mbedtls_md_context_t md_ctx;
+
+    mbedtls_md_init( &md_ctx );
+    if( mbedtls_md_setup( &md_ctx, mbedtls_md_info_from_type( md_type ),
+                          1 ) != 0 )
+        mbedtls_exit( 1 );
+
+    mbedtls_printf( HEADER_FORMAT, title );
+    fflush( stdout );
+    mbedtls_set_alarm( 3 );
+
+    for( ii = 0; ! mbedtls_timing_alarmed && ret == 0; ii++ )
+    {
+        ret = mbedtls_pkcs5_pbkdf2_hmac( &md_ctx, (unsigned char *) "password",
+                                         8, buf, 16, PBKDF2_ITERATIONS,
+                                         key_len, tmp );
+    }
+
+    if( ret != 0 )
+    {
+        PRINT_ERROR;
+    }
+    else
+        mbedtls_printf( "%9lu iterations/s\n",
+                        ii * PBKDF2_ITERATIONS / 3 );
+
+    mbedtls_md_free( &md_ctx );
+}
+#endif
+
+#if defined(MBEDTLS_CIPHER_C)
+/*
+ * A packet spread over network buffers: header, then payload fragments
+ */
+static const size_t packet_segs[] = { 54, 256, 512, 512, 170 };
+#define PACKET_SEGS     ( sizeof( packet_segs ) / sizeof( packet_segs[0] ) )
+#define PACKET_LEN      1504
+
+/*
+ * Encrypt a fragmented packet in place, either by copying it to a
+ * contiguous buffer and back, or directly with the _iov() functions
+ */
+static void cipher_iov_bench( const char *name, mbedtls_cipher_type_t type )
+{
+    unsigned long ii;
+    int ret = 0;
+    unsigned char tmp[200];
+    unsigned char packet[PACKET_LEN];
+    unsigned char flat[PACKET_LEN + 16];
+    unsigned char key[32], iv[16], tag[16];
+    mbedtls_cipher_iov iov[PACKET_SEGS];
+    mbedtls_cipher_context_t ctx;
+    const mbedtls_cipher_info_t *info;
+    char title[TITLE_LEN];
+    size_t i, off, olen, fin;
+    int use_iov, aead;
+
+    if( ( info = mbedtls_cipher_info_from_type( type ) ) == NULL )
+        return;
+
+    aead = info->mode == MBEDTLS_MODE_GCM || info->mode == MBEDTLS_MODE_CCM ||
+           info->mode == MBEDTLS_MODE_CHACHAPOLY;
+
+    memset( key, 0, sizeof( key ) );
+    memset( iv, 0, sizeof( iv ) );
+    memset( packet, 0, sizeof( packet ) );
+
+    for( i = 0, off = 0; i < PACKET_SEGS; off += packet_segs[i++] )
+    {
+        iov[i].base = packet + off;
+        iov[i].len = packet_segs[i];
+    }
+
+    mbedtls_cipher_init( &ctx );
+    if( mbedtls_cipher_setup( &ctx, info ) != 0 ||
+        mbedtls_cipher_setkey( &ctx, key, info->key_bitlen,
+                               MBEDTLS_ENCRYPT ) != 0 )
+        mbedtls_exit( 1 );
+#if defined(MBEDTLS_CIPHER_MODE_WITH_PADDING)
+    if( info->mode == MBEDTLS_MODE_CBC )
+        mbedtls_cipher_set_padding_mode( &ctx, MBEDTLS_PADDING_NONE );
+#endif
+
+    for( use_iov = 0; use_iov <= 1; use_iov++ )
+    {
+        mbedtls_snprintf( title, sizeof( title ), "%s %s", name,
+                          use_iov ? "iov" : "copy" );
+
+        mbedtls_printf( HEADER_FORMAT, title );
+        fflush( stdout );
+        mbedtls_set_alarm( 1 );
+
+        for( ii = 0; ! mbedtls_timing_alarmed && ret == 0; ii++ )
+        {
+            if( aead && use_iov )
+            {
+                ret = mbedtls_cipher_auth_encrypt_iov( &ctx, iv, 12, NULL, 0,
+                            iov, PACKET_SEGS, NULL, 0, &olen, tag, 16 );
+            }
+            else if( use_iov )
+            {
+                if( ( ret = mbedtls_cipher_set_iv( &ctx, iv,
+                                                   info->iv_size ) ) != 0 ||
+                    ( ret = mbedtls_cipher_reset( &ctx ) ) != 0 ||
+                    ( ret = mbedtls_cipher_update_iov( &ctx, iov, PACKET_SEGS,
+                                                   NULL, 0, &olen ) ) != 0 )
+                    break;
+                ret = mbedtls_cipher_finish( &ctx, flat, &fin );
+            }
+            else
+            {
+                for( i = 0, off = 0; i < PACKET_SEGS; off += iov[i++].len )
+                    memcpy( flat + off, iov[i].base, iov[i].len );
+
+                if( aead )
+                    ret = mbedtls_cipher_auth_encrypt( &ctx, iv, 12, NULL, 0,
+                                flat, PACKET_LEN, flat, &olen, tag, 16 );
+                else
+                    ret = mbedtls_cipher_crypt( &ctx, iv, info->iv_size,
+                                flat, PACKET_LEN, flat, &olen );
+
+                for( i = 0, off = 0; i < PACKET_SEGS; off += iov[i++].len )
+                    memcpy( iov[i].base, flat + off, iov[i].len );
+            }
+        }
+
+        if( ret != 0 )
+        {
+            PRINT_ERROR;
+            break;
+        }
+
+        mbedtls_printf( "%9lu packets/s\n", ii );
+    }
+
+    mbedtls_cipher_free( &ctx );
+}
+#endif /* MBEDTLS_CIPHER_C */
+
+#if defined(MBEDTLS_AES_C) && defined(MBEDTLS_CIPHER_MODE_XTS)
+#define XTS_BENCH_LEN       ( 64 * 1024 )
+#define XTS_BENCH_SECTORS   ( XTS_BENCH_LEN / 512 )
+
+static unsigned char xts_bench_buf[XTS_BENCH_LEN];
+
+/*
+ * Encrypt 64 KiB worth of sectors in place, one call per sector or in one
+ * multi-sector call, optionally split between threads
+ */
+static void aes_xts_sectors_bench( mbedtls_aes_xts_context *ctx,
+                                   size_t sector_size, int multi,
+                                   unsigned int threads )
+{
+    unsigned long ii;
+    int ret = 0;
+    unsigned char tmp[200];
+    unsigned char data_unit[16];
+    mbedtls_aes_xts_sector sectors[XTS_BENCH_SECTORS];
+    size_t i, count = XTS_BENCH_LEN / sector_size;
+    /* Large enough for both titles below with any unsigned values */
+    char title[40];
+
+    for( i = 0; i < count; i++ )
+    {
+        sectors[i].data_unit = i;
+        sectors[i].input = xts_bench_buf + i * sector_size;
+        sectors[i].output = xts_bench_buf + i * sector_size;
+    }
+
+    if( threads > 1 )
+        mbedtls_snprintf( title, sizeof( title ), "AES-XTS-128 %uB %u thr",
+                          (unsigned) sector_size, threads );
+    else
+        mbedtls_snprintf( title, sizeof( title ), "AES-XTS-128 %uB %s",
+                          (unsigned) sector_size, multi ? "multi" : "loop" );
+
+    mbedtls_printf( HEADER_FORMAT, title );
+    fflush( stdout );
+    mbedtls_set_alarm( 1 );
+
+    for( ii = 0; ! mbedtls_timing_alarmed && ret == 0; ii++ )
+    {
+        if( threads > 1 )
+        {
+#if defined(MBEDTLS_THREADING_PTHREAD)
+            ret = mbedtls_aes_crypt_xts_multi_threads( ctx,
+                        MBEDTLS_AES_ENCRYPT, sector_size, sectors, count,
+                        threads );
+#endif
+        }
+        else if( multi )
+        {
+            ret = mbedtls_aes_crypt_xts_multi( ctx, MBEDTLS_AES_ENCRYPT,
+                                               sector_size, sectors, count );
+        }
+        else
+        {
+            for( i = 0; ret == 0 && i < count; i++ )
+            {
+                memset( data_unit, 0, sizeof( data_unit ) );
+                data_unit[0] = (unsigned char)( i );
+                data_unit[1] = (unsigned char)( i >> 8 );
+                ret = mbedtls_aes_crypt_xts( ctx, MBEDTLS_AES_ENCRYPT,
+                                             sector_size, data_unit,
+                                             sectors[i].input,
+                                             sectors[i].output );
+            }
+        }
+    }
+
+    if( ret != 0 )
+    {
+        PRINT_ERROR;
+        return;
+    }
+
+    mbedtls_printf( "%9lu MB/s\n", ( ii * XTS_BENCH_LEN ) / 1000000 );
+}
+#endif /* MBEDTLS_AES_C && MBEDTLS_CIPHER_MODE_XTS */
+
+#if defined(MBEDTLS_CTR_DRBG_C) || defined(MBEDTLS_HMAC_DRBG_C)
+#define DRBG_PREFETCH_LEN   1024
+
+/*
+ * Time 16, 32 and 64-byte requests to a DRBG, as made by nonce and key
+ * generation in the TLS handshake
+ */
+static void drbg_small_bench( const char *name,
+                              int (*f_rng)(void *, unsigned char *, size_t),
+                              void *p_rng )
+{
+    unsigned long ii;
+    int ret = 0;
+    unsigned char tmp[200];
+    unsigned char out[64];
+    char title[TITLE_LEN];
+    size_t len;
+
+    for( len = 16; len <= sizeof( out ); len *= 2 )
+    {
+        mbedtls_snprintf( title, sizeof( title ), "%s %dB", name, (int) len );
+
+        mbedtls_printf( HEADER_FORMAT, title );
+        fflush( stdout );
+        mbedtls_set_alarm( 1 );
+
+        for( ii = 0; ! mbedtls_timing_alarmed && ret == 0; ii++ )
+            ret = f_rng( p_rng, out, len );
+
+        if( ret != 0 )
+        {
+            PRINT_ERROR;
+            return;
+        }
+
+        mbedtls_printf( "%9lu requests/s\n", ii );
+    }
+}
+#endif
+
+#if defined(MBEDTLS_CTR_DRBG_C)
+#define CTR_DRBG_BULK_LEN   ( 64 * 1024 )
+
+/*
+ * Time mbedtls_ctr_drbg_random_bulk() on CTR_DRBG_BULK_LEN-byte requests
+ */
+static void ctr_drbg_bulk_bench( mbedtls_ctr_drbg_context *ctx )
+{
+    unsigned long ii;
+    int ret = 0;
+    unsigned char tmp[200];
+    unsigned char *out;
+
+    if( ( out = mbedtls_calloc( 1, CTR_DRBG_BULK_LEN ) ) == NULL )
+        mbedtls_exit( 1 );
+
+    mbedtls_printf( HEADER_FORMAT, "CTR_DRBG bulk 64KiB" );
+    fflush( stdout );
+    mbedtls_set_alarm( 1 );
+
+    for( ii = 0; ! mbedtls_timing_alarmed && ret == 0; ii++ )
+        ret = mbedtls_ctr_drbg_random_bulk( ctx, out, CTR_DRBG_BULK_LEN );
+
+    if( ret != 0 )
+    {
+        PRINT_ERROR;
+    }
+    else
+        mbedtls_printf( "%9lu KiB/s\n", ii * ( CTR_DRBG_BULK_LEN / 1024 ) );
+
+    mbedtls_free( out );
+}
+#endif
+
+#if defined(MBEDTLS_AES_BITSLICE)
+/* Encrypt BUFSIZE bytes as messages of len bytes, table vs bitsliced */
+static int aes_table_msgs( mbedtls_aes_context *ctx, size_t len )
+{
+    size_t i, j;
+    int ret = 0;
+
+    for( i = 0; ret == 0 && i < BUFSIZE; i += len )
+        for( j = 0; ret == 0 && j < len; j += 16 )
+            ret = mbedtls_internal_aes_encrypt( ctx, buf + i + j,
+                                                buf + i + j );
+
+    return( ret );
+}
+
+static int aes_bitsliced_msgs( mbedtls_aes_context *ctx, size_t len )
+{
+    size_t i;
+    int ret = 0;
+
+    for( i = 0; ret == 0 && i < BUFSIZE; i += len )
+        ret = mbedtls_internal_aes_encrypt_bitsliced( ctx, len / 16,
+                                                      buf + i, buf + i );
+
+    return( ret );
+}
+#endif
+
+#if defined(MBEDTLS_MD_C) && defined(MBEDTLS_SHA256_C)
+static int hmac_seq( mbedtls_md_context_t *ctx )
+{
+    int i, ret = 0;
+
+    for( i = 0; ret == 0 && i < MULTI_COUNT; i++ )
+    {
+        if( ( ret = mbedtls_md_hmac_reset( &ctx[i] ) ) != 0 ||
+            ( ret = mbedtls_md_hmac_update( &ctx[i], multi_in[i],
+                                            multi_len[i] ) ) != 0 )
+            break;
+        ret = mbedtls_md_hmac_finish( &ctx[i], multi_outp[i] );
+    }
+
+    return( ret );
+}
+
+static int hmac_multi( mbedtls_md_context_t *ctx,
+                       mbedtls_md_context_t * const pctx[] )
+{
+    int i, ret = 0;
+
+    for( i = 0; ret == 0 && i < MULTI_COUNT; i++ )
+        ret = mbedtls_md_hmac_reset( &ctx[i] );
+
+    if( ret == 0 )
+        ret = mbedtls_md_hmac_finish_multi( pctx, multi_in, multi_len,
+                                            multi_outp, MULTI_COUNT );
+
+    return( ret );
+}
+#endif
+
+#if defined(MBEDTLS_CMAC_C) && defined(MBEDTLS_AES_C)
+static int cmac_seq( mbedtls_cipher_context_t *ctx )
+{
+    int i, ret = 0;
+
+    for( i = 0; ret == 0 && i < MULTI_COUNT; i++ )
+    {
+        if( ( ret = mbedtls_cipher_cmac_reset( ctx ) ) != 0 ||
+            ( ret = mbedtls_cipher_cmac_update( ctx, multi_in[i],
+                                                multi_len[i] ) ) != 0 )
+            break;
+        ret = mbedtls_cipher_cmac_finish( ctx, multi_outp[i] );
+    }
+
+    return( ret );
+}
+#endif
+
+#if defined(MBEDTLS_NIST_KW_C) && defined(MBEDTLS_AES_C)
+/* Key rotation: BUFSIZE worth of 32-byte data keys wrapped under one KEK */
+#define KW_BENCH_KEYS   ( BUFSIZE / 32 )
+
+static unsigned char kw_bench_keys[KW_BENCH_KEYS][32];
+static unsigned char kw_bench_wrapped[KW_BENCH_KEYS][40];
+static mbedtls_nist_kw_job kw_wrap_jobs[KW_BENCH_KEYS];
+static mbedtls_nist_kw_job kw_unwrap_jobs[KW_BENCH_KEYS];
+
+static void kw_bench_setup( void )
+{
+    size_t i;
+
+    for( i = 0; i < KW_BENCH_KEYS; i++ )
+    {
+        memset( kw_bench_keys[i], (int) i, sizeof( kw_bench_keys[i] ) );
+
+        kw_wrap_jobs[i].input = kw_bench_keys[i];
+        kw_wrap_jobs[i].in_len = sizeof( kw_bench_keys[i] );
+        kw_wrap_jobs[i].output = kw_bench_wrapped[i];
+        kw_wrap_jobs[i].out_size = sizeof( kw_bench_wrapped[i] );
+
+        kw_unwrap_jobs[i].input = kw_bench_wrapped[i];
+        kw_unwrap_jobs[i].in_len = sizeof( kw_bench_wrapped[i] );
+        kw_unwrap_jobs[i].output = kw_bench_keys[i];
+        kw_unwrap_jobs[i].out_size = sizeof( kw_bench_keys[i] );
+    }
+}
+
+static int kw_seq( mbedtls_nist_kw_context *ctx, int is_wrap )
+{
+    size_t i, olen;
+    int ret = 0;
+
+    for( i = 0; ret == 0 && i < KW_BENCH_KEYS; i++ )
+    {
+        if( is_wrap )
+            ret = mbedtls_nist_kw_wrap( ctx, MBEDTLS_KW_MODE_KW,
+                                        kw_bench_keys[i], 32,
+                                        kw_bench_wrapped[i], &olen, 40 );
+        else
+            ret = mbedtls_nist_kw_unwrap( ctx, MBEDTLS_KW_MODE_KW,
+                                          kw_bench_wrapped[i], 40,
+                                          kw_bench_keys[i], &olen, 32 );
+    }
+
+    return( ret );
+}
+#endif /* MBEDTLS_NIST_KW_C && MBEDTLS_AES_C */
+
+#if defined(MBEDTLS_ENTROPY_C)
+#define ENTROPY_BENCH_THREADS   16
+
+typedef struct
+{
+    mbedtls_entropy_context *ctx;
+    unsigned long calls;
+    int ret;
+} entropy_bench_data;
+
+/*
+ * Call mbedtls_entropy_func() until the alarm goes off
+ */
+static void *entropy_bench_loop( void *arg )
+{
+    entropy_bench_data *data = (entropy_bench_data *) arg;
+    unsigned char out[MBEDTLS_ENTROPY_BLOCK_SIZE];
+
+    while( ! mbedtls_timing_alarmed && data->ret == 0 )
+    {
+        data->ret = mbedtls_entropy_func( data->ctx, out, sizeof( out ) );
+        data->calls++;
+    }
+
+    return( NULL );
+}
+
+/*
+ * Time mbedtls_entropy_func() called from nthreads threads at once,
+ * as when many connections reseed their DRBGs together
+ */
+static void entropy_bench( int nthreads, int background )
+{
+    mbedtls_entropy_context ctx;
+    entropy_bench_data data[ENTROPY_BENCH_THREADS];
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    pthread_t threads[ENTROPY_BENCH_THREADS];
+#endif
+    char title[TITLE_LEN];
+    unsigned char tmp[200];
+    unsigned long calls = 0;
+    int i, ret = 0;
+
+    mbedtls_entropy_init( &ctx );
+    memset( data, 0, sizeof( data ) );
+
+    mbedtls_snprintf( title, sizeof( title ), "entropy_func %d thr%s",
+                      nthreads, background ? " bg" : "" );
+    mbedtls_printf( HEADER_FORMAT, title );
+    fflush( stdout );
+
+#if defined(MBEDTLS_ENTROPY_SHARDS) && defined(MBEDTLS_THREADING_PTHREAD)
+    if( background &&
+        ( ret = mbedtls_entropy_gather_thread_start( &ctx, 1 ) ) != 0 )
+    {
+        PRINT_ERROR;
+        goto exit;
+    }
+#else
+    ((void) background);
+#endif
+
+    mbedtls_set_alarm( 1 );
+
+    for( i = 0; i < nthreads; i++ )
+        data[i].ctx = &ctx;
+
+#if defined(MBEDTLS_THREADING_PTHREAD)
+    for( i = 0; i < nthreads; i++ )
+        if( pthread_create( &threads[i], NULL,
+                            entropy_bench_loop, &data[i] ) != 0 )
+            mbedtls_exit( 1 );
+
+    for( i = 0; i < nthreads; i++ )
+        pthread_join( threads[i], NULL );
+#else
+    entropy_bench_loop( &data[0] );
+#endif
+
+    for( i = 0; i < nthreads; i++ )
+    {
+        if( data[i].ret != 0 )
+            ret = data[i].ret;
+        calls += data[i].calls;
+    }
+
+    if( ret != 0 )
+    {
+        PRINT_ERROR;
+    }
+    else
+        mbedtls_printf( "%9lu calls/s\n", calls );
+
+#if defined(MBEDTLS_ENTROPY_SHARDS) && defined(MBEDTLS_THREADING_PTHREAD)
+exit:
+#endif
+    mbedtls_entropy_free( &ctx );
+}
+#endif /* MBEDTLS_ENTROPY_C */
+
+#if defined(MBEDTLS_ECDSA_NONCE_POOL) && defined(MBEDTLS_SHA256_C)
+#define ECDSA_BURST_LEN     256
+
+static int cmp_ulong( const void *a, const void *b )
+{
+    unsigned long x = *(const unsigned long *) a;
+    unsigned long y = *(const unsigned long *) b;
+
+    return( ( x > y ) - ( x < y ) );
+}
+
+/*
+ * Time each signature of a burst, without a nonce pool and then with a pool
+ * filled beforehand, and print the distribution of the latencies
+ */
+static void ecdsa_burst_bench( const mbedtls_ecp_curve_info *curve_info )
+{
+    mbedtls_ecdsa_context ecdsa;
+    mbedtls_ecdsa_nonce_pool pool;
+    mbedtls_mpi r, s;
+    unsigned long lat[ECDSA_BURST_LEN], start;
+    char title[TITLE_LEN];
+    unsigned char tmp[200];
+    int i, use_pool, ret = 0;
+
+    mbedtls_ecdsa_init( &ecdsa );
+    mbedtls_ecdsa_nonce_pool_init( &pool );
+    mbedtls_mpi_init( &r ); mbedtls_mpi_init( &s );
+
+    if( mbedtls_ecdsa_genkey( &ecdsa, curve_info->grp_id, myrand, NULL ) != 0 ||
+        mbedtls_ecdsa_nonce_pool_setup( &pool, curve_info->grp_id,
+                                        ECDSA_BURST_LEN, 0, myrand, NULL ) != 0 )
+        mbedtls_exit( 1 );
+
+    for( use_pool = 0; use_pool <= 1 && ret == 0; use_pool++ )
+    {
+        mbedtls_snprintf( title, sizeof( title ), "ECDSA-%s%s",
+                          curve_info->name, use_pool ? " pool" : "" );
+        mbedtls_printf( HEADER_FORMAT, title );
+        fflush( stdout );
+
+        if( use_pool && ( ret = mbedtls_ecdsa_nonce_pool_refill( &pool ) ) != 0 )
+            break;
+
+        for( i = 0; i < ECDSA_BURST_LEN && ret == 0; i++ )
+        {
+            start = mbedtls_timing_hardclock();
+            ret = mbedtls_ecdsa_sign_pool( &ecdsa.grp, &r, &s, &ecdsa.d,
+                                           buf, curve_info->bit_size / 8,
+                                           use_pool ? &pool : NULL,
+                                           myrand, NULL );
+            lat[i] = mbedtls_timing_hardclock() - start;
+        }
+
+        if( ret != 0 )
+            break;
+
+        qsort( lat, ECDSA_BURST_LEN, sizeof( lat[0] ), cmp_ulong );
+        mbedtls_printf( "burst sign p50 %lu, p90 %lu, p99 %lu, max %lu cycles\n",
+                        lat[ECDSA_BURST_LEN / 2],
+                        lat[ECDSA_BURST_LEN * 9 / 10],
+                        lat[ECDSA_BURST_LEN * 99 / 100],
+                        lat[ECDSA_BURST_LEN - 1] );
+    }
+
+    if( ret != 0 )
+    {
+        PRINT_ERROR;
+    }
+
+    mbedtls_ecdsa_free( &ecdsa );
+    mbedtls_ecdsa_nonce_pool_free( &pool );
+    mbedtls_mpi_free( &r ); mbedtls_mpi_free( &s );
+}
+#endif /* MBEDTLS_ECDSA_NONCE_POOL && MBEDTLS_SHA256_C */
+
 typedef struct {
     char md4, md5, ripemd160, sha1, sha256, sha512,
          arc4, des3, des,
-         aes_cbc, aes_gcm, aes_ccm, aes_xts, chachapoly,
-         aes_cmac, des3_cmac,
+         aes_cbc, aes_gcm, aes_ccm, aes_xts, aes_bs, chachapoly,
+         cipher_iov, aes_cmac, des3_cmac, aes_kw,
          aria, camellia, blowfish, chacha20,
          poly1305,
-         havege, ctr_drbg, hmac_drbg,
-         rsa, dhm, ecdsa, ecdh;
+         havege, entropy, ctr_drbg, hmac_drbg, pbkdf2,
+         mpi, rsa, dhm, ecdsa, ecdh;
 } todo_list;
 
 int main( int argc, char *argv[] )
@@ -296,14 +1016,20 @@ int main( int argc, char *argv[] )
                 todo.aes_cbc = 1;
             else if( strcmp( argv[i], "aes_xts" ) == 0 )
                 todo.aes_xts = 1;
+            else if( strcmp( argv[i], "aes_bs" ) == 0 )
+                todo.aes_bs = 1;
             else if( strcmp( argv[i], "aes_gcm" ) == 0 )
                 todo.aes_gcm = 1;
             else if( strcmp( argv[i], "aes_ccm" ) == 0 )
                 todo.aes_ccm = 1;
             else if( strcmp( argv[i], "chachapoly" ) == 0 )
                 todo.chachapoly = 1;
+            else if( strcmp( argv[i], "cipher_iov" ) == 0 )
+                todo.cipher_iov = 1;
             else if( strcmp( argv[i], "aes_cmac" ) == 0 )
                 todo.aes_cmac = 1;
+            else if( strcmp( argv[i], "aes_kw" ) == 0 )
+                todo.aes_kw = 1;
             else if( strcmp( argv[i], "des3_cmac" ) == 0 )
                 todo.des3_cmac = 1;
             else if( strcmp( argv[i], "aria" ) == 0 )
@@ -318,10 +1044,16 @@ int main( int argc, char *argv[] )
                 todo.poly1305 = 1;
             else if( strcmp( argv[i], "havege" ) == 0 )
                 todo.havege = 1;
+            else if( strcmp( argv[i], "entropy" ) == 0 )
+                todo.entropy = 1;
             else if( strcmp( argv[i], "ctr_drbg" ) == 0 )
                 todo.ctr_drbg = 1;
             else if( strcmp( argv[i], "hmac_drbg" ) == 0 )
                 todo.hmac_drbg = 1;
+            else if( strcmp( argv[i], "pbkdf2" ) == 0 )
+                todo.pbkdf2 = 1;
+            else if( strcmp( argv[i], "mpi" ) == 0 )
+                todo.mpi = 1;
             else if( strcmp( argv[i], "rsa" ) == 0 )
                 todo.rsa = 1;
             else if( strcmp( argv[i], "dhm" ) == 0 )
@@ -345,6 +1077,10 @@ int main( int argc, char *argv[] )
 #endif
     memset( buf, 0xAA, sizeof( buf ) );
     memset( tmp, 0xBB, sizeof( tmp ) );
+#if defined(MBEDTLS_SHA1_C) || defined(MBEDTLS_SHA256_C) || \
+    defined(MBEDTLS_SHA512_C)
+    multi_setup();
+#endif
 
 #if defined(MBEDTLS_MD4_C)
     if( todo.md4 )
@@ -363,17 +1099,68 @@ int main( int argc, char *argv[] )
 
 #if defined(MBEDTLS_SHA1_C)
     if( todo.sha1 )
+    {
         TIME_AND_TSC( "SHA-1", mbedtls_sha1_ret( buf, BUFSIZE, tmp ) );
+        TIME_AND_TSC( "SHA-1 16x64B", sha1_seq() );
+        TIME_AND_TSC( "SHA-1 16x64B multi",
+                      mbedtls_sha1_ret_multi( multi_in, multi_len,
+                                              multi_outp, MULTI_COUNT ) );
+    }
 #endif
 
 #if defined(MBEDTLS_SHA256_C)
     if( todo.sha256 )
+    {
         TIME_AND_TSC( "SHA-256", mbedtls_sha256_ret( buf, BUFSIZE, tmp, 0 ) );
+        TIME_AND_TSC( "SHA-256 16x64B", sha256_seq() );
+        TIME_AND_TSC( "SHA-256 16x64B multi",
+                      mbedtls_sha256_ret_multi( multi_in, multi_len,
+                                                multi_outp, MULTI_COUNT, 0 ) );
+    }
+#endif
+
+#if defined(MBEDTLS_MD_C) && defined(MBEDTLS_SHA256_C)
+    if( todo.sha256 )
+    {
+        mbedtls_md_context_t md_ctx[MULTI_COUNT];
+        mbedtls_md_context_t *md_pctx[MULTI_COUNT];
+
+        for( i = 0; i < MULTI_COUNT; i++ )
+        {
+            mbedtls_md_init( &md_ctx[i] );
+            md_pctx[i] = &md_ctx[i];
+            if( mbedtls_md_setup( &md_ctx[i],
+                    mbedtls_md_info_from_type( MBEDTLS_MD_SHA256 ), 1 ) != 0 ||
+                mbedtls_md_hmac_starts( &md_ctx[i], tmp, 32 ) != 0 )
+                mbedtls_exit( 1 );
+        }
+
+        TIME_AND_TSC( "HMAC-SHA-256 16x64B", hmac_seq( md_ctx ) );
+        TIME_AND_TSC( "HMAC-SHA-256 16x64B multi",
+                      hmac_multi( md_ctx, md_pctx ) );
+
+        for( i = 0; i < MULTI_COUNT; i++ )
+            mbedtls_md_free( &md_ctx[i] );
+    }
 #endif
 
 #if defined(MBEDTLS_SHA512_C)
     if( todo.sha512 )
+    {
+        mbedtls_sha512_context sha512;
+
         TIME_AND_TSC( "SHA-512", mbedtls_sha512_ret( buf, BUFSIZE, tmp, 0 ) );
+
+        /* Large buffers: steady state of a long message, no padding */
+        mbedtls_sha512_init( &sha512 );
+        mbedtls_sha512_starts_ret( &sha512, 0 );
+        TIME_AND_TSC( "SHA-512 stream",
+                      mbedtls_sha512_update_ret( &sha512, buf, BUFSIZE ) );
+        mbedtls_sha512_free( &sha512 );
+
+        /* Small buffers: one or two blocks per message */
+        TIME_AND_TSC( "SHA-512 16x64B", sha512_seq() );
+    }
 #endif
 
 #if defined(MBEDTLS_ARC4_C)
@@ -470,6 +1257,45 @@ int main( int argc, char *argv[] )
 
             mbedtls_aes_xts_free( &ctx );
         }
+
+        memset( tmp, 0, sizeof( tmp ) );
+        mbedtls_aes_xts_setkey_enc( &ctx, tmp, 256 );
+
+        aes_xts_sectors_bench( &ctx, 512, 0, 1 );
+        aes_xts_sectors_bench( &ctx, 512, 1, 1 );
+        aes_xts_sectors_bench( &ctx, 4096, 0, 1 );
+        aes_xts_sectors_bench( &ctx, 4096, 1, 1 );
+#if defined(MBEDTLS_THREADING_PTHREAD)
+        aes_xts_sectors_bench( &ctx, 4096, 1, 4 );
+#endif
+
+        mbedtls_aes_xts_free( &ctx );
+    }
+#endif
+#if defined(MBEDTLS_AES_BITSLICE)
+    if( todo.aes_bs )
+    {
+        static const size_t lens[] = { 16, 64, 128, 1024 };
+        size_t k;
+        mbedtls_aes_context aes;
+
+        mbedtls_aes_init( &aes );
+        memset( buf, 0, sizeof( buf ) );
+        memset( tmp, 0, sizeof( tmp ) );
+        mbedtls_aes_setkey_enc( &aes, tmp, 128 );
+
+        for( k = 0; k < sizeof( lens ) / sizeof( lens[0] ); k++ )
+        {
+            mbedtls_snprintf( title, sizeof( title ), "AES-128 table %uB",
+                              (unsigned) lens[k] );
+            TIME_AND_TSC( title, aes_table_msgs( &aes, lens[k] ) );
+
+            mbedtls_snprintf( title, sizeof( title ), "AES-128 bitsliced %uB",
+                              (unsigned) lens[k] );
+            TIME_AND_TSC( title, aes_bitsliced_msgs( &aes, lens[k] ) );
+        }
+
+        mbedtls_aes_free( &aes );
     }
 #endif
 #if defined(MBEDTLS_GCM_C)
@@ -493,6 +1319,39 @@ int main( int argc, char *argv[] )
 
             mbedtls_gcm_free( &gcm );
         }
+
+        /* GHASH implementations: speed vs per-context table memory */
+        {
+            static const char * const ghash_names[] =
+                { "auto", "table4", "table8", "const-time" };
+            int mode;
+
+            for( mode = MBEDTLS_GCM_GHASH_AUTO; mode <= MBEDTLS_GCM_GHASH_CT;
+                 mode++ )
+            {
+                size_t mem = sizeof( mbedtls_gcm_context );
+
+                memset( buf, 0, sizeof( buf ) );
+                memset( tmp, 0, sizeof( tmp ) );
+                mbedtls_gcm_init( &gcm );
+                mbedtls_gcm_set_ghash_mode( &gcm, mode );
+                mbedtls_gcm_setkey( &gcm, MBEDTLS_CIPHER_ID_AES, tmp, 128 );
+
+                /* The 8-bit tables are allocated by the mode actually in
+                 * use, which for "auto" depends on the CPU and the config */
+                if( gcm.HT8 != NULL )
+                    mem += 256 * 2 * sizeof( uint64_t );
+
+                mbedtls_snprintf( title, sizeof( title ), "GCM-128 %s %uB",
+                                  ghash_names[mode], (unsigned) mem );
+
+                TIME_AND_TSC( title,
+                        mbedtls_gcm_crypt_and_tag( &gcm, MBEDTLS_GCM_ENCRYPT, BUFSIZE, tmp,
+                            12, NULL, 0, buf, buf, 16, tmp ) );
+
+                mbedtls_gcm_free( &gcm );
+            }
+        }
     }
 #endif
 #if defined(MBEDTLS_CCM_C)
@@ -538,10 +1397,31 @@ int main( int argc, char *argv[] )
         mbedtls_chachapoly_free( &chachapoly );
     }
 #endif
+#if defined(MBEDTLS_CIPHER_C)
+    if( todo.cipher_iov )
+    {
+#if defined(MBEDTLS_GCM_C) && defined(MBEDTLS_AES_C)
+        cipher_iov_bench( "AES-GCM-128 1504B", MBEDTLS_CIPHER_AES_128_GCM );
+#endif
+#if defined(MBEDTLS_CIPHER_MODE_CTR) && defined(MBEDTLS_AES_C)
+        cipher_iov_bench( "AES-CTR-128 1504B", MBEDTLS_CIPHER_AES_128_CTR );
+#endif
+#if defined(MBEDTLS_CIPHER_MODE_CBC) && defined(MBEDTLS_AES_C)
+        cipher_iov_bench( "AES-CBC-128 1504B", MBEDTLS_CIPHER_AES_128_CBC );
+#endif
+#if defined(MBEDTLS_CCM_C) && defined(MBEDTLS_AES_C)
+        cipher_iov_bench( "AES-CCM-128 1504B", MBEDTLS_CIPHER_AES_128_CCM );
+#endif
+#if defined(MBEDTLS_CHACHAPOLY_C)
+        cipher_iov_bench( "ChaChaPoly 1504B", MBEDTLS_CIPHER_CHACHA20_POLY1305 );
+#endif
+    }
+#endif
 #if defined(MBEDTLS_CMAC_C)
     if( todo.aes_cmac )
     {
         unsigned char output[16];
+        mbedtls_cipher_context_t cipher_ctx;
         const mbedtls_cipher_info_t *cipher_info;
         mbedtls_cipher_type_t cipher_type;
         int keysize;
@@ -567,8 +1447,67 @@ int main( int argc, char *argv[] )
         TIME_AND_TSC( "AES-CMAC-PRF-128",
                       mbedtls_aes_cmac_prf_128( tmp, 16, buf, BUFSIZE,
                                                 output ) );
+
+        mbedtls_cipher_init( &cipher_ctx );
+        if( mbedtls_cipher_setup( &cipher_ctx, mbedtls_cipher_info_from_type(
+                                  MBEDTLS_CIPHER_AES_128_ECB ) ) != 0 ||
+            mbedtls_cipher_cmac_starts( &cipher_ctx, tmp, 128 ) != 0 )
+            mbedtls_exit( 1 );
+
+        TIME_AND_TSC( "AES-CMAC 16x64B", cmac_seq( &cipher_ctx ) );
+        TIME_AND_TSC( "AES-CMAC 16x64B multi",
+                      mbedtls_cipher_cmac_multi( &cipher_ctx, multi_in,
+                                                 multi_len, multi_outp,
+                                                 MULTI_COUNT ) );
+
+        mbedtls_cipher_free( &cipher_ctx );
     }
 #endif /* MBEDTLS_CMAC_C */
+#if defined(MBEDTLS_NIST_KW_C)
+    if( todo.aes_kw )
+    {
+        mbedtls_nist_kw_context kw_wrap, kw_unwrap;
+
+        memset( tmp, 0, sizeof( tmp ) );
+        mbedtls_nist_kw_init( &kw_wrap );
+        mbedtls_nist_kw_init( &kw_unwrap );
+        if( mbedtls_nist_kw_setkey( &kw_wrap, MBEDTLS_CIPHER_ID_AES,
+                                    tmp, 256, 1 ) != 0 ||
+            mbedtls_nist_kw_setkey( &kw_unwrap, MBEDTLS_CIPHER_ID_AES,
+                                    tmp, 256, 0 ) != 0 )
+            mbedtls_exit( 1 );
+
+        kw_bench_setup();
+
+        TIME_AND_TSC( "AES-KW-256 wrap 32x32B", kw_seq( &kw_wrap, 1 ) );
+        TIME_AND_TSC( "AES-KW-256 wrap multi",
+                      mbedtls_nist_kw_wrap_multi( &kw_wrap, MBEDTLS_KW_MODE_KW,
+                                                  kw_wrap_jobs,
+                                                  KW_BENCH_KEYS ) );
+#if defined(MBEDTLS_THREADING_PTHREAD) && !defined(MBEDTLS_NIST_KW_ALT)
+        TIME_AND_TSC( "AES-KW-256 wrap 4 thr",
+                      mbedtls_nist_kw_wrap_multi_threads( &kw_wrap,
+                                MBEDTLS_KW_MODE_KW, kw_wrap_jobs,
+                                KW_BENCH_KEYS, 4 ) );
+#endif
+
+        TIME_AND_TSC( "AES-KW-256 unwrap 32x32B", kw_seq( &kw_unwrap, 0 ) );
+        TIME_AND_TSC( "AES-KW-256 unwrap multi",
+                      mbedtls_nist_kw_unwrap_multi( &kw_unwrap,
+                                                    MBEDTLS_KW_MODE_KW,
+                                                    kw_unwrap_jobs,
+                                                    KW_BENCH_KEYS ) );
+#if defined(MBEDTLS_THREADING_PTHREAD) && !defined(MBEDTLS_NIST_KW_ALT)
+        TIME_AND_TSC( "AES-KW-256 unwrap 4 thr",
+                      mbedtls_nist_kw_unwrap_multi_threads( &kw_unwrap,
+                                MBEDTLS_KW_MODE_KW, kw_unwrap_jobs,
+                                KW_BENCH_KEYS, 4 ) );
+#endif
+
+        mbedtls_nist_kw_free( &kw_wrap );
+        mbedtls_nist_kw_free( &kw_unwrap );
+    }
+#endif /* MBEDTLS_NIST_KW_C */
 #endif /* MBEDTLS_AES_C */
 
 #if defined(MBEDTLS_ARIA_C) && defined(MBEDTLS_CIPHER_MODE_CBC)
@@ -588,6 +1527,41 @@ int main( int argc, char *argv[] )
             TIME_AND_TSC( title,
                     mbedtls_aria_crypt_cbc( &aria, MBEDTLS_ARIA_ENCRYPT,
                         BUFSIZE, tmp, buf, buf ) );
+
+            mbedtls_snprintf( title, sizeof( title ), "ARIA-CBC-%d dec", keysize );
+            mbedtls_aria_setkey_dec( &aria, tmp, keysize );
+
+            TIME_AND_TSC( title,
+                    mbedtls_aria_crypt_cbc( &aria, MBEDTLS_ARIA_DECRYPT,
+                        BUFSIZE, tmp, buf, buf ) );
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+            {
+                size_t nc_off = 0;
+                unsigned char stream_block[16];
+
+                mbedtls_snprintf( title, sizeof( title ), "ARIA-CTR-%d", keysize );
+                mbedtls_aria_setkey_enc( &aria, tmp, keysize );
+
+                TIME_AND_TSC( title,
+                        mbedtls_aria_crypt_ctr( &aria, BUFSIZE, &nc_off,
+                            tmp, stream_block, buf, buf ) );
+            }
+#endif
+#if defined(MBEDTLS_GCM_C)
+            {
+                mbedtls_gcm_context gcm;
+
+                mbedtls_gcm_init( &gcm );
+                mbedtls_snprintf( title, sizeof( title ), "ARIA-GCM-%d", keysize );
+                mbedtls_gcm_setkey( &gcm, MBEDTLS_CIPHER_ID_ARIA, tmp, keysize );
+
+                TIME_AND_TSC( title,
+                        mbedtls_gcm_crypt_and_tag( &gcm, MBEDTLS_GCM_ENCRYPT,
+                            BUFSIZE, tmp, 12, NULL, 0, buf, buf, 16, tmp ) );
+
+                mbedtls_gcm_free( &gcm );
+            }
+#endif
         }
         mbedtls_aria_free( &aria );
     }
@@ -610,6 +1584,41 @@ int main( int argc, char *argv[] )
             TIME_AND_TSC( title,
                     mbedtls_camellia_crypt_cbc( &camellia, MBEDTLS_CAMELLIA_ENCRYPT,
                         BUFSIZE, tmp, buf, buf ) );
+
+            mbedtls_snprintf( title, sizeof( title ), "CAMELLIA-CBC-%d dec", keysize );
+            mbedtls_camellia_setkey_dec( &camellia, tmp, keysize );
+
+            TIME_AND_TSC( title,
+                    mbedtls_camellia_crypt_cbc( &camellia, MBEDTLS_CAMELLIA_DECRYPT,
+                        BUFSIZE, tmp, buf, buf ) );
+#if defined(MBEDTLS_CIPHER_MODE_CTR)
+            {
+                size_t nc_off = 0;
+                unsigned char stream_block[16];
+
+                mbedtls_snprintf( title, sizeof( title ), "CAMELLIA-CTR-%d", keysize );
+                mbedtls_camellia_setkey_enc( &camellia, tmp, keysize );
+
+                TIME_AND_TSC( title,
+                        mbedtls_camellia_crypt_ctr( &camellia, BUFSIZE, &nc_off,
+                            tmp, stream_block, buf, buf ) );
+            }
+#endif
+#if defined(MBEDTLS_GCM_C)
+            {
+                mbedtls_gcm_context gcm;
+
+                mbedtls_gcm_init( &gcm );
+                mbedtls_snprintf( title, sizeof( title ), "CAMELLIA-GCM-%d", keysize );
+                mbedtls_gcm_setkey( &gcm, MBEDTLS_CIPHER_ID_CAMELLIA, tmp, keysize );
+
+                TIME_AND_TSC( title,
+                        mbedtls_gcm_crypt_and_tag( &gcm, MBEDTLS_GCM_ENCRYPT,
+                            BUFSIZE, tmp, 12, NULL, 0, buf, buf, 16, tmp ) );
+
+                mbedtls_gcm_free( &gcm );
+            }
+#endif
         }
         mbedtls_camellia_free( &camellia );
     }
@@ -663,10 +1672,25 @@ int main( int argc, char *argv[] )
     }
 #endif
 
+#if defined(MBEDTLS_ENTROPY_C)
+    if( todo.entropy )
+    {
+        entropy_bench( 1, 0 );
+#if defined(MBEDTLS_THREADING_PTHREAD)
+        entropy_bench( 4, 0 );
+        entropy_bench( ENTROPY_BENCH_THREADS, 0 );
+#if defined(MBEDTLS_ENTROPY_SHARDS)
+        entropy_bench( ENTROPY_BENCH_THREADS, 1 );
+#endif
+#endif
+    }
+#endif
+
 #if defined(MBEDTLS_CTR_DRBG_C)
     if( todo.ctr_drbg )
     {
         mbedtls_ctr_drbg_context ctr_drbg;
+        unsigned char prefetch[DRBG_PREFETCH_LEN];
 
         mbedtls_ctr_drbg_init( &ctr_drbg );
 
@@ -674,6 +1698,13 @@ int main( int argc, char *argv[] )
             mbedtls_exit(1);
         TIME_AND_TSC( "CTR_DRBG (NOPR)",
                 mbedtls_ctr_drbg_random( &ctr_drbg, buf, BUFSIZE ) );
+        ctr_drbg_bulk_bench( &ctr_drbg );
+
+        drbg_small_bench( "CTR_DRBG", mbedtls_ctr_drbg_random, &ctr_drbg );
+        mbedtls_ctr_drbg_set_prefetch( &ctr_drbg, prefetch,
+                                       sizeof( prefetch ), 0 );
+        drbg_small_bench( "CTR_DRBG pf", mbedtls_ctr_drbg_random, &ctr_drbg );
+        mbedtls_ctr_drbg_set_prefetch( &ctr_drbg, NULL, 0, 0 );
 
         if( mbedtls_ctr_drbg_seed( &ctr_drbg, myrand, NULL, NULL, 0 ) != 0 )
             mbedtls_exit(1);
@@ -689,6 +1720,7 @@ int main( int argc, char *argv[] )
     {
         mbedtls_hmac_drbg_context hmac_drbg;
         const mbedtls_md_info_t *md_info;
+        unsigned char prefetch[DRBG_PREFETCH_LEN];
 
         mbedtls_hmac_drbg_init( &hmac_drbg );
 
@@ -715,9 +1747,19 @@ int main( int argc, char *argv[] )
 
         if( mbedtls_hmac_drbg_seed( &hmac_drbg, md_info, myrand, NULL, NULL, 0 ) != 0 )
             mbedtls_exit(1);
+        mbedtls_hmac_drbg_set_prediction_resistance( &hmac_drbg,
+                                             MBEDTLS_HMAC_DRBG_PR_OFF );
         TIME_AND_TSC( "HMAC_DRBG SHA-256 (NOPR)",
                 mbedtls_hmac_drbg_random( &hmac_drbg, buf, BUFSIZE ) );
 
+        drbg_small_bench( "HMAC_DRBG SHA-256", mbedtls_hmac_drbg_random,
+                          &hmac_drbg );
+        mbedtls_hmac_drbg_set_prefetch( &hmac_drbg, prefetch,
+                                        sizeof( prefetch ), 0 );
+        drbg_small_bench( "HMAC_DRBG SHA-256 pf", mbedtls_hmac_drbg_random,
+                          &hmac_drbg );
+        mbedtls_hmac_drbg_set_prefetch( &hmac_drbg, NULL, 0, 0 );
+
         if( mbedtls_hmac_drbg_seed( &hmac_drbg, md_info, myrand, NULL, NULL, 0 ) != 0 )
             mbedtls_exit(1);
         mbedtls_hmac_drbg_set_prediction_resistance( &hmac_drbg,
@@ -729,14 +1771,103 @@ int main( int argc, char *argv[] )
     }
 #endif
 
+#if defined(MBEDTLS_PKCS5_C)
+    if( todo.pbkdf2 )
+    {
+#if defined(MBEDTLS_SHA1_C)
+        pbkdf2_bench( "PBKDF2-SHA-1 20B", MBEDTLS_MD_SHA1, 20 );
+        pbkdf2_bench( "PBKDF2-SHA-1 160B", MBEDTLS_MD_SHA1, 160 );
+#endif
+#if defined(MBEDTLS_SHA256_C)
+        pbkdf2_bench( "PBKDF2-SHA-256 32B", MBEDTLS_MD_SHA256, 32 );
+        pbkdf2_bench( "PBKDF2-SHA-256 128B", MBEDTLS_MD_SHA256, 128 );
+#endif
+#if defined(MBEDTLS_SHA512_C)
+        pbkdf2_bench( "PBKDF2-SHA-512 64B", MBEDTLS_MD_SHA512, 64 );
+#endif
+    }
+#endif
+
+#if defined(MBEDTLS_BIGNUM_C)
+    if( todo.mpi )
+    {
+        /*
+         * The Montgomery multiplication of mbedtls_mpi_exp_mod() is timed
+         * through an exponentiation by 65537 (16 squarings, 1 multiplication)
+         */
+        int mpi_sizes[] = { 256, 1024, 2048, 3072, 4096 };
+        mbedtls_mpi A, B, E, N, X, RR;
+
+        mbedtls_mpi_init( &A ); mbedtls_mpi_init( &B ); mbedtls_mpi_init( &E );
+        mbedtls_mpi_init( &N ); mbedtls_mpi_init( &X ); mbedtls_mpi_init( &RR );
+
+        for( i = 0; (size_t) i < sizeof( mpi_sizes ) / sizeof( mpi_sizes[0] ); i++ )
+        {
+            size_t len = mpi_sizes[i] / 8;
+
+            mbedtls_mpi_free( &RR );
+
+            if( mbedtls_mpi_fill_random( &A, len, myrand, NULL ) != 0 ||
+                mbedtls_mpi_fill_random( &B, len, myrand, NULL ) != 0 ||
+                mbedtls_mpi_fill_random( &N, len, myrand, NULL ) != 0 ||
+                mbedtls_mpi_set_bit( &N, mpi_sizes[i] - 1, 1 ) != 0 ||
+                mbedtls_mpi_set_bit( &N, 0, 1 ) != 0 ||
+                mbedtls_mpi_mod_mpi( &A, &A, &N ) != 0 )
+            {
+                mbedtls_exit( 1 );
+            }
+
+            mbedtls_snprintf( title, sizeof( title ), "MPI-%d", mpi_sizes[i] );
+
+            TIME_PUBLIC( title, "mul",
+                    ret = mbedtls_mpi_mul_mpi( &X, &A, &B ) );
+
+            TIME_PUBLIC( title, "sqr",
+                    ret = mbedtls_mpi_mul_mpi( &X, &A, &A ) );
+
+            if( mbedtls_mpi_lset( &E, 65537 ) != 0 )
+                mbedtls_exit( 1 );
+
+            TIME_PUBLIC( title, "exp 65537",
+                    ret = mbedtls_mpi_exp_mod( &X, &A, &E, &N, &RR ) );
+
+            if( mbedtls_mpi_fill_random( &E, len, myrand, NULL ) != 0 )
+                mbedtls_exit( 1 );
+
+            TIME_PUBLIC( title, "exp_mod",
+                    ret = mbedtls_mpi_exp_mod( &X, &A, &E, &N, &RR ) );
+        }
+
+        mbedtls_mpi_free( &A ); mbedtls_mpi_free( &B ); mbedtls_mpi_free( &E );
+        mbedtls_mpi_free( &N ); mbedtls_mpi_free( &X ); mbedtls_mpi_free( &RR );
+    }
+#endif
+
 #if defined(MBEDTLS_RSA_C) && defined(MBEDTLS_GENPRIME)
     if( todo.rsa )
     {
         int keysize;
+        int rsa_sizes[] = { 2048, 3072, 4096 };
+        const char *kernel = "";
         mbedtls_rsa_context rsa;
-        for( keysize = 2048; keysize <= 4096; keysize *= 2 )
+#if defined(MBEDTLS_RSA_CRT_POOL)
+        mbedtls_rsa_crt_pool crt_pool;
+
+        mbedtls_rsa_crt_pool_init( &crt_pool );
+        if( mbedtls_rsa_crt_pool_start( &crt_pool, 1 ) != 0 )
+            mbedtls_printf( "  RSA CRT pool: no worker started\n" );
+#endif
+
+#if defined(MBEDTLS_ADX_C) && defined(MBEDTLS_HAVE_X86_64)
+        if( mbedtls_adx_has_support( MBEDTLS_ADX_BMI2 | MBEDTLS_ADX_ADX ) )
+            kernel = " (ADX)";
+#endif
+
+        for( i = 0; (size_t) i < sizeof( rsa_sizes ) / sizeof( rsa_sizes[0] ); i++ )
         {
-            mbedtls_snprintf( title, sizeof( title ), "RSA-%d", keysize );
+            keysize = rsa_sizes[i];
+            mbedtls_snprintf( title, sizeof( title ), "RSA-%d%s", keysize,
+                              kernel );
 
             mbedtls_rsa_init( &rsa, MBEDTLS_RSA_PKCS_V15, 0 );
             mbedtls_rsa_gen_key( &rsa, myrand, NULL, keysize, 65537 );
@@ -749,8 +1880,26 @@ int main( int argc, char *argv[] )
                     buf[0] = 0;
                     ret = mbedtls_rsa_private( &rsa, myrand, NULL, buf, buf ) );
 
+            TIME_LATENCY( title, "private",
+                    buf[0] = 0;
+                    ret = mbedtls_rsa_private( &rsa, myrand, NULL, buf, buf ) );
+
+#if defined(MBEDTLS_RSA_CRT_POOL)
+            mbedtls_snprintf( title, sizeof( title ), "RSA-%d%s CRT pool",
+                              keysize, kernel );
+            mbedtls_rsa_set_crt_pool( &rsa, &crt_pool );
+
+            TIME_LATENCY( title, "private",
+                    buf[0] = 0;
+                    ret = mbedtls_rsa_private( &rsa, myrand, NULL, buf, buf ) );
+#endif
+
             mbedtls_rsa_free( &rsa );
         }
+
+#if defined(MBEDTLS_RSA_CRT_POOL)
+        mbedtls_rsa_crt_pool_free( &crt_pool );
+#endif
     }
 #endif
 
@@ -837,6 +1986,20 @@ int main( int argc, char *argv[] )
             mbedtls_ecdsa_free( &ecdsa );
         }
 
+        /* First operation on a freshly loaded group */
+        for( curve_info = mbedtls_ecp_curve_list();
+             curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
+             curve_info++ )
+        {
+            mbedtls_snprintf( title, sizeof( title ), "ECDSA-%s",
+                                              curve_info->name );
+            TIME_PUBLIC( title, "fresh keygen",
+                    mbedtls_ecdsa_init( &ecdsa );
+                    ret = mbedtls_ecdsa_genkey( &ecdsa, curve_info->grp_id,
+                                                myrand, NULL );
+                    mbedtls_ecdsa_free( &ecdsa ) );
+        }
+
         for( curve_info = mbedtls_ecp_curve_list();
              curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
              curve_info++ )
@@ -857,8 +2020,26 @@ int main( int argc, char *argv[] )
                     ret = mbedtls_ecdsa_read_signature( &ecdsa, buf, curve_info->bit_size,
                                                 tmp, sig_len ) );
 
+#if defined(MBEDTLS_ECP_PRECOMP_CACHE)
+            if( mbedtls_ecp_keypair_precompute( &ecdsa, 16384 ) == 0 )
+            {
+                TIME_PUBLIC( title, "verify precomp",
+                        ret = mbedtls_ecdsa_read_signature( &ecdsa, buf, curve_info->bit_size,
+                                                    tmp, sig_len ) );
+            }
+#endif
+
             mbedtls_ecdsa_free( &ecdsa );
         }
+
+#if defined(MBEDTLS_ECDSA_NONCE_POOL)
+        for( curve_info = mbedtls_ecp_curve_list();
+             curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
+             curve_info++ )
+        {
+            ecdsa_burst_bench( curve_info );
+        }
+#endif
     }
 #endif
 
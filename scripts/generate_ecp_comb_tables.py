@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""Generate the static base point comb tables in library/ecp_curves.c.
+
+For each short Weierstrass curve, the domain parameters are read from the
+constants already present in ecp_curves.c, the table that ecp_mul_comb()
+would compute for the base point is computed here, and the table is written
+back into ecp_curves.c right after the domain parameters of the curve.
+Running the script again replaces the tables it generated before.
+
+Usage: scripts/generate_ecp_comb_tables.py [library/ecp_curves.c]
+"""
+
+import re
+import sys
+
+BEGIN = '/*\n * Base point comb table for %s\n'
+END = '#endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 */\n'
+
+def parse_constants(text):
+    """Return {name: (value, [group sizes in bytes])} for the mpi constants."""
+    consts = {}
+    pattern = re.compile(r'static const mbedtls_mpi_uint (\w+)\[\] = \{\n'
+                         r'(.*?)\n\};', re.S)
+    for m in pattern.finditer(text):
+        data = []
+        groups = []
+        for g in re.finditer(r'BYTES_TO_T_UINT_(\d)\(([^)]*)\)', m.group(2)):
+            bytes_ = [int(b, 16) for b in g.group(2).split(',')]
+            groups.append(int(g.group(1)))
+            data.extend(bytes_)
+        consts[m.group(1)] = (int.from_bytes(bytes(data), 'little'), groups)
+    return consts
+
+def inverse(x, p):
+    return pow(x % p, p - 2, p)
+
+def add(P, Q, a, p):
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    if P[0] == Q[0]:
+        if (P[1] + Q[1]) % p == 0:
+            return None
+        l = (3 * P[0] * P[0] + a) * inverse(2 * P[1], p) % p
+    else:
+        l = (Q[1] - P[1]) * inverse(Q[0] - P[0], p) % p
+    x = (l * l - P[0] - Q[0]) % p
+    return (x, (l * (P[0] - x) - P[1]) % p)
+
+def comb_table(G, a, p, nbits):
+    """The table of ecp_precompute_comb() for the window of ecp_pick_window_size()."""
+    w = (5 if nbits >= 384 else 4) + 1
+    d = (nbits + w - 1) // w
+    powers = [G]
+    for _ in range(w - 1):
+        Q = powers[-1]
+        for _ in range(d):
+            Q = add(Q, Q, a, p)
+        powers.append(Q)
+    table = []
+    for i in range(1 << (w - 1)):
+        Q = G
+        for j in range(1, w):
+            if i >> (j - 1) & 1:
+                Q = add(Q, powers[j], a, p)
+        table.append(Q)
+    return w, table
+
+def format_mpi(name, value, groups):
+    data = value.to_bytes(sum(groups), 'little')
+    lines = ['static const mbedtls_mpi_uint %s[] = {' % name]
+    pos = 0
+    for size in groups:
+        chunk = ', '.join('0x%02X' % b for b in data[pos:pos + size])
+        lines.append('    BYTES_TO_T_UINT_%d( %s ),' % (size, chunk))
+        pos += size
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+def generate(curve, consts):
+    p, groups = consts[curve + '_p']
+    a = consts[curve + '_a'][0] if curve + '_a' in consts else p - 3
+    G = (consts[curve + '_gx'][0], consts[curve + '_gy'][0])
+    nbits = consts[curve + '_n'][0].bit_length()
+    w, table = comb_table(G, a, p, nbits)
+
+    out = BEGIN % curve
+    out += ' * (w = %d, generated by scripts/generate_ecp_comb_tables.py)\n */\n' % w
+    out += '#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1\n'
+    for i, (x, y) in enumerate(table):
+        out += format_mpi('%s_T_%d_X' % (curve, i), x, groups)
+        out += format_mpi('%s_T_%d_Y' % (curve, i), y, groups)
+    out += 'static const mbedtls_ecp_point %s_T[%d] = {\n' % (curve, len(table))
+    for i in range(len(table)):
+        out += '    ECP_POINT_INIT_XY_Z1( %s_T_%d_X, %s_T_%d_Y ),\n' % (
+            curve, i, curve, i)
+    out += '};\n#else\n#define %s_T NULL\n' % curve
+    out += END
+    return out
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else 'library/ecp_curves.c'
+    with open(path) as f:
+        text = f.read()
+
+    # Drop the tables of a previous run
+    text = re.sub(r'/\*\n \* Base point comb table for .*?' + re.escape(END),
+                  '', text, flags=re.S)
+
+    consts = parse_constants(text)
+    curves = [name[:-3] for name in consts if name.endswith('_gy')]
+    for curve in curves:
+        n_def = text.index('static const mbedtls_mpi_uint %s_n[]' % curve)
+        pos = text.index('#endif /* MBEDTLS_ECP_DP_', n_def)
+        text = text[:pos] + generate(curve, consts) + text[pos:]
+
+    with open(path, 'w') as f:
+        f.write(text)
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Generate the base point table of the P-256 backend in library/ecp_p256.c.
+
+p256_base_table[j][i] is (i + 1) * 2^(W * j) * G in affine coordinates, with
+both coordinates in Montgomery form (times 2^256 mod p) as four 64-bit limbs,
+least significant first. W and the number of windows are read from the
+P256_BASE_W and P256_BASE_WINDOWS macros of ecp_p256.c. Running the script
+again replaces the table it generated before.
+
+Usage: scripts/generate_ecp_p256_table.py [library/ecp_p256.c]
+"""
+
+import re
+import sys
+
+P = 2**256 - 2**224 + 2**192 + 2**96 - 1
+A = P - 3
+GX = 0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296
+GY = 0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5
+
+def add(P1, P2):
+    if P1 is None:
+        return P2
+    if P2 is None:
+        return P1
+    if P1[0] == P2[0]:
+        if (P1[1] + P2[1]) % P == 0:
+            return None
+        l = (3 * P1[0] * P1[0] + A) * pow(2 * P1[1], P - 2, P) % P
+    else:
+        l = (P2[1] - P1[1]) * pow(P2[0] - P1[0], P - 2, P) % P
+    x = (l * l - P1[0] - P2[0]) % P
+    return (x, (l * (P1[0] - x) - P1[1]) % P)
+
+def limbs(x):
+    x = x * 2**256 % P
+    return [(x >> (64 * i)) & (2**64 - 1) for i in range(4)]
+
+def table(w, windows):
+    out = ''
+    base = (GX, GY)
+    for j in range(windows):
+        out += '    {\n'
+        Q = None
+        for i in range(1 << (w - 1)):
+            Q = add(Q, base)
+            words = limbs(Q[0]) + limbs(Q[1])
+            lines = ['UL64(0x%016X), UL64(0x%016X)' % (words[k], words[k + 1])
+                     for k in range(0, 8, 2)]
+            out += '        { ' + ',\n          '.join(lines) + ' },\n'
+        out += '    },\n'
+        for _ in range(w):
+            base = add(base, base)
+    return out
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else 'library/ecp_p256.c'
+    with open(path) as f:
+        text = f.read()
+
+    w = int(re.search(r'#define P256_BASE_W +(\d+)', text).group(1))
+    windows = int(re.search(r'#define P256_BASE_WINDOWS +(\d+)',
+                            text).group(1))
+
+    start = re.search(r'static const uint64_t p256_base_table\[.*?\] = \{\n',
+                      text)
+    end = text.index('\n};\n', start.end() - 1) + 1
+    text = text[:start.end()] + table(w, windows) + text[end:]
+
+    with open(path, 'w') as f:
+        f.write(text)
+
+if __name__ == '__main__':
+    main()
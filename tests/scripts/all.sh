@@ -753,6 +753,103 @@ make CC=gcc CFLAGS='-Werror -Wall -Wextra'
 msg "test: AES_FEWER_TABLES + AES_ROM_TABLES"
 make test
 
+msg "build: default config with AES_BITSLICE enabled"
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_AES_BITSLICE
+scripts/config.pl unset MBEDTLS_AESNI_C # run the bitsliced code on any host
+make CC=gcc CFLAGS='-Werror -Wall -Wextra'
+
+msg "test: AES_BITSLICE"
+make test
+
+msg "build: default config with sharded entropy and pthread"
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_ENTROPY_SHARDS 8
+scripts/config.pl set MBEDTLS_THREADING_C
+scripts/config.pl set MBEDTLS_THREADING_PTHREAD
+make CC=gcc CFLAGS='-Werror -Wall -Wextra' LDFLAGS='-lpthread'
+
+msg "test: ENTROPY_SHARDS + THREADING_PTHREAD"
+make LDFLAGS='-lpthread' test
+
+msg "build: default config with sharded entropy, pthread and NV seed"
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_ENTROPY_SHARDS 8
+scripts/config.pl set MBEDTLS_THREADING_C
+scripts/config.pl set MBEDTLS_THREADING_PTHREAD
+scripts/config.pl set MBEDTLS_ENTROPY_NV_SEED
+make CC=gcc CFLAGS='-Werror -Wall -Wextra' LDFLAGS='-lpthread'
+
+msg "test: ENTROPY_SHARDS + THREADING_PTHREAD + ENTROPY_NV_SEED"
+make LDFLAGS='-lpthread' test
+
+msg "build: default config with ECP_P256_C enabled"
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_ECP_P256_C
+make CC=gcc CFLAGS='-Werror -Wall -Wextra'
+
+msg "test: ECP_P256_C"
+make test
+
+msg "build: ECP_P256_C without MBEDTLS_HAVE_ASM"
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_ECP_P256_C
+scripts/config.pl unset MBEDTLS_HAVE_ASM
+scripts/config.pl unset MBEDTLS_ADX_C
+scripts/config.pl unset MBEDTLS_AESNI_C
+scripts/config.pl unset MBEDTLS_SHANI_C
+scripts/config.pl unset MBEDTLS_PADLOCK_C
+make CC=gcc CFLAGS='-Werror -Wall -Wextra'
+
+msg "test: ECP_P256_C without MBEDTLS_HAVE_ASM"
+make test
+
+msg "build: default config with ECP_PRECOMP_CACHE enabled"
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_ECP_PRECOMP_CACHE
+scripts/config.pl set MBEDTLS_ECP_PRECOMP_PSA_SIZE 16384
+make CC=gcc CFLAGS='-Werror -Wall -Wextra'
+
+msg "test: ECP_PRECOMP_CACHE"
+make test
+
+msg "build: default config with ECDSA_NONCE_POOL enabled"
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_ECDSA_NONCE_POOL
+make CC=gcc CFLAGS='-Werror -Wall -Wextra'
+
+msg "test: ECDSA_NONCE_POOL"
+make test
+
+msg "build: default config with ECDSA_NONCE_POOL and pthread"
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_ECDSA_NONCE_POOL
+scripts/config.pl set MBEDTLS_THREADING_C
+scripts/config.pl set MBEDTLS_THREADING_PTHREAD
+make CC=gcc CFLAGS='-Werror -Wall -Wextra' LDFLAGS='-lpthread'
+
+msg "test: ECDSA_NONCE_POOL + THREADING_PTHREAD"
+make LDFLAGS='-lpthread' test
+
+msg "build: default config with RSA_CRT_POOL"
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_RSA_CRT_POOL
+scripts/config.pl set MBEDTLS_THREADING_C
+scripts/config.pl set MBEDTLS_THREADING_PTHREAD
+make CC=gcc CFLAGS='-Werror -Wall -Wextra' LDFLAGS='-lpthread'
+
+msg "test: RSA_CRT_POOL"
+make LDFLAGS='-lpthread' test
+
 if uname -a | grep -F Linux >/dev/null; then
     msg "build/test: make shared" # ~ 40s
     cleanup
@@ -794,7 +891,9 @@ msg "build: gcc, force 32-bit bignum limbs"
 cleanup
 cp "$CONFIG_H" "$CONFIG_BAK"
 scripts/config.pl unset MBEDTLS_HAVE_ASM
+scripts/config.pl unset MBEDTLS_ADX_C
 scripts/config.pl unset MBEDTLS_AESNI_C
+scripts/config.pl unset MBEDTLS_SHANI_C
 scripts/config.pl unset MBEDTLS_PADLOCK_C
 make CC=gcc CFLAGS='-Werror -Wall -Wextra -DMBEDTLS_HAVE_INT32'
 
@@ -805,7 +904,9 @@ msg "build: gcc, force 64-bit bignum limbs"
 cleanup
 cp "$CONFIG_H" "$CONFIG_BAK"
 scripts/config.pl unset MBEDTLS_HAVE_ASM
+scripts/config.pl unset MBEDTLS_ADX_C
 scripts/config.pl unset MBEDTLS_AESNI_C
+scripts/config.pl unset MBEDTLS_SHANI_C
 scripts/config.pl unset MBEDTLS_PADLOCK_C
 make CC=gcc CFLAGS='-Werror -Wall -Wextra -DMBEDTLS_HAVE_INT64'
 
@@ -836,6 +937,15 @@ make CFLAGS='-Werror -O1'
 msg "test: MBEDTLS_NO_64BIT_MULTIPLICATION native" # ~ 10s
 make test
 
+msg "build: MBEDTLS_MPI_KARATSUBA_THRESHOLD=4" # ~ 10s
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_MPI_KARATSUBA_THRESHOLD 4
+make CFLAGS='-Werror -O1'
+
+msg "test: MBEDTLS_MPI_KARATSUBA_THRESHOLD=4" # ~ 10s
+make test
+
 
 msg "build: arm-none-eabi-gcc, make" # ~ 10s
 cleanup
@@ -981,6 +1091,8 @@ if uname -a | grep 'Linux.*x86_64' >/dev/null; then
     cleanup
     cp "$CONFIG_H" "$CONFIG_BAK"
     scripts/config.pl unset MBEDTLS_AESNI_C # memsan doesn't grok asm
+    scripts/config.pl unset MBEDTLS_SHANI_C # memsan doesn't grok asm
+    scripts/config.pl unset MBEDTLS_ADX_C # memsan doesn't grok asm
     CC=clang cmake -D CMAKE_BUILD_TYPE:String=MemSan .
     make
 
@@ -67,3 +67,5 @@ check()
 check scripts/generate_errors.pl library/error.c
 check scripts/generate_features.pl library/version_features.c
 check scripts/generate_visualc_files.pl visualc/VS2010
+check scripts/generate_ecp_comb_tables.py library/ecp_curves.c
+check scripts/generate_ecp_p256_table.py library/ecp_p256.c